@@ -0,0 +1,160 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__ALLOCATION_AUDIT_HPP_
+#define RCLCPP__ALLOCATION_AUDIT_HPP_
+
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+
+/// Declare that application initialization is complete.
+/**
+ * Allocations recorded by the allocation audit (see
+ * rclcpp::allocation_audit) after this call are counted as post-init, which
+ * is the set that matters when certifying "no heap allocation after init".
+ * Typically called once, after all nodes, entities, and executors have been
+ * created and before spinning starts.
+ */
+RCLCPP_PUBLIC
+void
+mark_init_complete();
+
+/// Return whether mark_init_complete() has been called.
+RCLCPP_PUBLIC
+bool
+init_complete();
+
+/// Built-in accounting for the library's internal allocation points.
+/**
+ * When enabled, the known internal allocation points (executor handle
+ * containers, message conversions in AnySubscriptionCallback, promise
+ * creation in Client, the parameter maps in NodeParameters) record the
+ * callsite and size of each allocation, split into pre- and post-init phases
+ * by rclcpp::mark_init_complete(). The report answers the question an
+ * LD_PRELOAD malloc shim is usually abused for: which allocation sites are
+ * still live after initialization, and therefore need to be preallocated or
+ * eliminated.
+ *
+ * Auditing is disabled by default and the only cost in that state is one
+ * atomic flag load per instrumented callsite. Recording takes a lock, so
+ * audit mode is for qualification runs, not production.
+ */
+namespace allocation_audit
+{
+
+/// Accumulated allocations of one callsite, split by phase.
+struct CallsiteReport
+{
+  /// Name of the allocation site, e.g. "Client::async_send_request".
+  std::string callsite;
+  /// Number of allocations recorded before mark_init_complete().
+  size_t pre_init_count;
+  /// Bytes recorded before mark_init_complete().
+  size_t pre_init_bytes;
+  /// Number of allocations recorded after mark_init_complete().
+  size_t post_init_count;
+  /// Bytes recorded after mark_init_complete().
+  size_t post_init_bytes;
+};
+
+/// Enable recording of internal allocations.
+RCLCPP_PUBLIC
+void
+enable();
+
+/// Disable recording of internal allocations.
+RCLCPP_PUBLIC
+void
+disable();
+
+/// Return whether recording is currently enabled.
+RCLCPP_PUBLIC
+bool
+enabled();
+
+/// Record an allocation, a no-op unless auditing is enabled.
+/**
+ * \param[in] callsite Name of the allocation site; must point to a string
+ *   with static storage duration, as only the pointer is stored.
+ * \param[in] bytes Size of the allocation.
+ */
+RCLCPP_PUBLIC
+void
+record(const char * callsite, size_t bytes);
+
+/// Return the accumulated allocations of every recorded callsite.
+RCLCPP_PUBLIC
+std::vector<CallsiteReport>
+report();
+
+/// Return only the callsites which allocated after mark_init_complete().
+RCLCPP_PUBLIC
+std::vector<CallsiteReport>
+post_init_report();
+
+/// Clear all recorded allocations and revert to the pre-init phase.
+RCLCPP_PUBLIC
+void
+reset();
+
+/// A memory resource which records its allocations with the audit.
+/**
+ * Wraps an upstream resource (by default the new/delete resource), so an
+ * arena installed through rclcpp::NodeOptions::memory_resource() or handed
+ * to the polymorphic entity allocators can be audited without changing the
+ * code that allocates from it.
+ */
+class AuditingMemoryResource : public std::pmr::memory_resource
+{
+public:
+  /**
+   * \param[in] callsite Name recorded for allocations from this resource;
+   *   must point to a string with static storage duration.
+   * \param[in] upstream The resource actually providing the memory, must
+   *   outlive this resource.
+   */
+  RCLCPP_PUBLIC
+  explicit AuditingMemoryResource(
+    const char * callsite,
+    std::pmr::memory_resource * upstream = std::pmr::new_delete_resource());
+
+protected:
+  RCLCPP_PUBLIC
+  void *
+  do_allocate(size_t bytes, size_t alignment) override;
+
+  RCLCPP_PUBLIC
+  void
+  do_deallocate(void * pointer, size_t bytes, size_t alignment) override;
+
+  RCLCPP_PUBLIC
+  bool
+  do_is_equal(const std::pmr::memory_resource & other) const noexcept override;
+
+private:
+  const char * callsite_;
+  std::pmr::memory_resource * upstream_;
+};
+
+}  // namespace allocation_audit
+}  // namespace rclcpp
+
+#endif  // RCLCPP__ALLOCATION_AUDIT_HPP_
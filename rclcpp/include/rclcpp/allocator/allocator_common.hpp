@@ -17,10 +17,12 @@
 
 #include <cstring>
 #include <memory>
+#include <memory_resource>
 
 #include "rcl/allocator.h"
 
 #include "rclcpp/allocator/allocator_deleter.hpp"
+#include "rclcpp/allocator/pmr_allocator.hpp"
 
 namespace rclcpp
 {
@@ -30,6 +32,13 @@ namespace allocator
 template<typename T, typename Alloc>
 using AllocRebind = typename std::allocator_traits<Alloc>::template rebind_traits<T>;
 
+/// Whether Alloc is a std::pmr::polymorphic_allocator specialization.
+template<typename Alloc>
+struct is_polymorphic_allocator : std::false_type {};
+
+template<typename T>
+struct is_polymorphic_allocator<std::pmr::polymorphic_allocator<T>>: std::true_type {};
+
 template<typename Alloc>
 void * retyped_allocate(size_t size, void * untyped_allocator)
 {
@@ -84,7 +93,8 @@ void * retyped_reallocate(void * untyped_pointer, size_t size, void * untyped_al
 template<
   typename T,
   typename Alloc,
-  typename std::enable_if<!std::is_same<Alloc, std::allocator<void>>::value>::type * = nullptr>
+  typename std::enable_if<!std::is_same<Alloc, std::allocator<void>>::value &&
+  !is_polymorphic_allocator<Alloc>::value>::type * = nullptr>
 rcl_allocator_t get_rcl_allocator(Alloc & allocator)
 {
   rcl_allocator_t rcl_allocator = rcl_get_default_allocator();
@@ -111,6 +121,18 @@ rcl_allocator_t get_rcl_allocator(Alloc & allocator)
   return rcl_get_default_allocator();
 }
 
+// Polymorphic allocators only carry a pointer to their memory resource, so
+// the rcl allocator wraps the resource directly, which also keeps the
+// allocation sizes that std::pmr::memory_resource::deallocate() requires.
+template<
+  typename T,
+  typename Alloc,
+  typename std::enable_if<is_polymorphic_allocator<Alloc>::value>::type * = nullptr>
+rcl_allocator_t get_rcl_allocator(Alloc & allocator)
+{
+  return get_rcl_allocator_from_memory_resource(allocator.resource());
+}
+
 }  // namespace allocator
 }  // namespace rclcpp
 
@@ -0,0 +1,209 @@
+// Copyright 2024 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__ALLOCATOR__ARENA_POOL_ALLOCATOR_HPP_
+#define RCLCPP__ALLOCATOR__ARENA_POOL_ALLOCATOR_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace rclcpp
+{
+namespace allocator
+{
+
+/// Fixed-size slot arena shared by ArenaPoolAllocator instances.
+/**
+ * The arena owns a contiguous block of `slot_count` slots of `slot_size`
+ * bytes each and hands them out through a lock-free free list (Treiber stack
+ * over slot indices). Allocations that do not fit in a slot, or that arrive
+ * when the arena is exhausted, fall back to the global heap, so the arena is
+ * an optimization and never a correctness constraint.
+ *
+ * The typical use is one arena per publisher, sized for the message type, so
+ * that steady-state intra-process publishing recycles the same few slots
+ * instead of hitting malloc/free on every message.
+ */
+class ArenaPool
+{
+public:
+  /**
+   * \param[in] slot_size size in bytes of each slot.
+   * \param[in] slot_count number of slots in the arena.
+   */
+  ArenaPool(size_t slot_size, size_t slot_count)
+  : slot_size_(round_up(slot_size)),
+    storage_(round_up(slot_size) * slot_count),
+    next_(slot_count)
+  {
+    // Thread the free list through the slot indices.
+    for (size_t i = 0; i < slot_count; i++) {
+      next_[i].store(i + 1, std::memory_order_relaxed);
+    }
+    free_head_.store(pack(slot_count > 0 ? 0 : kEnd, 0), std::memory_order_relaxed);
+    if (slot_count == 0) {
+      return;
+    }
+    next_[slot_count - 1].store(kEnd, std::memory_order_relaxed);
+  }
+
+  /// Try to take a slot, returns nullptr when exhausted or too small.
+  void * try_allocate(size_t size)
+  {
+    if (size > slot_size_) {
+      return nullptr;
+    }
+    uint64_t head = free_head_.load(std::memory_order_acquire);
+    while (index_of(head) != kEnd) {
+      size_t next = next_[index_of(head)].load(std::memory_order_relaxed);
+      // The tag makes the compare-exchange immune to ABA on the slot index.
+      if (free_head_.compare_exchange_weak(
+          head, pack(next, tag_of(head) + 1),
+          std::memory_order_acq_rel, std::memory_order_acquire))
+      {
+        return storage_.data() + index_of(head) * slot_size_;
+      }
+    }
+    return nullptr;
+  }
+
+  /// Return a pointer previously obtained from try_allocate.
+  /**
+   * \return true if the pointer belonged to this arena, false otherwise.
+   */
+  bool deallocate(void * ptr)
+  {
+    auto * bytes = static_cast<unsigned char *>(ptr);
+    if (bytes < storage_.data() || bytes >= storage_.data() + storage_.size()) {
+      return false;
+    }
+    size_t index = static_cast<size_t>(bytes - storage_.data()) / slot_size_;
+    uint64_t head = free_head_.load(std::memory_order_relaxed);
+    do {
+      next_[index].store(index_of(head), std::memory_order_relaxed);
+    } while (!free_head_.compare_exchange_weak(
+        head, pack(index, tag_of(head) + 1),
+        std::memory_order_acq_rel, std::memory_order_relaxed));
+    return true;
+  }
+
+  size_t slot_size() const {return slot_size_;}
+
+private:
+  static constexpr size_t kEnd = 0xFFFFFFFFu;
+
+  // The free list head packs a slot index and a modification tag so that the
+  // Treiber stack is safe against ABA.
+  static uint64_t pack(size_t index, uint32_t tag)
+  {
+    return (static_cast<uint64_t>(tag) << 32) | static_cast<uint32_t>(index);
+  }
+  static size_t index_of(uint64_t packed) {return static_cast<uint32_t>(packed);}
+  static uint32_t tag_of(uint64_t packed) {return static_cast<uint32_t>(packed >> 32);}
+
+  static size_t round_up(size_t size)
+  {
+    // Keep every slot suitably aligned for any object.
+    constexpr size_t alignment = alignof(std::max_align_t);
+    return (size + alignment - 1) / alignment * alignment;
+  }
+
+  size_t slot_size_;
+  std::vector<unsigned char> storage_;
+  std::vector<std::atomic<size_t>> next_;
+  std::atomic<uint64_t> free_head_;
+};
+
+/// Allocator that recycles fixed-size slots from a shared ArenaPool.
+/**
+ * Models the standard Allocator requirements, so it can be used as the
+ * AllocatorT of Publisher/Subscription (and thereby by
+ * do_intra_process_publish's allocate_shared calls) or handed to
+ * create_intra_process_buffer. Single-element allocations of at most the
+ * arena's slot size are served from the pool; everything else transparently
+ * falls back to the global heap.
+ */
+template<typename T>
+class ArenaPoolAllocator
+{
+public:
+  using value_type = T;
+
+  /// Construct an allocator drawing from the given arena.
+  explicit ArenaPoolAllocator(std::shared_ptr<ArenaPool> pool)
+  : pool_(std::move(pool))
+  {}
+
+  /// Convenience constructor: build an arena sized for `slot_count` objects of T.
+  /**
+   * Slots are padded so that the combined object created by allocate_shared
+   * (control block plus message) still fits after the allocator is rebound.
+   */
+  explicit ArenaPoolAllocator(size_t slot_count)
+  : pool_(std::make_shared<ArenaPool>(sizeof(T) + kControlBlockHeadroom, slot_count))
+  {}
+
+  template<typename U>
+  ArenaPoolAllocator(const ArenaPoolAllocator<U> & other)  // NOLINT(runtime/explicit)
+  : pool_(other.pool())
+  {}
+
+  T * allocate(size_t n)
+  {
+    if (n == 1) {
+      void * slot = pool_->try_allocate(sizeof(T));
+      if (slot != nullptr) {
+        return static_cast<T *>(slot);
+      }
+    }
+    return static_cast<T *>(::operator new(n * sizeof(T)));
+  }
+
+  void deallocate(T * ptr, size_t n)
+  {
+    (void)n;
+    if (!pool_->deallocate(ptr)) {
+      ::operator delete(ptr);
+    }
+  }
+
+  const std::shared_ptr<ArenaPool> & pool() const {return pool_;}
+
+  template<typename U>
+  bool operator==(const ArenaPoolAllocator<U> & other) const
+  {
+    return pool_ == other.pool();
+  }
+
+  template<typename U>
+  bool operator!=(const ArenaPoolAllocator<U> & other) const
+  {
+    return pool_ != other.pool();
+  }
+
+private:
+  // Headroom for the shared_ptr control block allocated alongside the object.
+  static constexpr size_t kControlBlockHeadroom = 64;
+
+  std::shared_ptr<ArenaPool> pool_;
+};
+
+}  // namespace allocator
+}  // namespace rclcpp
+
+#endif  // RCLCPP__ALLOCATOR__ARENA_POOL_ALLOCATOR_HPP_
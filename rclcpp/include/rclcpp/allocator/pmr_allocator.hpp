@@ -0,0 +1,136 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__ALLOCATOR__PMR_ALLOCATOR_HPP_
+#define RCLCPP__ALLOCATOR__PMR_ALLOCATOR_HPP_
+
+#include <cstddef>
+#include <cstring>
+#include <memory_resource>
+#include <stdexcept>
+
+#include "rcl/allocator.h"
+
+namespace rclcpp
+{
+namespace allocator
+{
+
+/// Polymorphic allocator to use with the allocator-templated rclcpp entities.
+/**
+ * `std::pmr::polymorphic_allocator` satisfies the `Alloc` template contract
+ * used by publishers, subscriptions, the intra-process buffers, and
+ * `AllocatorMemoryStrategy`, so the same `std::pmr::memory_resource` (for
+ * example a monotonic or pool resource) can back all of a node's entities
+ * without encoding a concrete allocator type into their signatures.
+ */
+template<typename T = void>
+using PolymorphicAllocator = std::pmr::polymorphic_allocator<T>;
+
+namespace detail
+{
+
+/// Size of the header prepended to each allocation made through the bridge.
+/**
+ * `std::pmr::memory_resource::deallocate()` requires the allocation size,
+ * which the rcl allocator interface does not pass back, so the size is
+ * recorded in a maximally aligned header in front of each allocation.
+ */
+constexpr size_t pmr_allocation_header_size = alignof(std::max_align_t);
+
+inline void * pmr_allocate(size_t size, void * state)
+{
+  auto resource = static_cast<std::pmr::memory_resource *>(state);
+  if (!resource) {
+    throw std::runtime_error("Received null memory resource");
+  }
+  const size_t total_size = size + pmr_allocation_header_size;
+  void * allocation = resource->allocate(total_size, alignof(std::max_align_t));
+  *static_cast<size_t *>(allocation) = total_size;
+  return static_cast<char *>(allocation) + pmr_allocation_header_size;
+}
+
+inline void pmr_deallocate(void * pointer, void * state)
+{
+  auto resource = static_cast<std::pmr::memory_resource *>(state);
+  if (!resource) {
+    throw std::runtime_error("Received null memory resource");
+  }
+  if (!pointer) {
+    return;
+  }
+  void * allocation = static_cast<char *>(pointer) - pmr_allocation_header_size;
+  resource->deallocate(
+    allocation, *static_cast<size_t *>(allocation), alignof(std::max_align_t));
+}
+
+inline void * pmr_reallocate(void * pointer, size_t size, void * state)
+{
+  if (!pointer) {
+    return pmr_allocate(size, state);
+  }
+  if (0u == size) {
+    pmr_deallocate(pointer, state);
+    return nullptr;
+  }
+  void * old_allocation = static_cast<char *>(pointer) - pmr_allocation_header_size;
+  const size_t old_size = *static_cast<size_t *>(old_allocation) - pmr_allocation_header_size;
+  void * new_pointer = pmr_allocate(size, state);
+  std::memcpy(new_pointer, pointer, old_size < size ? old_size : size);
+  pmr_deallocate(pointer, state);
+  return new_pointer;
+}
+
+inline void * pmr_zero_allocate(size_t number_of_elem, size_t size_of_elem, void * state)
+{
+  const size_t size = number_of_elem * size_of_elem;
+  void * pointer = pmr_allocate(size, state);
+  std::memset(pointer, 0, size);
+  return pointer;
+}
+
+}  // namespace detail
+
+/// Convert a std::pmr::memory_resource into an rcl allocator.
+/**
+ * The returned allocator draws all of its memory from the given resource, so
+ * the rcl structures of a node (and anything else taking an rcl_allocator_t,
+ * like rclcpp::SerializedMessage) can share an arena with the C++ side.
+ *
+ * The resource is referenced, not owned: it must outlive every allocation
+ * made through the returned allocator.
+ *
+ * \param[in] resource The memory resource to allocate from, must not be null.
+ * \return an rcl allocator backed by the resource.
+ * \throws std::invalid_argument if resource is null.
+ */
+inline rcl_allocator_t get_rcl_allocator_from_memory_resource(
+  std::pmr::memory_resource * resource)
+{
+  if (!resource) {
+    throw std::invalid_argument("memory resource must not be null");
+  }
+  rcl_allocator_t rcl_allocator = rcl_get_default_allocator();
+  rcl_allocator.allocate = &detail::pmr_allocate;
+  rcl_allocator.deallocate = &detail::pmr_deallocate;
+  rcl_allocator.reallocate = &detail::pmr_reallocate;
+  rcl_allocator.zero_allocate = &detail::pmr_zero_allocate;
+  rcl_allocator.state = resource;
+  return rcl_allocator;
+}
+
+}  // namespace allocator
+}  // namespace rclcpp
+
+#endif  // RCLCPP__ALLOCATOR__PMR_ALLOCATOR_HPP_
@@ -35,9 +35,34 @@ struct AnyExecutable
   RCLCPP_PUBLIC
   AnyExecutable();
 
+  RCLCPP_PUBLIC
+  AnyExecutable(const AnyExecutable & other) = default;
+
+  RCLCPP_PUBLIC
+  AnyExecutable(AnyExecutable && other) noexcept = default;
+
+  RCLCPP_PUBLIC
+  AnyExecutable &
+  operator=(const AnyExecutable & other) = default;
+
+  RCLCPP_PUBLIC
+  AnyExecutable &
+  operator=(AnyExecutable && other) noexcept = default;
+
   RCLCPP_PUBLIC
   virtual ~AnyExecutable();
 
+  /// Release every reference held by this executable.
+  /**
+   * Unlike the destructor this does not restore `can_be_taken_from` on the
+   * callback group, which execute_any_executable() already did; use it to
+   * recycle one record per worker thread instead of paying the construction,
+   * destruction and reference-count traffic of a fresh record per dispatch.
+   */
+  RCLCPP_PUBLIC
+  void
+  reset();
+
   // Only one of the following pointers will be set.
   rclcpp::SubscriptionBase::SharedPtr subscription;
   rclcpp::TimerBase::SharedPtr timer;
@@ -22,6 +22,7 @@
 #include <type_traits>
 #include <utility>
 
+#include "rclcpp/detail/inplace_function.hpp"
 #include "rclcpp/function_traits.hpp"
 #include "rclcpp/visibility_control.hpp"
 #include "rmw/types.h"
@@ -204,23 +205,23 @@ public:
   }
 
 private:
-  using SharedPtrCallback = std::function<
+  using SharedPtrCallback = detail::InplaceFunction<
     void (
       std::shared_ptr<typename ServiceT::Request>,
       std::shared_ptr<typename ServiceT::Response>
     )>;
-  using SharedPtrWithRequestHeaderCallback = std::function<
+  using SharedPtrWithRequestHeaderCallback = detail::InplaceFunction<
     void (
       std::shared_ptr<rmw_request_id_t>,
       std::shared_ptr<typename ServiceT::Request>,
       std::shared_ptr<typename ServiceT::Response>
     )>;
-  using SharedPtrDeferResponseCallback = std::function<
+  using SharedPtrDeferResponseCallback = detail::InplaceFunction<
     void (
       std::shared_ptr<rmw_request_id_t>,
       std::shared_ptr<typename ServiceT::Request>
     )>;
-  using SharedPtrDeferResponseCallbackWithServiceHandle = std::function<
+  using SharedPtrDeferResponseCallbackWithServiceHandle = detail::InplaceFunction<
     void (
       std::shared_ptr<rclcpp::Service<ServiceT>>,
       std::shared_ptr<rmw_request_id_t>,
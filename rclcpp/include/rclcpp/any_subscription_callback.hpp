@@ -26,7 +26,9 @@
 #include "tracetools/tracetools.h"
 #include "tracetools/utils.hpp"
 
+#include "rclcpp/allocation_audit.hpp"
 #include "rclcpp/allocator/allocator_common.hpp"
+#include "rclcpp/detail/inplace_function.hpp"
 #include "rclcpp/detail/subscription_callback_type_helper.hpp"
 #include "rclcpp/function_traits.hpp"
 #include "rclcpp/message_info.hpp"
@@ -68,90 +70,92 @@ struct AnySubscriptionCallbackPossibleTypes
     typename MessageDeleterHelper<rclcpp::SerializedMessage, AllocatorT>::Deleter;
 
   using ConstRefCallback =
-    std::function<void (const SubscribedType &)>;
+    detail::InplaceFunction<void (const SubscribedType &)>;
   using ConstRefROSMessageCallback =
-    std::function<void (const ROSMessageType &)>;
+    detail::InplaceFunction<void (const ROSMessageType &)>;
   using ConstRefWithInfoCallback =
-    std::function<void (const SubscribedType &, const rclcpp::MessageInfo &)>;
+    detail::InplaceFunction<void (const SubscribedType &, const rclcpp::MessageInfo &)>;
   using ConstRefWithInfoROSMessageCallback =
-    std::function<void (const ROSMessageType &, const rclcpp::MessageInfo &)>;
+    detail::InplaceFunction<void (const ROSMessageType &, const rclcpp::MessageInfo &)>;
   using ConstRefSerializedMessageCallback =
-    std::function<void (const rclcpp::SerializedMessage &)>;
+    detail::InplaceFunction<void (const rclcpp::SerializedMessage &)>;
   using ConstRefSerializedMessageWithInfoCallback =
-    std::function<void (const rclcpp::SerializedMessage &, const rclcpp::MessageInfo &)>;
+    detail::InplaceFunction<void (const rclcpp::SerializedMessage &, const rclcpp::MessageInfo &)>;
 
   using UniquePtrCallback =
-    std::function<void (std::unique_ptr<SubscribedType, SubscribedMessageDeleter>)>;
+    detail::InplaceFunction<void (std::unique_ptr<SubscribedType, SubscribedMessageDeleter>)>;
   using UniquePtrROSMessageCallback =
-    std::function<void (std::unique_ptr<ROSMessageType, ROSMessageDeleter>)>;
+    detail::InplaceFunction<void (std::unique_ptr<ROSMessageType, ROSMessageDeleter>)>;
   using UniquePtrWithInfoCallback =
-    std::function<void (
+    detail::InplaceFunction<void (
         std::unique_ptr<SubscribedType, SubscribedMessageDeleter>,
         const rclcpp::MessageInfo &)>;
   using UniquePtrWithInfoROSMessageCallback =
-    std::function<void (
+    detail::InplaceFunction<void (
         std::unique_ptr<ROSMessageType, ROSMessageDeleter>,
         const rclcpp::MessageInfo &)>;
   using UniquePtrSerializedMessageCallback =
-    std::function<void (std::unique_ptr<rclcpp::SerializedMessage, SerializedMessageDeleter>)>;
+    detail::InplaceFunction<void (
+        std::unique_ptr<rclcpp::SerializedMessage, SerializedMessageDeleter>)>;
   using UniquePtrSerializedMessageWithInfoCallback =
-    std::function<void (
+    detail::InplaceFunction<void (
         std::unique_ptr<rclcpp::SerializedMessage, SerializedMessageDeleter>,
         const rclcpp::MessageInfo &)>;
 
   using SharedConstPtrCallback =
-    std::function<void (std::shared_ptr<const SubscribedType>)>;
+    detail::InplaceFunction<void (std::shared_ptr<const SubscribedType>)>;
   using SharedConstPtrROSMessageCallback =
-    std::function<void (std::shared_ptr<const ROSMessageType>)>;
+    detail::InplaceFunction<void (std::shared_ptr<const ROSMessageType>)>;
   using SharedConstPtrWithInfoCallback =
-    std::function<void (
+    detail::InplaceFunction<void (
         std::shared_ptr<const SubscribedType>,
         const rclcpp::MessageInfo &)>;
   using SharedConstPtrWithInfoROSMessageCallback =
-    std::function<void (
+    detail::InplaceFunction<void (
         std::shared_ptr<const ROSMessageType>,
         const rclcpp::MessageInfo &)>;
   using SharedConstPtrSerializedMessageCallback =
-    std::function<void (std::shared_ptr<const rclcpp::SerializedMessage>)>;
+    detail::InplaceFunction<void (std::shared_ptr<const rclcpp::SerializedMessage>)>;
   using SharedConstPtrSerializedMessageWithInfoCallback =
-    std::function<void (
+    detail::InplaceFunction<void (
         std::shared_ptr<const rclcpp::SerializedMessage>,
         const rclcpp::MessageInfo &)>;
 
   using ConstRefSharedConstPtrCallback =
-    std::function<void (const std::shared_ptr<const SubscribedType> &)>;
+    detail::InplaceFunction<void (const std::shared_ptr<const SubscribedType> &)>;
   using ConstRefSharedConstPtrROSMessageCallback =
-    std::function<void (const std::shared_ptr<const ROSMessageType> &)>;
+    detail::InplaceFunction<void (const std::shared_ptr<const ROSMessageType> &)>;
   using ConstRefSharedConstPtrWithInfoCallback =
-    std::function<void (
+    detail::InplaceFunction<void (
         const std::shared_ptr<const SubscribedType> &,
         const rclcpp::MessageInfo &)>;
   using ConstRefSharedConstPtrWithInfoROSMessageCallback =
-    std::function<void (
+    detail::InplaceFunction<void (
         const std::shared_ptr<const ROSMessageType> &,
         const rclcpp::MessageInfo &)>;
   using ConstRefSharedConstPtrSerializedMessageCallback =
-    std::function<void (const std::shared_ptr<const rclcpp::SerializedMessage> &)>;
+    detail::InplaceFunction<void (const std::shared_ptr<const rclcpp::SerializedMessage> &)>;
   using ConstRefSharedConstPtrSerializedMessageWithInfoCallback =
-    std::function<void (
+    detail::InplaceFunction<void (
         const std::shared_ptr<const rclcpp::SerializedMessage> &,
         const rclcpp::MessageInfo &)>;
 
   // Deprecated signatures:
   using SharedPtrCallback =
-    std::function<void (std::shared_ptr<SubscribedType>)>;
+    detail::InplaceFunction<void (std::shared_ptr<SubscribedType>)>;
   using SharedPtrROSMessageCallback =
-    std::function<void (std::shared_ptr<ROSMessageType>)>;
+    detail::InplaceFunction<void (std::shared_ptr<ROSMessageType>)>;
   using SharedPtrWithInfoCallback =
-    std::function<void (std::shared_ptr<SubscribedType>, const rclcpp::MessageInfo &)>;
+    detail::InplaceFunction<void (std::shared_ptr<SubscribedType>, const rclcpp::MessageInfo &)>;
   using SharedPtrWithInfoROSMessageCallback =
-    std::function<void (
+    detail::InplaceFunction<void (
         std::shared_ptr<ROSMessageType>,
         const rclcpp::MessageInfo &)>;
   using SharedPtrSerializedMessageCallback =
-    std::function<void (std::shared_ptr<rclcpp::SerializedMessage>)>;
+    detail::InplaceFunction<void (std::shared_ptr<rclcpp::SerializedMessage>)>;
   using SharedPtrSerializedMessageWithInfoCallback =
-    std::function<void (std::shared_ptr<rclcpp::SerializedMessage>, const rclcpp::MessageInfo &)>;
+    detail::InplaceFunction<void (
+        std::shared_ptr<rclcpp::SerializedMessage>, const rclcpp::MessageInfo &)>;
 };
 
 /// Template helper to select the variant type based on whether or not MessageT is a TypeAdapter.
@@ -232,6 +236,19 @@ struct AnySubscriptionCallbackHelper<MessageT, AllocatorT, true>
   >;
 };
 
+/// Trait resolving, from a stored callback type, whether it consumes a MessageInfo argument.
+/**
+ * Every "WithInfo" callback signature takes the message followed by a
+ * `const rclcpp::MessageInfo &`; everything else cannot observe the message info at all.
+ */
+template<typename CallbackT>
+struct callback_takes_message_info : std::false_type {};
+
+template<typename MessageArgT, size_t Capacity>
+struct callback_takes_message_info<
+  InplaceFunction<void (MessageArgT, const rclcpp::MessageInfo &), Capacity>>
+  : std::true_type {};
+
 }  // namespace detail
 
 template<
@@ -390,8 +407,11 @@ public:
       // If deprecated, call sub-routine that is deprecated.
       set_deprecated(static_cast<typename scbth::callback_type>(callback));
     } else {
-      // Otherwise just assign it.
-      callback_variant_ = static_cast<typename scbth::callback_type>(callback);
+      // Otherwise emplace the InplaceFunction alternative matching the
+      // discovered std::function type, which forces the type of the callback.
+      callback_variant_.template emplace<
+        typename detail::InplaceFunctionFromStdFunction<typename scbth::callback_type>::type>(
+        std::move(callback));
     }
 
     // Return copy of self for easier testing, normally will be compiled out.
@@ -407,7 +427,8 @@ public:
   void
   set_deprecated(std::function<void(std::shared_ptr<SetT>)> callback)
   {
-    callback_variant_ = callback;
+    callback_variant_.template emplace<
+      detail::InplaceFunction<void (std::shared_ptr<SetT>)>>(std::move(callback));
   }
 
   /// Function for shared_ptr to non-const MessageT with MessageInfo, which is deprecated.
@@ -421,13 +442,18 @@ public:
   void
   set_deprecated(std::function<void(std::shared_ptr<SetT>, const rclcpp::MessageInfo &)> callback)
   {
-    callback_variant_ = callback;
+    callback_variant_.template emplace<
+      detail::InplaceFunction<void (std::shared_ptr<SetT>, const rclcpp::MessageInfo &)>>(
+      std::move(callback));
   }
 
   std::unique_ptr<ROSMessageType, ROSMessageTypeDeleter>
   create_ros_unique_ptr_from_ros_shared_ptr_message(
     const std::shared_ptr<const ROSMessageType> & message)
   {
+    allocation_audit::record(
+      "AnySubscriptionCallback::create_ros_unique_ptr_from_ros_shared_ptr_message",
+      sizeof(ROSMessageType));
     auto ptr = ROSMessageTypeAllocatorTraits::allocate(ros_message_type_allocator_, 1);
     ROSMessageTypeAllocatorTraits::construct(ros_message_type_allocator_, ptr, *message);
     return std::unique_ptr<ROSMessageType, ROSMessageTypeDeleter>(ptr, ros_message_type_deleter_);
@@ -437,6 +463,9 @@ public:
   create_serialized_message_unique_ptr_from_shared_ptr(
     const std::shared_ptr<const rclcpp::SerializedMessage> & serialized_message)
   {
+    allocation_audit::record(
+      "AnySubscriptionCallback::create_serialized_message_unique_ptr_from_shared_ptr",
+      sizeof(rclcpp::SerializedMessage));
     auto ptr = SerializedMessageAllocatorTraits::allocate(serialized_message_allocator_, 1);
     SerializedMessageAllocatorTraits::construct(
       serialized_message_allocator_, ptr, *serialized_message);
@@ -450,6 +479,9 @@ public:
   create_custom_unique_ptr_from_custom_shared_ptr_message(
     const std::shared_ptr<const SubscribedType> & message)
   {
+    allocation_audit::record(
+      "AnySubscriptionCallback::create_custom_unique_ptr_from_custom_shared_ptr_message",
+      sizeof(SubscribedType));
     auto ptr = SubscribedTypeAllocatorTraits::allocate(subscribed_type_allocator_, 1);
     SubscribedTypeAllocatorTraits::construct(subscribed_type_allocator_, ptr, *message);
     return std::unique_ptr<SubscribedType, SubscribedTypeDeleter>(ptr, subscribed_type_deleter_);
@@ -459,6 +491,9 @@ public:
   convert_ros_message_to_custom_type_unique_ptr(const ROSMessageType & msg)
   {
     if constexpr (rclcpp::TypeAdapter<MessageT>::is_specialized::value) {
+      allocation_audit::record(
+        "AnySubscriptionCallback::convert_ros_message_to_custom_type_unique_ptr",
+        sizeof(SubscribedType));
       auto ptr = SubscribedTypeAllocatorTraits::allocate(subscribed_type_allocator_, 1);
       SubscribedTypeAllocatorTraits::construct(subscribed_type_allocator_, ptr);
       rclcpp::TypeAdapter<MessageT>::convert_to_custom(msg, *ptr);
@@ -474,6 +509,9 @@ public:
   convert_custom_type_to_ros_message_unique_ptr(const SubscribedType & msg)
   {
     if constexpr (rclcpp::TypeAdapter<MessageT>::is_specialized::value) {
+      allocation_audit::record(
+        "AnySubscriptionCallback::convert_custom_type_to_ros_message_unique_ptr",
+        sizeof(ROSMessageType));
       auto ptr = ROSMessageTypeAllocatorTraits::allocate(ros_message_type_allocator_, 1);
       ROSMessageTypeAllocatorTraits::construct(ros_message_type_allocator_, ptr);
       rclcpp::TypeAdapter<MessageT>::convert_to_ros_message(msg, *ptr);
@@ -941,6 +979,43 @@ public:
       std::holds_alternative<ConstRefSharedConstPtrWithInfoCallback>(callback_variant_);
   }
 
+  /// Return true if the set callback only observes the message by const reference.
+  /**
+   * Such a callback cannot retain the message past its own return, so dispatch
+   * sites may reuse one preallocated message object across take-dispatch cycles
+   * instead of borrowing a fresh message for every take.
+   */
+  constexpr
+  bool
+  is_const_ref_callback() const
+  {
+    return std::visit(
+      [](auto && callback) {
+        using T = std::remove_cv_t<std::remove_reference_t<decltype(callback)>>;
+        return
+          std::is_same_v<T, ConstRefCallback> ||
+          std::is_same_v<T, ConstRefWithInfoCallback> ||
+          std::is_same_v<T, ConstRefROSMessageCallback> ||
+          std::is_same_v<T, ConstRefWithInfoROSMessageCallback>;
+      }, callback_variant_);
+  }
+
+  /// Return true if the set callback consumes the message info argument.
+  /**
+   * Resolved from the callback signature, so dispatch sites can skip populating message
+   * info entirely for callbacks that cannot observe it.
+   */
+  constexpr
+  bool
+  uses_message_info() const
+  {
+    return std::visit(
+      [](auto && callback) {
+        using CallbackT = std::remove_cv_t<std::remove_reference_t<decltype(callback)>>;
+        return detail::callback_takes_message_info<CallbackT>::value;
+      }, callback_variant_);
+  }
+
   constexpr
   bool
   is_serialized_message_callback() const
@@ -16,9 +16,12 @@
 #define RCLCPP__CALLBACK_GROUP_HPP_
 
 #include <atomic>
+#include <chrono>
 #include <functional>
+#include <list>
 #include <memory>
 #include <mutex>
+#include <string>
 #include <vector>
 
 #include "rclcpp/client.hpp"
@@ -49,7 +52,7 @@ enum class CallbackGroupType
   Reentrant
 };
 
-class CallbackGroup
+class CallbackGroup : public std::enable_shared_from_this<CallbackGroup>
 {
   friend class rclcpp::node_interfaces::NodeServices;
   friend class rclcpp::node_interfaces::NodeTimers;
@@ -149,35 +152,35 @@ public:
   rclcpp::SubscriptionBase::SharedPtr
   find_subscription_ptrs_if(Function func) const
   {
-    return _find_ptrs_if_impl<rclcpp::SubscriptionBase, Function>(func, subscription_ptrs_);
+    return _find_ptrs_if_impl<rclcpp::SubscriptionBase, Function>(func, subscription_entries_);
   }
 
   template<typename Function>
   rclcpp::TimerBase::SharedPtr
   find_timer_ptrs_if(Function func) const
   {
-    return _find_ptrs_if_impl<rclcpp::TimerBase, Function>(func, timer_ptrs_);
+    return _find_ptrs_if_impl<rclcpp::TimerBase, Function>(func, timer_entries_);
   }
 
   template<typename Function>
   rclcpp::ServiceBase::SharedPtr
   find_service_ptrs_if(Function func) const
   {
-    return _find_ptrs_if_impl<rclcpp::ServiceBase, Function>(func, service_ptrs_);
+    return _find_ptrs_if_impl<rclcpp::ServiceBase, Function>(func, service_entries_);
   }
 
   template<typename Function>
   rclcpp::ClientBase::SharedPtr
   find_client_ptrs_if(Function func) const
   {
-    return _find_ptrs_if_impl<rclcpp::ClientBase, Function>(func, client_ptrs_);
+    return _find_ptrs_if_impl<rclcpp::ClientBase, Function>(func, client_entries_);
   }
 
   template<typename Function>
   rclcpp::Waitable::SharedPtr
   find_waitable_ptrs_if(Function func) const
   {
-    return _find_ptrs_if_impl<rclcpp::Waitable, Function>(func, waitable_ptrs_);
+    return _find_ptrs_if_impl<rclcpp::Waitable, Function>(func, waitable_entries_);
   }
 
   /// Get the total number of entities in this callback group.
@@ -195,6 +198,104 @@ public:
   const CallbackGroupType &
   type() const;
 
+  /// Set the relative scheduling deadline of this group's callbacks.
+  /**
+   * When a deadline-aware executor services ready work, an executable from
+   * this group is assigned the absolute deadline `now + deadline`.
+   * A zero deadline (the default) means the group has no deadline and is
+   * ordered after all deadline-bearing groups, by scheduling priority.
+   * \param[in] deadline the relative deadline, zero to disable.
+   */
+  RCLCPP_PUBLIC
+  void
+  set_scheduling_deadline(std::chrono::nanoseconds deadline);
+
+  /// Get the relative scheduling deadline of this group, zero if unset.
+  RCLCPP_PUBLIC
+  std::chrono::nanoseconds
+  scheduling_deadline() const;
+
+  /// Set the scheduling priority used to order groups without a deadline.
+  /**
+   * Higher values are serviced first. Only deadline-aware executors use this;
+   * the default executors ignore it.
+   * \param[in] priority the priority, default 0.
+   */
+  RCLCPP_PUBLIC
+  void
+  set_scheduling_priority(int priority);
+
+  /// Get the scheduling priority of this group.
+  RCLCPP_PUBLIC
+  int
+  scheduling_priority() const;
+
+  /// Assign this group's callbacks to a named executor thread pool.
+  /**
+   * Executors with dedicated thread pools, \sa
+   * rclcpp::executors::MultiThreadedExecutor::add_thread_pool(), execute the
+   * callbacks of groups tagged with a pool name exclusively on that pool's
+   * threads. An empty name (the default) leaves the group on the executor's
+   * default threads; executors without a matching pool also fall back to them.
+   * \param[in] name the thread pool name, empty to clear the assignment.
+   */
+  RCLCPP_PUBLIC
+  void
+  set_thread_pool_name(const std::string & name);
+
+  /// Get the name of the thread pool this group is assigned to, empty if none.
+  RCLCPP_PUBLIC
+  std::string
+  thread_pool_name() const;
+
+  /// Snapshot of the execution accounting of this group, see get_stats().
+  struct Stats
+  {
+    /// Cumulative thread CPU time spent executing this group's callbacks.
+    std::chrono::nanoseconds cpu_time;
+    /// Number of executables dispatched for this group.
+    uint64_t executions;
+    /// Longest thread CPU time spent on a single dispatch.
+    std::chrono::nanoseconds max_execution_time;
+  };
+
+  /// Get the execution accounting of this group.
+  /**
+   * Executors attribute the thread CPU time of each dispatched executable to
+   * its callback group, so executor utilization can be attributed to groups
+   * continuously without a profiler. The counters are relaxed atomics updated
+   * on every dispatch; under concurrent execution a snapshot is only
+   * approximately consistent between its fields.
+   *
+   * \return a snapshot of the counters, all zero before the first dispatch.
+   */
+  RCLCPP_PUBLIC
+  Stats
+  get_stats() const;
+
+  /// Record one dispatched execution against this group's accounting.
+  /**
+   * Called by executors after an executable from this group completes.
+   *
+   * \param[in] cpu_time thread CPU time consumed by the dispatch.
+   */
+  RCLCPP_PUBLIC
+  void
+  record_execution(std::chrono::nanoseconds cpu_time);
+
+  /// Get the version of the entity membership of this group.
+  /**
+   * The version is incremented every time an entity is added to or removed
+   * from the group. Executors use it to detect whether a previously collected
+   * snapshot of this group's entities is still current, avoiding a full
+   * re-collection when nothing changed.
+   *
+   * \return the current entity membership version.
+   */
+  RCLCPP_PUBLIC
+  size_t
+  entities_version() const;
+
   RCLCPP_PUBLIC
   void collect_all_ptrs(
     std::function<void(const rclcpp::SubscriptionBase::SharedPtr &)> sub_func,
@@ -282,16 +383,90 @@ protected:
   void
   remove_waitable(const rclcpp::Waitable::SharedPtr waitable_ptr) noexcept;
 
+  /// Membership record for one entity registered with this group.
+  /**
+   * The raw pointer gives traversal a stable identity; the weak pointer is
+   * used to take a reference when handing the entity out and to guard the
+   * window in which the entity is already being destroyed but has not
+   * unlinked itself yet.
+   */
+  template<typename TypeT>
+  struct MembershipEntry
+  {
+    TypeT * raw;
+    typename TypeT::WeakPtr weak;
+  };
+
+  /// Unlink handle owned by a registered entity, see add_subscription() etc.
+  /**
+   * The entity holds this handle for its lifetime; releasing it erases the
+   * entity's entry from the group's membership list, so the lists never
+   * accumulate expired entries and need no pruning on traversal.
+   */
+  template<typename TypeT>
+  class Membership
+  {
+  public:
+    Membership(
+      std::weak_ptr<CallbackGroup> group,
+      std::list<MembershipEntry<TypeT>> * list,
+      typename std::list<MembershipEntry<TypeT>>::iterator entry)
+    : group_(group), list_(list), entry_(entry)
+    {}
+
+    ~Membership()
+    {
+      auto group = group_.lock();
+      if (!group) {
+        return;
+      }
+      std::lock_guard<std::mutex> lock(group->mutex_);
+      list_->erase(entry_);
+      group->entities_version_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+  private:
+    RCLCPP_DISABLE_COPY(Membership)
+
+    std::weak_ptr<CallbackGroup> group_;
+    std::list<MembershipEntry<TypeT>> * list_;
+    typename std::list<MembershipEntry<TypeT>>::iterator entry_;
+  };
+
+  /// Append an entry for the entity and return the unlink handle it will own.
+  template<typename TypeT>
+  std::shared_ptr<void>
+  register_entity(std::list<MembershipEntry<TypeT>> & list, const typename TypeT::SharedPtr & ptr)
+  {
+    entities_version_.fetch_add(1, std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto entry = list.emplace(list.end(), MembershipEntry<TypeT>{ptr.get(), ptr});
+    return std::make_shared<Membership<TypeT>>(this->weak_from_this(), &list, entry);
+  }
+
   CallbackGroupType type_;
-  // Mutex to protect the subsequent vectors of pointers.
+  // Mutex to protect the subsequent membership lists.
   mutable std::mutex mutex_;
   std::atomic_bool associated_with_executor_;
-  std::vector<rclcpp::SubscriptionBase::WeakPtr> subscription_ptrs_;
-  std::vector<rclcpp::TimerBase::WeakPtr> timer_ptrs_;
-  std::vector<rclcpp::ServiceBase::WeakPtr> service_ptrs_;
-  std::vector<rclcpp::ClientBase::WeakPtr> client_ptrs_;
-  std::vector<rclcpp::Waitable::WeakPtr> waitable_ptrs_;
+  std::list<MembershipEntry<rclcpp::SubscriptionBase>> subscription_entries_;
+  std::list<MembershipEntry<rclcpp::TimerBase>> timer_entries_;
+  std::list<MembershipEntry<rclcpp::ServiceBase>> service_entries_;
+  std::list<MembershipEntry<rclcpp::ClientBase>> client_entries_;
+  std::list<MembershipEntry<rclcpp::Waitable>> waitable_entries_;
   std::atomic_bool can_be_taken_from_;
+  // Incremented on every entity addition or removal, see entities_version().
+  std::atomic<size_t> entities_version_ {0};
+  // Relative deadline in nanoseconds used by deadline-aware executors, 0 if unset.
+  std::atomic<int64_t> scheduling_deadline_ns_ {0};
+  // Priority used to order non-deadline groups in deadline-aware executors.
+  std::atomic<int> scheduling_priority_ {0};
+  // Execution accounting updated per dispatch, see get_stats().
+  std::atomic<int64_t> stats_cpu_time_ns_ {0};
+  std::atomic<uint64_t> stats_executions_ {0};
+  std::atomic<int64_t> stats_max_execution_ns_ {0};
+  // Name of the executor thread pool servicing this group, empty for the default
+  // threads; protected by mutex_.
+  std::string thread_pool_name_;
   const bool automatically_add_to_executor_with_node_;
   // defer the creation of the guard condition
   std::shared_ptr<rclcpp::GuardCondition> notify_guard_condition_ = nullptr;
@@ -302,13 +477,21 @@ protected:
 private:
   template<typename TypeT, typename Function>
   typename TypeT::SharedPtr _find_ptrs_if_impl(
-    Function func, const std::vector<typename TypeT::WeakPtr> & vect_ptrs) const
+    Function func, const std::list<MembershipEntry<TypeT>> & entries) const
   {
+    // Declared before the lock so the references are released after it:
+    // dropping the last reference to an entity under the lock would run its
+    // membership unlink against the same mutex.
+    std::vector<typename TypeT::SharedPtr> alive;
     std::lock_guard<std::mutex> lock(mutex_);
-    for (auto & weak_ptr : vect_ptrs) {
-      auto ref_ptr = weak_ptr.lock();
-      if (ref_ptr && func(ref_ptr)) {
-        return ref_ptr;
+    alive.reserve(entries.size());
+    for (const auto & entry : entries) {
+      auto ref_ptr = entry.weak.lock();
+      if (ref_ptr) {
+        if (func(ref_ptr)) {
+          return ref_ptr;
+        }
+        alive.push_back(std::move(ref_ptr));
       }
     }
     return typename TypeT::SharedPtr();
@@ -35,11 +35,14 @@
 #include "rcl/service_introspection.h"
 #include "rcl/wait.h"
 
+#include "rclcpp/allocation_audit.hpp"
 #include "rclcpp/clock.hpp"
 #include "rclcpp/detail/cpp_callback_trampoline.hpp"
 #include "rclcpp/exceptions.hpp"
 #include "rclcpp/expand_topic_or_service_name.hpp"
+#include "rclcpp/experimental/intra_process_manager.hpp"
 #include "rclcpp/function_traits.hpp"
+#include "rclcpp/loaned_message_pool.hpp"
 #include "rclcpp/logging.hpp"
 #include "rclcpp/macros.hpp"
 #include "rclcpp/node_interfaces/node_graph_interface.hpp"
@@ -120,6 +123,7 @@ struct FutureAndRequestId
 namespace node_interfaces
 {
 class NodeBaseInterface;
+class NodeGraph;
 }  // namespace node_interfaces
 
 class ClientBase
@@ -133,7 +137,7 @@ public:
     rclcpp::node_interfaces::NodeGraphInterface::SharedPtr node_graph);
 
   RCLCPP_PUBLIC
-  virtual ~ClientBase() = default;
+  virtual ~ClientBase();
 
   /// Take the next response for this client as a type erased pointer.
   /**
@@ -156,6 +160,26 @@ public:
   bool
   take_type_erased_response(void * response_out, rmw_request_id_t & request_header_out);
 
+  /// Take the next response for this client without throwing on failure.
+  /**
+   * Error-code variant of take_type_erased_response() for callers that cannot
+   * afford exceptions on the hot path.
+   * No allocation happens on any branch and the rcl error state is reset
+   * before returning, so nothing is left pending for a later throwing call.
+   *
+   * \param[out] response_out The type erased pointer to a Service Response into
+   *   which the middleware will copy the response being taken.
+   * \param[out] request_header_out The request header to be filled by the
+   *   middleware when taking.
+   * \return RCL_RET_OK if a response was taken,
+   *   RCL_RET_CLIENT_TAKE_FAILED if no response was pending,
+   *   or the error code from rcl_take_response() on failure.
+   */
+  RCLCPP_PUBLIC
+  rcl_ret_t
+  try_take_type_erased_response(
+    void * response_out, rmw_request_id_t & request_header_out) noexcept;
+
   /// Return the name of the service.
   /** \return The name of the service. */
   RCLCPP_PUBLIC
@@ -339,6 +363,28 @@ public:
     }
   }
 
+  using IntraProcessManagerWeakPtr =
+    std::weak_ptr<rclcpp::experimental::IntraProcessManager>;
+
+  /// Implementation detail.
+  /**
+   * Enables the intra-process fast path for this client: requests to a
+   * service registered with the given intra process manager under the same
+   * resolved name and type are dispatched to it directly, bypassing the
+   * middleware.
+   */
+  RCLCPP_PUBLIC
+  void
+  setup_intra_process(IntraProcessManagerWeakPtr weak_ipm);
+
+  /// Set the opaque callback group membership handle, see rclcpp::CallbackGroup.
+  /**
+   * \param[in] membership the handle, nullptr to unlink from the group.
+   */
+  RCLCPP_PUBLIC
+  void
+  set_callback_group_membership(std::shared_ptr<void> membership);
+
 protected:
   RCLCPP_DISABLE_COPY(ClientBase)
 
@@ -346,6 +392,19 @@ protected:
   bool
   wait_for_service_nanoseconds(std::chrono::nanoseconds timeout);
 
+  /// Wait on a graph event filtered to this service name.
+  /**
+   * Used by wait_for_service_nanoseconds() when the node's graph interface is
+   * the stock NodeGraph; only wakes when a matching server (dis)appears
+   * instead of on every graph change.
+   */
+  RCLCPP_PUBLIC
+  bool
+  wait_for_service_filtered_nanoseconds(
+    std::shared_ptr<rclcpp::node_interfaces::NodeGraph> node_graph,
+    std::chrono::nanoseconds timeout,
+    std::chrono::steady_clock::time_point start);
+
   RCLCPP_PUBLIC
   rcl_node_t *
   get_rcl_node_handle();
@@ -373,6 +432,12 @@ protected:
   std::shared_ptr<rcl_client_t> client_handle_;
 
   std::atomic<bool> in_use_by_wait_set_{false};
+
+  // Unlinks this client from its callback group on destruction.
+  std::shared_ptr<void> callback_group_membership_;
+
+  bool use_intra_process_{false};
+  IntraProcessManagerWeakPtr weak_ipm_;
 };
 
 template<typename ServiceT>
@@ -397,6 +462,9 @@ public:
 
   using CallbackType = std::function<void (SharedFuture)>;
   using CallbackWithRequestType = std::function<void (SharedFutureWithRequest)>;
+  using StreamCallbackType = std::function<void (SharedResponse)>;
+
+  class RequestStream;
 
   RCLCPP_SMART_PTR_DEFINITIONS(Client)
 
@@ -521,14 +589,79 @@ public:
     return this->take_type_erased_response(&response_out, request_header_out);
   }
 
+  /// Send a request without throwing and without registering a callback.
+  /**
+   * Error-code variant of async_send_request() for callers that cannot afford
+   * exceptions on the hot path, e.g. builds compiled without exception
+   * support.
+   * The request always goes over the middleware (the intra-process fast path
+   * is skipped) and is not entered in the pending request tables, so no
+   * future or callback will complete for it: poll for the response with
+   * try_take_response() and match it by the returned sequence number.
+   * No allocation happens on any branch and the rcl error state is reset
+   * before returning, so nothing is left pending for a later throwing call.
+   *
+   * \param[in] request the request to send.
+   * \param[out] sequence_number_out the sequence number identifying this
+   *   request, valid only when RCL_RET_OK is returned.
+   * \return RCL_RET_OK if the request was sent,
+   *   or the error code from rcl_send_request() on failure.
+   */
+  rcl_ret_t
+  try_send_request(const Request & request, int64_t & sequence_number_out) noexcept
+  {
+    std::lock_guard<std::mutex> lock(pending_requests_mutex_);
+    rcl_ret_t ret = rcl_send_request(
+      get_client_handle().get(), &request, &sequence_number_out);
+    if (RCL_RET_OK != ret) {
+      rcl_reset_error();
+    }
+    return ret;
+  }
+
+  /// Take the next response for this client without throwing on failure.
+  /**
+   * \sa ClientBase::try_take_type_erased_response().
+   *
+   * \param[out] response_out The reference to a Service Response into
+   *   which the middleware will copy the response being taken.
+   * \param[out] request_header_out The request header to be filled by the
+   *   middleware when taking.
+   * \return RCL_RET_OK if a response was taken,
+   *   RCL_RET_CLIENT_TAKE_FAILED if no response was pending,
+   *   or the error code from rcl_take_response() on failure.
+   */
+  rcl_ret_t
+  try_take_response(
+    typename ServiceT::Response & response_out, rmw_request_id_t & request_header_out) noexcept
+  {
+    return this->try_take_type_erased_response(&response_out, request_header_out);
+  }
+
   /// Create a shared pointer with the response type
   /**
+   * The instance comes from a per-client recycling pool and returns to it
+   * when the last user reference drops, so the steady-state take path does
+   * not allocate a fresh response per RPC.
+   *
    * \return shared pointer with the response type
    */
   std::shared_ptr<void>
   create_response() override
   {
-    return std::shared_ptr<void>(new typename ServiceT::Response());
+    auto pool = response_pool_;
+    Response * response = pool->acquire();
+    return std::shared_ptr<void>(
+      response,
+      [pool](void * ptr) {
+        auto * typed = static_cast<Response *>(ptr);
+        if (!pool->release(typed)) {
+          // The pool already holds its depth in idle instances.
+          typed->~Response();
+          auto allocator = pool->get_message_allocator();
+          allocator.deallocate(typed, 1);
+        }
+      });
   }
 
   /// Create a shared pointer with a rmw_request_id_t
@@ -558,28 +691,9 @@ public:
     if (!optional_pending_request) {
       return;
     }
-    auto & value = *optional_pending_request;
     auto typed_response = std::static_pointer_cast<typename ServiceT::Response>(
       std::move(response));
-    if (std::holds_alternative<Promise>(value)) {
-      auto & promise = std::get<Promise>(value);
-      promise.set_value(std::move(typed_response));
-    } else if (std::holds_alternative<CallbackTypeValueVariant>(value)) {
-      auto & inner = std::get<CallbackTypeValueVariant>(value);
-      const auto & callback = std::get<CallbackType>(inner);
-      auto & promise = std::get<Promise>(inner);
-      auto & future = std::get<SharedFuture>(inner);
-      promise.set_value(std::move(typed_response));
-      callback(std::move(future));
-    } else if (std::holds_alternative<CallbackWithRequestTypeValueVariant>(value)) {
-      auto & inner = std::get<CallbackWithRequestTypeValueVariant>(value);
-      const auto & callback = std::get<CallbackWithRequestType>(inner);
-      auto & promise = std::get<PromiseWithRequest>(inner);
-      auto & future = std::get<SharedFutureWithRequest>(inner);
-      auto & request = std::get<SharedRequest>(inner);
-      promise.set_value(std::make_pair(std::move(request), std::move(typed_response)));
-      callback(std::move(future));
-    }
+    this->dispatch_response(std::move(*optional_pending_request), std::move(typed_response));
   }
 
   /// Send a request to the service server.
@@ -607,12 +721,18 @@ public:
    * }
    * ```
    *
+   * If intra-process communication is enabled and a service matching this
+   * client exists in the same process, the request is instead dispatched to
+   * the service callback inline on this thread and the returned future is
+   * already completed; the request id is negative in that case.
+   *
    * \param[in] request request to be send.
    * \return a FutureAndRequestId instance.
    */
   FutureAndRequestId
   async_send_request(SharedRequest request)
   {
+    allocation_audit::record("Client::async_send_request", sizeof(Promise));
     Promise promise;
     auto future = promise.get_future();
     auto req_id = async_send_request_impl(
@@ -648,6 +768,7 @@ public:
   SharedFutureAndRequestId
   async_send_request(SharedRequest request, CallbackT && cb)
   {
+    allocation_audit::record("Client::async_send_request", sizeof(Promise));
     Promise promise;
     auto shared_future = promise.get_future().share();
     auto req_id = async_send_request_impl(
@@ -679,6 +800,7 @@ public:
   SharedFutureWithRequestAndRequestId
   async_send_request(SharedRequest request, CallbackT && cb)
   {
+    allocation_audit::record("Client::async_send_request", sizeof(PromiseWithRequest));
     PromiseWithRequest promise;
     auto shared_future = promise.get_future().share();
     auto req_id = async_send_request_impl(
@@ -691,6 +813,110 @@ public:
     return SharedFutureWithRequestAndRequestId{std::move(shared_future), req_id};
   }
 
+  /// Bounded pipeline of requests, see Client::create_request_stream().
+  /**
+   * A request stream keeps at most a fixed number of requests outstanding at
+   * once. try_send() claims a window slot and sends; the response callback
+   * is invoked inline on the executor thread with the typed response, with
+   * no std::promise/std::future pair per call, and releases the slot. When
+   * the window is full try_send() returns false, giving the caller
+   * backpressure instead of an unbounded pending request backlog.
+   *
+   * A stream borrows from the Client that created it and must not outlive
+   * it. Responses arriving after the stream was destroyed are dropped. The
+   * window slot of a request removed via remove_pending_request() or the
+   * prune methods is not released, as the stream cannot tell it from one
+   * still awaiting its response.
+   */
+  class RequestStream : public std::enable_shared_from_this<RequestStream>
+  {
+  public:
+    /// Send a request if the outstanding window allows it.
+    /**
+     * \param[in] request request to be sent.
+     * \return true if the request was sent, false if the window is full.
+     * \throws anything rclcpp::exceptions::throw_from_rcl_error can throw.
+     */
+    bool
+    try_send(SharedRequest request)
+    {
+      // Lock-free window claim; released when the response is handled.
+      size_t current = in_flight_.load(std::memory_order_relaxed);
+      do {
+        if (current >= window_size_) {
+          return false;
+        }
+      } while (!in_flight_.compare_exchange_weak(
+          current, current + 1u, std::memory_order_acq_rel));
+      try {
+        client_->async_send_request_impl(
+          *request, std::weak_ptr<RequestStream>(this->shared_from_this()));
+      } catch (...) {
+        in_flight_.fetch_sub(1u, std::memory_order_acq_rel);
+        throw;
+      }
+      return true;
+    }
+
+    /// Return the number of requests currently outstanding.
+    size_t
+    in_flight() const
+    {
+      return in_flight_.load(std::memory_order_acquire);
+    }
+
+    /// Return the maximum number of outstanding requests.
+    size_t
+    window_size() const
+    {
+      return window_size_;
+    }
+
+  private:
+    friend class Client<ServiceT>;
+
+    RequestStream(Client<ServiceT> * client, size_t window_size, StreamCallbackType callback)
+    : client_(client), window_size_(window_size), callback_(std::move(callback))
+    {}
+
+    void
+    handle_stream_response(SharedResponse response)
+    {
+      in_flight_.fetch_sub(1u, std::memory_order_acq_rel);
+      callback_(std::move(response));
+    }
+
+    Client<ServiceT> * client_;
+    const size_t window_size_;
+    const StreamCallbackType callback_;
+    std::atomic<size_t> in_flight_{0};
+  };
+
+  /// Create a stream of requests with a bounded outstanding window.
+  /**
+   * Unlike repeated async_send_request() calls, a stream cannot leak pending
+   * requests -- at most `window_size` are outstanding at any time -- and its
+   * responses are delivered straight to the given callback without a
+   * promise/future pair per request.
+   *
+   * \param[in] window_size maximum number of outstanding requests.
+   * \param[in] callback invoked on the executor thread with each response.
+   * \return the stream; it must not outlive this client.
+   * \throws std::invalid_argument if window_size is zero or callback is empty.
+   */
+  std::shared_ptr<RequestStream>
+  create_request_stream(size_t window_size, StreamCallbackType callback)
+  {
+    if (0u == window_size) {
+      throw std::invalid_argument("create_request_stream(): window_size must not be zero");
+    }
+    if (!callback) {
+      throw std::invalid_argument("create_request_stream(): callback must not be empty");
+    }
+    return std::shared_ptr<RequestStream>(
+      new RequestStream(this, window_size, std::move(callback)));
+  }
+
   /// Cleanup a pending request.
   /**
    * This notifies the client that we have waited long enough for a response from the server
@@ -706,6 +932,14 @@ public:
   remove_pending_request(int64_t request_id)
   {
     std::lock_guard guard(pending_requests_mutex_);
+    if (!pending_request_slots_.empty()) {
+      auto & slot = this->slot_for_sequence_number(request_id);
+      if (slot.sequence_number == request_id) {
+        slot.sequence_number = kFreeSlot;
+        slot.value.reset();
+        return true;
+      }
+    }
     return pending_requests_.erase(request_id) != 0u;
   }
 
@@ -755,6 +989,13 @@ public:
     std::lock_guard guard(pending_requests_mutex_);
     auto ret = pending_requests_.size();
     pending_requests_.clear();
+    for (auto & slot : pending_request_slots_) {
+      if (kFreeSlot != slot.sequence_number) {
+        slot.sequence_number = kFreeSlot;
+        slot.value.reset();
+        ++ret;
+      }
+    }
     return ret;
   }
 
@@ -783,7 +1024,51 @@ public:
         ++it;
       }
     }
-    return old_size - pending_requests_.size();
+    size_t pruned = old_size - pending_requests_.size();
+    for (auto & slot : pending_request_slots_) {
+      if (kFreeSlot != slot.sequence_number && slot.time < time_point) {
+        if (pruned_requests) {
+          pruned_requests->push_back(slot.sequence_number);
+        }
+        slot.sequence_number = kFreeSlot;
+        slot.value.reset();
+        ++pruned;
+      }
+    }
+    return pruned;
+  }
+
+  /// Preallocate a fixed table of slots for pending requests.
+  /**
+   * When a table is reserved, in-flight requests are kept in a slot indexed
+   * by their sequence number modulo the capacity instead of the pending
+   * request map, making async_send_request() and handle_response()
+   * allocation-free as long as at most `capacity` requests are in flight.
+   * If a slot is still held by an older, unanswered request, the new request
+   * transparently overflows into the map.
+   *
+   * \param[in] capacity number of slots to preallocate.
+   * \throws std::runtime_error if there are requests pending, since resizing
+   *   the table would remap their slots.
+   */
+  void
+  reserve_pending_requests(size_t capacity)
+  {
+    std::lock_guard guard(pending_requests_mutex_);
+    if (capacity == pending_request_slots_.size()) {
+      return;
+    }
+    if (!pending_requests_.empty()) {
+      throw std::runtime_error(
+              "cannot reserve pending request slots while requests are pending");
+    }
+    for (const auto & slot : pending_request_slots_) {
+      if (kFreeSlot != slot.sequence_number) {
+        throw std::runtime_error(
+                "cannot reserve pending request slots while requests are pending");
+      }
+    }
+    pending_request_slots_ = std::vector<PendingRequestSlot>(capacity);
   }
 
   /// Configure client introspection.
@@ -821,17 +1106,116 @@ protected:
   using CallbackInfoVariant = std::variant<
     std::promise<SharedResponse>,
     CallbackTypeValueVariant,
-    CallbackWithRequestTypeValueVariant>;
+    CallbackWithRequestTypeValueVariant,
+    std::weak_ptr<RequestStream>>;
+
+  /// Complete a pending request with its typed response.
+  /**
+   * Static on purpose: the intra-process path completes requests from the
+   * service's executor thread, possibly after this client is gone.
+   */
+  static void
+  dispatch_response(CallbackInfoVariant value, SharedResponse typed_response)
+  {
+    if (std::holds_alternative<Promise>(value)) {
+      auto & promise = std::get<Promise>(value);
+      promise.set_value(std::move(typed_response));
+    } else if (std::holds_alternative<CallbackTypeValueVariant>(value)) {
+      auto & inner = std::get<CallbackTypeValueVariant>(value);
+      const auto & callback = std::get<CallbackType>(inner);
+      auto & promise = std::get<Promise>(inner);
+      auto & future = std::get<SharedFuture>(inner);
+      promise.set_value(std::move(typed_response));
+      callback(std::move(future));
+    } else if (std::holds_alternative<CallbackWithRequestTypeValueVariant>(value)) {
+      auto & inner = std::get<CallbackWithRequestTypeValueVariant>(value);
+      const auto & callback = std::get<CallbackWithRequestType>(inner);
+      auto & promise = std::get<PromiseWithRequest>(inner);
+      auto & future = std::get<SharedFutureWithRequest>(inner);
+      auto & request = std::get<SharedRequest>(inner);
+      promise.set_value(std::make_pair(std::move(request), std::move(typed_response)));
+      callback(std::move(future));
+    } else if (std::holds_alternative<std::weak_ptr<RequestStream>>(value)) {
+      auto stream = std::get<std::weak_ptr<RequestStream>>(value).lock();
+      if (stream) {
+        stream->handle_stream_response(std::move(typed_response));
+      }
+      // If the stream is gone, the response is dropped; nobody is waiting.
+    }
+  }
+
+  /// Find the intra-process service matching this client, if any.
+  /**
+   * The match is cached; as long as the service stays alive subsequent
+   * requests skip the intra process manager lookup entirely.
+   */
+  typename Service<ServiceT>::SharedPtr
+  get_intra_process_service()
+  {
+    std::lock_guard<std::mutex> lock(pending_requests_mutex_);
+    auto service = intra_process_service_.lock();
+    if (service) {
+      return service;
+    }
+    auto ipm = weak_ipm_.lock();
+    if (!ipm) {
+      return nullptr;
+    }
+    auto base = ipm->get_matching_service(
+      this->get_service_name(), srv_type_support_handle_);
+    if (!base) {
+      return nullptr;
+    }
+    // Matching type support handles guarantee the service is a
+    // Service<ServiceT>, since the handle is a per-type singleton.
+    service = std::static_pointer_cast<Service<ServiceT>>(base);
+    intra_process_service_ = service;
+    return service;
+  }
 
   int64_t
   async_send_request_impl(const Request & request, CallbackInfoVariant value)
   {
+    if (use_intra_process_) {
+      auto service = this->get_intra_process_service();
+      if (service) {
+        // Queue the request into the service's waitable; its user callback
+        // then runs on the service's executor, inside its callback group,
+        // like a middleware-delivered request, and the completion below
+        // finishes the promise/callback when the response is ready. The
+        // request is never stored in this client's pending tables, and the
+        // sequence numbers handed out here are negative so they cannot
+        // collide with rcl ones (-1 is reserved as the free-slot sentinel).
+        auto pending_value = std::make_shared<CallbackInfoVariant>(std::move(value));
+        if (service->queue_intra_process_request(
+            std::make_shared<Request>(request),
+            [pending_value](SharedResponse response) {
+              dispatch_response(std::move(*pending_value), std::move(response));
+            }))
+        {
+          return -2 - intra_process_sequence_number_.fetch_add(1, std::memory_order_relaxed);
+        }
+        // The service has no intra-process waitable; use the middleware.
+        value = std::move(*pending_value);
+      }
+    }
     int64_t sequence_number;
     std::lock_guard<std::mutex> lock(pending_requests_mutex_);
     rcl_ret_t ret = rcl_send_request(get_client_handle().get(), &request, &sequence_number);
     if (RCL_RET_OK != ret) {
       rclcpp::exceptions::throw_from_rcl_error(ret, "failed to send request");
     }
+    if (!pending_request_slots_.empty()) {
+      auto & slot = this->slot_for_sequence_number(sequence_number);
+      if (kFreeSlot == slot.sequence_number) {
+        slot.sequence_number = sequence_number;
+        slot.time = std::chrono::system_clock::now();
+        slot.value.emplace(std::move(value));
+        return sequence_number;
+      }
+      // The slot is still held by an older, unanswered request; overflow
+      // into the map.
+    }
     pending_requests_.try_emplace(
       sequence_number,
       std::make_pair(std::chrono::system_clock::now(), std::move(value)));
@@ -842,6 +1226,15 @@ protected:
   get_and_erase_pending_request(int64_t request_number)
   {
     std::unique_lock<std::mutex> lock(pending_requests_mutex_);
+    if (!pending_request_slots_.empty()) {
+      auto & slot = this->slot_for_sequence_number(request_number);
+      if (slot.sequence_number == request_number) {
+        auto value = std::move(*slot.value);
+        slot.sequence_number = kFreeSlot;
+        slot.value.reset();
+        return value;
+      }
+    }
     auto it = this->pending_requests_.find(request_number);
     if (it == this->pending_requests_.end()) {
       RCUTILS_LOG_DEBUG_NAMED(
@@ -856,16 +1249,47 @@ protected:
 
   RCLCPP_DISABLE_COPY(Client)
 
+  /// A preallocated home for one in-flight request, see reserve_pending_requests().
+  struct PendingRequestSlot
+  {
+    int64_t sequence_number{-1};
+    std::chrono::time_point<std::chrono::system_clock> time;
+    std::optional<CallbackInfoVariant> value;
+  };
+
+  static constexpr int64_t kFreeSlot = -1;
+
+  /// Return the slot a sequence number maps to; only valid if slots are reserved.
+  PendingRequestSlot &
+  slot_for_sequence_number(int64_t sequence_number)
+  {
+    return pending_request_slots_[
+      static_cast<uint64_t>(sequence_number) % pending_request_slots_.size()];
+  }
+
   std::unordered_map<
     int64_t,
     std::pair<
       std::chrono::time_point<std::chrono::system_clock>,
       CallbackInfoVariant>>
   pending_requests_;
+  // Fixed-capacity slot table used instead of the map when non-empty.
+  // Sequence numbers from rcl increase monotonically, so modulo indexing
+  // keeps each in-flight request in its own slot while at most
+  // `pending_request_slots_.size()` requests are outstanding.
+  std::vector<PendingRequestSlot> pending_request_slots_;
   std::mutex pending_requests_mutex_;
 
 private:
   const rosidl_service_type_support_t * srv_type_support_handle_;
+
+  /// Recycling pool backing create_response(); bounded to its default depth.
+  typename LoanedMessagePool<Response>::SharedPtr response_pool_ =
+    std::make_shared<LoanedMessagePool<Response>>();
+
+  // Cached intra-process match, guarded by pending_requests_mutex_.
+  typename Service<ServiceT>::WeakPtr intra_process_service_;
+  std::atomic<int64_t> intra_process_sequence_number_{0};
 };
 
 }  // namespace rclcpp
@@ -15,13 +15,17 @@
 #ifndef RCLCPP__CONTEXT_HPP_
 #define RCLCPP__CONTEXT_HPP_
 
+#include <array>
+#include <atomic>
 #include <condition_variable>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <typeindex>
 #include <typeinfo>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -58,6 +62,7 @@ public:
 
 private:
   std::weak_ptr<ShutdownCallbackType> callback;
+  uint64_t id = 0;
 };
 
 using OnShutdownCallbackHandle = ShutdownCallbackHandle;
@@ -330,6 +335,53 @@ public:
   void
   interrupt_all_sleep_for();
 
+  /// Return the existing sub context of the given type, or nullptr if it was never created.
+  template<typename SubContext>
+  std::shared_ptr<SubContext>
+  peek_sub_context()
+  {
+    std::lock_guard<std::recursive_mutex> lock(sub_contexts_mutex_);
+    auto it = sub_contexts_.find(std::type_index(typeid(SubContext)));
+    if (it == sub_contexts_.end()) {
+      return nullptr;
+    }
+    return std::static_pointer_cast<SubContext>(it->second);
+  }
+
+  /// Whether shutdown() has activated deferred entity finalization.
+  /**
+   * \sa InitOptions::deferred_entity_finalization
+   */
+  RCLCPP_PUBLIC
+  bool
+  is_deferred_finalization_active() const;
+
+  /// Run the given finalization work on the context's teardown thread.
+  /**
+   * During deferred teardown (see InitOptions::deferred_entity_finalization)
+   * entity destructors hand the release of their rcl handles here, so the
+   * expensive rcl/rmw finalization round trips leave the destruction path.
+   * The work runs inline when the mode is not active.
+   *
+   * The work runs on one dedicated thread in submission order, since rcl
+   * entity finalization on a shared node is not guaranteed to be thread-safe
+   * across rmw implementations.
+   *
+   * \param[in] finalize the finalization work to run.
+   */
+  RCLCPP_PUBLIC
+  void
+  defer_entity_finalization(std::function<void()> finalize);
+
+  /// Block until all deferred finalization work has run.
+  /**
+   * Joins the teardown thread and deactivates deferred finalization; called
+   * during cleanup, but may also be called to fence on teardown completion.
+   */
+  RCLCPP_PUBLIC
+  void
+  wait_for_deferred_finalization();
+
   /// Return a singleton instance for the SubContext type, constructing one if necessary.
   template<typename SubContext, typename ... Args>
   std::shared_ptr<SubContext>
@@ -376,15 +428,56 @@ private:
   std::shared_ptr<std::recursive_mutex> logging_mutex_;
 
   std::unordered_map<std::type_index, std::shared_ptr<void>> sub_contexts_;
+
+  /// Deferred teardown machinery, see defer_entity_finalization().
+  std::atomic<bool> deferred_finalization_active_ {false};
+  std::mutex deferred_finalization_mutex_;
+  std::condition_variable deferred_finalization_cv_;
+  std::vector<std::function<void()>> deferred_finalization_queue_;
+  std::thread deferred_finalization_thread_;
+  bool deferred_finalization_exit_ {false};
+
   // This mutex is recursive so that the constructor of a sub context may
   // attempt to acquire another sub context.
   std::recursive_mutex sub_contexts_mutex_;
 
-  std::vector<std::shared_ptr<OnShutdownCallback>> on_shutdown_callbacks_;
-  mutable std::mutex on_shutdown_callbacks_mutex_;
+  /// Sharded, handle-id keyed storage for shutdown callbacks.
+  /**
+   * Callback slots are spread over independently locked shards, keyed by an
+   * id drawn from an atomic counter, so per-object registration and O(1)
+   * handle-based removal from many threads only contend within one shard
+   * instead of on a single list-wide mutex.  Ids are monotonic, which lets
+   * collect() restore registration order for execution.
+   */
+  class ShutdownCallbackRegistry
+  {
+  public:
+    /// Store the callback and return the id for its handle.
+    uint64_t
+    add(std::shared_ptr<ShutdownCallbackHandle::ShutdownCallbackType> callback);
+
+    /// Remove the callback slot with the given id, returning false if absent.
+    bool
+    remove(uint64_t id);
+
+    /// Return the registered callbacks in registration order.
+    std::vector<std::shared_ptr<ShutdownCallbackHandle::ShutdownCallbackType>>
+    collect() const;
+
+  private:
+    static constexpr size_t kShardCount = 8;
+    struct Shard
+    {
+      mutable std::mutex mutex;
+      std::unordered_map<
+        uint64_t, std::shared_ptr<ShutdownCallbackHandle::ShutdownCallbackType>> slots;
+    };
+    std::atomic<uint64_t> next_id_ {1};
+    std::array<Shard, kShardCount> shards_;
+  };
 
-  std::vector<std::shared_ptr<PreShutdownCallback>> pre_shutdown_callbacks_;
-  mutable std::mutex pre_shutdown_callbacks_mutex_;
+  ShutdownCallbackRegistry on_shutdown_callbacks_;
+  ShutdownCallbackRegistry pre_shutdown_callbacks_;
 
   /// Condition variable for timed sleep (see sleep_for).
   std::condition_variable interrupt_condition_variable_;
@@ -18,6 +18,7 @@
 #include <memory>
 #include <string>
 
+#include "rclcpp/experimental/intra_process_manager.hpp"
 #include "rclcpp/node_interfaces/node_base_interface.hpp"
 #include "rclcpp/node_interfaces/node_services_interface.hpp"
 #include "rclcpp/qos.hpp"
@@ -78,6 +79,14 @@ create_client(
 
   auto cli_base_ptr = std::dynamic_pointer_cast<rclcpp::ClientBase>(cli);
   node_services->add_client(cli_base_ptr, group);
+
+  if (node_base->get_use_intra_process_default()) {
+    // Clients are not registered with the manager; they look up (and cache)
+    // a matching service when sending requests.
+    auto context = node_base->get_context();
+    auto ipm = context->get_sub_context<rclcpp::experimental::IntraProcessManager>();
+    cli->setup_intra_process(ipm);
+  }
   return cli;
 }
 
@@ -57,7 +57,7 @@ std::shared_ptr<GenericSubscription> create_generic_subscription(
   )
 )
 {
-  auto ts_lib = rclcpp::get_typesupport_library(
+  auto ts_lib = rclcpp::get_cached_typesupport_library(
     topic_type, "rosidl_typesupport_cpp");
 
   auto subscription = std::make_shared<GenericSubscription>(
@@ -74,6 +74,50 @@ std::shared_ptr<GenericSubscription> create_generic_subscription(
   return subscription;
 }
 
+/// Create and return a GenericSubscription with a borrowed-view callback.
+/**
+ * Same as the other overload, except that new messages are delivered as a
+ * SerializedMessageView borrowing the subscription's take buffer instead of an
+ * owning SerializedMessage, avoiding a per-message heap allocation.
+ *
+ * \param topics_interface NodeTopicsInterface pointer used in parts of the setup.
+ * \param topic_name Topic name
+ * \param topic_type Topic type
+ * \param qos %QoS settings
+ * \param callback Callback for a borrowed view of new serialized messages
+ * \param options %Publisher options.
+ * Not all publisher options are currently respected, the only relevant options for this
+ * publisher are `event_callbacks`, `use_default_callbacks`, and `%callback_group`.
+ */
+template<typename AllocatorT = std::allocator<void>>
+std::shared_ptr<GenericSubscription> create_generic_subscription(
+  rclcpp::node_interfaces::NodeTopicsInterface::SharedPtr topics_interface,
+  const std::string & topic_name,
+  const std::string & topic_type,
+  const rclcpp::QoS & qos,
+  std::function<void(rclcpp::SerializedMessageView)> callback,
+  const rclcpp::SubscriptionOptionsWithAllocator<AllocatorT> & options = (
+    rclcpp::SubscriptionOptionsWithAllocator<AllocatorT>()
+  )
+)
+{
+  auto ts_lib = rclcpp::get_cached_typesupport_library(
+    topic_type, "rosidl_typesupport_cpp");
+
+  auto subscription = std::make_shared<GenericSubscription>(
+    topics_interface->get_node_base_interface(),
+    std::move(ts_lib),
+    topic_name,
+    topic_type,
+    qos,
+    std::move(callback),
+    options);
+
+  topics_interface->add_subscription(subscription, options.callback_group);
+
+  return subscription;
+}
+
 }  // namespace rclcpp
 
 #endif  // RCLCPP__CREATE_GENERIC_SUBSCRIPTION_HPP_
@@ -0,0 +1,83 @@
+// Copyright 2024 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__CREATE_LAZY_SUBSCRIPTION_HPP_
+#define RCLCPP__CREATE_LAZY_SUBSCRIPTION_HPP_
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "rosidl_runtime_cpp/traits.hpp"
+
+#include "rclcpp/create_generic_subscription.hpp"
+#include "rclcpp/generic_subscription.hpp"
+#include "rclcpp/lazy_message.hpp"
+#include "rclcpp/node_interfaces/node_topics_interface.hpp"
+#include "rclcpp/qos.hpp"
+#include "rclcpp/serialized_message.hpp"
+#include "rclcpp/subscription_options.hpp"
+
+namespace rclcpp
+{
+
+/// Create and return a subscription delivering lazily-deserialized messages.
+/**
+ * The callback receives a LazyMessage handle over the serialized message:
+ * dereferencing the handle deserializes the full message on first access,
+ * while `stamp()` and `frame_id()` read the leading header fields straight
+ * out of the CDR buffer. A monitoring node that only looks at the stamp
+ * therefore never pays for deserializing the message body.
+ *
+ * This is implemented on top of GenericSubscription, so it does not support
+ * intra-process handling.
+ *
+ * \param topics_interface NodeTopicsInterface pointer used in parts of the setup.
+ * \param topic_name Topic name
+ * \param qos %QoS settings
+ * \param callback Callback receiving a LazyMessage handle for new messages
+ * \param options %Subscription options.
+ * Not all subscription options are currently respected, the only relevant options for this
+ * subscription are `event_callbacks`, `use_default_callbacks`, `ignore_local_publications`, and
+ * `%callback_group`.
+ */
+template<typename MessageT, typename AllocatorT = std::allocator<void>>
+std::shared_ptr<GenericSubscription> create_lazy_subscription(
+  rclcpp::node_interfaces::NodeTopicsInterface::SharedPtr topics_interface,
+  const std::string & topic_name,
+  const rclcpp::QoS & qos,
+  std::function<void(rclcpp::LazyMessage<MessageT>)> callback,
+  const rclcpp::SubscriptionOptionsWithAllocator<AllocatorT> & options = (
+    rclcpp::SubscriptionOptionsWithAllocator<AllocatorT>()
+  )
+)
+{
+  std::function<void(std::shared_ptr<rclcpp::SerializedMessage>)> wrapped_callback =
+    [callback = std::move(callback)](std::shared_ptr<rclcpp::SerializedMessage> message) {
+      callback(rclcpp::LazyMessage<MessageT>(std::move(message)));
+    };
+
+  return rclcpp::create_generic_subscription(
+    topics_interface,
+    topic_name,
+    rosidl_generator_traits::name<MessageT>(),
+    qos,
+    std::move(wrapped_callback),
+    options);
+}
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__CREATE_LAZY_SUBSCRIPTION_HPP_
@@ -19,6 +19,7 @@
 #include <string>
 #include <utility>
 
+#include "rclcpp/experimental/intra_process_manager.hpp"
 #include "rclcpp/node_interfaces/node_base_interface.hpp"
 #include "rclcpp/node_interfaces/node_services_interface.hpp"
 #include "rclcpp/visibility_control.hpp"
@@ -75,6 +76,21 @@ create_service(
     node_base->get_shared_rcl_node_handle(),
     service_name, any_service_callback, service_options);
   auto serv_base_ptr = std::dynamic_pointer_cast<ServiceBase>(serv);
+
+  if (node_base->get_use_intra_process_default()) {
+    // Register the service so that clients of the same context can route
+    // requests to it directly, without going through the middleware. The
+    // waitable buffering those requests must exist before the service is
+    // discoverable, and must be registered before add_service() below so it
+    // is added to the service's callback group.
+    auto context = node_base->get_context();
+    auto ipm = context->get_sub_context<rclcpp::experimental::IntraProcessManager>();
+    serv->create_intra_process_waitable(context);
+    uint64_t intra_process_service_id =
+      ipm->add_service(serv_base_ptr, serv->get_service_type_support_handle());
+    serv->setup_intra_process(intra_process_service_id, ipm);
+  }
+
   node_services->add_service(serv_base_ptr, group);
   return serv;
 }
@@ -32,6 +32,7 @@
 #include "rclcpp/create_publisher.hpp"
 #include "rclcpp/create_timer.hpp"
 #include "rclcpp/qos.hpp"
+#include "rclcpp/subscription_busy_poller.hpp"
 #include "rclcpp/subscription_factory.hpp"
 #include "rclcpp/subscription_options.hpp"
 #include "rclcpp/timer.hpp"
@@ -73,7 +74,12 @@ create_subscription(
   std::shared_ptr<rclcpp::topic_statistics::SubscriptionTopicStatistics<ROSMessageType>>
   subscription_topic_stats = nullptr;
 
-  if (rclcpp::detail::resolve_enable_topic_statistics(
+  if (options.slim && rclcpp::TopicStatisticsState::Enable == options.topic_stats_options.state) {
+    throw std::invalid_argument("topic statistics can not be enabled when the slim option is set");
+  }
+
+  if (!options.slim &&
+    rclcpp::detail::resolve_enable_topic_statistics(
       options,
       *node_topics_interface->get_node_base_interface()))
   {
@@ -84,39 +90,87 @@ create_subscription(
               " ms");
     }
 
-    std::shared_ptr<Publisher<statistics_msgs::msg::MetricsMessage>>
-    publisher = rclcpp::detail::create_publisher<statistics_msgs::msg::MetricsMessage>(
-      node_parameters,
-      node_topics_interface,
-      options.topic_stats_options.publish_topic,
-      qos);
-
-    subscription_topic_stats = std::make_shared<
-      rclcpp::topic_statistics::SubscriptionTopicStatistics<ROSMessageType>
-      >(node_topics_interface->get_node_base_interface()->get_name(), publisher);
-
-    std::weak_ptr<
-      rclcpp::topic_statistics::SubscriptionTopicStatistics<ROSMessageType>
-    > weak_subscription_topic_stats(subscription_topic_stats);
-    auto sub_call_back = [weak_subscription_topic_stats]() {
-        auto subscription_topic_stats = weak_subscription_topic_stats.lock();
-        if (subscription_topic_stats) {
-          subscription_topic_stats->publish_message_and_reset_measurements();
-        }
-      };
+    if (0u == options.topic_stats_options.sample_rate) {
+      throw std::invalid_argument("topic_stats_options.sample_rate must be greater than 0");
+    }
 
     auto node_timer_interface = node_topics_interface->get_node_timers_interface();
 
-    auto timer = create_wall_timer(
-      std::chrono::duration_cast<std::chrono::nanoseconds>(
-        options.topic_stats_options.publish_period),
-      sub_call_back,
-      options.callback_group,
-      node_topics_interface->get_node_base_interface(),
-      node_timer_interface
-    );
+    if (options.topic_stats_options.aggregate) {
+      // One process-wide sink per statistics topic: its single timer drains
+      // every registered subscription and publishes the consolidated batch.
+      auto sink = rclcpp::topic_statistics::AggregatedTopicStatisticsSink::get_or_create(
+        options.topic_stats_options.publish_topic,
+        [&]() {
+          auto publisher =
+          rclcpp::detail::create_publisher<statistics_msgs::msg::MetricsMessage>(
+            node_parameters,
+            node_topics_interface,
+            options.topic_stats_options.publish_topic,
+            qos);
+          auto new_sink =
+          std::make_shared<rclcpp::topic_statistics::AggregatedTopicStatisticsSink>(publisher);
+          std::weak_ptr<rclcpp::topic_statistics::AggregatedTopicStatisticsSink>
+          weak_sink(new_sink);
+          auto timer = create_wall_timer(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+              options.topic_stats_options.publish_period),
+            [weak_sink]() {
+              auto sink = weak_sink.lock();
+              if (sink) {
+                sink->publish_batch();
+              }
+            },
+            options.callback_group,
+            node_topics_interface->get_node_base_interface(),
+            node_timer_interface);
+          new_sink->set_publisher_timer(timer);
+          return new_sink;
+        });
+
+      subscription_topic_stats = std::make_shared<
+        rclcpp::topic_statistics::SubscriptionTopicStatistics<ROSMessageType>
+        >(
+        node_topics_interface->get_node_base_interface()->get_name(),
+        sink,
+        options.topic_stats_options.sample_rate);
+      sink->add_source(subscription_topic_stats);
+    } else {
+      std::shared_ptr<Publisher<statistics_msgs::msg::MetricsMessage>>
+      publisher = rclcpp::detail::create_publisher<statistics_msgs::msg::MetricsMessage>(
+        node_parameters,
+        node_topics_interface,
+        options.topic_stats_options.publish_topic,
+        qos);
+
+      subscription_topic_stats = std::make_shared<
+        rclcpp::topic_statistics::SubscriptionTopicStatistics<ROSMessageType>
+        >(
+        node_topics_interface->get_node_base_interface()->get_name(),
+        publisher,
+        options.topic_stats_options.sample_rate);
 
-    subscription_topic_stats->set_publisher_timer(timer);
+      std::weak_ptr<
+        rclcpp::topic_statistics::SubscriptionTopicStatistics<ROSMessageType>
+      > weak_subscription_topic_stats(subscription_topic_stats);
+      auto sub_call_back = [weak_subscription_topic_stats]() {
+          auto subscription_topic_stats = weak_subscription_topic_stats.lock();
+          if (subscription_topic_stats) {
+            subscription_topic_stats->publish_message_and_reset_measurements();
+          }
+        };
+
+      auto timer = create_wall_timer(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+          options.topic_stats_options.publish_period),
+        sub_call_back,
+        options.callback_group,
+        node_topics_interface->get_node_base_interface(),
+        node_timer_interface
+      );
+
+      subscription_topic_stats->set_publisher_timer(timer);
+    }
   }
 
   auto factory =
@@ -135,6 +189,18 @@ create_subscription(
     qos;
 
   auto sub = node_topics_interface->create_subscription(topic_name, factory, actual_qos);
+
+  // Attached before add_subscription() so the busy-polled state is already
+  // visible when the subscription and its intra-process waitable would be
+  // associated with the callback group.
+  if (options.busy_poll_options.enabled) {
+    sub->set_busy_poller(
+      std::make_shared<rclcpp::SubscriptionBusyPoller>(
+        sub,
+        node_topics_interface->get_node_base_interface()->get_context(),
+        options.busy_poll_options.thread_attributes));
+  }
+
   node_topics_interface->add_subscription(sub, options.callback_group);
 
   return std::dynamic_pointer_cast<SubscriptionT>(sub);
@@ -91,7 +91,8 @@ create_timer(
   rclcpp::Duration period,
   CallbackT && callback,
   rclcpp::CallbackGroup::SharedPtr group = nullptr,
-  bool autostart = true)
+  bool autostart = true,
+  rclcpp::Duration phase = rclcpp::Duration(0, 0))
 {
   return create_timer(
     clock,
@@ -100,7 +101,8 @@ create_timer(
     group,
     node_base.get(),
     node_timers.get(),
-    autostart);
+    autostart,
+    phase.to_chrono<std::chrono::nanoseconds>());
 }
 
 /// Create a timer with a given clock
@@ -112,7 +114,8 @@ create_timer(
   rclcpp::Duration period,
   CallbackT && callback,
   rclcpp::CallbackGroup::SharedPtr group = nullptr,
-  bool autostart = true)
+  bool autostart = true,
+  rclcpp::Duration phase = rclcpp::Duration(0, 0))
 {
   return create_timer(
     clock,
@@ -121,7 +124,8 @@ create_timer(
     group,
     rclcpp::node_interfaces::get_node_base_interface(node).get(),
     rclcpp::node_interfaces::get_node_timers_interface(node).get(),
-    autostart);
+    autostart,
+    phase.to_chrono<std::chrono::nanoseconds>());
 }
 
 /// Convenience method to create a general timer with node resources.
@@ -137,9 +141,11 @@ create_timer(
  * \param node_base node base interface
  * \param node_timers node timer interface
  * \param autostart defines if the timer should start it's countdown on initialization or not.
+ * \param phase offset added to the first trigger only, de-synchronizing timers of equal
+ * period; see rclcpp::TimerBase::set_phase
  * \return shared pointer to a generic timer
  * \throws std::invalid_argument if either clock, node_base or node_timers
- * are nullptr, or period is negative or too large
+ * are nullptr, or period is negative or too large, or phase is negative
  */
 template<typename DurationRepT, typename DurationT, typename CallbackT>
 typename rclcpp::GenericTimer<CallbackT>::SharedPtr
@@ -150,7 +156,8 @@ create_timer(
   rclcpp::CallbackGroup::SharedPtr group,
   node_interfaces::NodeBaseInterface * node_base,
   node_interfaces::NodeTimersInterface * node_timers,
-  bool autostart = true)
+  bool autostart = true,
+  std::chrono::nanoseconds phase = std::chrono::nanoseconds::zero())
 {
   if (clock == nullptr) {
     throw std::invalid_argument{"clock cannot be null"};
@@ -167,6 +174,7 @@ create_timer(
   // Add a new generic timer.
   auto timer = rclcpp::GenericTimer<CallbackT>::make_shared(
     std::move(clock), period_ns, std::move(callback), node_base->get_context(), autostart);
+  timer->set_phase(phase);
   node_timers->add_timer(timer, group);
   return timer;
 }
@@ -182,9 +190,12 @@ create_timer(
  * \param group callback group
  * \param node_base node base interface
  * \param node_timers node timer interface
+ * \param autostart defines if the timer should start it's countdown on initialization or not.
+ * \param phase offset added to the first trigger only, de-synchronizing timers of equal
+ * period; see rclcpp::TimerBase::set_phase
  * \return shared pointer to a wall timer
  * \throws std::invalid_argument if either node_base or node_timers
- * are null, or period is negative or too large
+ * are null, or period is negative or too large, or phase is negative
  */
 template<typename DurationRepT, typename DurationT, typename CallbackT>
 typename rclcpp::WallTimer<CallbackT>::SharedPtr
@@ -194,7 +205,8 @@ create_wall_timer(
   rclcpp::CallbackGroup::SharedPtr group,
   node_interfaces::NodeBaseInterface * node_base,
   node_interfaces::NodeTimersInterface * node_timers,
-  bool autostart = true)
+  bool autostart = true,
+  std::chrono::nanoseconds phase = std::chrono::nanoseconds::zero())
 {
   if (node_base == nullptr) {
     throw std::invalid_argument{"input node_base cannot be null"};
@@ -209,6 +221,7 @@ create_wall_timer(
   // Add a new wall timer.
   auto timer = rclcpp::WallTimer<CallbackT>::make_shared(
     period_ns, std::move(callback), node_base->get_context(), autostart);
+  timer->set_phase(phase);
   node_timers->add_timer(timer, group);
   return timer;
 }
@@ -0,0 +1,284 @@
+// Copyright 2024 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__DETAIL__INPLACE_FUNCTION_HPP_
+#define RCLCPP__DETAIL__INPLACE_FUNCTION_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace rclcpp
+{
+namespace detail
+{
+
+/// Default capture capacity of InplaceFunction, in bytes.
+/**
+ * Large enough for captures of a handful of shared_ptr, which covers the
+ * typical entity callback, while keeping the wrappers reasonably small.
+ */
+inline constexpr size_t kDefaultInplaceFunctionCapacity = 64;
+
+template<typename SignatureT, size_t Capacity = kDefaultInplaceFunctionCapacity>
+class InplaceFunction;
+
+/// Type-erased callable wrapper that avoids allocating for small captures.
+/**
+ * Drop-in replacement for the std::function storage used by the entity
+ * callback wrappers (AnySubscriptionCallback, AnyServiceCallback):
+ * callables whose size fits `Capacity` are stored inline, so creating a
+ * callback from a lambda capturing a few shared_ptr does not touch the heap,
+ * and invocation goes through a plain function pointer instead of the
+ * vtable-like indirection of std::function. Callables larger than `Capacity`
+ * transparently fall back to heap storage, so there is no size limit on what
+ * users may capture.
+ *
+ * Like std::function, the stored callable must be copy constructible and
+ * `operator()` is const-qualified but invokes the callable as non-const.
+ */
+template<typename ReturnT, typename ... ArgTs, size_t Capacity>
+class InplaceFunction<ReturnT(ArgTs...), Capacity>
+{
+public:
+  InplaceFunction() noexcept = default;
+
+  InplaceFunction(std::nullptr_t) noexcept {}  // NOLINT(runtime/explicit)
+
+  /// Construct from any callable compatible with the signature.
+  template<
+    typename CallableT,
+    typename DecayedT = std::decay_t<CallableT>,
+    typename = std::enable_if_t<
+      !std::is_same_v<DecayedT, InplaceFunction> &&
+      !std::is_same_v<DecayedT, std::nullptr_t> &&
+      std::is_invocable_r_v<ReturnT, DecayedT &, ArgTs...>>>
+  InplaceFunction(CallableT && callable)  // NOLINT(runtime/explicit)
+  {
+    using HandlerT = Handler<DecayedT, fits_inline<DecayedT>()>;
+    HandlerT::create(storage_, std::forward<CallableT>(callable));
+    manage_ = &HandlerT::manage;
+    invoke_ = &HandlerT::invoke;
+  }
+
+  InplaceFunction(const InplaceFunction & other)
+  {
+    if (other.manage_) {
+      other.manage_(StorageOp::Copy, &storage_, const_cast<Storage *>(&other.storage_));
+      manage_ = other.manage_;
+      invoke_ = other.invoke_;
+    }
+  }
+
+  InplaceFunction(InplaceFunction && other) noexcept
+  {
+    if (other.manage_) {
+      other.manage_(StorageOp::Move, &storage_, &other.storage_);
+      manage_ = other.manage_;
+      invoke_ = other.invoke_;
+      other.manage_ = nullptr;
+      other.invoke_ = nullptr;
+    }
+  }
+
+  InplaceFunction & operator=(const InplaceFunction & other)
+  {
+    if (this != &other) {
+      InplaceFunction copy(other);
+      *this = std::move(copy);
+    }
+    return *this;
+  }
+
+  InplaceFunction & operator=(InplaceFunction && other) noexcept
+  {
+    if (this != &other) {
+      this->reset();
+      if (other.manage_) {
+        other.manage_(StorageOp::Move, &storage_, &other.storage_);
+        manage_ = other.manage_;
+        invoke_ = other.invoke_;
+        other.manage_ = nullptr;
+        other.invoke_ = nullptr;
+      }
+    }
+    return *this;
+  }
+
+  InplaceFunction & operator=(std::nullptr_t) noexcept
+  {
+    this->reset();
+    return *this;
+  }
+
+  ~InplaceFunction()
+  {
+    this->reset();
+  }
+
+  ReturnT operator()(ArgTs... args) const
+  {
+    if (!invoke_) {
+      throw std::bad_function_call();
+    }
+    return invoke_(const_cast<Storage *>(&storage_), std::forward<ArgTs>(args)...);
+  }
+
+  explicit operator bool() const noexcept
+  {
+    return invoke_ != nullptr;
+  }
+
+  friend bool operator==(const InplaceFunction & function, std::nullptr_t) noexcept
+  {
+    return !function;
+  }
+
+  friend bool operator==(std::nullptr_t, const InplaceFunction & function) noexcept
+  {
+    return !function;
+  }
+
+  friend bool operator!=(const InplaceFunction & function, std::nullptr_t) noexcept
+  {
+    return static_cast<bool>(function);
+  }
+
+  friend bool operator!=(std::nullptr_t, const InplaceFunction & function) noexcept
+  {
+    return static_cast<bool>(function);
+  }
+
+private:
+  union Storage
+  {
+    alignas(std::max_align_t) unsigned char inline_storage[Capacity];
+    void * heap;
+  };
+
+  enum class StorageOp {Destroy, Copy, Move};
+
+  using ManageFnT = void (*)(StorageOp, Storage *, Storage *);
+  using InvokeFnT = ReturnT (*)(Storage *, ArgTs && ...);
+
+  template<typename CallableT>
+  static constexpr bool fits_inline()
+  {
+    return sizeof(CallableT) <= Capacity && alignof(CallableT) <= alignof(std::max_align_t);
+  }
+
+  // Inline storage: the callable lives inside the union.
+  template<typename CallableT, bool IsInline>
+  struct Handler
+  {
+    static CallableT * get(Storage * storage)
+    {
+      return reinterpret_cast<CallableT *>(storage->inline_storage);
+    }
+
+    template<typename T>
+    static void create(Storage & storage, T && callable)
+    {
+      ::new (static_cast<void *>(storage.inline_storage)) CallableT(std::forward<T>(callable));
+    }
+
+    static ReturnT invoke(Storage * storage, ArgTs && ... args)
+    {
+      return (*get(storage))(std::forward<ArgTs>(args)...);
+    }
+
+    static void manage(StorageOp op, Storage * target, Storage * source)
+    {
+      switch (op) {
+        case StorageOp::Destroy:
+          get(target)->~CallableT();
+          break;
+        case StorageOp::Copy:
+          create(*target, *get(source));
+          break;
+        case StorageOp::Move:
+          create(*target, std::move(*get(source)));
+          get(source)->~CallableT();
+          break;
+      }
+    }
+  };
+
+  // Heap fallback for callables larger than the inline capacity.
+  template<typename CallableT>
+  struct Handler<CallableT, false>
+  {
+    static CallableT * get(Storage * storage)
+    {
+      return static_cast<CallableT *>(storage->heap);
+    }
+
+    template<typename T>
+    static void create(Storage & storage, T && callable)
+    {
+      storage.heap = new CallableT(std::forward<T>(callable));
+    }
+
+    static ReturnT invoke(Storage * storage, ArgTs && ... args)
+    {
+      return (*get(storage))(std::forward<ArgTs>(args)...);
+    }
+
+    static void manage(StorageOp op, Storage * target, Storage * source)
+    {
+      switch (op) {
+        case StorageOp::Destroy:
+          delete get(target);
+          break;
+        case StorageOp::Copy:
+          create(*target, *get(source));
+          break;
+        case StorageOp::Move:
+          target->heap = source->heap;
+          source->heap = nullptr;
+          break;
+      }
+    }
+  };
+
+  void reset() noexcept
+  {
+    if (manage_) {
+      manage_(StorageOp::Destroy, &storage_, nullptr);
+      manage_ = nullptr;
+      invoke_ = nullptr;
+    }
+  }
+
+  Storage storage_;
+  ManageFnT manage_ {nullptr};
+  InvokeFnT invoke_ {nullptr};
+};
+
+/// Map a std::function type to the InplaceFunction with the same signature.
+template<typename StdFunctionT, size_t Capacity = kDefaultInplaceFunctionCapacity>
+struct InplaceFunctionFromStdFunction;
+
+template<typename SignatureT, size_t Capacity>
+struct InplaceFunctionFromStdFunction<std::function<SignatureT>, Capacity>
+{
+  using type = InplaceFunction<SignatureT, Capacity>;
+};
+
+}  // namespace detail
+}  // namespace rclcpp
+
+#endif  // RCLCPP__DETAIL__INPLACE_FUNCTION_HPP_
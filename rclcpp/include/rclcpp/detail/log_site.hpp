@@ -0,0 +1,121 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__DETAIL__LOG_SITE_HPP_
+#define RCLCPP__DETAIL__LOG_SITE_HPP_
+
+#include <atomic>
+#include <cstring>
+
+#include "rcutils/macros.h"
+
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+namespace detail
+{
+
+/// Per-call-site state for the logging macros.
+/**
+ * Each expansion of a RCLCPP_* logging macro holds one static instance of
+ * this struct.  Once registered, a disabled log statement costs an atomic
+ * load, a short name comparison and a branch, instead of the rcutils
+ * logger-name hash and severity lookup on every call.
+ *
+ * \internal
+ */
+struct LogSite
+{
+  /// Whether messages from this site are currently enabled.
+  std::atomic<bool> enabled{false};
+  /// Interned copy of the name the site registered with; nullptr until then.
+  /**
+   * Points into registry-owned storage that is never freed, so it stays
+   * valid after the Logger the site first saw is destroyed.
+   */
+  std::atomic<const char *> logger_name{nullptr};
+  /// Severity of the macro that owns this site, fixed at registration.
+  int severity{0};
+};
+
+/// Registry of all log sites in the process.
+/**
+ * Sites register lazily on the first pass through their macro.  Whenever a
+ * logger severity changes (rclcpp::Logger::set_level and the logger level
+ * services), refresh_all() recomputes every site's gate, so steady-state
+ * logging never consults the rcutils severity hashmap.
+ *
+ * \internal
+ */
+class LogSiteRegistry
+{
+public:
+  /// Register a site and compute its initial gate.
+  /**
+   * \param site the static site object of the macro expansion.
+   * \param logger_name the full name of the logger used at the site.
+   * \param severity the rcutils severity of the macro.
+   * \return true if the site is currently enabled.
+   */
+  RCLCPP_PUBLIC
+  static
+  bool
+  register_site(LogSite * site, const char * logger_name, int severity);
+
+  /// Recompute the gate of every registered site from the current severities.
+  RCLCPP_PUBLIC
+  static
+  void
+  refresh_all();
+};
+
+/// Return whether the logging macro owning the given site should log.
+/**
+ * Fast path: the caller's logger name matches the interned name the site
+ * registered with and the cached gate answers without touching the rcutils
+ * severity hashmap.  The match is by string value, not pointer identity:
+ * severities are keyed by name, and the buffer a destroyed Logger's name
+ * lived in can be reused at the same address by a differently named one,
+ * which a pointer check would silently accept.  Sites reached with other
+ * logger names (e.g. in templates or helper functions), and loggers with no
+ * name, defer to the rcutils severity check inside the logging call itself.
+ *
+ * \internal
+ */
+inline
+bool
+log_site_is_enabled(LogSite & site, const char * logger_name, int severity)
+{
+  const char * registered_name = site.logger_name.load(std::memory_order_acquire);
+  if (RCUTILS_UNLIKELY(nullptr == registered_name)) {
+    if (nullptr == logger_name) {
+      // Unnamed logger, nothing to cache on.
+      return true;
+    }
+    return LogSiteRegistry::register_site(&site, logger_name, severity);
+  }
+  if (RCUTILS_UNLIKELY(nullptr == logger_name ||
+    0 != std::strcmp(registered_name, logger_name)))
+  {
+    // The site sees more than one logger name; its cache cannot be trusted.
+    return true;
+  }
+  return site.enabled.load(std::memory_order_relaxed);
+}
+
+}  // namespace detail
+}  // namespace rclcpp
+
+#endif  // RCLCPP__DETAIL__LOG_SITE_HPP_
@@ -20,8 +20,11 @@
 #include <functional>
 #include <initializer_list>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "rcl_interfaces/msg/parameter_descriptor.hpp"
@@ -104,6 +107,145 @@ declare_parameter_or_get(
   }
 }
 
+/// \internal Process-wide cache of qos profiles already resolved against parameter overrides.
+/**
+ * The qos override parameters are declared read-only, so for a given node,
+ * parameter prefix, requested policy set, and default profile the resolved
+ * profile can never change, and repeated entity creation on the same topic
+ * (bulk bring-up, respawning publishers) can skip the parameter machinery.
+ * Entries are validated against a weak reference to the parameters interface,
+ * so a destroyed node's slot cannot alias a new node at the same address.
+ */
+class QosOverridesCache
+{
+public:
+  static
+  QosOverridesCache &
+  instance()
+  {
+    static QosOverridesCache cache;
+    return cache;
+  }
+
+  /// Retrieve a previously resolved profile, returning true on a hit.
+  bool
+  get(
+    const rclcpp::node_interfaces::NodeParametersInterface::SharedPtr & parameters,
+    const std::string & cache_key,
+    const rclcpp::QoS & default_qos,
+    rclcpp::QoS & resolved_qos)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(std::make_pair(static_cast<const void *>(parameters.get()), cache_key));
+    if (it == entries_.end()) {
+      return false;
+    }
+    auto locked_parameters = it->second.parameters.lock();
+    if (locked_parameters != parameters) {
+      // The node this entry was resolved for is gone.
+      entries_.erase(it);
+      return false;
+    }
+    if (!(it->second.default_qos == default_qos)) {
+      return false;
+    }
+    resolved_qos = it->second.resolved_qos;
+    return true;
+  }
+
+  /// Store a resolved profile for later calls with the same key and default.
+  void
+  put(
+    const rclcpp::node_interfaces::NodeParametersInterface::SharedPtr & parameters,
+    const std::string & cache_key,
+    const rclcpp::QoS & default_qos,
+    const rclcpp::QoS & resolved_qos)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.insert_or_assign(
+      std::make_pair(static_cast<const void *>(parameters.get()), cache_key),
+      Entry{parameters, default_qos, resolved_qos});
+  }
+
+private:
+  struct Entry
+  {
+    std::weak_ptr<rclcpp::node_interfaces::NodeParametersInterface> parameters;
+    rclcpp::QoS default_qos;
+    rclcpp::QoS resolved_qos;
+  };
+
+  std::mutex mutex_;
+  std::map<std::pair<const void *, std::string>, Entry> entries_;
+};
+
+/// \internal Frozen QoS profiles handed to nodes through `NodeOptions::qos_profile_manifest`.
+/**
+ * Entity creation reaches QoS resolution with only a node parameters
+ * interface in hand, so the manifest a node was constructed with is published
+ * here, keyed by that interface.  Entries are validated against a weak
+ * reference, so a destroyed node's slot cannot alias a new node at the same
+ * address.
+ */
+class QosProfileManifestRegistry
+{
+public:
+  static
+  QosProfileManifestRegistry &
+  instance()
+  {
+    static QosProfileManifestRegistry registry;
+    return registry;
+  }
+
+  /// Publish the manifest of a newly constructed node.
+  void
+  set(
+    const rclcpp::node_interfaces::NodeParametersInterface::SharedPtr & parameters,
+    const std::map<std::string, rclcpp::QoS> & manifest)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.insert_or_assign(
+      static_cast<const void *>(parameters.get()), Entry{parameters, manifest});
+  }
+
+  /// Retrieve the frozen profile for the given entity key, returning true on a hit.
+  bool
+  get(
+    const rclcpp::node_interfaces::NodeParametersInterface::SharedPtr & parameters,
+    const std::string & entity_key,
+    rclcpp::QoS & frozen_qos)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(static_cast<const void *>(parameters.get()));
+    if (it == entries_.end()) {
+      return false;
+    }
+    auto locked_parameters = it->second.parameters.lock();
+    if (locked_parameters != parameters) {
+      // The node this manifest belongs to is gone.
+      entries_.erase(it);
+      return false;
+    }
+    auto profile_it = it->second.manifest.find(entity_key);
+    if (profile_it == it->second.manifest.end()) {
+      return false;
+    }
+    frozen_qos = profile_it->second;
+    return true;
+  }
+
+private:
+  struct Entry
+  {
+    std::weak_ptr<rclcpp::node_interfaces::NodeParametersInterface> parameters;
+    std::map<std::string, rclcpp::QoS> manifest;
+  };
+
+  std::mutex mutex_;
+  std::map<const void *, Entry> entries_;
+};
+
 #ifdef DOXYGEN_ONLY
 /// \internal Declare QoS parameters for the given entity.
 /**
@@ -142,17 +284,52 @@ declare_qos_parameters(
   const ::rclcpp::QoS & default_qos,
   EntityQosParametersTraits)
 {
-  auto & parameters_interface = *rclcpp::node_interfaces::get_node_parameters_interface(node);
-  std::string param_prefix;
+  auto parameters_interface_ptr = rclcpp::node_interfaces::get_node_parameters_interface(node);
+  auto & parameters_interface = *parameters_interface_ptr;
+  std::string entity_key;
   const auto & id = options.get_id();
   {
-    std::ostringstream oss{"qos_overrides.", std::ios::ate};
-    oss << topic_name << "." << EntityQosParametersTraits::entity_type();
+    std::ostringstream oss{topic_name, std::ios::ate};
+    oss << "." << EntityQosParametersTraits::entity_type();
     if (!id.empty()) {
       oss << "_" << id;
     }
-    oss << ".";
-    param_prefix = oss.str();
+    entity_key = oss.str();
+  }
+  {
+    // A frozen profile from the node's manifest replaces resolution entirely;
+    // only the entity's validation callback still gets a say.
+    rclcpp::QoS frozen_qos = default_qos;
+    if (QosProfileManifestRegistry::instance().get(
+        parameters_interface_ptr, entity_key, frozen_qos))
+    {
+      const auto & frozen_validation_callback = options.get_validation_callback();
+      if (frozen_validation_callback) {
+        auto result = frozen_validation_callback(frozen_qos);
+        if (!result.successful) {
+          throw rclcpp::exceptions::InvalidQosOverridesException{
+                  "validation callback failed: " + result.reason};
+        }
+      }
+      return frozen_qos;
+    }
+  }
+  std::string param_prefix = "qos_overrides." + entity_key + ".";
+  // The cache key has to cover everything the resolution depends on besides
+  // the default profile: the parameter prefix and the requested policy set.
+  std::string cache_key = param_prefix;
+  for (auto policy : options.get_policy_kinds()) {
+    cache_key += qos_policy_kind_to_cstr(policy);
+    cache_key += '|';
+  }
+  {
+    rclcpp::QoS cached_qos = default_qos;
+    if (QosOverridesCache::instance().get(
+        parameters_interface_ptr, cache_key, default_qos, cached_qos))
+    {
+      // The profile was validated when it was first resolved.
+      return cached_qos;
+    }
   }
   std::string param_description_suffix;
   {
@@ -189,6 +366,7 @@ declare_qos_parameters(
               "validation callback failed: " + result.reason};
     }
   }
+  QosOverridesCache::instance().put(parameters_interface_ptr, cache_key, default_qos, qos);
   return qos;
 }
 
@@ -16,6 +16,8 @@
 #define RCLCPP__DURATION_HPP_
 
 #include <chrono>
+#include <cstdint>
+#include <limits>
 
 #include "builtin_interfaces/msg/duration.hpp"
 #include "rcl/time.h"
@@ -23,6 +25,9 @@
 
 namespace rclcpp
 {
+
+class UncheckedDuration;
+
 class RCLCPP_PUBLIC Duration
 {
 public:
@@ -152,12 +157,163 @@ public:
   rmw_time_t
   to_rmw_time() const;
 
+  /// Get an unchecked arithmetic view of this duration.
+  /** \sa UncheckedDuration */
+  UncheckedDuration
+  unchecked() const noexcept;
+
 private:
   rcl_duration_t rcl_duration_;
 
   Duration() = default;
 };
 
+namespace detail
+{
+
+/// Addition that wraps on overflow instead of being undefined behavior.
+/**
+ * Signed overflow is UB, so the sum is formed in uint64_t, where wrapping is
+ * defined, and converted back, which is two's complement on every supported
+ * platform.
+ */
+constexpr rcl_duration_value_t
+wrapping_nanoseconds_add(rcl_duration_value_t a, rcl_duration_value_t b) noexcept
+{
+  return static_cast<rcl_duration_value_t>(
+    static_cast<uint64_t>(a) + static_cast<uint64_t>(b));
+}
+
+/// Subtraction that wraps on overflow instead of being undefined behavior.
+/** \sa wrapping_nanoseconds_add */
+constexpr rcl_duration_value_t
+wrapping_nanoseconds_subtract(rcl_duration_value_t a, rcl_duration_value_t b) noexcept
+{
+  return static_cast<rcl_duration_value_t>(
+    static_cast<uint64_t>(a) - static_cast<uint64_t>(b));
+}
+
+/// Scale by a double, clamping results outside the representable range.
+/**
+ * Converting an out-of-range double to an integer is UB, and a wrapped
+ * result of a floating-point product would be meaningless anyway, so the
+ * result saturates at the int64_t bounds; NaN maps to zero.
+ */
+constexpr rcl_duration_value_t
+saturating_nanoseconds_scale(rcl_duration_value_t value, double scale) noexcept
+{
+  const double result = static_cast<double>(value) * scale;
+  // max() rounds up to 2^63 as a double, so >= catches everything above the
+  // largest representable value; min() converts to exactly -2^63.
+  if (result >= static_cast<double>(std::numeric_limits<rcl_duration_value_t>::max())) {
+    return std::numeric_limits<rcl_duration_value_t>::max();
+  }
+  if (result < static_cast<double>(std::numeric_limits<rcl_duration_value_t>::min())) {
+    return std::numeric_limits<rcl_duration_value_t>::min();
+  }
+  if (result != result) {
+    return 0;
+  }
+  return static_cast<rcl_duration_value_t>(result);
+}
+
+}  // namespace detail
+
+/// Lightweight nanosecond duration arithmetic without runtime checks.
+/**
+ * Duration's operators check for overflow and throw, which keeps tight
+ * numeric loops from vectorizing. UncheckedDuration keeps Duration's type
+ * safety but every operation is constexpr and noexcept, with no throwing
+ * paths; overflow in addition and subtraction wraps like two's complement
+ * arithmetic, and scaling saturates at the representable range. Obtain one
+ * with Duration::unchecked(), do the bulk arithmetic, and convert back with
+ * checked() at the boundary.
+ */
+class UncheckedDuration
+{
+public:
+  explicit constexpr UncheckedDuration(rcl_duration_value_t nanoseconds) noexcept
+  : nanoseconds_(nanoseconds)
+  {}
+
+  /// Get duration in nanoseconds.
+  constexpr rcl_duration_value_t
+  nanoseconds() const noexcept
+  {
+    return nanoseconds_;
+  }
+
+  /// Convert back to a checked Duration.
+  Duration
+  checked() const
+  {
+    return Duration::from_nanoseconds(nanoseconds_);
+  }
+
+  constexpr bool operator==(UncheckedDuration rhs) const noexcept
+  {
+    return nanoseconds_ == rhs.nanoseconds_;
+  }
+  constexpr bool operator!=(UncheckedDuration rhs) const noexcept
+  {
+    return nanoseconds_ != rhs.nanoseconds_;
+  }
+  constexpr bool operator<(UncheckedDuration rhs) const noexcept
+  {
+    return nanoseconds_ < rhs.nanoseconds_;
+  }
+  constexpr bool operator<=(UncheckedDuration rhs) const noexcept
+  {
+    return nanoseconds_ <= rhs.nanoseconds_;
+  }
+  constexpr bool operator>=(UncheckedDuration rhs) const noexcept
+  {
+    return nanoseconds_ >= rhs.nanoseconds_;
+  }
+  constexpr bool operator>(UncheckedDuration rhs) const noexcept
+  {
+    return nanoseconds_ > rhs.nanoseconds_;
+  }
+
+  constexpr UncheckedDuration operator+(UncheckedDuration rhs) const noexcept
+  {
+    return UncheckedDuration(detail::wrapping_nanoseconds_add(nanoseconds_, rhs.nanoseconds_));
+  }
+  constexpr UncheckedDuration operator-(UncheckedDuration rhs) const noexcept
+  {
+    return UncheckedDuration(detail::wrapping_nanoseconds_subtract(nanoseconds_, rhs.nanoseconds_));
+  }
+  constexpr UncheckedDuration operator*(double scale) const noexcept
+  {
+    return UncheckedDuration(detail::saturating_nanoseconds_scale(nanoseconds_, scale));
+  }
+
+  UncheckedDuration & operator+=(UncheckedDuration rhs) noexcept
+  {
+    nanoseconds_ = detail::wrapping_nanoseconds_add(nanoseconds_, rhs.nanoseconds_);
+    return *this;
+  }
+  UncheckedDuration & operator-=(UncheckedDuration rhs) noexcept
+  {
+    nanoseconds_ = detail::wrapping_nanoseconds_subtract(nanoseconds_, rhs.nanoseconds_);
+    return *this;
+  }
+  UncheckedDuration & operator*=(double scale) noexcept
+  {
+    nanoseconds_ = detail::saturating_nanoseconds_scale(nanoseconds_, scale);
+    return *this;
+  }
+
+private:
+  rcl_duration_value_t nanoseconds_;
+};
+
+inline UncheckedDuration
+Duration::unchecked() const noexcept
+{
+  return UncheckedDuration(rcl_duration_.nanoseconds);
+}
+
 }  // namespace rclcpp
 
 #endif  // RCLCPP__DURATION_HPP_
@@ -0,0 +1,142 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__DYNAMIC_TYPESUPPORT__DYNAMIC_MESSAGE_ACCESS_PLAN_HPP_
+#define RCLCPP__DYNAMIC_TYPESUPPORT__DYNAMIC_MESSAGE_ACCESS_PLAN_HPP_
+
+#include <rosidl_runtime_c/type_description/type_description__struct.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "rclcpp/macros.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+namespace dynamic_typesupport
+{
+
+/// Compiled field access plan for a dynamic typesupport message type.
+/**
+ * Walking a rosidl type description on every field access is far too slow for
+ * consumers that touch dynamic messages at high rates. An access plan walks
+ * the description exactly once and compiles it into a flat table of field
+ * records — dotted names, type ids, and offsets/strides into a canonical
+ * packed layout — so field lookup and iteration become table reads.
+ *
+ * The canonical packed layout places each field at its natural alignment, in
+ * declaration order, with nested message fields flattened inline. Fixed
+ * arrays are laid out inline with a per-element stride; strings, wstrings,
+ * and sequences of any kind occupy a fixed-size reference slot (pointer plus
+ * length) since their payload is externally owned. Fixed arrays, bounded
+ * sequences, and unbounded sequences of nested types are not flattened; their
+ * element type is recorded in FieldAccess::nested_type_name and its plan can
+ * be fetched separately.
+ *
+ * Plans are immutable once built and are cached process-wide keyed by the
+ * RIHS type hash of the description, so every subscription or reader of the
+ * same type shares one plan. The cache keeps plans alive for the lifetime of
+ * the process.
+ */
+class DynamicMessageAccessPlan
+{
+public:
+  RCLCPP_SMART_PTR_ALIASES_ONLY(DynamicMessageAccessPlan)
+
+  /// One entry of the compiled plan: where and how to read a single field.
+  struct FieldAccess
+  {
+    /// Dotted path of the field from the message root, e.g. "pose.position.x".
+    std::string name;
+    /// Field type id, as in rosidl_runtime_c__type_description__FieldType.
+    uint8_t type_id;
+    /// Element type id with the array/sequence offsets removed.
+    uint8_t base_type_id;
+    /// Fixed-array length or bounded capacity; 0 when not applicable.
+    uint64_t capacity;
+    /// Capacity of fixed or bounded strings; 0 when not applicable.
+    uint64_t string_capacity;
+    /// Element type name when base_type_id is a nested type, empty otherwise.
+    std::string nested_type_name;
+    /// Byte offset of the field in the canonical packed layout.
+    size_t offset;
+    /// Total bytes the field occupies in the canonical packed layout.
+    size_t size;
+    /// Byte distance between consecutive elements of a fixed array,
+    /// equal to size for everything else.
+    size_t stride;
+  };
+
+  /// Return the cached plan for the described type, compiling it on first use.
+  /**
+   * \param[in] description a full type description, including the referenced
+   *   type descriptions of every nested field type.
+   * \return the shared, immutable plan for the described type.
+   * \throws std::runtime_error if the type hash can not be computed, if a
+   *   nested field names a type missing from the referenced descriptions, or
+   *   if the description nests deeper than the supported limit.
+   */
+  RCLCPP_PUBLIC
+  static DynamicMessageAccessPlan::SharedPtr
+  get_or_build(const rosidl_runtime_c__type_description__TypeDescription & description);
+
+  /// Return the flattened field table, in canonical layout order.
+  RCLCPP_PUBLIC
+  const std::vector<FieldAccess> &
+  fields() const;
+
+  /// Return the field record for a dotted path, or nullptr if there is none.
+  RCLCPP_PUBLIC
+  const FieldAccess *
+  find_field(const std::string & name) const;
+
+  /// Return the total size in bytes of the canonical packed layout.
+  RCLCPP_PUBLIC
+  size_t
+  packed_size() const;
+
+  /// Return the stringified RIHS hash the plan is cached under.
+  RCLCPP_PUBLIC
+  const std::string &
+  type_hash() const;
+
+  /// Return the fully qualified name of the described type.
+  RCLCPP_PUBLIC
+  const std::string &
+  type_name() const;
+
+private:
+  RCLCPP_DISABLE_COPY(DynamicMessageAccessPlan)
+
+  RCLCPP_PUBLIC
+  DynamicMessageAccessPlan(
+    const rosidl_runtime_c__type_description__TypeDescription & description,
+    std::string type_hash);
+
+  std::string type_name_;
+  std::string type_hash_;
+  std::vector<FieldAccess> fields_;
+  std::unordered_map<std::string, size_t> field_index_;
+  size_t packed_size_ = 0;
+};
+
+}  // namespace dynamic_typesupport
+}  // namespace rclcpp
+
+#endif  // RCLCPP__DYNAMIC_TYPESUPPORT__DYNAMIC_MESSAGE_ACCESS_PLAN_HPP_
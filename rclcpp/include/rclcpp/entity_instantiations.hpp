@@ -0,0 +1,67 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__ENTITY_INSTANTIATIONS_HPP_
+#define RCLCPP__ENTITY_INSTANTIATIONS_HPP_
+
+#include <memory>
+
+#include "rcl_interfaces/msg/parameter_event.hpp"
+#include "rosgraph_msgs/msg/clock.hpp"
+#include "statistics_msgs/msg/metrics_message.hpp"
+
+#include "rclcpp/any_subscription_callback.hpp"
+#include "rclcpp/publisher.hpp"
+#include "rclcpp/subscription.hpp"
+
+/// \file
+/// Opt-in pre-built instantiations of the entity templates for common message types.
+/**
+ * Every translation unit creating a publisher or subscription instantiates
+ * `Publisher<T>`, `Subscription<T>` and `AnySubscriptionCallback<T>` from
+ * scratch, so identical code is duplicated across libraries and lands at
+ * different addresses at runtime.  Including this header declares the
+ * instantiations for the message types rclcpp itself depends on as
+ * `extern template`, so they are compiled once into the
+ * `rclcpp_instantiations` companion library instead.
+ *
+ * Packages wanting the same treatment for their own high-traffic message
+ * types can build a companion library of their own: declare each type with
+ * RCLCPP_DECLARE_ENTITY_INSTANTIATIONS() in a header included by all users,
+ * and define it with RCLCPP_DEFINE_ENTITY_INSTANTIATIONS() in exactly one
+ * translation unit of that library.
+ */
+
+/// Declare that the entity templates for MessageT are compiled elsewhere.
+#define RCLCPP_DECLARE_ENTITY_INSTANTIATIONS(MessageT) \
+  extern template class rclcpp::AnySubscriptionCallback<MessageT>; \
+  extern template class rclcpp::Subscription<MessageT>; \
+  extern template class rclcpp::Publisher<MessageT>;
+
+/// Define the entity templates for MessageT in the current translation unit.
+/**
+ * Use exactly once per message type, in a source file of the library named
+ * by the matching RCLCPP_DECLARE_ENTITY_INSTANTIATIONS() declaration.
+ */
+#define RCLCPP_DEFINE_ENTITY_INSTANTIATIONS(MessageT) \
+  template class rclcpp::AnySubscriptionCallback<MessageT>; \
+  template class rclcpp::Subscription<MessageT>; \
+  template class rclcpp::Publisher<MessageT>;
+
+// Message types used by rclcpp itself; compiled into rclcpp_instantiations
+RCLCPP_DECLARE_ENTITY_INSTANTIATIONS(rcl_interfaces::msg::ParameterEvent)
+RCLCPP_DECLARE_ENTITY_INSTANTIATIONS(rosgraph_msgs::msg::Clock)
+RCLCPP_DECLARE_ENTITY_INSTANTIATIONS(statistics_msgs::msg::MetricsMessage)
+
+#endif  // RCLCPP__ENTITY_INSTANTIATIONS_HPP_
@@ -30,6 +30,7 @@
 #include "rcutils/logging_macros.h"
 
 #include "rclcpp/detail/cpp_callback_trampoline.hpp"
+#include "rclcpp/detail/inplace_function.hpp"
 #include "rclcpp/exceptions.hpp"
 #include "rclcpp/function_traits.hpp"
 #include "rclcpp/logging.hpp"
@@ -227,7 +228,9 @@ protected:
   set_on_new_event_callback(rcl_event_callback_t callback, const void * user_data);
 
   std::recursive_mutex callback_mutex_;
-  std::function<void(size_t)> on_new_event_callback_{nullptr};
+  // Small-buffer-optimized so installing the listener callback does not
+  // allocate and dispatch skips the std::function indirection.
+  rclcpp::detail::InplaceFunction<void(size_t)> on_new_event_callback_{nullptr};
 
   rcl_event_t event_handle_;
   size_t wait_set_event_index_;
@@ -261,18 +264,31 @@ public:
   }
 
   /// Take data so that the callback cannot be scheduled again
+  /**
+   * One take drains everything pending: the rcl event status aggregates all
+   * occurrences since the previous take (e.g. `total_count_change` covers a
+   * whole burst of missed deadlines), so a storm costs one activation.
+   */
   std::shared_ptr<void>
   take_data() override
   {
-    EventCallbackInfoT callback_info;
-    rcl_ret_t ret = rcl_take_event(&event_handle_, &callback_info);
+    // Reuse the previously returned storage once the executor has dropped it;
+    // a fresh block is only allocated while an earlier event is still in
+    // flight (e.g. handed to another worker thread), so steady-state event
+    // dispatch does not allocate.
+    std::shared_ptr<EventCallbackInfoT> event_info = recycled_event_;
+    if (!event_info || event_info.use_count() > 2) {
+      event_info = std::make_shared<EventCallbackInfoT>();
+      recycled_event_ = event_info;
+    }
+    rcl_ret_t ret = rcl_take_event(&event_handle_, event_info.get());
     if (ret != RCL_RET_OK) {
       RCUTILS_LOG_ERROR_NAMED(
         "rclcpp",
         "Couldn't take event info: %s", rcl_get_error_string().str);
       return nullptr;
     }
-    return std::static_pointer_cast<void>(std::make_shared<EventCallbackInfoT>(callback_info));
+    return std::static_pointer_cast<void>(event_info);
   }
 
   std::shared_ptr<void>
@@ -300,6 +316,7 @@ private:
 
   ParentHandleT parent_handle_;
   EventCallbackT event_callback_;
+  std::shared_ptr<EventCallbackInfoT> recycled_event_;
 };
 
 template<typename EventCallbackT, typename ParentHandleT>
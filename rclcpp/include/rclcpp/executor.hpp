@@ -18,13 +18,16 @@
 #include <algorithm>
 #include <cassert>
 #include <chrono>
+#include <condition_variable>
 #include <cstdlib>
+#include <functional>
 #include <iostream>
 #include <list>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "rcl/guard_condition.h"
@@ -33,6 +36,7 @@
 
 #include "rclcpp/context.hpp"
 #include "rclcpp/contexts/default_context.hpp"
+#include "rclcpp/detail/inplace_function.hpp"
 #include "rclcpp/guard_condition.hpp"
 #include "rclcpp/executor_options.hpp"
 #include "rclcpp/future_return_code.hpp"
@@ -297,6 +301,25 @@ public:
   virtual void
   spin_some(std::chrono::nanoseconds max_duration = std::chrono::nanoseconds(0));
 
+  /// Execute a bounded, fair slice of available work.
+  /**
+   * Budgeted variant of spin_some() intended for callers that embed the executor in a
+   * periodic loop (e.g. a render frame) and need deterministic slice cost.
+   * At most `max_callbacks` callbacks are executed and the wall-clock budget is enforced
+   * as in spin_some().
+   * Entity categories (timers, subscriptions, services, clients, waitables) are served
+   * round-robin, and the rotation cursor persists across calls, so leftover work resumes
+   * next slice where the previous one stopped instead of re-starting at the timers.
+   *
+   * \param[in] max_duration The maximum amount of time to spend executing work, or 0 for no
+   *   wall-clock limit.
+   * \param[in] max_callbacks The maximum number of callbacks to execute, must be > 0.
+   * \throw std::invalid_argument if max_duration is less than 0 or max_callbacks is 0.
+   */
+  RCLCPP_PUBLIC
+  void
+  spin_some(std::chrono::nanoseconds max_duration, size_t max_callbacks);
+
   /// Collect and execute work repeatedly within a duration or until no more work is available.
   /**
    * This function can be overridden. The default implementation is suitable for a
@@ -349,49 +372,91 @@ public:
     // TODO(wjwwood): does not work recursively; can't call spin_node_until_future_complete
     // inside a callback executed by an executor.
 
-    // Check the future before entering the while loop.
+    // Check the future before entering the wait loop.
     // If the future is already complete, don't try to spin.
     std::future_status status = future.wait_for(std::chrono::seconds(0));
     if (status == std::future_status::ready) {
       return FutureReturnCode::SUCCESS;
     }
 
-    auto end_time = std::chrono::steady_clock::now();
-    std::chrono::nanoseconds timeout_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
-      timeout);
-    if (timeout_ns > std::chrono::nanoseconds::zero()) {
-      end_time += timeout_ns;
-    }
-    std::chrono::nanoseconds timeout_left = timeout_ns;
+    // The wait loop itself is non-templated and the base spin-once path reuses a persistent
+    // executable record, so repeated calls do not allocate; the readiness probe is stored
+    // inline.
+    return spin_until_ready_impl(
+      [&future]() {
+        return std::future_status::ready == future.wait_for(std::chrono::seconds(0));
+      },
+      std::chrono::duration_cast<std::chrono::nanoseconds>(timeout));
+  }
 
-    if (spinning.exchange(true)) {
-      throw std::runtime_error("spin_until_future_complete() called while already spinning");
+  /// Spin (blocking) until every future in the range is complete, or a timeout/interruption.
+  /**
+   * Waits on all futures through one spin loop and one readiness probe rather
+   * than one spin_until_future_complete() call per future, so the wait-set is
+   * set up once for the whole gather.
+   *
+   * \param[in] futures An iterable range of futures. If this function returns SUCCESS, every
+   *   future in the range can be accessed without blocking (though each may still throw).
+   * \param[in] timeout Optional overall timeout for the whole range.
+   *   `-1` is block forever, `0` is non-blocking.
+   * \return The return code, one of `SUCCESS`, `INTERRUPTED`, or `TIMEOUT`.
+   */
+  template<typename FutureContainerT, typename TimeRepT = int64_t, typename TimeT = std::milli>
+  FutureReturnCode
+  spin_until_all_complete(
+    const FutureContainerT & futures,
+    std::chrono::duration<TimeRepT, TimeT> timeout = std::chrono::duration<TimeRepT, TimeT>(-1))
+  {
+    auto all_ready = [&futures]() {
+        for (const auto & future : futures) {
+          if (std::future_status::ready != future.wait_for(std::chrono::seconds(0))) {
+            return false;
+          }
+        }
+        return true;
+      };
+
+    // Check before entering the wait loop, every future may already be complete.
+    if (all_ready()) {
+      return FutureReturnCode::SUCCESS;
     }
-    RCPPUTILS_SCOPE_EXIT(this->spinning.store(false); );
-    while (rclcpp::ok(this->context_) && spinning.load()) {
-      // Do one item of work.
-      spin_once_impl(timeout_left);
-
-      // Check if the future is set, return SUCCESS if it is.
-      status = future.wait_for(std::chrono::seconds(0));
-      if (status == std::future_status::ready) {
-        return FutureReturnCode::SUCCESS;
-      }
-      // If the original timeout is < 0, then this is blocking, never TIMEOUT.
-      if (timeout_ns < std::chrono::nanoseconds::zero()) {
-        continue;
-      }
-      // Otherwise check if we still have time to wait, return TIMEOUT if not.
-      auto now = std::chrono::steady_clock::now();
-      if (now >= end_time) {
-        return FutureReturnCode::TIMEOUT;
-      }
-      // Subtract the elapsed time from the original timeout.
-      timeout_left = std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - now);
+
+    return spin_until_ready_impl(
+      all_ready, std::chrono::duration_cast<std::chrono::nanoseconds>(timeout));
+  }
+
+  /// Spin (blocking) until at least one future in the range is complete.
+  /**
+   * The counterpart of spin_until_all_complete() for races: returns as soon
+   * as any future in the range is ready. On SUCCESS the caller has to check
+   * the individual futures to see which completed; more than one may have.
+   *
+   * \param[in] futures An iterable range of futures.
+   * \param[in] timeout Optional timeout parameter.
+   *   `-1` is block forever, `0` is non-blocking.
+   * \return The return code, one of `SUCCESS`, `INTERRUPTED`, or `TIMEOUT`.
+   */
+  template<typename FutureContainerT, typename TimeRepT = int64_t, typename TimeT = std::milli>
+  FutureReturnCode
+  spin_until_any_complete(
+    const FutureContainerT & futures,
+    std::chrono::duration<TimeRepT, TimeT> timeout = std::chrono::duration<TimeRepT, TimeT>(-1))
+  {
+    auto any_ready = [&futures]() {
+        for (const auto & future : futures) {
+          if (std::future_status::ready == future.wait_for(std::chrono::seconds(0))) {
+            return true;
+          }
+        }
+        return false;
+      };
+
+    if (any_ready()) {
+      return FutureReturnCode::SUCCESS;
     }
 
-    // The future did not complete before ok() returned false, return INTERRUPTED.
-    return FutureReturnCode::INTERRUPTED;
+    return spin_until_ready_impl(
+      any_ready, std::chrono::duration_cast<std::chrono::nanoseconds>(timeout));
   }
 
   /// Cancel any running spin* function, causing it to return.
@@ -414,6 +479,57 @@ public:
   void
   set_memory_strategy(memory_strategy::MemoryStrategy::SharedPtr memory_strategy);
 
+  /// Register housekeeping work to run only while the executor is idle.
+  /**
+   * The callback is invoked from the spin thread, but only when
+   * get_next_ready_executable found nothing to do, in the time the executor
+   * would otherwise spend blocked in the wait set.  It is called repeatedly
+   * within a slice bounded by the given budget, doing one small unit of
+   * housekeeping per call; after each slice the executor polls for real
+   * work before granting another one, so ready callbacks are never delayed
+   * by more than one budget.  Once every registered callback reports
+   * nothing to do, the executor blocks in the wait set as usual.
+   *
+   * This replaces the pattern of running cache maintenance or deferred
+   * cleanup on periodic timers, which fire regardless of load and steal
+   * cycles exactly when the executor is busiest.
+   *
+   * Multiple registrations are served round-robin, one slice each.
+   * There is no way to unregister; callbacks live as long as the executor.
+   *
+   * \param[in] callback Performs a small unit of housekeeping per call and
+   *   returns true if it did something, false if there was nothing to do.
+   * \param[in] budget Maximum duration of one idle slice for this callback.
+   * \throws std::invalid_argument if callback is nullptr or budget is not
+   *   positive.
+   */
+  RCLCPP_PUBLIC
+  void
+  add_idle_work(std::function<bool()> callback, std::chrono::nanoseconds budget);
+
+  /// Arm a watchdog that flags callback dispatches exceeding a deadline.
+  /**
+   * A single shared watchdog thread observes every dispatch made by
+   * execute_any_executable.  When a callback is still running once the
+   * deadline has elapsed, the watchdog records the offending entity and
+   * how long the dispatch had been running into the process-wide stall
+   * ring, see rclcpp::introspection::stall_events().  The callback itself
+   * is not interrupted, and each dispatch is flagged at most once.
+   *
+   * This catches the hung or slow callback that silently stalls a
+   * mutually exclusive group, which otherwise only shows up as timeouts
+   * further downstream.  Arming a dispatch costs one uncontended mutex
+   * acquisition; while the watchdog is disabled the overhead is a single
+   * relaxed atomic load per dispatch.
+   *
+   * \param[in] deadline Dispatches running longer than this are flagged;
+   *   zero disables the watchdog and stops its thread.
+   * \throws std::invalid_argument if deadline is negative.
+   */
+  RCLCPP_PUBLIC
+  void
+  set_callback_deadline(std::chrono::nanoseconds deadline);
+
   /// Returns true if the executor is currently spinning.
   /**
    * This function can be called asynchronously from any thread.
@@ -446,10 +562,35 @@ protected:
    * \param[in] max_duration The maximum amount of time to spend executing work, or 0 for no limit.
    * \param[in] exhaustive when set to true, continue to collect work and execute (spin_all)
    *                       when set to false, return when all collected work is executed (spin_some)
+   * \param[in] max_callbacks when greater than 0, execute at most this many callbacks and
+   *                          rotate entity categories round-robin between them
    */
   RCLCPP_PUBLIC
   void
-  spin_some_impl(std::chrono::nanoseconds max_duration, bool exhaustive);
+  spin_some_impl(
+    std::chrono::nanoseconds max_duration, bool exhaustive, size_t max_callbacks = 0);
+
+  /// Execute work until the given readiness probe reports true, a timeout, or interruption.
+  /**
+   * Implementation of spin_until_future_complete.
+   * This is deliberately non-templated: the templated entry point wraps the future in an
+   * inline-stored readiness probe so that one copy of the wait loop serves every future type,
+   * and the base spin-once path reuses a persistent executor-owned executable record rather
+   * than a per-call local.  Callers that wait on futures at high rates therefore do not pay
+   * per-call allocation or template bloat.
+   * Work is executed through the virtual spin_once_impl, so subclasses keep their own
+   * dispatch path while waiting.
+   *
+   * \param[in] future_ready probe returning true once the awaited future is complete.
+   * \param[in] timeout maximum time to wait; negative blocks indefinitely, zero is non-blocking.
+   * \return The return code, one of `SUCCESS`, `INTERRUPTED`, or `TIMEOUT`.
+   * \throws std::runtime_error if called while the executor is already spinning
+   */
+  RCLCPP_PUBLIC
+  FutureReturnCode
+  spin_until_ready_impl(
+    const rclcpp::detail::InplaceFunction<bool()> & future_ready,
+    std::chrono::nanoseconds timeout);
 
   /// Find the next available executable and do the work associated with it.
   /**
@@ -619,6 +760,19 @@ protected:
     AnyExecutable & any_executable,
     std::chrono::nanoseconds timeout = std::chrono::nanoseconds(-1));
 
+  /// Grant one idle-work slice, see add_idle_work.
+  /**
+   * Picks the next registered idle callback round-robin and runs it within
+   * its budget.  Callbacks which report no pending work are skipped; at most
+   * one full rotation is attempted per call.
+   *
+   * \return true if any idle work was executed, false if no registered
+   *   callback had pending work.
+   */
+  RCLCPP_PUBLIC
+  bool
+  run_idle_work();
+
   /// Add all callback groups that can be automatically added from associated nodes.
   /**
    * The executor, before collecting entities, verifies if any callback group from
@@ -634,9 +788,22 @@ protected:
   virtual void
   add_callback_groups_from_nodes_associated_to_executor() RCPPUTILS_TSA_REQUIRES(mutex_);
 
+  /// Trigger the interrupt guard condition, coalescing redundant triggers.
+  /**
+   * Any number of triggers between two waits cause exactly one wakeup: the
+   * pending flag is cleared right before the wait set blocks, so the first
+   * trigger of a cycle reaches the rmw layer and the rest are absorbed.
+   */
+  RCLCPP_PUBLIC
+  void
+  trigger_interrupt_guard_condition();
+
   /// Spinning state, used to prevent multi threaded calls to spin and to cancel blocking spins.
   std::atomic_bool spinning;
 
+  /// Whether the interrupt guard condition holds a trigger not yet consumed by a wait.
+  std::atomic_bool interrupt_pending_ {false};
+
   /// Guard condition for signaling the rmw layer to wake up for special events.
   std::shared_ptr<rclcpp::GuardCondition> interrupt_guard_condition_;
 
@@ -646,6 +813,26 @@ protected:
   /// Wait set for managing entities that the rmw layer waits on.
   rcl_wait_set_t wait_set_ = rcl_get_zero_initialized_wait_set();
 
+  /// Persistent record reused by the base spin_once path across calls.
+  /**
+   * Only touched while `spinning` is held, so no further locking is needed.
+   */
+  AnyExecutable spin_once_executable_;
+
+  /// Number of entity categories probed by get_next_ready_executable_from_map.
+  static constexpr size_t ready_category_count = 5;
+
+  /// Category to probe first in get_next_ready_executable_from_map.
+  /**
+   * Stays 0 (timers first) for the classic spin paths; budgeted spin_some slices rotate it
+   * so one ready-heavy category cannot monopolize a slice.  Only mutated while `spinning`
+   * is held.
+   */
+  size_t ready_dispatch_offset_ {0};
+
+  /// Rotation cursor persisted between budgeted spin_some slices, see spin_some_impl.
+  size_t spin_some_category_cursor_ {0};
+
   // Mutex to protect the subsequent memory_strategy_.
   mutable std::mutex mutex_;
 
@@ -653,6 +840,65 @@ protected:
   memory_strategy::MemoryStrategy::SharedPtr
   memory_strategy_ RCPPUTILS_TSA_PT_GUARDED_BY(mutex_);
 
+  /// One registered piece of idle housekeeping, see add_idle_work.
+  struct IdleWork
+  {
+    std::function<bool()> callback;
+    std::chrono::nanoseconds budget;
+  };
+
+  /// Registered idle work, served round-robin by run_idle_work.
+  std::vector<IdleWork> idle_work_ RCPPUTILS_TSA_GUARDED_BY(mutex_);
+
+  /// Index of the idle work entry to be granted the next slice.
+  size_t idle_work_cursor_ RCPPUTILS_TSA_GUARDED_BY(mutex_) {0};
+
+  /// State shared between the dispatching threads and the watchdog thread.
+  /**
+   * See set_callback_deadline.  The generation counter is odd while a
+   * dispatch is armed and even otherwise, so the watchdog can tell whether
+   * the dispatch it slept on is still the one running.
+   */
+  struct WatchdogState
+  {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::chrono::nanoseconds deadline {0};
+    bool shutdown {false};
+    uint64_t generation {0};
+    std::chrono::steady_clock::time_point dispatch_start;
+    std::string description;
+  };
+
+  /// Watchdog state, see set_callback_deadline.
+  WatchdogState watchdog_;
+
+  /// The shared watchdog thread; joined on disable and destruction.
+  std::thread watchdog_thread_;
+
+  /// Checked with one relaxed load per dispatch before touching watchdog_.
+  std::atomic<bool> watchdog_enabled_ {false};
+
+  /// Publish the armed dispatch to the watchdog thread.
+  RCLCPP_PUBLIC
+  void
+  watchdog_arm(const AnyExecutable & any_exec);
+
+  /// Mark the armed dispatch as finished.
+  RCLCPP_PUBLIC
+  void
+  watchdog_disarm();
+
+  /// Body of the watchdog thread, see set_callback_deadline.
+  RCLCPP_PUBLIC
+  void
+  watchdog_run();
+
+  /// Stop and join the watchdog thread if it is running.
+  RCLCPP_PUBLIC
+  void
+  watchdog_stop();
+
   /// The context associated with this executor.
   std::shared_ptr<rclcpp::Context> context_;
 
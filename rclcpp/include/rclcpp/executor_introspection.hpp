@@ -0,0 +1,151 @@
+// Copyright 2024 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__EXECUTOR_INTROSPECTION_HPP_
+#define RCLCPP__EXECUTOR_INTROSPECTION_HPP_
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+
+/// Lightweight latency instrumentation for the executors.
+/**
+ * When enabled, the executors record two quantities for every dispatched
+ * executable into per-thread, lock-free histograms:
+ *
+ * - wakeup-to-dispatch: the time between the executor waking up with ready
+ *   work (wait set returning, or an event being popped from the events queue)
+ *   and the moment a given executable starts executing. When multiple
+ *   executables are dispatched after a single wakeup, each one is measured
+ *   from the same wakeup, so the histogram captures the queueing delay
+ *   experienced by the later ones.
+ * - dispatch duration: the time spent executing the executable, i.e. the
+ *   user callback plus the take/dispatch overhead around it.
+ *
+ * The histograms use logarithmic buckets (four sub-buckets per power of two
+ * nanoseconds, i.e. at most 25% relative error), so recording is a couple of
+ * relaxed atomic increments and snapshots are cheap enough to poll from a
+ * monitoring thread in production.
+ *
+ * Instrumentation is disabled by default and the only cost in that state is
+ * one atomic flag load per dispatched executable.
+ */
+namespace executor_introspection
+{
+
+/// Number of buckets in each latency histogram.
+static constexpr size_t kHistogramBuckets = 252;
+
+/// A consistent-enough copy of one of the latency histograms.
+/**
+ * Snapshots aggregate the per-thread histograms of all executor threads that
+ * ever recorded a sample, including threads that have since terminated.
+ */
+struct HistogramSnapshot
+{
+  /// Total number of recorded samples.
+  uint64_t count;
+  /// Sum of all recorded values, in nanoseconds.
+  uint64_t sum_ns;
+  /// Largest recorded value, in nanoseconds.
+  uint64_t max_ns;
+  /// Sample counts, indexed by bucket. See `bucket_lower_bound()`.
+  std::array<uint64_t, kHistogramBuckets> buckets;
+
+  /// Estimate the given quantile (e.g. 0.99) from the bucket counts.
+  /**
+   * \param[in] q the quantile to estimate, in the [0.0, 1.0] range.
+   * \return lower bound of the bucket holding the quantile, or zero if the
+   * histogram is empty.
+   */
+  RCLCPP_PUBLIC
+  std::chrono::nanoseconds
+  quantile(double q) const;
+};
+
+/// Enable recording of executor latency samples.
+RCLCPP_PUBLIC
+void
+enable();
+
+/// Disable recording of executor latency samples.
+RCLCPP_PUBLIC
+void
+disable();
+
+/// Return whether recording is currently enabled.
+RCLCPP_PUBLIC
+bool
+enabled();
+
+/// Get a snapshot of the wakeup-to-dispatch latency histogram.
+RCLCPP_PUBLIC
+HistogramSnapshot
+get_wakeup_to_dispatch_histogram();
+
+/// Get a snapshot of the dispatch duration histogram.
+RCLCPP_PUBLIC
+HistogramSnapshot
+get_dispatch_duration_histogram();
+
+/// Reset all histograms to empty.
+/**
+ * Samples being recorded concurrently with the reset may be lost, which is
+ * acceptable for a monitoring facility.
+ */
+RCLCPP_PUBLIC
+void
+reset();
+
+/// Get the bucket index a value in nanoseconds is recorded into.
+RCLCPP_PUBLIC
+size_t
+bucket_index(uint64_t value_ns);
+
+/// Get the smallest value in nanoseconds mapping to the given bucket.
+RCLCPP_PUBLIC
+uint64_t
+bucket_lower_bound(size_t index);
+
+/// Record that the calling executor thread woke up with ready work.
+/**
+ * Called by the executors when their wait primitive returns; subsequent
+ * `record_dispatch()` calls from the same thread measure their
+ * wakeup-to-dispatch latency from this point.
+ */
+RCLCPP_PUBLIC
+void
+mark_wakeup();
+
+/// Record the dispatch of one executable by the calling executor thread.
+/**
+ * \param[in] dispatch_start when the executable started executing.
+ * \param[in] dispatch_end when the executable finished executing.
+ */
+RCLCPP_PUBLIC
+void
+record_dispatch(
+  std::chrono::steady_clock::time_point dispatch_start,
+  std::chrono::steady_clock::time_point dispatch_end);
+
+}  // namespace executor_introspection
+}  // namespace rclcpp
+
+#endif  // RCLCPP__EXECUTOR_INTROSPECTION_HPP_
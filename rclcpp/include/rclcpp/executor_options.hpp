@@ -15,11 +15,15 @@
 #ifndef RCLCPP__EXECUTOR_OPTIONS_HPP_
 #define RCLCPP__EXECUTOR_OPTIONS_HPP_
 
+#include <optional>
+
 #include "rclcpp/context.hpp"
 #include "rclcpp/contexts/default_context.hpp"
 #include "rclcpp/memory_strategies.hpp"
 #include "rclcpp/memory_strategy.hpp"
+#include "rclcpp/thread_attributes.hpp"
 #include "rclcpp/visibility_control.hpp"
+#include "rclcpp/wait_strategy.hpp"
 
 namespace rclcpp
 {
@@ -36,6 +40,23 @@ struct ExecutorOptions
   rclcpp::memory_strategy::MemoryStrategy::SharedPtr memory_strategy;
   rclcpp::Context::SharedPtr context;
   size_t max_conditions;
+
+  /// Attributes applied to the threads spawned by the executor, if any.
+  /**
+   * When set, multi-threaded executors apply these to every worker thread
+   * they spawn and the EventsExecutor applies them to the timers thread.
+   * Single-threaded executors ignore this field: they run in the caller's
+   * thread, whose attributes belong to the caller.
+   */
+  std::optional<rclcpp::ThreadAttributes> thread_attributes;
+
+  /// How worker threads wait for the next unit of work.
+  /**
+   * The default parks immediately, matching the historical behavior.
+   * Honored by MultiThreadedExecutor; queue-based executors configure
+   * waiting on their events queue instead (see SimpleEventsQueue).
+   */
+  rclcpp::WaitStrategy wait_strategy;
 };
 
 }  // namespace rclcpp
@@ -0,0 +1,212 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__EXECUTOR_SCHEDULE_HPP_
+#define RCLCPP__EXECUTOR_SCHEDULE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "rclcpp/macros.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+
+/// Recording and deterministic replay of executor dispatch schedules.
+/**
+ * Tail-latency incidents are hard to reproduce because the callback
+ * interleaving differs from run to run. When recording is started, the
+ * wait-set based executors append one fixed-size record per dispatched
+ * executable — entity id, kind, the wakeup that made it ready, and dispatch
+ * start/end — into a bounded in-memory ring that overwrites its oldest
+ * entries, so the last seconds leading up to an incident are always
+ * retained at a fixed memory cost.
+ *
+ * A drained schedule can be written to and read back from a stream in a
+ * compact binary form, and re-executed offline with ScheduleReplayer: stub
+ * callbacks stand in for the recorded entities and are invoked in exactly
+ * the recorded order, optionally paced to the recorded start times, so an
+ * ordering-dependent latency spike can be reproduced and profiled outside
+ * the robot.
+ *
+ * Recording is off by default; when off the only cost is one atomic flag
+ * load per dispatched executable. While on, each dispatch additionally
+ * takes a short lock to append one record, which is acceptable for a
+ * diagnosis session but not meant as always-on telemetry.
+ */
+namespace executor_schedule
+{
+
+/// The kind of executable a dispatch record refers to.
+enum class ExecutableKind : uint8_t
+{
+  Timer = 0,
+  Subscription = 1,
+  Service = 2,
+  Client = 3,
+  Waitable = 4,
+};
+
+/// One dispatched executable, as recorded by the executor.
+struct DispatchRecord
+{
+  /// Identifies the entity: the address of its rcl handle (or of the
+  /// waitable itself), matching the executor tracepoints.
+  uint64_t entity_id;
+  /// The kind of the dispatched executable.
+  ExecutableKind kind;
+  /// When the executor woke up with this work ready, steady clock nanoseconds.
+  int64_t ready_time_ns;
+  /// When the executable started executing, steady clock nanoseconds.
+  int64_t start_time_ns;
+  /// When the executable finished executing, steady clock nanoseconds.
+  int64_t end_time_ns;
+};
+
+/// Start recording dispatches into a ring of the given capacity.
+/**
+ * A ring already being recorded into is discarded and replaced.
+ *
+ * \param[in] capacity number of records retained; once full, the oldest
+ *   records are overwritten.
+ * \throws std::invalid_argument if capacity is zero.
+ */
+RCLCPP_PUBLIC
+void
+start_recording(size_t capacity);
+
+/// Stop recording; the recorded schedule stays available to drain().
+RCLCPP_PUBLIC
+void
+stop_recording();
+
+/// Return whether dispatches are currently being recorded.
+RCLCPP_PUBLIC
+bool
+recording();
+
+/// Take the recorded schedule, oldest dispatch first, leaving the ring empty.
+RCLCPP_PUBLIC
+std::vector<DispatchRecord>
+drain();
+
+/// Record that the calling executor thread woke up with ready work.
+/**
+ * Called by the executors when their wait primitive returns; subsequent
+ * record_dispatch() calls from the same thread use this as the ready time.
+ */
+RCLCPP_PUBLIC
+void
+mark_wakeup();
+
+/// Append one dispatch to the ring, called by the executors.
+/**
+ * \param[in] entity_id see DispatchRecord::entity_id.
+ * \param[in] kind the kind of the dispatched executable.
+ * \param[in] start_time_ns when the executable started executing.
+ * \param[in] end_time_ns when the executable finished executing.
+ */
+RCLCPP_PUBLIC
+void
+record_dispatch(
+  uint64_t entity_id,
+  ExecutableKind kind,
+  int64_t start_time_ns,
+  int64_t end_time_ns);
+
+/// Write a schedule to a stream in compact binary form.
+/**
+ * The format is a small header (magic, version, record count) followed by
+ * the raw fixed-size records; it is not portable across architectures with
+ * different endianness, which is acceptable for shipping recordings from
+ * robots to identical development machines.
+ */
+RCLCPP_PUBLIC
+void
+write_schedule(std::ostream & out, const std::vector<DispatchRecord> & records);
+
+/// Read back a schedule written by write_schedule().
+/**
+ * \throws std::runtime_error if the stream does not hold a valid schedule.
+ */
+RCLCPP_PUBLIC
+std::vector<DispatchRecord>
+read_schedule(std::istream & in);
+
+/// Re-execute a recorded schedule against stub entities.
+/**
+ * Stubs registered per entity id are invoked in exactly the recorded
+ * dispatch order; a fallback stub receives every dispatch without a
+ * per-entity stub. This deliberately replays the schedule single-threaded:
+ * the recorded order is the total dispatch order to reproduce, and the
+ * profiling interest lies in what each callback does when executed in that
+ * order, not in re-creating the original thread assignment.
+ */
+class ScheduleReplayer
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS_NOT_COPYABLE(ScheduleReplayer)
+
+  /// Construct the replayer over a drained or read-back schedule.
+  RCLCPP_PUBLIC
+  explicit ScheduleReplayer(std::vector<DispatchRecord> records);
+
+  /// Register the stub invoked for dispatches of one entity.
+  /**
+   * \param[in] entity_id the recorded entity id the stub stands in for.
+   * \param[in] stub invoked once per recorded dispatch of that entity.
+   */
+  RCLCPP_PUBLIC
+  void
+  set_stub(uint64_t entity_id, std::function<void(const DispatchRecord &)> stub);
+
+  /// Register the stub invoked for dispatches without a per-entity stub.
+  RCLCPP_PUBLIC
+  void
+  set_fallback_stub(std::function<void(const DispatchRecord &)> stub);
+
+  /// Re-execute the schedule in recorded order.
+  /**
+   * \param[in] pace when true, sleep before each dispatch so the gaps
+   *   between dispatch start times match the recording; when false the
+   *   schedule is replayed back-to-back.
+   * \return the number of dispatches for which a stub was invoked.
+   */
+  RCLCPP_PUBLIC
+  size_t
+  replay(bool pace = false) const;
+
+  /// Return the schedule being replayed.
+  RCLCPP_PUBLIC
+  const std::vector<DispatchRecord> &
+  get_records() const;
+
+private:
+  RCLCPP_DISABLE_COPY(ScheduleReplayer)
+
+  std::vector<DispatchRecord> records_;
+  std::unordered_map<uint64_t, std::function<void(const DispatchRecord &)>> stubs_;
+  std::function<void(const DispatchRecord &)> fallback_stub_;
+};
+
+}  // namespace executor_schedule
+}  // namespace rclcpp
+
+#endif  // RCLCPP__EXECUTOR_SCHEDULE_HPP_
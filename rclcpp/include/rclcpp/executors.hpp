@@ -18,9 +18,13 @@
 #include <future>
 #include <memory>
 
+#include "rclcpp/executors/edf_executor.hpp"
 #include "rclcpp/executors/multi_threaded_executor.hpp"
+#include "rclcpp/executors/multiplexed_executor.hpp"
+#include "rclcpp/executors/sealed_executor.hpp"
 #include "rclcpp/executors/single_threaded_executor.hpp"
 #include "rclcpp/executors/static_single_threaded_executor.hpp"
+#include "rclcpp/executors/work_stealing_executor.hpp"
 #include "rclcpp/experimental/executors/events_executor/events_executor.hpp"
 #include "rclcpp/node.hpp"
 #include "rclcpp/utilities.hpp"
@@ -123,6 +127,60 @@ spin_until_future_complete(
   return rclcpp::spin_until_future_complete(node_ptr->get_node_base_interface(), future, timeout);
 }
 
+/// Spin a default executor until every future in the range is complete.
+/** See Executor::spin_until_all_complete(). */
+template<typename FutureContainerT, typename TimeRepT = int64_t, typename TimeT = std::milli>
+rclcpp::FutureReturnCode
+spin_until_all_complete(
+  rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_ptr,
+  const FutureContainerT & futures,
+  std::chrono::duration<TimeRepT, TimeT> timeout = std::chrono::duration<TimeRepT, TimeT>(-1))
+{
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(node_ptr);
+  auto retcode = executor.spin_until_all_complete(futures, timeout);
+  executor.remove_node(node_ptr);
+  return retcode;
+}
+
+template<typename NodeT = rclcpp::Node, typename FutureContainerT, typename TimeRepT = int64_t,
+  typename TimeT = std::milli>
+rclcpp::FutureReturnCode
+spin_until_all_complete(
+  std::shared_ptr<NodeT> node_ptr,
+  const FutureContainerT & futures,
+  std::chrono::duration<TimeRepT, TimeT> timeout = std::chrono::duration<TimeRepT, TimeT>(-1))
+{
+  return rclcpp::spin_until_all_complete(node_ptr->get_node_base_interface(), futures, timeout);
+}
+
+/// Spin a default executor until at least one future in the range is complete.
+/** See Executor::spin_until_any_complete(). */
+template<typename FutureContainerT, typename TimeRepT = int64_t, typename TimeT = std::milli>
+rclcpp::FutureReturnCode
+spin_until_any_complete(
+  rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_ptr,
+  const FutureContainerT & futures,
+  std::chrono::duration<TimeRepT, TimeT> timeout = std::chrono::duration<TimeRepT, TimeT>(-1))
+{
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(node_ptr);
+  auto retcode = executor.spin_until_any_complete(futures, timeout);
+  executor.remove_node(node_ptr);
+  return retcode;
+}
+
+template<typename NodeT = rclcpp::Node, typename FutureContainerT, typename TimeRepT = int64_t,
+  typename TimeT = std::milli>
+rclcpp::FutureReturnCode
+spin_until_any_complete(
+  std::shared_ptr<NodeT> node_ptr,
+  const FutureContainerT & futures,
+  std::chrono::duration<TimeRepT, TimeT> timeout = std::chrono::duration<TimeRepT, TimeT>(-1))
+{
+  return rclcpp::spin_until_any_complete(node_ptr->get_node_base_interface(), futures, timeout);
+}
+
 }  // namespace rclcpp
 
 #endif  // RCLCPP__EXECUTORS_HPP_
@@ -0,0 +1,96 @@
+// Copyright 2024 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__EXECUTORS__EDF_EXECUTOR_HPP_
+#define RCLCPP__EXECUTORS__EDF_EXECUTOR_HPP_
+
+#include <chrono>
+#include <vector>
+
+#include "rclcpp/any_executable.hpp"
+#include "rclcpp/executor.hpp"
+#include "rclcpp/macros.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+namespace executors
+{
+
+/// Single-threaded executor that services ready work in earliest-deadline-first order.
+/**
+ * The default executors service ready entities in wait-set order, which lets a
+ * high-rate topic starve others. This executor instead drains all ready
+ * executables after each wait and executes them ordered by the absolute
+ * deadline derived from their callback group:
+ *
+ * - Groups with a relative deadline (CallbackGroup::set_scheduling_deadline)
+ *   are assigned `now + deadline` at the moment the work is collected.
+ * - Groups without a deadline come after all deadline-bearing groups, ordered
+ *   by descending CallbackGroup::scheduling_priority().
+ *
+ * Because at most one executable per mutually exclusive group is in flight per
+ * round, a group's remaining ready work re-enters the ready set on the next
+ * round and is re-evaluated against the current deadlines, so an urgent group
+ * is never stuck behind a backlog from a lax one.
+ */
+class EdfExecutor : public rclcpp::Executor
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS(EdfExecutor)
+
+  /// Constructor for EdfExecutor.
+  /**
+   * \param options common options for all executors
+   */
+  RCLCPP_PUBLIC
+  explicit EdfExecutor(
+    const rclcpp::ExecutorOptions & options = rclcpp::ExecutorOptions());
+
+  RCLCPP_PUBLIC
+  virtual ~EdfExecutor();
+
+  /**
+   * \sa rclcpp::Executor:spin() for more details
+   * \throws std::runtime_error when spin() called while already spinning
+   */
+  RCLCPP_PUBLIC
+  void
+  spin() override;
+
+private:
+  RCLCPP_DISABLE_COPY(EdfExecutor)
+
+  /// A ready executable together with its computed scheduling key.
+  struct ScheduledExecutable
+  {
+    rclcpp::AnyExecutable any_exec;
+    // Absolute deadline; max() for groups without a deadline.
+    std::chrono::steady_clock::time_point deadline;
+    // Tie breaker for non-deadline groups, higher runs first.
+    int priority;
+  };
+
+  /// Drain all ready executables and compute their scheduling keys.
+  void
+  collect_ready(std::vector<ScheduledExecutable> & ready);
+
+  // Reused across iterations to avoid per-loop allocations.
+  std::vector<ScheduledExecutable> ready_;
+};
+
+}  // namespace executors
+}  // namespace rclcpp
+
+#endif  // RCLCPP__EXECUTORS__EDF_EXECUTOR_HPP_
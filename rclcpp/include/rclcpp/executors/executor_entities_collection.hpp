@@ -17,7 +17,9 @@
 
 #include <deque>
 #include <functional>
+#include <map>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <rclcpp/any_executable.hpp>
@@ -192,6 +194,43 @@ build_entities_collection(
   const std::vector<rclcpp::CallbackGroup::WeakPtr> & callback_groups,
   ExecutorEntitiesCollection & collection);
 
+/// Cached per-callback-group snapshot used for incremental collection rebuilds.
+/**
+ * A snapshot is current as long as the group's entities_version() matches and
+ * none of the snapshotted entities have expired.
+ */
+struct GroupEntitiesCacheEntry
+{
+  /// Value of CallbackGroup::entities_version() when the snapshot was taken.
+  size_t entities_version;
+
+  /// The entities collected from the group.
+  ExecutorEntitiesCollection entities;
+};
+
+/// Cache of per-group snapshots, keyed by callback group.
+using GroupEntitiesCache = std::map<
+  rclcpp::CallbackGroup::WeakPtr,
+  GroupEntitiesCacheEntry,
+  std::owner_less<rclcpp::CallbackGroup::WeakPtr>>;
+
+/// Build an entities collection from callback groups, reusing cached snapshots
+/**
+ * Like build_entities_collection, but only walks the entities of callback
+ * groups whose membership changed since the previous call; unchanged groups
+ * are merged from the cache. This keeps the rebuild cost proportional to the
+ * number of changed groups instead of the total number of entities.
+ *
+ * \param[in] callback_groups List of callback groups to check for entities
+ * \param[inout] collection Entities collection to populate with found entities
+ * \param[inout] cache Per-group snapshots from the previous call; updated in place
+ */
+void
+build_entities_collection(
+  const std::vector<rclcpp::CallbackGroup::WeakPtr> & callback_groups,
+  ExecutorEntitiesCollection & collection,
+  GroupEntitiesCache & cache);
+
 /// Build a queue of executables ready to be executed
 /**
  * Iterates a list of entities and adds them to a queue if they are ready.
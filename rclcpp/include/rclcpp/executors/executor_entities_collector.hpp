@@ -15,6 +15,8 @@
 #ifndef RCLCPP__EXECUTORS__EXECUTOR_ENTITIES_COLLECTOR_HPP_
 #define RCLCPP__EXECUTORS__EXECUTOR_ENTITIES_COLLECTOR_HPP_
 
+#include <atomic>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -149,6 +151,19 @@ public:
   void
   update_collections();
 
+  /// Get the membership generation of this collector.
+  /**
+   * The generation is incremented every time the tracked set of nodes or
+   * callback groups actually changes, and may be read without taking the
+   * collector mutex.  Executors can snapshot it to cheaply detect whether
+   * membership changed since they last queried the callback groups.
+   *
+   * \return the current generation tag
+   */
+  RCLCPP_PUBLIC
+  uint64_t
+  get_generation() const;
+
 protected:
   using NodeCollection = std::set<
     rclcpp::node_interfaces::NodeBaseInterface::WeakPtr,
@@ -168,6 +183,11 @@ protected:
     rclcpp::GuardCondition::WeakPtr,
     std::owner_less<rclcpp::CallbackGroup::WeakPtr>>;
 
+  using WeakNodesToGroupsMap = std::map<
+    rclcpp::node_interfaces::NodeBaseInterface::WeakPtr,
+    CallbackGroupCollection,
+    std::owner_less<rclcpp::node_interfaces::NodeBaseInterface::WeakPtr>>;
+
   /// Implementation of removing a node from the collector.
   /**
    * This will disassociate the node from the collector and remove any
@@ -249,6 +269,14 @@ protected:
   /// Track guard conditions associated with added callback groups
   WeakGroupsToGuardConditionsMap weak_groups_to_guard_conditions_ RCPPUTILS_TSA_GUARDED_BY(mutex_);
 
+  /// Automatically added groups owned by each node, so a node's groups can be
+  /// removed in time proportional to that node's entities rather than by
+  /// scanning every group in the executor
+  WeakNodesToGroupsMap weak_nodes_to_groups_ RCPPUTILS_TSA_GUARDED_BY(mutex_);
+
+  /// Membership generation, incremented on every effective change, see get_generation()
+  std::atomic<uint64_t> generation_ {0};
+
   /// nodes that have been added since the last update.
   NodeCollection pending_added_nodes_ RCPPUTILS_TSA_GUARDED_BY(mutex_);
 
@@ -15,6 +15,7 @@
 #ifndef RCLCPP__EXECUTORS__EXECUTOR_NOTIFY_WAITABLE_HPP_
 #define RCLCPP__EXECUTORS__EXECUTOR_NOTIFY_WAITABLE_HPP_
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -147,6 +148,15 @@ private:
 
   std::function<void(size_t)> on_ready_callback_;
 
+  /// Whether a notification has been signaled but not yet executed.
+  /**
+   * Coalesces bursts of guard condition triggers: the first trigger after the
+   * last execute forwards to the on-ready callback, further triggers are
+   * absorbed until execute runs, so N entity changes within one wait cycle
+   * cost one wakeup and one rebuild.
+   */
+  std::atomic<bool> notification_pending_ {false};
+
   /// The collection of guard conditions to be waited on.
   std::set<rclcpp::GuardCondition::WeakPtr,
     std::owner_less<rclcpp::GuardCondition::WeakPtr>> notify_guard_conditions_;
@@ -16,16 +16,22 @@
 #define RCLCPP__EXECUTORS__MULTI_THREADED_EXECUTOR_HPP_
 
 #include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <set>
+#include <string>
 #include <thread>
 #include <unordered_map>
 
 #include "rclcpp/executor.hpp"
 #include "rclcpp/macros.hpp"
 #include "rclcpp/memory_strategies.hpp"
+#include "rclcpp/thread_attributes.hpp"
 #include "rclcpp/visibility_control.hpp"
+#include "rclcpp/wait_strategy.hpp"
 
 namespace rclcpp
 {
@@ -73,6 +79,26 @@ public:
   size_t
   get_number_of_threads();
 
+  /// Add a dedicated thread pool for callback groups tagged with the given name.
+  /**
+   * Callback groups assigned to the pool via
+   * rclcpp::CallbackGroup::set_thread_pool_name() have their ready callbacks
+   * handed to the pool's own work queue and executed exclusively on its
+   * threads, isolating them from the default threads and from other pools.
+   * Groups naming a pool this executor does not have fall back to the default
+   * threads.
+   *
+   * Pools must be added before spin() is called.
+   *
+   * \param name name of the pool, must be non-empty and not already added.
+   * \param number_of_threads number of dedicated threads, must be non-zero.
+   * \throws std::invalid_argument if the name or thread count is invalid.
+   * \throws std::runtime_error if called while spinning.
+   */
+  RCLCPP_PUBLIC
+  void
+  add_thread_pool(const std::string & name, size_t number_of_threads);
+
 protected:
   RCLCPP_PUBLIC
   void
@@ -81,8 +107,35 @@ protected:
 private:
   RCLCPP_DISABLE_COPY(MultiThreadedExecutor)
 
+  // Dedicated worker threads with an independent work queue, fed by the
+  // default threads when they take work from a group tagged with this pool.
+  struct ThreadPool
+  {
+    size_t number_of_threads;
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<rclcpp::AnyExecutable> queue;
+  };
+
+  /// Worker loop of a dedicated thread pool.
+  RCLCPP_LOCAL
+  void
+  run_pool(ThreadPool & pool);
+
+  /// Enqueue the executable on its group's thread pool, if it names one.
+  /**
+   * \return true if the executable was handed off, false if it should be
+   *   executed on the calling (default) thread.
+   */
+  RCLCPP_LOCAL
+  bool
+  dispatch_to_thread_pool(rclcpp::AnyExecutable & any_exec);
+
   std::mutex wait_mutex_;
   size_t number_of_threads_;
+  std::unordered_map<std::string, std::unique_ptr<ThreadPool>> thread_pools_;
+  std::optional<rclcpp::ThreadAttributes> thread_attributes_;
+  rclcpp::AdaptiveSpinWaiter spin_waiter_;
   bool yield_before_execute_;
   std::chrono::nanoseconds next_exec_timeout_;
 };
@@ -0,0 +1,175 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__EXECUTORS__MULTIPLEXED_EXECUTOR_HPP_
+#define RCLCPP__EXECUTORS__MULTIPLEXED_EXECUTOR_HPP_
+
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "rclcpp/any_executable.hpp"
+#include "rclcpp/executor.hpp"
+#include "rclcpp/macros.hpp"
+#include "rclcpp/node.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+namespace executors
+{
+
+/// Executor multiplexing single-threaded execution domains onto a thread pool.
+/**
+ * A common pattern for per-subsystem determinism is one SingleThreadedExecutor
+ * per subsystem, which costs one mostly idle thread and one wait set each.
+ * This executor keeps the determinism but collapses the overhead: all entities
+ * share one wait set and one small pool of worker threads, and every node is
+ * assigned to a named execution domain whose callbacks are strictly
+ * serialized, in ready order, exactly as if the domain had its own
+ * SingleThreadedExecutor.
+ *
+ * A worker that takes a ready executable from the shared wait set executes it
+ * in place when its domain is idle; otherwise the executable is queued on the
+ * domain and run, in order, by the worker currently driving that domain. Two
+ * callbacks of the same domain therefore never run concurrently, while
+ * different domains run in parallel up to the pool size.
+ *
+ * Nodes added with the plain add_node() overloads land in the default domain,
+ * which is serialized like any other.
+ */
+class MultiplexedExecutor : public rclcpp::Executor
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS(MultiplexedExecutor)
+
+  /// Constructor for MultiplexedExecutor.
+  /**
+   * \param options common options for all executors
+   * \param number_of_threads number of threads to have in the thread pool,
+   *   the default 0 will use the number of cpu cores found (minimum of 2)
+   * \param timeout maximum time to wait for work
+   */
+  RCLCPP_PUBLIC
+  explicit MultiplexedExecutor(
+    const rclcpp::ExecutorOptions & options = rclcpp::ExecutorOptions(),
+    size_t number_of_threads = 0,
+    std::chrono::nanoseconds timeout = std::chrono::nanoseconds(-1));
+
+  RCLCPP_PUBLIC
+  virtual ~MultiplexedExecutor();
+
+  /**
+   * \sa rclcpp::Executor:spin() for more details
+   * \throws std::runtime_error when spin() called while already spinning
+   */
+  RCLCPP_PUBLIC
+  void
+  spin() override;
+
+  RCLCPP_PUBLIC
+  size_t
+  get_number_of_threads();
+
+  /// Add a node to the executor, assigning it to an execution domain.
+  /**
+   * All callbacks of the node's callback groups are serialized with the other
+   * members of the domain. The domain is created on first use; it is fine to
+   * add nodes to new or existing domains while the executor is spinning.
+   *
+   * \param[in] node_ptr node to add, by its base interface.
+   * \param[in] domain_name name of the execution domain, must be non-empty.
+   * \param[in] notify \sa rclcpp::Executor::add_node
+   * \throws std::invalid_argument if domain_name is empty.
+   */
+  RCLCPP_PUBLIC
+  void
+  add_node_to_domain(
+    rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_ptr,
+    const std::string & domain_name,
+    bool notify = true);
+
+  /// Convenience overload taking a Node.
+  /** \sa add_node_to_domain */
+  RCLCPP_PUBLIC
+  void
+  add_node_to_domain(
+    std::shared_ptr<rclcpp::Node> node_ptr,
+    const std::string & domain_name,
+    bool notify = true);
+
+protected:
+  RCLCPP_PUBLIC
+  void
+  run();
+
+private:
+  RCLCPP_DISABLE_COPY(MultiplexedExecutor)
+
+  /// One logical single-threaded execution domain.
+  /**
+   * `busy` marks that some worker is currently executing for the domain;
+   * executables taken for a busy domain are parked in `queue` and drained, in
+   * order, by that worker before it releases the domain.
+   */
+  struct Domain
+  {
+    std::mutex mutex;
+    bool busy {false};
+    std::deque<rclcpp::AnyExecutable> queue;
+  };
+
+  /// Get (creating it if needed) the index of the named domain.
+  RCLCPP_LOCAL
+  size_t
+  domain_index(const std::string & domain_name);
+
+  /// Map an executable to its domain through its callback group's node.
+  /**
+   * Resolutions are cached per callback group; groups whose node was never
+   * assigned to a domain resolve to the default domain.
+   */
+  RCLCPP_LOCAL
+  Domain &
+  resolve_domain(const rclcpp::AnyExecutable & any_exec);
+
+  /// Execute (or park) the executable under its domain's serialization.
+  RCLCPP_LOCAL
+  void
+  execute_in_domain(rclcpp::AnyExecutable & any_exec, Domain & domain);
+
+  std::mutex wait_mutex_;
+  size_t number_of_threads_;
+  std::chrono::nanoseconds next_exec_timeout_;
+
+  /// Guards the domain table and the assignment maps below.
+  std::mutex domains_mutex_;
+  /// Domains by index; heap-allocated so references stay valid across growth.
+  std::vector<std::unique_ptr<Domain>> domains_;
+  std::unordered_map<std::string, size_t> domain_names_;
+  /// Nodes assigned to a non-default domain.
+  std::vector<std::pair<rclcpp::node_interfaces::NodeBaseInterface::WeakPtr, size_t>> node_domains_;
+  /// Cache of resolved callback group assignments.
+  std::unordered_map<const rclcpp::CallbackGroup *, size_t> group_domains_;
+};
+
+}  // namespace executors
+}  // namespace rclcpp
+
+#endif  // RCLCPP__EXECUTORS__MULTIPLEXED_EXECUTOR_HPP_
@@ -0,0 +1,171 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__EXECUTORS__NUMA_DOMAINS_HPP_
+#define RCLCPP__EXECUTORS__NUMA_DOMAINS_HPP_
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "rclcpp/executors/multi_threaded_executor.hpp"
+#include "rclcpp/macros.hpp"
+#include "rclcpp/node.hpp"
+#include "rclcpp/thread_attributes.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+namespace executors
+{
+
+/// A NUMA domain and the CPUs that belong to it.
+struct NumaDomain
+{
+  /// Domain index as reported by the OS (node id on Linux).
+  size_t id;
+
+  /// CPU indices local to this domain.
+  std::vector<size_t> cpu_set;
+};
+
+/// Discover the NUMA domains of the host.
+/**
+ * On Linux the domains are read from /sys/devices/system/node. On platforms
+ * without that interface, or on single-socket machines, a single domain
+ * covering every hardware thread is returned, so callers never need a
+ * special case.
+ *
+ * \return one entry per NUMA domain, ordered by domain id, never empty.
+ */
+RCLCPP_PUBLIC
+std::vector<NumaDomain>
+detect_numa_domains();
+
+/// Build thread attributes that pin worker threads to one NUMA domain.
+/**
+ * The returned attributes carry the domain's cpu set and a thread name of the
+ * form "numa<id>". First-touch allocation then places executor-side memory
+ * (intra-process buffers, callback state) on the domain the threads run on.
+ *
+ * \param[in] domain the domain to pin to.
+ * \return attributes suitable for rclcpp::ExecutorOptions::thread_attributes.
+ */
+RCLCPP_PUBLIC
+rclcpp::ThreadAttributes
+thread_attributes_for_numa_domain(const NumaDomain & domain);
+
+/// One multi-threaded executor per NUMA domain, with placement-aware assignment.
+/**
+ * On multi-socket machines a single executor's thread pool migrates across
+ * sockets, so intra-process buffer memory is first-touched on one node and
+ * consumed from another. This helper builds one MultiThreadedExecutor per NUMA
+ * domain, pins each pool to its domain's CPUs via ThreadAttributes, and
+ * assigns nodes (and their callback groups) to domains: a node whose
+ * NodeOptions carry a numa_domain hint goes to that domain, all others are
+ * spread round-robin. Callbacks of one node then always run on one socket,
+ * and first-touch keeps their buffers local.
+ *
+ * Intra-process messaging between nodes on different domains keeps working
+ * unchanged; only the placement of the endpoints is controlled here.
+ */
+class NumaExecutorSet
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS_NOT_COPYABLE(NumaExecutorSet)
+
+  /// Constructor for NumaExecutorSet.
+  /**
+   * \param options common options, applied to every per-domain executor;
+   *   any thread_attributes in it are overridden with the per-domain pinning.
+   * \param domains the domains to build executors for, the default empty
+   *   vector means the domains detected on this host.
+   */
+  RCLCPP_PUBLIC
+  explicit NumaExecutorSet(
+    const rclcpp::ExecutorOptions & options = rclcpp::ExecutorOptions(),
+    std::vector<NumaDomain> domains = {});
+
+  RCLCPP_PUBLIC
+  virtual ~NumaExecutorSet();
+
+  /// Add a node to the executor of its preferred domain.
+  /**
+   * Honors the numa_domain hint in the node's NodeOptions when it names an
+   * existing domain; otherwise the node goes to the domain with the fewest
+   * assigned nodes.
+   *
+   * \param[in] node_ptr the node to add.
+   * \return the domain index the node was assigned to.
+   */
+  RCLCPP_PUBLIC
+  size_t
+  add_node(rclcpp::Node::SharedPtr node_ptr);
+
+  /// Add a single callback group to the executor of the given domain.
+  /**
+   * \param[in] group_ptr the callback group to add.
+   * \param[in] node_ptr the node base interface owning the group.
+   * \param[in] domain_index index into domains(), not the OS domain id.
+   * \throws std::out_of_range if domain_index is not a valid index.
+   */
+  RCLCPP_PUBLIC
+  void
+  add_callback_group(
+    rclcpp::CallbackGroup::SharedPtr group_ptr,
+    rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_ptr,
+    size_t domain_index);
+
+  /// Spin all per-domain executors, one spinner thread each, until cancelled.
+  /**
+   * Blocks until cancel() is called (the per-domain worker pools are spawned
+   * by the executors themselves, already pinned).
+   * \throws std::runtime_error when spin() called while already spinning
+   */
+  RCLCPP_PUBLIC
+  void
+  spin();
+
+  /// Cancel all per-domain executors.
+  RCLCPP_PUBLIC
+  void
+  cancel();
+
+  /// Return the domains this set was built for.
+  RCLCPP_PUBLIC
+  const std::vector<NumaDomain> &
+  domains() const;
+
+  /// Return the executor for the given domain index.
+  /**
+   * \throws std::out_of_range if domain_index is not a valid index.
+   */
+  RCLCPP_PUBLIC
+  rclcpp::executors::MultiThreadedExecutor &
+  get_executor(size_t domain_index);
+
+private:
+  RCLCPP_DISABLE_COPY(NumaExecutorSet)
+
+  std::vector<NumaDomain> domains_;
+  std::vector<std::unique_ptr<MultiThreadedExecutor>> domain_executors_;
+  // Nodes assigned per domain, used for least-loaded placement of unhinted nodes.
+  std::vector<size_t> nodes_per_domain_;
+  std::atomic_bool spinning_ {false};
+};
+
+}  // namespace executors
+}  // namespace rclcpp
+
+#endif  // RCLCPP__EXECUTORS__NUMA_DOMAINS_HPP_
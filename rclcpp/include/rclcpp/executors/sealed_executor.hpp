@@ -0,0 +1,220 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__EXECUTORS__SEALED_EXECUTOR_HPP_
+#define RCLCPP__EXECUTORS__SEALED_EXECUTOR_HPP_
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include "rclcpp/executors/static_single_threaded_executor.hpp"
+#include "rclcpp/macros.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+namespace executors
+{
+
+/// Fixed-configuration executor with a precompiled dispatch table.
+/**
+ * This executor targets systems whose entity set never changes after
+ * initialization. Nodes and callback groups are added as usual; calling
+ * seal() then freezes the configuration: all timers, subscriptions, services,
+ * clients and waitables are copied into flat arrays and paired with direct
+ * function-pointer dispatch entries. After sealing, any attempt to add or
+ * remove entities throws, and the spin functions iterate the preallocated
+ * dispatch table without constructing AnyExecutable instances and without
+ * locking or rebuilding any entity collection per cycle.
+ *
+ * Usage:
+ * rclcpp::executors::SealedExecutor exec;
+ * exec.add_node(node);
+ * exec.seal();
+ * exec.spin();
+ */
+class SealedExecutor : public StaticSingleThreadedExecutor
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS(SealedExecutor)
+
+  /// Default constructor. See the default constructor for Executor.
+  RCLCPP_PUBLIC
+  explicit SealedExecutor(
+    const rclcpp::ExecutorOptions & options = rclcpp::ExecutorOptions());
+
+  /// Default destructor.
+  RCLCPP_PUBLIC
+  virtual ~SealedExecutor();
+
+  /// Freeze the current entity configuration into the dispatch table.
+  /**
+   * Collects the entities of all nodes and callback groups added so far,
+   * prepares the wait set once and builds the flat dispatch table used by the
+   * spin functions. After this call the configuration is immutable.
+   *
+   * \throws std::runtime_error if the executor is already sealed
+   */
+  RCLCPP_PUBLIC
+  void
+  seal();
+
+  /// Return true if seal() has been called.
+  RCLCPP_PUBLIC
+  bool
+  is_sealed() const;
+
+  /// Sealed executor implementation of spin.
+  /**
+   * \throws std::runtime_error if called before seal()
+   * \throws std::runtime_error when spin() called while already spinning
+   */
+  RCLCPP_PUBLIC
+  void
+  spin() override;
+
+  /// Sealed executor implementation of spin some.
+  /**
+   * \sa rclcpp::executors::StaticSingleThreadedExecutor::spin_some
+   * \throws std::runtime_error if called before seal()
+   */
+  RCLCPP_PUBLIC
+  void
+  spin_some(std::chrono::nanoseconds max_duration = std::chrono::nanoseconds(0)) override;
+
+  /// Sealed executor implementation of spin all.
+  /**
+   * \sa rclcpp::executors::StaticSingleThreadedExecutor::spin_all
+   * \throws std::runtime_error if called before seal()
+   */
+  RCLCPP_PUBLIC
+  void
+  spin_all(std::chrono::nanoseconds max_duration) override;
+
+  /// Add a callback group to an executor.
+  /**
+   * \sa rclcpp::Executor::add_callback_group
+   * \throws std::runtime_error if the executor is sealed
+   */
+  RCLCPP_PUBLIC
+  void
+  add_callback_group(
+    rclcpp::CallbackGroup::SharedPtr group_ptr,
+    rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_ptr,
+    bool notify = true) override;
+
+  /// Remove callback group from the executor.
+  /**
+   * \sa rclcpp::Executor::remove_callback_group
+   * \throws std::runtime_error if the executor is sealed
+   */
+  RCLCPP_PUBLIC
+  void
+  remove_callback_group(
+    rclcpp::CallbackGroup::SharedPtr group_ptr,
+    bool notify = true) override;
+
+  /// Add a node to the executor.
+  /**
+   * \sa rclcpp::Executor::add_node
+   * \throws std::runtime_error if the executor is sealed
+   */
+  RCLCPP_PUBLIC
+  void
+  add_node(
+    rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_ptr,
+    bool notify = true) override;
+
+  /// Remove a node from the executor.
+  /**
+   * \sa rclcpp::Executor::remove_node
+   * \throws std::runtime_error if the executor is sealed
+   */
+  RCLCPP_PUBLIC
+  void
+  remove_node(
+    rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_ptr,
+    bool notify = true) override;
+
+protected:
+  /// One frozen entity with its readiness check and dispatch function.
+  struct DispatchEntry
+  {
+    /// Check readiness and run the entity; returns true if a callback ran.
+    bool (* dispatch)(SealedExecutor & self, const DispatchEntry & entry);
+    /// Points at the typed shared pointer in the frozen entity storage.
+    const void * entity;
+    /// Index into the matching wait set array.
+    size_t index;
+  };
+
+  /// Run one pass over the dispatch table.
+  /**
+   * \param spin_once if true, return after the first executed entity.
+   * \return true if any entity was ready and executed.
+   */
+  RCLCPP_PUBLIC
+  bool
+  run_dispatch_table(bool spin_once);
+
+  RCLCPP_PUBLIC
+  void
+  spin_some_impl(std::chrono::nanoseconds max_duration, bool exhaustive);
+
+  RCLCPP_PUBLIC
+  void
+  spin_once_impl(std::chrono::nanoseconds timeout) override;
+
+private:
+  RCLCPP_DISABLE_COPY(SealedExecutor)
+
+  void
+  throw_if_sealed() const;
+
+  void
+  throw_if_not_sealed() const;
+
+  static bool
+  dispatch_subscription(SealedExecutor & self, const DispatchEntry & entry);
+
+  static bool
+  dispatch_timer(SealedExecutor & self, const DispatchEntry & entry);
+
+  static bool
+  dispatch_service(SealedExecutor & self, const DispatchEntry & entry);
+
+  static bool
+  dispatch_client(SealedExecutor & self, const DispatchEntry & entry);
+
+  static bool
+  dispatch_waitable(SealedExecutor & self, const DispatchEntry & entry);
+
+  /// Frozen entity storage; keeps every dispatched entity alive and in place.
+  std::vector<rclcpp::SubscriptionBase::SharedPtr> subscriptions_;
+  std::vector<rclcpp::TimerBase::SharedPtr> timers_;
+  std::vector<rclcpp::ServiceBase::SharedPtr> services_;
+  std::vector<rclcpp::ClientBase::SharedPtr> clients_;
+  std::vector<rclcpp::Waitable::SharedPtr> waitables_;
+
+  /// Flat dispatch table built by seal(), iterated by the spin functions.
+  std::vector<DispatchEntry> dispatch_table_;
+
+  bool sealed_ = false;
+};
+
+}  // namespace executors
+}  // namespace rclcpp
+
+#endif  // RCLCPP__EXECUTORS__SEALED_EXECUTOR_HPP_
@@ -0,0 +1,144 @@
+// Copyright 2024 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__EXECUTORS__WORK_STEALING_EXECUTOR_HPP_
+#define RCLCPP__EXECUTORS__WORK_STEALING_EXECUTOR_HPP_
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "rclcpp/any_executable.hpp"
+#include "rclcpp/executor.hpp"
+#include "rclcpp/macros.hpp"
+#include "rclcpp/thread_attributes.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+namespace executors
+{
+
+/// Multi-threaded executor with per-thread work queues and work stealing.
+/**
+ * Unlike MultiThreadedExecutor, where every worker thread serializes on a single
+ * mutex around get_next_executable(), this executor shards ready executables
+ * across per-thread queues keyed by callback group and lets idle threads steal
+ * from their neighbors.
+ *
+ * One worker at a time takes the collector role: it waits for work, drains all
+ * ready executables from the wait result and distributes them to the per-thread
+ * queues. All other workers only touch their own queue (or a victim's queue
+ * when stealing), so the dispatch hot path has no process-wide lock.
+ *
+ * Executables from the same callback group always hash to the same queue, which
+ * preserves the mutually-exclusive callback group guarantee and keeps a group's
+ * callbacks cache-warm on one thread.
+ */
+class WorkStealingExecutor : public rclcpp::Executor
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS(WorkStealingExecutor)
+
+  /// Constructor for WorkStealingExecutor.
+  /**
+   * \param options common options for all executors
+   * \param number_of_threads number of threads to have in the thread pool,
+   *   the default 0 will use the number of cpu cores found (minimum of 2)
+   * \param timeout maximum time the collector thread waits for work
+   */
+  RCLCPP_PUBLIC
+  explicit WorkStealingExecutor(
+    const rclcpp::ExecutorOptions & options = rclcpp::ExecutorOptions(),
+    size_t number_of_threads = 0,
+    std::chrono::nanoseconds timeout = std::chrono::nanoseconds(-1));
+
+  RCLCPP_PUBLIC
+  virtual ~WorkStealingExecutor();
+
+  /**
+   * \sa rclcpp::Executor:spin() for more details
+   * \throws std::runtime_error when spin() called while already spinning
+   */
+  RCLCPP_PUBLIC
+  void
+  spin() override;
+
+  RCLCPP_PUBLIC
+  size_t
+  get_number_of_threads();
+
+protected:
+  RCLCPP_PUBLIC
+  void
+  run(size_t this_thread_number);
+
+private:
+  RCLCPP_DISABLE_COPY(WorkStealingExecutor)
+
+  /// A per-thread queue of ready executables.
+  /**
+   * The queue has its own narrow mutex: the owner pops from the front,
+   * thieves pop from the back, and the collector pushes to the back.
+   * Contention is limited to one queue, never the whole executor.
+   */
+  struct WorkQueue
+  {
+    std::mutex mutex;
+    std::deque<rclcpp::AnyExecutable> executables;
+  };
+
+  /// Try to pop work from this thread's own queue.
+  bool
+  pop_local(size_t this_thread_number, rclcpp::AnyExecutable & any_exec);
+
+  /// Try to steal work from another thread's queue.
+  bool
+  steal(size_t this_thread_number, rclcpp::AnyExecutable & any_exec);
+
+  /// Wait for work and distribute ready executables to the per-thread queues.
+  /**
+   * Only one thread at a time runs this; returns the number of executables
+   * that were distributed.
+   */
+  size_t
+  collect(size_t this_thread_number);
+
+  /// Map a ready executable to a worker queue by callback group identity.
+  size_t
+  shard_for(const rclcpp::AnyExecutable & any_exec) const;
+
+  size_t number_of_threads_;
+  std::optional<rclcpp::ThreadAttributes> thread_attributes_;
+  std::chrono::nanoseconds next_exec_timeout_;
+
+  std::vector<std::unique_ptr<WorkQueue>> queues_;
+
+  // Serializes the collector role; never held while executing callbacks.
+  std::mutex collect_mutex_;
+  // Parks workers that found no local work, no stealable work and no
+  // collector role available.
+  std::mutex idle_mutex_;
+  std::condition_variable idle_cv_;
+};
+
+}  // namespace executors
+}  // namespace rclcpp
+
+#endif  // RCLCPP__EXECUTORS__WORK_STEALING_EXECUTOR_HPP_
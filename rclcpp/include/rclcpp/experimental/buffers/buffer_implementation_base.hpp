@@ -15,6 +15,13 @@
 #ifndef RCLCPP__EXPERIMENTAL__BUFFERS__BUFFER_IMPLEMENTATION_BASE_HPP_
 #define RCLCPP__EXPERIMENTAL__BUFFERS__BUFFER_IMPLEMENTATION_BASE_HPP_
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+#include "rclcpp/intra_process_buffer_full_policy.hpp"
+
 namespace rclcpp
 {
 namespace experimental
@@ -34,6 +41,32 @@ public:
   virtual void clear() = 0;
   virtual bool has_data() const = 0;
   virtual size_t available_capacity() const = 0;
+
+  /// Set the counter to increment when an enqueue overwrites unread data.
+  /**
+   * Implementations that drop the oldest element when full should increment
+   * the counter once per overwritten element; the default is to not count.
+   */
+  virtual void set_overwrite_counter(std::shared_ptr<std::atomic<uint64_t>> counter)
+  {
+    (void)counter;
+  }
+
+  /// Set the behavior for enqueue() on a full buffer.
+  /**
+   * The default implementation ignores the request, keeping the
+   * overwrite-oldest behavior.
+   *
+   * \param policy what to do with the incoming element when full.
+   * \param timeout how long IntraProcessBufferFullPolicy::Block waits for
+   *   room, non-positive values wait indefinitely.
+   */
+  virtual void set_full_policy(
+    rclcpp::IntraProcessBufferFullPolicy policy, std::chrono::nanoseconds timeout)
+  {
+    (void)policy;
+    (void)timeout;
+  }
 };
 
 }  // namespace buffers
@@ -15,6 +15,9 @@
 #ifndef RCLCPP__EXPERIMENTAL__BUFFERS__INTRA_PROCESS_BUFFER_HPP_
 #define RCLCPP__EXPERIMENTAL__BUFFERS__INTRA_PROCESS_BUFFER_HPP_
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <stdexcept>
 #include <type_traits>
@@ -23,6 +26,7 @@
 #include "rclcpp/allocator/allocator_common.hpp"
 #include "rclcpp/allocator/allocator_deleter.hpp"
 #include "rclcpp/experimental/buffers/buffer_implementation_base.hpp"
+#include "rclcpp/is_trivially_relocatable.hpp"
 #include "rclcpp/macros.hpp"
 #include "tracetools/tracetools.h"
 
@@ -33,6 +37,27 @@ namespace experimental
 namespace buffers
 {
 
+/// Largest message size stored by value in ring-buffer slots.
+constexpr size_t kInlineBufferMaxMessageSize = 256;
+
+/// Whether messages of this type may be stored by value in ring-buffer slots.
+/**
+ * For small trivially copyable messages (e.g. 48 byte velocity commands) the
+ * pointer hand-off and shared_ptr control-block allocations of the typed
+ * buffer cost more than simply copying the payload, so such messages are
+ * stored inline instead. Types marked trivially relocatable through the
+ * rclcpp::is_trivially_relocatable trait qualify as well, even when the
+ * generated constructors hide the trivial copyability from the language.
+ * \sa InlineTypedIntraProcessBuffer
+ */
+template<typename MessageT>
+struct is_inline_buffer_eligible
+  : std::integral_constant<bool,
+    rclcpp::is_trivially_relocatable<MessageT>::value &&
+    std::is_default_constructible<MessageT>::value &&
+    sizeof(MessageT) <= kInlineBufferMaxMessageSize>
+{};
+
 class IntraProcessBufferBase
 {
 public:
@@ -45,6 +70,22 @@ public:
   virtual bool has_data() const = 0;
   virtual bool use_take_shared_method() const = 0;
   virtual size_t available_capacity() const = 0;
+
+  /// Set the counter to increment when an enqueue overwrites unread data.
+  /** \sa BufferImplementationBase::set_overwrite_counter */
+  virtual void set_overwrite_counter(std::shared_ptr<std::atomic<uint64_t>> counter)
+  {
+    (void)counter;
+  }
+
+  /// Set the behavior for additions to a full buffer.
+  /** \sa BufferImplementationBase::set_full_policy */
+  virtual void set_full_policy(
+    rclcpp::IntraProcessBufferFullPolicy policy, std::chrono::nanoseconds timeout)
+  {
+    (void)policy;
+    (void)timeout;
+  }
 };
 
 template<
@@ -149,6 +190,17 @@ public:
     return buffer_->available_capacity();
   }
 
+  void set_overwrite_counter(std::shared_ptr<std::atomic<uint64_t>> counter) override
+  {
+    buffer_->set_overwrite_counter(std::move(counter));
+  }
+
+  void set_full_policy(
+    rclcpp::IntraProcessBufferFullPolicy policy, std::chrono::nanoseconds timeout) override
+  {
+    buffer_->set_full_policy(policy, timeout);
+  }
+
 private:
   std::unique_ptr<BufferImplementationBase<BufferT>> buffer_;
 
@@ -177,7 +229,7 @@ private:
     MessageUniquePtr unique_msg;
     MessageDeleter * deleter = std::get_deleter<MessageDeleter, const MessageT>(shared_msg);
     auto ptr = MessageAllocTraits::allocate(*message_allocator_.get(), 1);
-    MessageAllocTraits::construct(*message_allocator_.get(), ptr, *shared_msg);
+    rclcpp::detail::construct_relocated_copy(*message_allocator_.get(), ptr, *shared_msg);
     if (deleter) {
       unique_msg = MessageUniquePtr(ptr, *deleter);
     } else {
@@ -223,7 +275,7 @@ private:
     MessageUniquePtr unique_msg;
     MessageDeleter * deleter = std::get_deleter<MessageDeleter, const MessageT>(buffer_msg);
     auto ptr = MessageAllocTraits::allocate(*message_allocator_.get(), 1);
-    MessageAllocTraits::construct(*message_allocator_.get(), ptr, *buffer_msg);
+    rclcpp::detail::construct_relocated_copy(*message_allocator_.get(), ptr, *buffer_msg);
     if (deleter) {
       unique_msg = MessageUniquePtr(ptr, *deleter);
     } else {
@@ -245,6 +297,126 @@ private:
   }
 };
 
+/// Buffer storing small messages by value in the ring-buffer slots.
+/**
+ * Enqueues copy the payload straight into a pre-allocated slot, so publishing
+ * into this buffer neither allocates nor creates a shared_ptr control block.
+ * Consumers still receive owned pointers; the single allocation this requires
+ * is served by the buffer's message allocator, which keeps it cheap when a
+ * recycling allocator such as ArenaPoolAllocator is configured.
+ *
+ * Only eligible message types may be stored this way,
+ * \sa is_inline_buffer_eligible.
+ */
+template<
+  typename MessageT,
+  typename Alloc = std::allocator<void>,
+  typename MessageDeleter = std::default_delete<MessageT>>
+class InlineTypedIntraProcessBuffer : public IntraProcessBuffer<MessageT, Alloc, MessageDeleter>
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS(InlineTypedIntraProcessBuffer)
+
+  using MessageAllocTraits = allocator::AllocRebind<MessageT, Alloc>;
+  using MessageAlloc = typename MessageAllocTraits::allocator_type;
+  using MessageUniquePtr = std::unique_ptr<MessageT, MessageDeleter>;
+  using MessageSharedPtr = std::shared_ptr<const MessageT>;
+
+  static_assert(
+    is_inline_buffer_eligible<MessageT>::value,
+    "InlineTypedIntraProcessBuffer requires a small trivially copyable message type");
+
+  explicit
+  InlineTypedIntraProcessBuffer(
+    std::unique_ptr<BufferImplementationBase<MessageT>> buffer_impl,
+    std::shared_ptr<Alloc> allocator = nullptr)
+  {
+    buffer_ = std::move(buffer_impl);
+
+    TRACETOOLS_TRACEPOINT(
+      rclcpp_buffer_to_ipb,
+      static_cast<const void *>(buffer_.get()),
+      static_cast<const void *>(this));
+    if (!allocator) {
+      message_allocator_ = std::make_shared<MessageAlloc>();
+    } else {
+      message_allocator_ = std::make_shared<MessageAlloc>(*allocator.get());
+    }
+  }
+
+  virtual ~InlineTypedIntraProcessBuffer() {}
+
+  void add_shared(MessageSharedPtr msg) override
+  {
+    buffer_->enqueue(*msg);
+  }
+
+  void add_unique(MessageUniquePtr msg) override
+  {
+    buffer_->enqueue(*msg);
+  }
+
+  MessageSharedPtr consume_shared() override
+  {
+    if constexpr (std::is_trivially_copyable<MessageT>::value) {
+      return std::allocate_shared<MessageT, MessageAlloc>(*message_allocator_, buffer_->dequeue());
+    } else {
+      // Relocatable but not trivially copyable for the language: construct the
+      // shared message first, then overwrite it bytewise to bypass the
+      // generated per-field copy assignment.
+      auto msg = std::allocate_shared<MessageT, MessageAlloc>(*message_allocator_);
+      rclcpp::detail::relocate_into(buffer_->dequeue(), *msg);
+      return msg;
+    }
+  }
+
+  MessageUniquePtr consume_unique() override
+  {
+    MessageT message = buffer_->dequeue();
+    auto ptr = MessageAllocTraits::allocate(*message_allocator_.get(), 1);
+    rclcpp::detail::construct_relocated_copy(*message_allocator_.get(), ptr, message);
+    MessageDeleter deleter;
+    allocator::set_allocator_for_deleter(&deleter, message_allocator_.get());
+    return MessageUniquePtr(ptr, deleter);
+  }
+
+  bool has_data() const override
+  {
+    return buffer_->has_data();
+  }
+
+  void clear() override
+  {
+    buffer_->clear();
+  }
+
+  bool use_take_shared_method() const override
+  {
+    return false;
+  }
+
+  size_t available_capacity() const override
+  {
+    return buffer_->available_capacity();
+  }
+
+  void set_overwrite_counter(std::shared_ptr<std::atomic<uint64_t>> counter) override
+  {
+    buffer_->set_overwrite_counter(std::move(counter));
+  }
+
+  void set_full_policy(
+    rclcpp::IntraProcessBufferFullPolicy policy, std::chrono::nanoseconds timeout) override
+  {
+    buffer_->set_full_policy(policy, timeout);
+  }
+
+private:
+  std::unique_ptr<BufferImplementationBase<MessageT>> buffer_;
+
+  std::shared_ptr<MessageAlloc> message_allocator_;
+};
+
 }  // namespace buffers
 }  // namespace experimental
 }  // namespace rclcpp
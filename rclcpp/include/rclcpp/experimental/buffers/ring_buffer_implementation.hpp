@@ -15,12 +15,19 @@
 #ifndef RCLCPP__EXPERIMENTAL__BUFFERS__RING_BUFFER_IMPLEMENTATION_HPP_
 #define RCLCPP__EXPERIMENTAL__BUFFERS__RING_BUFFER_IMPLEMENTATION_HPP_
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
 #include <mutex>
 #include <stdexcept>
 #include <utility>
 #include <vector>
 
 #include "rclcpp/experimental/buffers/buffer_implementation_base.hpp"
+#include "rclcpp/is_trivially_relocatable.hpp"
+#include "rclcpp/intra_process_buffer_full_policy.hpp"
 #include "rclcpp/logger.hpp"
 #include "rclcpp/logging.hpp"
 #include "rclcpp/macros.hpp"
@@ -68,10 +75,29 @@ public:
    */
   void enqueue(BufferT request)
   {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    if (is_full_() && full_policy_ != rclcpp::IntraProcessBufferFullPolicy::OverwriteOldest) {
+      if (full_policy_ == rclcpp::IntraProcessBufferFullPolicy::Block) {
+        auto not_full = [this]() {return !is_full_();};
+        if (full_timeout_ > std::chrono::nanoseconds::zero()) {
+          not_full_cv_.wait_for(lock, full_timeout_, not_full);
+        } else {
+          not_full_cv_.wait(lock, not_full);
+        }
+      }
+      if (is_full_()) {
+        // Drop-newest, or block timed out: the incoming element is discarded
+        // and the unread history is kept.
+        if (overwrite_counter_) {
+          overwrite_counter_->fetch_add(1, std::memory_order_relaxed);
+        }
+        return;
+      }
+    }
 
     write_index_ = next_(write_index_);
-    ring_buffer_[write_index_] = std::move(request);
+    rclcpp::detail::relocate_into(std::move(request), ring_buffer_[write_index_]);
     TRACETOOLS_TRACEPOINT(
       rclcpp_ring_buffer_enqueue,
       static_cast<const void *>(this),
@@ -81,6 +107,9 @@ public:
 
     if (is_full_()) {
       read_index_ = next_(read_index_);
+      if (overwrite_counter_) {
+        overwrite_counter_->fetch_add(1, std::memory_order_relaxed);
+      }
     } else {
       size_++;
     }
@@ -100,7 +129,8 @@ public:
       return BufferT();
     }
 
-    auto request = std::move(ring_buffer_[read_index_]);
+    BufferT request;
+    rclcpp::detail::relocate_into(std::move(ring_buffer_[read_index_]), request);
     TRACETOOLS_TRACEPOINT(
       rclcpp_ring_buffer_dequeue,
       static_cast<const void *>(this),
@@ -109,6 +139,7 @@ public:
     read_index_ = next_(read_index_);
 
     size_--;
+    not_full_cv_.notify_one();
 
     return request;
   }
@@ -168,6 +199,23 @@ public:
     TRACETOOLS_TRACEPOINT(rclcpp_ring_buffer_clear, static_cast<const void *>(this));
   }
 
+  /// Set the counter to increment when an enqueue overwrites unread data.
+  void set_overwrite_counter(std::shared_ptr<std::atomic<uint64_t>> counter) override
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    overwrite_counter_ = std::move(counter);
+  }
+
+  /// Set the behavior for enqueue() on a full buffer.
+  /** \sa BufferImplementationBase::set_full_policy */
+  void set_full_policy(
+    rclcpp::IntraProcessBufferFullPolicy policy, std::chrono::nanoseconds timeout) override
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    full_policy_ = policy;
+    full_timeout_ = timeout;
+  }
+
 private:
   /// Get the next index value for the ring buffer
   /**
@@ -223,6 +271,13 @@ private:
   size_t read_index_;
   size_t size_;
 
+  std::shared_ptr<std::atomic<uint64_t>> overwrite_counter_;
+
+  rclcpp::IntraProcessBufferFullPolicy full_policy_ {
+    rclcpp::IntraProcessBufferFullPolicy::OverwriteOldest};
+  std::chrono::nanoseconds full_timeout_ {-1};
+  std::condition_variable not_full_cv_;
+
   mutable std::mutex mutex_;
 };
 
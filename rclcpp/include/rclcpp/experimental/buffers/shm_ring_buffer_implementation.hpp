@@ -0,0 +1,388 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__EXPERIMENTAL__BUFFERS__SHM_RING_BUFFER_IMPLEMENTATION_HPP_
+#define RCLCPP__EXPERIMENTAL__BUFFERS__SHM_RING_BUFFER_IMPLEMENTATION_HPP_
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "rclcpp/experimental/buffers/buffer_implementation_base.hpp"
+#include "rclcpp/is_trivially_relocatable.hpp"
+#include "rclcpp/macros.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+namespace experimental
+{
+namespace buffers
+{
+
+/// Store elements in a fixed-size, FIFO buffer placed in shared memory.
+/**
+ * Cross-process variant of SpscRingBufferImplementation: the control block
+ * and the slots live in a named POSIX shared memory segment, so one process
+ * may enqueue while another dequeues with the same moved-value economics as
+ * the in-process ring buffers. Both sides construct the buffer with the same
+ * name; whichever process arrives first creates and initializes the segment
+ * and the other attaches to it. Handoff uses the same per-slot sequence
+ * counters as the single-process buffer, which work unchanged across
+ * processes because every atomic in the segment is lock free.
+ *
+ * Only trivially relocatable element types are supported: the consumer reads
+ * a byte-for-byte copy from the segment, so the object representation must
+ * fully describe the value. Types holding heap pointers (unbounded strings
+ * or sequences, smart pointers) must stay on the regular rmw path. Like the
+ * in-process buffers, exactly one thread in one process may enqueue and
+ * exactly one thread in one process may dequeue, and enqueue() on a full
+ * buffer drops the oldest element.
+ *
+ * The segment is unlinked by the last detaching buffer; a crashed peer
+ * therefore leaves the name behind until the surviving side detaches. This
+ * class is not available on Windows, the constructor throws there.
+ */
+template<typename BufferT>
+class ShmRingBufferImplementation : public BufferImplementationBase<BufferT>
+{
+  static_assert(
+    rclcpp::is_trivially_relocatable_v<BufferT>,
+    "shared memory ring buffers require a trivially relocatable element type");
+  static_assert(
+    std::atomic<uint64_t>::is_always_lock_free,
+    "shared memory ring buffers require lock free 64 bit atomics");
+
+public:
+  ShmRingBufferImplementation(const std::string & name, size_t capacity)
+  : capacity_(capacity)
+  {
+    if (capacity == 0) {
+      throw std::invalid_argument("capacity must be a positive, non-zero value");
+    }
+    if (name.empty() || name.find('/') != std::string::npos) {
+      throw std::invalid_argument("segment name must be non-empty and must not contain '/'");
+    }
+#if defined(_WIN32)
+    throw std::runtime_error("shared memory ring buffers are not supported on this platform");
+#else
+    shm_name_ = "/" + name;
+    const size_t segment_size = sizeof(ControlBlock) + capacity_ * sizeof(Slot);
+
+    bool created = true;
+    int fd = shm_open(shm_name_.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+      if (errno != EEXIST) {
+        throw std::runtime_error("failed to create shared memory segment " + shm_name_);
+      }
+      created = false;
+      fd = shm_open(shm_name_.c_str(), O_RDWR, 0600);
+      if (fd < 0) {
+        throw std::runtime_error("failed to open shared memory segment " + shm_name_);
+      }
+    }
+
+    if (created) {
+      if (ftruncate(fd, static_cast<off_t>(segment_size)) != 0) {
+        close(fd);
+        shm_unlink(shm_name_.c_str());
+        throw std::runtime_error("failed to size shared memory segment " + shm_name_);
+      }
+    } else {
+      // The creator may not have sized the segment yet; wait until it has.
+      wait_for_segment_size(fd, segment_size);
+    }
+
+    void * base = mmap(nullptr, segment_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (MAP_FAILED == base) {
+      if (created) {
+        shm_unlink(shm_name_.c_str());
+      }
+      throw std::runtime_error("failed to map shared memory segment " + shm_name_);
+    }
+    base_ = base;
+    segment_size_ = segment_size;
+    control_ = static_cast<ControlBlock *>(base);
+    slots_ = reinterpret_cast<Slot *>(static_cast<char *>(base) + sizeof(ControlBlock));
+
+    if (created) {
+      new (control_) ControlBlock;
+      control_->element_size = sizeof(BufferT);
+      control_->capacity = capacity_;
+      control_->overwrite_count.store(0, std::memory_order_relaxed);
+      control_->attached.store(0, std::memory_order_relaxed);
+      control_->write_pos.store(0, std::memory_order_relaxed);
+      control_->read_pos.store(0, std::memory_order_relaxed);
+      for (size_t i = 0; i < capacity_; i++) {
+        new (&slots_[i].sequence) std::atomic<uint64_t>(0);
+      }
+      control_->magic.store(kMagic, std::memory_order_release);
+    } else {
+      wait_until_initialized();
+      if (control_->element_size != sizeof(BufferT)) {
+        detach();
+        throw std::invalid_argument(
+                "element size of segment " + shm_name_ + " does not match the element type");
+      }
+      if (control_->capacity != capacity_) {
+        detach();
+        throw std::invalid_argument(
+                "capacity of segment " + shm_name_ + " does not match the requested capacity");
+      }
+    }
+    control_->attached.fetch_add(1, std::memory_order_acq_rel);
+#endif
+  }
+
+  virtual ~ShmRingBufferImplementation()
+  {
+    detach();
+  }
+
+  /// Add a new element to store in the ring buffer
+  /**
+   * May only be called by the single producing thread, process-wide.
+   * If the buffer is full the oldest element is dropped.
+   *
+   * \param request the element to be stored in the ring buffer
+   */
+  void enqueue(BufferT request)
+  {
+    uint64_t write_pos = control_->write_pos.load(std::memory_order_relaxed);
+    uint64_t read_pos = control_->read_pos.load(std::memory_order_acquire);
+
+    if (write_pos - read_pos == capacity_) {
+      // Full: drop the oldest element by advancing the read position, as in
+      // SpscRingBufferImplementation. A failed exchange means the consumer
+      // process freed the slot first.
+      if (control_->read_pos.compare_exchange_strong(
+          read_pos, read_pos + 1,
+          std::memory_order_acq_rel, std::memory_order_acquire))
+      {
+        control_->overwrite_count.fetch_add(1, std::memory_order_relaxed);
+        if (overwrite_counter_) {
+          overwrite_counter_->fetch_add(1, std::memory_order_relaxed);
+        }
+      }
+    }
+
+    Slot & slot = slots_[write_pos % capacity_];
+    slot.sequence.store(write_pos, std::memory_order_release);
+    std::memcpy(slot.element, &request, sizeof(BufferT));
+    slot.sequence.store(write_pos + 1, std::memory_order_release);
+
+    control_->write_pos.store(write_pos + 1, std::memory_order_release);
+  }
+
+  /// Remove the oldest element from ring buffer
+  /**
+   * May only be called by the single consuming thread, process-wide.
+   *
+   * \return the element that is being removed from the ring buffer
+   */
+  BufferT dequeue()
+  {
+    while (true) {
+      uint64_t read_pos = control_->read_pos.load(std::memory_order_relaxed);
+      uint64_t write_pos = control_->write_pos.load(std::memory_order_acquire);
+      if (read_pos == write_pos) {
+        return BufferT();
+      }
+
+      Slot & slot = slots_[read_pos % capacity_];
+      if (slot.sequence.load(std::memory_order_acquire) != read_pos + 1) {
+        // The producer is overwriting this slot right now; it has already
+        // advanced the read position, reload and try the next element.
+        continue;
+      }
+      BufferT element;
+      std::memcpy(&element, slot.element, sizeof(BufferT));
+      if (slot.sequence.load(std::memory_order_acquire) != read_pos + 1) {
+        // The producer wrapped around and clobbered the slot mid-copy;
+        // discard and retry with the advanced read position.
+        continue;
+      }
+      if (control_->read_pos.compare_exchange_strong(
+          read_pos, read_pos + 1,
+          std::memory_order_acq_rel, std::memory_order_acquire))
+      {
+        return element;
+      }
+      // The producer dropped this element as oldest while we were reading it;
+      // discard our copy and retry.
+    }
+  }
+
+  /// Get if the ring buffer has at least one element stored
+  /**
+   * Thread safe, the result is a snapshot.
+   *
+   * \return `true` if there is data and `false` otherwise
+   */
+  inline bool has_data() const
+  {
+    return control_->read_pos.load(std::memory_order_acquire) !=
+           control_->write_pos.load(std::memory_order_acquire);
+  }
+
+  /// Get the remaining capacity to store messages
+  /**
+   * Thread safe, the result is a snapshot.
+   *
+   * \return the number of free capacity for new messages
+   */
+  size_t available_capacity() const
+  {
+    uint64_t used = control_->write_pos.load(std::memory_order_acquire) -
+      control_->read_pos.load(std::memory_order_acquire);
+    return used >= capacity_ ? 0u : capacity_ - static_cast<size_t>(used);
+  }
+
+  void clear()
+  {
+  }
+
+  /// Set the counter to increment when an enqueue overwrites unread data.
+  /**
+   * The counter only observes overwrites performed by this side; the segment
+   * additionally keeps a shared total in overwrite_count().
+   */
+  void set_overwrite_counter(std::shared_ptr<std::atomic<uint64_t>> counter) override
+  {
+    overwrite_counter_ = std::move(counter);
+  }
+
+  /// Get the number of elements overwritten unread, across both processes.
+  uint64_t overwrite_count() const
+  {
+    return control_->overwrite_count.load(std::memory_order_relaxed);
+  }
+
+  /// Get the number of buffers currently attached to the segment.
+  uint64_t attached_count() const
+  {
+    return control_->attached.load(std::memory_order_acquire);
+  }
+
+private:
+  static constexpr uint64_t kMagic = 0x72636c6370705348ull;  // "rclcppSH"
+
+  // Shared state at the start of the segment; the slots follow it. The
+  // producer and consumer positions sit on separate cache lines so the two
+  // processes do not false-share.
+  struct ControlBlock
+  {
+    std::atomic<uint64_t> magic{0};
+    uint64_t element_size{0};
+    uint64_t capacity{0};
+    std::atomic<uint64_t> overwrite_count{0};
+    std::atomic<uint64_t> attached{0};
+    alignas(64) std::atomic<uint64_t> write_pos{0};
+    alignas(64) std::atomic<uint64_t> read_pos{0};
+  };
+
+  struct Slot
+  {
+    // Holds position + 1 once the element at that position is published.
+    std::atomic<uint64_t> sequence;
+    alignas(alignof(BufferT)) unsigned char element[sizeof(BufferT)];
+  };
+
+#if !defined(_WIN32)
+  void wait_for_segment_size(int fd, size_t segment_size) const
+  {
+    auto deadline = std::chrono::steady_clock::now() + kAttachTimeout;
+    while (true) {
+      struct stat segment_stat;
+      if (fstat(fd, &segment_stat) != 0) {
+        close(fd);
+        throw std::runtime_error("failed to stat shared memory segment " + shm_name_);
+      }
+      if (static_cast<size_t>(segment_stat.st_size) >= segment_size) {
+        return;
+      }
+      if (std::chrono::steady_clock::now() >= deadline) {
+        close(fd);
+        throw std::runtime_error(
+                "timed out waiting for the creator to size segment " + shm_name_);
+      }
+      std::this_thread::yield();
+    }
+  }
+
+  void wait_until_initialized()
+  {
+    auto deadline = std::chrono::steady_clock::now() + kAttachTimeout;
+    while (control_->magic.load(std::memory_order_acquire) != kMagic) {
+      if (std::chrono::steady_clock::now() >= deadline) {
+        detach();
+        throw std::runtime_error(
+                "timed out waiting for the creator to initialize segment " + shm_name_);
+      }
+      std::this_thread::yield();
+    }
+  }
+#endif
+
+  void detach()
+  {
+#if !defined(_WIN32)
+    if (nullptr == base_) {
+      return;
+    }
+    // The last buffer to detach unlinks the name so it does not leak; a
+    // process attaching concurrently with the last detach has to recreate.
+    if (control_->attached.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      shm_unlink(shm_name_.c_str());
+    }
+    munmap(base_, segment_size_);
+    base_ = nullptr;
+    control_ = nullptr;
+    slots_ = nullptr;
+#endif
+  }
+
+  static constexpr std::chrono::seconds kAttachTimeout{5};
+
+  const size_t capacity_;
+  std::string shm_name_;
+  void * base_ = nullptr;
+  size_t segment_size_ = 0;
+  ControlBlock * control_ = nullptr;
+  Slot * slots_ = nullptr;
+
+  std::shared_ptr<std::atomic<uint64_t>> overwrite_counter_;
+};
+
+}  // namespace buffers
+}  // namespace experimental
+}  // namespace rclcpp
+
+#endif  // RCLCPP__EXPERIMENTAL__BUFFERS__SHM_RING_BUFFER_IMPLEMENTATION_HPP_
@@ -0,0 +1,226 @@
+// Copyright 2024 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__EXPERIMENTAL__BUFFERS__SPSC_RING_BUFFER_IMPLEMENTATION_HPP_
+#define RCLCPP__EXPERIMENTAL__BUFFERS__SPSC_RING_BUFFER_IMPLEMENTATION_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "rclcpp/experimental/buffers/buffer_implementation_base.hpp"
+#include "rclcpp/intra_process_buffer_full_policy.hpp"
+#include "rclcpp/is_trivially_relocatable.hpp"
+#include "rclcpp/macros.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+namespace experimental
+{
+namespace buffers
+{
+
+/// Store elements in a fixed-size, FIFO buffer without locking.
+/**
+ * Single-producer single-consumer variant of RingBufferImplementation:
+ * exactly one thread may call enqueue() and exactly one thread may call
+ * dequeue(). This matches the common intra-process case of one publisher
+ * thread and one executor thread, and removes the two mutex operations per
+ * message that the generic ring buffer pays.
+ *
+ * The read and write indices live on separate cache lines so the producer and
+ * consumer do not false-share. Like RingBufferImplementation, enqueue() on a
+ * full buffer drops the oldest element (keep-last semantics); the producer
+ * drops it by advancing the read index with a compare-exchange, and the
+ * consumer detects a concurrent drop through per-slot sequence numbers and
+ * retries.
+ */
+template<typename BufferT>
+class SpscRingBufferImplementation : public BufferImplementationBase<BufferT>
+{
+public:
+  explicit SpscRingBufferImplementation(size_t capacity)
+  : capacity_(capacity),
+    slots_(capacity)
+  {
+    if (capacity == 0) {
+      throw std::invalid_argument("capacity must be a positive, non-zero value");
+    }
+    for (size_t i = 0; i < capacity; i++) {
+      slots_[i].sequence.store(0, std::memory_order_relaxed);
+    }
+    write_pos_.store(0, std::memory_order_relaxed);
+    read_pos_.store(0, std::memory_order_relaxed);
+  }
+
+  virtual ~SpscRingBufferImplementation() {}
+
+  /// Add a new element to store in the ring buffer
+  /**
+   * May only be called from the single producer thread.
+   * If the buffer is full the oldest element is dropped.
+   *
+   * \param request the element to be stored in the ring buffer
+   */
+  void enqueue(BufferT request)
+  {
+    size_t write_pos = write_pos_.load(std::memory_order_relaxed);
+    size_t read_pos = read_pos_.load(std::memory_order_acquire);
+
+    if (write_pos - read_pos == capacity_) {
+      // Full: drop the oldest element by advancing the read position.
+      // If the consumer grabs it first the exchange fails, which is fine,
+      // a slot has been freed either way.
+      if (read_pos_.compare_exchange_strong(
+          read_pos, read_pos + 1,
+          std::memory_order_acq_rel, std::memory_order_acquire) &&
+        overwrite_counter_)
+      {
+        overwrite_counter_->fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+
+    Slot & slot = slots_[write_pos % capacity_];
+    // Mark the slot as being written so a consumer that raced past the
+    // dropped read position discards what it read.
+    slot.sequence.store(write_pos, std::memory_order_release);
+    rclcpp::detail::relocate_into(std::move(request), slot.element);
+    slot.sequence.store(write_pos + 1, std::memory_order_release);
+
+    write_pos_.store(write_pos + 1, std::memory_order_release);
+  }
+
+  /// Remove the oldest element from ring buffer
+  /**
+   * May only be called from the single consumer thread.
+   *
+   * \return the element that is being removed from the ring buffer
+   */
+  BufferT dequeue()
+  {
+    while (true) {
+      size_t read_pos = read_pos_.load(std::memory_order_relaxed);
+      size_t write_pos = write_pos_.load(std::memory_order_acquire);
+      if (read_pos == write_pos) {
+        return BufferT();
+      }
+
+      Slot & slot = slots_[read_pos % capacity_];
+      if (slot.sequence.load(std::memory_order_acquire) != read_pos + 1) {
+        // The producer is overwriting this slot right now; it has already
+        // advanced the read position, reload and try the next element.
+        continue;
+      }
+      BufferT element;
+      rclcpp::detail::relocate_into(std::move(slot.element), element);
+      if (slot.sequence.load(std::memory_order_acquire) != read_pos + 1) {
+        // The producer wrapped around and clobbered the slot mid-move;
+        // discard and retry with the advanced read position.
+        continue;
+      }
+      if (read_pos_.compare_exchange_strong(
+          read_pos, read_pos + 1,
+          std::memory_order_acq_rel, std::memory_order_acquire))
+      {
+        return element;
+      }
+      // The producer dropped this element as oldest while we were reading it;
+      // discard our copy and retry.
+    }
+  }
+
+  /// Get if the ring buffer has at least one element stored
+  /**
+   * Thread safe, the result is a snapshot.
+   *
+   * \return `true` if there is data and `false` otherwise
+   */
+  inline bool has_data() const
+  {
+    return read_pos_.load(std::memory_order_acquire) !=
+           write_pos_.load(std::memory_order_acquire);
+  }
+
+  /// Get the remaining capacity to store messages
+  /**
+   * Thread safe, the result is a snapshot.
+   *
+   * \return the number of free capacity for new messages
+   */
+  size_t available_capacity() const
+  {
+    size_t used = write_pos_.load(std::memory_order_acquire) -
+      read_pos_.load(std::memory_order_acquire);
+    return used >= capacity_ ? 0u : capacity_ - used;
+  }
+
+  void clear()
+  {
+  }
+
+  /// Set the counter to increment when an enqueue overwrites unread data.
+  void set_overwrite_counter(std::shared_ptr<std::atomic<uint64_t>> counter) override
+  {
+    overwrite_counter_ = std::move(counter);
+  }
+
+  /// Set the behavior for enqueue() on a full buffer.
+  /**
+   * Only IntraProcessBufferFullPolicy::OverwriteOldest is supported: the
+   * lock-free producer cannot block, and dropping the incoming element would
+   * need the consumer-side coordination this buffer exists to avoid.
+   *
+   * \throws std::invalid_argument for any other policy, so a configuration
+   *   this buffer cannot honor fails at setup instead of being silently
+   *   downgraded.
+   */
+  void set_full_policy(
+    rclcpp::IntraProcessBufferFullPolicy policy, std::chrono::nanoseconds timeout) override
+  {
+    (void)timeout;
+    if (policy != rclcpp::IntraProcessBufferFullPolicy::OverwriteOldest) {
+      throw std::invalid_argument(
+              "SpscRingBufferImplementation only supports the overwrite-oldest full policy");
+    }
+  }
+
+private:
+  struct Slot
+  {
+    BufferT element;
+    // Holds position + 1 once the element at that position is published.
+    std::atomic<size_t> sequence;
+  };
+
+  const size_t capacity_;
+  std::vector<Slot> slots_;
+
+  std::shared_ptr<std::atomic<uint64_t>> overwrite_counter_;
+
+  // Producer and consumer positions are monotonic and mapped onto the ring
+  // by modulo; they sit on separate cache lines to avoid false sharing.
+  alignas(64) std::atomic<size_t> write_pos_;
+  alignas(64) std::atomic<size_t> read_pos_;
+};
+
+}  // namespace buffers
+}  // namespace experimental
+}  // namespace rclcpp
+
+#endif  // RCLCPP__EXPERIMENTAL__BUFFERS__SPSC_RING_BUFFER_IMPLEMENTATION_HPP_
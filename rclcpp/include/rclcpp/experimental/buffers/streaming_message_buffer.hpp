@@ -0,0 +1,204 @@
+// Copyright 2024 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__EXPERIMENTAL__BUFFERS__STREAMING_MESSAGE_BUFFER_HPP_
+#define RCLCPP__EXPERIMENTAL__BUFFERS__STREAMING_MESSAGE_BUFFER_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+#include "rclcpp/macros.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+namespace experimental
+{
+namespace buffers
+{
+
+/// Hand a message from producer to consumer progressively, in chunks.
+/**
+ * A large intra-process message is normally only visible to the consumer once
+ * the producer has finished building all of it. This buffer lets one producer
+ * thread expose a message while it is still being filled: the producer calls
+ * begin() with the message, then commit() after each chunk of payload it has
+ * written, and finally finish(). One consumer thread polls (or is notified
+ * through the on-commit callback) and may already process the committed
+ * prefix of the payload while later chunks are still being produced,
+ * overlapping the two sides instead of serializing them.
+ *
+ * The committed amount is an opaque, monotonically growing count chosen by
+ * the producer, typically bytes or points written. Commits publish with
+ * release ordering and committed() reads with acquire ordering, so everything
+ * the producer wrote into the message before a commit is visible to a
+ * consumer which observed that commit. The consumer must never touch the
+ * message beyond the committed count, and the producer must never rewrite
+ * anything it has already committed.
+ *
+ * Exactly one thread may produce and exactly one thread may consume, like
+ * SpscRingBufferImplementation. Unlike the ring buffers this holds a single
+ * in-flight message: begin() while a previous message has not been taken
+ * replaces it, dropping the unconsumed remainder (keep-last semantics).
+ */
+template<typename MessageT>
+class StreamingMessageBuffer
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS_NOT_COPYABLE(StreamingMessageBuffer)
+
+  StreamingMessageBuffer() = default;
+
+  ~StreamingMessageBuffer() = default;
+
+  /// Start streaming a new message, may only be called by the producer.
+  /**
+   * The producer keeps its own non-const reference for filling the payload;
+   * the buffer and the consumer only see the message as const.
+   * Replaces any previous message which was not taken yet.
+   *
+   * \param[in] message The message being built, must not be nullptr.
+   * \throws std::invalid_argument if message is nullptr.
+   */
+  void
+  begin(std::shared_ptr<const MessageT> message)
+  {
+    if (nullptr == message) {
+      throw std::invalid_argument("message is nullptr");
+    }
+    {
+      std::lock_guard<std::mutex> lock(message_mutex_);
+      message_ = std::move(message);
+    }
+    committed_.store(0u, std::memory_order_relaxed);
+    // The generation is odd while streaming and even once finished; moving
+    // to the next odd value makes the new message visible either way, also
+    // when the previous one was replaced before being finished.
+    uint64_t generation = generation_.load(std::memory_order_relaxed);
+    generation_.store(
+      generation + (0u == generation % 2u ? 1u : 2u), std::memory_order_release);
+  }
+
+  /// Publish producer progress, may only be called by the producer.
+  /**
+   * Everything written into the message before this call is visible to a
+   * consumer which reads an equal or greater value from committed().
+   *
+   * \param[in] committed Total amount committed so far; must not shrink.
+   */
+  void
+  commit(size_t committed)
+  {
+    committed_.store(committed, std::memory_order_release);
+    if (on_commit_callback_) {
+      on_commit_callback_(committed);
+    }
+  }
+
+  /// Mark the in-flight message as complete, may only be called by the producer.
+  void
+  finish()
+  {
+    uint64_t generation = generation_.load(std::memory_order_relaxed);
+    if (0u == generation % 2u) {
+      return;  // nothing is streaming
+    }
+    generation_.store(generation + 1u, std::memory_order_release);
+    if (on_commit_callback_) {
+      on_commit_callback_(committed_.load(std::memory_order_relaxed));
+    }
+  }
+
+  /// Get the message currently being streamed, or nullptr if there is none.
+  /**
+   * May be called by the consumer at any point after begin(); only the
+   * committed() prefix of the payload may be read.
+   */
+  std::shared_ptr<const MessageT>
+  current() const
+  {
+    std::lock_guard<std::mutex> lock(message_mutex_);
+    return message_;
+  }
+
+  /// Get the amount committed so far, pairs with commit().
+  size_t
+  committed() const
+  {
+    return committed_.load(std::memory_order_acquire);
+  }
+
+  /// Get whether the in-flight message has been finished by the producer.
+  bool
+  complete() const
+  {
+    uint64_t generation = generation_.load(std::memory_order_acquire);
+    return generation != 0u && 0u == generation % 2u;
+  }
+
+  /// Take the finished message, may only be called by the consumer.
+  /**
+   * \return the message if the producer has finished it, nullptr otherwise.
+   */
+  std::shared_ptr<const MessageT>
+  take_complete()
+  {
+    if (!this->complete()) {
+      return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(message_mutex_);
+    return std::move(message_);
+  }
+
+  /// Set a callback invoked, on the producer thread, after every commit.
+  /**
+   * Meant for waking the consumer, e.g. by triggering a guard condition;
+   * it receives the committed amount. Set it before streaming starts, this
+   * is not synchronized against a concurrent commit().
+   *
+   * \param[in] callback The callback, nullptr to remove it.
+   */
+  void
+  set_on_commit_callback(std::function<void (size_t)> callback)
+  {
+    on_commit_callback_ = std::move(callback);
+  }
+
+private:
+  RCLCPP_DISABLE_COPY(StreamingMessageBuffer)
+
+  /// Message in flight, guarded only for the pointer swap itself.
+  mutable std::mutex message_mutex_;
+  std::shared_ptr<const MessageT> message_;
+
+  /// Total amount committed by the producer, see commit().
+  std::atomic<size_t> committed_ {0u};
+
+  /// Odd while a message is streaming, even after finish(), 0 initially.
+  std::atomic<uint64_t> generation_ {0u};
+
+  std::function<void (size_t)> on_commit_callback_;
+};
+
+}  // namespace buffers
+}  // namespace experimental
+}  // namespace rclcpp
+
+#endif  // RCLCPP__EXPERIMENTAL__BUFFERS__STREAMING_MESSAGE_BUFFER_HPP_
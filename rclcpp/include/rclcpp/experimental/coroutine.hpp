@@ -0,0 +1,234 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__EXPERIMENTAL__COROUTINE_HPP_
+#define RCLCPP__EXPERIMENTAL__COROUTINE_HPP_
+
+#include <version>
+
+#if !defined(__cpp_impl_coroutine) || !defined(__cpp_lib_coroutine)
+#error "rclcpp/experimental/coroutine.hpp requires C++20 coroutine support"
+#endif
+
+#include <chrono>
+#include <coroutine>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "rclcpp/client.hpp"
+#include "rclcpp/node.hpp"
+#include "rclcpp/qos.hpp"
+#include "rclcpp/subscription.hpp"
+#include "rclcpp/timer.hpp"
+
+namespace rclcpp
+{
+namespace experimental
+{
+
+/// Fire-and-forget coroutine task driven by the owning executor.
+/**
+ * A function returning CoroTask can `co_await` the awaitables in this header,
+ * e.g. from inside a service handler using the deferred-response callback
+ * signature. While the coroutine is suspended it occupies no thread: the
+ * continuation is stored in the awaited entity's callback, so the resumption
+ * runs inside Executor::execute_any_executable() when that entity becomes
+ * ready, on whichever executor the entity was added to.
+ *
+ * The coroutine starts eagerly and destroys its frame when it runs to
+ * completion. Exceptions escaping the coroutine propagate out of the
+ * resuming callback, i.e. they surface through the executor like exceptions
+ * thrown by any other callback.
+ *
+ * Only available when rclcpp is compiled as C++20 or newer.
+ */
+class CoroTask
+{
+public:
+  struct promise_type
+  {
+    CoroTask get_return_object() noexcept {return CoroTask();}
+    std::suspend_never initial_suspend() noexcept {return {};}
+    std::suspend_never final_suspend() noexcept {return {};}
+    void return_void() noexcept {}
+    void unhandled_exception() {throw;}
+  };
+};
+
+/// Awaitable for a service response, see async_await_response().
+template<typename ServiceT>
+class ClientResponseAwaitable
+{
+public:
+  ClientResponseAwaitable(
+    std::shared_ptr<rclcpp::Client<ServiceT>> client,
+    typename rclcpp::Client<ServiceT>::SharedRequest request)
+  : client_(std::move(client)), request_(std::move(request))
+  {}
+
+  bool await_ready() const noexcept {return false;}
+
+  void await_suspend(std::coroutine_handle<> handle)
+  {
+    client_->async_send_request(
+      request_,
+      [this, handle](typename rclcpp::Client<ServiceT>::SharedFuture future) {
+        response_ = future.get();
+        handle.resume();
+      });
+  }
+
+  typename rclcpp::Client<ServiceT>::SharedResponse await_resume()
+  {
+    return response_;
+  }
+
+private:
+  std::shared_ptr<rclcpp::Client<ServiceT>> client_;
+  typename rclcpp::Client<ServiceT>::SharedRequest request_;
+  typename rclcpp::Client<ServiceT>::SharedResponse response_;
+};
+
+/// `co_await` a service response without blocking an executor thread.
+/**
+ * The request is sent when the coroutine suspends and the coroutine is
+ * resumed by the client's response callback, with the response as the value
+ * of the `co_await` expression.
+ *
+ * \param client the client to send the request with, must outlive the await.
+ * \param request the request to send.
+ * \return awaitable yielding the shared response.
+ */
+template<typename ServiceT>
+ClientResponseAwaitable<ServiceT>
+async_await_response(
+  std::shared_ptr<rclcpp::Client<ServiceT>> client,
+  typename rclcpp::Client<ServiceT>::SharedRequest request)
+{
+  return ClientResponseAwaitable<ServiceT>(std::move(client), std::move(request));
+}
+
+/// Awaitable for a timer expiration, see async_sleep_for().
+class SleepAwaitable
+{
+public:
+  SleepAwaitable(rclcpp::Node::SharedPtr node, std::chrono::nanoseconds duration)
+  : node_(std::move(node)), duration_(duration)
+  {}
+
+  bool await_ready() const noexcept
+  {
+    return duration_ <= std::chrono::nanoseconds::zero();
+  }
+
+  void await_suspend(std::coroutine_handle<> handle)
+  {
+    timer_ = node_->create_wall_timer(
+      duration_,
+      [this, handle]() {
+        // One-shot: stop the timer before resuming, and touch no members
+        // afterwards as resuming may destroy this awaitable.
+        timer_->cancel();
+        handle.resume();
+      });
+  }
+
+  void await_resume() const noexcept {}
+
+private:
+  rclcpp::Node::SharedPtr node_;
+  std::chrono::nanoseconds duration_;
+  rclcpp::TimerBase::SharedPtr timer_;
+};
+
+/// `co_await` a wall-clock delay without blocking an executor thread.
+/**
+ * \param node the node to create the one-shot timer on.
+ * \param duration how long to suspend for, non-positive values do not suspend.
+ * \return awaitable completing after the duration elapsed.
+ */
+inline SleepAwaitable
+async_sleep_for(rclcpp::Node::SharedPtr node, std::chrono::nanoseconds duration)
+{
+  return SleepAwaitable(std::move(node), duration);
+}
+
+/// Awaitable for the next message on a topic, see async_await_message().
+template<typename MessageT>
+class MessageAwaitable
+{
+public:
+  MessageAwaitable(
+    rclcpp::Node::SharedPtr node,
+    const std::string & topic_name,
+    const rclcpp::QoS & qos)
+  : node_(std::move(node)), topic_name_(topic_name), qos_(qos)
+  {}
+
+  bool await_ready() const noexcept {return false;}
+
+  void await_suspend(std::coroutine_handle<> handle)
+  {
+    subscription_ = node_->template create_subscription<MessageT>(
+      topic_name_, qos_,
+      [this, handle](std::shared_ptr<const MessageT> message) {
+        if (message_) {
+          // More than one message was ready in this activation, only the
+          // first one resumes the coroutine.
+          return;
+        }
+        message_ = std::move(message);
+        handle.resume();
+      });
+  }
+
+  std::shared_ptr<const MessageT> await_resume()
+  {
+    return message_;
+  }
+
+private:
+  rclcpp::Node::SharedPtr node_;
+  std::string topic_name_;
+  rclcpp::QoS qos_;
+  std::shared_ptr<rclcpp::Subscription<MessageT>> subscription_;
+  std::shared_ptr<const MessageT> message_;
+};
+
+/// `co_await` the next message on a topic without blocking an executor thread.
+/**
+ * A subscription is created when the coroutine suspends and destroyed when
+ * the `co_await` expression completes, so only messages published while
+ * suspended can fulfill it.
+ *
+ * \param node the node to create the subscription on.
+ * \param topic_name the topic to await a message from.
+ * \param qos QoS profile for the subscription.
+ * \return awaitable yielding the first received message.
+ */
+template<typename MessageT>
+MessageAwaitable<MessageT>
+async_await_message(
+  rclcpp::Node::SharedPtr node,
+  const std::string & topic_name,
+  const rclcpp::QoS & qos = rclcpp::QoS(10))
+{
+  return MessageAwaitable<MessageT>(std::move(node), topic_name, qos);
+}
+
+}  // namespace experimental
+}  // namespace rclcpp
+
+#endif  // RCLCPP__EXPERIMENTAL__COROUTINE_HPP_
@@ -17,7 +17,11 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "rclcpp/executor.hpp"
@@ -70,13 +74,25 @@ public:
    * \param[in] execute_timers_separate_thread If true, timers are executed in a separate
    * thread. If false, timers are executed in the same thread as all other entities.
    * \param[in] options Options used to configure the executor.
+   * \param[in] timers_storage The storage backend used by the timers manager. The default
+   * binary heap is the best choice for few timers; the timer wheel scales better with
+   * large numbers of short-period timers, see `TimersManager::TimersStorage`.
+   * \param[in] execute_timers_inline If true, the timers manager thread is not started at
+   * all during `spin()`: the spin loop itself computes the next timer deadline, uses it as
+   * the dequeue timeout and executes expired timers in place, like `spin_once()` does.
+   * This removes the cross-thread wakeup and enqueue per timer expiration, at the cost
+   * that a timer reset from another thread only takes effect at the next wakeup.
+   * Mutually exclusive with `execute_timers_separate_thread`.
    */
   RCLCPP_PUBLIC
   explicit EventsExecutor(
     rclcpp::experimental::executors::EventsQueue::UniquePtr events_queue = std::make_unique<
       rclcpp::experimental::executors::SimpleEventsQueue>(),
     bool execute_timers_separate_thread = false,
-    const rclcpp::ExecutorOptions & options = rclcpp::ExecutorOptions());
+    const rclcpp::ExecutorOptions & options = rclcpp::ExecutorOptions(),
+    rclcpp::experimental::TimersManager::TimersStorage timers_storage =
+    rclcpp::experimental::TimersManager::TimersStorage::HEAP,
+    bool execute_timers_inline = false);
 
   /// Default destructor.
   RCLCPP_PUBLIC
@@ -128,6 +144,53 @@ public:
   void
   spin_all(std::chrono::nanoseconds max_duration) override;
 
+  /// Return a pollable file descriptor signaling pending executor work.
+  /**
+   * The descriptor becomes readable whenever an event is pushed into the
+   * events queue, letting external event loops (epoll, poll, Qt, libuv)
+   * drive this executor natively instead of bridging it through a thread
+   * that spins it: register the descriptor for readability and call
+   * process_ready() when it fires. No thread monitors timers in this mode,
+   * so use time_until_next_timer() as the poll timeout and call
+   * process_ready() on timeout expiry as well.
+   *
+   * The descriptor is created on the first call and owned by the executor;
+   * do not read from or close it, process_ready() drains it.
+   *
+   * \return the file descriptor to poll for readability.
+   * \throws std::runtime_error on platforms without pipes, or if the pipe
+   *   cannot be created.
+   */
+  RCLCPP_PUBLIC
+  int
+  get_wakeup_fd();
+
+  /// Execute ready events and expired timers without blocking.
+  /**
+   * Drains the wakeup descriptor, then executes events until the queue is
+   * empty and finally all expired timers. Events pushed concurrently make
+   * the descriptor readable again, so an external loop picks them up on
+   * its next iteration even if this call missed them.
+   *
+   * \return the number of events and timers executed.
+   * \throws std::runtime_error if called while the executor is spinning.
+   */
+  RCLCPP_PUBLIC
+  size_t
+  process_ready();
+
+  /// Return how long until the next tracked timer expires.
+  /**
+   * External event loops use this as their poll timeout so that timers
+   * fire on time, see get_wakeup_fd().
+   *
+   * \return the time until the next timer expires, or
+   *   std::chrono::nanoseconds::max() if there is no tracked timer.
+   */
+  RCLCPP_PUBLIC
+  std::chrono::nanoseconds
+  time_until_next_timer();
+
   /// Add a node to the executor.
   /**
    * \sa rclcpp::Executor::add_node
@@ -227,6 +290,18 @@ private:
   void
   execute_event(const ExecutorEvent & event);
 
+  /// Enqueue an event, signaling the wakeup descriptor when enabled.
+  void
+  enqueue_event(const ExecutorEvent & event);
+
+  /// Make the wakeup descriptor readable, see get_wakeup_fd().
+  void
+  signal_wakeup_fd();
+
+  /// Consume everything pending on the wakeup descriptor.
+  void
+  drain_wakeup_fd();
+
   /// Collect entities from callback groups and refresh the current collection with them
   void
   refresh_current_collection_from_callback_groups();
@@ -236,12 +311,28 @@ private:
   refresh_current_collection(const rclcpp::executors::ExecutorEntitiesCollection & new_collection);
 
   /// Create a listener callback function for the provided entity
+  /**
+   * The entity is registered in the entity slab and the produced events carry
+   * its slab id, so dispatch resolves it without a key lookup.
+   */
   std::function<void(size_t)>
-  create_entity_callback(void * entity_key, ExecutorEventType type);
+  create_entity_callback(
+    void * entity_key, std::weak_ptr<void> entity, ExecutorEventType type);
 
   /// Create a listener callback function for the provided waitable entity
+  /**
+   * \sa create_entity_callback
+   */
   std::function<void(size_t, int)>
-  create_waitable_callback(const rclcpp::Waitable * waitable_id);
+  create_waitable_callback(const rclcpp::Waitable * waitable_id, std::weak_ptr<void> entity);
+
+  /// Register an entity in the slab, returning its slab id and generation.
+  std::pair<uint32_t, uint32_t>
+  slab_register(const void * entity_key, std::weak_ptr<void> entity);
+
+  /// Release an entity's slab slot, invalidating events still carrying its id.
+  void
+  slab_unregister(const void * entity_key);
 
   /// Utility to add the notify waitable to an entities collection
   void
@@ -270,6 +361,30 @@ private:
     return entity;
   }
 
+  /// Resolve an event to its entity, preferring the dense slab over key lookup
+  /**
+   * Events carrying a slab id are resolved with an array index plus a
+   * generation check, independent of the entity count; a stale generation
+   * means the entity was removed after the event was queued. Events without
+   * a slab id fall back to retrieve_entity().
+   * The caller must hold collection_mutex_.
+   */
+  template<typename EntityT, typename CollectionType>
+  std::shared_ptr<EntityT>
+  retrieve_event_entity(const ExecutorEvent & event, CollectionType & collection)
+  {
+    if (0 != event.entity_generation) {
+      if (event.entity_id < entity_slab_.size() &&
+        entity_slab_[event.entity_id].generation == event.entity_generation)
+      {
+        return std::static_pointer_cast<EntityT>(entity_slab_[event.entity_id].entity.lock());
+      }
+      return nullptr;
+    }
+    return this->retrieve_entity(
+      static_cast<typename CollectionType::Key>(event.entity_key), collection);
+  }
+
   /// Queue where entities can push events
   rclcpp::experimental::executors::EventsQueue::UniquePtr events_queue_;
 
@@ -280,11 +395,49 @@ private:
   std::recursive_mutex collection_mutex_;
   std::shared_ptr<rclcpp::executors::ExecutorEntitiesCollection> current_entities_collection_;
 
+  /// Per-group snapshots reused across collection rebuilds, so that only
+  /// callback groups whose membership changed are walked again.
+  /// Only accessed while holding collection_mutex_.
+  rclcpp::executors::GroupEntitiesCache collection_build_cache_;
+
+  /// One slab slot per registered entity, indexed by the slab id events carry.
+  struct EntitySlot
+  {
+    std::weak_ptr<void> entity;
+    // Incremented whenever the slot is (re)assigned or released, so queued
+    // events referring to a previous occupant resolve to nothing; 0 is
+    // reserved to mean "event carries no slab id".
+    uint32_t generation {0};
+  };
+
+  /// Dense entity slab; only accessed while holding collection_mutex_.
+  std::vector<EntitySlot> entity_slab_;
+
+  /// Released slab ids available for reuse; only accessed while holding collection_mutex_.
+  std::vector<uint32_t> free_slots_;
+
+  /// Maps entity keys to slab ids, used only when (un)registering entities.
+  /// Only accessed while holding collection_mutex_.
+  std::unordered_map<const void *, uint32_t> slab_index_;
+
   /// Flag used to reduce the number of unnecessary waitable events
   std::atomic<bool> notify_waitable_event_pushed_ {false};
 
   /// Timers manager used to track and/or execute associated timers
   std::shared_ptr<rclcpp::experimental::TimersManager> timers_manager_;
+
+  /// Whether spin() drives the timers itself instead of starting the timers thread
+  bool inline_timers_ {false};
+
+  /// Guards the lazy creation of the wakeup pipe.
+  std::mutex wakeup_fd_mutex_;
+
+  /// Read end of the wakeup pipe, -1 until get_wakeup_fd() is called.
+  int wakeup_read_fd_ {-1};
+
+  /// Write end of the wakeup pipe; atomic so the enqueue paths can check
+  /// whether signaling is enabled with a single relaxed-cost load.
+  std::atomic<int> wakeup_write_fd_ {-1};
 };
 
 }  // namespace executors
@@ -15,6 +15,9 @@
 #ifndef RCLCPP__EXPERIMENTAL__EXECUTORS__EVENTS_EXECUTOR__EVENTS_EXECUTOR_EVENT_TYPES_HPP_
 #define RCLCPP__EXPERIMENTAL__EXECUTORS__EVENTS_EXECUTOR__EVENTS_EXECUTOR_EVENT_TYPES_HPP_
 
+#include <cstddef>
+#include <cstdint>
+
 namespace rclcpp
 {
 namespace experimental
@@ -37,6 +40,13 @@ struct ExecutorEvent
   int waitable_data;
   ExecutorEventType type;
   size_t num_events;
+  // Dense slab id assigned by the executor when the entity's listener
+  // callback is created; dispatch resolves it with an array index and a
+  // generation check instead of a key lookup in the entities collection.
+  // A generation of 0 means the event carries no slab id and the entity is
+  // resolved by entity_key lookup instead.
+  uint32_t entity_id = 0;
+  uint32_t entity_generation = 0;
 };
 
 }  // namespace executors
@@ -0,0 +1,237 @@
+// Copyright 2023 iRobot Corporation.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__EXPERIMENTAL__EXECUTORS__EVENTS_EXECUTOR__LOCK_FREE_EVENTS_QUEUE_HPP_
+#define RCLCPP__EXPERIMENTAL__EXECUTORS__EVENTS_EXECUTOR__LOCK_FREE_EVENTS_QUEUE_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "rclcpp/experimental/executors/events_executor/events_queue.hpp"
+
+namespace rclcpp
+{
+namespace experimental
+{
+namespace executors
+{
+
+/**
+ * @brief This class implements an EventsQueue as a bounded lock-free
+ * multi-producer single-consumer ring buffer.
+ * Producers (e.g. rmw listener callbacks) enqueue events without taking any mutex,
+ * claiming ring slots via an atomic ticket counter; the single consumer
+ * (the executor spin thread) pops events and parks on a condition variable only
+ * when the ring is observed empty, so the steady-state hot path is wait-free
+ * for producers and lock-free for the consumer.
+ * If the ring is full, enqueue falls back to blocking until the consumer
+ * frees a slot, preserving the "no events are ever dropped" guarantee of
+ * the SimpleEventsQueue.
+ */
+class LockFreeEventsQueue : public EventsQueue
+{
+public:
+  /**
+   * @brief Construct the queue.
+   * @param capacity Number of ring slots, rounded up to the next power of two.
+   */
+  RCLCPP_PUBLIC
+  explicit LockFreeEventsQueue(size_t capacity = 4096)
+  {
+    size_t rounded_capacity = 1;
+    while (rounded_capacity < capacity) {
+      rounded_capacity <<= 1;
+    }
+    capacity_mask_ = rounded_capacity - 1;
+    cells_.resize(rounded_capacity);
+    for (size_t i = 0; i < rounded_capacity; i++) {
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    enqueue_pos_.store(0, std::memory_order_relaxed);
+    dequeue_pos_.store(0, std::memory_order_relaxed);
+    consumer_parked_.store(false, std::memory_order_relaxed);
+  }
+
+  RCLCPP_PUBLIC
+  ~LockFreeEventsQueue() override = default;
+
+  /**
+   * @brief enqueue event into the queue
+   * Thread safe, lock-free unless the ring is full
+   * @param event The event to enqueue into the queue
+   */
+  RCLCPP_PUBLIC
+  void
+  enqueue(const rclcpp::experimental::executors::ExecutorEvent & event) override
+  {
+    rclcpp::experimental::executors::ExecutorEvent single_event = event;
+    single_event.num_events = 1;
+    for (size_t ev = 0; ev < event.num_events; ev++) {
+      this->push_one(single_event);
+    }
+    this->wake_consumer();
+  }
+
+  /**
+   * @brief waits for an event until timeout, gets a single event
+   * To be called from the single consumer thread only
+   * @return true if event, false if timeout
+   */
+  RCLCPP_PUBLIC
+  bool
+  dequeue(
+    rclcpp::experimental::executors::ExecutorEvent & event,
+    std::chrono::nanoseconds timeout = std::chrono::nanoseconds::max()) override
+  {
+    if (this->pop_one(event)) {
+      return true;
+    }
+
+    // The ring was observed empty: park on the condition variable until
+    // a producer wakes us up or the timeout expires.
+    std::unique_lock<std::mutex> lock(consumer_mutex_);
+    consumer_parked_.store(true, std::memory_order_seq_cst);
+    // Re-check after publishing the parked flag to avoid a missed wakeup.
+    if (this->pop_one(event)) {
+      consumer_parked_.store(false, std::memory_order_relaxed);
+      return true;
+    }
+
+    auto predicate = [this, &event]() {return this->pop_one(event);};
+    bool has_data = true;
+    if (timeout != std::chrono::nanoseconds::max()) {
+      has_data = consumer_cv_.wait_for(lock, timeout, predicate);
+    } else {
+      consumer_cv_.wait(lock, predicate);
+    }
+    consumer_parked_.store(false, std::memory_order_relaxed);
+    return has_data;
+  }
+
+  /**
+   * @brief Test whether queue is empty
+   * Thread safe
+   * @return true if the queue's size is 0, false otherwise.
+   */
+  RCLCPP_PUBLIC
+  bool
+  empty() const override
+  {
+    return this->size() == 0u;
+  }
+
+  /**
+   * @brief Returns the number of elements in the queue.
+   * Thread safe, the returned value is a snapshot
+   * @return the number of elements in the queue.
+   */
+  RCLCPP_PUBLIC
+  size_t
+  size() const override
+  {
+    size_t enqueue_pos = enqueue_pos_.load(std::memory_order_acquire);
+    size_t dequeue_pos = dequeue_pos_.load(std::memory_order_acquire);
+    return enqueue_pos >= dequeue_pos ? enqueue_pos - dequeue_pos : 0u;
+  }
+
+private:
+  struct Cell
+  {
+    std::atomic<size_t> sequence;
+    rclcpp::experimental::executors::ExecutorEvent event;
+  };
+
+  /// Claim a ring slot and store a single event into it.
+  void
+  push_one(const rclcpp::experimental::executors::ExecutorEvent & event)
+  {
+    Cell * cell;
+    size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    while (true) {
+      cell = &cells_[pos & capacity_mask_];
+      size_t seq = cell->sequence.load(std::memory_order_acquire);
+      intptr_t dif = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+      if (dif == 0) {
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (dif < 0) {
+        // Ring full: wait for the consumer to free this slot.
+        std::this_thread::yield();
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      } else {
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+    cell->event = event;
+    cell->sequence.store(pos + 1, std::memory_order_release);
+  }
+
+  /// Try to pop a single event; returns false if the ring is empty.
+  bool
+  pop_one(rclcpp::experimental::executors::ExecutorEvent & event)
+  {
+    size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+    Cell * cell = &cells_[pos & capacity_mask_];
+    size_t seq = cell->sequence.load(std::memory_order_acquire);
+    intptr_t dif = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+    if (dif < 0) {
+      return false;
+    }
+    dequeue_pos_.store(pos + 1, std::memory_order_relaxed);
+    event = cell->event;
+    cell->sequence.store(pos + capacity_mask_ + 1, std::memory_order_release);
+    return true;
+  }
+
+  /// Wake the consumer only if it published that it is parked.
+  void
+  wake_consumer()
+  {
+    // Order the release-store of the cell sequence in push_one before the
+    // load below; without the fence the two can reorder (StoreLoad) and this
+    // producer may see "not parked" while the consumer's post-park pop_one
+    // re-check misses the just-written event, leaving it parked forever.
+    // The consumer side is already fenced by its seq_cst exchange.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (consumer_parked_.load(std::memory_order_seq_cst)) {
+      std::unique_lock<std::mutex> lock(consumer_mutex_);
+      consumer_cv_.notify_one();
+    }
+  }
+
+  // The ring storage; size is always a power of two
+  std::vector<Cell> cells_;
+  // Mask used to map a monotonic position onto a ring index
+  size_t capacity_mask_;
+  // Next position to be claimed by a producer
+  alignas(64) std::atomic<size_t> enqueue_pos_;
+  // Next position to be consumed
+  alignas(64) std::atomic<size_t> dequeue_pos_;
+  // Whether the consumer is (about to be) blocked on the condition variable
+  std::atomic<bool> consumer_parked_;
+  // Mutex and condition variable used only to park/wake the idle consumer
+  std::mutex consumer_mutex_;
+  std::condition_variable consumer_cv_;
+};
+
+}  // namespace executors
+}  // namespace experimental
+}  // namespace rclcpp
+
+#endif  // RCLCPP__EXPERIMENTAL__EXECUTORS__EVENTS_EXECUTOR__LOCK_FREE_EVENTS_QUEUE_HPP_
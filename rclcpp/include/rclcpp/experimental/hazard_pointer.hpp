@@ -0,0 +1,222 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__EXPERIMENTAL__HAZARD_POINTER_HPP_
+#define RCLCPP__EXPERIMENTAL__HAZARD_POINTER_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace rclcpp
+{
+namespace experimental
+{
+
+/// Domain of hazard-pointer slots with deferred reclamation.
+/**
+ * Readers protect a pointer loaded from an atomic source by publishing it in
+ * a slot, see HazardPointer. Slot acquisition is lock-free; the slot list
+ * grows on demand and slot nodes are only reclaimed when the domain is
+ * destroyed. Writers retire replaced objects with retire(); a retired object
+ * is deleted once no slot references it. Retirement takes a mutex, which is
+ * fine on mutation paths that are serialized anyway, while readers never
+ * block on writers or on each other.
+ *
+ * The domain must outlive every reader; its destructor assumes no slot is
+ * active anymore.
+ */
+class HazardPointerDomain
+{
+public:
+  /// A reader slot, claimed through acquire_slot().
+  struct Slot
+  {
+    std::atomic<const void *> pointer {nullptr};
+    std::atomic<bool> active {false};
+    Slot * next {nullptr};
+  };
+
+  HazardPointerDomain() = default;
+
+  HazardPointerDomain(const HazardPointerDomain &) = delete;
+  HazardPointerDomain & operator=(const HazardPointerDomain &) = delete;
+
+  ~HazardPointerDomain()
+  {
+    // No reader may be active at this point, so everything still retired
+    // is unprotected by definition.
+    for (auto & retired : retired_) {
+      retired.deleter();
+    }
+    Slot * slot = slots_.load(std::memory_order_acquire);
+    while (slot != nullptr) {
+      Slot * next = slot->next;
+      delete slot;
+      slot = next;
+    }
+  }
+
+  /// Claim a free slot, growing the slot list when all are taken. Lock-free.
+  Slot *
+  acquire_slot()
+  {
+    for (Slot * slot = slots_.load(std::memory_order_acquire); slot != nullptr;
+      slot = slot->next)
+    {
+      bool expected = false;
+      if (slot->active.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+        return slot;
+      }
+    }
+    auto * slot = new Slot();
+    slot->active.store(true, std::memory_order_relaxed);
+    Slot * head = slots_.load(std::memory_order_relaxed);
+    do {
+      slot->next = head;
+    } while (!slots_.compare_exchange_weak(
+        head, slot, std::memory_order_acq_rel, std::memory_order_relaxed));
+    return slot;
+  }
+
+  /// Return a slot claimed with acquire_slot(). Lock-free.
+  void
+  release_slot(Slot * slot)
+  {
+    slot->pointer.store(nullptr, std::memory_order_release);
+    slot->active.store(false, std::memory_order_release);
+  }
+
+  /// Defer deletion of object until no slot protects it.
+  /**
+   * Also reclaims any previously retired object that is no longer protected.
+   */
+  template<typename T>
+  void
+  retire(const T * object)
+  {
+    if (nullptr == object) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(retired_mutex_);
+    retired_.push_back({object, [object]() {delete object;}});
+    scan_();
+  }
+
+private:
+  struct Retired
+  {
+    const void * pointer;
+    std::function<void ()> deleter;
+  };
+
+  /// Delete every retired object no slot references; retired_mutex_ required.
+  void
+  scan_()
+  {
+    // A full barrier between the retirer's removal of the object from the
+    // shared source and the hazard-slot loads below. It pairs with the
+    // seq_cst fence in the HazardPointer constructor: either the reader's
+    // re-read of the source sees the removal, or this scan sees the
+    // published hazard. Acquire alone would let the slot loads be satisfied
+    // before the removal became visible, missing a protected pointer.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::vector<const void *> hazards;
+    for (Slot * slot = slots_.load(std::memory_order_acquire); slot != nullptr;
+      slot = slot->next)
+    {
+      const void * pointer = slot->pointer.load(std::memory_order_acquire);
+      if (pointer != nullptr) {
+        hazards.push_back(pointer);
+      }
+    }
+    auto it = retired_.begin();
+    while (it != retired_.end()) {
+      if (std::find(hazards.begin(), hazards.end(), it->pointer) == hazards.end()) {
+        it->deleter();
+        it = retired_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  std::atomic<Slot *> slots_ {nullptr};
+  std::mutex retired_mutex_;
+  std::vector<Retired> retired_;
+};
+
+/// RAII protection of a pointer loaded from an atomic source.
+/**
+ * While the HazardPointer is alive the object it resolved to will not be
+ * reclaimed by HazardPointerDomain::retire(), even if the source has since
+ * been swapped to a newer object. Construction is lock-free.
+ */
+template<typename T>
+class HazardPointer
+{
+public:
+  HazardPointer(HazardPointerDomain & domain, const std::atomic<T *> & source)
+  : domain_(&domain), slot_(domain.acquire_slot())
+  {
+    T * candidate = source.load(std::memory_order_acquire);
+    while (true) {
+      slot_->pointer.store(static_cast<const void *>(candidate), std::memory_order_release);
+      // A full barrier between publishing the hazard and re-reading the
+      // source, so retirement scans running in between see the hazard.
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      T * current = source.load(std::memory_order_acquire);
+      if (current == candidate) {
+        break;
+      }
+      candidate = current;
+    }
+    pointer_ = candidate;
+  }
+
+  HazardPointer(const HazardPointer &) = delete;
+  HazardPointer & operator=(const HazardPointer &) = delete;
+
+  HazardPointer(HazardPointer && other) noexcept
+  : domain_(other.domain_), slot_(other.slot_), pointer_(other.pointer_)
+  {
+    other.slot_ = nullptr;
+    other.pointer_ = nullptr;
+  }
+
+  ~HazardPointer()
+  {
+    if (slot_ != nullptr) {
+      domain_->release_slot(slot_);
+    }
+  }
+
+  T * get() const {return pointer_;}
+  T * operator->() const {return pointer_;}
+  T & operator*() const {return *pointer_;}
+  explicit operator bool() const {return pointer_ != nullptr;}
+
+private:
+  HazardPointerDomain * domain_;
+  HazardPointerDomain::Slot * slot_;
+  T * pointer_;
+};
+
+}  // namespace experimental
+}  // namespace rclcpp
+
+#endif  // RCLCPP__EXPERIMENTAL__HAZARD_POINTER_HPP_
@@ -19,23 +19,29 @@
 
 #include <shared_mutex>
 
+#include <atomic>
+#include <functional>
 #include <iterator>
 #include <memory>
 #include <stdexcept>
+#include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 #include <typeinfo>
 
 #include "rclcpp/allocator/allocator_deleter.hpp"
+#include "rclcpp/experimental/hazard_pointer.hpp"
 #include "rclcpp/experimental/ros_message_intra_process_buffer.hpp"
 #include "rclcpp/experimental/subscription_intra_process.hpp"
 #include "rclcpp/experimental/subscription_intra_process_base.hpp"
 #include "rclcpp/experimental/subscription_intra_process_buffer.hpp"
+#include "rclcpp/intra_process_buffer_type.hpp"
 #include "rclcpp/logger.hpp"
 #include "rclcpp/logging.hpp"
 #include "rclcpp/macros.hpp"
 #include "rclcpp/publisher_base.hpp"
+#include "rclcpp/service.hpp"
 #include "rclcpp/type_adapter.hpp"
 #include "rclcpp/visibility_control.hpp"
 
@@ -150,6 +156,134 @@ public:
   void
   remove_publisher(uint64_t intra_process_publisher_id);
 
+  /// Unregister every endpoint in one pass.
+  /**
+   * Severs all publishers, subscriptions, services and action endpoints with
+   * a single lock acquisition and a single endpoint snapshot rebuild, instead
+   * of one of each per removed entity. Used during context shutdown, where
+   * the per-entity remove_* calls that follow from the entity destructors
+   * then return without work.
+   */
+  RCLCPP_PUBLIC
+  void
+  clear();
+
+  /// Register a service with the manager, returns the service unique id.
+  /**
+   * This method stores the service together with its type support and
+   * resolved service name, so that clients created for the same service in
+   * the same process can find it and dispatch requests to it directly.
+   *
+   * In addition this generates a unique intra process id for the service.
+   *
+   * \param service the service to register.
+   * \param type_support the type support the service was created with.
+   * \return an unsigned 64-bit integer which is the service's unique id.
+   */
+  RCLCPP_PUBLIC
+  uint64_t
+  add_service(
+    rclcpp::ServiceBase::SharedPtr service,
+    const rosidl_service_type_support_t * type_support);
+
+  /// Unregister a service using the service's unique id.
+  /**
+   * \param intra_process_service_id id of the service to remove.
+   */
+  RCLCPP_PUBLIC
+  void
+  remove_service(uint64_t intra_process_service_id);
+
+  /// Find a registered service matching a client.
+  /**
+   * A service matches when it has the same resolved service name and was
+   * created with the same type support handle; since type support handles
+   * are process-wide singletons per service type, pointer equality also
+   * guarantees that the service and the client use the same types.
+   *
+   * \param service_name the client's resolved service name.
+   * \param type_support the type support the client was created with.
+   * \return the matching service, or nullptr if there is none.
+   */
+  RCLCPP_PUBLIC
+  rclcpp::ServiceBase::SharedPtr
+  get_matching_service(
+    const std::string & service_name,
+    const rosidl_service_type_support_t * type_support) const;
+
+  /// Register an action server with the manager, returns its unique id.
+  /**
+   * Action servers and clients live in rclcpp_action, on which rclcpp cannot
+   * depend, so they are stored type erased; rclcpp_action is responsible for
+   * registering pointers that can be cast back to its own base types.
+   * Matching works like it does for services: same resolved action name and
+   * the same (process-wide singleton) type support pointer.
+   *
+   * \param server the action server to register, type erased.
+   * \param type_support the action type support the server was created with.
+   * \param action_name the server's expanded action name.
+   * \return an unsigned 64-bit integer which is the server's unique id.
+   */
+  RCLCPP_PUBLIC
+  uint64_t
+  add_action_server(
+    std::shared_ptr<void> server,
+    const void * type_support,
+    const std::string & action_name);
+
+  /// Unregister an action server using its unique id.
+  /**
+   * \param intra_process_action_server_id id of the action server to remove.
+   */
+  RCLCPP_PUBLIC
+  void
+  remove_action_server(uint64_t intra_process_action_server_id);
+
+  /// Return true if an action server matching name and type support is alive.
+  /**
+   * \param action_name the expanded action name to look for.
+   * \param type_support the action type support to match against.
+   */
+  RCLCPP_PUBLIC
+  bool
+  has_matching_action_server(
+    const std::string & action_name,
+    const void * type_support) const;
+
+  /// Register an action client with the manager, returns its unique id.
+  /**
+   * \param client the action client to register, type erased.
+   * \param type_support the action type support the client was created with.
+   * \param action_name the client's expanded action name.
+   * \return an unsigned 64-bit integer which is the client's unique id.
+   */
+  RCLCPP_PUBLIC
+  uint64_t
+  add_action_client(
+    std::shared_ptr<void> client,
+    const void * type_support,
+    const std::string & action_name);
+
+  /// Unregister an action client using its unique id.
+  /**
+   * \param intra_process_action_client_id id of the action client to remove.
+   */
+  RCLCPP_PUBLIC
+  void
+  remove_action_client(uint64_t intra_process_action_client_id);
+
+  /// Return all live action clients matching name and type support.
+  /**
+   * \param action_name the expanded action name to look for.
+   * \param type_support the action type support to match against.
+   * \return the matching clients, type erased.
+   */
+  RCLCPP_PUBLIC
+  std::vector<std::shared_ptr<void>>
+  get_matching_action_clients(
+    const std::string & action_name,
+    const void * type_support) const;
+
   /// Publishes an intra-process message, passed as a unique pointer.
   /**
    * This is one of the two methods for publishing intra-process.
@@ -189,51 +323,51 @@ public:
     using MessageAllocTraits = allocator::AllocRebind<MessageT, Alloc>;
     using MessageAllocatorT = typename MessageAllocTraits::allocator_type;
 
-    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    auto state = get_endpoint_state();
 
-    auto publisher_it = pub_to_subs_.find(intra_process_publisher_id);
-    if (publisher_it == pub_to_subs_.end()) {
+    auto publisher_it = state->fanouts.find(intra_process_publisher_id);
+    if (publisher_it == state->fanouts.end()) {
       // Publisher is either invalid or no longer exists.
       RCLCPP_WARN(
         rclcpp::get_logger("rclcpp"),
         "Calling do_intra_process_publish for invalid or no longer existing publisher id");
       return;
     }
-    const auto & sub_ids = publisher_it->second;
+    const auto & fanout = publisher_it->second;
+
+    if (fanout.retained_depth > 0u) {
+      this->template retain_sample_copy<MessageT, Alloc, Deleter, ROSMessageType>(
+        intra_process_publisher_id, fanout.retained_depth, *message, allocator);
+    }
 
-    if (sub_ids.take_ownership_subscriptions.empty()) {
+    if (fanout.take_ownership_subscriptions.empty()) {
       // None of the buffers require ownership, so we promote the pointer
       std::shared_ptr<MessageT> msg = std::move(message);
 
       this->template add_shared_msg_to_buffers<MessageT, Alloc, Deleter, ROSMessageType>(
-        msg, sub_ids.take_shared_subscriptions);
-    } else if (!sub_ids.take_ownership_subscriptions.empty() && // NOLINT
-      sub_ids.take_shared_subscriptions.size() <= 1)
+        msg, fanout.take_shared_subscriptions);
+    } else if (!fanout.take_ownership_subscriptions.empty() && // NOLINT
+      fanout.take_shared_subscriptions.size() <= 1)
     {
       // There is at maximum 1 buffer that does not require ownership.
-      // So this case is equivalent to all the buffers requiring ownership
-
-      // Merge the two vector of ids into a unique one
-      std::vector<uint64_t> concatenated_vector(sub_ids.take_shared_subscriptions);
-      concatenated_vector.insert(
-        concatenated_vector.end(),
-        sub_ids.take_ownership_subscriptions.begin(),
-        sub_ids.take_ownership_subscriptions.end());
+      // So this case is equivalent to all the buffers requiring ownership.
+      // The merged recipient list was precomputed with the snapshot, so no
+      // allocation happens on this path.
       this->template add_owned_msg_to_buffers<MessageT, Alloc, Deleter, ROSMessageType>(
         std::move(message),
-        concatenated_vector,
+        fanout.all_subscriptions,
         allocator);
-    } else if (!sub_ids.take_ownership_subscriptions.empty() && // NOLINT
-      sub_ids.take_shared_subscriptions.size() > 1)
+    } else if (!fanout.take_ownership_subscriptions.empty() && // NOLINT
+      fanout.take_shared_subscriptions.size() > 1)
     {
       // Construct a new shared pointer from the message
       // for the buffers that do not require ownership
       auto shared_msg = std::allocate_shared<MessageT, MessageAllocatorT>(allocator, *message);
 
       this->template add_shared_msg_to_buffers<MessageT, Alloc, Deleter, ROSMessageType>(
-        shared_msg, sub_ids.take_shared_subscriptions);
+        shared_msg, fanout.take_shared_subscriptions);
       this->template add_owned_msg_to_buffers<MessageT, Alloc, Deleter, ROSMessageType>(
-        std::move(message), sub_ids.take_ownership_subscriptions, allocator);
+        std::move(message), fanout.take_ownership_subscriptions, allocator);
     }
   }
 
@@ -252,24 +386,29 @@ public:
     using MessageAllocTraits = allocator::AllocRebind<MessageT, Alloc>;
     using MessageAllocatorT = typename MessageAllocTraits::allocator_type;
 
-    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    auto state = get_endpoint_state();
 
-    auto publisher_it = pub_to_subs_.find(intra_process_publisher_id);
-    if (publisher_it == pub_to_subs_.end()) {
+    auto publisher_it = state->fanouts.find(intra_process_publisher_id);
+    if (publisher_it == state->fanouts.end()) {
       // Publisher is either invalid or no longer exists.
       RCLCPP_WARN(
         rclcpp::get_logger("rclcpp"),
         "Calling do_intra_process_publish for invalid or no longer existing publisher id");
       return nullptr;
     }
-    const auto & sub_ids = publisher_it->second;
+    const auto & fanout = publisher_it->second;
 
-    if (sub_ids.take_ownership_subscriptions.empty()) {
+    if (fanout.retained_depth > 0u) {
+      this->template retain_sample_copy<MessageT, Alloc, Deleter, ROSMessageType>(
+        intra_process_publisher_id, fanout.retained_depth, *message, allocator);
+    }
+
+    if (fanout.take_ownership_subscriptions.empty()) {
       // If there are no owning, just convert to shared.
       std::shared_ptr<MessageT> shared_msg = std::move(message);
-      if (!sub_ids.take_shared_subscriptions.empty()) {
+      if (!fanout.take_shared_subscriptions.empty()) {
         this->template add_shared_msg_to_buffers<MessageT, Alloc, Deleter, ROSMessageType>(
-          shared_msg, sub_ids.take_shared_subscriptions);
+          shared_msg, fanout.take_shared_subscriptions);
       }
       return shared_msg;
     } else {
@@ -277,15 +416,15 @@ public:
       // do not require ownership and to return.
       auto shared_msg = std::allocate_shared<MessageT, MessageAllocatorT>(allocator, *message);
 
-      if (!sub_ids.take_shared_subscriptions.empty()) {
+      if (!fanout.take_shared_subscriptions.empty()) {
         this->template add_shared_msg_to_buffers<MessageT, Alloc, Deleter, ROSMessageType>(
           shared_msg,
-          sub_ids.take_shared_subscriptions);
+          fanout.take_shared_subscriptions);
       }
-      if (!sub_ids.take_ownership_subscriptions.empty()) {
+      if (!fanout.take_ownership_subscriptions.empty()) {
         this->template add_owned_msg_to_buffers<MessageT, Alloc, Deleter, ROSMessageType>(
           std::move(message),
-          sub_ids.take_ownership_subscriptions,
+          fanout.take_ownership_subscriptions,
           allocator);
       }
       return shared_msg;
@@ -311,6 +450,55 @@ public:
   size_t
   lowest_available_capacity(const uint64_t intra_process_publisher_id) const;
 
+  /// Status of one registered intra-process subscription buffer.
+  struct SubscriptionBufferStatus
+  {
+    uint64_t subscription_id;
+    std::string topic_name;
+    /// Resolved buffer type, either SharedPtr or UniquePtr.
+    rclcpp::IntraProcessBufferType buffer_type;
+    /// Buffer capacity from the QoS depth; 0 when the history is keep-all.
+    size_t capacity;
+    /// Number of buffered messages not yet taken.
+    size_t occupancy;
+    /// Unread messages overwritten by newer ones since creation.
+    uint64_t overwrites;
+  };
+
+  /// Status of one registered intra-process publisher.
+  struct PublisherStatus
+  {
+    uint64_t publisher_id;
+    std::string topic_name;
+    /// Number of matched intra-process subscriptions still alive.
+    size_t matched_subscription_count;
+    /// Smallest available capacity across the matched buffers; 0 when no
+    /// subscription is matched.
+    size_t lowest_available_capacity;
+  };
+
+  /// A consistent view of the registered endpoints and their buffer state.
+  struct TopologySnapshot
+  {
+    std::vector<PublisherStatus> publishers;
+    std::vector<SubscriptionBufferStatus> subscriptions;
+  };
+
+  /// Enumerate the registered endpoints with their buffer occupancy.
+  /**
+   * All entries are read from one endpoint snapshot, so publishers and
+   * subscriptions are mutually consistent even while endpoints are added or
+   * removed concurrently.  Occupancy and overwrite counts are sampled per
+   * buffer without blocking publishers, and the walk takes no locks beyond
+   * each buffer's own, so this is cheap enough to poll periodically and feed
+   * into telemetry to locate a backed-up buffer.
+   *
+   * \return status of every registered publisher and subscription.
+   */
+  RCLCPP_PUBLIC
+  TopologySnapshot
+  get_topology_snapshot() const;
+
 private:
   struct SplittedSubscriptions
   {
@@ -327,6 +515,93 @@ private:
   using PublisherToSubscriptionIdsMap =
     std::unordered_map<uint64_t, SplittedSubscriptions>;
 
+  /// A registered service, with the data needed to match clients against it.
+  struct ServiceEntry
+  {
+    rclcpp::ServiceBase::WeakPtr service;
+    const rosidl_service_type_support_t * type_support;
+    std::string service_name;
+  };
+
+  using ServiceMap =
+    std::unordered_map<uint64_t, ServiceEntry>;
+
+  /// A registered action endpoint (server or client), type erased.
+  struct ActionEndpointEntry
+  {
+    std::weak_ptr<void> endpoint;
+    const void * type_support;
+    std::string action_name;
+  };
+
+  using ActionEndpointMap =
+    std::unordered_map<uint64_t, ActionEndpointEntry>;
+
+  /// Per-publisher recipient lists with the id lookups already resolved.
+  /**
+   * Built together with the endpoint snapshot, so the publish paths iterate
+   * weak pointers directly instead of resolving each subscription id through
+   * a hash map on every publish.
+   */
+  struct ResolvedFanout
+  {
+    std::vector<rclcpp::experimental::SubscriptionIntraProcessBase::WeakPtr>
+    take_shared_subscriptions;
+    std::vector<rclcpp::experimental::SubscriptionIntraProcessBase::WeakPtr>
+    take_ownership_subscriptions;
+    /// The two lists above concatenated, take-shared first; precomputed so
+    /// the one-copy publish path does not merge them on every publish.
+    std::vector<rclcpp::experimental::SubscriptionIntraProcessBase::WeakPtr>
+    all_subscriptions;
+    /// QoS depth when the publisher is transient local, 0 otherwise; non-zero
+    /// values make the publish paths retain samples for late joiners.
+    size_t retained_depth {0};
+  };
+
+  using FanoutMap =
+    std::unordered_map<uint64_t, ResolvedFanout>;
+
+  /// Immutable snapshot of the endpoint topology.
+  /**
+   * Publish paths read the snapshot without taking the shared mutex; endpoint
+   * additions and removals (rare) build a new snapshot and swap it in, RCU
+   * style. Readers protect the snapshot they loaded through a hazard pointer,
+   * so loading stays lock-free even while retired snapshots are reclaimed
+   * (atomic shared_ptr loads go through a lock pool on common standard
+   * library implementations).
+   */
+  struct EndpointState
+  {
+    FanoutMap fanouts;
+    SubscriptionMap subscriptions;
+    PublisherMap publishers;
+  };
+
+  /// Load the current endpoint snapshot, lock-free.
+  rclcpp::experimental::HazardPointer<const EndpointState>
+  get_endpoint_state() const
+  {
+    return rclcpp::experimental::HazardPointer<const EndpointState>(
+      endpoint_state_domain_, endpoint_state_);
+  }
+
+  /// Publish a new snapshot of the endpoint maps.
+  /**
+   * Must be called with mutex_ held exclusively after every mutation.
+   */
+  RCLCPP_PUBLIC
+  void
+  publish_endpoint_state();
+
+  /// Type-erased delivery of a retained latched sample into one subscription.
+  using RetainedSampleReplayFn =
+    std::function<void (rclcpp::experimental::SubscriptionIntraProcessBase::SharedPtr)>;
+
+  /// Store a latched sample replay function, keeping at most depth samples.
+  RCLCPP_PUBLIC
+  void
+  retain_sample(uint64_t intra_process_publisher_id, size_t depth, RetainedSampleReplayFn replay);
+
   RCLCPP_PUBLIC
   static
   uint64_t
@@ -350,7 +625,40 @@ private:
   void
   add_shared_msg_to_buffers(
     std::shared_ptr<const MessageT> message,
-    std::vector<uint64_t> subscription_ids)
+    const std::vector<rclcpp::experimental::SubscriptionIntraProcessBase::WeakPtr> & recipients)
+  {
+    // When the publisher uses a type adapter, all ROS-typed subscriptions share
+    // a single lazily converted message; when every taker accepts the adapted
+    // type no conversion happens at all and the custom type is delivered as is.
+    std::shared_ptr<ROSMessageType> converted_ros_msg;
+
+    for (const auto & recipient : recipients) {
+      auto subscription_base = recipient.lock();
+      if (subscription_base == nullptr) {
+        // The subscription expired after this snapshot was taken; its removal
+        // will publish a pruned snapshot, nothing to clean up here.
+        continue;
+      }
+      this->template deliver_shared_msg_to_buffer<MessageT, Alloc, Deleter, ROSMessageType>(
+        message, std::move(subscription_base), converted_ros_msg);
+    }
+  }
+
+  /// Deliver a shared message to a single subscription buffer.
+  /**
+   * \param converted_ros_msg cache for the ROS-typed conversion of an adapted
+   *   message, shared between deliveries of the same sample.
+   */
+  template<
+    typename MessageT,
+    typename Alloc,
+    typename Deleter,
+    typename ROSMessageType>
+  void
+  deliver_shared_msg_to_buffer(
+    const std::shared_ptr<const MessageT> & message,
+    rclcpp::experimental::SubscriptionIntraProcessBase::SharedPtr subscription_base,
+    std::shared_ptr<ROSMessageType> & converted_ros_msg)
   {
     using ROSMessageTypeAllocatorTraits = allocator::AllocRebind<ROSMessageType, Alloc>;
     using ROSMessageTypeAllocator = typename ROSMessageTypeAllocatorTraits::allocator_type;
@@ -361,62 +669,85 @@ private:
     using PublishedTypeAllocator = typename PublishedTypeAllocatorTraits::allocator_type;
     using PublishedTypeDeleter = allocator::Deleter<PublishedTypeAllocator, PublishedType>;
 
-    for (auto id : subscription_ids) {
-      auto subscription_it = subscriptions_.find(id);
-      if (subscription_it == subscriptions_.end()) {
-        throw std::runtime_error("subscription has unexpectedly gone out of scope");
-      }
-      auto subscription_base = subscription_it->second.lock();
-      if (subscription_base == nullptr) {
-        subscriptions_.erase(id);
-        continue;
-      }
+    auto subscription = std::dynamic_pointer_cast<
+      rclcpp::experimental::SubscriptionIntraProcessBuffer<PublishedType,
+      PublishedTypeAllocator, PublishedTypeDeleter, ROSMessageType>
+      >(subscription_base);
+    if (subscription != nullptr) {
+      subscription->provide_intra_process_data(message);
+      return;
+    }
 
-      auto subscription = std::dynamic_pointer_cast<
-        rclcpp::experimental::SubscriptionIntraProcessBuffer<PublishedType,
-        PublishedTypeAllocator, PublishedTypeDeleter, ROSMessageType>
-        >(subscription_base);
-      if (subscription != nullptr) {
-        subscription->provide_intra_process_data(message);
-        continue;
-      }
+    auto ros_message_subscription = std::dynamic_pointer_cast<
+      rclcpp::experimental::SubscriptionROSMsgIntraProcessBuffer<ROSMessageType,
+      ROSMessageTypeAllocator, ROSMessageTypeDeleter>
+      >(subscription_base);
+    if (nullptr == ros_message_subscription) {
+      throw std::runtime_error(
+              "failed to dynamic cast SubscriptionIntraProcessBase to "
+              "SubscriptionIntraProcessBuffer<MessageT, Alloc, Deleter>, or to "
+              "SubscriptionROSMsgIntraProcessBuffer<ROSMessageType,ROSMessageTypeAllocator,"
+              "ROSMessageTypeDeleter> which can happen when the publisher and "
+              "subscription use different allocator types, which is not supported");
+    }
 
-      auto ros_message_subscription = std::dynamic_pointer_cast<
-        rclcpp::experimental::SubscriptionROSMsgIntraProcessBuffer<ROSMessageType,
-        ROSMessageTypeAllocator, ROSMessageTypeDeleter>
-        >(subscription_base);
-      if (nullptr == ros_message_subscription) {
-        throw std::runtime_error(
-                "failed to dynamic cast SubscriptionIntraProcessBase to "
-                "SubscriptionIntraProcessBuffer<MessageT, Alloc, Deleter>, or to "
-                "SubscriptionROSMsgIntraProcessBuffer<ROSMessageType,ROSMessageTypeAllocator,"
-                "ROSMessageTypeDeleter> which can happen when the publisher and "
-                "subscription use different allocator types, which is not supported");
+    if constexpr (rclcpp::TypeAdapter<MessageT>::is_specialized::value) {
+      if (nullptr == converted_ros_msg) {
+        converted_ros_msg = std::make_shared<ROSMessageType>();
+        rclcpp::TypeAdapter<MessageT>::convert_to_ros_message(*message, *converted_ros_msg);
       }
-
-      if constexpr (rclcpp::TypeAdapter<MessageT>::is_specialized::value) {
-        ROSMessageType ros_msg;
-        rclcpp::TypeAdapter<MessageT>::convert_to_ros_message(*message, ros_msg);
-        ros_message_subscription->provide_intra_process_message(
-          std::make_shared<ROSMessageType>(ros_msg));
+      ros_message_subscription->provide_intra_process_message(converted_ros_msg);
+    } else {
+      if constexpr (std::is_same<MessageT, ROSMessageType>::value) {
+        ros_message_subscription->provide_intra_process_message(message);
       } else {
-        if constexpr (std::is_same<MessageT, ROSMessageType>::value) {
-          ros_message_subscription->provide_intra_process_message(message);
-        } else {
-          if constexpr (std::is_same<typename rclcpp::TypeAdapter<MessageT,
-            ROSMessageType>::ros_message_type, ROSMessageType>::value)
-          {
-            ROSMessageType ros_msg;
+        if constexpr (std::is_same<typename rclcpp::TypeAdapter<MessageT,
+          ROSMessageType>::ros_message_type, ROSMessageType>::value)
+        {
+          if (nullptr == converted_ros_msg) {
+            converted_ros_msg = std::make_shared<ROSMessageType>();
             rclcpp::TypeAdapter<MessageT, ROSMessageType>::convert_to_ros_message(
-              *message, ros_msg);
-            ros_message_subscription->provide_intra_process_message(
-              std::make_shared<ROSMessageType>(ros_msg));
+              *message, *converted_ros_msg);
           }
+          ros_message_subscription->provide_intra_process_message(converted_ros_msg);
         }
       }
     }
   }
 
+  /// Retain a copy of a latched sample for replay to late joiners.
+  /**
+   * Used for transient local publishers: a shared copy of the sample is kept,
+   * wrapped in a type-erased replay function that delivers it into the buffer
+   * of a subscription added after the sample was published.
+   */
+  template<
+    typename MessageT,
+    typename Alloc,
+    typename Deleter,
+    typename ROSMessageType>
+  void
+  retain_sample_copy(
+    uint64_t intra_process_publisher_id,
+    size_t retained_depth,
+    const MessageT & message,
+    typename allocator::AllocRebind<MessageT, Alloc>::allocator_type & allocator)
+  {
+    using MessageAllocTraits = allocator::AllocRebind<MessageT, Alloc>;
+    using MessageAllocatorT = typename MessageAllocTraits::allocator_type;
+
+    std::shared_ptr<const MessageT> retained_msg =
+      std::allocate_shared<MessageT, MessageAllocatorT>(allocator, message);
+    retain_sample(
+      intra_process_publisher_id,
+      retained_depth,
+      [this, retained_msg](rclcpp::experimental::SubscriptionIntraProcessBase::SharedPtr sub) {
+        std::shared_ptr<ROSMessageType> converted_ros_msg;
+        this->template deliver_shared_msg_to_buffer<MessageT, Alloc, Deleter, ROSMessageType>(
+          retained_msg, std::move(sub), converted_ros_msg);
+      });
+  }
+
   template<
     typename MessageT,
     typename Alloc,
@@ -425,7 +756,7 @@ private:
   void
   add_owned_msg_to_buffers(
     std::unique_ptr<MessageT, Deleter> message,
-    std::vector<uint64_t> subscription_ids,
+    const std::vector<rclcpp::experimental::SubscriptionIntraProcessBase::WeakPtr> & recipients,
     typename allocator::AllocRebind<MessageT, Alloc>::allocator_type & allocator)
   {
     using MessageAllocTraits = allocator::AllocRebind<MessageT, Alloc>;
@@ -439,15 +770,22 @@ private:
     using PublishedTypeAllocatorTraits = allocator::AllocRebind<PublishedType, Alloc>;
     using PublishedTypeAllocator = typename PublishedTypeAllocatorTraits::allocator_type;
     using PublishedTypeDeleter = allocator::Deleter<PublishedTypeAllocator, PublishedType>;
-
-    for (auto it = subscription_ids.begin(); it != subscription_ids.end(); it++) {
-      auto subscription_it = subscriptions_.find(*it);
-      if (subscription_it == subscriptions_.end()) {
-        throw std::runtime_error("subscription has unexpectedly gone out of scope");
-      }
-      auto subscription_base = subscription_it->second.lock();
+    using ROSMessageUniquePtr = std::unique_ptr<ROSMessageType, ROSMessageTypeDeleter>;
+
+    // When the publisher uses a type adapter, the conversion runs at most once
+    // per publish: the first ROS-typed subscription is deferred and receives
+    // the converted message after the loop, so any further ROS-typed takers
+    // can copy from it instead of converting again. When every taker accepts
+    // the adapted type no conversion happens at all.
+    std::shared_ptr<rclcpp::experimental::SubscriptionROSMsgIntraProcessBuffer<ROSMessageType,
+      ROSMessageTypeAllocator, ROSMessageTypeDeleter>> deferred_ros_message_subscription;
+    ROSMessageUniquePtr converted_ros_msg;
+
+    for (auto it = recipients.begin(); it != recipients.end(); it++) {
+      auto subscription_base = it->lock();
       if (subscription_base == nullptr) {
-        subscriptions_.erase(subscription_it);
+        // The subscription expired after this snapshot was taken; its removal
+        // will publish a pruned snapshot, nothing to clean up here.
         continue;
       }
 
@@ -456,7 +794,7 @@ private:
         PublishedTypeAllocator, PublishedTypeDeleter, ROSMessageType>
         >(subscription_base);
       if (subscription != nullptr) {
-        if (std::next(it) == subscription_ids.end()) {
+        if (std::next(it) == recipients.end()) {
           // If this is the last subscription, give up ownership
           subscription->provide_intra_process_data(std::move(message));
           // Last message delivered, break from for loop
@@ -488,16 +826,23 @@ private:
 
       if constexpr (rclcpp::TypeAdapter<MessageT>::is_specialized::value) {
         ROSMessageTypeAllocator ros_message_alloc(allocator);
-        auto ptr = ros_message_alloc.allocate(1);
-        ros_message_alloc.construct(ptr);
         ROSMessageTypeDeleter deleter;
         allocator::set_allocator_for_deleter(&deleter, &allocator);
-        rclcpp::TypeAdapter<MessageT>::convert_to_ros_message(*message, *ptr);
-        auto ros_msg = std::unique_ptr<ROSMessageType, ROSMessageTypeDeleter>(ptr, deleter);
-        ros_message_subscription->provide_intra_process_message(std::move(ros_msg));
+        auto ptr = ros_message_alloc.allocate(1);
+        if (nullptr == converted_ros_msg) {
+          ros_message_alloc.construct(ptr);
+          rclcpp::TypeAdapter<MessageT>::convert_to_ros_message(*message, *ptr);
+          converted_ros_msg = ROSMessageUniquePtr(ptr, deleter);
+          deferred_ros_message_subscription = ros_message_subscription;
+        } else {
+          // Copy the already converted message instead of converting again.
+          ros_message_alloc.construct(ptr, *converted_ros_msg);
+          ros_message_subscription->provide_intra_process_message(
+            ROSMessageUniquePtr(ptr, deleter));
+        }
       } else {
         if constexpr (std::is_same<MessageT, ROSMessageType>::value) {
-          if (std::next(it) == subscription_ids.end()) {
+          if (std::next(it) == recipients.end()) {
             // If this is the last subscription, give up ownership
             ros_message_subscription->provide_intra_process_message(std::move(message));
             // Last message delivered, break from for loop
@@ -515,11 +860,29 @@ private:
         }
       }
     }
+
+    if (deferred_ros_message_subscription) {
+      deferred_ros_message_subscription->provide_intra_process_message(
+        std::move(converted_ros_msg));
+    }
   }
 
   PublisherToSubscriptionIdsMap pub_to_subs_;
   SubscriptionMap subscriptions_;
   PublisherMap publishers_;
+  // Services are looked up rarely (clients cache their match), so they are
+  // kept out of the endpoint snapshot and read under the shared mutex.
+  ServiceMap services_;
+  ActionEndpointMap action_servers_;
+  ActionEndpointMap action_clients_;
+  // Latched samples of transient local publishers, replayed into matching
+  // subscriptions that join after the samples were published.
+  std::unordered_map<uint64_t, std::vector<RetainedSampleReplayFn>> retained_samples_;
+
+  /// Read-side copy of the maps above, swapped atomically on mutation.
+  std::atomic<const EndpointState *> endpoint_state_ {nullptr};
+  /// Reclaims replaced snapshots once no reader protects them anymore.
+  mutable rclcpp::experimental::HazardPointerDomain endpoint_state_domain_;
 
   mutable std::shared_timed_mutex mutex_;
 };
@@ -0,0 +1,278 @@
+// Copyright 2024 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__EXPERIMENTAL__SERVICE_INTRA_PROCESS_HPP_
+#define RCLCPP__EXPERIMENTAL__SERVICE_INTRA_PROCESS_HPP_
+
+#include <rmw/types.h>
+
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+#include "rcl/wait.h"
+#include "rmw/impl/cpp/demangle.hpp"
+
+#include "rclcpp/context.hpp"
+#include "rclcpp/detail/add_guard_condition_to_rcl_wait_set.hpp"
+#include "rclcpp/guard_condition.hpp"
+#include "rclcpp/logging.hpp"
+#include "rclcpp/macros.hpp"
+#include "rclcpp/waitable.hpp"
+
+namespace rclcpp
+{
+namespace experimental
+{
+
+/// Waitable buffering requests sent by intra-process clients to one service.
+/**
+ * Matched clients queue requests here instead of dispatching them inline, so
+ * the service's user callback always runs on the service's executor, inside
+ * its callback group, exactly like a middleware-delivered request.
+ *
+ * Each queued request carries a completion callback which delivers the typed
+ * response back to the client side; it is invoked either directly after the
+ * user callback returns a response, or later through
+ * Service::send_response() when the callback deferred the response.
+ */
+template<typename ServiceT>
+class ServiceIntraProcess : public rclcpp::Waitable
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS(ServiceIntraProcess)
+
+  using SharedRequest = typename ServiceT::Request::SharedPtr;
+  using SharedResponse = typename ServiceT::Response::SharedPtr;
+  /// Delivers the typed response back to the waiting client.
+  using CompletionCallback = std::function<void (SharedResponse)>;
+  /// Runs the service's user callback; returns nullptr when it deferred.
+  using DispatchCallback = std::function<
+    SharedResponse (std::shared_ptr<rmw_request_id_t>, SharedRequest)>;
+
+  enum class EntityType : std::size_t
+  {
+    Service,
+  };
+
+  ServiceIntraProcess(
+    rclcpp::Context::SharedPtr context,
+    DispatchCallback dispatch)
+  : gc_(context), dispatch_(std::move(dispatch))
+  {}
+
+  ~ServiceIntraProcess() override = default;
+
+  size_t
+  get_number_of_ready_guard_conditions() override {return 1;}
+
+  void
+  add_to_wait_set(rcl_wait_set_t * wait_set) override
+  {
+    detail::add_guard_condition_to_rcl_wait_set(*wait_set, gc_);
+  }
+
+  bool
+  is_ready(rcl_wait_set_t * wait_set) override
+  {
+    (void) wait_set;
+    std::lock_guard<std::mutex> lock(mutex_);
+    return !queue_.empty();
+  }
+
+  /// Queue a request from a matched intra-process client.
+  /**
+   * Thread-safe; called from the client's thread. The request is executed
+   * the next time the service's executor processes this waitable.
+   *
+   * \param[in] request the request to execute.
+   * \param[in] on_response invoked with the typed response once the user
+   *   callback produced one, possibly deferred.
+   */
+  void
+  queue_request(SharedRequest request, CompletionCallback on_response)
+  {
+    auto pending = std::make_shared<PendingRequest>();
+    pending->request = std::move(request);
+    pending->on_response = std::move(on_response);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      // Negative sequence numbers cannot collide with rmw assigned ones,
+      // letting send_response() route deferred intra-process responses here.
+      pending->sequence_number = next_sequence_number_--;
+      queue_.push_back(pending);
+    }
+    gc_.trigger();
+    invoke_on_new_request();
+  }
+
+  std::shared_ptr<void>
+  take_data() override
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) {
+      return nullptr;
+    }
+    auto pending = std::move(queue_.front());
+    queue_.pop_front();
+    return std::static_pointer_cast<void>(pending);
+  }
+
+  std::shared_ptr<void>
+  take_data_by_entity_id(size_t id) override
+  {
+    (void)id;
+    return take_data();
+  }
+
+  void
+  execute(std::shared_ptr<void> & data) override
+  {
+    auto pending = std::static_pointer_cast<PendingRequest>(data);
+    if (!pending) {
+      return;
+    }
+    auto request_header = std::make_shared<rmw_request_id_t>();
+    *request_header = rmw_request_id_t();
+    request_header->sequence_number = pending->sequence_number;
+    {
+      // Registered before dispatching, so a callback deferring the response
+      // can complete it from inside the callback if it wants to.
+      std::lock_guard<std::mutex> lock(mutex_);
+      in_flight_.emplace(pending->sequence_number, std::move(pending->on_response));
+    }
+    auto response = dispatch_(std::move(request_header), std::move(pending->request));
+    if (response) {
+      complete_request(pending->sequence_number, std::move(response));
+    }
+    // Otherwise the response was deferred; the completion stays in
+    // in_flight_ until send_response() routes it back here.
+  }
+
+  /// Complete a pending request, delivering the response to the client.
+  /**
+   * \param[in] sequence_number the intra-process sequence number assigned in
+   *   queue_request().
+   * \param[in] response the typed response.
+   * \return true if a request with that sequence number was pending.
+   */
+  bool
+  complete_request(int64_t sequence_number, SharedResponse response)
+  {
+    CompletionCallback on_response;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = in_flight_.find(sequence_number);
+      if (it == in_flight_.end()) {
+        return false;
+      }
+      on_response = std::move(it->second);
+      in_flight_.erase(it);
+    }
+    if (on_response) {
+      on_response(std::move(response));
+    }
+    return true;
+  }
+
+  /// Set a callback to be called when each new request arrives.
+  /** \sa rclcpp::Waitable::set_on_ready_callback */
+  void
+  set_on_ready_callback(std::function<void(size_t, int)> callback) override
+  {
+    if (!callback) {
+      throw std::invalid_argument(
+              "The callback passed to set_on_ready_callback "
+              "is not callable.");
+    }
+
+    auto new_callback =
+      [callback, this](size_t number_of_events) {
+        try {
+          callback(number_of_events, static_cast<int>(EntityType::Service));
+        } catch (const std::exception & exception) {
+          RCLCPP_ERROR_STREAM(
+            rclcpp::get_logger("rclcpp"),
+            "rclcpp::experimental::ServiceIntraProcess@" << this <<
+              " caught " << rmw::impl::cpp::demangle(exception) <<
+              " exception in user-provided callback for the 'on ready' callback: " <<
+              exception.what());
+        } catch (...) {
+          RCLCPP_ERROR_STREAM(
+            rclcpp::get_logger("rclcpp"),
+            "rclcpp::experimental::ServiceIntraProcess@" << this <<
+              " caught unhandled exception in user-provided callback " <<
+              "for the 'on ready' callback");
+        }
+      };
+
+    std::lock_guard<std::recursive_mutex> lock(callback_mutex_);
+    on_new_request_callback_ = new_callback;
+
+    if (unread_count_ > 0) {
+      on_new_request_callback_(unread_count_);
+      unread_count_ = 0;
+    }
+  }
+
+  /// Unset the callback registered for new requests, if any.
+  void
+  clear_on_ready_callback() override
+  {
+    std::lock_guard<std::recursive_mutex> lock(callback_mutex_);
+    on_new_request_callback_ = nullptr;
+  }
+
+private:
+  struct PendingRequest
+  {
+    int64_t sequence_number{0};
+    SharedRequest request;
+    CompletionCallback on_response;
+  };
+
+  void
+  invoke_on_new_request()
+  {
+    std::lock_guard<std::recursive_mutex> lock(callback_mutex_);
+    if (on_new_request_callback_) {
+      on_new_request_callback_(1);
+    } else {
+      unread_count_++;
+    }
+  }
+
+  rclcpp::GuardCondition gc_;
+  DispatchCallback dispatch_;
+
+  std::mutex mutex_;
+  std::deque<std::shared_ptr<PendingRequest>> queue_;
+  std::unordered_map<int64_t, CompletionCallback> in_flight_;
+  // Start below -1, which the client side reserves as a sentinel.
+  int64_t next_sequence_number_{-2};
+
+  std::recursive_mutex callback_mutex_;
+  std::function<void(size_t)> on_new_request_callback_ {nullptr};
+  size_t unread_count_{0};
+};
+
+}  // namespace experimental
+}  // namespace rclcpp
+
+#endif  // RCLCPP__EXPERIMENTAL__SERVICE_INTRA_PROCESS_HPP_
@@ -19,13 +19,17 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <utility>
 
 #include "rcl/wait.h"
 #include "rmw/impl/cpp/demangle.hpp"
 
 #include "rclcpp/guard_condition.hpp"
+#include "rclcpp/introspection.hpp"
 #include "rclcpp/logging.hpp"
+#include "rclcpp/interned_qos.hpp"
 #include "rclcpp/qos.hpp"
+#include "rclcpp/topic_name.hpp"
 #include "rclcpp/waitable.hpp"
 
 namespace rclcpp
@@ -48,7 +52,8 @@ public:
     rclcpp::Context::SharedPtr context,
     const std::string & topic_name,
     const rclcpp::QoS & qos_profile)
-  : gc_(context), topic_name_(topic_name), qos_profile_(qos_profile)
+  : gc_(context), topic_name_(topic_name), interned_topic_name_(topic_name),
+    qos_profile_(qos_profile), interned_qos_profile_(qos_profile)
   {}
 
   RCLCPP_PUBLIC
@@ -91,10 +96,46 @@ public:
   const char *
   get_topic_name() const;
 
+  /// Get the interned topic name, comparable by pointer against other
+  /// interned names.
+  RCLCPP_PUBLIC
+  const rclcpp::TopicName &
+  get_interned_topic_name() const;
+
   RCLCPP_PUBLIC
   QoS
   get_actual_qos() const;
 
+  /// Get the interned QoS profile, comparable by pointer against other
+  /// interned profiles.
+  RCLCPP_PUBLIC
+  const rclcpp::InternedQoS &
+  get_interned_actual_qos() const
+  {
+    return interned_qos_profile_;
+  }
+
+  /// Attach the owning subscription's introspection counter block.
+  /**
+   * Intra-process deliveries and buffer overwrites are then counted in the
+   * same block as the subscription's inter-process traffic.
+   *
+   * \param[in] counters the subscription's counter block.
+   */
+  virtual
+  void
+  set_introspection_counters(std::shared_ptr<rclcpp::introspection::EntityCounters> counters)
+  {
+    introspection_counters_ = std::move(counters);
+  }
+
+  /// Get the attached introspection counter block, may be nullptr.
+  std::shared_ptr<rclcpp::introspection::EntityCounters>
+  get_introspection_counters() const
+  {
+    return introspection_counters_;
+  }
+
   /// Set a callback to be called when each new message arrives.
   /**
    * The callback receives a size_t which is the number of messages received
@@ -181,6 +222,7 @@ protected:
   std::function<void(size_t)> on_new_message_callback_ {nullptr};
   size_t unread_count_{0};
   rclcpp::GuardCondition gc_;
+  std::shared_ptr<rclcpp::introspection::EntityCounters> introspection_counters_;
 
   virtual void
   trigger_guard_condition() = 0;
@@ -198,7 +240,9 @@ protected:
 
 private:
   std::string topic_name_;
+  rclcpp::TopicName interned_topic_name_;
   QoS qos_profile_;
+  rclcpp::InternedQoS interned_qos_profile_;
 };
 
 }  // namespace experimental
@@ -15,7 +15,12 @@
 #ifndef RCLCPP__EXPERIMENTAL__SUBSCRIPTION_INTRA_PROCESS_BUFFER_HPP_
 #define RCLCPP__EXPERIMENTAL__SUBSCRIPTION_INTRA_PROCESS_BUFFER_HPP_
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <stdexcept>
 #include <utility>
@@ -28,6 +33,7 @@
 #include "rclcpp/experimental/create_intra_process_buffer.hpp"
 #include "rclcpp/experimental/subscription_intra_process_base.hpp"
 #include "rclcpp/experimental/ros_message_intra_process_buffer.hpp"
+#include "rclcpp/intra_process_buffer_full_policy.hpp"
 #include "rclcpp/qos.hpp"
 #include "rclcpp/type_support_decl.hpp"
 
@@ -121,14 +127,40 @@ public:
     }
   }
 
+  /// Set a content filter predicate evaluated before buffer insertion.
+  /**
+   * Messages rejected by the predicate are dropped at publish time, before
+   * they are inserted into the intra-process buffer, so they never trigger
+   * the guard condition or wake an executor.
+   *
+   * \param[in] predicate Return true to accept the message, false to drop it.
+   *   Pass nullptr to clear the filter.
+   */
+  void
+  set_content_filter(std::function<bool(const SubscribedType &)> predicate)
+  {
+    auto predicate_ptr = predicate ?
+      std::make_shared<const std::function<bool(const SubscribedType &)>>(std::move(predicate)) :
+      nullptr;
+    std::lock_guard<std::mutex> lock(content_filter_mutex_);
+    content_filter_ = std::move(predicate_ptr);
+  }
+
   void
   provide_intra_process_message(ConstMessageSharedPtr message) override
   {
     if constexpr (std::is_same<SubscribedType, ROSMessageType>::value) {
+      if (!matches_content_filter(*message)) {
+        return;
+      }
       buffer_->add_shared(std::move(message));
       trigger_guard_condition();
     } else {
-      buffer_->add_shared(convert_ros_message_to_subscribed_type_unique_ptr(*message));
+      auto converted = convert_ros_message_to_subscribed_type_unique_ptr(*message);
+      if (!matches_content_filter(*converted)) {
+        return;
+      }
+      buffer_->add_shared(std::move(converted));
       trigger_guard_condition();
     }
     this->invoke_on_new_message();
@@ -138,10 +170,17 @@ public:
   provide_intra_process_message(MessageUniquePtr message) override
   {
     if constexpr (std::is_same<SubscribedType, ROSMessageType>::value) {
+      if (!matches_content_filter(*message)) {
+        return;
+      }
       buffer_->add_unique(std::move(message));
       trigger_guard_condition();
     } else {
-      buffer_->add_unique(convert_ros_message_to_subscribed_type_unique_ptr(*message));
+      auto converted = convert_ros_message_to_subscribed_type_unique_ptr(*message);
+      if (!matches_content_filter(*converted)) {
+        return;
+      }
+      buffer_->add_unique(std::move(converted));
       trigger_guard_condition();
     }
     this->invoke_on_new_message();
@@ -150,6 +189,9 @@ public:
   void
   provide_intra_process_data(ConstDataSharedPtr message)
   {
+    if (!matches_content_filter(*message)) {
+      return;
+    }
     buffer_->add_shared(std::move(message));
     trigger_guard_condition();
     this->invoke_on_new_message();
@@ -158,6 +200,9 @@ public:
   void
   provide_intra_process_data(SubscribedTypeUniquePtr message)
   {
+    if (!matches_content_filter(*message)) {
+      return;
+    }
     buffer_->add_unique(std::move(message));
     trigger_guard_condition();
     this->invoke_on_new_message();
@@ -174,6 +219,28 @@ public:
     return buffer_->available_capacity();
   }
 
+  /// Set the behavior of the intra-process buffer when it is full.
+  /** \sa rclcpp::experimental::buffers::BufferImplementationBase::set_full_policy */
+  void
+  set_buffer_full_policy(
+    rclcpp::IntraProcessBufferFullPolicy policy,
+    std::chrono::nanoseconds timeout)
+  {
+    buffer_->set_full_policy(policy, timeout);
+  }
+
+  void
+  set_introspection_counters(
+    std::shared_ptr<rclcpp::introspection::EntityCounters> counters) override
+  {
+    if (counters) {
+      // Alias the overwrite counter so the buffer keeps the block alive.
+      buffer_->set_overwrite_counter(
+        std::shared_ptr<std::atomic<uint64_t>>(counters, &counters->buffer_overwrites));
+    }
+    SubscriptionIntraProcessBase::set_introspection_counters(std::move(counters));
+  }
+
 protected:
   void
   trigger_guard_condition() override
@@ -181,9 +248,23 @@ protected:
     this->gc_.trigger();
   }
 
+  bool
+  matches_content_filter(const SubscribedType & message) const
+  {
+    std::shared_ptr<const std::function<bool(const SubscribedType &)>> predicate;
+    {
+      std::lock_guard<std::mutex> lock(content_filter_mutex_);
+      predicate = content_filter_;
+    }
+    return !predicate || (*predicate)(message);
+  }
+
   BufferUniquePtr buffer_;
   SubscribedTypeAllocator subscribed_type_allocator_;
   SubscribedTypeDeleter subscribed_type_deleter_;
+  // Publish-time fallback content filter; shared_ptr so evaluation does not hold the mutex.
+  mutable std::mutex content_filter_mutex_;
+  std::shared_ptr<const std::function<bool(const SubscribedType &)>> content_filter_;
 };
 
 }  // namespace experimental
@@ -16,17 +16,22 @@
 #define RCLCPP__EXPERIMENTAL__TIMERS_MANAGER_HPP_
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <thread>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "rclcpp/context.hpp"
+#include "rclcpp/thread_attributes.hpp"
 #include "rclcpp/timer.hpp"
 
 namespace rclcpp
@@ -67,6 +72,22 @@ class TimersManager
 public:
   RCLCPP_SMART_PTR_DEFINITIONS_NOT_COPYABLE(TimersManager)
 
+  /**
+   * @brief Storage backends available for the timers.
+   */
+  enum class TimersStorage
+  {
+    /// Binary heap ordered by trigger time. This is the default and the best
+    /// choice for applications with a small number of timers.
+    HEAP,
+    /// Hierarchical timer wheel. Insertion and removal are O(1) and all the
+    /// timers expiring in the same wakeup are dispatched as a single batch,
+    /// which makes it better suited to large numbers of short-period timers.
+    /// Trigger times are quantized to the wheel resolution (1 millisecond),
+    /// so timers may be executed up to one resolution step after their deadline.
+    WHEEL
+  };
+
   /**
    * @brief Construct a new TimersManager object
    *
@@ -82,11 +103,36 @@ public:
    * or `execute_ready_timer`) without the TimersManager being `running`, i.e.
    * without actually explicitly waiting for the timer to become ready, will ignore this
    * callback.
+   * @param thread_attributes attributes applied to the timers thread when it is started.
+   * @param storage the storage backend used for the timers, see `TimersStorage`.
+   * @param timer_slack coalescing window applied when sleeping until the next timer:
+   * the timers thread oversleeps its deadline by up to this amount, so every timer
+   * due within the window is gathered into a single wakeup and executed back-to-back.
+   * This trades up to `timer_slack` of extra latency per timer for fewer wakeups,
+   * which pays off with many loosely phased periodic timers.
+   * The default of zero keeps the exact per-deadline wakeup behavior.
+   * @param num_timer_threads number of internal shards, each with its own storage
+   * and its own timers thread once `start` is called. With more than one shard a
+   * slow timer callback only delays the timers sharing its shard, not every timer.
+   * The default of one keeps the single-thread behavior.
+   * @param shard_period_boundaries when sharding, how timers are partitioned:
+   * ascending period boundaries, one less than the number of shards. A timer goes
+   * to the first shard whose boundary its period is below; timers with a period at
+   * or above the last boundary go to the last shard. When empty, timers are
+   * assigned round-robin.
+   * @throws std::invalid_argument if `num_timer_threads` is zero, or if
+   * `shard_period_boundaries` is non-empty and is not ascending or its size is not
+   * `num_timer_threads - 1`.
    */
   RCLCPP_PUBLIC
   TimersManager(
     std::shared_ptr<rclcpp::Context> context,
-    std::function<void(const rclcpp::TimerBase *)> on_ready_callback = nullptr);
+    std::function<void(const rclcpp::TimerBase *)> on_ready_callback = nullptr,
+    std::optional<rclcpp::ThreadAttributes> thread_attributes = std::nullopt,
+    TimersStorage storage = TimersStorage::HEAP,
+    std::chrono::nanoseconds timer_slack = std::chrono::nanoseconds::zero(),
+    size_t num_timer_threads = 1,
+    std::vector<std::chrono::nanoseconds> shard_period_boundaries = {});
 
   /**
    * @brief Destruct the TimersManager object making sure to stop thread and release memory.
@@ -502,12 +548,406 @@ private:
     std::vector<TimerPtr> owned_heap_;
   };
 
+  /**
+   * @brief Hierarchical timer wheel, used as an alternative storage to the timers heap.
+   * Timers are stored as weak pointers in a registry indexed by their raw pointer and
+   * scheduled into wheel slots according to their trigger time, quantized to the wheel
+   * resolution. Insertion and removal are O(1): removal just erases the registry entry
+   * and leaves the slot entry behind as stale, to be discarded when its slot is reached.
+   * Timers whose trigger time moved (e.g. after a reset) are lazily re-slotted, either
+   * by `refresh_if_dirty()` or when their original slot expires.
+   * This class is not thread safe and requires external mutexes to protect its usage.
+   */
+  class TimerWheel
+  {
+public:
+    TimerWheel()
+    : epoch_(std::chrono::steady_clock::now())
+    {}
+
+    /**
+     * @brief Add a new timer to the wheel.
+     * @param timer new timer to add.
+     * @return true if timer has been added, false if it was already there.
+     */
+    bool add_timer(TimerPtr timer)
+    {
+      const rclcpp::TimerBase * timer_id = timer.get();
+      if (registry_.count(timer_id) != 0) {
+        return false;
+      }
+      const uint64_t tick = this->deadline_tick(timer);
+      registry_[timer_id] = Entry{timer, tick};
+      if (tick != kNeverTick) {
+        this->place(timer_id, tick);
+      }
+      return true;
+    }
+
+    /**
+     * @brief Remove a timer from the wheel.
+     * The slot entry is left behind as stale and discarded when its slot is reached.
+     * @param timer timer to remove.
+     * @return true if timer has been removed, false if it was not there.
+     */
+    bool remove_timer(const TimerPtr & timer)
+    {
+      return registry_.erase(timer.get()) != 0;
+    }
+
+    /**
+     * @brief Retrieve the timer identified by the key
+     * @param timer_id The ID of the timer to retrieve.
+     * @return TimerPtr if there's a timer associated with the ID, nullptr otherwise
+     */
+    TimerPtr get_timer(const rclcpp::TimerBase * timer_id) const
+    {
+      auto it = registry_.find(timer_id);
+      if (it == registry_.end()) {
+        return nullptr;
+      }
+      return it->second.timer.lock();
+    }
+
+    /**
+     * @brief Returns the timer with the earliest trigger time, locking all timers to
+     * find it. This is only meant to be used while the timers thread is not running.
+     * @return TimerPtr earliest timer, or nullptr if the wheel is empty.
+     */
+    TimerPtr head_timer() const
+    {
+      TimerPtr head;
+      auto head_delta = std::chrono::nanoseconds::max();
+      for (const auto & entry : registry_) {
+        auto timer = entry.second.timer.lock();
+        if (!timer) {
+          continue;
+        }
+        auto delta = timer->time_until_trigger();
+        if (!head || delta < head_delta) {
+          head = std::move(timer);
+          head_delta = delta;
+        }
+      }
+      return head;
+    }
+
+    /**
+     * @brief Returns whether the wheel is empty or not.
+     */
+    bool empty() const
+    {
+      return registry_.empty();
+    }
+
+    /**
+     * @brief Get the number of timers that are currently ready.
+     * @return size_t number of ready timers.
+     */
+    size_t get_number_ready_timers() const
+    {
+      size_t ready_timers = 0;
+      for (const auto & entry : registry_) {
+        auto timer = entry.second.timer.lock();
+        if (timer && timer->is_ready()) {
+          ready_timers++;
+        }
+      }
+      return ready_timers;
+    }
+
+    /**
+     * @brief Mark the wheel as needing a refresh, i.e. some timer may have a trigger
+     * time that doesn't match the slot it was scheduled into (e.g. it has been reset).
+     */
+    void mark_dirty()
+    {
+      dirty_ = true;
+    }
+
+    /**
+     * @brief Re-slot the timers whose trigger time moved earlier than scheduled and
+     * drop registry entries for timers that went out of scope.
+     * Does nothing unless `mark_dirty()` has been called since the last refresh.
+     */
+    void refresh_if_dirty()
+    {
+      if (!dirty_) {
+        return;
+      }
+      dirty_ = false;
+      auto it = registry_.begin();
+      while (it != registry_.end()) {
+        auto timer = it->second.timer.lock();
+        if (!timer) {
+          it = registry_.erase(it);
+          continue;
+        }
+        const uint64_t tick = this->deadline_tick(timer);
+        if (tick < it->second.tick) {
+          // The timer now triggers earlier than scheduled: re-slot it.
+          // The old slot entry becomes stale and is skipped when reached.
+          it->second.tick = tick;
+          if (tick != kNeverTick) {
+            this->place(it->first, tick);
+          }
+        }
+        ++it;
+      }
+    }
+
+    /**
+     * @brief Get the amount of time before the next scheduled slot expires.
+     * @return std::chrono::nanoseconds to wait, zero if there are slots pending
+     * processing or std::chrono::nanoseconds::max() if no timer is scheduled.
+     */
+    std::chrono::nanoseconds time_until_next() const
+    {
+      if (registry_.empty()) {
+        return std::chrono::nanoseconds::max();
+      }
+      if (this->now_tick() > current_tick_) {
+        // There are elapsed ticks that have not been processed yet.
+        return std::chrono::nanoseconds::zero();
+      }
+      // Scan the level-0 window for the next scheduled slot.
+      for (uint64_t t = current_tick_ + 1; t <= current_tick_ + kSlots; t++) {
+        if (!slots_[0][t & kSlotsMask].empty()) {
+          return this->time_to_tick(t);
+        }
+      }
+      // Nothing in the level-0 window: wake up at the cascade boundary of the
+      // first higher-level slot that holds entries.
+      for (size_t level = 1; level < kLevels; level++) {
+        const size_t shift = level * kSlotsBits;
+        const uint64_t base = current_tick_ >> shift;
+        for (uint64_t s = base + 1; s <= base + kSlots; s++) {
+          if (!slots_[level][s & kSlotsMask].empty()) {
+            return this->time_to_tick(s << shift);
+          }
+        }
+      }
+      // Only parked timers (e.g. cancelled) remain: wait for a notification.
+      return std::chrono::nanoseconds::max();
+    }
+
+    /**
+     * @brief Advance the wheel up to the current time, collecting the timers of all
+     * the elapsed slots as a single batch.
+     * Stale entries are discarded and timers that are not ready (their trigger time
+     * moved later after they were slotted) are re-slotted rather than collected.
+     * @param expired output, the timers that are ready to be executed.
+     */
+    void collect_expired(std::vector<TimerPtr> & expired)
+    {
+      const uint64_t target_tick = this->now_tick();
+      if (registry_.empty()) {
+        current_tick_ = target_tick;
+        return;
+      }
+      while (current_tick_ < target_tick) {
+        current_tick_++;
+        const uint64_t t = current_tick_;
+        // Cascade the higher-level slots whose window boundary is being crossed,
+        // before draining level 0, so that their due entries land in this tick's slot.
+        for (size_t level = 1; level < kLevels; level++) {
+          const size_t shift = level * kSlotsBits;
+          if ((t & ((static_cast<uint64_t>(1) << shift) - 1)) != 0) {
+            break;
+          }
+          scratch_.swap(slots_[level][(t >> shift) & kSlotsMask]);
+          for (const SlotEntry & entry : scratch_) {
+            if (this->is_current(entry)) {
+              this->place(entry.id, std::max(entry.tick, t));
+            }
+          }
+          scratch_.clear();
+        }
+        // Drain the level-0 slot for this tick.
+        scratch_.swap(slots_[0][t & kSlotsMask]);
+        for (const SlotEntry & entry : scratch_) {
+          auto it = registry_.find(entry.id);
+          if (it == registry_.end() || it->second.tick != entry.tick) {
+            // Stale: the timer was removed or re-slotted.
+            continue;
+          }
+          auto timer = it->second.timer.lock();
+          if (!timer) {
+            registry_.erase(it);
+            continue;
+          }
+          if (entry.tick > t) {
+            // Not due yet, this entry wrapped around the level-0 window.
+            this->place(entry.id, entry.tick);
+            continue;
+          }
+          if (!timer->is_ready()) {
+            // The trigger time moved later after the timer was slotted.
+            const uint64_t tick = this->deadline_tick(timer);
+            it->second.tick = tick;
+            if (tick != kNeverTick) {
+              this->place(entry.id, tick);
+            }
+            continue;
+          }
+          expired.push_back(std::move(timer));
+        }
+        scratch_.clear();
+      }
+    }
+
+    /**
+     * @brief Schedule a timer into the slot matching its current trigger time.
+     * To be called after a collected timer has been triggered.
+     * Does nothing if the timer has been removed in the meantime.
+     * @param timer the timer to reschedule.
+     */
+    void reschedule(const TimerPtr & timer)
+    {
+      auto it = registry_.find(timer.get());
+      if (it == registry_.end()) {
+        return;
+      }
+      const uint64_t tick = this->deadline_tick(timer);
+      it->second.tick = tick;
+      if (tick != kNeverTick) {
+        this->place(timer.get(), tick);
+      }
+    }
+
+    /**
+     * @brief Helper function to clear the "on_reset_callback" on all associated timers.
+     */
+    void clear_timers_on_reset_callbacks()
+    {
+      for (const auto & entry : registry_) {
+        auto timer = entry.second.timer.lock();
+        if (timer) {
+          timer->clear_on_reset_callback();
+        }
+      }
+    }
+
+    /**
+     * @brief Remove all timers from the wheel.
+     */
+    void clear()
+    {
+      registry_.clear();
+      for (auto & level : slots_) {
+        for (auto & slot : level) {
+          slot.clear();
+        }
+      }
+    }
+
+private:
+    // 4 levels of 64 slots each cover 2^24 ticks, i.e. more than 4 hours at the
+    // default resolution; farther deadlines wrap in the top level and cascade.
+    static constexpr size_t kSlotsBits = 6;
+    static constexpr size_t kSlots = static_cast<size_t>(1) << kSlotsBits;
+    static constexpr size_t kSlotsMask = kSlots - 1;
+    static constexpr size_t kLevels = 4;
+    // Tick used for timers without a trigger time (e.g. cancelled timers).
+    static constexpr uint64_t kNeverTick = UINT64_MAX;
+
+    /// A timer known to the wheel, with the tick its current slot entry refers to.
+    struct Entry
+    {
+      WeakTimerPtr timer;
+      uint64_t tick;
+    };
+
+    /// A scheduled expiration; stale if the registry tick doesn't match anymore.
+    struct SlotEntry
+    {
+      const rclcpp::TimerBase * id;
+      uint64_t tick;
+    };
+
+    /// Number of ticks elapsed since the wheel was created.
+    uint64_t now_tick() const
+    {
+      const auto elapsed = std::chrono::steady_clock::now() - epoch_;
+      return static_cast<uint64_t>(elapsed / kResolution);
+    }
+
+    /// Time from now until the given tick starts, clamped to zero.
+    std::chrono::nanoseconds time_to_tick(uint64_t tick) const
+    {
+      const auto when = epoch_ + static_cast<int64_t>(tick) * kResolution;
+      const auto delta = when - std::chrono::steady_clock::now();
+      return std::max(std::chrono::nanoseconds(delta), std::chrono::nanoseconds::zero());
+    }
+
+    /// Tick at which the timer should trigger, always past the current tick.
+    uint64_t deadline_tick(const TimerPtr & timer) const
+    {
+      const auto delta = timer->time_until_trigger();
+      if (delta == std::chrono::nanoseconds::max()) {
+        return kNeverTick;
+      }
+      uint64_t tick = this->now_tick();
+      if (delta > std::chrono::nanoseconds::zero()) {
+        // Round up so that timers are never collected before their trigger time.
+        tick += (static_cast<uint64_t>(delta.count()) + kResolution.count() - 1) /
+          kResolution.count();
+      }
+      return std::max(tick, current_tick_ + 1);
+    }
+
+    /// Whether a slot entry still matches the registry, i.e. it is not stale.
+    bool is_current(const SlotEntry & entry) const
+    {
+      auto it = registry_.find(entry.id);
+      return it != registry_.end() && it->second.tick == entry.tick;
+    }
+
+    /// Insert a slot entry at the level matching its distance from the current tick.
+    void place(const rclcpp::TimerBase * timer_id, uint64_t tick)
+    {
+      const uint64_t delta = tick - current_tick_;
+      size_t level = 0;
+      while (level + 1 < kLevels &&
+        delta >= (static_cast<uint64_t>(kSlots) << (level * kSlotsBits)))
+      {
+        level++;
+      }
+      slots_[level][(tick >> (level * kSlotsBits)) & kSlotsMask].push_back({timer_id, tick});
+    }
+
+    static constexpr std::chrono::nanoseconds kResolution = std::chrono::milliseconds(1);
+
+    // Time corresponding to tick 0.
+    std::chrono::steady_clock::time_point epoch_;
+    // Last tick whose slot has been drained.
+    uint64_t current_tick_ {0};
+    // Whether some timer may need to be re-slotted, see `mark_dirty()`.
+    bool dirty_ {false};
+    // All the timers known to the wheel, keyed by the raw pointer used as timer ID.
+    std::unordered_map<const rclcpp::TimerBase *, Entry> registry_;
+    // The wheel itself: per-level circular arrays of slots.
+    std::array<std::array<std::vector<SlotEntry>, kSlots>, kLevels> slots_;
+    // Scratch vector reused while draining and cascading slots.
+    std::vector<SlotEntry> scratch_;
+  };
+
   /**
    * @brief Implements a loop that keeps executing ready timers.
    * This function is executed in the timers thread.
    */
   void run_timers();
 
+  /**
+   * @brief Select the shard a new timer belongs to, either by period class or
+   * round-robin when no period boundaries were given.
+   * This function is not thread safe, acquire the timers_mutex_ before calling it.
+   *
+   * @param timer the timer being added.
+   * @return the shard index.
+   */
+  size_t select_shard(const TimerPtr & timer);
+
   /**
    * @brief Get the amount of time before the next timer triggers.
    * This function is not thread safe, acquire a mutex before calling it.
@@ -531,6 +971,9 @@ private:
 
   // Thread used to run the timers execution task
   std::thread timers_thread_;
+
+  // Attributes applied to the timers thread when it is started.
+  std::optional<rclcpp::ThreadAttributes> thread_attributes_;
   // Protects access to timers
   std::mutex timers_mutex_;
   // Protects access to stop()
@@ -539,12 +982,36 @@ private:
   std::condition_variable timers_cv_;
   // Flag used as predicate by timers_cv_ that denotes one or more timers being added/removed
   bool timers_updated_ {false};
+  // Whether some heap timer may be out of order, e.g. after its period was
+  // exchanged in place; fixed up lazily with a single heapify
+  bool heap_dirty_ {false};
   // Indicates whether the timers thread is currently running or not
   std::atomic<bool> running_ {false};
   // Parent context used to understand if ROS is still active
   std::shared_ptr<rclcpp::Context> context_;
-  // Timers heap storage with weak ownership
+  // Which of the storage backends below is in use
+  TimersStorage storage_ {TimersStorage::HEAP};
+  // Coalescing window: how long past its deadline the timers thread may oversleep
+  // to gather nearby expirations into one wakeup, zero to wake per deadline
+  std::chrono::nanoseconds timer_slack_ {std::chrono::nanoseconds::zero()};
+  // Timers heap storage with weak ownership, used with `TimersStorage::HEAP`
   WeakTimersHeap weak_timers_heap_;
+  // Timer wheel storage with weak ownership, used with `TimersStorage::WHEEL`
+  TimerWheel timer_wheel_;
+  // Batch of expired timers collected from the wheel, reused across wakeups
+  std::vector<TimerPtr> expired_timers_;
+  // Single-threaded child managers timers are routed to when sharding is
+  // enabled; empty in the default single-thread configuration, in which
+  // case the storage members above are used directly
+  std::vector<TimersManager::UniquePtr> shards_;
+  // Ascending period boundaries partitioning timers across shards, empty
+  // for round-robin assignment
+  std::vector<std::chrono::nanoseconds> shard_period_boundaries_;
+  // Which shard each routed timer was assigned to, so that removal and
+  // execution by ID reach the right shard; guarded by timers_mutex_
+  std::unordered_map<const rclcpp::TimerBase *, size_t> shard_assignment_;
+  // Next shard for round-robin assignment; guarded by timers_mutex_
+  size_t next_shard_ {0};
 };
 
 }  // namespace experimental
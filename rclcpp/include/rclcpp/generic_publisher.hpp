@@ -16,8 +16,12 @@
 #ifndef RCLCPP__GENERIC_PUBLISHER_HPP_
 #define RCLCPP__GENERIC_PUBLISHER_HPP_
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 #include "rcpputils/shared_library.hpp"
 
@@ -28,6 +32,7 @@
 #include "rclcpp/publisher_base.hpp"
 #include "rclcpp/qos.hpp"
 #include "rclcpp/serialized_message.hpp"
+#include "rclcpp/serialized_message_codec.hpp"
 #include "rclcpp/typesupport_helpers.hpp"
 #include "rclcpp/visibility_control.hpp"
 
@@ -36,6 +41,23 @@
 namespace rclcpp
 {
 
+/// Non-owning view of a serialized message buffer.
+/**
+ * Used with GenericPublisher::publish_batch() to publish directly out of externally
+ * owned storage (e.g. a memory-mapped bag file) without first copying each message
+ * into a rclcpp::SerializedMessage.
+ *
+ * Not to be confused with rclcpp::SerializedMessageView, which is an owning,
+ * returnable view over a subscription's take buffer.
+ */
+struct SerializedBufferView
+{
+  /// Pointer to the serialized message payload, not owned by the view.
+  const uint8_t * data;
+  /// Size of the serialized message payload in bytes.
+  size_t size;
+};
+
 /// %Publisher for serialized messages whose type is not known at compile time.
 /**
  * Since the type is not known at compile time, this is not a template, and the dynamic library
@@ -89,9 +111,55 @@ public:
   virtual ~GenericPublisher() = default;
 
   /// Publish a rclcpp::SerializedMessage.
+  /**
+   * If a codec was set with set_codec(), the payload is encoded into an
+   * internal scratch buffer first and the encoded payload is published; the
+   * given message is left untouched either way.
+   */
   RCLCPP_PUBLIC
   void publish(const rclcpp::SerializedMessage & message);
 
+  /// Set a codec applied to each payload before it is published.
+  /**
+   * Subscribers of the topic must decode with a matching codec, so this is
+   * meant for topics consumed through a GenericSubscription with the same
+   * codec set, e.g. to compress traffic over a constrained link.
+   * The codec stage only applies to publish(); publish_batch() and
+   * publish_as_loaned_msg() hand payloads to the middleware unencoded.
+   *
+   * This is not thread-safe with respect to concurrent publishes; set the
+   * codec before the publisher is used.
+   *
+   * \param[in] codec The codec to encode with, nullptr to remove the stage.
+   */
+  RCLCPP_PUBLIC
+  void set_codec(rclcpp::SerializedMessageCodec::SharedPtr codec);
+
+  /// Publish a batch of serialized messages from non-owning buffer views.
+  /**
+   * The views alias externally owned storage; the payloads are handed to the
+   * middleware without being copied, so the buffers only need to stay valid for
+   * the duration of this call.
+   * Per-publish setup is done once for the whole batch, which amortizes the
+   * overhead when replaying high message rates.
+   *
+   * \param views Pointer to the first of `count` contiguous message views.
+   * \param count Number of messages to publish.
+   * \throws anything rclcpp::exceptions::throw_from_rcl_error can show
+   */
+  RCLCPP_PUBLIC
+  void publish_batch(const SerializedBufferView * views, size_t count);
+
+  /// Publish a batch of serialized messages from non-owning buffer views.
+  /**
+   * Convenience overload of publish_batch(const SerializedBufferView *, size_t).
+   *
+   * \param views Views of the messages to publish, in order.
+   * \throws anything rclcpp::exceptions::throw_from_rcl_error can show
+   */
+  RCLCPP_PUBLIC
+  void publish_batch(const std::vector<SerializedBufferView> & views);
+
   /**
    * Publish a rclcpp::SerializedMessage via loaned message after de-serialization.
    *
@@ -105,6 +173,13 @@ private:
   // The type support library should stay loaded, so it is stored in the GenericPublisher
   std::shared_ptr<rcpputils::SharedLibrary> ts_lib_;
 
+  // Optional codec stage, see set_codec(). The mutex serializes concurrent
+  // publishes through the one scratch buffer the codec encodes into.
+  rclcpp::SerializedMessageCodec::SharedPtr codec_;
+  rclcpp::SerializedMessage codec_buffer_;
+  std::mutex codec_mutex_;
+
+  void do_publish(const rclcpp::SerializedMessage & message);
   void * borrow_loaned_message();
   void deserialize_message(
     const rmw_serialized_message_t & serialized_message,
@@ -18,7 +18,10 @@
 
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "rcpputils/shared_library.hpp"
 
@@ -28,6 +31,8 @@
 #include "rclcpp/node_interfaces/node_topics_interface.hpp"
 #include "rclcpp/qos.hpp"
 #include "rclcpp/serialized_message.hpp"
+#include "rclcpp/serialized_message_codec.hpp"
+#include "rclcpp/serialized_message_view.hpp"
 #include "rclcpp/subscription_base.hpp"
 #include "rclcpp/typesupport_helpers.hpp"
 #include "rclcpp/visibility_control.hpp"
@@ -89,9 +94,65 @@ public:
     ts_lib_(ts_lib)
   {}
 
+  /// Constructor for a borrowed-view callback.
+  /**
+   * Identical to the other constructor, except that new messages are handed to
+   * the callback as a SerializedMessageView borrowing the subscription's take
+   * buffer, instead of as an owning SerializedMessage. Take buffers are pooled
+   * and reused once the view is destroyed, so dispatching a message does not
+   * perform a per-message heap allocation and the payload is never copied.
+   *
+   * \param node_base Pointer to parent node's NodeBaseInterface
+   * \param ts_lib Type support library, needs to correspond to topic_type
+   * \param topic_name Topic name
+   * \param topic_type Topic type
+   * \param qos %QoS settings
+   * \param callback Callback for a borrowed view of new serialized messages
+   * \param options %Subscription options.
+   * Not all subscription options are currently respected, the only relevant options for this
+   * subscription are `event_callbacks`, `use_default_callbacks`, `ignore_local_publications`, and
+   * `%callback_group`.
+   */
+  template<typename AllocatorT = std::allocator<void>>
+  GenericSubscription(
+    rclcpp::node_interfaces::NodeBaseInterface * node_base,
+    const std::shared_ptr<rcpputils::SharedLibrary> ts_lib,
+    const std::string & topic_name,
+    const std::string & topic_type,
+    const rclcpp::QoS & qos,
+    std::function<void(rclcpp::SerializedMessageView)> callback,
+    const rclcpp::SubscriptionOptionsWithAllocator<AllocatorT> & options)
+  : SubscriptionBase(
+      node_base,
+      *rclcpp::get_typesupport_handle(topic_type, "rosidl_typesupport_cpp", *ts_lib),
+      topic_name,
+      options.to_rcl_subscription_options(qos),
+      options.event_callbacks,
+      options.use_default_callbacks,
+      DeliveredMessageKind::SERIALIZED_MESSAGE),
+    view_callback_(std::move(callback)),
+    ts_lib_(ts_lib),
+    buffer_pool_(std::make_shared<BufferPool>())
+  {}
+
   RCLCPP_PUBLIC
   virtual ~GenericSubscription() = default;
 
+  /// Set a codec applied to each taken payload before it reaches the callback.
+  /**
+   * Use with topics whose publisher encodes with a matching codec, see
+   * GenericPublisher::set_codec(). The payload is decoded into a scratch
+   * buffer which is then swapped with the take buffer, so the callback sees
+   * the decoded payload without an extra copy and both buffers are reused.
+   *
+   * This is not thread-safe with respect to messages being handled; set the
+   * codec before the subscription is added to a node or wait set.
+   *
+   * \param[in] codec The codec to decode with, nullptr to remove the stage.
+   */
+  RCLCPP_PUBLIC
+  void set_codec(rclcpp::SerializedMessageCodec::SharedPtr codec);
+
   // Same as create_serialized_message() as the subscription is to serialized_messages only
   RCLCPP_PUBLIC
   std::shared_ptr<void> create_message() override;
@@ -151,9 +212,27 @@ public:
 private:
   RCLCPP_DISABLE_COPY(GenericSubscription)
 
+  // Pool of take buffers, only used in borrowed-view mode. Buffers handed out
+  // as views are pushed back here when the view is destroyed, so steady-state
+  // operation reuses buffers instead of allocating per message. Held through a
+  // shared_ptr so a view outliving the subscription can safely drop its buffer.
+  struct BufferPool
+  {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<rclcpp::SerializedMessage>> buffers;
+  };
+
   std::function<void(std::shared_ptr<rclcpp::SerializedMessage>)> callback_;
+  std::function<void(rclcpp::SerializedMessageView)> view_callback_;
   // The type support library should stay loaded, so it is stored in the GenericSubscription
   std::shared_ptr<rcpputils::SharedLibrary> ts_lib_;
+  std::shared_ptr<BufferPool> buffer_pool_;
+
+  // Optional codec stage, see set_codec(). The mutex serializes concurrent
+  // message handling through the one scratch buffer the codec decodes into.
+  rclcpp::SerializedMessageCodec::SharedPtr codec_;
+  rclcpp::SerializedMessage codec_buffer_;
+  std::mutex codec_mutex_;
 };
 
 }  // namespace rclcpp
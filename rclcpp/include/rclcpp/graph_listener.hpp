@@ -15,15 +15,24 @@
 #ifndef RCLCPP__GRAPH_LISTENER_HPP_
 #define RCLCPP__GRAPH_LISTENER_HPP_
 
+#include <array>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <regex>
+#include <string>
 #include <thread>
 #include <vector>
 
 #include "rcl/guard_condition.h"
 #include "rcl/wait.h"
 #include "rclcpp/context.hpp"
+#include "rclcpp/event.hpp"
 #include "rclcpp/guard_condition.hpp"
 #include "rclcpp/macros.hpp"
 #include "rclcpp/node_interfaces/node_graph_interface.hpp"
@@ -154,6 +163,110 @@ public:
   bool
   is_shutdown();
 
+  /// Return a shared immutable snapshot of a topic names and types query.
+  /**
+   * The snapshot is rebuilt with \p query only if the graph changed since the
+   * last rebuild; otherwise repeat calls return the stored snapshot without
+   * calling into rcl or allocating.
+   * The listen thread invalidates the cache when a graph guard condition
+   * fires, so staleness is bounded by its wakeup latency.
+   * If this listener is already shutdown, nothing would invalidate the cache,
+   * so the cache is bypassed and \p query is always called.
+   *
+   * \param[in] no_demangle whether demangling was disabled for the query,
+   *   each value of the flag gets its own snapshot
+   * \param[in] query fallback which performs the actual graph query
+   * \throws std::system_error anything std::mutex::lock() throws
+   */
+  RCLCPP_PUBLIC
+  std::shared_ptr<const std::map<std::string, std::vector<std::string>>>
+  get_cached_topic_names_and_types(
+    bool no_demangle,
+    const std::function<std::map<std::string, std::vector<std::string>>()> & query);
+
+  /// Return a cached publisher count for a fully qualified topic name.
+  /**
+   * Counts are cached per topic name and invalidated like the topic names and
+   * types snapshots, see get_cached_topic_names_and_types().
+   *
+   * \param[in] fq_topic_name fully qualified topic name to count on
+   * \param[in] query fallback which performs the actual graph query
+   * \throws std::system_error anything std::mutex::lock() throws
+   */
+  RCLCPP_PUBLIC
+  size_t
+  get_cached_publisher_count(
+    const std::string & fq_topic_name,
+    const std::function<size_t()> & query);
+
+  /// Return a cached subscriber count, see get_cached_publisher_count().
+  RCLCPP_PUBLIC
+  size_t
+  get_cached_subscriber_count(
+    const std::string & fq_topic_name,
+    const std::function<size_t()> & query);
+
+  /// Return an event set only on graph changes affecting matching topics.
+  /**
+   * Unlike NodeGraphInterface::get_graph_event(), which is set on every graph
+   * change, the returned event is only set when the listen thread diffs the
+   * graph and finds an added, removed, or retyped topic whose fully qualified
+   * name matches \p topic_filter, so subscribers to unrelated parts of the
+   * graph are never woken.
+   *
+   * The given node is used to take the baseline snapshot which later graph
+   * states are diffed against; it must already be added to this listener.
+   *
+   * \param[in] node_graph registered node used to query the graph
+   * \param[in] topic_filter pattern matched against fully qualified topic
+   *   names with std::regex_search
+   * \throws GraphListenerShutdownError if the GraphListener is shutdown
+   * \throws std::invalid_argument if node_graph is nullptr
+   * \throws std::regex_error if the pattern is invalid
+   */
+  RCLCPP_PUBLIC
+  rclcpp::Event::SharedPtr
+  add_filtered_graph_event(
+    rclcpp::node_interfaces::NodeGraphInterface * node_graph,
+    const std::string & topic_filter);
+
+  /// Return an event set only on graph changes affecting a named service.
+  /**
+   * The returned event is set when the listen thread diffs the graph and the
+   * service with the given fully qualified name appears, disappears, or
+   * changes types. Clients waiting for a specific server can block on it
+   * instead of being woken by every unrelated graph change.
+   *
+   * The given node is used to take the baseline snapshot which later graph
+   * states are diffed against; it must already be added to this listener.
+   *
+   * \param[in] node_graph registered node used to query the graph
+   * \param[in] service_name fully qualified service name to watch
+   * \throws GraphListenerShutdownError if the GraphListener is shutdown
+   * \throws std::invalid_argument if node_graph is nullptr
+   */
+  RCLCPP_PUBLIC
+  rclcpp::Event::SharedPtr
+  add_filtered_service_graph_event(
+    rclcpp::node_interfaces::NodeGraphInterface * node_graph,
+    const std::string & service_name);
+
+  /// Block until a filtered graph event is set or the timeout elapses.
+  /**
+   * \param[in] event event returned by add_filtered_graph_event() or
+   *   add_filtered_service_graph_event()
+   * \param[in] timeout maximum time to wait
+   * \throws rclcpp::exceptions::InvalidEventError if the event is nullptr
+   * \throws rclcpp::exceptions::EventNotRegisteredError if the event was not
+   *   returned by add_filtered_graph_event() or
+   *   add_filtered_service_graph_event()
+   */
+  RCLCPP_PUBLIC
+  void
+  wait_for_filtered_graph_event(
+    rclcpp::Event::SharedPtr event,
+    std::chrono::nanoseconds timeout);
+
 protected:
   /// Main function for the listening thread.
   RCLCPP_PUBLIC
@@ -181,6 +294,42 @@ private:
   void
   __shutdown();
 
+  struct CachedCount
+  {
+    uint64_t generation;
+    size_t count;
+  };
+
+  size_t
+  get_cached_count_(
+    std::map<std::string, CachedCount> & counts,
+    const std::string & fq_topic_name,
+    const std::function<size_t()> & query);
+
+  struct FilteredGraphEvent
+  {
+    std::regex pattern;
+    rclcpp::Event::WeakPtr event;
+  };
+
+  struct FilteredServiceGraphEvent
+  {
+    std::string service_name;
+    rclcpp::Event::WeakPtr event;
+  };
+
+  /// Diff the graph and set filtered events whose pattern matches a change.
+  /** \internal Called by the listen thread with the nodes mutex held. */
+  void
+  notify_filtered_graph_events_();
+
+  /// Collect keys which were added, removed, or changed values between maps.
+  /** \internal */
+  static std::vector<std::string>
+  collect_changed_keys_(
+    const std::map<std::string, std::vector<std::string>> & old_map,
+    const std::map<std::string, std::vector<std::string>> & new_map);
+
   std::weak_ptr<rclcpp::Context> weak_parent_context_;
   std::shared_ptr<rcl_context_t> rcl_parent_context_;
 
@@ -195,6 +344,28 @@ private:
 
   rclcpp::GuardCondition interrupt_guard_condition_;
   rcl_wait_set_t wait_set_ = rcl_get_zero_initialized_wait_set();
+
+  /// Bumped by the listen thread whenever a graph guard condition fires.
+  std::atomic<uint64_t> graph_generation_{1};
+  /// Set on first cache use; makes the listen thread watch every node's graph
+  /// guard condition, not just the nodes with graph events out on loan.
+  std::atomic_bool graph_cache_active_{false};
+  mutable std::mutex graph_cache_mutex_;
+  /// Cached snapshots and the generation they were taken at, per no_demangle flag.
+  std::array<std::shared_ptr<const std::map<std::string, std::vector<std::string>>>, 2>
+  cached_topic_names_and_types_;
+  std::array<uint64_t, 2> cached_topic_names_and_types_generations_{{0u, 0u}};
+  std::map<std::string, CachedCount> cached_publisher_counts_;
+  std::map<std::string, CachedCount> cached_subscriber_counts_;
+
+  mutable std::mutex filtered_graph_events_mutex_;
+  /// For waking wait_for_filtered_graph_event() when any filtered event is set.
+  std::condition_variable filtered_graph_events_cv_;
+  std::vector<FilteredGraphEvent> filtered_graph_events_;
+  std::vector<FilteredServiceGraphEvent> filtered_service_graph_events_;
+  /// Snapshots the listen thread diffs new graph states against.
+  std::map<std::string, std::vector<std::string>> diffed_topic_names_and_types_;
+  std::map<std::string, std::vector<std::string>> diffed_service_names_and_types_;
 };
 
 }  // namespace graph_listener
@@ -77,6 +77,14 @@ public:
    * This function is thread-safe, and may be called concurrently with waiting
    * on this guard condition in a wait set.
    *
+   * Redundant triggers are deduplicated: while a trigger is already pending
+   * (delivered to rcl but not yet consumed by a wait cycle), further calls
+   * only flip an atomic flag and notify listeners, skipping the per-trigger
+   * middleware syscall. High-rate sources like intra-process subscriptions
+   * can therefore trigger once per message without one wakeup syscall each.
+   * The pending state is re-armed when the guard condition is added to a
+   * wait set for the next cycle, see add_to_wait_set().
+   *
    * \throws rclcpp::exceptions::RCLError based exceptions when underlying
    *   rcl functions fail.
    */
@@ -101,6 +109,12 @@ public:
   /// Adds the guard condition to a waitset
   /**
    * This function is thread-safe.
+   *
+   * This also starts a new trigger deduplication cycle: if any trigger was
+   * suppressed since the last wait, the underlying guard condition is
+   * triggered once here so the upcoming wait returns and re-checks readiness
+   * rather than sleeping over the suppressed wakeup.
+   *
    * \param[in] wait_set pointer to a wait set where to add the guard condition
    */
   RCLCPP_PUBLIC
@@ -127,10 +141,35 @@ public:
   void
   set_on_trigger_callback(std::function<void(size_t)> callback);
 
+  /// Start a new trigger deduplication cycle, see trigger().
+  /**
+   * Clears the pending-trigger state and, if any trigger was suppressed since
+   * the previous cycle, triggers the underlying guard condition once so the
+   * upcoming wait returns and readiness is re-checked rather than sleeping
+   * over the suppressed wakeup. Called by the code paths that (re-)add this
+   * guard condition to a wait set before waiting.
+   *
+   * This function is thread-safe.
+   *
+   * \throws rclcpp::exceptions::RCLError based exceptions when underlying
+   *   rcl functions fail.
+   */
+  RCLCPP_PUBLIC
+  void
+  retrigger_if_pending() const;
+
 protected:
   rclcpp::Context::SharedPtr context_;
   rcl_guard_condition_t rcl_guard_condition_;
   std::atomic<bool> in_use_by_wait_set_{false};
+  // True while a trigger has been handed to rcl but not consumed by a wait
+  // cycle yet; further triggers in that window skip the middleware syscall.
+  // Mutable so retrigger_if_pending() can run via the const references the
+  // wait set machinery holds.
+  mutable std::atomic<bool> trigger_pending_{false};
+  // True if any trigger was deduplicated in the current cycle; it then gets
+  // one catch-up delivery when the next cycle starts.
+  mutable std::atomic<bool> trigger_suppressed_{false};
   std::recursive_mutex reentrant_mutex_;
   std::function<void(size_t)> on_trigger_callback_{nullptr};
   size_t unread_count_{0};
@@ -31,6 +31,26 @@ public:
   /// If true, the context will be shutdown on SIGINT by the signal handler (if it was installed).
   bool shutdown_on_signal = true;
 
+  /// If true, pre-shutdown and on-shutdown callbacks run on a small thread pool.
+  /**
+   * Speeds up teardown of processes that registered many per-object shutdown
+   * callbacks, at the cost of losing the registration-order execution
+   * guarantee; only enable this if the callbacks are independent of each
+   * other.
+   */
+  bool parallel_shutdown_callbacks = false;
+
+  /// If true, entity teardown after shutdown is severed in bulk and finalized off-thread.
+  /**
+   * Context::shutdown() then unregisters all intra-process endpoints with one
+   * lock acquisition, and publisher, subscription and client destructors hand
+   * the finalization of their rcl handles to a teardown thread owned by the
+   * context instead of round-tripping through rcl/rmw inline. This shortens
+   * the teardown of processes with many nodes, e.g. during deploy restarts.
+   * The context joins the teardown thread during cleanup.
+   */
+  bool deferred_entity_finalization = false;
+
   /// Constructor
   /**
    * It allows you to specify the allocator used within the init options.
@@ -63,6 +83,26 @@ public:
   InitOptions &
   auto_initialize_logging(bool initialize_logging);
 
+  /// Return `true` if log messages should be handed off to a dedicated logging thread.
+  RCLCPP_PUBLIC
+  bool
+  asynchronous_logging() const;
+
+  /// Set flag indicating if log messages should be handed off to a dedicated logging thread.
+  /**
+   * When enabled, log call sites format the message and push it onto a
+   * bounded per-process ring; a dedicated thread forwards the records to the
+   * logging sinks (console, file and rosout) in batches, so logging never
+   * blocks the calling thread on sink I/O.  When the ring overflows, new
+   * messages are dropped and the loss is reported once the sink catches up.
+   *
+   * Only effective when logging is initialized by the context, see
+   * auto_initialize_logging().  Disabled by default.
+   */
+  RCLCPP_PUBLIC
+  InitOptions &
+  asynchronous_logging(bool asynchronous_logging);
+
   /// Assignment operator.
   RCLCPP_PUBLIC
   InitOptions &
@@ -107,6 +147,7 @@ private:
   mutable std::mutex init_options_mutex_;
   std::unique_ptr<rcl_init_options_t> init_options_;
   bool initialize_logging_{true};
+  bool asynchronous_logging_{false};
 };
 
 }  // namespace rclcpp
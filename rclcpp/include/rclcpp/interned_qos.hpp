@@ -0,0 +1,117 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__INTERNED_QOS_HPP_
+#define RCLCPP__INTERNED_QOS_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+#include "rclcpp/qos.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+
+/// An immutable, interned QoS profile.
+/**
+ * Profiles are interned in a process-wide table: instances built from equal
+ * profiles (in the sense of QoS::operator==) share one canonical record, so a
+ * process with thousands of entities but a handful of distinct profiles stores
+ * each profile once, equality checks on hot paths reduce to a pointer
+ * comparison, and the hash for QoS-keyed caches is computed once per distinct
+ * profile. Default-constructed instances are empty and compare equal to each
+ * other.
+ *
+ * Entities intern their actual (rmw-resolved) profile once at creation, see
+ * PublisherBase::get_interned_actual_qos() and
+ * SubscriptionBase::get_interned_actual_qos().
+ */
+class InternedQoS
+{
+public:
+  /// Construct an empty instance.
+  RCLCPP_PUBLIC
+  InternedQoS() = default;
+
+  /// Intern the given profile.
+  RCLCPP_PUBLIC
+  explicit InternedQoS(const rclcpp::QoS & qos);
+
+  /// Return the canonical profile.
+  /**
+   * Empty instances return the rclcpp default profile (keep last 10).
+   */
+  RCLCPP_PUBLIC
+  const rclcpp::QoS &
+  qos() const;
+
+  /// Return the rmw profile of the canonical record.
+  RCLCPP_PUBLIC
+  const rmw_qos_profile_t &
+  get_rmw_qos_profile() const;
+
+  /// Return the hash computed when the profile was interned.
+  RCLCPP_PUBLIC
+  size_t
+  hash() const;
+
+  RCLCPP_PUBLIC
+  bool
+  empty() const;
+
+  /// Compare the interned records by pointer.
+  RCLCPP_PUBLIC
+  bool
+  operator==(const InternedQoS & other) const;
+
+  RCLCPP_PUBLIC
+  bool
+  operator!=(const InternedQoS & other) const;
+
+private:
+  struct Interned
+  {
+    Interned(const rclcpp::QoS & qos_in, size_t hash_in)
+    : qos(qos_in), hash(hash_in)
+    {}
+
+    rclcpp::QoS qos;
+    size_t hash;
+  };
+
+  RCLCPP_LOCAL
+  static std::shared_ptr<const Interned>
+  intern(const rclcpp::QoS & qos);
+
+  std::shared_ptr<const Interned> interned_;
+};
+
+}  // namespace rclcpp
+
+namespace std
+{
+template<>
+struct hash<rclcpp::InternedQoS>
+{
+  size_t
+  operator()(const rclcpp::InternedQoS & qos) const
+  {
+    return qos.hash();
+  }
+};
+}  // namespace std
+
+#endif  // RCLCPP__INTERNED_QOS_HPP_
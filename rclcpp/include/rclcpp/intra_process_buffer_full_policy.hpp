@@ -0,0 +1,39 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__INTRA_PROCESS_BUFFER_FULL_POLICY_HPP_
+#define RCLCPP__INTRA_PROCESS_BUFFER_FULL_POLICY_HPP_
+
+namespace rclcpp
+{
+
+/// Behavior of the intra-process buffer when a message arrives and it is full.
+/**
+ * Every policy counts each discarded message in the buffer_overwrites counter
+ * of the subscription's introspection block.
+ */
+enum class IntraProcessBufferFullPolicy
+{
+  /// Discard the oldest unread message to make room for the new one (default).
+  OverwriteOldest,
+  /// Keep the unread history and discard the incoming message instead.
+  DropNewest,
+  /// Block the publishing thread until there is room or the configured timeout
+  /// expires, then discard the incoming message.
+  Block
+};
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__INTRA_PROCESS_BUFFER_FULL_POLICY_HPP_
@@ -0,0 +1,202 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__INTROSPECTION_HPP_
+#define RCLCPP__INTROSPECTION_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+
+/// Always-on per-entity hot-path counters.
+/**
+ * Every publisher, subscription, service and timer owns an EntityCounters
+ * block that the hot paths update with relaxed atomic increments, so the
+ * steady-state cost is a handful of uncontended atomic adds per message.
+ * A process-level snapshot() copies all blocks into plain structs, which a
+ * metrics agent can scrape periodically without subscribing to statistics
+ * topics and without perturbing the entities it observes.
+ */
+namespace introspection
+{
+
+/// The kind of entity a counter block belongs to.
+enum class EntityKind
+{
+  Publisher,
+  Subscription,
+  Service,
+  Timer,
+};
+
+/// Counter block updated by the hot paths of one entity.
+/**
+ * Which counters an entity updates depends on its kind:
+ *
+ * - publishers count published messages
+ * - subscriptions count taken/delivered messages, takes that found nothing,
+ *   intra-process buffer overwrites (i.e. messages dropped unread),
+ *   messages shed for exceeding the configured age, and callback
+ *   executions with their cumulative duration
+ * - services count handled requests as both messages and callbacks
+ * - timers count callback executions and their cumulative duration, plus
+ *   activation jitter (how late each fire was) and overruns (callbacks
+ *   that outlasted the timer period)
+ */
+struct EntityCounters
+{
+  /// Messages published, taken or requests handled.
+  std::atomic<uint64_t> messages{0};
+  /// Takes that found nothing to take.
+  std::atomic<uint64_t> empty_takes{0};
+  /// Unread messages overwritten in the intra-process buffer.
+  std::atomic<uint64_t> buffer_overwrites{0};
+  /// Messages dropped unread at dispatch for exceeding the configured age.
+  std::atomic<uint64_t> shed_messages{0};
+  /// User callback executions.
+  std::atomic<uint64_t> callbacks{0};
+  /// Cumulative user callback execution time, in nanoseconds.
+  std::atomic<uint64_t> callback_duration_ns{0};
+  /// Number of pipeline latency samples recorded, see record_latency().
+  std::atomic<uint64_t> latency_samples{0};
+  /// Cumulative pipeline latency over all samples, in nanoseconds.
+  std::atomic<uint64_t> latency_sum_ns{0};
+  /// Smallest pipeline latency observed, in nanoseconds.
+  std::atomic<uint64_t> latency_min_ns{UINT64_MAX};
+  /// Largest pipeline latency observed, in nanoseconds.
+  std::atomic<uint64_t> latency_max_ns{0};
+  /// Cumulative timer activation jitter (late fires), in nanoseconds.
+  std::atomic<uint64_t> timer_jitter_ns{0};
+  /// Largest single timer activation jitter observed, in nanoseconds.
+  std::atomic<uint64_t> timer_jitter_max_ns{0};
+  /// Timer callbacks whose duration exceeded the timer period.
+  std::atomic<uint64_t> timer_overruns{0};
+};
+
+/// Record one pipeline latency sample into a counter block.
+/**
+ * Subscriptions record the latency of every taken message relative to its
+ * origin timestamp, and publishers with an origin set (relay hops) record it
+ * at publish time, see rclcpp::MessageInfo::get_pipeline_latency(). Count,
+ * sum, minimum and maximum give a metrics agent a distribution summary per
+ * scrape interval by differencing consecutive snapshots.
+ *
+ * \param[in] counters the counter block of the observing entity.
+ * \param[in] latency_ns the sample, in nanoseconds.
+ */
+inline void
+record_latency(EntityCounters & counters, uint64_t latency_ns)
+{
+  counters.latency_samples.fetch_add(1, std::memory_order_relaxed);
+  counters.latency_sum_ns.fetch_add(latency_ns, std::memory_order_relaxed);
+  uint64_t observed = counters.latency_min_ns.load(std::memory_order_relaxed);
+  while (latency_ns < observed &&
+    !counters.latency_min_ns.compare_exchange_weak(
+      observed, latency_ns, std::memory_order_relaxed))
+  {
+  }
+  observed = counters.latency_max_ns.load(std::memory_order_relaxed);
+  while (latency_ns > observed &&
+    !counters.latency_max_ns.compare_exchange_weak(
+      observed, latency_ns, std::memory_order_relaxed))
+  {
+  }
+}
+
+/// Plain copy of one entity's counter block.
+struct EntitySnapshot
+{
+  /// The kind of the entity.
+  EntityKind kind;
+  /// Topic or service name; empty for timers.
+  std::string name;
+  /// Address of the counter block, stable for the entity's lifetime.
+  const void * id;
+  /// See EntityCounters for the meaning per entity kind.
+  uint64_t messages;
+  uint64_t empty_takes;
+  uint64_t buffer_overwrites;
+  uint64_t shed_messages;
+  uint64_t callbacks;
+  uint64_t callback_duration_ns;
+  uint64_t latency_samples;
+  uint64_t latency_sum_ns;
+  /// 0 when no sample was recorded yet.
+  uint64_t latency_min_ns;
+  uint64_t latency_max_ns;
+  uint64_t timer_jitter_ns;
+  uint64_t timer_jitter_max_ns;
+  uint64_t timer_overruns;
+};
+
+/// One callback dispatch that outlived the executor watchdog deadline.
+/**
+ * Recorded by the watchdog armed with rclcpp::Executor::set_callback_deadline().
+ * Events are kept in a fixed-size ring where new entries overwrite the
+ * oldest, so a wedged callback cannot grow the ring unbounded.
+ */
+struct StallEvent
+{
+  /// The offending entity, e.g. "subscription '/chatter'".
+  std::string description;
+  /// How long the dispatch had been running when it was flagged, in nanoseconds.
+  uint64_t running_ns;
+  /// Detection time, system clock nanoseconds since the epoch.
+  uint64_t detected_at_ns;
+};
+
+/// Record a stalled dispatch into the stall ring.
+/**
+ * \param[in] description the offending entity.
+ * \param[in] running_ns how long the dispatch had been running, in nanoseconds.
+ */
+RCLCPP_PUBLIC
+void
+record_stall(const std::string & description, uint64_t running_ns);
+
+/// Copy out the recorded stall events, oldest first.
+RCLCPP_PUBLIC
+std::vector<StallEvent>
+stall_events();
+
+/// Register a counter block for a new entity.
+/**
+ * Called by the entity constructors; the registry keeps a weak reference,
+ * so destroying the entity (and with it the returned shared pointer)
+ * removes the block from future snapshots.
+ *
+ * \param[in] kind the kind of the entity.
+ * \param[in] name topic or service name, may be empty.
+ * \return the counter block to be updated by the entity's hot paths.
+ */
+RCLCPP_PUBLIC
+std::shared_ptr<EntityCounters>
+register_entity(EntityKind kind, const std::string & name);
+
+/// Copy the counter blocks of all live entities in the process.
+RCLCPP_PUBLIC
+std::vector<EntitySnapshot>
+snapshot();
+
+}  // namespace introspection
+}  // namespace rclcpp
+
+#endif  // RCLCPP__INTROSPECTION_HPP_
@@ -0,0 +1,93 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__IS_TRIVIALLY_RELOCATABLE_HPP_
+#define RCLCPP__IS_TRIVIALLY_RELOCATABLE_HPP_
+
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace rclcpp
+{
+
+/// Compile-time trait marking a message type as safe to copy with memcpy.
+/**
+ * A trivially relocatable message is one whose object representation fully
+ * describes its value: copying the bytes yields an independent, valid message
+ * and abandoning the source afterwards leaks nothing. For such types the
+ * intra-process buffers replace the rosidl-generated per-field copy
+ * constructors and assignment operators, which the compiler often cannot
+ * vectorize, with a single memcpy/memmove.
+ *
+ * By default this is exactly std::is_trivially_copyable. Like TypeAdapter,
+ * the trait may be specialized for message types the language trait cannot
+ * see through, e.g. bounded messages whose generated constructors disable
+ * trivial copyability but whose members are all scalars and fixed-size
+ * arrays:
+ *
+ *     template<>
+ *     struct rclcpp::is_trivially_relocatable<my_msgs::msg::JointState>
+ *       : std::true_type {};
+ *
+ * Specializing this trait for a type holding owning pointers or unbounded
+ * strings/sequences is undefined behavior.
+ */
+template<typename MessageT, typename = void>
+struct is_trivially_relocatable : std::is_trivially_copyable<MessageT>
+{};
+
+template<typename MessageT>
+constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<MessageT>::value;
+
+namespace detail
+{
+
+/// Move `from` into the existing object `to`, via memcpy when relocatable.
+template<typename T>
+void
+relocate_into(T && from, std::decay_t<T> & to)
+{
+  using ValueT = std::decay_t<T>;
+  if constexpr (is_trivially_relocatable<ValueT>::value) {
+    std::memcpy(
+      static_cast<void *>(std::addressof(to)),
+      static_cast<const void *>(std::addressof(from)),
+      sizeof(ValueT));
+  } else {
+    to = std::forward<T>(from);
+  }
+}
+
+/// Copy-construct `from` into the raw storage at `ptr`, via memcpy when relocatable.
+template<typename AllocT, typename T>
+void
+construct_relocated_copy(AllocT & allocator, T * ptr, const T & from)
+{
+  if constexpr (is_trivially_relocatable<T>::value) {
+    std::memcpy(
+      static_cast<void *>(ptr),
+      static_cast<const void *>(std::addressof(from)),
+      sizeof(T));
+  } else {
+    std::allocator_traits<AllocT>::construct(allocator, ptr, from);
+  }
+}
+
+}  // namespace detail
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__IS_TRIVIALLY_RELOCATABLE_HPP_
@@ -0,0 +1,161 @@
+// Copyright 2024 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__LAZY_MESSAGE_HPP_
+#define RCLCPP__LAZY_MESSAGE_HPP_
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "rcl/time.h"
+
+#include "rclcpp/serialization.hpp"
+#include "rclcpp/serialized_message.hpp"
+#include "rclcpp/time.hpp"
+
+namespace rclcpp
+{
+
+/// Handle to a received message that is deserialized only on first access.
+/**
+ * Subscriptions to large messages (point clouds, images) often only need a
+ * few leading fields, e.g. the header stamp for latency accounting; paying
+ * for a full deserialization per message is wasted CPU. A LazyMessage wraps
+ * the serialized form and deserializes the complete message the first time it
+ * is dereferenced, caching the result for subsequent accesses.
+ *
+ * For the common monitoring case, `stamp()` and `frame_id()` read the leading
+ * `std_msgs/Header` fields straight out of the CDR buffer without
+ * deserializing anything else. These accessors are only meaningful when the
+ * first field of `MessageT` is a `std_msgs/Header`; they return `nullopt`
+ * when the buffer is too short to contain the requested field.
+ *
+ * \sa create_lazy_subscription() for subscribing with LazyMessage callbacks.
+ */
+template<typename MessageT>
+class LazyMessage
+{
+public:
+  /// Construct a lazy handle over a serialized message.
+  explicit LazyMessage(std::shared_ptr<rclcpp::SerializedMessage> serialized_message)
+  : serialized_message_(std::move(serialized_message))
+  {}
+
+  /// Get the underlying serialized message without deserializing.
+  const rclcpp::SerializedMessage & serialized_message() const
+  {
+    return *serialized_message_;
+  }
+
+  /// Get the deserialized message, deserializing it on first access.
+  /**
+   * \throws anything Serialization::deserialize_message() throws.
+   */
+  std::shared_ptr<const MessageT> get() const
+  {
+    if (!message_) {
+      static const rclcpp::Serialization<MessageT> serializer;
+      auto message = std::make_shared<MessageT>();
+      serializer.deserialize_message(serialized_message_.get(), message.get());
+      message_ = std::move(message);
+    }
+    return message_;
+  }
+
+  /// Dereference to the deserialized message, deserializing it on first access.
+  const MessageT & operator*() const
+  {
+    return *get();
+  }
+
+  /// Member access into the deserialized message, deserializing it on first access.
+  const MessageT * operator->() const
+  {
+    return get().get();
+  }
+
+  /// Whether the full message has been deserialized yet.
+  bool is_deserialized() const
+  {
+    return nullptr != message_;
+  }
+
+  /// Read the leading header stamp directly from the CDR buffer.
+  /**
+   * Only meaningful when the first field of `MessageT` is a
+   * `std_msgs/Header`.
+   *
+   * \return The stamp as ROS time, or `nullopt` if the buffer is too short.
+   */
+  std::optional<rclcpp::Time> stamp() const
+  {
+    const auto & message = serialized_message_->get_rcl_serialized_message();
+    // 4 byte CDR encapsulation, then int32 sec and uint32 nanosec.
+    if (message.buffer_length < 12u) {
+      return std::nullopt;
+    }
+    const bool little_endian = (message.buffer[1] & 0x01) != 0;
+    const auto sec = static_cast<int32_t>(read_uint32(&message.buffer[4], little_endian));
+    const uint32_t nanosec = read_uint32(&message.buffer[8], little_endian);
+    return rclcpp::Time(sec, nanosec, RCL_ROS_TIME);
+  }
+
+  /// Read the leading header frame id directly from the CDR buffer.
+  /**
+   * Only meaningful when the first field of `MessageT` is a
+   * `std_msgs/Header`.
+   *
+   * \return The frame id, or `nullopt` if the buffer is too short.
+   */
+  std::optional<std::string> frame_id() const
+  {
+    const auto & message = serialized_message_->get_rcl_serialized_message();
+    // The string length (which includes the null terminator) follows the
+    // stamp, with the characters after it.
+    if (message.buffer_length < 16u) {
+      return std::nullopt;
+    }
+    const bool little_endian = (message.buffer[1] & 0x01) != 0;
+    const uint32_t length = read_uint32(&message.buffer[12], little_endian);
+    if (0u == length || message.buffer_length < 16u + length) {
+      return std::nullopt;
+    }
+    return std::string(reinterpret_cast<const char *>(&message.buffer[16]), length - 1u);
+  }
+
+private:
+  static uint32_t read_uint32(const uint8_t * buffer, bool little_endian)
+  {
+    if (little_endian) {
+      return static_cast<uint32_t>(buffer[0]) |
+             (static_cast<uint32_t>(buffer[1]) << 8) |
+             (static_cast<uint32_t>(buffer[2]) << 16) |
+             (static_cast<uint32_t>(buffer[3]) << 24);
+    }
+    return (static_cast<uint32_t>(buffer[0]) << 24) |
+           (static_cast<uint32_t>(buffer[1]) << 16) |
+           (static_cast<uint32_t>(buffer[2]) << 8) |
+           static_cast<uint32_t>(buffer[3]);
+  }
+
+  std::shared_ptr<rclcpp::SerializedMessage> serialized_message_;
+  mutable std::shared_ptr<const MessageT> message_;
+};
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__LAZY_MESSAGE_HPP_
@@ -19,6 +19,7 @@
 #include <utility>
 
 #include "rclcpp/allocator/allocator_common.hpp"
+#include "rclcpp/loaned_message_pool.hpp"
 #include "rclcpp/logging.hpp"
 #include "rclcpp/publisher_base.hpp"
 
@@ -64,15 +65,7 @@ public:
     message_allocator_(std::move(allocator))
   {
     if (pub_.can_loan_messages()) {
-      void * message_ptr = nullptr;
-      auto ret = rcl_borrow_loaned_message(
-        pub_.get_publisher_handle().get(),
-        rosidl_typesupport_cpp::get_message_type_support_handle<MessageT>(),
-        &message_ptr);
-      if (RCL_RET_OK != ret) {
-        rclcpp::exceptions::throw_from_rcl_error(ret);
-      }
-      message_ = static_cast<MessageT *>(message_ptr);
+      borrow_from_middleware_();
     } else {
       RCLCPP_INFO_ONCE(
         rclcpp::get_logger("rclcpp"),
@@ -82,6 +75,35 @@ public:
     }
   }
 
+  /// Constructor of the LoanedMessage class drawing fallback storage from a pool.
+  /**
+   * Behaves like the allocator based constructor, except that when the middleware
+   * can not loan messages the message instance is acquired from the given pool
+   * and returned to it on destruction, so repeated borrows do not allocate.
+   * When the middleware can loan messages the pool is not used.
+   *
+   * \param[in] pub rclcpp::Publisher instance to which the memory belongs
+   * \param[in] pool pool providing message instances when the middleware can not loan
+   * \throws anything rclcpp::exceptions::throw_from_rcl_error can throw.
+   */
+  LoanedMessage(
+    const rclcpp::PublisherBase & pub,
+    std::shared_ptr<LoanedMessagePool<MessageT, AllocatorT>> pool)
+  : pub_(pub),
+    message_(nullptr),
+    message_allocator_(pool->get_message_allocator()),
+    pool_(std::move(pool))
+  {
+    if (pub_.can_loan_messages()) {
+      borrow_from_middleware_();
+    } else {
+      RCLCPP_INFO_ONCE(
+        rclcpp::get_logger("rclcpp"),
+        "Currently used middleware can't loan messages. Local message pool will be used.");
+      message_ = pool_->acquire();
+    }
+  }
+
   /// Constructor of the LoanedMessage class.
   /**
    * The constructor of this class allocates memory for a given message type
@@ -116,7 +138,8 @@ public:
   LoanedMessage(LoanedMessage<MessageT> && other)
   : pub_(std::move(other.pub_)),
     message_(std::move(other.message_)),
-    message_allocator_(std::move(other.message_allocator_))
+    message_allocator_(std::move(other.message_allocator_)),
+    pool_(std::move(other.pool_))
   {
     other.message_ = nullptr;
   }
@@ -150,8 +173,8 @@ public:
           error_logger, "rcl_deallocate_loaned_message failed: %s", rcl_get_error_string().str);
         rcl_reset_error();
       }
-    } else {
-      // call destructor before deallocating
+    } else if (!pool_ || !pool_->release(message_)) {
+      // no pool configured, or the pool is at depth; call destructor before deallocating
       message_->~MessageT();
       message_allocator_.deallocate(message_, 1);
     }
@@ -205,6 +228,18 @@ public:
       return std::unique_ptr<MessageT, std::function<void(MessageT *)>>(msg, [](MessageT *) {});
     }
 
+    if (pool_) {
+      return std::unique_ptr<MessageT, std::function<void(MessageT *)>>(
+        msg,
+        [pool = pool_, allocator = message_allocator_](MessageT * msg_ptr) mutable {
+          if (!pool->release(msg_ptr)) {
+            // the pool is at depth; call destructor before deallocating
+            msg_ptr->~MessageT();
+            allocator.deallocate(msg_ptr, 1);
+          }
+        });
+    }
+
     return std::unique_ptr<MessageT, std::function<void(MessageT *)>>(
       msg,
       [allocator = message_allocator_](MessageT * msg_ptr) mutable {
@@ -221,8 +256,26 @@ protected:
 
   MessageAllocator message_allocator_;
 
+  /// Pool recycling fallback message instances, may be nullptr.
+  std::shared_ptr<LoanedMessagePool<MessageT, AllocatorT>> pool_;
+
   /// Deleted copy constructor to preserve memory integrity.
   LoanedMessage(const LoanedMessage<MessageT> & other) = delete;
+
+private:
+  void
+  borrow_from_middleware_()
+  {
+    void * message_ptr = nullptr;
+    auto ret = rcl_borrow_loaned_message(
+      pub_.get_publisher_handle().get(),
+      rosidl_typesupport_cpp::get_message_type_support_handle<MessageT>(),
+      &message_ptr);
+    if (RCL_RET_OK != ret) {
+      rclcpp::exceptions::throw_from_rcl_error(ret);
+    }
+    message_ = static_cast<MessageT *>(message_ptr);
+  }
 };
 
 }  // namespace rclcpp
@@ -0,0 +1,171 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__LOANED_MESSAGE_POOL_HPP_
+#define RCLCPP__LOANED_MESSAGE_POOL_HPP_
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "rclcpp/allocator/allocator_common.hpp"
+#include "rclcpp/macros.hpp"
+
+namespace rclcpp
+{
+
+/// Recycling pool of message instances for the non-loaning LoanedMessage path.
+/**
+ * When the middleware can not loan messages, rclcpp::LoanedMessage falls back
+ * to allocating a message instance per borrow.
+ * A publisher configured with a LoanedMessagePool hands the pool to each
+ * LoanedMessage it creates instead, so that fallback instances are recycled
+ * and repeated borrows neither allocate nor release memory once the pool has
+ * warmed up.
+ * Recycled instances keep the heap capacity their sequence and string fields
+ * have grown to, which is what makes reuse cheap for dynamically sized
+ * messages.
+ *
+ * The pool keeps at most `depth` idle instances; borrows beyond the depth
+ * fall back to the allocator and the surplus instances are destroyed on
+ * release.
+ * All member functions are thread-safe.
+ */
+template<typename MessageT, typename AllocatorT = std::allocator<void>>
+class LoanedMessagePool
+{
+  using MessageAllocatorTraits = rclcpp::allocator::AllocRebind<MessageT, AllocatorT>;
+  using MessageAllocator = typename MessageAllocatorTraits::allocator_type;
+
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS_NOT_COPYABLE(LoanedMessagePool)
+
+  /// Default number of idle message instances kept by the pool.
+  static constexpr size_t kDefaultDepth = 16;
+
+  /// Construct a pool keeping at most depth idle message instances.
+  /**
+   * \param[in] depth maximum number of idle instances kept for reuse.
+   * \param[in] allocator allocator used when the pool is empty or over depth.
+   */
+  explicit LoanedMessagePool(
+    size_t depth = kDefaultDepth,
+    MessageAllocator allocator = MessageAllocator())
+  : depth_(depth),
+    message_allocator_(std::move(allocator))
+  {
+    free_list_.reserve(depth_);
+  }
+
+  virtual ~LoanedMessagePool()
+  {
+    for (MessageT * message : free_list_) {
+      message->~MessageT();
+      message_allocator_.deallocate(message, 1);
+    }
+  }
+
+  /// Take a default-initialized message instance, reusing pooled storage if available.
+  /**
+   * If the pool is empty the instance is allocated with the pool's allocator,
+   * so acquire() never fails beyond what the allocator can throw.
+   *
+   * \return pointer to a constructed, default-initialized message instance.
+   */
+  MessageT *
+  acquire()
+  {
+    MessageT * message = nullptr;
+    {
+      std::lock_guard<std::mutex> lock(free_list_mutex_);
+      if (!free_list_.empty()) {
+        message = free_list_.back();
+        free_list_.pop_back();
+      }
+    }
+    if (nullptr != message) {
+      // Copy-assign from a default instance rather than destroy and
+      // reconstruct, so sequence and string fields keep their grown capacity.
+      static const MessageT default_message;
+      *message = default_message;
+      return message;
+    }
+    message = message_allocator_.allocate(1);
+    new (message) MessageT();
+    return message;
+  }
+
+  /// Return a message instance to the pool.
+  /**
+   * \param[in] message instance previously obtained from acquire().
+   * \return true if the instance was pooled, false if the pool already holds
+   *   depth idle instances, in which case the caller must destroy it.
+   */
+  bool
+  release(MessageT * message)
+  {
+    std::lock_guard<std::mutex> lock(free_list_mutex_);
+    if (free_list_.size() >= depth_) {
+      return false;
+    }
+    free_list_.push_back(message);
+    return true;
+  }
+
+  /// Pre-construct idle instances so that the first borrows do not allocate.
+  /**
+   * \param[in] count number of idle instances to have ready, capped at depth.
+   */
+  void
+  reserve(size_t count)
+  {
+    std::lock_guard<std::mutex> lock(free_list_mutex_);
+    count = std::min(count, depth_);
+    while (free_list_.size() < count) {
+      MessageT * message = message_allocator_.allocate(1);
+      new (message) MessageT();
+      free_list_.push_back(message);
+    }
+  }
+
+  /// Return the number of idle message instances currently held.
+  size_t
+  free_count() const
+  {
+    std::lock_guard<std::mutex> lock(free_list_mutex_);
+    return free_list_.size();
+  }
+
+  /// Return a copy of the allocator backing the pool.
+  MessageAllocator
+  get_message_allocator() const
+  {
+    return message_allocator_;
+  }
+
+private:
+  const size_t depth_;
+
+  MessageAllocator message_allocator_;
+
+  mutable std::mutex free_list_mutex_;
+
+  std::vector<MessageT *> free_list_;
+};
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__LOANED_MESSAGE_POOL_HPP_
@@ -119,11 +119,15 @@ private:
   /**
    * This cannot be called directly, see `rclcpp::get_logger` instead.
    */
-  explicit Logger(const std::string & name)
-  : name_(new std::string(name)) {}
+  RCLCPP_PUBLIC
+  explicit Logger(const std::string & name);
+
+  /// Cache of child loggers, shared between copies of this handle.
+  struct ChildCache;
 
   std::shared_ptr<const std::string> name_;
   std::shared_ptr<std::pair<std::string, std::string>> logger_sublogger_pairname_ = nullptr;
+  std::shared_ptr<ChildCache> child_cache_ = nullptr;
 
 public:
   RCLCPP_PUBLIC
@@ -152,6 +156,12 @@ public:
    * For example, ```get_logger('abc').get_child('def')``` will return a logger
    * with name `abc.def`.
    *
+   * Children are cached on the parent: repeated calls with the same suffix
+   * return copies of one handle at the cost of a hash probe, without
+   * rebuilding the name or re-registering the sublogger. A cached child (and
+   * with it the rosout sublogger registration) lives as long as the parent
+   * handle and its copies do.
+   *
    * \param[in] suffix the child logger's suffix
    * \return a logger with the fully-qualified name including the suffix, or
    * \return a dummy logger if this logger is invalid (e.g. because logging is
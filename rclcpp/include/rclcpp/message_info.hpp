@@ -46,8 +46,45 @@ public:
   rmw_message_info_t &
   get_rmw_message_info();
 
+  /// Return the timestamp at which the message entered the pipeline.
+  /**
+   * If an explicit origin was set, e.g. preserved across a relay hop, it is
+   * returned; otherwise this falls back to the middleware source timestamp,
+   * i.e. for a message published directly the origin is its publish time.
+   *
+   * \return origin timestamp in nanoseconds, or 0 if unavailable.
+   */
+  rmw_time_point_value_t
+  get_origin_timestamp() const;
+
+  /// Override the origin timestamp, see get_origin_timestamp().
+  /**
+   * Used by components which forward messages, such as relays, to preserve
+   * the original entry time of a message across additional hops.
+   *
+   * \param[in] origin_timestamp origin timestamp in nanoseconds, 0 to clear.
+   */
+  void
+  set_origin_timestamp(rmw_time_point_value_t origin_timestamp);
+
+  /// Return the latency accumulated between origin and reception.
+  /**
+   * The difference between the received timestamp and the origin timestamp,
+   * see get_origin_timestamp(). Both timestamps come from the system clock,
+   * albeit possibly on different hosts, so clock offset between machines is
+   * included like it is for the rmw timestamps themselves.
+   *
+   * \return pipeline latency in nanoseconds, or 0 if either timestamp is
+   *   unavailable.
+   */
+  rmw_time_point_value_t
+  get_pipeline_latency() const;
+
 private:
   rmw_message_info_t rmw_message_info_;
+
+  /// Explicit origin overriding the source timestamp, 0 when unset.
+  rmw_time_point_value_t origin_timestamp_ {0};
 };
 
 }  // namespace rclcpp
@@ -0,0 +1,158 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__MESSAGE_POLLER_HPP_
+#define RCLCPP__MESSAGE_POLLER_HPP_
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "rclcpp/node.hpp"
+#include "rclcpp/visibility_control.hpp"
+#include "rclcpp/wait_set.hpp"
+
+namespace rclcpp
+{
+
+/// Reusable, take-based message receiver that never involves an executor.
+/**
+ * Unlike rclcpp::wait_for_message(), which creates a throwaway subscription,
+ * wait set, and shutdown guard per call, a MessagePoller is constructed once
+ * and then polled repeatedly with zero per-call setup: poll() waits on a
+ * persistent wait set and takes directly from the subscription, and
+ * take_batch() drains already-queued messages without waiting at all.
+ *
+ * The subscription's callback is never invoked; messages are consumed
+ * through the take machinery, which makes this suitable for test harnesses
+ * and sequential pipelines that want executor-free, pull-based delivery.
+ *
+ * This class is not thread-safe; poll from one thread at a time.
+ *
+ * \tparam MsgT the message type to receive.
+ */
+template<class MsgT>
+class MessagePoller
+{
+public:
+  /// Construct from an already initialized subscription.
+  /**
+   * \param[in] subscription the subscription to take messages from.
+   * \param[in] context context to watch for shutdown, which unblocks poll().
+   */
+  MessagePoller(
+    std::shared_ptr<rclcpp::Subscription<MsgT>> subscription,
+    std::shared_ptr<rclcpp::Context> context)
+  : subscription_(std::move(subscription)),
+    context_(std::move(context)),
+    shutdown_guard_condition_(std::make_shared<rclcpp::GuardCondition>(context_))
+  {
+    shutdown_callback_handle_ = context_->add_on_shutdown_callback(
+      [weak_gc = std::weak_ptr<rclcpp::GuardCondition>{shutdown_guard_condition_}]() {
+        auto strong_gc = weak_gc.lock();
+        if (strong_gc) {
+          strong_gc->trigger();
+        }
+      });
+    wait_set_.add_subscription(subscription_);
+    wait_set_.add_guard_condition(shutdown_guard_condition_);
+  }
+
+  /// Construct a new subscription on the given topic and poll it.
+  /**
+   * \param[in] node the node to create the subscription on.
+   * \param[in] topic the topic to receive messages from.
+   * \param[in] qos the QoS of the created subscription.
+   */
+  MessagePoller(
+    rclcpp::Node::SharedPtr node,
+    const std::string & topic,
+    const rclcpp::QoS & qos = rclcpp::QoS(10))
+  : MessagePoller(
+      node->create_subscription<MsgT>(topic, qos, [](const std::shared_ptr<const MsgT>) {}),
+      node->get_node_options().context())
+  {}
+
+  ~MessagePoller()
+  {
+    context_->remove_on_shutdown_callback(shutdown_callback_handle_);
+  }
+
+  /// Take the next message, waiting for one to arrive if necessary.
+  /**
+   * \param[out] out the message to fill.
+   * \param[in] timeout how long to wait; negative waits indefinitely, zero
+   *   only takes a message that is already queued.
+   * \return true if a message was taken, false on timeout or if shutdown was
+   *   triggered on the context while waiting.
+   */
+  template<class Rep = int64_t, class Period = std::milli>
+  bool
+  poll(
+    MsgT & out,
+    std::chrono::duration<Rep, Period> timeout = std::chrono::duration<Rep, Period>(-1))
+  {
+    rclcpp::MessageInfo info;
+    // A message may already be queued from a previous wakeup.
+    if (subscription_->take(out, info)) {
+      return true;
+    }
+    if (wait_set_.wait_into(wait_result_, timeout) != rclcpp::WaitResultKind::Ready) {
+      return false;
+    }
+    if (wait_set_.get_rcl_wait_set().guard_conditions[0]) {
+      // Shutdown was triggered.
+      return false;
+    }
+    return subscription_->take(out, info);
+  }
+
+  /// Take every already-queued message, up to capacity, without waiting.
+  /**
+   * \param[out] out_messages array of at least capacity messages to fill.
+   * \param[in] capacity maximum number of messages to take.
+   * \return the number of messages taken.
+   */
+  size_t
+  take_batch(MsgT * out_messages, size_t capacity)
+  {
+    rclcpp::MessageInfo info;
+    size_t taken = 0;
+    while (taken < capacity && subscription_->take(out_messages[taken], info)) {
+      ++taken;
+    }
+    return taken;
+  }
+
+  /// Return the polled subscription.
+  std::shared_ptr<rclcpp::Subscription<MsgT>>
+  get_subscription() const
+  {
+    return subscription_;
+  }
+
+private:
+  RCLCPP_DISABLE_COPY(MessagePoller)
+
+  std::shared_ptr<rclcpp::Subscription<MsgT>> subscription_;
+  std::shared_ptr<rclcpp::Context> context_;
+  std::shared_ptr<rclcpp::GuardCondition> shutdown_guard_condition_;
+  rclcpp::OnShutdownCallbackHandle shutdown_callback_handle_;
+  rclcpp::WaitSet wait_set_;
+  rclcpp::WaitSet::ResultT wait_result_;
+};
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__MESSAGE_POLLER_HPP_
@@ -160,6 +160,46 @@ public:
   void
   for_each_callback_group(const node_interfaces::NodeBaseInterface::CallbackGroupFunction & func);
 
+  /// Create a batch of entities with a single executor notification.
+  /**
+   * Every entity created on a node individually triggers the node's notify
+   * guard condition, and an executor rebuilds its entity collection per
+   * trigger. For batches of entities (e.g. a mode switch setting up dozens
+   * of subscriptions) this method coalesces the notifications: all create
+   * calls made inside the batch callable defer their triggers, and one
+   * trigger fires when the batch returns, so the executor rebuilds once.
+   *
+   * ```cpp
+   * node->create_entities(
+   *   [&]() {
+   *     for (const auto & topic : topics) {
+   *       subs.push_back(node->create_subscription<MsgT>(topic, 10, cb));
+   *     }
+   *   });
+   * ```
+   *
+   * Batches nest; only the outermost one commits. The callable runs on the
+   * calling thread and exceptions propagate after the transaction is
+   * closed, with a notification fired for any entities already created.
+   *
+   * \param[in] batch callable creating the entities on this node.
+   */
+  RCLCPP_PUBLIC
+  void
+  create_entities(const std::function<void()> & batch);
+
+  /// Destroy a batch of entities with a single executor notification.
+  /**
+   * The counterpart of create_entities() for teardown: release the entity
+   * shared pointers inside the batch callable and observers are notified
+   * once when it returns instead of per entity.
+   *
+   * \param[in] batch callable releasing the entities of this node.
+   */
+  RCLCPP_PUBLIC
+  void
+  destroy_entities(const std::function<void()> & batch);
+
   /// Create and return a Publisher.
   /**
    * The rclcpp::QoS has several convenient constructors, including a
@@ -369,6 +409,33 @@ public:
     )
   );
 
+  /// Create and return a GenericSubscription with a borrowed-view callback.
+  /**
+   * Same as the other overload, except that new messages are delivered as a
+   * SerializedMessageView borrowing the subscription's take buffer instead of
+   * an owning SerializedMessage, avoiding a per-message heap allocation.
+   *
+   * \param[in] topic_name Topic name
+   * \param[in] topic_type Topic type
+   * \param[in] qos %QoS settings
+   * \param[in] callback Callback for a borrowed view of new serialized messages
+   * \param[in] options %Subscription options.
+   * Not all subscription options are currently respected, the only relevant options for this
+   * subscription are `event_callbacks`, `use_default_callbacks`, `ignore_local_publications`, and
+   * `%callback_group`.
+   * \return Shared pointer to the created generic subscription.
+   */
+  template<typename AllocatorT = std::allocator<void>>
+  std::shared_ptr<rclcpp::GenericSubscription> create_generic_subscription(
+    const std::string & topic_name,
+    const std::string & topic_type,
+    const rclcpp::QoS & qos,
+    std::function<void(rclcpp::SerializedMessageView)> callback,
+    const rclcpp::SubscriptionOptionsWithAllocator<AllocatorT> & options = (
+      rclcpp::SubscriptionOptionsWithAllocator<AllocatorT>()
+    )
+  );
+
   /// Declare and initialize a parameter, return the effective value.
   /**
    * This method is used to declare that a parameter exists on this node.
@@ -1585,6 +1652,32 @@ protected:
 private:
   RCLCPP_DISABLE_COPY(Node)
 
+  /// Return the parameters interface, materializing it first if construction was deferred.
+  /**
+   * \sa rclcpp::NodeOptions::lazy_parameters()
+   */
+  RCLCPP_PUBLIC
+  const rclcpp::node_interfaces::NodeParametersInterface::SharedPtr &
+  ensure_node_parameters() const;
+
+  /// Return the time source, materializing it first if construction was deferred.
+  /**
+   * \sa rclcpp::NodeOptions::lazy_time_source()
+   */
+  RCLCPP_PUBLIC
+  const rclcpp::node_interfaces::NodeTimeSourceInterface::SharedPtr &
+  ensure_node_time_source() const;
+
+  /// Construct the parameters interface and its dependents; lazy_interfaces_mutex_ must be held.
+  RCLCPP_LOCAL
+  void
+  materialize_parameters_unlocked() const;
+
+  /// Construct the time source (and parameters first); lazy_interfaces_mutex_ must be held.
+  RCLCPP_LOCAL
+  void
+  materialize_time_source_unlocked() const;
+
   rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_base_;
   rclcpp::node_interfaces::NodeGraphInterface::SharedPtr node_graph_;
   rclcpp::node_interfaces::NodeLoggingInterface::SharedPtr node_logging_;
@@ -1592,11 +1685,17 @@ private:
   rclcpp::node_interfaces::NodeTopicsInterface::SharedPtr node_topics_;
   rclcpp::node_interfaces::NodeServicesInterface::SharedPtr node_services_;
   rclcpp::node_interfaces::NodeClockInterface::SharedPtr node_clock_;
-  rclcpp::node_interfaces::NodeParametersInterface::SharedPtr node_parameters_;
-  rclcpp::node_interfaces::NodeTimeSourceInterface::SharedPtr node_time_source_;
-  rclcpp::node_interfaces::NodeTypeDescriptionsInterface::SharedPtr node_type_descriptions_;
+  // These three are mutable so that nodes created with the lazy construction
+  // options can materialize them on first use from const accessors.
+  mutable rclcpp::node_interfaces::NodeParametersInterface::SharedPtr node_parameters_;
+  mutable rclcpp::node_interfaces::NodeTimeSourceInterface::SharedPtr node_time_source_;
+  mutable rclcpp::node_interfaces::NodeTypeDescriptionsInterface::SharedPtr
+    node_type_descriptions_;
   rclcpp::node_interfaces::NodeWaitablesInterface::SharedPtr node_waitables_;
 
+  /// Guards materialization of the interfaces whose construction was deferred.
+  mutable std::mutex lazy_interfaces_mutex_;
+
   const rclcpp::NodeOptions node_options_;
   const std::string sub_namespace_;
   const std::string effective_namespace_;
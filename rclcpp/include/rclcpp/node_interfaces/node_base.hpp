@@ -134,6 +134,27 @@ public:
   void
   trigger_notify_guard_condition() override;
 
+  /// Start deferring notify guard condition triggers.
+  /**
+   * Until the matching end_notify_transaction(), triggers are coalesced
+   * into a pending flag instead of waking observers; the executor then
+   * rebuilds its entity collection once per batch instead of once per
+   * entity. Transactions nest, only the outermost end commits.
+   *
+   * \sa rclcpp::Node::create_entities
+   */
+  RCLCPP_PUBLIC
+  void
+  begin_notify_transaction();
+
+  /// Stop deferring triggers, firing one if any was coalesced.
+  /**
+   * \throws std::runtime_error if there is no open transaction.
+   */
+  RCLCPP_PUBLIC
+  void
+  end_notify_transaction();
+
   RCLCPP_PUBLIC
   bool
   get_use_intra_process_default() const override;
@@ -164,6 +185,11 @@ private:
   mutable std::recursive_mutex notify_guard_condition_mutex_;
   std::shared_ptr<rclcpp::GuardCondition> notify_guard_condition_;
   bool notify_guard_condition_is_valid_;
+
+  /// Open notify transactions; guarded by notify_guard_condition_mutex_.
+  size_t notify_transaction_depth_ {0};
+  /// A trigger was coalesced while a transaction was open.
+  bool notify_trigger_pending_ {false};
 };
 
 }  // namespace node_interfaces
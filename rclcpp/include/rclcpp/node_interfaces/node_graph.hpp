@@ -63,6 +63,16 @@ public:
   std::map<std::string, std::vector<std::string>>
   get_topic_names_and_types(bool no_demangle = false) const override;
 
+  /// Return topic names and types served from the graph listener's cache.
+  /**
+   * Unlike get_topic_names_and_types(), repeat calls between graph changes
+   * return the same immutable snapshot without calling into rcl or copying
+   * the map, making this suitable for high rate polling.
+   */
+  RCLCPP_PUBLIC
+  std::shared_ptr<const std::map<std::string, std::vector<std::string>>>
+  get_cached_topic_names_and_types(bool no_demangle = false) const;
+
   RCLCPP_PUBLIC
   std::map<std::string, std::vector<std::string>>
   get_service_names_and_types() const override;
@@ -129,6 +139,32 @@ public:
   rclcpp::Event::SharedPtr
   get_graph_event() override;
 
+  /// Return an event set only on graph changes affecting matching topics.
+  /**
+   * \sa rclcpp::graph_listener::GraphListener::add_filtered_graph_event
+   */
+  RCLCPP_PUBLIC
+  rclcpp::Event::SharedPtr
+  get_filtered_graph_event(const std::string & topic_filter);
+
+  /// Return an event set only on graph changes affecting a named service.
+  /**
+   * \sa rclcpp::graph_listener::GraphListener::add_filtered_service_graph_event
+   */
+  RCLCPP_PUBLIC
+  rclcpp::Event::SharedPtr
+  get_service_graph_event(const std::string & service_name);
+
+  /// Block until a filtered graph event is set or the timeout elapses.
+  /**
+   * \sa rclcpp::graph_listener::GraphListener::wait_for_filtered_graph_event
+   */
+  RCLCPP_PUBLIC
+  void
+  wait_for_filtered_graph_event(
+    rclcpp::Event::SharedPtr event,
+    std::chrono::nanoseconds timeout);
+
   RCLCPP_PUBLIC
   void
   wait_for_graph_change(
@@ -154,13 +190,18 @@ public:
 private:
   RCLCPP_DISABLE_COPY(NodeGraph)
 
+  /// Add this node to the graph listener once, so that cached graph queries
+  /// get invalidated when the graph changes.
+  void
+  ensure_graph_change_monitoring() const;
+
   /// Handle to the NodeBaseInterface given in the constructor.
   rclcpp::node_interfaces::NodeBaseInterface * node_base_;
 
   /// Graph Listener which waits on graph changes for the node and is shared across nodes.
   std::shared_ptr<rclcpp::graph_listener::GraphListener> graph_listener_;
   /// Whether or not this node needs to be added to the graph listener.
-  std::atomic_bool should_add_to_graph_listener_;
+  mutable std::atomic_bool should_add_to_graph_listener_;
 
   /// Mutex to guard the graph event related data structures.
   mutable std::mutex graph_mutex_;
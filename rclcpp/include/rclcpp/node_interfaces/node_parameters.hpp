@@ -15,6 +15,7 @@
 #ifndef RCLCPP__NODE_INTERFACES__NODE_PARAMETERS_HPP_
 #define RCLCPP__NODE_INTERFACES__NODE_PARAMETERS_HPP_
 
+#include <cstdint>
 #include <list>
 #include <map>
 #include <memory>
@@ -55,6 +56,169 @@ struct ParameterInfo
   rcl_interfaces::msg::ParameterDescriptor descriptor;
 };
 
+/// A single entry of a batch declaration, see NodeParameters::declare_parameters().
+struct ParameterDeclaration
+{
+  /// Name of the parameter to declare.
+  std::string name;
+
+  /// Default value, used if there is no override for the parameter.
+  rclcpp::ParameterValue default_value;
+
+  /// A description of the parameter.
+  rcl_interfaces::msg::ParameterDescriptor descriptor;
+
+  /// If true, the parameter overrides are ignored for this entry.
+  bool ignore_override {false};
+};
+
+/// Immutable view of a node's parameters, taken at a single point in time.
+/**
+ * A snapshot stores its entries in a flat, open-addressing hash table, so
+ * lookups do a couple of contiguous probes instead of a red-black tree walk,
+ * and it is never modified after construction, so no locking is needed to
+ * read from it. NodeParameters publishes a new snapshot after every mutation
+ * and its `get_parameter`/`get_parameters` read from the latest one without
+ * taking a lock.
+ *
+ * Holding on to a snapshot (see NodeParameters::get_parameter_snapshot())
+ * additionally gives consistent multi-parameter reads: all lookups against
+ * the same snapshot observe the parameters as they were at one point in
+ * time, unaffected by concurrent sets.
+ */
+class ParameterSnapshot
+{
+public:
+  using ConstSharedPtr = std::shared_ptr<const ParameterSnapshot>;
+
+  /// Construct a snapshot of the given parameter storage.
+  /**
+   * \param[in] parameters The parameter storage to copy.
+   * \param[in] allow_undeclared Whether reads of undeclared parameters
+   *   return a default-constructed parameter instead of throwing, mirroring
+   *   the owning node's setting.
+   */
+  RCLCPP_PUBLIC
+  ParameterSnapshot(
+    const std::map<std::string, ParameterInfo> & parameters,
+    bool allow_undeclared);
+
+  /// Return true if the parameter is in the snapshot.
+  RCLCPP_PUBLIC
+  bool
+  has_parameter(const std::string & name) const;
+
+  /// Get the parameter, with the same semantics as NodeParameters::get_parameter.
+  /**
+   * \throws rclcpp::exceptions::ParameterNotDeclaredException if the
+   *   parameter is not in the snapshot and undeclared parameters are not
+   *   allowed.
+   * \throws rclcpp::exceptions::ParameterUninitializedException if the
+   *   parameter was declared statically typed but never given a value.
+   */
+  RCLCPP_PUBLIC
+  rclcpp::Parameter
+  get_parameter(const std::string & name) const;
+
+  /// Get the parameter into the output, returning true on success.
+  RCLCPP_PUBLIC
+  bool
+  get_parameter(const std::string & name, rclcpp::Parameter & parameter) const;
+
+  /// Get the given parameters, all read from this one snapshot.
+  RCLCPP_PUBLIC
+  std::vector<rclcpp::Parameter>
+  get_parameters(const std::vector<std::string> & names) const;
+
+  /// Find the info of a parameter, or nullptr if it is not in the snapshot.
+  RCLCPP_PUBLIC
+  const ParameterInfo *
+  find(const std::string & name) const;
+
+  /// Return the number of parameters in the snapshot.
+  RCLCPP_PUBLIC
+  size_t
+  size() const;
+
+private:
+  struct Entry
+  {
+    std::string name;
+    ParameterInfo info;
+    size_t hash;
+  };
+
+  std::vector<Entry> entries_;
+  // Open-addressing slot table with linear probing; each slot holds an index
+  // into entries_ plus one, with zero marking an empty slot. The table size
+  // is a power of two, kept at most half full.
+  std::vector<uint32_t> slots_;
+  size_t slot_mask_ {0};
+  bool allow_undeclared_ {false};
+};
+
+class NodeParameters;
+
+/// Cached handle to a single parameter, resolving its name only on mutation.
+/**
+ * A handle obtained from NodeParameters::get_parameter_handle() remembers
+ * where its parameter lives inside the current ParameterSnapshot. As long as
+ * no parameter of the node is mutated, reading through the handle is an
+ * atomic snapshot load plus a pointer comparison -- no string hashing or
+ * comparisons. After a mutation the handle transparently re-resolves the
+ * name against the new snapshot on its next read.
+ *
+ * Handles are cheap to copy and safe to read from several threads, but they
+ * borrow from the NodeParameters that created them and must not outlive it.
+ */
+class ParameterHandle
+{
+public:
+  /// Get the parameter, with the same semantics as NodeParameters::get_parameter.
+  /**
+   * \throws rclcpp::exceptions::ParameterNotDeclaredException if the
+   *   parameter is not declared and undeclared parameters are not allowed.
+   * \throws rclcpp::exceptions::ParameterUninitializedException if the
+   *   parameter was declared statically typed but never given a value.
+   */
+  RCLCPP_PUBLIC
+  rclcpp::Parameter
+  get_parameter() const;
+
+  /// Get the parameter into the output, returning true on success.
+  RCLCPP_PUBLIC
+  bool
+  get_parameter(rclcpp::Parameter & parameter) const;
+
+  /// Return the name the handle was created for.
+  RCLCPP_PUBLIC
+  const std::string &
+  get_name() const;
+
+private:
+  friend class NodeParameters;
+
+  RCLCPP_PUBLIC
+  ParameterHandle(const NodeParameters * node_parameters, const std::string & name);
+
+  // Resolution of the name against one particular snapshot; replaced
+  // wholesale when the node publishes a new snapshot, so readers always see
+  // a consistent (snapshot, info) pair.
+  struct Cache
+  {
+    ParameterSnapshot::ConstSharedPtr snapshot;
+    const ParameterInfo * info;
+  };
+
+  /// Return the parameter's info in the given snapshot, updating the cache.
+  const ParameterInfo *
+  resolve(const ParameterSnapshot::ConstSharedPtr & snapshot) const;
+
+  const NodeParameters * node_parameters_;
+  std::string name_;
+  mutable std::shared_ptr<const Cache> cache_;
+};
+
 // Internal RAII-style guard for mutation recursion
 class ParameterMutationRecursionGuard
 {
@@ -104,6 +268,7 @@ public:
     const node_interfaces::NodeClockInterface::SharedPtr node_clock,
     const std::vector<Parameter> & parameter_overrides,
     bool start_parameter_services,
+    bool use_shared_parameter_service,
     bool start_parameter_event_publisher,
     const rclcpp::QoS & parameter_event_qos,
     const rclcpp::PublisherOptionsBase & parameter_event_publisher_options,
@@ -132,6 +297,27 @@ public:
     rcl_interfaces::msg::ParameterDescriptor(),
     bool ignore_override = false) override;
 
+  /// Declare several parameters at once, publishing one consolidated event.
+  /**
+   * Each entry behaves like a call to declare_parameter(), but the whole
+   * batch is validated before anything is applied, the lock is taken only
+   * once, and a single ParameterEvent covering every declared parameter is
+   * published at the end instead of one event per parameter. This noticeably
+   * reduces bring-up time for nodes declaring many parameters.
+   *
+   * If any entry fails, the corresponding exception from declare_parameter()
+   * is thrown and no parameter of the batch is declared.
+   *
+   * \param[in] declarations The parameters to declare.
+   * \return The effective values of the declared parameters, in the order of
+   *   the declarations.
+   * \throws Same exceptions as declare_parameter(); additionally a name
+   *   appearing twice in the batch raises ParameterAlreadyDeclaredException.
+   */
+  RCLCPP_PUBLIC
+  std::vector<rclcpp::ParameterValue>
+  declare_parameters(const std::vector<ParameterDeclaration> & declarations);
+
   RCLCPP_PUBLIC
   void
   undeclare_parameter(const std::string & name) override;
@@ -214,6 +400,28 @@ public:
   const std::map<std::string, rclcpp::ParameterValue> &
   get_parameter_overrides() const override;
 
+  /// Get the latest parameter snapshot, without taking a lock.
+  /**
+   * The returned snapshot is immutable; reading several parameters from it
+   * yields a consistent view unaffected by concurrent sets. It reflects all
+   * mutations completed before this call, and none started after it.
+   */
+  RCLCPP_PUBLIC
+  ParameterSnapshot::ConstSharedPtr
+  get_parameter_snapshot() const;
+
+  /// Get a cached handle for hot-loop reads of a single parameter.
+  /**
+   * The handle resolves the name against the parameter storage once per
+   * mutation instead of once per read; see ParameterHandle. It borrows from
+   * this NodeParameters and must not outlive it.
+   *
+   * \param[in] name The name of the parameter, which may be undeclared.
+   */
+  RCLCPP_PUBLIC
+  ParameterHandle
+  get_parameter_handle(const std::string & name) const;
+
   using PreSetCallbacksHandleContainer = std::list<PreSetParametersCallbackHandle::WeakPtr>;
   using OnSetCallbacksHandleContainer = std::list<OnSetParametersCallbackHandle::WeakPtr>;
   using PostSetCallbacksHandleContainer = std::list<PostSetParametersCallbackHandle::WeakPtr>;
@@ -228,6 +436,14 @@ protected:
 private:
   RCLCPP_DISABLE_COPY(NodeParameters)
 
+  /// Rebuild and atomically publish the parameter snapshot.
+  /**
+   * Must be called with mutex_ held, after every mutation of parameters_.
+   * Lock-free readers observe the mutation once the new snapshot is stored.
+   */
+  void
+  refresh_parameter_snapshot();
+
   mutable std::recursive_mutex mutex_;
 
   // There are times when we don't want to allow modifications to parameters
@@ -243,6 +459,10 @@ private:
 
   std::map<std::string, ParameterInfo> parameters_;
 
+  // Latest immutable snapshot of parameters_, read with std::atomic_load by
+  // the lock-free read paths and replaced by refresh_parameter_snapshot().
+  ParameterSnapshot::ConstSharedPtr snapshot_;
+
   std::map<std::string, rclcpp::ParameterValue> parameter_overrides_;
 
   bool allow_undeclared_ = false;
@@ -251,6 +471,10 @@ private:
 
   std::shared_ptr<ParameterService> parameter_service_;
 
+  // Non-empty when registered with the process-wide SharedParameterService;
+  // used to unregister on destruction.
+  std::string shared_parameter_service_name_;
+
   std::string combined_name_;
 
   node_interfaces::NodeLoggingInterface::SharedPtr node_logging_;
@@ -15,7 +15,10 @@
 #ifndef RCLCPP__NODE_OPTIONS_HPP_
 #define RCLCPP__NODE_OPTIONS_HPP_
 
+#include <limits>
+#include <map>
 #include <memory>
+#include <memory_resource>
 #include <string>
 #include <vector>
 
@@ -44,9 +47,12 @@ public:
    *   - parameter_overrides = {}
    *   - use_global_arguments = true
    *   - use_intra_process_comms = false
+   *   - numa_domain = std::numeric_limits<size_t>::max() (no preference)
    *   - enable_topic_statistics = false
    *   - start_parameter_services = true
    *   - start_parameter_event_publisher = true
+   *   - lazy_parameters = false
+   *   - lazy_time_source = false
    *   - clock_type = RCL_ROS_TIME
    *   - clock_qos = rclcpp::ClockQoS()
    *   - use_clock_thread = true
@@ -58,6 +64,7 @@ public:
    *   - allow_undeclared_parameters = false
    *   - automatically_declare_parameters_from_overrides = false
    *   - allocator = rcl_get_default_allocator()
+   *   - memory_resource = nullptr (use the allocator)
    *
    * \param[in] allocator allocator to use in construction of NodeOptions.
    */
@@ -197,6 +204,26 @@ public:
   NodeOptions &
   use_intra_process_comms(bool use_intra_process_comms);
 
+  /// Return the preferred NUMA domain, or std::numeric_limits<size_t>::max() if unset.
+  RCLCPP_PUBLIC
+  size_t
+  numa_domain() const;
+
+  /// Set the preferred NUMA domain, return this for parameter idiom.
+  /**
+   * A placement hint consumed by rclcpp::executors::NumaExecutorSet: nodes
+   * carrying a hint are assigned to the executor pinned to that domain, so
+   * their callbacks run, and their message payloads are first touched, on the
+   * matching socket. Nodes without a hint are balanced across domains.
+   *
+   * The hint has no effect when the node is spun by a regular executor.
+   *
+   * Defaults to std::numeric_limits<size_t>::max(), meaning no preference.
+   */
+  RCLCPP_PUBLIC
+  NodeOptions &
+  numa_domain(size_t numa_domain);
+
   /// Return the enable_topic_statistics flag.
   RCLCPP_PUBLIC
   bool
@@ -233,6 +260,64 @@ public:
   NodeOptions &
   start_parameter_services(bool start_parameter_services);
 
+  /// Return the use_shared_parameter_service flag.
+  RCLCPP_PUBLIC
+  bool
+  use_shared_parameter_service() const;
+
+  /// Set the use_shared_parameter_service flag, return this for parameter idiom.
+  /**
+   * If true, instead of creating its own set of parameter services, the node
+   * registers with the process-wide rclcpp::SharedParameterService, whose
+   * single set of services multiplexes parameter access for every registered
+   * node by fully qualified node name. This collapses the per-node service
+   * count in large composed containers.
+   *
+   * Only effective when start_parameter_services is also true; the first
+   * registering node hosts the shared services and should outlive the others.
+   *
+   * \sa rclcpp::SharedParameterService
+   */
+  RCLCPP_PUBLIC
+  NodeOptions &
+  use_shared_parameter_service(bool use_shared_parameter_service);
+
+  /// Return the lazy_parameters flag.
+  RCLCPP_PUBLIC
+  bool
+  lazy_parameters() const;
+
+  /// Set the lazy_parameters flag, return this for parameter idiom.
+  /**
+   * If true, the node defers construction of its parameters interface (and
+   * with it the parameter services, the parameter event publisher, and the
+   * time source, which depends on parameters) until the first parameter
+   * access, cutting per-node construction cost for nodes that only publish
+   * and subscribe.  First use then synchronizes on an internal mutex while
+   * the interfaces are materialized.
+   *
+   * Note that parameter overrides and parameter services only take effect
+   * once the interface has materialized.
+   */
+  RCLCPP_PUBLIC
+  NodeOptions &
+  lazy_parameters(bool lazy_parameters);
+
+  /// Return the lazy_time_source flag.
+  RCLCPP_PUBLIC
+  bool
+  lazy_time_source() const;
+
+  /// Set the lazy_time_source flag, return this for parameter idiom.
+  /**
+   * If true, the node defers construction of its time source until the clock
+   * is first accessed (or the time source interface is requested), avoiding
+   * the /clock machinery for nodes that never consult node time.
+   */
+  RCLCPP_PUBLIC
+  NodeOptions &
+  lazy_time_source(bool lazy_time_source);
+
   /// Return the enable_logger_service flag.
   RCLCPP_PUBLIC
   bool
@@ -333,6 +418,28 @@ public:
   NodeOptions &
   rosout_qos(const rclcpp::QoS & rosout_qos);
 
+  /// Return a reference to the frozen QoS profile manifest.
+  RCLCPP_PUBLIC
+  const std::map<std::string, rclcpp::QoS> &
+  qos_profile_manifest() const;
+
+  /// Set the frozen QoS profile manifest, return this for parameter idiom.
+  /**
+   * The manifest maps entities to pre-resolved QoS profiles, keyed by
+   * "<fully qualified topic name>.<entity type>" with an optional
+   * "_<id>" suffix, matching the prefixes of the qos_overrides parameters
+   * (e.g. "/camera/image.publisher").
+   * When an entity is created with qos overriding options and its key is
+   * found here, the frozen profile is used verbatim and the per-entity
+   * qos_overrides parameters are not declared, which makes bulk entity
+   * bring-up considerably cheaper.
+   * Only the entity's validation callback, if any, still runs against the
+   * frozen profile.
+   */
+  RCLCPP_PUBLIC
+  NodeOptions &
+  qos_profile_manifest(const std::map<std::string, rclcpp::QoS> & qos_profile_manifest);
+
   /// Return a reference to the parameter_event_publisher_options.
   RCLCPP_PUBLIC
   const rclcpp::PublisherOptionsBase &
@@ -407,6 +514,27 @@ public:
   NodeOptions &
   allocator(rcl_allocator_t allocator);
 
+  /// Return the std::pmr::memory_resource to be used, or nullptr if none was set.
+  RCLCPP_PUBLIC
+  std::pmr::memory_resource *
+  memory_resource() const;
+
+  /// Set the std::pmr::memory_resource to back the node's allocations.
+  /**
+   * When set, the resource overrides the rcl_allocator_t from allocator() for
+   * the underlying rcl node options, and it is the resource users should pass
+   * to the polymorphic allocators of the node's entities (see
+   * rclcpp::allocator::PolymorphicAllocator) so that a whole node's
+   * steady-state allocations can come from a single arena.
+   *
+   * The resource is referenced, not owned: it must outlive the node and
+   * everything allocated on the node's behalf.
+   * This will cause the internal rcl_node_options_t struct to be invalidated.
+   */
+  RCLCPP_PUBLIC
+  NodeOptions &
+  memory_resource(std::pmr::memory_resource * memory_resource);
+
 private:
   // This is mutable to allow for a const accessor which lazily creates the node options instance.
   /// Underlying rcl_node_options structure.
@@ -428,10 +556,18 @@ private:
 
   bool use_intra_process_comms_ {false};
 
+  size_t numa_domain_ {std::numeric_limits<size_t>::max()};
+
   bool enable_topic_statistics_ {false};
 
   bool start_parameter_services_ {true};
 
+  bool use_shared_parameter_service_ {false};
+
+  bool lazy_parameters_ {false};
+
+  bool lazy_time_source_ {false};
+
   bool start_parameter_event_publisher_ {true};
 
   rcl_clock_type_t clock_type_ {RCL_ROS_TIME};
@@ -448,6 +584,8 @@ private:
 
   rclcpp::QoS rosout_qos_ = rclcpp::RosoutQoS();
 
+  std::map<std::string, rclcpp::QoS> qos_profile_manifest_;
+
   rclcpp::PublisherOptionsBase parameter_event_publisher_options_ = rclcpp::PublisherOptionsBase();
 
   bool allow_undeclared_parameters_ {false};
@@ -455,6 +593,8 @@ private:
   bool automatically_declare_parameters_from_overrides_ {false};
 
   rcl_allocator_t allocator_ {rcl_get_default_allocator()};
+
+  std::pmr::memory_resource * memory_resource_ {nullptr};
 };
 
 }  // namespace rclcpp
@@ -229,6 +229,54 @@ public:
       void(std::shared_future<std::vector<rcl_interfaces::msg::SetParametersResult>>)
     > callback = nullptr);
 
+  /// Set many parameters in chunked requests that are all in flight at once.
+  /**
+   * The parameters are split into chunks of at most chunk_size and one
+   * set_parameters request is issued per chunk immediately, without waiting
+   * for earlier chunks to complete, so a large transfer costs roughly one
+   * round trip over the link instead of one per chunk.  The results are
+   * reassembled into a single vector matching the input order.
+   *
+   * Each chunk is applied by the remote node independently; use
+   * set_parameters_atomically() if all-or-nothing semantics are required.
+   *
+   * \param parameters the parameters to set.
+   * \param chunk_size maximum number of parameters per request.
+   * \param callback optional callback invoked once all chunks completed.
+   * \return a future resolved when every chunk's results have arrived.
+   * \throw std::invalid_argument if chunk_size is zero.
+   */
+  RCLCPP_PUBLIC
+  std::shared_future<std::vector<rcl_interfaces::msg::SetParametersResult>>
+  set_parameters_bulk(
+    const std::vector<rclcpp::Parameter> & parameters,
+    size_t chunk_size = 64,
+    std::function<
+      void(std::shared_future<std::vector<rcl_interfaces::msg::SetParametersResult>>)
+    > callback = nullptr);
+
+  /// Set only the parameters that differ from a local snapshot.
+  /**
+   * Compares each parameter against the snapshot by name and value and
+   * forwards only the changed (or new) ones to set_parameters_bulk(), so
+   * repeatedly syncing a mostly unchanged configuration transfers close to
+   * nothing.  Parameters present in the snapshot but absent from parameters
+   * are left untouched on the remote node.
+   *
+   * \param parameters the desired parameter values.
+   * \param snapshot the last known remote values to diff against.
+   * \param chunk_size maximum number of parameters per request.
+   * \return a future with one result per transferred parameter; already
+   *   resolved with an empty vector if nothing differed.
+   * \throw std::invalid_argument if chunk_size is zero.
+   */
+  RCLCPP_PUBLIC
+  std::shared_future<std::vector<rcl_interfaces::msg::SetParametersResult>>
+  set_parameters_delta(
+    const std::vector<rclcpp::Parameter> & parameters,
+    const std::vector<rclcpp::Parameter> & snapshot,
+    size_t chunk_size = 64);
+
   RCLCPP_PUBLIC
   std::shared_future<rcl_interfaces::msg::SetParametersResult>
   set_parameters_atomically(
@@ -17,6 +17,7 @@
 
 #include <memory>
 #include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -77,6 +78,56 @@ private:
   std::shared_ptr<const rcl_interfaces::msg::ParameterEvent> event_;  ///< Keep event in scope
 };
 
+/// Reusable parameter event filter with hash-indexed name lookup.
+/**
+ * ParameterEventsFilter scans every filter name for every parameter in the
+ * event, which is fine for a handful of names but quadratic when watching
+ * thousands. This variant tokenizes the criteria once at construction into a
+ * hash set, so each event is evaluated in time proportional to the event
+ * itself, and it reuses its result storage across events so steady-state
+ * evaluation does not allocate.
+ */
+class IndexedParameterEventsFilter
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS(IndexedParameterEventsFilter)
+  using EventType = ParameterEventsFilter::EventType;
+  using EventPair = ParameterEventsFilter::EventPair;
+
+  /// Construct the filter criteria once, for evaluating many events.
+  /**
+   * \param[in] names A list of parameter names of interest.
+   * \param[in] types A list of the types of parameter events of interest.
+   *    EventType NEW, DELETED, or CHANGED
+   */
+  RCLCPP_PUBLIC
+  IndexedParameterEventsFilter(
+    const std::vector<std::string> & names,
+    const std::vector<EventType> & types);
+
+  /// Evaluate one event against the indexed criteria.
+  /**
+   * The returned reference, and the Parameter pointers in it, are only valid
+   * until the next call to evaluate(); the filter keeps the event in scope
+   * until then.
+   *
+   * \param[in] event The parameter event message to filter.
+   * \return All matching parameter changes in this event.
+   */
+  RCLCPP_PUBLIC
+  const std::vector<EventPair> &
+  evaluate(std::shared_ptr<const rcl_interfaces::msg::ParameterEvent> event);
+
+private:
+  std::unordered_set<std::string> names_;
+  bool match_new_ {false};
+  bool match_changed_ {false};
+  bool match_deleted_ {false};
+
+  std::vector<EventPair> result_;  ///< Reused across evaluate() calls
+  std::shared_ptr<const rcl_interfaces::msg::ParameterEvent> event_;  ///< Keep event in scope
+};
+
 }  // namespace rclcpp
 
 #endif  // RCLCPP__PARAMETER_EVENTS_FILTER_HPP_
@@ -0,0 +1,102 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__PARAMETER_FILE_SOURCE_HPP_
+#define RCLCPP__PARAMETER_FILE_SOURCE_HPP_
+
+#include <rcl_yaml_param_parser/types.h>
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "rclcpp/macros.hpp"
+#include "rclcpp/parameter.hpp"
+#include "rclcpp/parameter_map.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+
+/// A parameter file parsed once and served out in per-node slices on demand.
+/**
+ * parameter_map_from_yaml_file() re-parses the whole file and converts every
+ * value on each call, even when the caller only needs one node's slice. For a
+ * container composing many nodes against one large parameter file this
+ * multiplies the parse cost by the node count.
+ *
+ * A ParameterFileSource parses the file a single time, keeps the parsed tree
+ * in its original storage, and converts values to rclcpp::Parameter lazily,
+ * per requested node, caching each converted slice. Instances are shared
+ * process-wide through open(), keyed by file name, so every node in a
+ * container reads from the same parse. A file that changed on disk (size or
+ * modification time) is re-parsed on the next open().
+ */
+class ParameterFileSource
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS_NOT_COPYABLE(ParameterFileSource)
+
+  /// Open a parameter file, reusing the process-wide parse if one exists.
+  /**
+   * \param[in] yaml_filename full name of the yaml file.
+   * \returns the shared source for that file.
+   * \throws from rcl error of rcl_parse_yaml_file()
+   */
+  RCLCPP_PUBLIC
+  static
+  SharedPtr
+  open(const std::string & yaml_filename);
+
+  RCLCPP_PUBLIC
+  ~ParameterFileSource();
+
+  /// Return the node names the file holds parameters for, without converting values.
+  RCLCPP_PUBLIC
+  std::vector<std::string>
+  node_names() const;
+
+  /// Return the parameters for one node, converting and caching them on first request.
+  /**
+   * \param[in] node_fqn a Fully Qualified Name of a node; sections using
+   *   wildcards are matched the same way parameter_map_from() matches them.
+   * \returns the node's parameters; empty if the file has no matching section.
+   * \throws InvalidParametersException if the parsed tree is inconsistent.
+   */
+  RCLCPP_PUBLIC
+  std::vector<Parameter>
+  parameters(const std::string & node_fqn);
+
+  /// Convert and return the whole file, equivalent to parameter_map_from_yaml_file().
+  RCLCPP_PUBLIC
+  ParameterMap
+  parameter_map();
+
+private:
+  RCLCPP_PUBLIC
+  explicit ParameterFileSource(const std::string & yaml_filename);
+
+  std::string yaml_filename_;
+  rcl_params_t * params_ {nullptr};
+  std::mutex mutex_;
+  // Converted slices, keyed by the fully qualified node name they were
+  // requested for.
+  std::unordered_map<std::string, std::vector<Parameter>> slices_;
+};
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__PARAMETER_FILE_SOURCE_HPP_
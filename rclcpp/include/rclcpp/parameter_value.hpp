@@ -17,6 +17,7 @@
 
 #include <exception>
 #include <iostream>
+#include <memory>
 #include <ostream>
 #include <sstream>
 #include <string>
@@ -147,10 +148,10 @@ public:
   typename std::enable_if<type == ParameterType::PARAMETER_BOOL, const bool &>::type
   get() const
   {
-    if (value_.type != rcl_interfaces::msg::ParameterType::PARAMETER_BOOL) {
+    if (type_ != rcl_interfaces::msg::ParameterType::PARAMETER_BOOL) {
       throw ParameterTypeException(ParameterType::PARAMETER_BOOL, get_type());
     }
-    return value_.bool_value;
+    return bool_value_;
   }
 
   template<ParameterType type>
@@ -158,10 +159,10 @@ public:
   typename std::enable_if<type == ParameterType::PARAMETER_INTEGER, const int64_t &>::type
   get() const
   {
-    if (value_.type != rcl_interfaces::msg::ParameterType::PARAMETER_INTEGER) {
+    if (type_ != rcl_interfaces::msg::ParameterType::PARAMETER_INTEGER) {
       throw ParameterTypeException(ParameterType::PARAMETER_INTEGER, get_type());
     }
-    return value_.integer_value;
+    return integer_value_;
   }
 
   template<ParameterType type>
@@ -169,10 +170,10 @@ public:
   typename std::enable_if<type == ParameterType::PARAMETER_DOUBLE, const double &>::type
   get() const
   {
-    if (value_.type != rcl_interfaces::msg::ParameterType::PARAMETER_DOUBLE) {
+    if (type_ != rcl_interfaces::msg::ParameterType::PARAMETER_DOUBLE) {
       throw ParameterTypeException(ParameterType::PARAMETER_DOUBLE, get_type());
     }
-    return value_.double_value;
+    return double_value_;
   }
 
   template<ParameterType type>
@@ -180,10 +181,10 @@ public:
   typename std::enable_if<type == ParameterType::PARAMETER_STRING, const std::string &>::type
   get() const
   {
-    if (value_.type != rcl_interfaces::msg::ParameterType::PARAMETER_STRING) {
+    if (type_ != rcl_interfaces::msg::ParameterType::PARAMETER_STRING) {
       throw ParameterTypeException(ParameterType::PARAMETER_STRING, get_type());
     }
-    return value_.string_value;
+    return payload_->string_value;
   }
 
   template<ParameterType type>
@@ -192,10 +193,10 @@ public:
     type == ParameterType::PARAMETER_BYTE_ARRAY, const std::vector<uint8_t> &>::type
   get() const
   {
-    if (value_.type != rcl_interfaces::msg::ParameterType::PARAMETER_BYTE_ARRAY) {
+    if (type_ != rcl_interfaces::msg::ParameterType::PARAMETER_BYTE_ARRAY) {
       throw ParameterTypeException(ParameterType::PARAMETER_BYTE_ARRAY, get_type());
     }
-    return value_.byte_array_value;
+    return payload_->byte_array_value;
   }
 
   template<ParameterType type>
@@ -204,10 +205,10 @@ public:
     type == ParameterType::PARAMETER_BOOL_ARRAY, const std::vector<bool> &>::type
   get() const
   {
-    if (value_.type != rcl_interfaces::msg::ParameterType::PARAMETER_BOOL_ARRAY) {
+    if (type_ != rcl_interfaces::msg::ParameterType::PARAMETER_BOOL_ARRAY) {
       throw ParameterTypeException(ParameterType::PARAMETER_BOOL_ARRAY, get_type());
     }
-    return value_.bool_array_value;
+    return payload_->bool_array_value;
   }
 
   template<ParameterType type>
@@ -216,10 +217,10 @@ public:
     type == ParameterType::PARAMETER_INTEGER_ARRAY, const std::vector<int64_t> &>::type
   get() const
   {
-    if (value_.type != rcl_interfaces::msg::ParameterType::PARAMETER_INTEGER_ARRAY) {
+    if (type_ != rcl_interfaces::msg::ParameterType::PARAMETER_INTEGER_ARRAY) {
       throw ParameterTypeException(ParameterType::PARAMETER_INTEGER_ARRAY, get_type());
     }
-    return value_.integer_array_value;
+    return payload_->integer_array_value;
   }
 
   template<ParameterType type>
@@ -228,10 +229,10 @@ public:
     type == ParameterType::PARAMETER_DOUBLE_ARRAY, const std::vector<double> &>::type
   get() const
   {
-    if (value_.type != rcl_interfaces::msg::ParameterType::PARAMETER_DOUBLE_ARRAY) {
+    if (type_ != rcl_interfaces::msg::ParameterType::PARAMETER_DOUBLE_ARRAY) {
       throw ParameterTypeException(ParameterType::PARAMETER_DOUBLE_ARRAY, get_type());
     }
-    return value_.double_array_value;
+    return payload_->double_array_value;
   }
 
   template<ParameterType type>
@@ -240,10 +241,10 @@ public:
     type == ParameterType::PARAMETER_STRING_ARRAY, const std::vector<std::string> &>::type
   get() const
   {
-    if (value_.type != rcl_interfaces::msg::ParameterType::PARAMETER_STRING_ARRAY) {
+    if (type_ != rcl_interfaces::msg::ParameterType::PARAMETER_STRING_ARRAY) {
       throw ParameterTypeException(ParameterType::PARAMETER_STRING_ARRAY, get_type());
     }
-    return value_.string_array_value;
+    return payload_->string_array_value;
   }
 
   // The following get() variants allow the use of primitive types
@@ -352,7 +353,18 @@ public:
   }
 
 private:
-  rcl_interfaces::msg::ParameterValue value_;
+  /// Type tag; scalar values are stored inline, everything else lives in payload_.
+  uint8_t type_ {rcl_interfaces::msg::ParameterType::PARAMETER_NOT_SET};
+  /// Inline storage for scalar values, so scalar parameters never allocate.
+  bool bool_value_ {false};
+  int64_t integer_value_ {0};
+  double double_value_ {0.0};
+  /// String and array payload, immutable once constructed and shared between copies.
+  /**
+   * Because ParameterValue offers no mutating interface after construction, copies can
+   * alias one payload; copying a value is then O(1) regardless of array or string size.
+   */
+  std::shared_ptr<const rcl_interfaces::msg::ParameterValue> payload_;
 };
 
 /// Return the value of a parameter as a string
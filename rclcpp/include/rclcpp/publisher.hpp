@@ -36,6 +36,7 @@
 #include "rclcpp/get_message_type_support_handle.hpp"
 #include "rclcpp/is_ros_compatible_type.hpp"
 #include "rclcpp/loaned_message.hpp"
+#include "rclcpp/loaned_message_pool.hpp"
 #include "rclcpp/macros.hpp"
 #include "rclcpp/node_interfaces/node_base_interface.hpp"
 #include "rclcpp/publisher_base.hpp"
@@ -133,14 +134,30 @@ public:
       rclcpp::get_message_type_support_handle<MessageT>(),
       options.template to_rcl_publisher_options<MessageT>(qos),
       // NOTE(methylDragon): Passing these args separately is necessary for event binding
-      options.event_callbacks,
-      options.use_default_callbacks),
+      options.slim ? PublisherEventCallbacks() : options.event_callbacks,
+      options.use_default_callbacks && !options.slim),
     options_(options),
     published_type_allocator_(*options.get_allocator()),
     ros_message_type_allocator_(*options.get_allocator())
   {
+    if (options.slim &&
+      (options.event_callbacks.deadline_callback ||
+      options.event_callbacks.liveliness_callback ||
+      options.event_callbacks.incompatible_qos_callback ||
+      options.event_callbacks.incompatible_type_callback ||
+      options.event_callbacks.matched_callback))
+    {
+      throw std::invalid_argument("event_callbacks must be empty when the slim option is set");
+    }
     allocator::set_allocator_for_deleter(&published_type_deleter_, &published_type_allocator_);
     allocator::set_allocator_for_deleter(&ros_message_type_deleter_, &ros_message_type_allocator_);
+    if (options.loaned_message_pool_depth > 0) {
+      loaned_message_pool_ = std::make_shared<LoanedMessagePool<ROSMessageType, AllocatorT>>(
+        options.loaned_message_pool_depth, ros_message_type_allocator_);
+      // Pre-construct the pool so that borrow_loaned_message() is
+      // allocation-free from the first borrow on.
+      loaned_message_pool_->reserve(options.loaned_message_pool_depth);
+    }
     // Setup continues in the post construction method, post_init_setup().
   }
 
@@ -171,9 +188,12 @@ public:
         throw std::invalid_argument(
                 "intraprocess communication is not allowed with a zero qos history depth value");
       }
-      if (qos.durability() != rclcpp::DurabilityPolicy::Volatile) {
+      if (qos.durability() != rclcpp::DurabilityPolicy::Volatile &&
+        qos.durability() != rclcpp::DurabilityPolicy::TransientLocal)
+      {
         throw std::invalid_argument(
-                "intraprocess communication allowed only with volatile durability");
+                "intraprocess communication allowed only with volatile or "
+                "transient local durability");
       }
       uint64_t intra_process_publisher_id = ipm->add_publisher(this->shared_from_this());
       this->setup_intra_process(
@@ -203,6 +223,9 @@ public:
   rclcpp::LoanedMessage<ROSMessageType, AllocatorT>
   borrow_loaned_message()
   {
+    if (loaned_message_pool_) {
+      return rclcpp::LoanedMessage<ROSMessageType, AllocatorT>(*this, loaned_message_pool_);
+    }
     return rclcpp::LoanedMessage<ROSMessageType, AllocatorT>(
       *this,
       this->get_ros_message_type_allocator());
@@ -245,6 +268,8 @@ public:
       this->do_inter_process_publish(*shared_msg);
     } else {
       this->do_intra_process_ros_message_publish(std::move(msg));
+      introspection_counters_->messages.fetch_add(1, std::memory_order_relaxed);
+      this->count_publish_latency();
     }
   }
 
@@ -318,6 +343,8 @@ public:
       this->do_inter_process_publish(ros_msg);
     } else {
       this->do_intra_process_publish(std::move(msg));
+      introspection_counters_->messages.fetch_add(1, std::memory_order_relaxed);
+      this->count_publish_latency();
     }
   }
 
@@ -417,6 +444,63 @@ public:
     return ros_message_type_allocator_;
   }
 
+  /// Publish a message over the middleware without throwing on failure.
+  /**
+   * Error-code variant of publish() for callers that cannot afford exceptions
+   * on the hot path, e.g. builds compiled without exception support.
+   * No allocation happens on any branch and the rcl error state is reset
+   * before returning, so nothing is left pending for a later throwing call.
+   *
+   * Intra-process delivery needs buffer allocation and is not attempted:
+   * when intra-process is enabled on this publisher, RCL_RET_UNSUPPORTED is
+   * returned and nothing is published, so local intra-process subscriptions
+   * cannot silently miss the message.
+   *
+   * \param[in] msg the message to publish.
+   * \return RCL_RET_OK if the message was published,
+   *   RCL_RET_UNSUPPORTED if intra-process is enabled on this publisher,
+   *   or the error code from rcl_publish() on failure.
+   */
+  rcl_ret_t
+  try_publish(const ROSMessageType & msg) noexcept
+  {
+    if (intra_process_is_enabled_) {
+      return RCL_RET_UNSUPPORTED;
+    }
+    TRACETOOLS_TRACEPOINT(rclcpp_publish, nullptr, static_cast<const void *>(&msg));
+    rcl_ret_t status = rcl_publish(publisher_handle_.get(), &msg, nullptr);
+    if (RCL_RET_OK != status) {
+      rcl_reset_error();
+      return status;
+    }
+    introspection_counters_->messages.fetch_add(1, std::memory_order_relaxed);
+    this->count_publish_latency();
+    return RCL_RET_OK;
+  }
+
+  /// Publish unless a matched intra-process buffer would overwrite unread data.
+  /**
+   * Fast-fail variant for producers that prefer adapting their rate over
+   * losing data: when some matched intra-process subscription buffer is
+   * full, nothing is published anywhere and false is returned. The capacity
+   * check and the delivery are not atomic, a competing publisher can fill
+   * a freed slot in between, so this is a strong hint, not a reservation.
+   * See PublisherBase::ipm_buffers_have_capacity().
+   *
+   * \param[in] msg the message, by any type publish() accepts.
+   * \return true if the message was published.
+   */
+  template<typename MsgT>
+  bool
+  publish_if_capacity(MsgT && msg)
+  {
+    if (!this->ipm_buffers_have_capacity()) {
+      return false;
+    }
+    this->publish(std::forward<MsgT>(msg));
+    return true;
+  }
+
 protected:
   void
   do_inter_process_publish(const ROSMessageType & msg)
@@ -437,6 +521,8 @@ protected:
     if (RCL_RET_OK != status) {
       rclcpp::exceptions::throw_from_rcl_error(status, "failed to publish message");
     }
+    introspection_counters_->messages.fetch_add(1, std::memory_order_relaxed);
+    this->count_publish_latency();
   }
 
   void
@@ -450,6 +536,8 @@ protected:
     if (RCL_RET_OK != status) {
       rclcpp::exceptions::throw_from_rcl_error(status, "failed to publish serialized message");
     }
+    introspection_counters_->messages.fetch_add(1, std::memory_order_relaxed);
+    this->count_publish_latency();
   }
 
   void
@@ -472,6 +560,8 @@ protected:
     if (RCL_RET_OK != status) {
       rclcpp::exceptions::throw_from_rcl_error(status, "failed to publish message");
     }
+    introspection_counters_->messages.fetch_add(1, std::memory_order_relaxed);
+    this->count_publish_latency();
   }
 
   void
@@ -490,6 +580,7 @@ protected:
       static_cast<const void *>(publisher_handle_.get()),
       msg.get());
 
+    this->check_backpressure();
     ipm->template do_intra_process_publish<PublishedType, ROSMessageType, AllocatorT>(
       intra_process_publisher_id_,
       std::move(msg),
@@ -512,6 +603,7 @@ protected:
       static_cast<const void *>(publisher_handle_.get()),
       msg.get());
 
+    this->check_backpressure();
     ipm->template do_intra_process_publish<ROSMessageType, ROSMessageType, AllocatorT>(
       intra_process_publisher_id_,
       std::move(msg),
@@ -535,6 +627,7 @@ protected:
       static_cast<const void *>(publisher_handle_.get()),
       msg.get());
 
+    this->check_backpressure();
     return ipm->template do_intra_process_publish_and_return_shared<ROSMessageType, ROSMessageType,
              AllocatorT>(
       intra_process_publisher_id_,
@@ -581,6 +674,10 @@ protected:
   PublishedTypeDeleter published_type_deleter_;
   ROSMessageTypeAllocator ros_message_type_allocator_;
   ROSMessageTypeDeleter ros_message_type_deleter_;
+
+  /// Pool recycling fallback instances for borrow_loaned_message(), created
+  /// when options request a non-zero loaned_message_pool_depth.
+  std::shared_ptr<LoanedMessagePool<ROSMessageType, AllocatorT>> loaned_message_pool_;
 };
 
 }  // namespace rclcpp
@@ -18,10 +18,13 @@
 #include <rmw/error_handling.h>
 #include <rmw/rmw.h>
 
+#include <atomic>
 #include <chrono>
 #include <functional>
+#include <future>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <unordered_map>
@@ -30,10 +33,13 @@
 
 #include "rcl/publisher.h"
 
+#include "rclcpp/introspection.hpp"
 #include "rclcpp/macros.hpp"
 #include "rclcpp/network_flow_endpoint.hpp"
 #include "rclcpp/qos.hpp"
 #include "rclcpp/event_handler.hpp"
+#include "rclcpp/interned_qos.hpp"
+#include "rclcpp/topic_name.hpp"
 #include "rclcpp/type_support_decl.hpp"
 #include "rclcpp/visibility_control.hpp"
 #include "rcpputils/time.hpp"
@@ -48,6 +54,9 @@ class NodeBaseInterface;
 class NodeTopicsInterface;
 }  // namespace node_interfaces
 
+/// Forward declared to avoid including `context.hpp`; only a weak reference is held.
+class Context;
+
 namespace experimental
 {
 /**
@@ -96,6 +105,26 @@ public:
   const char *
   get_topic_name() const;
 
+  /// Get the interned fully-qualified topic name.
+  /**
+   * The name is interned once at construction, so comparisons against other
+   * interned names are pointer comparisons.
+   * \return The interned topic name.
+   */
+  RCLCPP_PUBLIC
+  const rclcpp::TopicName &
+  get_interned_topic_name() const;
+
+  /// Get the interned actual QoS settings of this publisher.
+  /**
+   * The rmw-resolved profile is interned once at construction, so comparisons
+   * against other interned profiles are pointer comparisons.
+   * \return The interned actual QoS profile.
+   */
+  RCLCPP_PUBLIC
+  const rclcpp::InternedQoS &
+  get_interned_actual_qos() const;
+
   /// Get the queue size for this publisher.
   /** \return The queue size. */
   RCLCPP_PUBLIC
@@ -167,6 +196,35 @@ public:
   rclcpp::QoS
   get_actual_qos() const;
 
+  /// Get the introspection counter block for this publisher.
+  /** \return The counter block, see rclcpp::introspection::EntityCounters. */
+  RCLCPP_PUBLIC
+  std::shared_ptr<rclcpp::introspection::EntityCounters>
+  get_introspection_counters() const;
+
+  /// Set the origin timestamp attributed to the next published message.
+  /**
+   * Components which forward messages, such as relays, set this to the
+   * origin timestamp of the message they are about to republish, see
+   * rclcpp::MessageInfo::get_origin_timestamp(). The next publish then
+   * records the latency accumulated since that origin into the counter
+   * block instead of starting a new measurement, chaining end-to-end
+   * latency across hops without touching the payload.
+   *
+   * The value applies to exactly one publish; it is consumed when the
+   * latency sample is recorded.
+   *
+   * \param[in] origin_timestamp origin timestamp in nanoseconds, 0 to clear.
+   */
+  RCLCPP_PUBLIC
+  void
+  set_origin_timestamp(rmw_time_point_value_t origin_timestamp);
+
+  /// Get the origin timestamp pending for the next publish, 0 if none.
+  RCLCPP_PUBLIC
+  rmw_time_point_value_t
+  get_origin_timestamp() const;
+
   /// Check if publisher instance can loan messages.
   /**
    * Depending on the middleware and the message type, this will return true if the middleware
@@ -215,6 +273,20 @@ public:
   std::vector<rclcpp::NetworkFlowEndpoint>
   get_network_flow_endpoints() const;
 
+  /// Get a cached view of the network flow endpoints.
+  /**
+   * Converts and caches the endpoints on first use; later calls return the
+   * cached vector without querying the middleware or allocating, which suits
+   * periodic polling.
+   * The cache is refreshed when the matched subscription count changes, since
+   * that is when the set of flows this publisher sends on can change.
+   *
+   * \return shared pointer to the cached vector of NetworkFlowEndpoint
+   */
+  RCLCPP_PUBLIC
+  std::shared_ptr<const std::vector<rclcpp::NetworkFlowEndpoint>>
+  get_network_flow_endpoints_view() const;
+
   /// Return the lowest available capacity for all subscription buffers.
   /**
    * For intraprocess communication return the lowest buffer capacity for all subscriptions.
@@ -226,6 +298,40 @@ public:
   size_t
   lowest_available_ipm_capacity() const;
 
+  /// Return whether a publish now would avoid overwriting unread intra-process data.
+  /**
+   * True when intra-process is disabled, when no intra-process subscription
+   * is matched, or when every matched subscription buffer has room for at
+   * least one more message. The check is momentary: consumers and competing
+   * publishers can change the capacity between this call and a publish.
+   *
+   * \return true unless some matched intra-process buffer is full
+   */
+  RCLCPP_PUBLIC
+  bool
+  ipm_buffers_have_capacity() const;
+
+  /// Register a callback fired when subscription buffers run low at publish time.
+  /**
+   * Before every intra-process publish, the lowest available capacity
+   * across the matched subscription buffers is compared against the
+   * threshold; at or below it the callback is invoked from the publishing
+   * thread with that capacity. This gives a producer a backpressure signal
+   * to adapt its rate instead of silently overwriting a slow consumer's
+   * buffer or blocking.
+   *
+   * While no callback is registered the cost is one relaxed atomic load
+   * per publish. The callback must not publish on this publisher.
+   *
+   * \param[in] low_capacity_threshold invoke the callback when the lowest
+   *   available capacity is at or below this many messages.
+   * \param[in] callback invoked with the observed capacity; nullptr clears
+   *   the registration.
+   */
+  RCLCPP_PUBLIC
+  void
+  set_backpressure_callback(size_t low_capacity_threshold, std::function<void (size_t)> callback);
+
   /// Wait until all published messages are acknowledged or until the specified timeout elapses.
   /**
    * This method waits until all published messages are acknowledged by all matching
@@ -266,6 +372,57 @@ public:
     }
   }
 
+  /// Register a callback to be invoked once all published messages are acknowledged.
+  /**
+   * This is the non-blocking counterpart of wait_for_all_acked().
+   * The caller's thread returns immediately; the callback is invoked later, from a shared
+   * background thread, with `true` if every published message was acknowledged before the
+   * timeout elapsed and `false` otherwise.
+   * All publishers in the process share a single polling thread, so registering many
+   * concurrent waits does not consume additional threads.
+   *
+   * If the timeout is negative the wait never expires; the callback fires only once all
+   * messages are acknowledged (or with `false` at shutdown if the process exits first).
+   *
+   * The callback must not block; do significant work elsewhere.
+   * The publisher handle is kept alive until the callback has been invoked, so it is safe
+   * to let the publisher go out of scope while a wait is in flight.
+   *
+   * \param[in] timeout the duration to wait for all published messages to be acknowledged.
+   * \param[in] callback functor invoked exactly once with the outcome of the wait.
+   * \throws std::invalid_argument if the callback is not callable
+   */
+  RCLCPP_PUBLIC
+  void
+  async_wait_for_all_acked(
+    std::chrono::nanoseconds timeout,
+    std::function<void(bool)> callback) const;
+
+  /// Return a future that completes once all published messages are acknowledged.
+  /**
+   * Convenience overload of async_wait_for_all_acked() for callers that prefer a
+   * std::future over a callback.
+   *
+   * \param[in] timeout the duration to wait for all published messages to be acknowledged.
+   * \return a future resolving to `true` if all published messages were acknowledged before
+   *   the given timeout elapsed, otherwise `false`.
+   * \throws std::invalid_argument if timeout is greater than std::chrono::nanoseconds::max() or
+   *   less than std::chrono::nanoseconds::min()
+   */
+  template<typename DurationRepT = int64_t, typename DurationT = std::milli>
+  std::future<bool>
+  async_wait_for_all_acked(
+    std::chrono::duration<DurationRepT, DurationT> timeout =
+    std::chrono::duration<DurationRepT, DurationT>(-1)) const
+  {
+    auto promise = std::make_shared<std::promise<bool>>();
+    std::future<bool> future = promise->get_future();
+    async_wait_for_all_acked(
+      rcpputils::convert_to_nanoseconds(timeout),
+      [promise](bool acked) {promise->set_value(acked);});
+    return future;
+  }
+
   /// Set a callback to be called when each new qos event instance occurs.
   /**
    * The callback receives a size_t which is the number of events that occurred
@@ -353,8 +510,30 @@ protected:
   RCLCPP_PUBLIC
   void default_incompatible_type_callback(IncompatibleTypeInfo & info) const;
 
+  /// Record the pending origin latency, called by the publish paths.
+  /**
+   * If an origin timestamp is pending it is consumed and the latency from
+   * the origin to now is recorded into the counter block; otherwise this is
+   * a relaxed load and a branch, see set_origin_timestamp().
+   */
+  RCLCPP_PUBLIC
+  void
+  count_publish_latency();
+
+  /// Fire the backpressure callback if matched buffers run low.
+  /**
+   * Called by the intra-process publish paths before the message is added
+   * to the buffers, so the observed capacity is the one this publish
+   * encounters, see set_backpressure_callback().
+   */
+  RCLCPP_PUBLIC
+  void
+  check_backpressure();
+
   std::shared_ptr<rcl_node_t> rcl_node_handle_;
 
+  std::weak_ptr<rclcpp::Context> weak_context_;
+
   std::shared_ptr<rcl_publisher_t> publisher_handle_;
 
   std::unordered_map<rcl_publisher_event_type_t,
@@ -368,9 +547,29 @@ protected:
 
   rmw_gid_t rmw_gid_;
 
+  rclcpp::TopicName interned_topic_name_;
+  rclcpp::InternedQoS interned_actual_qos_;
+
   const rosidl_message_type_support_t type_support_;
 
   const PublisherEventCallbacks event_callbacks_;
+
+  std::shared_ptr<rclcpp::introspection::EntityCounters> introspection_counters_;
+
+  /// Origin timestamp attributed to the next publish, 0 when none is pending.
+  std::atomic<rmw_time_point_value_t> origin_timestamp_ {0};
+
+  /// Backpressure callback state, see set_backpressure_callback().
+  std::atomic<bool> backpressure_callback_set_ {false};
+  mutable std::mutex backpressure_mutex_;
+  size_t backpressure_threshold_ {0};
+  std::function<void (size_t)> backpressure_callback_;
+
+  /// Converted network flow endpoints, see get_network_flow_endpoints_view().
+  mutable std::mutex network_flow_endpoints_mutex_;
+  mutable std::shared_ptr<const std::vector<rclcpp::NetworkFlowEndpoint>>
+  network_flow_endpoints_cache_;
+  mutable size_t network_flow_endpoints_matched_count_ {0};
 };
 
 }  // namespace rclcpp
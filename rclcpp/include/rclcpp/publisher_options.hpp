@@ -46,6 +46,16 @@ struct PublisherOptionsBase
   /// Whether or not to use default callbacks when user doesn't supply any in event_callbacks
   bool use_default_callbacks = true;
 
+  /// Slim profile: construct only the core publisher.
+  /**
+   * Skips the optional per-entity machinery: no QoS event handlers are
+   * created, neither the defaults nor user-supplied ones (event_callbacks
+   * must be empty when this is set). For fleets where most entities use none
+   * of the optional features this trims per-entity footprint and
+   * construction time.
+   */
+  bool slim = false;
+
   /// Require middleware to generate unique network flow endpoints
   /// Disabled by default
   rmw_unique_network_flow_endpoints_requirement_t require_unique_network_flow_endpoints =
@@ -58,6 +68,16 @@ struct PublisherOptionsBase
   std::shared_ptr<rclcpp::detail::RMWImplementationSpecificPublisherPayload>
   rmw_implementation_payload = nullptr;
 
+  /// Depth of the message pool backing borrow_loaned_message() when the
+  /// middleware can not loan messages.
+  /// When non-zero, fallback message instances are recycled through a
+  /// per-publisher pool of this depth instead of being allocated per borrow.
+  /// Disabled by default.
+  size_t loaned_message_pool_depth = 0;
+
+  /// Qos parameter override handling; the default (no policy kinds) skips the
+  /// parameter machinery entirely during publisher creation, and enabled
+  /// overrides resolve through a per-node cache on repeated creation.
   QosOverridingOptions qos_overriding_options;
 };
 
@@ -16,12 +16,14 @@
 #define RCLCPP__RATE_HPP_
 
 #include <chrono>
+#include <cstdint>
 #include <memory>
 #include <thread>
 
 #include "rclcpp/macros.hpp"
 #include "rclcpp/utilities.hpp"
 #include "rclcpp/visibility_control.hpp"
+#include "rclcpp/wait_strategy.hpp"
 
 namespace rclcpp
 {
@@ -115,6 +117,118 @@ private:
 using Rate = GenericRate<std::chrono::system_clock>;
 using WallRate = GenericRate<std::chrono::steady_clock>;
 
+/// How PrecisionRate reschedules after an iteration overran its period.
+enum class RateOverrunPolicy
+{
+  /// Realign the next deadline past now, keeping the phase of the original
+  /// schedule; missed periods are skipped.
+  Skip,
+  /// Keep advancing the deadline by exactly one period, so missed cycles run
+  /// back-to-back until the schedule is recovered.
+  CatchUp,
+};
+
+/// Drift-free rate based on absolute deadlines on the steady clock.
+/**
+ * Unlike GenericRate, which schedules relative to the time sleep() was
+ * entered, PrecisionRate keeps an absolute next-deadline in raw nanoseconds,
+ * so jitter in individual iterations never accumulates into drift.  The
+ * sleep is batched: one coarse sleep up to spin_duration before the
+ * deadline, then a cpu-relax spin across the remainder, which covers the
+ * wakeup latency of the coarse sleep for tight control loops.
+ */
+class PrecisionRate : public RateBase
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS(PrecisionRate)
+
+  /**
+   * \param[in] rate loop frequency in Hz.
+   * \param[in] overrun_policy how to reschedule when an iteration overruns.
+   * \param[in] spin_duration how long before the deadline to stop sleeping
+   *   and spin; zero disables spinning entirely.
+   */
+  explicit PrecisionRate(
+    double rate,
+    RateOverrunPolicy overrun_policy = RateOverrunPolicy::Skip,
+    std::chrono::nanoseconds spin_duration = std::chrono::microseconds(50))
+  : PrecisionRate(
+      duration_cast<nanoseconds>(duration<double>(1.0 / rate)), overrun_policy, spin_duration)
+  {}
+
+  explicit PrecisionRate(
+    std::chrono::nanoseconds period,
+    RateOverrunPolicy overrun_policy = RateOverrunPolicy::Skip,
+    std::chrono::nanoseconds spin_duration = std::chrono::microseconds(50))
+  : period_ns_(period.count()),
+    spin_ns_(spin_duration.count()),
+    overrun_policy_(overrun_policy),
+    next_deadline_ns_(now_ns() + period.count())
+  {}
+
+  bool
+  sleep() override
+  {
+    const int64_t deadline = next_deadline_ns_;
+    const int64_t now = now_ns();
+    if (now >= deadline) {
+      // The iteration overran its period.
+      if (RateOverrunPolicy::Skip == overrun_policy_) {
+        const int64_t missed = (now - deadline) / period_ns_ + 1;
+        next_deadline_ns_ = deadline + missed * period_ns_;
+      } else {
+        next_deadline_ns_ = deadline + period_ns_;
+      }
+      return false;
+    }
+    next_deadline_ns_ = deadline + period_ns_;
+
+    // Coarse sleep until spin_ns_ before the deadline, then spin the rest.
+    const int64_t park_until = deadline - spin_ns_;
+    if (park_until > now) {
+      rclcpp::sleep_for(nanoseconds(park_until - now));
+    }
+    while (now_ns() < deadline) {
+      // Zero elapsed time keeps this on the cpu-relax path, never yielding.
+      AdaptiveSpinWaiter::pause(nanoseconds::zero(), nanoseconds::max());
+    }
+    return true;
+  }
+
+  bool
+  is_steady() const override
+  {
+    return true;
+  }
+
+  void
+  reset() override
+  {
+    next_deadline_ns_ = now_ns() + period_ns_;
+  }
+
+  std::chrono::nanoseconds
+  period() const
+  {
+    return nanoseconds(period_ns_);
+  }
+
+private:
+  RCLCPP_DISABLE_COPY(PrecisionRate)
+
+  static int64_t
+  now_ns()
+  {
+    return std::chrono::duration_cast<nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+  const int64_t period_ns_;
+  const int64_t spin_ns_;
+  const RateOverrunPolicy overrun_policy_;
+  int64_t next_deadline_ns_;
+};
+
 }  // namespace rclcpp
 
 #endif  // RCLCPP__RATE_HPP_
@@ -0,0 +1,303 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__RELAY_HPP_
+#define RCLCPP__RELAY_HPP_
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "rclcpp/create_generic_publisher.hpp"
+#include "rclcpp/create_publisher.hpp"
+#include "rclcpp/create_subscription.hpp"
+#include "rclcpp/generic_publisher.hpp"
+#include "rclcpp/generic_subscription.hpp"
+#include "rclcpp/macros.hpp"
+#include "rclcpp/message_info.hpp"
+#include "rclcpp/node_interfaces/node_topics_interface.hpp"
+#include "rclcpp/publisher.hpp"
+#include "rclcpp/publisher_options.hpp"
+#include "rclcpp/qos.hpp"
+#include "rclcpp/serialized_message.hpp"
+#include "rclcpp/subscription.hpp"
+#include "rclcpp/subscription_options.hpp"
+#include "rclcpp/typesupport_helpers.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+
+/// %Relay republishing serialized messages without deserializing them.
+/**
+ * A Relay is a GenericSubscription whose dispatch step publishes the taken
+ * serialized message through a GenericPublisher instead of invoking a user
+ * callback. The payload is never deserialized and never copied beyond the
+ * middleware's own take and publish, so bridging or renaming a topic costs
+ * one take and one publish per message regardless of message size or type.
+ *
+ * An optional filter decides per message whether to republish. It only sees
+ * the rclcpp::MessageInfo, i.e. the metadata the middleware attaches to every
+ * sample, so decimation policies (every Nth message, sender-based, timestamp
+ * windows) run without touching the payload.
+ *
+ * Like all generic entities this class does not support intra-process
+ * handling; messages from in-process publishers are still relayed through the
+ * middleware loopback. Use TypedRelay when the message type is known at
+ * compile time and intra-process handoff is desired.
+ *
+ * \sa rclcpp::create_relay() for creating an instance of this class.
+ */
+class Relay : public rclcpp::GenericSubscription
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS(Relay)
+
+  /// Filter invoked per message; return true to republish, false to drop.
+  using FilterCallbackT = std::function<bool (const rclcpp::MessageInfo &)>;
+
+  /// Constructor.
+  /**
+   * In order to start relaying, the relay needs to be added to the
+   * node_topic_interface of the node passed into this constructor.
+   *
+   * \sa rclcpp::create_relay() for creating an instance of this class and
+   * adding it to the node_topic_interface.
+   *
+   * \param node_base Pointer to parent node's NodeBaseInterface
+   * \param ts_lib Type support library, needs to correspond to topic_type
+   * \param input_topic Topic to subscribe to
+   * \param topic_type Topic type
+   * \param qos %QoS settings
+   * \param publisher Generic publisher the messages are republished through
+   * \param filter Optional decimation filter, may be nullptr
+   * \param options %Subscription options, see GenericSubscription
+   */
+  template<typename AllocatorT = std::allocator<void>>
+  Relay(
+    rclcpp::node_interfaces::NodeBaseInterface * node_base,
+    const std::shared_ptr<rcpputils::SharedLibrary> ts_lib,
+    const std::string & input_topic,
+    const std::string & topic_type,
+    const rclcpp::QoS & qos,
+    rclcpp::GenericPublisher::SharedPtr publisher,
+    FilterCallbackT filter,
+    const rclcpp::SubscriptionOptionsWithAllocator<AllocatorT> & options)
+  : GenericSubscription(
+      node_base,
+      ts_lib,
+      input_topic,
+      topic_type,
+      qos,
+      // Never invoked, handle_serialized_message() is overridden below.
+      std::function<void(std::shared_ptr<rclcpp::SerializedMessage>)>(
+        [](std::shared_ptr<rclcpp::SerializedMessage>) {}),
+      options),
+    publisher_(std::move(publisher)),
+    filter_(std::move(filter))
+  {}
+
+  RCLCPP_PUBLIC
+  virtual ~Relay() = default;
+
+  /// Republish the taken serialized message, applying the filter if any.
+  RCLCPP_PUBLIC
+  void
+  handle_serialized_message(
+    const std::shared_ptr<rclcpp::SerializedMessage> & serialized_message,
+    const rclcpp::MessageInfo & message_info) override;
+
+  /// Return the publisher messages are republished through.
+  RCLCPP_PUBLIC
+  rclcpp::GenericPublisher::SharedPtr
+  get_publisher() const;
+
+private:
+  RCLCPP_DISABLE_COPY(Relay)
+
+  rclcpp::GenericPublisher::SharedPtr publisher_;
+  FilterCallbackT filter_;
+};
+
+/// %Relay for a message type known at compile time, with intra-process handoff.
+/**
+ * Pairs a Subscription taking messages by std::unique_ptr with a Publisher of
+ * the same type. Each message is republished by moving the unique_ptr into
+ * Publisher::publish(), so when intra-process communication is enabled the
+ * payload is handed through the IntraProcessManager without being copied or
+ * serialized; in-process subscriptions of the output topic receive the very
+ * buffer the input publisher produced. Inter-process messages are
+ * deserialized once on take and serialized once on publish, as they would be
+ * in a hand-written subscribe-and-republish node.
+ *
+ * The optional filter matches Relay's: it runs on the rclcpp::MessageInfo
+ * before the message is republished.
+ *
+ * \sa rclcpp::create_typed_relay() for creating an instance of this class.
+ */
+template<typename MessageT, typename AllocatorT = std::allocator<void>>
+class TypedRelay
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS_NOT_COPYABLE(TypedRelay)
+
+  /// Filter invoked per message; return true to republish, false to drop.
+  using FilterCallbackT = std::function<bool (const rclcpp::MessageInfo &)>;
+
+  /// Constructor.
+  /**
+   * \param node Node the input subscription and output publisher are created on
+   * \param input_topic Topic to subscribe to
+   * \param output_topic Topic to republish on
+   * \param qos %QoS settings, applied to both sides
+   * \param filter Optional decimation filter, may be nullptr
+   * \param subscription_options Options for the input subscription
+   * \param publisher_options Options for the output publisher
+   */
+  template<typename NodeT>
+  TypedRelay(
+    NodeT && node,
+    const std::string & input_topic,
+    const std::string & output_topic,
+    const rclcpp::QoS & qos,
+    FilterCallbackT filter = nullptr,
+    const rclcpp::SubscriptionOptionsWithAllocator<AllocatorT> & subscription_options = (
+      rclcpp::SubscriptionOptionsWithAllocator<AllocatorT>()),
+    const rclcpp::PublisherOptionsWithAllocator<AllocatorT> & publisher_options = (
+      rclcpp::PublisherOptionsWithAllocator<AllocatorT>()))
+  : filter_(std::move(filter))
+  {
+    publisher_ = rclcpp::create_publisher<MessageT>(
+      node, output_topic, qos, publisher_options);
+    subscription_ = rclcpp::create_subscription<MessageT>(
+      node, input_topic, qos,
+      [this](std::unique_ptr<MessageT> message, const rclcpp::MessageInfo & message_info) {
+        if (filter_ && !filter_(message_info)) {
+          return;
+        }
+        // Preserve the entry time of the message across this hop, see
+        // PublisherBase::set_origin_timestamp().
+        publisher_->set_origin_timestamp(message_info.get_origin_timestamp());
+        publisher_->publish(std::move(message));
+      },
+      subscription_options);
+  }
+
+  /// Return the input subscription.
+  typename rclcpp::Subscription<MessageT, AllocatorT>::SharedPtr
+  get_subscription() const
+  {
+    return subscription_;
+  }
+
+  /// Return the output publisher.
+  typename rclcpp::Publisher<MessageT, AllocatorT>::SharedPtr
+  get_publisher() const
+  {
+    return publisher_;
+  }
+
+private:
+  RCLCPP_DISABLE_COPY(TypedRelay)
+
+  FilterCallbackT filter_;
+  typename rclcpp::Publisher<MessageT, AllocatorT>::SharedPtr publisher_;
+  typename rclcpp::Subscription<MessageT, AllocatorT>::SharedPtr subscription_;
+};
+
+/// Create and return a Relay.
+/**
+ * The returned pointer will never be empty, but this function can throw
+ * various exceptions, for instance when the message's package can not be
+ * found on the AMENT_PREFIX_PATH.
+ *
+ * \param topics_interface NodeTopicsInterface pointer used in parts of the setup
+ * \param input_topic Topic to subscribe to
+ * \param output_topic Topic to republish on
+ * \param topic_type Topic type
+ * \param qos %QoS settings, applied to both sides
+ * \param filter Optional decimation filter, may be nullptr
+ * \param subscription_options Options for the input side, see GenericSubscription
+ * \param publisher_options Options for the output side, see GenericPublisher
+ */
+template<typename AllocatorT = std::allocator<void>>
+std::shared_ptr<Relay> create_relay(
+  rclcpp::node_interfaces::NodeTopicsInterface::SharedPtr topics_interface,
+  const std::string & input_topic,
+  const std::string & output_topic,
+  const std::string & topic_type,
+  const rclcpp::QoS & qos,
+  Relay::FilterCallbackT filter = nullptr,
+  const rclcpp::SubscriptionOptionsWithAllocator<AllocatorT> & subscription_options = (
+    rclcpp::SubscriptionOptionsWithAllocator<AllocatorT>()),
+  const rclcpp::PublisherOptionsWithAllocator<AllocatorT> & publisher_options = (
+    rclcpp::PublisherOptionsWithAllocator<AllocatorT>()))
+{
+  auto publisher = rclcpp::create_generic_publisher(
+    topics_interface, output_topic, topic_type, qos, publisher_options);
+
+  auto ts_lib = rclcpp::get_cached_typesupport_library(
+    topic_type, "rosidl_typesupport_cpp");
+
+  auto relay = std::make_shared<Relay>(
+    topics_interface->get_node_base_interface(),
+    std::move(ts_lib),
+    input_topic,
+    topic_type,
+    qos,
+    std::move(publisher),
+    std::move(filter),
+    subscription_options);
+
+  topics_interface->add_subscription(relay, subscription_options.callback_group);
+
+  return relay;
+}
+
+/// Create and return a TypedRelay.
+/**
+ * \param node Node the input subscription and output publisher are created on
+ * \param input_topic Topic to subscribe to
+ * \param output_topic Topic to republish on
+ * \param qos %QoS settings, applied to both sides
+ * \param filter Optional decimation filter, may be nullptr
+ * \param subscription_options Options for the input subscription
+ * \param publisher_options Options for the output publisher
+ */
+template<typename MessageT, typename AllocatorT = std::allocator<void>, typename NodeT>
+typename TypedRelay<MessageT, AllocatorT>::SharedPtr create_typed_relay(
+  NodeT && node,
+  const std::string & input_topic,
+  const std::string & output_topic,
+  const rclcpp::QoS & qos,
+  typename TypedRelay<MessageT, AllocatorT>::FilterCallbackT filter = nullptr,
+  const rclcpp::SubscriptionOptionsWithAllocator<AllocatorT> & subscription_options = (
+    rclcpp::SubscriptionOptionsWithAllocator<AllocatorT>()),
+  const rclcpp::PublisherOptionsWithAllocator<AllocatorT> & publisher_options = (
+    rclcpp::PublisherOptionsWithAllocator<AllocatorT>()))
+{
+  return std::make_shared<TypedRelay<MessageT, AllocatorT>>(
+    std::forward<NodeT>(node),
+    input_topic,
+    output_topic,
+    qos,
+    std::move(filter),
+    subscription_options,
+    publisher_options);
+}
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__RELAY_HPP_
@@ -0,0 +1,176 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__SEALED_SUBSCRIPTION_HPP_
+#define RCLCPP__SEALED_SUBSCRIPTION_HPP_
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "rclcpp/any_subscription_callback.hpp"
+#include "rclcpp/message_info.hpp"
+#include "rclcpp/node_interfaces/node_base_interface.hpp"
+#include "rclcpp/qos.hpp"
+#include "rclcpp/serialized_message.hpp"
+#include "rclcpp/subscription.hpp"
+#include "rclcpp/subscription_options.hpp"
+
+namespace rclcpp
+{
+
+namespace detail
+{
+
+/// Check whether a callback type can be dispatched directly by SealedSubscription.
+template<typename CallbackT, typename ROSMessageType>
+struct is_sealable_callback
+  : std::bool_constant<
+    !std::is_same_v<ROSMessageType, rclcpp::SerializedMessage> &&
+    std::is_copy_constructible_v<CallbackT> &&
+    (std::is_invocable_v<
+      CallbackT &, std::shared_ptr<const ROSMessageType>, const rclcpp::MessageInfo &> ||
+    std::is_invocable_v<CallbackT &, std::shared_ptr<const ROSMessageType>> ||
+    std::is_invocable_v<CallbackT &, const ROSMessageType &, const rclcpp::MessageInfo &> ||
+    std::is_invocable_v<CallbackT &, const ROSMessageType &>)>
+{
+};
+
+}  // namespace detail
+
+/// Subscription whose inter-process dispatch is one direct call to the user callback.
+/**
+ * The generic Subscription delivers every inter-process message through
+ * AnySubscriptionCallback::dispatch(), i.e. a variant visit followed by a
+ * std::function invocation. This final class additionally stores the user
+ * callback with its concrete type and overrides handle_message() and
+ * handle_loaned_message() to call it directly, so the compiler can inline the
+ * whole take-and-dispatch chain behind the one unavoidable virtual call the
+ * executor makes through SubscriptionBase.
+ *
+ * The type-erased callback is still passed to the base class, keeping the
+ * intra-process and serialized delivery paths and callback tracing unchanged.
+ *
+ * Instances are created by create_subscription() when
+ * SubscriptionOptionsBase::use_sealed_dispatch is set and the callback type is
+ * sealable, see rclcpp::detail::is_sealable_callback.
+ */
+template<typename MessageT, typename CallbackT, typename AllocatorT = std::allocator<void>>
+class SealedSubscription final : public Subscription<MessageT, AllocatorT>
+{
+public:
+  using BaseType = Subscription<MessageT, AllocatorT>;
+  using ROSMessageType = typename BaseType::ROSMessageType;
+  using MessageMemoryStrategyType = typename BaseType::MessageMemoryStrategyType;
+
+  static_assert(
+    detail::is_sealable_callback<CallbackT, ROSMessageType>::value,
+    "callback type cannot be dispatched directly by SealedSubscription");
+
+  RCLCPP_SMART_PTR_DEFINITIONS(SealedSubscription)
+
+  /// Default constructor.
+  /**
+   * Takes the same arguments as Subscription, plus a copy of the user
+   * callback with its concrete type for direct dispatch.
+   * Like Subscription, this is almost never called directly; instead use
+   * rclcpp::create_subscription() with use_sealed_dispatch enabled.
+   */
+  SealedSubscription(
+    rclcpp::node_interfaces::NodeBaseInterface * node_base,
+    const rosidl_message_type_support_t & type_support_handle,
+    const std::string & topic_name,
+    const rclcpp::QoS & qos,
+    AnySubscriptionCallback<MessageT, AllocatorT> callback,
+    CallbackT direct_callback,
+    const rclcpp::SubscriptionOptionsWithAllocator<AllocatorT> & options,
+    typename MessageMemoryStrategyType::SharedPtr message_memory_strategy)
+  : BaseType(
+      node_base,
+      type_support_handle,
+      topic_name,
+      qos,
+      std::move(callback),
+      options,
+      message_memory_strategy),
+    direct_callback_(std::move(direct_callback))
+  {}
+
+  void
+  handle_message(
+    std::shared_ptr<void> & message,
+    const rclcpp::MessageInfo & message_info) final
+  {
+    if (this->matches_any_intra_process_publishers(
+        &message_info.get_rmw_message_info().publisher_gid))
+    {
+      // In this case, the message will be delivered via intra process and
+      // we should ignore this copy of the message.
+      return;
+    }
+    auto typed_message = std::static_pointer_cast<ROSMessageType>(message);
+    const auto callback_start = std::chrono::steady_clock::now();
+    this->dispatch_direct(std::move(typed_message), message_info);
+    this->count_callback_executed(callback_start);
+  }
+
+  void
+  handle_loaned_message(
+    void * loaned_message,
+    const rclcpp::MessageInfo & message_info) final
+  {
+    if (this->matches_any_intra_process_publishers(
+        &message_info.get_rmw_message_info().publisher_gid))
+    {
+      return;
+    }
+    auto typed_message = static_cast<ROSMessageType *>(loaned_message);
+    // message is loaned, so we have to make sure that the deleter does not deallocate the message
+    auto sptr = std::shared_ptr<ROSMessageType>(
+      typed_message, [](ROSMessageType * msg) {(void) msg;});
+    const auto callback_start = std::chrono::steady_clock::now();
+    this->dispatch_direct(std::move(sptr), message_info);
+    this->count_callback_executed(callback_start);
+  }
+
+private:
+  /// Call the user callback with whichever sealable form its type supports.
+  void
+  dispatch_direct(
+    std::shared_ptr<ROSMessageType> message,
+    const rclcpp::MessageInfo & message_info)
+  {
+    if constexpr (std::is_invocable_v<
+        CallbackT &, std::shared_ptr<const ROSMessageType>, const rclcpp::MessageInfo &>)
+    {
+      direct_callback_(std::move(message), message_info);
+    } else if constexpr (std::is_invocable_v<CallbackT &, std::shared_ptr<const ROSMessageType>>) {
+      direct_callback_(std::move(message));
+    } else if constexpr (std::is_invocable_v<
+        CallbackT &, const ROSMessageType &, const rclcpp::MessageInfo &>)
+    {
+      direct_callback_(*message, message_info);
+    } else {
+      direct_callback_(*message);
+    }
+  }
+
+  CallbackT direct_callback_;
+};
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__SEALED_SUBSCRIPTION_HPP_
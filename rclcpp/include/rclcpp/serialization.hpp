@@ -15,9 +15,14 @@
 #ifndef RCLCPP__SERIALIZATION_HPP_
 #define RCLCPP__SERIALIZATION_HPP_
 
+#include <atomic>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
+#include <utility>
 
 #include "rclcpp/visibility_control.hpp"
 
@@ -31,6 +36,7 @@ namespace rclcpp
 {
 
 class SerializedMessage;
+class SerializedMessagePool;
 
 namespace serialization_traits
 {
@@ -44,6 +50,93 @@ struct is_serialized_message_class<SerializedMessage>: std::true_type
 {};
 }  // namespace serialization_traits
 
+/// An alternative (de)serialization codec for a single message type.
+/**
+ * Backends let a specialized codec, e.g. one doing vectorized bulk encoding
+ * of primitive arrays, replace the generic rmw typesupport path for the
+ * message types it understands.
+ * Either function may return false to decline a particular message at
+ * runtime, in which case the caller falls back to the rmw path.
+ */
+struct SerializationBackend
+{
+  /// Serialize a ROS message into the given (already initialized) buffer.
+  std::function<bool (const void * ros_message, rcl_serialized_message_t *)> serialize;
+  /// Deserialize the given buffer into a ROS message.
+  std::function<bool (const rcl_serialized_message_t *, void * ros_message)> deserialize;
+};
+
+/// Process-wide registry of serialization backends, keyed by type support handle.
+/**
+ * SerializationBase consults this registry on every (de)serialization and
+ * prefers a registered backend over the generic rmw typesupport functions.
+ * Type support handles are per-type singletons, so a backend registered for
+ * `rosidl_typesupport_cpp::get_message_type_support_handle<MessageT>()` is
+ * found by every `Serialization<MessageT>` in the process.
+ * The lookup is a single relaxed atomic load while the registry is empty,
+ * so processes that never register a backend do not pay for the indirection.
+ */
+class SerializationBackendRegistry
+{
+public:
+  /// Return the process-wide registry.
+  RCLCPP_PUBLIC
+  static SerializationBackendRegistry &
+  instance();
+
+  /// Register (or replace) the backend for a message type.
+  /**
+   * \param[in] type_support the per-type type support handle the backend applies to.
+   * \param[in] backend the codec; both functions must be callable.
+   * \throws std::invalid_argument if either backend function is empty.
+   */
+  RCLCPP_PUBLIC
+  void
+  register_backend(
+    const rosidl_message_type_support_t * type_support,
+    SerializationBackend backend);
+
+  /// Remove the backend for a message type, if any.
+  RCLCPP_PUBLIC
+  void
+  unregister_backend(const rosidl_message_type_support_t * type_support);
+
+  /// Return the backend registered for a message type, or nullptr.
+  RCLCPP_PUBLIC
+  std::shared_ptr<const SerializationBackend>
+  get_backend(const rosidl_message_type_support_t * type_support) const;
+
+private:
+  mutable std::mutex mutex_;
+  std::unordered_map<
+    const rosidl_message_type_support_t *,
+    std::shared_ptr<const SerializationBackend>> backends_;
+  // Fast path flag: stays false until the first registration ever, letting
+  // get_backend() skip the lock in processes without backends.
+  std::atomic<bool> ever_registered_ {false};
+};
+
+/// Register a serialization backend for MessageT.
+/** \sa SerializationBackendRegistry */
+template<typename MessageT>
+void
+register_serialization_backend(SerializationBackend backend)
+{
+  SerializationBackendRegistry::instance().register_backend(
+    rosidl_typesupport_cpp::get_message_type_support_handle<MessageT>(),
+    std::move(backend));
+}
+
+/// Remove the serialization backend for MessageT, if any.
+/** \sa SerializationBackendRegistry */
+template<typename MessageT>
+void
+unregister_serialization_backend()
+{
+  SerializationBackendRegistry::instance().unregister_backend(
+    rosidl_typesupport_cpp::get_message_type_support_handle<MessageT>());
+}
+
 /// Interface to (de)serialize a message
 class RCLCPP_PUBLIC_TYPE SerializationBase
 {
@@ -66,6 +159,19 @@ public:
   void serialize_message(
     const void * ros_message, SerializedMessage * serialized_message) const;
 
+  /// Serialize a ROS2 message into a buffer drawn from a pool
+  /**
+   * Same as the other overload, but the destination is acquired from the
+   * given pool and returned to it when the result is released, avoiding a
+   * buffer allocation per serialized message in the steady state.
+   *
+   * \param[in] ros_message The ROS2 message which is read and serialized by rmw.
+   * \param[in] pool The pool to draw the destination buffer from.
+   * \return The serialized message, backed by a pooled buffer.
+   */
+  std::shared_ptr<SerializedMessage> serialize_message(
+    const void * ros_message, SerializedMessagePool & pool) const;
+
   /// Deserialize a serialized stream to a ROS message
   /**
    * \param[in] serialized_message The serialized message to be converted to ROS2 by rmw.
@@ -15,18 +15,45 @@
 #ifndef RCLCPP__SERIALIZED_MESSAGE_HPP_
 #define RCLCPP__SERIALIZED_MESSAGE_HPP_
 
+#include <cstddef>
+#include <cstdint>
+
 #include "rcl/allocator.h"
 #include "rcl/types.h"
 
 #include "rclcpp/visibility_control.hpp"
 
+/// Number of bytes a SerializedMessage stores inline, without touching the heap.
+/**
+ * May be overridden at compile time, but must be configured consistently across
+ * every translation unit of a build, as it changes the size of SerializedMessage.
+ */
+#ifndef RCLCPP_SERIALIZED_MESSAGE_INLINE_CAPACITY
+#define RCLCPP_SERIALIZED_MESSAGE_INLINE_CAPACITY 512u
+#endif
+
 namespace rclcpp
 {
 
 /// Object oriented version of rcl_serialized_message_t with destructor to avoid memory leaks
+/**
+ * Buffers no larger than kInlineBufferCapacity live inside the object itself;
+ * only messages that outgrow the inline storage fall back to the allocator
+ * passed at construction.
+ * The underlying rcl_serialized_message_t carries an allocator that knows about
+ * the inline storage, so resizing and finalizing it through the usual
+ * rmw_serialized_message_* functions stays valid.
+ * As a consequence, while the inline storage is in use, the handle returned by
+ * get_rcl_serialized_message() is tied to the lifetime and address of this
+ * object; use release_rcl_serialized_message() to obtain a self-contained
+ * handle.
+ */
 class RCLCPP_PUBLIC_TYPE SerializedMessage
 {
 public:
+  /// Capacity of the inline buffer, see RCLCPP_SERIALIZED_MESSAGE_INLINE_CAPACITY.
+  static constexpr size_t kInlineBufferCapacity = RCLCPP_SERIALIZED_MESSAGE_INLINE_CAPACITY;
+
   /// Default constructor for a SerializedMessage
   /**
    * Default constructs a serialized message and initalizes it
@@ -109,11 +136,40 @@ public:
   /**
    * The memory (i.e. the data buffer) of the serialized message will no longer
    * be managed by this instance and the memory won't be deallocated on destruction.
+   * If the data still resides in the inline buffer, it is copied out to a fresh
+   * allocation first, so the returned handle never refers back to this object.
    */
   rcl_serialized_message_t release_rcl_serialized_message();
 
 private:
+  /// State block referenced by the inline-aware allocator.
+  struct InlineStorage
+  {
+    rcl_allocator_t base_allocator;
+    uint8_t buffer[kInlineBufferCapacity];
+  };
+
+  // Allocator callbacks which keep the inline buffer out of heap management.
+  static void * inline_buffer_allocate(size_t size, void * state);
+  static void inline_buffer_deallocate(void * pointer, void * state);
+  static void * inline_buffer_reallocate(void * pointer, size_t size, void * state);
+  static void * inline_buffer_zero_allocate(
+    size_t number_of_elements, size_t size_of_element, void * state);
+
+  /// Get the user-facing allocator behind a message, unwrapping the inline-aware one.
+  static const rcl_allocator_t & base_allocator_of(const rcl_serialized_message_t & message);
+
+  rcl_allocator_t make_inline_allocator();
+  bool buffer_is_inline() const;
+  /// Set up an empty buffer of the given capacity, inline when it fits.
+  void init_storage(size_t capacity, const rcl_allocator_t & base_allocator);
+  /// Initialize this message as a copy of the given one.
+  void init_from(const rcl_serialized_message_t & other);
+  /// Re-home inline data and allocator state after taking over a moved-from peer.
+  void adopt_inline_storage(const InlineStorage & source);
+
   rcl_serialized_message_t serialized_message_;
+  InlineStorage inline_storage_;
 };
 
 }  // namespace rclcpp
@@ -0,0 +1,84 @@
+// Copyright 2024 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__SERIALIZED_MESSAGE_CODEC_HPP_
+#define RCLCPP__SERIALIZED_MESSAGE_CODEC_HPP_
+
+#include "rclcpp/macros.hpp"
+#include "rclcpp/serialized_message.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+
+/// Pluggable codec transforming serialized payloads between take and publish.
+/**
+ * A codec is a pair of inverse transforms over serialized message payloads,
+ * typically a compressor, applied transparently inside the existing generic
+ * entities: a GenericPublisher encodes each payload just before handing it to
+ * the middleware, and a GenericSubscription decodes each payload right after
+ * taking it, so topics crossing a constrained link can be compressed without
+ * dedicated relay nodes and the extra hops and copies they bring.
+ *
+ * Any framing the decoder needs, such as a magic number or the uncompressed
+ * size, is the codec's own responsibility and must be part of the encoded
+ * payload; rclcpp does not add a header of its own.
+ *
+ * Both transforms write into a caller-provided output message, which the
+ * entities reuse across messages, so in the steady state a codec which only
+ * calls SerializedMessage::reserve() on its output performs no allocations.
+ *
+ * Implementations must be safe to call from the thread the owning entity
+ * publishes or takes on; the entities serialize calls into one codec
+ * instance, but one instance shared between entities sees concurrent calls.
+ *
+ * \sa GenericPublisher::set_codec() and GenericSubscription::set_codec()
+ */
+class SerializedMessageCodec
+{
+public:
+  RCLCPP_SMART_PTR_ALIASES_ONLY(SerializedMessageCodec)
+
+  RCLCPP_PUBLIC
+  virtual
+  ~SerializedMessageCodec() = default;
+
+  /// Encode a payload, e.g. compress it, writing the result to output.
+  /**
+   * \param[in] input The payload to encode, left untouched.
+   * \param[out] output Overwritten with the encoded payload; its buffer is
+   *   reused between calls and should be grown with reserve() as needed.
+   */
+  RCLCPP_PUBLIC
+  virtual
+  void
+  encode(const rclcpp::SerializedMessage & input, rclcpp::SerializedMessage & output) = 0;
+
+  /// Decode a payload previously produced by encode() of the same codec.
+  /**
+   * \param[in] input The encoded payload, left untouched.
+   * \param[out] output Overwritten with the decoded payload; its buffer is
+   *   reused between calls and should be grown with reserve() as needed.
+   * \throws std::runtime_error or a codec-specific exception if the payload
+   *   is not valid for this codec.
+   */
+  RCLCPP_PUBLIC
+  virtual
+  void
+  decode(const rclcpp::SerializedMessage & input, rclcpp::SerializedMessage & output) = 0;
+};
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__SERIALIZED_MESSAGE_CODEC_HPP_
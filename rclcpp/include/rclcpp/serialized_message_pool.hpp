@@ -0,0 +1,130 @@
+// Copyright 2024 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__SERIALIZED_MESSAGE_POOL_HPP_
+#define RCLCPP__SERIALIZED_MESSAGE_POOL_HPP_
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "rclcpp/macros.hpp"
+#include "rclcpp/serialized_message.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+
+/// Size-class pool of SerializedMessage buffers.
+/**
+ * Serializing at high rates with fresh `SerializedMessage` instances spends
+ * most of its time in the allocator: every message init-allocates its buffer
+ * and every destruction frees it. This pool keeps released buffers around in
+ * power-of-two size classes, so a steady-state producer (e.g. a bridge
+ * serializing tens of thousands of messages per second) reuses a handful of
+ * buffers instead of hitting malloc per message.
+ *
+ * Messages are handed out as `std::shared_ptr<SerializedMessage>` whose
+ * deleter returns the buffer to the pool, keyed by the capacity the buffer
+ * has grown to. Each size class retains at most `high_watermark` buffers;
+ * buffers released beyond that (or after the pool is destroyed) are freed
+ * normally. Use `reserve()` at startup to pre-size the pool and keep
+ * allocations out of the steady state entirely.
+ *
+ * All member functions are thread-safe.
+ *
+ * \sa SerializationBase::serialize_message() for drawing from a pool while
+ *   serializing.
+ */
+class RCLCPP_PUBLIC_TYPE SerializedMessagePool
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS_NOT_COPYABLE(SerializedMessagePool)
+
+  /// Default cap on the number of buffers retained per size class.
+  static constexpr size_t kDefaultHighWatermark = 64;
+
+  /// Constructor.
+  /**
+   * \param[in] high_watermark Maximum number of buffers retained per size
+   *   class; releases beyond it free the buffer instead of pooling it.
+   */
+  RCLCPP_PUBLIC
+  explicit SerializedMessagePool(size_t high_watermark = kDefaultHighWatermark);
+
+  RCLCPP_PUBLIC
+  virtual ~SerializedMessagePool() = default;
+
+  /// Acquire a serialized message, reusing a pooled buffer when possible.
+  /**
+   * The message's size is reset to zero, but its capacity is at least
+   * `capacity_hint` so a serializer writing up to that many bytes will not
+   * need to grow the buffer. When the returned pointer is released the buffer
+   * goes back to the pool, even if the pool handed it out before being
+   * destroyed (in which case it is simply freed).
+   *
+   * \param[in] capacity_hint Expected serialized size in bytes, may be zero.
+   * \return Serialized message whose deleter returns the buffer to the pool.
+   */
+  RCLCPP_PUBLIC
+  std::shared_ptr<SerializedMessage> acquire(size_t capacity_hint = 0);
+
+  /// Pre-populate the pool, e.g. at process startup.
+  /**
+   * Adds buffers until the size class covering `capacity` holds at least
+   * `count` buffers, without exceeding the high watermark.
+   *
+   * \param[in] count Number of buffers the size class should hold.
+   * \param[in] capacity Capacity of each pre-allocated buffer, in bytes.
+   */
+  RCLCPP_PUBLIC
+  void reserve(size_t count, size_t capacity);
+
+  /// Return the total number of buffers currently held by the pool.
+  RCLCPP_PUBLIC
+  size_t available() const;
+
+  /// Get the cap on the number of buffers retained per size class.
+  RCLCPP_PUBLIC
+  size_t get_high_watermark() const;
+
+private:
+  RCLCPP_DISABLE_COPY(SerializedMessagePool)
+
+  // Power-of-two size classes: kMinClassCapacity << 0 .. << (kNumClasses - 1).
+  static constexpr size_t kMinClassCapacity = 256;
+  static constexpr size_t kNumClasses = 15;  // up to 4 MiB
+
+  /// Index of the smallest size class whose capacity is >= the given one.
+  static size_t size_class_index(size_t capacity);
+
+  /// Capacity of the given size class, in bytes.
+  static size_t size_class_capacity(size_t class_index);
+
+  // Shared with the deleters of outstanding messages, so buffers released
+  // after the pool is destroyed are freed instead of dereferencing the pool.
+  struct State
+  {
+    mutable std::mutex mutex;
+    std::array<std::vector<std::unique_ptr<SerializedMessage>>, kNumClasses> classes;
+    size_t high_watermark;
+  };
+
+  std::shared_ptr<State> state_;
+};
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__SERIALIZED_MESSAGE_POOL_HPP_
@@ -0,0 +1,101 @@
+// Copyright 2024 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__SERIALIZED_MESSAGE_VIEW_HPP_
+#define RCLCPP__SERIALIZED_MESSAGE_VIEW_HPP_
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include "rcl/types.h"
+
+#include "rclcpp/macros.hpp"
+#include "rclcpp/serialized_message.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+
+/// Borrowed, read-only view of a serialized message taken by a subscription.
+/**
+ * Unlike an owning `SerializedMessage`, a view does not own the CDR buffer it
+ * points at: the buffer stays borrowed from the take path of the subscription
+ * which produced the view, and is handed back for reuse when the view is
+ * destroyed. High-throughput consumers such as rosbag-style recorders can
+ * therefore hold on to the payload until it has been written out, without the
+ * payload ever being copied into an additional process-heap allocation.
+ *
+ * Views are move-only, so exactly one instance is responsible for returning
+ * the buffer. A consumer that needs the data beyond the lifetime of the view
+ * has to copy it out, e.g. with `to_serialized_message()`.
+ *
+ * \sa GenericSubscription for the subscription side handing out views.
+ */
+class RCLCPP_PUBLIC_TYPE SerializedMessageView
+{
+public:
+  /// Callback returning the borrowed buffer to its owner for reuse.
+  using ReturnCallbackT = std::function<void (std::shared_ptr<rclcpp::SerializedMessage>)>;
+
+  /// Construct a view over a taken serialized message.
+  /**
+   * \param[in] message The serialized message holding the borrowed buffer.
+   * \param[in] return_callback Called with the message when the view is
+   *   destroyed, handing the buffer back to its owner. If nullptr, the buffer
+   *   is simply released when the view is destroyed.
+   */
+  RCLCPP_PUBLIC
+  SerializedMessageView(
+    std::shared_ptr<rclcpp::SerializedMessage> message,
+    ReturnCallbackT return_callback);
+
+  /// Move constructor, transfers responsibility for returning the buffer.
+  RCLCPP_PUBLIC
+  SerializedMessageView(SerializedMessageView && other) noexcept;
+
+  /// Move assignment operator, returns the currently viewed buffer first.
+  RCLCPP_PUBLIC
+  SerializedMessageView & operator=(SerializedMessageView && other) noexcept;
+
+  /// Destructor, returns the borrowed buffer to its owner.
+  RCLCPP_PUBLIC
+  ~SerializedMessageView();
+
+  /// Get a const handle to the underlying rcl_serialized_message_t.
+  RCLCPP_PUBLIC
+  const rcl_serialized_message_t & get_rcl_serialized_message() const;
+
+  /// Get a pointer to the serialized data buffer.
+  RCLCPP_PUBLIC
+  const uint8_t * data() const;
+
+  /// Get the size of the serialized data buffer.
+  RCLCPP_PUBLIC
+  size_t size() const;
+
+  /// Copy the borrowed buffer into an owning SerializedMessage.
+  RCLCPP_PUBLIC
+  rclcpp::SerializedMessage to_serialized_message() const;
+
+private:
+  RCLCPP_DISABLE_COPY(SerializedMessageView)
+
+  std::shared_ptr<rclcpp::SerializedMessage> message_;
+  ReturnCallbackT return_callback_;
+};
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__SERIALIZED_MESSAGE_VIEW_HPP_
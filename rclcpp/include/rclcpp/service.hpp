@@ -16,6 +16,7 @@
 #define RCLCPP__SERVICE_HPP_
 
 #include <atomic>
+#include <chrono>
 #include <functional>
 #include <iostream>
 #include <memory>
@@ -39,15 +40,28 @@
 #include "rclcpp/detail/cpp_callback_trampoline.hpp"
 #include "rclcpp/exceptions.hpp"
 #include "rclcpp/expand_topic_or_service_name.hpp"
+#include "rclcpp/experimental/service_intra_process.hpp"
+#include "rclcpp/introspection.hpp"
+#include "rclcpp/loaned_message_pool.hpp"
 #include "rclcpp/logging.hpp"
 #include "rclcpp/macros.hpp"
 #include "rclcpp/qos.hpp"
 #include "rclcpp/type_support_decl.hpp"
 #include "rclcpp/visibility_control.hpp"
+#include "rclcpp/waitable.hpp"
 
 namespace rclcpp
 {
 
+namespace experimental
+{
+/**
+ * IntraProcessManager is forward declared here, avoiding a circular inclusion between
+ * `intra_process_manager.hpp` and `service.hpp`.
+ */
+class IntraProcessManager;
+}  // namespace experimental
+
 class ServiceBase
 {
 public:
@@ -57,7 +71,34 @@ public:
   explicit ServiceBase(std::shared_ptr<rcl_node_t> node_handle);
 
   RCLCPP_PUBLIC
-  virtual ~ServiceBase() = default;
+  virtual ~ServiceBase();
+
+  using IntraProcessManagerWeakPtr =
+    std::weak_ptr<rclcpp::experimental::IntraProcessManager>;
+
+  /// Implementation detail.
+  /**
+   * Stores the id this service was registered with in the intra process
+   * manager, so the service can unregister itself on destruction.
+   */
+  RCLCPP_PUBLIC
+  void
+  setup_intra_process(
+    uint64_t intra_process_service_id,
+    IntraProcessManagerWeakPtr weak_ipm);
+
+  /// Return the waitable that executes intra-process requests, if any.
+  /**
+   * The waitable is added to the service's callback group, so that requests
+   * buffered by intra-process clients are dispatched by the same executor,
+   * under the same concurrency rules, as middleware-delivered ones.
+   *
+   * \return the waitable, or nullptr when intra-process is not set up.
+   */
+  RCLCPP_PUBLIC
+  virtual
+  rclcpp::Waitable::SharedPtr
+  get_intra_process_waitable();
 
   /// Return the name of the service.
   /** \return The name of the service. */
@@ -130,6 +171,27 @@ public:
   bool
   exchange_in_use_by_wait_set_state(bool in_use_state);
 
+  /// Enable or disable draining all pending requests in one activation.
+  /**
+   * When enabled, the executor keeps taking and dispatching requests until
+   * the middleware has none left each time this service becomes ready,
+   * instead of taking a single request per wait-set round trip. This makes
+   * a burst of requests cost one activation rather than one per request,
+   * at the price of delaying other entities of the same node while the
+   * burst is drained.
+   *
+   * \param[in] drain true to drain all pending requests per activation.
+   */
+  RCLCPP_PUBLIC
+  void
+  set_drain_requests_on_execute(bool drain);
+
+  /// Return whether all pending requests are drained in one activation.
+  /** \sa set_drain_requests_on_execute() */
+  RCLCPP_PUBLIC
+  bool
+  drain_requests_on_execute() const;
+
   /// Get the actual response publisher QoS settings, after the defaults have been determined.
   /**
    * The actual configuration applied when using RMW_QOS_POLICY_*_SYSTEM_DEFAULT
@@ -162,6 +224,12 @@ public:
   rclcpp::QoS
   get_request_subscription_actual_qos() const;
 
+  /// Get the introspection counter block for this service.
+  /** \return The counter block, see rclcpp::introspection::EntityCounters. */
+  RCLCPP_PUBLIC
+  std::shared_ptr<rclcpp::introspection::EntityCounters>
+  get_introspection_counters() const;
+
   /// Set a callback to be called when each new request is received.
   /**
    * The callback receives a size_t which is the number of requests received
@@ -248,6 +316,14 @@ public:
     }
   }
 
+  /// Set the opaque callback group membership handle, see rclcpp::CallbackGroup.
+  /**
+   * \param[in] membership the handle, nullptr to unlink from the group.
+   */
+  RCLCPP_PUBLIC
+  void
+  set_callback_group_membership(std::shared_ptr<void> membership);
+
 protected:
   RCLCPP_DISABLE_COPY(ServiceBase)
 
@@ -263,6 +339,16 @@ protected:
   void
   set_on_new_request_callback(rcl_event_callback_t callback, const void * user_data);
 
+  /// Register the introspection counter block, once service_handle_ is set.
+  RCLCPP_PUBLIC
+  void
+  register_introspection_counters();
+
+  /// Count one handled request and the duration of the user callback.
+  RCLCPP_PUBLIC
+  void
+  count_request_handled(std::chrono::steady_clock::time_point callback_start);
+
   std::shared_ptr<rcl_node_t> node_handle_;
 
   std::recursive_mutex callback_mutex_;
@@ -278,8 +364,22 @@ protected:
   rclcpp::Logger node_logger_;
 
   std::atomic<bool> in_use_by_wait_set_{false};
+
+  std::atomic<bool> drain_requests_on_execute_{false};
+
+  bool use_intra_process_{false};
+  IntraProcessManagerWeakPtr weak_ipm_;
+  uint64_t intra_process_service_id_{0};
+
+  std::shared_ptr<rclcpp::introspection::EntityCounters> introspection_counters_;
+
+  // Unlinks this service from its callback group on destruction.
+  std::shared_ptr<void> callback_group_membership_;
 };
 
+template<typename ServiceT>
+class ServiceResponseSender;
+
 template<typename ServiceT>
 class Service
   : public ServiceBase,
@@ -352,6 +452,7 @@ public:
 
       rclcpp::exceptions::throw_from_rcl_error(ret, "could not create service");
     }
+    register_introspection_counters();
     TRACETOOLS_TRACEPOINT(
       rclcpp_service_callback_added,
       static_cast<const void *>(get_service_handle().get()),
@@ -387,6 +488,7 @@ public:
     }
 
     service_handle_ = service_handle;
+    register_introspection_counters();
     TRACETOOLS_TRACEPOINT(
       rclcpp_service_callback_added,
       static_cast<const void *>(get_service_handle().get()),
@@ -424,6 +526,7 @@ public:
     // In this case, rcl owns the service handle memory
     service_handle_ = std::shared_ptr<rcl_service_t>(new rcl_service_t);
     service_handle_->impl = service_handle->impl;
+    register_introspection_counters();
     TRACETOOLS_TRACEPOINT(
       rclcpp_service_callback_added,
       static_cast<const void *>(get_service_handle().get()),
@@ -457,10 +560,31 @@ public:
     return this->take_type_erased_request(&request_out, request_id_out);
   }
 
+  /// Create a shared pointer with the request type
+  /**
+   * The instance comes from a per-service recycling pool and returns to it
+   * when the last reference drops, typically at the end of the user callback,
+   * so the steady-state take path does not allocate a fresh request per RPC.
+   *
+   * \return shared pointer with the request type
+   */
   std::shared_ptr<void>
   create_request() override
   {
-    return std::make_shared<typename ServiceT::Request>();
+    using RequestT = typename ServiceT::Request;
+    auto pool = request_pool_;
+    RequestT * request = pool->acquire();
+    return std::shared_ptr<void>(
+      request,
+      [pool](void * ptr) {
+        auto * typed = static_cast<RequestT *>(ptr);
+        if (!pool->release(typed)) {
+          // The pool already holds its depth in idle instances.
+          typed->~RequestT();
+          auto allocator = pool->get_message_allocator();
+          allocator.deallocate(typed, 1);
+        }
+      });
   }
 
   std::shared_ptr<rmw_request_id_t>
@@ -475,7 +599,9 @@ public:
     std::shared_ptr<void> request) override
   {
     auto typed_request = std::static_pointer_cast<typename ServiceT::Request>(request);
+    const auto callback_start = std::chrono::steady_clock::now();
     auto response = any_callback_.dispatch(this->shared_from_this(), request_header, typed_request);
+    this->count_request_handled(callback_start);
     if (response) {
       send_response(*request_header, *response);
     }
@@ -484,6 +610,17 @@ public:
   void
   send_response(rmw_request_id_t & req_id, typename ServiceT::Response & response)
   {
+    // Negative sequence numbers identify intra-process requests, which rmw
+    // never assigns; their responses, deferred or not, are delivered to the
+    // client's completion directly instead of through the middleware.
+    if (req_id.sequence_number < 0 && intra_process_waitable_) {
+      if (intra_process_waitable_->complete_request(
+          req_id.sequence_number,
+          std::make_shared<typename ServiceT::Response>(response)))
+      {
+        return;
+      }
+    }
     rcl_ret_t ret = rcl_send_response(get_service_handle().get(), &req_id, &response);
 
     if (ret != RCL_RET_OK) {
@@ -491,6 +628,114 @@ public:
     }
   }
 
+  /// Create the waitable that buffers and executes intra-process requests.
+  /**
+   * Must be called before the service is registered with the
+   * IntraProcessManager, so a client can never match this service while the
+   * waitable is still missing; the manager's lock then also publishes the
+   * pointer to client threads.
+   *
+   * \param[in] context context the service's node was created with.
+   */
+  void
+  create_intra_process_waitable(rclcpp::Context::SharedPtr context)
+  {
+    std::weak_ptr<Service<ServiceT>> weak_this = this->shared_from_this();
+    intra_process_waitable_ =
+      std::make_shared<rclcpp::experimental::ServiceIntraProcess<ServiceT>>(
+      std::move(context),
+      [weak_this](
+        std::shared_ptr<rmw_request_id_t> request_header,
+        std::shared_ptr<typename ServiceT::Request> request)
+      -> std::shared_ptr<typename ServiceT::Response>
+      {
+        auto service = weak_this.lock();
+        if (!service) {
+          return nullptr;
+        }
+        return service->handle_intra_process_request(
+          std::move(request_header), std::move(request));
+      });
+  }
+
+  rclcpp::Waitable::SharedPtr
+  get_intra_process_waitable() override
+  {
+    return intra_process_waitable_;
+  }
+
+  /// Queue a request from a matched intra-process client.
+  /**
+   * The request is executed by this service's executor, in its callback
+   * group, the next time the intra-process waitable is dispatched.
+   *
+   * \param[in] request the request to execute.
+   * \param[in] on_response invoked with the response when it is ready.
+   * \return true if the request was queued, false when this service has no
+   *   intra-process waitable and the client must use the middleware.
+   */
+  bool
+  queue_intra_process_request(
+    std::shared_ptr<typename ServiceT::Request> request,
+    std::function<void (std::shared_ptr<typename ServiceT::Response>)> on_response)
+  {
+    auto waitable = intra_process_waitable_;
+    if (!waitable) {
+      return false;
+    }
+    waitable->queue_request(std::move(request), std::move(on_response));
+    return true;
+  }
+
+  /// Execute one buffered intra-process request.
+  /**
+   * Called by this service's ServiceIntraProcess waitable when the executor
+   * dispatches it, so the user callback runs inside the service's callback
+   * group exactly like a middleware-delivered request would.
+   *
+   * \param[in] request_header header carrying the intra-process sequence
+   *   number; there is no backing rmw request.
+   * \param[in] request the request to dispatch.
+   * \return the response, or nullptr when the callback deferred it; a
+   *   deferred response is routed back through send_response().
+   */
+  std::shared_ptr<typename ServiceT::Response>
+  handle_intra_process_request(
+    std::shared_ptr<rmw_request_id_t> request_header,
+    std::shared_ptr<typename ServiceT::Request> request)
+  {
+    const auto callback_start = std::chrono::steady_clock::now();
+    auto response = any_callback_.dispatch(
+      this->shared_from_this(), std::move(request_header), std::move(request));
+    this->count_request_handled(callback_start);
+    return response;
+  }
+
+  /// Return the type support handle this service was created with.
+  const rosidl_service_type_support_t *
+  get_service_type_support_handle() const
+  {
+    return srv_type_support_handle_;
+  }
+
+  /// Create a handle for completing this request's response later.
+  /**
+   * Meant to be used from a deferred-response callback (one taking the
+   * service and request header but no response): the sender can be moved to
+   * another thread and completed whenever the response is ready, in any
+   * order relative to other requests. It keeps the service alive until the
+   * response is sent or the sender is dropped.
+   *
+   * \param[in] request_header header of the request to respond to.
+   * \return the response sender.
+   */
+  ServiceResponseSender<ServiceT>
+  create_response_sender(std::shared_ptr<rmw_request_id_t> request_header)
+  {
+    return ServiceResponseSender<ServiceT>(
+      this->shared_from_this(), std::move(request_header));
+  }
+
   /// Configure client introspection.
   /**
    * \param[in] clock clock to use to generate introspection timestamps
@@ -524,6 +769,62 @@ private:
   AnyServiceCallback<ServiceT> any_callback_;
 
   const rosidl_service_type_support_t * srv_type_support_handle_;
+
+  /// Recycling pool backing create_request(); bounded to its default depth.
+  typename LoanedMessagePool<typename ServiceT::Request>::SharedPtr request_pool_ =
+    std::make_shared<LoanedMessagePool<typename ServiceT::Request>>();
+
+  // Buffers requests from intra-process clients; created once in
+  // create_intra_process_waitable() and owned for the service's lifetime.
+  typename rclcpp::experimental::ServiceIntraProcess<ServiceT>::SharedPtr intra_process_waitable_;
+};
+
+/// Handle for completing a deferred service response out of order.
+/**
+ * Obtained from Service::create_response_sender(). Each sender completes
+ * exactly one request; senders for different requests may be completed in
+ * any order, from any thread.
+ */
+template<typename ServiceT>
+class ServiceResponseSender
+{
+public:
+  /// Send the response for the request this sender was created for.
+  /**
+   * \param[in] response the response to send.
+   * \throws std::runtime_error if the response was already sent.
+   * \throws rclcpp::exceptions::RCLError based exceptions if the underlying
+   *   rcl calls fail.
+   */
+  void
+  send_response(typename ServiceT::Response & response)
+  {
+    if (!service_) {
+      throw std::runtime_error("response was already sent for this request");
+    }
+    service_->send_response(*request_header_, response);
+    service_.reset();
+    request_header_.reset();
+  }
+
+  /// Return true as long as the response was not sent yet.
+  bool
+  is_pending() const
+  {
+    return nullptr != service_;
+  }
+
+private:
+  friend class Service<ServiceT>;
+
+  ServiceResponseSender(
+    typename Service<ServiceT>::SharedPtr service,
+    std::shared_ptr<rmw_request_id_t> request_header)
+  : service_(std::move(service)), request_header_(std::move(request_header))
+  {}
+
+  typename Service<ServiceT>::SharedPtr service_;
+  std::shared_ptr<rmw_request_id_t> request_header_;
 };
 
 }  // namespace rclcpp
@@ -0,0 +1,247 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__SHARDING_HPP_
+#define RCLCPP__SHARDING_HPP_
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "rclcpp/create_subscription.hpp"
+#include "rclcpp/macros.hpp"
+#include "rclcpp/qos.hpp"
+#include "rclcpp/subscription.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+
+/// Options for ShardedSubscription.
+/**
+ * \tparam MessageT The subscribed message type.
+ */
+template<typename MessageT>
+struct ShardingOptions
+{
+  /// Number of worker threads processing messages in parallel.
+  size_t shards = 2;
+
+  /// Selects the worker for a message; round-robin when nullptr.
+  /**
+   * The return value is taken modulo the shard count. Messages mapped to
+   * the same shard are processed serially in arrival order, so a key-based
+   * selector preserves per-key ordering across the pool.
+   */
+  std::function<size_t (const MessageT &)> shard_selector = nullptr;
+
+  /// When set, completions are handed off in publish order.
+  /**
+   * Invoked once per message after the worker callback returned, in the
+   * order the messages arrived, regardless of which worker finished first.
+   * Calls are serialized; a slow on_complete delays the hand-off of every
+   * later message.
+   */
+  std::function<void (const std::shared_ptr<const MessageT> &)> on_complete = nullptr;
+};
+
+/// Subscription fanning one topic out to a pool of worker threads.
+/**
+ * A subscription dispatches serially, so one high-rate topic is limited to
+ * a single core no matter the executor. ShardedSubscription keeps a single
+ * underlying subscription whose callback only assigns each message a shard
+ * (round-robin, or by the configured selector) and enqueues it; N worker
+ * threads run the user callback in parallel, scaling one topic's processing
+ * across cores without splitting it over multiple nodes.
+ *
+ * The user callback runs concurrently on different workers and must be
+ * safe for that; messages within one shard are processed serially in
+ * arrival order. With the optional on_complete hand-off, results can be
+ * consumed in publish order while the processing itself stays parallel.
+ *
+ * Queues are unbounded: if the callback cannot keep up with the topic on
+ * average, memory grows. Messages still queued at destruction are dropped.
+ *
+ * \tparam MessageT The subscribed message type.
+ */
+template<typename MessageT>
+class ShardedSubscription
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS_NOT_COPYABLE(ShardedSubscription)
+
+  /// Invoked by a worker thread, once per message.
+  using CallbackT = std::function<void (const std::shared_ptr<const MessageT> &)>;
+
+  /// Construct the sharded subscription, starting the worker pool.
+  /**
+   * \param[in] node The node to create the subscription on.
+   * \param[in] topic_name The topic to shard.
+   * \param[in] qos %QoS of the underlying subscription.
+   * \param[in] callback Run by the workers, concurrently across shards.
+   * \param[in] options Shard count, selector and hand-off, see ShardingOptions.
+   * \throws std::invalid_argument if the callback is nullptr or shards is zero.
+   */
+  template<typename NodeT>
+  ShardedSubscription(
+    NodeT && node,
+    const std::string & topic_name,
+    const rclcpp::QoS & qos,
+    CallbackT callback,
+    const ShardingOptions<MessageT> & options = ShardingOptions<MessageT>())
+  : callback_(std::move(callback)),
+    shard_selector_(options.shard_selector),
+    on_complete_(options.on_complete)
+  {
+    if (nullptr == callback_) {
+      throw std::invalid_argument("callback is nullptr");
+    }
+    if (0u == options.shards) {
+      throw std::invalid_argument("shards must be positive");
+    }
+    shards_.reserve(options.shards);
+    for (size_t i = 0u; i < options.shards; ++i) {
+      shards_.push_back(std::make_unique<Shard>());
+    }
+    for (auto & shard : shards_) {
+      shard->thread = std::thread([this, shard = shard.get()]() {this->run_worker(*shard);});
+    }
+    subscription_ = rclcpp::create_subscription<MessageT>(
+      node, topic_name, qos,
+      [this](std::shared_ptr<const MessageT> message) {
+        this->enqueue(std::move(message));
+      });
+  }
+
+  ~ShardedSubscription()
+  {
+    // Stop the inflow first so no worker enqueues after shutdown.
+    subscription_.reset();
+    for (auto & shard : shards_) {
+      {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        shard->shutdown = true;
+      }
+      shard->cv.notify_all();
+    }
+    for (auto & shard : shards_) {
+      shard->thread.join();
+    }
+  }
+
+  /// Return the underlying subscription the messages arrive through.
+  typename rclcpp::Subscription<MessageT>::SharedPtr
+  get_subscription() const
+  {
+    return subscription_;
+  }
+
+private:
+  RCLCPP_DISABLE_COPY(ShardedSubscription)
+
+  /// One message handed to a worker, tagged for in-order completion.
+  struct Item
+  {
+    uint64_t sequence;
+    std::shared_ptr<const MessageT> message;
+  };
+
+  /// One worker: a queue, its synchronization, and the thread draining it.
+  struct Shard
+  {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<Item> queue;
+    bool shutdown {false};
+    std::thread thread;
+  };
+
+  /// Assign the message a shard and hand it to that worker.
+  void
+  enqueue(std::shared_ptr<const MessageT> message)
+  {
+    const size_t index = shard_selector_ ?
+      shard_selector_(*message) % shards_.size() :
+      round_robin_++ % shards_.size();
+    Shard & shard = *shards_[index];
+    {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      shard.queue.push_back({next_sequence_++, std::move(message)});
+    }
+    shard.cv.notify_one();
+  }
+
+  void
+  run_worker(Shard & shard)
+  {
+    std::unique_lock<std::mutex> lock(shard.mutex);
+    while (true) {
+      shard.cv.wait(lock, [&shard]() {return shard.shutdown || !shard.queue.empty();});
+      if (shard.shutdown) {
+        return;
+      }
+      Item item = std::move(shard.queue.front());
+      shard.queue.pop_front();
+      lock.unlock();
+      callback_(item.message);
+      if (on_complete_) {
+        this->complete_in_order(std::move(item));
+      }
+      lock.lock();
+    }
+  }
+
+  /// Park the finished item until every earlier one has been handed off.
+  void
+  complete_in_order(Item item)
+  {
+    std::lock_guard<std::mutex> lock(completion_mutex_);
+    completed_.emplace(item.sequence, std::move(item.message));
+    auto it = completed_.find(next_completion_);
+    while (it != completed_.end()) {
+      on_complete_(it->second);
+      completed_.erase(it);
+      it = completed_.find(++next_completion_);
+    }
+  }
+
+  CallbackT callback_;
+  std::function<size_t (const MessageT &)> shard_selector_;
+  std::function<void (const std::shared_ptr<const MessageT> &)> on_complete_;
+
+  std::vector<std::unique_ptr<Shard>> shards_;
+  /// Only touched from the subscription callback, which runs serially.
+  uint64_t next_sequence_ {0};
+  uint64_t round_robin_ {0};
+
+  /// Guards the out-of-order completion buffer and the hand-off.
+  std::mutex completion_mutex_;
+  std::map<uint64_t, std::shared_ptr<const MessageT>> completed_;
+  uint64_t next_completion_ {0};
+
+  typename rclcpp::Subscription<MessageT>::SharedPtr subscription_;
+};
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__SHARDING_HPP_
@@ -0,0 +1,144 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__SHARED_PARAMETER_SERVICE_HPP_
+#define RCLCPP__SHARED_PARAMETER_SERVICE_HPP_
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include "rcl_interfaces/srv/describe_parameters.hpp"
+#include "rcl_interfaces/srv/get_parameter_types.hpp"
+#include "rcl_interfaces/srv/get_parameters.hpp"
+#include "rcl_interfaces/srv/list_parameters.hpp"
+#include "rcl_interfaces/srv/set_parameters.hpp"
+#include "rcl_interfaces/srv/set_parameters_atomically.hpp"
+#include "rclcpp/macros.hpp"
+#include "rclcpp/node_interfaces/node_base_interface.hpp"
+#include "rclcpp/node_interfaces/node_parameters_interface.hpp"
+#include "rclcpp/node_interfaces/node_services_interface.hpp"
+#include "rclcpp/qos.hpp"
+#include "rclcpp/service.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+
+/// Process-wide parameter services multiplexing all registered nodes.
+/**
+ * A single set of the six standard parameter services, hosted on the first
+ * registered node, serving the parameters of every node registered with it.
+ * Containers composing many nodes can use this to avoid creating six services
+ * per node, see rclcpp::NodeOptions::use_shared_parameter_service().
+ *
+ * The standard parameter service types carry no node field, so the target
+ * node is encoded in the parameter name: a request for
+ * "<fully qualified node name>/<parameter name>" is forwarded to the node
+ * registered under the longest matching fully qualified name. Names with no
+ * registered prefix address the hosting node's own parameters, so tooling
+ * pointed at the host keeps working unchanged.
+ *
+ * If the hosting node unregisters, the services are re-created on one of the
+ * remaining registered nodes. Registration is typically managed by
+ * NodeParameters; direct use is only needed for custom node implementations.
+ */
+class SharedParameterService
+{
+public:
+  /// Return the process-wide instance.
+  RCLCPP_PUBLIC
+  static
+  SharedParameterService &
+  instance();
+
+  /// Register a node, hosting the shared services on it if none exist yet.
+  /**
+   * \param[in] node_base the node base interface used when hosting services.
+   * \param[in] node_services the node services interface used when hosting.
+   * \param[in] node_params the parameters interface requests are forwarded
+   *   to; must outlive the registration.
+   * \param[in] qos_profile the QoS used if this node hosts the services.
+   * \throws std::invalid_argument if a node with the same fully qualified
+   *   name is already registered, or if any argument is nullptr.
+   */
+  RCLCPP_PUBLIC
+  void
+  register_node(
+    const std::shared_ptr<node_interfaces::NodeBaseInterface> node_base,
+    const std::shared_ptr<node_interfaces::NodeServicesInterface> node_services,
+    rclcpp::node_interfaces::NodeParametersInterface * node_params,
+    const rclcpp::QoS & qos_profile = rclcpp::ParametersQoS());
+
+  /// Unregister a node, re-hosting the services elsewhere if it was the host.
+  /**
+   * Does nothing if no node with that name is registered.
+   *
+   * \param[in] fully_qualified_name name the node was registered under.
+   */
+  RCLCPP_PUBLIC
+  void
+  unregister_node(const std::string & fully_qualified_name);
+
+  /// Return the number of currently registered nodes.
+  RCLCPP_PUBLIC
+  size_t
+  registered_node_count() const;
+
+private:
+  RCLCPP_DISABLE_COPY(SharedParameterService)
+
+  RCLCPP_PUBLIC
+  SharedParameterService() = default;
+
+  struct Entry
+  {
+    std::weak_ptr<node_interfaces::NodeBaseInterface> node_base;
+    std::weak_ptr<node_interfaces::NodeServicesInterface> node_services;
+    rclcpp::node_interfaces::NodeParametersInterface * node_params;
+    rclcpp::QoS qos_profile {rclcpp::ParametersQoS()};
+  };
+
+  /// Create the six services on the given entry's node; mutex_ must be held.
+  void
+  host_services(const std::string & fully_qualified_name, const Entry & entry);
+
+  /// Resolve a prefixed parameter name to a node and its local parameter name.
+  /**
+   * Falls back to the hosting node with the name unchanged when no registered
+   * fully qualified name prefixes it; mutex_ must be held.
+   */
+  std::pair<rclcpp::node_interfaces::NodeParametersInterface *, std::string>
+  resolve(const std::string & name) const;
+
+  mutable std::mutex mutex_;
+  std::map<std::string, Entry> entries_;
+  std::string host_name_;
+
+  rclcpp::Service<rcl_interfaces::srv::GetParameters>::SharedPtr get_parameters_service_;
+  rclcpp::Service<rcl_interfaces::srv::GetParameterTypes>::SharedPtr
+    get_parameter_types_service_;
+  rclcpp::Service<rcl_interfaces::srv::SetParameters>::SharedPtr set_parameters_service_;
+  rclcpp::Service<rcl_interfaces::srv::SetParametersAtomically>::SharedPtr
+    set_parameters_atomically_service_;
+  rclcpp::Service<rcl_interfaces::srv::DescribeParameters>::SharedPtr
+    describe_parameters_service_;
+  rclcpp::Service<rcl_interfaces::srv::ListParameters>::SharedPtr list_parameters_service_;
+};
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__SHARED_PARAMETER_SERVICE_HPP_
@@ -15,13 +15,18 @@
 #ifndef RCLCPP__STRATEGIES__ALLOCATOR_MEMORY_STRATEGY_HPP_
 #define RCLCPP__STRATEGIES__ALLOCATOR_MEMORY_STRATEGY_HPP_
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <vector>
 #include <utility>
 
 #include "rcl/allocator.h"
 
+#include "rclcpp/allocation_audit.hpp"
 #include "rclcpp/allocator/allocator_common.hpp"
+#include "rclcpp/allocator/pmr_allocator.hpp"
 #include "rclcpp/detail/add_guard_condition_to_rcl_wait_set.hpp"
 #include "rclcpp/memory_strategy.hpp"
 #include "rclcpp/node.hpp"
@@ -85,11 +90,19 @@ public:
 
   void clear_handles() override
   {
-    subscription_handles_.clear();
-    service_handles_.clear();
-    client_handles_.clear();
-    timer_handles_.clear();
-    waitable_handles_.clear();
+    // clear() keeps each vector's capacity; additionally recording the
+    // high-water sizes and re-reserving them makes the retention explicit
+    // and survives vectors that were shrunk or moved from, so steady-state
+    // wait cycles never touch the allocator.
+    retain_high_water(subscription_handles_, subscription_high_water_);
+    retain_high_water(service_handles_, service_high_water_);
+    retain_high_water(client_handles_, client_high_water_);
+    retain_high_water(timer_handles_, timer_high_water_);
+    retain_high_water(waitable_handles_, waitable_high_water_);
+    if (waitable_triggered_handles_.capacity() < waitable_high_water_) {
+      waitable_triggered_handles_.reserve(waitable_high_water_);
+    }
+    scratch_arena_.reset();
   }
 
   void remove_null_handles(rcl_wait_set_t * wait_set) override
@@ -165,19 +178,19 @@ public:
 
       group->collect_all_ptrs(
         [this](const rclcpp::SubscriptionBase::SharedPtr & subscription) {
-          subscription_handles_.push_back(subscription->get_subscription_handle());
+          audited_push_back(subscription_handles_, subscription->get_subscription_handle());
         },
         [this](const rclcpp::ServiceBase::SharedPtr & service) {
-          service_handles_.push_back(service->get_service_handle());
+          audited_push_back(service_handles_, service->get_service_handle());
         },
         [this](const rclcpp::ClientBase::SharedPtr & client) {
-          client_handles_.push_back(client->get_client_handle());
+          audited_push_back(client_handles_, client->get_client_handle());
         },
         [this](const rclcpp::TimerBase::SharedPtr & timer) {
-          timer_handles_.push_back(timer->get_timer_handle());
+          audited_push_back(timer_handles_, timer->get_timer_handle());
         },
         [this](const rclcpp::Waitable::SharedPtr & waitable) {
-          waitable_handles_.push_back(waitable);
+          audited_push_back(waitable_handles_, waitable);
         });
     }
 
@@ -189,7 +202,7 @@ public:
     if (nullptr == waitable) {
       throw std::runtime_error("waitable object unexpectedly nullptr");
     }
-    waitable_handles_.push_back(waitable);
+    audited_push_back(waitable_handles_, waitable);
   }
 
   bool add_handles_to_wait_set(rcl_wait_set_t * wait_set) override
@@ -485,11 +498,101 @@ public:
     return waitable_handles_.size();
   }
 
+  /// Monotonic bump allocator for temporaries that live for one wait cycle.
+  /**
+   * Allocations are served by advancing an offset into one retained buffer;
+   * reset() rewinds the offset and grows the buffer once to the high-water
+   * usage of previous cycles, so after warm-up a cycle's worth of scratch
+   * allocations costs a few pointer bumps and no heap traffic. Requests that
+   * do not fit the buffer fall back to the heap (recorded with the
+   * allocation audit) and are released on the next reset().
+   *
+   * Nothing is destroyed by reset(); only use this for trivially
+   * destructible data.
+   */
+  class ScratchArena
+  {
+public:
+    /// Allocate size bytes with the given alignment, valid until reset().
+    void * allocate(size_t size, size_t alignment = alignof(std::max_align_t))
+    {
+      const uintptr_t base = reinterpret_cast<uintptr_t>(buffer_.data());
+      const uintptr_t aligned =
+        (base + offset_ + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+      const size_t new_offset = static_cast<size_t>(aligned - base) + size;
+      if (0 == buffer_.size() || new_offset > buffer_.size()) {
+        // Does not fit: remember the demand so reset() can grow the buffer,
+        // serve this request from the heap for now.
+        high_water_ = std::max(high_water_, offset_ + size + alignment);
+        rclcpp::allocation_audit::record(
+          "AllocatorMemoryStrategy::scratch_arena", size + alignment);
+        overflow_.emplace_back(new unsigned char[size + alignment]);
+        const uintptr_t overflow_base = reinterpret_cast<uintptr_t>(overflow_.back().get());
+        return reinterpret_cast<void *>(
+          (overflow_base + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1));
+      }
+      offset_ = new_offset;
+      high_water_ = std::max(high_water_, offset_);
+      return reinterpret_cast<void *>(aligned);
+    }
+
+    /// Rewind the arena, invalidating everything allocated since the last reset.
+    void reset()
+    {
+      offset_ = 0;
+      overflow_.clear();
+      if (buffer_.size() < high_water_) {
+        buffer_.resize(high_water_);
+      }
+    }
+
+private:
+    std::vector<unsigned char, typename std::allocator_traits<Alloc>::template rebind_alloc<
+      unsigned char>> buffer_;
+    std::vector<std::unique_ptr<unsigned char[]>> overflow_;
+    size_t offset_ {0};
+    size_t high_water_ {0};
+  };
+
+  /// Return the per-spin scratch arena, reset by clear_handles() each cycle.
+  ScratchArena & scratch_arena()
+  {
+    return scratch_arena_;
+  }
+
 private:
   template<typename T>
   using VectorRebind =
     std::vector<T, typename std::allocator_traits<Alloc>::template rebind_alloc<T>>;
 
+  /// Record a vector's high-water size, clear it, and re-reserve that size.
+  template<typename VectorT>
+  void retain_high_water(VectorT & vector, size_t & high_water)
+  {
+    high_water = std::max(high_water, vector.size());
+    vector.clear();
+    if (vector.capacity() < high_water) {
+      vector.reserve(high_water);
+    }
+  }
+
+  /// push_back which records capacity growth with the allocation audit.
+  /**
+   * The handle vectors are cleared each wait cycle but keep their capacity,
+   * so only pushes which actually grow a vector are recorded; a steady-state
+   * executor produces no audit entries from here.
+   */
+  template<typename VectorT, typename ValueT>
+  void audited_push_back(VectorT & vector, ValueT && value)
+  {
+    if (vector.size() == vector.capacity()) {
+      rclcpp::allocation_audit::record(
+        "AllocatorMemoryStrategy::collect_entities",
+        (vector.capacity() + 1) * sizeof(typename VectorT::value_type));
+    }
+    vector.push_back(std::forward<ValueT>(value));
+  }
+
   VectorRebind<const rclcpp::GuardCondition *> guard_conditions_;
 
   VectorRebind<std::shared_ptr<const rcl_subscription_t>> subscription_handles_;
@@ -500,9 +603,28 @@ private:
 
   VectorRebind<std::shared_ptr<Waitable>> waitable_triggered_handles_;
 
+  // High-water entity counts, used to size the handle vectors once and for
+  // all instead of regrowing them as entity counts fluctuate.
+  size_t subscription_high_water_ {0};
+  size_t service_high_water_ {0};
+  size_t client_high_water_ {0};
+  size_t timer_high_water_ {0};
+  size_t waitable_high_water_ {0};
+
+  ScratchArena scratch_arena_;
+
   std::shared_ptr<VoidAlloc> allocator_;
 };
 
+/// AllocatorMemoryStrategy backed by a std::pmr::memory_resource.
+/**
+ * Construct with `std::make_shared<rclcpp::allocator::PolymorphicAllocator<>>(resource)` to draw
+ * the executor's per-wait containers from the resource, e.g. a per-node arena shared with the
+ * entities via rclcpp::NodeOptions::memory_resource().
+ */
+using PolymorphicAllocatorMemoryStrategy =
+  AllocatorMemoryStrategy<rclcpp::allocator::PolymorphicAllocator<>>;
+
 }  // namespace allocator_memory_strategy
 }  // namespace memory_strategies
 }  // namespace rclcpp
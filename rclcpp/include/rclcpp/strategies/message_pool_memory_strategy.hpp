@@ -15,7 +15,12 @@
 #ifndef RCLCPP__STRATEGIES__MESSAGE_POOL_MEMORY_STRATEGY_HPP_
 #define RCLCPP__STRATEGIES__MESSAGE_POOL_MEMORY_STRATEGY_HPP_
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
 
 #include "rosidl_runtime_cpp/traits.hpp"
 
@@ -30,12 +35,21 @@ namespace strategies
 namespace message_pool_memory_strategy
 {
 
-/// Completely static memory allocation strategy for messages.
+/// Pooled memory allocation strategy for messages.
 /**
- * Templated on the type of message pooled by this class and the size of the message pool.
+ * Templated on the type of message pooled by this class and the size of a message pool chunk.
  * Templating allows the program to determine the memory required for this object at compile time.
  * The size of the message pool should be at least the largest number of concurrent accesses to
  * the subscription (usually the number of threads).
+ *
+ * Free messages are tracked with a lock-free Treiber stack of slot indices, so borrowing and
+ * returning messages never takes a lock or scans the pool and is safe to use from the workers of
+ * a multi-threaded executor with a reentrant callback group.
+ *
+ * By default the pool is a single chunk of Size messages and borrowing from an exhausted pool
+ * throws, preserving the fully static behavior.  Constructing with max_chunks > 1 allows the
+ * pool to grow by whole chunks, taking a lock only on the growth path; high_water_mark() reports
+ * the largest number of messages ever borrowed at once, to help size the pool for steady state.
  */
 template<
   typename MessageT,
@@ -50,61 +64,191 @@ class MessagePoolMemoryStrategy
 public:
   RCLCPP_SMART_PTR_DEFINITIONS(MessagePoolMemoryStrategy)
 
-  /// Default constructor
+  /// Default constructor, a fixed pool of exactly Size messages.
   MessagePoolMemoryStrategy()
-  : next_array_index_(0)
+  : MessagePoolMemoryStrategy(1)
+  {}
+
+  /// Constructor allowing the pool to grow.
+  /**
+   * \param[in] max_chunks Maximum number of chunks of Size messages the pool
+   *   may grow to; the first chunk is allocated immediately and further chunks
+   *   are allocated on demand when the pool is exhausted.
+   * \throws std::invalid_argument if max_chunks is zero.
+   */
+  explicit MessagePoolMemoryStrategy(size_t max_chunks)
+  : max_chunks_(max_chunks)
   {
-    for (size_t i = 0; i < Size; ++i) {
-      pool_[i].msg_ptr_ = std::make_shared<MessageT>();
-      pool_[i].used = false;
+    if (0u == max_chunks) {
+      throw std::invalid_argument("max_chunks must be at least 1");
     }
+    chunks_.reserve(max_chunks_);
+    this->add_chunk();
   }
 
   /// Borrow a message from the message pool.
   /**
-   * Manage the message pool ring buffer.
-   * Throw an exception if the next message was not available.
+   * Pop a free message off the lock-free free list, growing the pool by a
+   * chunk if it is exhausted and growth was allowed at construction.
    * \return Shared pointer to the borrowed message.
+   * \throws std::runtime_error if the pool is exhausted and cannot grow.
    */
-  std::shared_ptr<MessageT> borrow_message()
+  std::shared_ptr<MessageT> borrow_message() override
   {
-    size_t current_index = next_array_index_;
-    next_array_index_ = (next_array_index_ + 1) % Size;
-    if (pool_[current_index].used) {
-      throw std::runtime_error("Tried to access message that was still in use! Abort.");
+    uint32_t index = this->pop_free_index();
+    if (kInvalidIndex == index) {
+      index = this->grow_and_pop();
     }
-    pool_[current_index].msg_ptr_->~MessageT();
-    new (pool_[current_index].msg_ptr_.get())MessageT;
+    const std::shared_ptr<Chunk> & chunk = chunks_[index / Size];
+    MessageT * message = &chunk->messages[index % Size];
+    message->~MessageT();
+    new (message) MessageT;
 
-    pool_[current_index].used = true;
-    return pool_[current_index].msg_ptr_;
+    const size_t in_use = in_use_count_.fetch_add(1, std::memory_order_relaxed) + 1;
+    size_t hwm = high_water_mark_.load(std::memory_order_relaxed);
+    while (in_use > hwm &&
+      !high_water_mark_.compare_exchange_weak(hwm, in_use, std::memory_order_relaxed))
+    {}
+    // Alias the chunk's control block (no allocation), so a message handed
+    // out keeps its chunk alive even if the pool is destroyed first.
+    return std::shared_ptr<MessageT>(chunk, message);
   }
 
   /// Return a message to the message pool.
   /**
-   * Manage metadata in the message pool ring buffer to release the message.
+   * Locate the owning chunk by address range, then push the slot back onto
+   * the lock-free free list.
    * \param[in] msg Shared pointer to the message to return.
+   * \throws std::runtime_error if the message does not belong to this pool.
    */
-  void return_message(std::shared_ptr<MessageT> & msg)
+  void return_message(std::shared_ptr<MessageT> & msg) override
   {
-    for (size_t i = 0; i < Size; ++i) {
-      if (pool_[i].msg_ptr_ == msg) {
-        pool_[i].used = false;
+    const size_t chunk_count = chunk_count_.load(std::memory_order_acquire);
+    for (size_t chunk_index = 0; chunk_index < chunk_count; ++chunk_index) {
+      const MessageT * base = chunks_[chunk_index]->messages.data();
+      if (msg.get() >= base && msg.get() < base + Size) {
+        in_use_count_.fetch_sub(1, std::memory_order_relaxed);
+        this->push_free_index(static_cast<uint32_t>(chunk_index * Size + (msg.get() - base)));
         return;
       }
     }
     throw std::runtime_error("Unrecognized message ptr in return_message.");
   }
 
+  /// Return the current capacity of the pool, in messages.
+  size_t capacity() const
+  {
+    return chunk_count_.load(std::memory_order_acquire) * Size;
+  }
+
+  /// Return the largest number of messages ever borrowed at the same time.
+  size_t high_water_mark() const
+  {
+    return high_water_mark_.load(std::memory_order_relaxed);
+  }
+
 protected:
+  static constexpr uint32_t kInvalidIndex = UINT32_MAX;
+
   struct PoolMember
   {
-    std::shared_ptr<MessageT> msg_ptr_;
-    bool used;
+    /// Index of the next free slot while this slot is on the free list.
+    std::atomic<uint32_t> next_free_ {kInvalidIndex};
+  };
+
+  /// A chunk of Size contiguous messages, so slots can be found by address.
+  struct Chunk
+  {
+    Chunk()
+    : messages(Size), members(new PoolMember[Size])
+    {}
+
+    std::vector<MessageT> messages;
+    std::unique_ptr<PoolMember[]> members;
   };
 
-  std::array<PoolMember, Size> pool_;
-  size_t next_array_index_;
+  PoolMember & member_at(uint32_t index)
+  {
+    return chunks_[index / Size]->members[index % Size];
+  }
+
+  /// Pop a slot index off the free list, or kInvalidIndex if it is empty.
+  /**
+   * The head packs a version tag in the upper 32 bits and a slot index in the
+   * lower 32 bits; the tag changes on every pop so a concurrent pop/push/pop
+   * of the same slot cannot be mistaken for an unchanged head (ABA).
+   */
+  uint32_t pop_free_index()
+  {
+    uint64_t head = free_list_head_.load(std::memory_order_acquire);
+    while (true) {
+      const uint32_t index = static_cast<uint32_t>(head);
+      if (kInvalidIndex == index) {
+        return kInvalidIndex;
+      }
+      const uint32_t next = this->member_at(index).next_free_.load(std::memory_order_relaxed);
+      const uint64_t new_head = ((head >> 32) + 1) << 32 | next;
+      if (free_list_head_.compare_exchange_weak(
+          head, new_head, std::memory_order_acq_rel, std::memory_order_acquire))
+      {
+        return index;
+      }
+    }
+  }
+
+  /// Push a slot index onto the free list.
+  void push_free_index(uint32_t index)
+  {
+    PoolMember & member = this->member_at(index);
+    uint64_t head = free_list_head_.load(std::memory_order_relaxed);
+    uint64_t new_head;
+    do {
+      member.next_free_.store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+      new_head = ((head >> 32) + 1) << 32 | index;
+    } while (!free_list_head_.compare_exchange_weak(
+        head, new_head, std::memory_order_release, std::memory_order_relaxed));
+  }
+
+  /// Allocate and publish a new chunk, pushing its slots onto the free list.
+  /**
+   * Must be called with growth_mutex_ held, except from the constructor.
+   */
+  void add_chunk()
+  {
+    const size_t chunk_index = chunk_count_.load(std::memory_order_relaxed);
+    chunks_.push_back(std::make_shared<Chunk>());
+    // Publish the chunk before its slots become poppable.
+    chunk_count_.store(chunk_index + 1, std::memory_order_release);
+    for (size_t i = 0; i < Size; ++i) {
+      this->push_free_index(static_cast<uint32_t>(chunk_index * Size + i));
+    }
+  }
+
+  /// Grow the pool on exhaustion and pop a slot, or throw if it cannot grow.
+  uint32_t grow_and_pop()
+  {
+    std::lock_guard<std::mutex> lock(growth_mutex_);
+    while (true) {
+      // Another thread may have grown the pool or returned a message while
+      // this one was acquiring the lock.
+      const uint32_t index = this->pop_free_index();
+      if (kInvalidIndex != index) {
+        return index;
+      }
+      if (chunk_count_.load(std::memory_order_relaxed) >= max_chunks_) {
+        throw std::runtime_error("Tried to access message that was still in use! Abort.");
+      }
+      this->add_chunk();
+    }
+  }
+
+  const size_t max_chunks_;
+  std::vector<std::shared_ptr<Chunk>> chunks_;
+  std::atomic<size_t> chunk_count_ {0};
+  std::atomic<uint64_t> free_list_head_ {kInvalidIndex};
+  std::atomic<size_t> in_use_count_ {0};
+  std::atomic<size_t> high_water_mark_ {0};
+  std::mutex growth_mutex_;
 };
 
 }  // namespace message_pool_memory_strategy
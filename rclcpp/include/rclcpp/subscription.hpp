@@ -18,6 +18,7 @@
 #include <rmw/error_handling.h>
 #include <rmw/rmw.h>
 
+#include <atomic>
 #include <chrono>
 #include <functional>
 #include <iostream>
@@ -142,13 +143,33 @@ public:
       topic_name,
       options.to_rcl_subscription_options(qos),
       // NOTE(methylDragon): Passing these args separately is necessary for event binding
-      options.event_callbacks,
-      options.use_default_callbacks,
+      options.slim ? SubscriptionEventCallbacks() : options.event_callbacks,
+      options.use_default_callbacks && !options.slim,
       callback.is_serialized_message_callback() ? DeliveredMessageKind::SERIALIZED_MESSAGE : DeliveredMessageKind::ROS_MESSAGE),  // NOLINT
     any_callback_(callback),
     options_(options),
     message_memory_strategy_(message_memory_strategy)
   {
+    if (options.slim &&
+      (options.event_callbacks.deadline_callback ||
+      options.event_callbacks.liveliness_callback ||
+      options.event_callbacks.incompatible_qos_callback ||
+      options.event_callbacks.message_lost_callback ||
+      options.event_callbacks.incompatible_type_callback ||
+      options.event_callbacks.matched_callback))
+    {
+      throw std::invalid_argument("event_callbacks must be empty when the slim option is set");
+    }
+
+    this->set_take_batch_size(options_.take_batch_size);
+    this->set_max_message_age(options_.max_message_age);
+
+    if (any_callback_.is_const_ref_callback()) {
+      // A const-reference callback cannot retain the message past its own
+      // return, so take-dispatch cycles can reuse one preallocated message.
+      reusable_message_ = message_memory_strategy_->borrow_message();
+    }
+
     // Setup intra process publishing if requested.
     if (rclcpp::detail::resolve_use_intra_process(options_, *node_base)) {
       using rclcpp::detail::resolve_intra_process_buffer_type;
@@ -163,9 +184,12 @@ public:
         throw std::invalid_argument(
                 "intraprocess communication is not allowed with 0 depth qos policy");
       }
-      if (qos_profile.durability() != rclcpp::DurabilityPolicy::Volatile) {
+      if (qos_profile.durability() != rclcpp::DurabilityPolicy::Volatile &&
+        qos_profile.durability() != rclcpp::DurabilityPolicy::TransientLocal)
+      {
         throw std::invalid_argument(
-                "intraprocess communication allowed only with volatile durability");
+                "intraprocess communication allowed only with volatile or "
+                "transient local durability");
       }
 
       using SubscriptionIntraProcessT = rclcpp::experimental::SubscriptionIntraProcess<
@@ -184,7 +208,16 @@ public:
         context,
         this->get_topic_name(),  // important to get like this, as it has the fully-qualified name
         qos_profile,
-        resolve_intra_process_buffer_type(options_.intra_process_buffer_type, callback));
+        resolve_intra_process_buffer_type(options_.intra_process_buffer_type, callback),
+        options_.take_batch_size);
+      subscription_intra_process_->set_introspection_counters(this->get_introspection_counters());
+      if (options_.intra_process_buffer_full_policy !=
+        rclcpp::IntraProcessBufferFullPolicy::OverwriteOldest)
+      {
+        subscription_intra_process_->set_buffer_full_policy(
+          options_.intra_process_buffer_full_policy,
+          options_.intra_process_buffer_full_timeout);
+      }
       TRACETOOLS_TRACEPOINT(
         rclcpp_subscription_init,
         static_cast<const void *>(get_subscription_handle().get()),
@@ -253,6 +286,26 @@ public:
     return this->take_type_erased(static_cast<void *>(&message_out), message_info_out);
   }
 
+  /// Take the next message from the inter-process subscription without throwing.
+  /**
+   * Error-code variant of take() for callers that cannot afford exceptions on
+   * the hot path, e.g. builds compiled without exception support.
+   *
+   * \sa SubscriptionBase::try_take_type_erased()
+   *
+   * \param[out] message_out The message into which take will copy the data.
+   * \param[out] message_info_out The message info for the taken message.
+   * \return RCL_RET_OK if a valid message was taken,
+   *   RCL_RET_SUBSCRIPTION_TAKE_FAILED if no message was available or the
+   *   taken copy duplicates an intra-process delivery,
+   *   or the error code from rcl_take() on failure.
+   */
+  rcl_ret_t
+  try_take(ROSMessageType & message_out, rclcpp::MessageInfo & message_info_out) noexcept
+  {
+    return this->try_take_type_erased(static_cast<void *>(&message_out), message_info_out);
+  }
+
   /// Take the next message from the inter-process subscription.
   /**
    * This version takes a SubscribedType which is different from the
@@ -276,6 +329,54 @@ public:
     return taken;
   }
 
+  /// Set an rclcpp-side content filter callback for this subscription.
+  /**
+   * Fallback filter stage for middlewares without native content filtering:
+   * inter-process messages are evaluated right after take and intra-process
+   * messages at publish time, before insertion into the intra-process buffer,
+   * so filtered-out intra-process messages never wake an executor.
+   *
+   * When a rclcpp::TypeAdapter is in use only the take-time stage is wired up,
+   * since the intra-process buffer holds the adapted type.
+   *
+   * \param[in] predicate Return true to deliver the message, false to drop it.
+   *   Pass nullptr to clear the filter.
+   * \throws std::invalid_argument if the subscription delivers serialized
+   *   messages, \sa SubscriptionBase::set_content_filter_predicate() which
+   *   can filter those.
+   */
+  void
+  set_content_filter_callback(std::function<bool(const ROSMessageType &)> predicate)
+  {
+    if (rclcpp::DeliveredMessageKind::ROS_MESSAGE != this->get_delivered_message_kind()) {
+      throw std::invalid_argument(
+              "set_content_filter_callback() is only supported on subscriptions "
+              "delivering ROS messages");
+    }
+    if constexpr (std::is_same_v<SubscribedType, ROSMessageType>) {
+      if (subscription_intra_process_) {
+        using SubscriptionIntraProcessT = rclcpp::experimental::SubscriptionIntraProcess<
+          MessageT,
+          SubscribedType,
+          SubscribedTypeAllocator,
+          SubscribedTypeDeleter,
+          ROSMessageT,
+          AllocatorT>;
+        std::static_pointer_cast<SubscriptionIntraProcessT>(subscription_intra_process_)
+        ->set_content_filter(predicate);
+      }
+    }
+    if (predicate) {
+      this->set_content_filter_predicate(
+        [predicate = std::move(predicate)](
+          const void * message, const rclcpp::MessageInfo &) {
+          return predicate(*static_cast<const ROSMessageType *>(message));
+        });
+    } else {
+      this->set_content_filter_predicate(nullptr);
+    }
+  }
+
   std::shared_ptr<void>
   create_message() override
   {
@@ -283,6 +384,16 @@ public:
      * create_message, though alternative memory strategies that re-use a preallocated message may be
      * used (see rclcpp/strategies/message_pool_memory_strategy.hpp).
      */
+    if (reusable_message_) {
+      bool expected = false;
+      if (reusable_message_in_use_.compare_exchange_strong(
+          expected, true, std::memory_order_acquire))
+      {
+        return reusable_message_;
+      }
+      // The slot is held by a concurrent take (reentrant callback group),
+      // fall through and borrow a fresh message for this one.
+    }
     return message_memory_strategy_->borrow_message();
   }
 
@@ -311,7 +422,9 @@ public:
       now = std::chrono::system_clock::now();
     }
 
+    const auto callback_start = std::chrono::steady_clock::now();
     any_callback_.dispatch(typed_message, message_info);
+    this->count_callback_executed(callback_start);
 
     if (subscription_topic_statistics_) {
       const auto nanos = std::chrono::time_point_cast<std::chrono::nanoseconds>(now);
@@ -326,7 +439,9 @@ public:
     const rclcpp::MessageInfo & message_info) override
   {
     // TODO(wjwwood): enable topic statistics for serialized messages
+    const auto callback_start = std::chrono::steady_clock::now();
     any_callback_.dispatch(serialized_message, message_info);
+    this->count_callback_executed(callback_start);
   }
 
   void
@@ -352,7 +467,9 @@ public:
       now = std::chrono::system_clock::now();
     }
 
+    const auto callback_start = std::chrono::steady_clock::now();
     any_callback_.dispatch(sptr, message_info);
+    this->count_callback_executed(callback_start);
 
     if (subscription_topic_statistics_) {
       const auto nanos = std::chrono::time_point_cast<std::chrono::nanoseconds>(now);
@@ -368,6 +485,11 @@ public:
   void
   return_message(std::shared_ptr<void> & message) override
   {
+    if (reusable_message_ && message == reusable_message_) {
+      message.reset();
+      reusable_message_in_use_.store(false, std::memory_order_release);
+      return;
+    }
     auto typed_message = std::static_pointer_cast<ROSMessageType>(message);
     message_memory_strategy_->return_message(typed_message);
   }
@@ -452,6 +574,11 @@ private:
   typename message_memory_strategy::MessageMemoryStrategy<ROSMessageType, AllocatorT>::SharedPtr
     message_memory_strategy_;
 
+  /// Preallocated message reused across takes when the callback is known not
+  /// to retain the message, see create_message().
+  std::shared_ptr<ROSMessageType> reusable_message_;
+  std::atomic<bool> reusable_message_in_use_ {false};
+
   /// Component which computes and publishes topic statistics for this subscriber
   SubscriptionTopicStatisticsSharedPtr subscription_topic_statistics_{nullptr};
 };
@@ -16,6 +16,9 @@
 #define RCLCPP__SUBSCRIPTION_BASE_HPP_
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -36,12 +39,15 @@
 #include "rclcpp/dynamic_typesupport/dynamic_serialization_support.hpp"
 #include "rclcpp/experimental/intra_process_manager.hpp"
 #include "rclcpp/experimental/subscription_intra_process_base.hpp"
+#include "rclcpp/introspection.hpp"
 #include "rclcpp/macros.hpp"
 #include "rclcpp/message_info.hpp"
 #include "rclcpp/network_flow_endpoint.hpp"
 #include "rclcpp/qos.hpp"
 #include "rclcpp/event_handler.hpp"
 #include "rclcpp/serialized_message.hpp"
+#include "rclcpp/interned_qos.hpp"
+#include "rclcpp/topic_name.hpp"
 #include "rclcpp/subscription_content_filter_options.hpp"
 #include "rclcpp/type_support_decl.hpp"
 #include "rclcpp/visibility_control.hpp"
@@ -49,11 +55,20 @@
 namespace rclcpp
 {
 
+/**
+ * SubscriptionBusyPoller is forward declared here, avoiding a circular inclusion between
+ * `subscription_busy_poller.hpp` and `subscription_base.hpp`.
+ */
+class SubscriptionBusyPoller;
+
 namespace node_interfaces
 {
 class NodeBaseInterface;
 }  // namespace node_interfaces
 
+/// Forward declared to avoid including `context.hpp`; only a weak reference is held.
+class Context;
+
 namespace experimental
 {
 /**
@@ -128,6 +143,26 @@ public:
   const char *
   get_topic_name() const;
 
+  /// Get the interned fully-qualified topic name.
+  /**
+   * The name is interned once at construction, so comparisons against other
+   * interned names are pointer comparisons.
+   * \return The interned topic name.
+   */
+  RCLCPP_PUBLIC
+  const rclcpp::TopicName &
+  get_interned_topic_name() const;
+
+  /// Get the interned actual QoS settings of this subscription.
+  /**
+   * The rmw-resolved profile is interned once at construction, so comparisons
+   * against other interned profiles are pointer comparisons.
+   * \return The interned actual QoS profile.
+   */
+  RCLCPP_PUBLIC
+  const rclcpp::InternedQoS &
+  get_interned_actual_qos() const;
+
   RCLCPP_PUBLIC
   std::shared_ptr<rcl_subscription_t>
   get_subscription_handle();
@@ -159,6 +194,12 @@ public:
   rclcpp::QoS
   get_actual_qos() const;
 
+  /// Get the introspection counter block for this subscription.
+  /** \return The counter block, see rclcpp::introspection::EntityCounters. */
+  RCLCPP_PUBLIC
+  std::shared_ptr<rclcpp::introspection::EntityCounters>
+  get_introspection_counters() const;
+
   /// Take the next inter-process message from the subscription as a type erased pointer.
   /**
    * \sa Subscription::take() for details on how this function works.
@@ -180,6 +221,55 @@ public:
   bool
   take_type_erased(void * message_out, rclcpp::MessageInfo & message_info_out);
 
+  /// Take the next inter-process message without throwing on failure.
+  /**
+   * Error-code variant of take_type_erased() for callers that cannot afford
+   * exceptions on the hot path.
+   * No allocation happens on any branch and the rcl error state is reset
+   * before returning, so nothing is left pending for a later throwing call.
+   *
+   * \param[out] message_out The type erased message pointer into which take
+   *   will copy the data.
+   * \param[out] message_info_out The message info for the taken message.
+   * \return RCL_RET_OK if a valid message was taken,
+   *   RCL_RET_SUBSCRIPTION_TAKE_FAILED if no message was available or the
+   *   taken copy duplicates an intra-process delivery,
+   *   or the error code from rcl_take() on failure.
+   */
+  RCLCPP_PUBLIC
+  rcl_ret_t
+  try_take_type_erased(void * message_out, rclcpp::MessageInfo & message_info_out) noexcept;
+
+  /// Take up to count pending inter-process messages in one middleware call.
+  /**
+   * Uses rmw_take_sequence() on the underlying rmw subscription so a burst of
+   * queued messages is drained with a single middleware round trip, rather
+   * than one rcl_take() per message.
+   * Middlewares that do not implement take-sequence are detected on first use
+   * and this falls back to taking the messages one at a time.
+   *
+   * Unlike take_type_erased(), messages published by local intra-process
+   * publishers are not filtered out; callers should check each taken
+   * message's info with matches_any_intra_process_publishers() and skip the
+   * duplicates.
+   *
+   * \param[in] count the maximum number of messages to take.
+   * \param[out] messages_out array of count type erased message pointers
+   *   into which take will copy the data.
+   * \param[out] message_infos_out array of count message infos, one per
+   *   taken message.
+   * \return the number of messages taken, filled in order from index zero.
+   * \throws std::runtime_error if the middleware fails to take
+   * \throws any rcl errors from the one-at-a-time fallback,
+   *   \sa rclcpp::exceptions::throw_from_rcl_error()
+   */
+  RCLCPP_PUBLIC
+  size_t
+  take_type_erased_sequence(
+    size_t count,
+    void ** messages_out,
+    rclcpp::MessageInfo * message_infos_out);
+
   /// Take the next inter-process message, in its serialized form, from the subscription.
   /**
    * For now, if data is taken (written) into the message_out and
@@ -198,6 +288,92 @@ public:
   bool
   take_serialized(rclcpp::SerializedMessage & message_out, rclcpp::MessageInfo & message_info_out);
 
+  /// Non-owning view of one message taken into a caller-owned arena.
+  /**
+   * Produced by take_serialized_into() and take_serialized_sequence_into().
+   * The data pointer refers either into the caller's arena, or, for a
+   * message that did not fit the remaining arena space, into an internal
+   * fallback buffer that stays valid only until the next take on this
+   * subscription.
+   */
+  struct SerializedView
+  {
+    const uint8_t * data;
+    size_t size;
+    /// True when data points into the caller's arena.
+    bool in_arena;
+  };
+
+  /// Take the next serialized message in place into a caller-owned arena.
+  /**
+   * Unlike take_serialized(), which grows the provided SerializedMessage to
+   * the taken size, the message is written directly into the given memory,
+   * so a take loop against one preallocated region performs no per-message
+   * allocation. When a message is larger than the arena, the take falls
+   * back to an internal heap buffer transparently: the message is not lost,
+   * the view's in_arena flag is false, and the data stays valid only until
+   * the next take on this subscription.
+   *
+   * The fallback buffer is shared per subscription; takes through this
+   * method must not run concurrently.
+   *
+   * \param[in] arena start of the caller-owned region to write into.
+   * \param[in] arena_capacity usable bytes at arena.
+   * \param[out] view_out where the taken message was written, see
+   *   SerializedView.
+   * \param[out] message_info_out The message info for the taken message.
+   * \returns true if data was taken and is valid, otherwise false
+   * \throws std::invalid_argument if arena is null or arena_capacity is zero
+   * \throws any rcl errors from rcl_take, \sa rclcpp::exceptions::throw_from_rcl_error()
+   */
+  RCLCPP_PUBLIC
+  bool
+  take_serialized_into(
+    uint8_t * arena,
+    size_t arena_capacity,
+    SerializedView & view_out,
+    rclcpp::MessageInfo & message_info_out);
+
+  /// Take pending serialized messages back to back into a caller-owned arena.
+  /**
+   * Repeats take_serialized_into() until the queue is drained, max_messages
+   * are taken, or the arena is exhausted, packing the messages into the
+   * arena with each start offset aligned to eight bytes. A message that did
+   * not fit the remaining space lands in the shared fallback buffer and
+   * ends the batch, since the fallback holds one message at a time.
+   *
+   * \param[in] arena start of the caller-owned region to write into.
+   * \param[in] arena_capacity usable bytes at arena.
+   * \param[in] max_messages the maximum number of messages to take.
+   * \param[out] views_out array of max_messages views, one per taken message.
+   * \param[out] message_infos_out array of max_messages message infos, one
+   *   per taken message.
+   * \return the number of messages taken, filled in order from index zero.
+   * \throws std::invalid_argument if an argument is null or zero
+   * \throws any rcl errors from rcl_take, \sa rclcpp::exceptions::throw_from_rcl_error()
+   */
+  RCLCPP_PUBLIC
+  size_t
+  take_serialized_sequence_into(
+    uint8_t * arena,
+    size_t arena_capacity,
+    size_t max_messages,
+    SerializedView * views_out,
+    rclcpp::MessageInfo * message_infos_out);
+
+  /// Check if a message sender matches one of this subscription's intra-process publishers.
+  /**
+   * Messages taken with take_type_erased_sequence() are not de-duplicated;
+   * callers use this to identify and skip the inter-process copy of messages
+   * that are also delivered via intra-process.
+   *
+   * \param[in] sender_gid The publisher gid from the taken message's info.
+   * \return true if the sender is a matched local intra-process publisher.
+   */
+  RCLCPP_PUBLIC
+  bool
+  matches_any_intra_process_publishers(const rmw_gid_t * sender_gid) const;
+
   /// Borrow a new message.
   /** \return Shared pointer to the fresh message. */
   RCLCPP_PUBLIC
@@ -274,6 +450,75 @@ public:
   size_t
   get_publisher_count() const;
 
+  /// Return how many pending messages the executor may drain per activation.
+  /**
+   * \return the batch size, see `SubscriptionOptionsBase::take_batch_size`.
+   */
+  RCLCPP_PUBLIC
+  size_t
+  get_take_batch_size() const;
+
+  /// Set how many pending messages the executor may drain per activation.
+  /**
+   * \param[in] take_batch_size the batch size, values of zero are treated as 1.
+   */
+  RCLCPP_PUBLIC
+  void
+  set_take_batch_size(size_t take_batch_size);
+
+  /// Return the maximum age a message may have at dispatch before it is shed.
+  /**
+   * \return the age limit, zero when shedding is disabled,
+   *   see `SubscriptionOptionsBase::max_message_age`.
+   */
+  RCLCPP_PUBLIC
+  std::chrono::nanoseconds
+  get_max_message_age() const;
+
+  /// Set the maximum age a message may have at dispatch before it is shed.
+  /**
+   * \param[in] max_message_age the age limit, non-positive values disable shedding.
+   */
+  RCLCPP_PUBLIC
+  void
+  set_max_message_age(std::chrono::nanoseconds max_message_age);
+
+  /// Check whether a taken message is too old to deliver, counting the drop.
+  /**
+   * Called by the executor at dispatch, before the message reaches the
+   * content filter and the callback.
+   *
+   * \param[in] message_info info of the taken message.
+   * \return true if the message exceeds the configured age and must be
+   *   dropped; the shed_messages counter has then been incremented.
+   */
+  RCLCPP_PUBLIC
+  bool
+  shed_stale_message(const rclcpp::MessageInfo & message_info);
+
+  /// Return true if a dedicated thread busy-polls this subscription.
+  /**
+   * Busy-polled subscriptions are skipped when executors collect entities;
+   * their callback runs on the poll thread instead.
+   *
+   * \sa SubscriptionOptionsBase::BusyPollOptions
+   * \return true if a busy poller is attached to this subscription.
+   */
+  RCLCPP_PUBLIC
+  bool
+  is_busy_polled() const;
+
+  /// Attach the busy poller delivering this subscription's messages.
+  /**
+   * Called by create_subscription() when busy polling is requested; the
+   * subscription takes ownership and joins the poll thread on destruction.
+   *
+   * \param[in] busy_poller the poller to attach, replacing any previous one.
+   */
+  RCLCPP_PUBLIC
+  void
+  set_busy_poller(std::shared_ptr<rclcpp::SubscriptionBusyPoller> busy_poller);
+
   /// Check if subscription instance can loan messages.
   /**
    * Depending on the middleware and the message type, this will return true if the middleware
@@ -330,6 +575,20 @@ public:
   std::vector<rclcpp::NetworkFlowEndpoint>
   get_network_flow_endpoints() const;
 
+  /// Get a cached view of the network flow endpoints.
+  /**
+   * Converts and caches the endpoints on first use; later calls return the
+   * cached vector without querying the middleware or allocating, which suits
+   * periodic polling.
+   * The cache is refreshed when the matched publisher count changes, since
+   * that is when the set of flows this subscription receives on can change.
+   *
+   * \return shared pointer to the cached vector of NetworkFlowEndpoint
+   */
+  RCLCPP_PUBLIC
+  std::shared_ptr<const std::vector<rclcpp::NetworkFlowEndpoint>>
+  get_network_flow_endpoints_view() const;
+
   /// Set a callback to be called when each new message is received.
   /**
    * The callback receives a size_t which is the number of messages received
@@ -568,6 +827,36 @@ public:
   rclcpp::ContentFilterOptions
   get_content_filter() const;
 
+  /// Set an rclcpp-side content filter predicate for this subscription.
+  /**
+   * Fallback filter stage for middlewares without native content filtering:
+   * the predicate is evaluated right after each message is taken and messages
+   * it rejects are dropped before the user callback, so they never traverse
+   * the executor dispatch path.
+   * Unlike set_content_filter() the middleware still delivers every message,
+   * so the wait set wakeup itself is not avoided.
+   *
+   * \param[in] predicate Called with the taken message (the ROS message for
+   *   typed subscriptions, a rclcpp::SerializedMessage for serialized ones)
+   *   and its message info; return true to deliver the message, false to
+   *   drop it. Pass nullptr to clear the filter.
+   */
+  RCLCPP_PUBLIC
+  void
+  set_content_filter_predicate(
+    std::function<bool(const void *, const rclcpp::MessageInfo &)> predicate);
+
+  /// Evaluate the rclcpp-side content filter predicate on a taken message.
+  /**
+   * \param[in] message Type erased message to evaluate, must not be nullptr.
+   * \param[in] message_info Message info of the taken message.
+   * \return true if the message should be delivered, which includes the case
+   *   where no predicate is set.
+   */
+  RCLCPP_PUBLIC
+  bool
+  matches_content_filter(const void * message, const rclcpp::MessageInfo & message_info) const;
+
   // DYNAMIC TYPE ==================================================================================
   // TODO(methylDragon): Reorder later
   RCLCPP_PUBLIC
@@ -611,6 +900,14 @@ public:
     rclcpp::MessageInfo & message_info_out);
   // ===============================================================================================
 
+  /// Set the opaque callback group membership handle, see rclcpp::CallbackGroup.
+  /**
+   * \param[in] membership the handle, nullptr to unlink from the group.
+   */
+  RCLCPP_PUBLIC
+  void
+  set_callback_group_membership(std::shared_ptr<void> membership);
+
 protected:
   template<typename EventCallbackT>
   void
@@ -635,17 +932,29 @@ protected:
   void default_incompatible_type_callback(IncompatibleTypeInfo & info) const;
 
   RCLCPP_PUBLIC
-  bool
-  matches_any_intra_process_publishers(const rmw_gid_t * sender_gid) const;
+  void
+  set_on_new_message_callback(rcl_event_callback_t callback, const void * user_data);
 
+  /// Count one callback execution and its duration.
   RCLCPP_PUBLIC
   void
-  set_on_new_message_callback(rcl_event_callback_t callback, const void * user_data);
+  count_callback_executed(std::chrono::steady_clock::time_point callback_start);
+
+  /// Record the pipeline latency of one taken message, called by the take paths.
+  /**
+   * Records rclcpp::MessageInfo::get_pipeline_latency() into the counter
+   * block; a no-op when the middleware does not provide timestamps.
+   */
+  RCLCPP_PUBLIC
+  void
+  count_pipeline_latency(const rclcpp::MessageInfo & message_info);
 
   rclcpp::node_interfaces::NodeBaseInterface * const node_base_;
 
   std::shared_ptr<rcl_node_t> node_handle_;
 
+  std::weak_ptr<rclcpp::Context> weak_context_;
+
   std::recursive_mutex callback_mutex_;
   // It is important to declare on_new_message_callback_ before
   // subscription_handle_, so on destruction the subscription is
@@ -665,13 +974,46 @@ protected:
   uint64_t intra_process_subscription_id_;
   std::shared_ptr<rclcpp::experimental::SubscriptionIntraProcessBase> subscription_intra_process_;
 
+  rclcpp::TopicName interned_topic_name_;
+  rclcpp::InternedQoS interned_actual_qos_;
+
   const SubscriptionEventCallbacks event_callbacks_;
 
+  // Fallback content filter evaluated in-process when the rmw has no native
+  // filtering; shared_ptr so evaluation does not hold the mutex.
+  mutable std::mutex content_filter_predicate_mutex_;
+  std::shared_ptr<const std::function<bool(const void *, const rclcpp::MessageInfo &)>>
+  content_filter_predicate_;
+
+  std::shared_ptr<rclcpp::introspection::EntityCounters> introspection_counters_;
+
 private:
   RCLCPP_DISABLE_COPY(SubscriptionBase)
 
   rosidl_message_type_support_t type_support_;
   DeliveredMessageKind delivered_message_kind_;
+  size_t take_batch_size_ {1};
+  std::chrono::nanoseconds max_message_age_ {0};
+
+  /// Holds the most recent arena-take overflow, see take_serialized_into().
+  rclcpp::SerializedMessage arena_take_fallback_;
+
+  // Owns the busy-poll thread when busy polling is enabled; reset first in
+  // the destructor so the thread is joined before the handles go away.
+  std::shared_ptr<rclcpp::SubscriptionBusyPoller> busy_poller_;
+
+  // Cleared the first time the rmw reports take-sequence as unsupported, so
+  // later batch takes go straight to the one-at-a-time fallback.
+  std::atomic<bool> take_sequence_supported_ {true};
+
+  /// Converted network flow endpoints, see get_network_flow_endpoints_view().
+  mutable std::mutex network_flow_endpoints_mutex_;
+  mutable std::shared_ptr<const std::vector<rclcpp::NetworkFlowEndpoint>>
+  network_flow_endpoints_cache_;
+  mutable size_t network_flow_endpoints_matched_count_ {0};
+
+  // Unlinks this subscription from its callback group on destruction.
+  std::shared_ptr<void> callback_group_membership_;
 
   std::atomic<bool> subscription_in_use_by_wait_set_{false};
   std::atomic<bool> intra_process_subscription_waitable_in_use_by_wait_set_{false};
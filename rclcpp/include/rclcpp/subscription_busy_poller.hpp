@@ -0,0 +1,98 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__SUBSCRIPTION_BUSY_POLLER_HPP_
+#define RCLCPP__SUBSCRIPTION_BUSY_POLLER_HPP_
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+#include "rclcpp/context.hpp"
+#include "rclcpp/macros.hpp"
+#include "rclcpp/subscription_base.hpp"
+#include "rclcpp/thread_attributes.hpp"
+#include "rclcpp/visibility_control.hpp"
+#include "rclcpp/waitable.hpp"
+
+namespace rclcpp
+{
+
+/// Dedicated thread busy-polling one subscription, bypassing executors entirely.
+/**
+ * The poller thread spins in a tight loop checking the subscription's
+ * intra-process buffer and attempting an inter-process take, dispatching the
+ * user callback inline on every hit. There is no wait set, no guard
+ * condition, and no event queue between message arrival and callback, so
+ * delivery latency is bounded by the poll loop iteration time at the cost of
+ * one fully busy core.
+ *
+ * Instances are created by create_subscription() when
+ * SubscriptionOptionsBase::BusyPollOptions::enabled is set; the subscription
+ * is then reported as busy-polled and skipped when executors collect
+ * entities, see SubscriptionBase::is_busy_polled(). The thread attributes
+ * from the options are applied to the poll thread, which is how the thread
+ * is pinned to a reserved core.
+ *
+ * The thread stops when the subscription is destroyed, when the context is
+ * shut down, or when stop() is called.
+ */
+class SubscriptionBusyPoller
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS_NOT_COPYABLE(SubscriptionBusyPoller)
+
+  /// Constructor; starts the poll thread immediately.
+  /**
+   * \param subscription The subscription to poll; only a weak reference is
+   *   kept, so the poller never extends the subscription's lifetime.
+   * \param context Context whose shutdown terminates the poll loop.
+   * \param thread_attributes Attributes (cpu affinity, scheduling policy)
+   *   applied to the poll thread, see rclcpp::ThreadAttributes.
+   */
+  RCLCPP_PUBLIC
+  SubscriptionBusyPoller(
+    rclcpp::SubscriptionBase::SharedPtr subscription,
+    rclcpp::Context::SharedPtr context,
+    const rclcpp::ThreadAttributes & thread_attributes = rclcpp::ThreadAttributes());
+
+  /// Destructor; stops and joins the poll thread.
+  RCLCPP_PUBLIC
+  ~SubscriptionBusyPoller();
+
+  /// Stop the poll loop and join the thread, idempotent.
+  RCLCPP_PUBLIC
+  void
+  stop();
+
+private:
+  RCLCPP_DISABLE_COPY(SubscriptionBusyPoller)
+
+  /// Poll loop body, runs on the dedicated thread.
+  void
+  run(const rclcpp::ThreadAttributes & thread_attributes);
+
+  std::weak_ptr<rclcpp::SubscriptionBase> subscription_;
+  // Cached at construction: looking the waitable up through the
+  // IntraProcessManager takes a lock, which has no place in the poll loop.
+  // Nullptr when the subscription has no intra-process buffer.
+  rclcpp::Waitable::SharedPtr intra_process_waitable_;
+  rclcpp::Context::SharedPtr context_;
+  std::atomic<bool> spinning_ {true};
+  std::thread thread_;
+};
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__SUBSCRIPTION_BUSY_POLLER_HPP_
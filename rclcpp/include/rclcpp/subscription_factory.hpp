@@ -18,6 +18,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 #include "rcl/subscription.h"
@@ -28,6 +29,7 @@
 #include "rclcpp/get_message_type_support_handle.hpp"
 #include "rclcpp/node_interfaces/node_base_interface.hpp"
 #include "rclcpp/qos.hpp"
+#include "rclcpp/sealed_subscription.hpp"
 #include "rclcpp/subscription.hpp"
 #include "rclcpp/subscription_options.hpp"
 #include "rclcpp/subscription_traits.hpp"
@@ -90,6 +92,48 @@ create_subscription_factory(
   auto allocator = options.get_allocator();
 
   using rclcpp::AnySubscriptionCallback;
+
+  // Sealed dispatch: when the callback type is statically compatible and the
+  // default subscription class is requested, create a SealedSubscription whose
+  // handle_message() calls the callback directly, see sealed_subscription.hpp.
+  if constexpr (std::is_same_v<SubscriptionT, rclcpp::Subscription<MessageT, AllocatorT>> &&
+    std::is_same_v<MessageT, ROSMessageType> &&
+    rclcpp::detail::is_sealable_callback<std::decay_t<CallbackT>, ROSMessageType>::value)
+  {
+    // Topic statistics are handled by the generic class and are not sealable.
+    if (options.use_sealed_dispatch && nullptr == subscription_topic_stats) {
+      using DirectCallbackT = std::decay_t<CallbackT>;
+      using SealedSubscriptionT = rclcpp::SealedSubscription<MessageT, DirectCallbackT, AllocatorT>;
+      // Copy the callback before the type-erased wrapper consumes it; the
+      // base class still needs the wrapper for intra-process delivery.
+      DirectCallbackT direct_callback(callback);
+      AnySubscriptionCallback<MessageT, AllocatorT> sealed_any_callback(*allocator);
+      sealed_any_callback.set(std::forward<CallbackT>(callback));
+
+      return SubscriptionFactory {
+        [options, msg_mem_strat, sealed_any_callback,
+          direct_callback = std::move(direct_callback)](
+          rclcpp::node_interfaces::NodeBaseInterface * node_base,
+          const std::string & topic_name,
+          const rclcpp::QoS & qos
+        ) -> std::shared_ptr<SealedSubscriptionT>
+        {
+          auto sub = std::make_shared<SealedSubscriptionT>(
+            node_base,
+            rclcpp::get_message_type_support_handle<MessageT>(),
+            topic_name,
+            qos,
+            sealed_any_callback,
+            direct_callback,
+            options,
+            msg_mem_strat);
+          sub->post_init_setup(node_base, qos, options);
+          return sub;
+        }
+      };
+    }
+  }
+
   AnySubscriptionCallback<MessageT, AllocatorT> any_subscription_callback(*allocator);
   any_subscription_callback.set(std::forward<CallbackT>(callback));
 
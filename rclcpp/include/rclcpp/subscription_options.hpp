@@ -23,12 +23,14 @@
 
 #include "rclcpp/callback_group.hpp"
 #include "rclcpp/detail/rmw_implementation_specific_subscription_payload.hpp"
+#include "rclcpp/intra_process_buffer_full_policy.hpp"
 #include "rclcpp/intra_process_buffer_type.hpp"
 #include "rclcpp/intra_process_setting.hpp"
 #include "rclcpp/qos.hpp"
 #include "rclcpp/event_handler.hpp"
 #include "rclcpp/qos_overriding_options.hpp"
 #include "rclcpp/subscription_content_filter_options.hpp"
+#include "rclcpp/thread_attributes.hpp"
 #include "rclcpp/topic_statistics_state.hpp"
 #include "rclcpp/visibility_control.hpp"
 
@@ -44,6 +46,17 @@ struct SubscriptionOptionsBase
   /// Whether or not to use default callbacks when user doesn't supply any in event_callbacks
   bool use_default_callbacks = true;
 
+  /// Slim profile: construct only the core subscription.
+  /**
+   * Skips the optional per-entity machinery: no QoS event handlers are
+   * created, neither the defaults nor user-supplied ones (event_callbacks
+   * must be empty when this is set), and topic statistics stay off
+   * regardless of the node default (explicitly enabling them is an error).
+   * For fleets where most entities use none of the optional features this
+   * trims per-entity footprint and construction time.
+   */
+  bool slim = false;
+
   /// True to ignore local publications.
   bool ignore_local_publications = false;
 
@@ -61,6 +74,14 @@ struct SubscriptionOptionsBase
   /// Setting the data-type stored in the intraprocess buffer
   IntraProcessBufferType intra_process_buffer_type = IntraProcessBufferType::CallbackDefault;
 
+  /// What the intraprocess buffer does with an incoming message when it is full.
+  IntraProcessBufferFullPolicy intra_process_buffer_full_policy =
+    IntraProcessBufferFullPolicy::OverwriteOldest;
+
+  /// How long IntraProcessBufferFullPolicy::Block waits for room in the buffer.
+  /** Non-positive values wait indefinitely. Ignored by the other policies. */
+  std::chrono::nanoseconds intra_process_buffer_full_timeout = std::chrono::nanoseconds(-1);
+
   /// Optional RMW implementation specific payload to be used during creation of the subscription.
   std::shared_ptr<rclcpp::detail::RMWImplementationSpecificSubscriptionPayload>
   rmw_implementation_payload = nullptr;
@@ -77,6 +98,20 @@ struct SubscriptionOptionsBase
     // Topic statistics publication period in ms. Defaults to one second.
     // Only values greater than zero are allowed.
     std::chrono::milliseconds publish_period{std::chrono::seconds(1)};
+
+    // Process one out of every sample_rate received messages when collecting
+    // statistics. Defaults to 1, i.e. every message; zero is not allowed.
+    // Sampling keeps collection cheap on high-rate topics, at the cost of
+    // proportionally fewer samples per window and a message period statistic
+    // that measures the period between sampled messages.
+    uint64_t sample_rate = 1;
+
+    // Feed one process-wide statistics sink per publish_topic instead of
+    // creating a publisher and a timer per subscription. The sink publishes
+    // the consolidated batch on one timer, created on the node of the first
+    // aggregating subscription; its publish_period applies. Defaults to
+    // disabled, i.e. standalone per-subscription publishing.
+    bool aggregate = false;
   };
 
   TopicStatisticsOptions topic_stats_options;
@@ -84,6 +119,71 @@ struct SubscriptionOptionsBase
   QosOverridingOptions qos_overriding_options;
 
   ContentFilterOptions content_filter_options;
+
+  /// Maximum number of pending messages drained in a single executor activation.
+  /**
+   * The default of 1 preserves the historical behavior of one take and one
+   * callback invocation per executor wakeup. Raising it lets the executor
+   * drain up to this many pending messages (both from the middleware and from
+   * the intra-process buffer) once the subscription is ready, amortizing the
+   * wait/take round trip on high-rate topics. Note that with values greater
+   * than 1 a busy subscription can delay other entities sharing the executor
+   * for up to a full batch.
+   */
+  size_t take_batch_size = 1;
+
+  /// Maximum age a message may have when dispatched before it is shed.
+  /**
+   * When positive, a message whose source timestamp lies further than this
+   * in the past at dispatch time is dropped without invoking the callback,
+   * and the subscription's shed_messages introspection counter is
+   * incremented. Under overload this spends cycles only on input that is
+   * still actionable instead of working through a stale backlog in queue
+   * order.
+   *
+   * The age is measured against the system clock, so publisher and
+   * subscriber clocks must agree for inter-host topics. Messages without a
+   * source timestamp and messages delivered through the intra-process
+   * buffer (which carries no timestamps) are never shed. Zero, the
+   * default, disables shedding.
+   */
+  std::chrono::nanoseconds max_message_age = std::chrono::nanoseconds::zero();
+
+  /// Dispatch inter-process messages through a direct, inlinable callback call.
+  /**
+   * When true and the callback type is statically known to be compatible,
+   * create_subscription() instantiates a sealed subscription class whose
+   * handle_message() calls the user callback directly, bypassing the
+   * AnySubscriptionCallback variant visit and the std::function indirection.
+   * Subscriptions with topic statistics, type-adapted or serialized message
+   * types, custom subscription classes, or callback signatures outside the
+   * sealable set fall back to the generic dispatch path.
+   *
+   * \sa rclcpp::SealedSubscription
+   */
+  bool use_sealed_dispatch = false;
+
+  /// Options to busy-poll the subscription on a dedicated thread.
+  struct BusyPollOptions
+  {
+    /// Deliver messages from a dedicated busy-poll thread instead of an executor.
+    /**
+     * When true, create_subscription() starts a thread that spins on the
+     * intra-process buffer and the middleware take with no wait set, guard
+     * condition, or event queue in between, and the subscription is excluded
+     * from executor entity collection. The callback then runs on the poll
+     * thread, which occupies a full core; reserve this for the few topics
+     * where microseconds of delivery latency matter.
+     *
+     * \sa rclcpp::SubscriptionBusyPoller
+     */
+    bool enabled = false;
+
+    /// Attributes applied to the poll thread, typically a cpu pin.
+    rclcpp::ThreadAttributes thread_attributes;
+  };
+
+  BusyPollOptions busy_poll_options;
 };
 
 /// Structure containing optional configuration for Subscriptions.
@@ -0,0 +1,279 @@
+// Copyright 2024 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__SYNCHRONIZED_GROUP_HPP_
+#define RCLCPP__SYNCHRONIZED_GROUP_HPP_
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "rcl/time.h"
+
+#include "rclcpp/create_subscription.hpp"
+#include "rclcpp/macros.hpp"
+#include "rclcpp/qos.hpp"
+#include "rclcpp/subscription.hpp"
+#include "rclcpp/time.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+
+/// Trait yielding the time stamp of a message, used for synchronization.
+/**
+ * The default expects a message with a std_msgs-style header and returns
+ * `message.header.stamp` as nanoseconds.
+ * Specialize this for message types which carry their stamp elsewhere.
+ */
+template<typename MessageT, typename = void>
+struct MessageStamp
+{
+  static rcl_time_point_value_t
+  value(const MessageT & message)
+  {
+    return rclcpp::Time(message.header.stamp).nanoseconds();
+  }
+};
+
+/// Options for SynchronizedGroup.
+struct SynchronizedGroupOptions
+{
+  /// Maximum stamp spread within one aligned set.
+  std::chrono::nanoseconds slop = std::chrono::milliseconds(10);
+  /// Per-topic depth of pending messages; the oldest is dropped on overflow.
+  size_t queue_depth = 10;
+};
+
+/// Group of subscriptions delivering time-aligned message sets to one callback.
+/**
+ * The group subscribes to one topic per message type and buffers the arriving
+ * messages, as shared pointers only, in small per-topic queues under a single
+ * lock. Whenever every topic has at least one pending message, the group
+ * picks per topic the message closest to the newest of the queue heads, and
+ * if the stamps of that candidate set lie within the configured slop of each
+ * other, the callback is invoked once with the whole aligned tuple; messages
+ * which can no longer participate in any future set are dropped.
+ *
+ * Compared to stacking an external synchronizer on top of plain
+ * subscriptions, this removes a layer of queues and per-topic locking and
+ * never copies a payload: with intra-process communication enabled the
+ * callback receives the very shared pointers the publishers handed in.
+ * Alignment runs inline in the callback of whichever subscription completes
+ * a set, so an aligned set costs one executor activation and no hand-off.
+ *
+ * Stamps are obtained through the rclcpp::MessageStamp trait, which by
+ * default reads `header.stamp`.
+ *
+ * \tparam MessageTs The message type of each synchronized topic, in order.
+ */
+template<typename ... MessageTs>
+class SynchronizedGroup
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS_NOT_COPYABLE(SynchronizedGroup)
+
+  static constexpr size_t kTopicCount = sizeof...(MessageTs);
+  static_assert(kTopicCount >= 2u, "synchronizing fewer than two topics is pointless");
+
+  using CallbackT = std::function<void (std::shared_ptr<const MessageTs>...)>;
+
+  /// Construct the group, creating one subscription per topic.
+  /**
+   * \param[in] node The node to create the subscriptions on.
+   * \param[in] topic_names One topic name per message type, in order.
+   * \param[in] qos QoS applied to every subscription of the group.
+   * \param[in] callback Called with each aligned tuple of messages.
+   * \param[in] options Alignment slop and queue depth, see
+   *   SynchronizedGroupOptions.
+   */
+  template<typename NodeT>
+  SynchronizedGroup(
+    NodeT && node,
+    const std::array<std::string, kTopicCount> & topic_names,
+    const rclcpp::QoS & qos,
+    CallbackT callback,
+    const SynchronizedGroupOptions & options = SynchronizedGroupOptions())
+  : callback_(std::move(callback)),
+    slop_(options.slop.count()),
+    queue_depth_(options.queue_depth)
+  {
+    if (nullptr == callback_) {
+      throw std::invalid_argument("callback is nullptr");
+    }
+    if (0u == queue_depth_) {
+      throw std::invalid_argument("queue_depth must be positive");
+    }
+    this->create_subscriptions(
+      std::forward<NodeT>(node), topic_names, qos, std::index_sequence_for<MessageTs...>());
+  }
+
+private:
+  RCLCPP_DISABLE_COPY(SynchronizedGroup)
+
+  template<typename MessageT>
+  struct TopicQueue
+  {
+    std::deque<std::pair<rcl_time_point_value_t, std::shared_ptr<const MessageT>>> entries;
+  };
+
+  template<typename NodeT, size_t... Is>
+  void
+  create_subscriptions(
+    NodeT && node,
+    const std::array<std::string, kTopicCount> & topic_names,
+    const rclcpp::QoS & qos,
+    std::index_sequence<Is...>)
+  {
+    ((std::get<Is>(subscriptions_) =
+      rclcpp::create_subscription<std::tuple_element_t<Is, std::tuple<MessageTs...>>>(
+        node, topic_names[Is], qos,
+        [this](std::shared_ptr<const std::tuple_element_t<Is, std::tuple<MessageTs...>>> message)
+        {
+          this->template handle_message<Is>(std::move(message));
+        })), ...);
+  }
+
+  template<size_t I, typename MessageT>
+  void
+  handle_message(std::shared_ptr<const MessageT> message)
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto & entries = std::get<I>(queues_).entries;
+    if (entries.size() >= queue_depth_) {
+      entries.pop_front();
+    }
+    rcl_time_point_value_t stamp = MessageStamp<MessageT>::value(*message);
+    entries.emplace_back(stamp, std::move(message));
+    this->match_and_dispatch(lock);
+  }
+
+  /// Emit every currently completable aligned set, called with the lock held.
+  void
+  match_and_dispatch(std::unique_lock<std::mutex> & lock)
+  {
+    while (true) {
+      std::array<rcl_time_point_value_t, kTopicCount> front_stamps;
+      if (!this->collect_front_stamps(front_stamps, std::index_sequence_for<MessageTs...>())) {
+        return;  // at least one topic has nothing pending
+      }
+      // The newest queue head is the pivot: every older candidate set would
+      // leave that head unmatched forever, so it is the only one to try.
+      rcl_time_point_value_t pivot =
+        *std::max_element(front_stamps.begin(), front_stamps.end());
+      std::array<size_t, kTopicCount> selected;
+      std::array<rcl_time_point_value_t, kTopicCount> selected_stamps;
+      this->select_closest(
+        pivot, selected, selected_stamps, std::index_sequence_for<MessageTs...>());
+      auto minmax = std::minmax_element(selected_stamps.begin(), selected_stamps.end());
+      if (*minmax.second - *minmax.first <= slop_) {
+        auto messages =
+          this->take_selected(selected, std::index_sequence_for<MessageTs...>());
+        // Invoke without the lock, so the callback may not touch the group's
+        // own state but can publish or create entities freely.
+        lock.unlock();
+        std::apply(callback_, std::move(messages));
+        lock.lock();
+        continue;
+      }
+      // No set fits around this pivot; the overall oldest message can never
+      // be part of a future set either, drop it and retry.
+      this->drop_oldest(
+        static_cast<size_t>(
+          std::min_element(front_stamps.begin(), front_stamps.end()) - front_stamps.begin()),
+        std::index_sequence_for<MessageTs...>());
+    }
+  }
+
+  template<size_t... Is>
+  bool
+  collect_front_stamps(
+    std::array<rcl_time_point_value_t, kTopicCount> & out, std::index_sequence<Is...>)
+  {
+    if ((std::get<Is>(queues_).entries.empty() || ...)) {
+      return false;
+    }
+    ((out[Is] = std::get<Is>(queues_).entries.front().first), ...);
+    return true;
+  }
+
+  template<size_t... Is>
+  void
+  select_closest(
+    rcl_time_point_value_t pivot,
+    std::array<size_t, kTopicCount> & selected,
+    std::array<rcl_time_point_value_t, kTopicCount> & selected_stamps,
+    std::index_sequence<Is...>)
+  {
+    auto distance = [pivot](rcl_time_point_value_t stamp) {
+        return stamp > pivot ? stamp - pivot : pivot - stamp;
+      };
+    auto select_one = [this, &selected, &selected_stamps, &distance](auto index_constant) {
+        constexpr size_t index = decltype(index_constant)::value;
+        const auto & entries = std::get<index>(queues_).entries;
+        size_t best = 0u;
+        for (size_t ii = 1u; ii < entries.size(); ++ii) {
+          if (distance(entries[ii].first) < distance(entries[best].first)) {
+            best = ii;
+          }
+        }
+        selected[index] = best;
+        selected_stamps[index] = entries[best].first;
+      };
+    (select_one(std::integral_constant<size_t, Is>()), ...);
+  }
+
+  template<size_t... Is>
+  std::tuple<std::shared_ptr<const MessageTs>...>
+  take_selected(const std::array<size_t, kTopicCount> & selected, std::index_sequence<Is...>)
+  {
+    std::tuple<std::shared_ptr<const MessageTs>...> messages {
+      std::move(std::get<Is>(queues_).entries[selected[Is]].second)...};
+    // Everything up to and including the consumed entry is spent.
+    (std::get<Is>(queues_).entries.erase(
+      std::get<Is>(queues_).entries.begin(),
+      std::get<Is>(queues_).entries.begin() + static_cast<ptrdiff_t>(selected[Is]) + 1), ...);
+    return messages;
+  }
+
+  template<size_t... Is>
+  void
+  drop_oldest(size_t queue_index, std::index_sequence<Is...>)
+  {
+    ((Is == queue_index ? std::get<Is>(queues_).entries.pop_front() : void()), ...);
+  }
+
+  CallbackT callback_;
+  const rcl_time_point_value_t slop_;
+  const size_t queue_depth_;
+
+  /// Guards the queues; intentionally one lock for the whole group.
+  std::mutex mutex_;
+  std::tuple<TopicQueue<MessageTs>...> queues_;
+  std::tuple<typename rclcpp::Subscription<MessageTs>::SharedPtr...> subscriptions_;
+};
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__SYNCHRONIZED_GROUP_HPP_
@@ -0,0 +1,77 @@
+// Copyright 2024 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__THREAD_ATTRIBUTES_HPP_
+#define RCLCPP__THREAD_ATTRIBUTES_HPP_
+
+#include <string>
+#include <vector>
+
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+
+/// Scheduling class to request for an executor worker thread.
+enum class ThreadSchedulingPolicy
+{
+  /// Keep whatever the OS assigned to the spawning thread.
+  Inherit,
+  /// Normal time-sharing scheduling (SCHED_OTHER on Linux).
+  Other,
+  /// Real-time FIFO scheduling (SCHED_FIFO on Linux), requires privileges.
+  FIFO,
+  /// Real-time round-robin scheduling (SCHED_RR on Linux), requires privileges.
+  RoundRobin
+};
+
+/// Attributes applied to threads spawned by executors and the timers manager.
+/**
+ * All fields are optional: default-constructed attributes leave the thread
+ * untouched. Fields that the current platform cannot honor are ignored with a
+ * warning, they never cause thread creation to fail.
+ *
+ * NUMA placement is expressed through the cpu affinity set: pinning a thread
+ * to the cores of one node keeps its allocations and cache footprint local
+ * without requiring a libnuma dependency in rclcpp.
+ */
+struct ThreadAttributes
+{
+  /// CPU indices this thread may run on; empty means no affinity is applied.
+  std::vector<size_t> cpu_set;
+
+  /// Scheduling policy for the thread.
+  ThreadSchedulingPolicy scheduling_policy {ThreadSchedulingPolicy::Inherit};
+
+  /// Scheduling priority, only used with FIFO and RoundRobin policies.
+  int priority {0};
+
+  /// Thread name, truncated to the platform limit (15 chars on Linux);
+  /// empty means the name is left unchanged.
+  std::string name;
+};
+
+/// Apply the given attributes to the calling thread.
+/**
+ * Best effort: unsupported fields are skipped and failures (e.g. missing
+ * privileges for a real-time policy) are logged as warnings.
+ * \param[in] attributes the attributes to apply.
+ */
+RCLCPP_PUBLIC
+void
+apply_attributes_to_current_thread(const ThreadAttributes & attributes);
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__THREAD_ATTRIBUTES_HPP_
@@ -27,6 +27,7 @@ namespace rclcpp
 {
 
 class Clock;
+class UncheckedTime;
 
 class Time
 {
@@ -210,11 +211,126 @@ public:
   rcl_clock_type_t
   get_clock_type() const;
 
+  /// Get an unchecked arithmetic view of this time point.
+  /** \sa UncheckedTime */
+  UncheckedTime
+  unchecked() const noexcept;
+
 private:
   rcl_time_point_t rcl_time_;
   friend Clock;  // Allow clock to manipulate internal data
 };
 
+/// Lightweight nanosecond time-point arithmetic without runtime checks.
+/**
+ * Time's operators verify clock-type compatibility and check for overflow
+ * with throws on every operation, which keeps tight numeric loops from
+ * vectorizing. UncheckedTime keeps Time's type safety — a time point and a
+ * duration still cannot be confused — but every operation is noexcept, with
+ * no throwing paths: clock types are not compared and overflow wraps like
+ * two's complement arithmetic. Obtain one with Time::unchecked(), do the bulk
+ * arithmetic, and convert back with checked() at the boundary; the clock
+ * type is carried through unchanged.
+ */
+class UncheckedTime
+{
+public:
+  explicit constexpr UncheckedTime(
+    rcl_time_point_value_t nanoseconds,
+    rcl_clock_type_t clock_type = RCL_SYSTEM_TIME) noexcept
+  : nanoseconds_(nanoseconds), clock_type_(clock_type)
+  {}
+
+  /// Get the nanoseconds since epoch.
+  constexpr rcl_time_point_value_t
+  nanoseconds() const noexcept
+  {
+    return nanoseconds_;
+  }
+
+  /// Get the clock type.
+  constexpr rcl_clock_type_t
+  get_clock_type() const noexcept
+  {
+    return clock_type_;
+  }
+
+  /// Convert back to a checked Time.
+  Time
+  checked() const
+  {
+    return Time(nanoseconds_, clock_type_);
+  }
+
+  constexpr bool operator==(UncheckedTime rhs) const noexcept
+  {
+    return nanoseconds_ == rhs.nanoseconds_;
+  }
+  constexpr bool operator!=(UncheckedTime rhs) const noexcept
+  {
+    return nanoseconds_ != rhs.nanoseconds_;
+  }
+  constexpr bool operator<(UncheckedTime rhs) const noexcept
+  {
+    return nanoseconds_ < rhs.nanoseconds_;
+  }
+  constexpr bool operator<=(UncheckedTime rhs) const noexcept
+  {
+    return nanoseconds_ <= rhs.nanoseconds_;
+  }
+  constexpr bool operator>=(UncheckedTime rhs) const noexcept
+  {
+    return nanoseconds_ >= rhs.nanoseconds_;
+  }
+  constexpr bool operator>(UncheckedTime rhs) const noexcept
+  {
+    return nanoseconds_ > rhs.nanoseconds_;
+  }
+
+  constexpr UncheckedTime operator+(UncheckedDuration rhs) const noexcept
+  {
+    return UncheckedTime(
+      detail::wrapping_nanoseconds_add(nanoseconds_, rhs.nanoseconds()), clock_type_);
+  }
+  constexpr UncheckedTime operator-(UncheckedDuration rhs) const noexcept
+  {
+    return UncheckedTime(
+      detail::wrapping_nanoseconds_subtract(nanoseconds_, rhs.nanoseconds()), clock_type_);
+  }
+  constexpr UncheckedDuration operator-(UncheckedTime rhs) const noexcept
+  {
+    return UncheckedDuration(
+      detail::wrapping_nanoseconds_subtract(nanoseconds_, rhs.nanoseconds_));
+  }
+
+  UncheckedTime & operator+=(UncheckedDuration rhs) noexcept
+  {
+    nanoseconds_ = detail::wrapping_nanoseconds_add(nanoseconds_, rhs.nanoseconds());
+    return *this;
+  }
+  UncheckedTime & operator-=(UncheckedDuration rhs) noexcept
+  {
+    nanoseconds_ = detail::wrapping_nanoseconds_subtract(nanoseconds_, rhs.nanoseconds());
+    return *this;
+  }
+
+private:
+  rcl_time_point_value_t nanoseconds_;
+  rcl_clock_type_t clock_type_;
+};
+
+inline UncheckedTime
+Time::unchecked() const noexcept
+{
+  return UncheckedTime(rcl_time_.nanoseconds, rcl_time_.clock_type);
+}
+
+constexpr UncheckedTime
+operator+(UncheckedDuration lhs, UncheckedTime rhs) noexcept
+{
+  return rhs + lhs;
+}
+
 /**
  * \throws std::overflow_error if addition leads to overflow
  */
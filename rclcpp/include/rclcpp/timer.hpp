@@ -27,6 +27,7 @@
 #include "rclcpp/clock.hpp"
 #include "rclcpp/context.hpp"
 #include "rclcpp/function_traits.hpp"
+#include "rclcpp/introspection.hpp"
 #include "rclcpp/macros.hpp"
 #include "rclcpp/rate.hpp"
 #include "rclcpp/utilities.hpp"
@@ -96,6 +97,41 @@ public:
   void
   reset();
 
+  /// Exchange the timer period, rescheduling the timer in place.
+  /**
+   * The next trigger time is recomputed using the new period, without
+   * removing and recreating the timer.
+   * Entities tracking this timer (e.g. rclcpp::experimental::TimersManager)
+   * are notified through the on-reset callback so they can lazily fix up
+   * their schedule instead of removing and re-adding the timer.
+   *
+   * \param period the new period.
+   * \return the previous period.
+   * \throws std::runtime_error if the rcl_timer_exchange_period returns a failure
+   */
+  RCLCPP_PUBLIC
+  std::chrono::nanoseconds
+  exchange_period(std::chrono::nanoseconds period);
+
+  /// Shift the timer's schedule by a fixed phase offset.
+  /**
+   * Delays the first trigger by the given phase, so the timer fires at
+   * creation + phase + k * period instead of creation + k * period.
+   * Offsetting timers of equal period de-synchronizes them, flattening the
+   * load spike that results when they all fire in the same instant.
+   *
+   * Must be called before the timer first fires; calling it later re-arms
+   * the timer with the phase applied from the current time.
+   * Calling reset() before the first phased trigger re-applies the phase.
+   *
+   * \param phase the offset, typically within [0, period).
+   * \throws std::invalid_argument if phase is negative
+   * \throws std::runtime_error if the underlying rcl calls fail
+   */
+  RCLCPP_PUBLIC
+  void
+  set_phase(std::chrono::nanoseconds phase);
+
   /// Indicate that we're about to execute the callback.
   /**
    * The multithreaded executor takes advantage of this to avoid scheduling
@@ -116,6 +152,43 @@ public:
   std::shared_ptr<const rcl_timer_t>
   get_timer_handle();
 
+  /// Get the introspection counter block for this timer.
+  /** \return The counter block, see rclcpp::introspection::EntityCounters. */
+  RCLCPP_PUBLIC
+  std::shared_ptr<rclcpp::introspection::EntityCounters>
+  get_introspection_counters() const;
+
+  /// Plain copy of this timer's scheduling statistics.
+  struct Stats
+  {
+    /// Callback executions.
+    uint64_t callbacks;
+    /// Cumulative callback execution time, in nanoseconds.
+    uint64_t callback_duration_ns;
+    /// Cumulative activation jitter, i.e. how late fires were, in nanoseconds.
+    uint64_t jitter_sum_ns;
+    /// Largest single activation jitter, in nanoseconds.
+    uint64_t jitter_max_ns;
+    /// Callbacks whose duration exceeded the timer period.
+    uint64_t overruns;
+  };
+
+  /// Get the scheduling statistics for this timer.
+  /**
+   * Every fire records how late the callback started relative to the time
+   * the timer was scheduled to fire (activation jitter), and every callback
+   * whose duration exceeds the timer period counts as an overrun. The mean
+   * jitter over the timer's lifetime is jitter_sum_ns / callbacks.
+   *
+   * The counters are kept in relaxed atomics, so reading them concurrently
+   * with a firing timer is safe but yields no consistent cut across fields.
+   *
+   * \return a plain copy of the statistics.
+   */
+  RCLCPP_PUBLIC
+  Stats
+  get_stats() const;
+
   /// Check how long the timer has until its next scheduled callback.
   /**
    * \return A std::chrono::duration representing the relative time until the next callback
@@ -179,6 +252,14 @@ public:
   void
   clear_on_reset_callback();
 
+  /// Set the opaque callback group membership handle, see rclcpp::CallbackGroup.
+  /**
+   * \param[in] membership the handle, nullptr to unlink from the group.
+   */
+  RCLCPP_PUBLIC
+  void
+  set_callback_group_membership(std::shared_ptr<void> membership);
+
 protected:
   std::recursive_mutex callback_mutex_;
   // Declare callback before timer_handle_, so on destruction
@@ -193,9 +274,41 @@ protected:
 
   std::atomic<bool> in_use_by_wait_set_{false};
 
+  std::shared_ptr<rclcpp::introspection::EntityCounters> introspection_counters_;
+
+  // Unlinks this timer from its callback group on destruction.
+  std::shared_ptr<void> callback_group_membership_;
+
   RCLCPP_PUBLIC
   void
   set_on_reset_callback(rcl_event_callback_t callback, const void * user_data);
+
+  /// Count one callback execution, its duration, and overruns of the period.
+  RCLCPP_PUBLIC
+  void
+  count_callback_executed(std::chrono::steady_clock::time_point callback_start);
+
+  /// Record how late this fire is relative to its scheduled time.
+  /**
+   * Must be called before rcl_timer_call(), which advances the schedule.
+   */
+  RCLCPP_PUBLIC
+  void
+  count_timer_fired();
+
+  /// Restore the original period after the first phased trigger.
+  /**
+   * Must be called after rcl_timer_call(); a no-op unless set_phase() armed
+   * a phase offset that has not been consumed yet.
+   */
+  RCLCPP_PUBLIC
+  void
+  clear_phase_offset();
+
+private:
+  /// Period to restore once the phased first trigger fired.
+  int64_t phase_restore_period_ {0};
+  std::atomic<bool> phase_pending_ {false};
 };
 
 
@@ -259,6 +372,7 @@ public:
   bool
   call() override
   {
+    this->count_timer_fired();
     rcl_ret_t ret = rcl_timer_call(timer_handle_.get());
     if (ret == RCL_RET_TIMER_CANCELED) {
       return false;
@@ -266,6 +380,7 @@ public:
     if (ret != RCL_RET_OK) {
       throw std::runtime_error("Failed to notify timer that callback occurred");
     }
+    this->clear_phase_offset();
     return true;
   }
 
@@ -276,7 +391,9 @@ public:
   execute_callback() override
   {
     TRACETOOLS_TRACEPOINT(callback_start, reinterpret_cast<const void *>(&callback_), false);
+    const auto callback_start_time = std::chrono::steady_clock::now();
     execute_callback_delegate<>();
+    this->count_callback_executed(callback_start_time);
     TRACETOOLS_TRACEPOINT(callback_end, reinterpret_cast<const void *>(&callback_));
   }
 
@@ -0,0 +1,107 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__TOPIC_NAME_HPP_
+#define RCLCPP__TOPIC_NAME_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+
+/// An immutable, interned fully-qualified topic or service name.
+/**
+ * Names are interned in a process-wide table: instances built from equal
+ * strings share one storage record, so the hash is computed once per distinct
+ * name and equality checks on hot paths reduce to a pointer comparison.
+ * Default-constructed instances are empty and compare equal to each other.
+ *
+ * Entities intern their fully-qualified name once at creation, see
+ * PublisherBase::get_interned_topic_name() and
+ * SubscriptionBase::get_interned_topic_name().
+ */
+class TopicName
+{
+public:
+  /// Construct an empty name.
+  RCLCPP_PUBLIC
+  TopicName() = default;
+
+  /// Intern the given fully-qualified name.
+  RCLCPP_PUBLIC
+  explicit TopicName(const std::string & name);
+
+  /// Return the interned string, or an empty string for an empty name.
+  RCLCPP_PUBLIC
+  const std::string &
+  str() const;
+
+  /// Return the interned string as a null-terminated C string.
+  RCLCPP_PUBLIC
+  const char *
+  c_str() const;
+
+  /// Return the hash computed when the name was interned.
+  RCLCPP_PUBLIC
+  size_t
+  hash() const;
+
+  RCLCPP_PUBLIC
+  bool
+  empty() const;
+
+  /// Compare the interned records by pointer.
+  RCLCPP_PUBLIC
+  bool
+  operator==(const TopicName & other) const;
+
+  RCLCPP_PUBLIC
+  bool
+  operator!=(const TopicName & other) const;
+
+private:
+  struct Interned
+  {
+    std::string name;
+    size_t hash;
+  };
+
+  RCLCPP_LOCAL
+  static std::shared_ptr<const Interned>
+  intern(const std::string & name);
+
+  std::shared_ptr<const Interned> interned_;
+};
+
+}  // namespace rclcpp
+
+namespace std
+{
+template<>
+struct hash<rclcpp::TopicName>
+{
+  size_t
+  operator()(const rclcpp::TopicName & name) const
+  {
+    return name.hash();
+  }
+};
+}  // namespace std
+
+#endif  // RCLCPP__TOPIC_NAME_HPP_
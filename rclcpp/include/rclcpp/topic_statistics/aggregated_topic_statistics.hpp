@@ -0,0 +1,119 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__TOPIC_STATISTICS__AGGREGATED_TOPIC_STATISTICS_HPP_
+#define RCLCPP__TOPIC_STATISTICS__AGGREGATED_TOPIC_STATISTICS_HPP_
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "rclcpp/publisher.hpp"
+#include "rclcpp/timer.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+#include "statistics_msgs/msg/metrics_message.hpp"
+
+namespace rclcpp
+{
+namespace topic_statistics
+{
+
+/// Producer of topic statistics messages, fed into an AggregatedTopicStatisticsSink.
+class AggregatedTopicStatisticsSource
+{
+public:
+  virtual ~AggregatedTopicStatisticsSource() = default;
+
+  /// Return the statistics messages of the current window and reset the measurements.
+  virtual std::vector<statistics_msgs::msg::MetricsMessage>
+  collect_and_reset_measurements() = 0;
+};
+
+/// Process-wide sink publishing the statistics of many subscriptions in one batch.
+/**
+ * The per-subscription statistics machinery creates one publisher and one
+ * periodic timer per subscription, which does not scale to containers with
+ * hundreds of statistics-enabled subscriptions. In aggregation mode (see
+ * SubscriptionOptionsBase::TopicStatisticsOptions::aggregate) all
+ * subscriptions publishing to the same statistics topic share one sink: the
+ * subscriptions keep collecting into their own accumulators, and the sink's
+ * single timer drains every registered source and publishes the consolidated
+ * batch through its single publisher.
+ *
+ * The sink's publisher and timer are created on the node of the first
+ * subscription that requested aggregation for the topic; the timer only
+ * fires while that node is spun by an executor. Sources are held weakly and
+ * dropped once the owning subscription is destroyed; the sink itself lives
+ * as long as any of its sources.
+ */
+class AggregatedTopicStatisticsSink
+{
+public:
+  /// Construct a sink publishing through the given publisher.
+  /**
+   * \param[in] publisher publisher for the consolidated statistics batch.
+   * \throws std::invalid_argument if publisher is nullptr.
+   */
+  RCLCPP_PUBLIC
+  explicit AggregatedTopicStatisticsSink(
+    rclcpp::Publisher<statistics_msgs::msg::MetricsMessage>::SharedPtr publisher);
+
+  RCLCPP_PUBLIC
+  virtual ~AggregatedTopicStatisticsSink();
+
+  /// Register a statistics source; it is held weakly.
+  RCLCPP_PUBLIC
+  void
+  add_source(std::weak_ptr<AggregatedTopicStatisticsSource> source);
+
+  /// Set the timer firing publish_batch(), owned by this sink.
+  RCLCPP_PUBLIC
+  void
+  set_publisher_timer(rclcpp::TimerBase::SharedPtr publisher_timer);
+
+  /// Drain every live source and publish the consolidated batch.
+  /**
+   * Expired sources are pruned in the same pass.
+   */
+  RCLCPP_PUBLIC
+  void
+  publish_batch();
+
+  /// Return the process-wide sink for the given statistics topic, making one if needed.
+  /**
+   * \param[in] publish_topic the statistics topic keying the sink.
+   * \param[in] make factory invoked to construct the sink when no live one
+   *   exists for the topic.
+   * \return the shared sink for the topic.
+   */
+  RCLCPP_PUBLIC
+  static std::shared_ptr<AggregatedTopicStatisticsSink>
+  get_or_create(
+    const std::string & publish_topic,
+    const std::function<std::shared_ptr<AggregatedTopicStatisticsSink>()> & make);
+
+private:
+  std::mutex mutex_;
+  std::vector<std::weak_ptr<AggregatedTopicStatisticsSource>> sources_;
+  rclcpp::Publisher<statistics_msgs::msg::MetricsMessage>::SharedPtr publisher_;
+  rclcpp::TimerBase::SharedPtr publisher_timer_;
+};
+
+}  // namespace topic_statistics
+}  // namespace rclcpp
+
+#endif  // RCLCPP__TOPIC_STATISTICS__AGGREGATED_TOPIC_STATISTICS_HPP_
@@ -15,8 +15,16 @@
 #ifndef RCLCPP__TOPIC_STATISTICS__SUBSCRIPTION_TOPIC_STATISTICS_HPP_
 #define RCLCPP__TOPIC_STATISTICS__SUBSCRIPTION_TOPIC_STATISTICS_HPP_
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -30,6 +38,7 @@
 #include "rclcpp/time.hpp"
 #include "rclcpp/publisher.hpp"
 #include "rclcpp/timer.hpp"
+#include "rclcpp/topic_statistics/aggregated_topic_statistics.hpp"
 
 #include "statistics_msgs/msg/metrics_message.hpp"
 
@@ -49,10 +58,19 @@ using libstatistics_collector::moving_average_statistics::StatisticData;
  * Class used to collect, measure, and publish topic statistics data. Current statistics
  * supported for subscribers are received message age and received message period.
  *
+ * Collection is sharded: each handling thread updates its own collector set under an
+ * uncontended shard lock, and the shards are merged when the statistics are published,
+ * so collection stays cheap on high-rate topics. An optional sampling rate processes
+ * only one out of every N received messages.
+ *
+ * Statistics are either published standalone (this instance owns a publisher
+ * and a timer) or fed into a shared AggregatedTopicStatisticsSink, depending
+ * on which constructor is used.
+ *
  * \tparam CallbackMessageT the subscribed message type
  */
 template<typename CallbackMessageT>
-class SubscriptionTopicStatistics
+class SubscriptionTopicStatistics : public AggregatedTopicStatisticsSource
 {
   using TopicStatsCollector =
     libstatistics_collector::topic_statistics_collector::TopicStatisticsCollector<
@@ -75,19 +93,58 @@ public:
    * topic source
    * \param publisher instance constructed by the node in order to publish statistics data.
    * This class owns the publisher.
+   * \param sample_rate process one out of every sample_rate received messages, 1 by default
    * \throws std::invalid_argument if publisher pointer is nullptr
+   * \throws std::invalid_argument if sample_rate is zero
    */
   SubscriptionTopicStatistics(
     const std::string & node_name,
-    rclcpp::Publisher<statistics_msgs::msg::MetricsMessage>::SharedPtr publisher)
+    rclcpp::Publisher<statistics_msgs::msg::MetricsMessage>::SharedPtr publisher,
+    uint64_t sample_rate = 1)
   : node_name_(node_name),
-    publisher_(std::move(publisher))
+    publisher_(std::move(publisher)),
+    sample_rate_(sample_rate)
   {
     // TODO(dbbonnie): ros-tooling/aws-roadmap/issues/226, received message age
 
     if (nullptr == publisher_) {
       throw std::invalid_argument("publisher pointer is nullptr");
     }
+    if (0u == sample_rate_) {
+      throw std::invalid_argument("sample_rate must be greater than 0");
+    }
+
+    bring_up();
+  }
+
+  /// Construct a SubscriptionTopicStatistics object feeding a shared sink.
+  /**
+   * In this mode the instance owns no publisher and no timer; the sink's
+   * timer drains the collected statistics through
+   * collect_and_reset_measurements() and publishes the consolidated batch.
+   *
+   * \param node_name the name of the node, which created this instance, in order to denote
+   * topic source
+   * \param sink the process-wide sink this instance feeds; the caller
+   * registers this instance with the sink once it is owned by a shared_ptr.
+   * \param sample_rate process one out of every sample_rate received messages, 1 by default
+   * \throws std::invalid_argument if sink pointer is nullptr
+   * \throws std::invalid_argument if sample_rate is zero
+   */
+  SubscriptionTopicStatistics(
+    const std::string & node_name,
+    std::shared_ptr<AggregatedTopicStatisticsSink> sink,
+    uint64_t sample_rate = 1)
+  : node_name_(node_name),
+    sink_(std::move(sink)),
+    sample_rate_(sample_rate)
+  {
+    if (nullptr == sink_) {
+      throw std::invalid_argument("sink pointer is nullptr");
+    }
+    if (0u == sample_rate_) {
+      throw std::invalid_argument("sample_rate must be greater than 0");
+    }
 
     bring_up();
   }
@@ -99,7 +156,9 @@ public:
 
   /// Handle a message received by the subscription to collect statistics.
   /**
-   * This method acquires a lock to prevent race conditions to collectors list.
+   * When a sampling rate was configured, only one out of every sample_rate messages
+   * is processed. Sampled messages update the collectors of the handling thread's
+   * shard, so concurrent handling threads do not contend on a shared lock.
    *
    * \param received_message the message received by the subscription
    * \param now_nanoseconds current time in nanoseconds
@@ -108,8 +167,15 @@ public:
     const CallbackMessageT & received_message,
     const rclcpp::Time now_nanoseconds) const
   {
-    std::lock_guard<std::mutex> lock(mutex_);
-    for (const auto & collector : subscriber_statistics_collectors_) {
+    if (sample_rate_ > 1u) {
+      const auto message_count = message_counter_.fetch_add(1, std::memory_order_relaxed);
+      if (0u != message_count % sample_rate_) {
+        return;
+      }
+    }
+    auto & shard = shards_[collector_shard_index()];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    for (const auto & collector : shard.collectors) {
       collector->OnMessageReceived(received_message, now_nanoseconds.nanoseconds());
     }
   }
@@ -125,87 +191,135 @@ public:
 
   /// Publish a populated MetricsStatisticsMessage.
   /**
-   * This method acquires a lock to prevent race conditions to collectors list.
+   * The per-thread collector shards are merged into one result per metric and
+   * cleared, taking each shard lock in turn. Only meaningful in standalone
+   * mode; in aggregation mode the sink's timer drains this instance through
+   * collect_and_reset_measurements() instead.
    */
   virtual void publish_message_and_reset_measurements()
+  {
+    for (auto & msg : collect_and_reset_measurements()) {
+      publisher_->publish(msg);
+    }
+  }
+
+  /// Return the statistics messages of the current window and reset the measurements.
+  /**
+   * The per-thread collector shards are merged into one result per metric and
+   * cleared, taking each shard lock in turn.
+   */
+  std::vector<MetricsMessage> collect_and_reset_measurements() override
   {
     std::vector<MetricsMessage> msgs;
     rclcpp::Time window_end{get_current_nanoseconds_since_epoch()};
 
+    size_t num_metrics = 0;
     {
-      std::lock_guard<std::mutex> lock(mutex_);
-      for (auto & collector : subscriber_statistics_collectors_) {
+      std::lock_guard<std::mutex> lock(shards_[0].mutex);
+      num_metrics = shards_[0].collectors.size();
+    }
+
+    for (size_t metric_index = 0; metric_index < num_metrics; ++metric_index) {
+      StatisticData merged_stats;
+      std::string metric_name;
+      std::string metric_unit;
+      bool first_shard = true;
+      for (auto & shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (metric_index >= shard.collectors.size()) {
+          continue;
+        }
+        auto & collector = shard.collectors[metric_index];
         const auto collected_stats = collector->GetStatisticsResults();
         collector->ClearCurrentMeasurements();
-
-        auto message = libstatistics_collector::collector::GenerateStatisticMessage(
-          node_name_,
-          collector->GetMetricName(),
-          collector->GetMetricUnit(),
-          window_start_,
-          window_end,
-          collected_stats);
-        msgs.push_back(message);
+        if (first_shard) {
+          metric_name = collector->GetMetricName();
+          metric_unit = collector->GetMetricUnit();
+          merged_stats = collected_stats;
+          first_shard = false;
+        } else {
+          merged_stats = merge_statistics(merged_stats, collected_stats);
+        }
       }
-    }
 
-    for (auto & msg : msgs) {
-      publisher_->publish(msg);
+      auto message = libstatistics_collector::collector::GenerateStatisticMessage(
+        node_name_,
+        metric_name,
+        metric_unit,
+        window_start_,
+        window_end,
+        merged_stats);
+      msgs.push_back(message);
     }
+
     window_start_ = window_end;
+    return msgs;
   }
 
 protected:
-  /// Return a vector of all the currently collected data.
+  /// Return a vector of all the currently collected data, merged across shards.
   /**
-   * This method acquires a lock to prevent race conditions to collectors list.
+   * This method acquires each shard lock in turn.
    *
-   * \return a vector of all the collected data
+   * \return a vector of all the collected data, one entry per metric
    */
   std::vector<StatisticData> get_current_collector_data() const
   {
     std::vector<StatisticData> data;
-    std::lock_guard<std::mutex> lock(mutex_);
-    for (const auto & collector : subscriber_statistics_collectors_) {
-      data.push_back(collector->GetStatisticsResults());
+    size_t num_metrics = 0;
+    {
+      std::lock_guard<std::mutex> lock(shards_[0].mutex);
+      num_metrics = shards_[0].collectors.size();
+    }
+    for (size_t metric_index = 0; metric_index < num_metrics; ++metric_index) {
+      StatisticData merged_stats;
+      bool first_shard = true;
+      for (auto & shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (metric_index >= shard.collectors.size()) {
+          continue;
+        }
+        const auto collected_stats = shard.collectors[metric_index]->GetStatisticsResults();
+        if (first_shard) {
+          merged_stats = collected_stats;
+          first_shard = false;
+        } else {
+          merged_stats = merge_statistics(merged_stats, collected_stats);
+        }
+      }
+      data.push_back(merged_stats);
     }
     return data;
   }
 
 private:
-  /// Construct and start all collectors and set window_start_.
-  /**
-   * This method acquires a lock to prevent race conditions to collectors list.
-   */
+  /// Construct and start the collectors of every shard and set window_start_.
   void bring_up()
   {
-    auto received_message_age = std::make_unique<ReceivedMessageAge>();
-    received_message_age->Start();
-    subscriber_statistics_collectors_.emplace_back(std::move(received_message_age));
+    for (auto & shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
 
-    auto received_message_period = std::make_unique<ReceivedMessagePeriod>();
-    received_message_period->Start();
-    {
-      std::lock_guard<std::mutex> lock(mutex_);
-      subscriber_statistics_collectors_.emplace_back(std::move(received_message_period));
+      auto received_message_age = std::make_unique<ReceivedMessageAge>();
+      received_message_age->Start();
+      shard.collectors.emplace_back(std::move(received_message_age));
+
+      auto received_message_period = std::make_unique<ReceivedMessagePeriod>();
+      received_message_period->Start();
+      shard.collectors.emplace_back(std::move(received_message_period));
     }
 
     window_start_ = rclcpp::Time(get_current_nanoseconds_since_epoch());
   }
 
   /// Stop all collectors, clear measurements, stop publishing timer, and reset publisher.
-  /**
-   * This method acquires a lock to prevent race conditions to collectors list.
-   */
   void tear_down()
   {
-    {
-      std::lock_guard<std::mutex> lock(mutex_);
-      for (auto & collector : subscriber_statistics_collectors_) {
+    for (auto & shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      for (auto & collector : shard.collectors) {
         collector->Stop();
       }
-
-      subscriber_statistics_collectors_.clear();
+      shard.collectors.clear();
     }
 
     if (publisher_timer_) {
@@ -214,6 +328,40 @@ private:
     }
 
     publisher_.reset();
+    sink_.reset();
+  }
+
+  /// Combine the statistics collected by two shards into one result.
+  static StatisticData merge_statistics(const StatisticData & left, const StatisticData & right)
+  {
+    if (0u == right.sample_count) {
+      return left;
+    }
+    if (0u == left.sample_count) {
+      return right;
+    }
+    StatisticData merged;
+    merged.sample_count = left.sample_count + right.sample_count;
+    merged.min = std::min(left.min, right.min);
+    merged.max = std::max(left.max, right.max);
+    const double left_count = static_cast<double>(left.sample_count);
+    const double right_count = static_cast<double>(right.sample_count);
+    const double merged_count = static_cast<double>(merged.sample_count);
+    merged.average = (left.average * left_count + right.average * right_count) / merged_count;
+    // Combine the per-shard variances with the parallel algorithm of Chan et al.
+    const double delta = right.average - left.average;
+    const double merged_m2 =
+      left.standard_deviation * left.standard_deviation * left_count +
+      right.standard_deviation * right.standard_deviation * right_count +
+      delta * delta * left_count * right_count / merged_count;
+    merged.standard_deviation = std::sqrt(merged_m2 / merged_count);
+    return merged;
+  }
+
+  /// Return the collector shard index for the calling thread.
+  size_t collector_shard_index() const
+  {
+    return std::hash<std::thread::id>()(std::this_thread::get_id()) % kNumCollectorShards;
   }
 
   /// Return the current nanoseconds (count) since epoch.
@@ -226,14 +374,30 @@ private:
     return std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count();
   }
 
-  /// Mutex to protect the subsequence vectors
-  mutable std::mutex mutex_;
-  /// Collection of statistics collectors
-  std::vector<std::unique_ptr<TopicStatsCollector>> subscriber_statistics_collectors_{};
+  /// Number of collector shards; handling threads hash onto one of these.
+  static constexpr size_t kNumCollectorShards = 4;
+
+  /// A thread shard holding its own collectors behind an uncontended lock.
+  struct CollectorShard
+  {
+    /// Mutex to protect this shard's collectors
+    mutable std::mutex mutex;
+    /// Collection of statistics collectors
+    std::vector<std::unique_ptr<TopicStatsCollector>> collectors;
+  };
+
+  /// Per-thread collector shards, merged when statistics are published
+  mutable std::array<CollectorShard, kNumCollectorShards> shards_;
+  /// Number of messages received, used to apply the sampling rate
+  mutable std::atomic<uint64_t> message_counter_{0};
   /// Node name used to generate topic statistics messages to be published
   const std::string node_name_;
   /// Publisher, created by the node, used to publish topic statistics messages
   rclcpp::Publisher<statistics_msgs::msg::MetricsMessage>::SharedPtr publisher_;
+  /// Shared sink this instance feeds in aggregation mode, in place of publisher_
+  std::shared_ptr<AggregatedTopicStatisticsSink> sink_;
+  /// Process one out of every sample_rate_ received messages
+  const uint64_t sample_rate_;
   /// Timer which fires the publisher
   rclcpp::TimerBase::SharedPtr publisher_timer_;
   /// The start of the collection window, used in the published topic statistics message
@@ -52,6 +52,38 @@ get_typesupport_handle(
   const std::string & typesupport_identifier,
   rcpputils::SharedLibrary & library);
 
+/// Load the type support library for the given type through a process-wide cache.
+/**
+ * The first call for a given type and identifier loads the library and pins it in the cache for
+ * the remainder of the process; later calls, from any thread, return the pinned library without
+ * touching the filesystem. Failures are cached as well, so repeatedly requesting an unavailable
+ * type does not repeat the library search.
+ *
+ * \param[in] type The topic type, e.g. "std_msgs/msg/String"
+ * \param[in] typesupport_identifier Type support identifier, typically "rosidl_typesupport_cpp"
+ * \return A shared library, kept loaded by the cache
+ * \throws std::runtime_error if the library could not be found or loaded
+ */
+RCLCPP_PUBLIC
+std::shared_ptr<rcpputils::SharedLibrary>
+get_cached_typesupport_library(
+  const std::string & type, const std::string & typesupport_identifier);
+
+/// Extract the type support handle for the given type through a process-wide cache.
+/**
+ * Combines get_cached_typesupport_library() with the symbol lookup of get_typesupport_handle();
+ * both the library and the resolved handle are cached per type and identifier, and the library
+ * stays pinned for the remainder of the process, so the returned handle never dangles.
+ *
+ * \param[in] type The topic type, e.g. "std_msgs/msg/String"
+ * \param[in] typesupport_identifier Type support identifier, typically "rosidl_typesupport_cpp"
+ * \return A type support handle valid for the remainder of the process
+ * \throws std::runtime_error if the library or the type support symbol could not be found
+ */
+RCLCPP_PUBLIC
+const rosidl_message_type_support_t *
+get_cached_typesupport_handle(const std::string & type, const std::string & typesupport_identifier);
+
 }  // namespace rclcpp
 
 #endif  // RCLCPP__TYPESUPPORT_HELPERS_HPP_
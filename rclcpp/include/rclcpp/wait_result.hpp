@@ -15,9 +15,13 @@
 #ifndef RCLCPP__WAIT_RESULT_HPP_
 #define RCLCPP__WAIT_RESULT_HPP_
 
+#include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <functional>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 #include "rcl/wait.h"
 
@@ -27,6 +31,78 @@
 namespace rclcpp
 {
 
+class ClientBase;
+class GuardCondition;
+class ServiceBase;
+class SubscriptionBase;
+class TimerBase;
+class Waitable;
+
+/// Per-kind lists of indices into the rcl wait set left ready by a wait.
+/**
+ * The vectors keep their capacity when cleared, so a caller reusing one
+ * instance across waits pays no allocations in the steady state.
+ *
+ * \sa WaitResult::collect_ready_entities()
+ */
+struct ReadyEntityIndexes
+{
+  std::vector<size_t> subscriptions;
+  std::vector<size_t> guard_conditions;
+  std::vector<size_t> timers;
+  std::vector<size_t> clients;
+  std::vector<size_t> services;
+  std::vector<size_t> events;
+
+  void
+  clear()
+  {
+    subscriptions.clear();
+    guard_conditions.clear();
+    timers.clear();
+    clients.clear();
+    services.clear();
+    events.clear();
+  }
+};
+
+/// Per-entity priorities for ordering ready work, parallel to the add order.
+/**
+ * Fill each vector as entities are added to the wait set; entries beyond the
+ * end of a vector default to priority 0, so only the kinds (and prefixes) a
+ * user cares about need to be filled. Higher values are dispatched first.
+ *
+ * The indices only stay aligned with the wait set as long as no entity of the
+ * same kind is removed; on removal, rebuild the affected vector.
+ */
+struct ReadyEntityPriorities
+{
+  std::vector<int> subscriptions;
+  std::vector<int> guard_conditions;
+  std::vector<int> timers;
+  std::vector<int> clients;
+  std::vector<int> services;
+  std::vector<int> events;
+};
+
+/// Per-kind callbacks for visiting ready entities with their user tags.
+/**
+ * Each callback receives the ready entity and the tag that was given when the
+ * entity was added to the wait set, nullptr if no tag was given.
+ * Callbacks which are left unset cause their entity kind to be skipped.
+ *
+ * \sa WaitResult::for_each_ready()
+ */
+struct ReadyEntityVisitors
+{
+  std::function<void(SubscriptionBase &, const void *)> subscription;
+  std::function<void(GuardCondition &, const void *)> guard_condition;
+  std::function<void(TimerBase &, const void *)> timer;
+  std::function<void(ClientBase &, const void *)> client;
+  std::function<void(ServiceBase &, const void *)> service;
+  std::function<void(Waitable &, const void *)> waitable;
+};
+
 // TODO(wjwwood): the union-like design of this class could be replaced with
 //   std::variant, when we have access to that...
 /// Interface for introspecting a wait set after waiting on it.
@@ -122,11 +198,140 @@ public:
     return *wait_set_pointer_;
   }
 
+  /// Create an inactive WaitResult, for later reuse with wait_into().
+  /**
+   * The result behaves like a timeout until a wait assigns into it; it holds
+   * no reference to any wait set.
+   */
+  WaitResult() noexcept
+  : wait_result_kind_(WaitResultKind::Timeout)
+  {}
+
   WaitResult(WaitResult && other) noexcept
   : wait_result_kind_(other.wait_result_kind_),
     wait_set_pointer_(std::exchange(other.wait_set_pointer_, nullptr))
   {}
 
+  /// Replace this result with another, releasing any hold this one had.
+  WaitResult &
+  operator=(WaitResult && other) noexcept
+  {
+    if (this != &other) {
+      this->reset();
+      wait_result_kind_ = other.wait_result_kind_;
+      wait_set_pointer_ = std::exchange(other.wait_set_pointer_, nullptr);
+    }
+    return *this;
+  }
+
+  /// Fill the given lists with the indices of the ready entities.
+  /**
+   * The rcl wait set is scanned once and the indices of the entries left
+   * ready by the wait are appended per entity kind, so subsequent dispatch
+   * iterates only the ready work instead of re-testing every entity.
+   * The lists are cleared first and their capacity is retained, making the
+   * scan allocation-free once the lists have grown to a steady state.
+   *
+   * \param[out] out lists of ready indices, cleared and then filled.
+   * \throws std::runtime_error if the result was not ready.
+   */
+  void
+  collect_ready_entities(ReadyEntityIndexes & out) const
+  {
+    out.clear();
+    const auto & rcl_wait_set = this->get_wait_set().get_rcl_wait_set();
+    for (size_t ii = 0; ii < rcl_wait_set.size_of_subscriptions; ++ii) {
+      if (nullptr != rcl_wait_set.subscriptions[ii]) {
+        out.subscriptions.push_back(ii);
+      }
+    }
+    for (size_t ii = 0; ii < rcl_wait_set.size_of_guard_conditions; ++ii) {
+      if (nullptr != rcl_wait_set.guard_conditions[ii]) {
+        out.guard_conditions.push_back(ii);
+      }
+    }
+    for (size_t ii = 0; ii < rcl_wait_set.size_of_timers; ++ii) {
+      if (nullptr != rcl_wait_set.timers[ii]) {
+        out.timers.push_back(ii);
+      }
+    }
+    for (size_t ii = 0; ii < rcl_wait_set.size_of_clients; ++ii) {
+      if (nullptr != rcl_wait_set.clients[ii]) {
+        out.clients.push_back(ii);
+      }
+    }
+    for (size_t ii = 0; ii < rcl_wait_set.size_of_services; ++ii) {
+      if (nullptr != rcl_wait_set.services[ii]) {
+        out.services.push_back(ii);
+      }
+    }
+    for (size_t ii = 0; ii < rcl_wait_set.size_of_events; ++ii) {
+      if (nullptr != rcl_wait_set.events[ii]) {
+        out.events.push_back(ii);
+      }
+    }
+  }
+
+  /// Fill the given lists with ready indices, ordered by priority.
+  /**
+   * Like collect_ready_entities(ReadyEntityIndexes &), but each list is
+   * additionally sorted by the given priorities, highest first; entities of
+   * equal priority keep their storage order. Sorting is O(ready log ready),
+   * independent of the total number of entities.
+   *
+   * \param[out] out lists of ready indices, cleared, filled and sorted.
+   * \param[in] priorities per-entity priorities, parallel to the add order.
+   * \throws std::runtime_error if the result was not ready.
+   */
+  void
+  collect_ready_entities(
+    ReadyEntityIndexes & out,
+    const ReadyEntityPriorities & priorities) const
+  {
+    this->collect_ready_entities(out);
+    sort_by_priority(out.subscriptions, priorities.subscriptions);
+    sort_by_priority(out.guard_conditions, priorities.guard_conditions);
+    sort_by_priority(out.timers, priorities.timers);
+    sort_by_priority(out.clients, priorities.clients);
+    sort_by_priority(out.services, priorities.services);
+    sort_by_priority(out.events, priorities.events);
+  }
+
+  /// Visit each ready entity of the wait set, together with its user tag.
+  /**
+   * The matching visitor is invoked once for each entity left ready by the
+   * wait, receiving the entity and the tag given when it was added to the
+   * wait set, nullptr if none was given, so dispatch needs neither a full
+   * scan of the wait set nor a caller-side lookup from entity to handler.
+   * Entities which entered the wait set through a waitable, e.g. QoS events
+   * of a subscription, are not reported individually; instead the waitable
+   * visitor is invoked for each ready waitable.
+   *
+   * \param[in] visitors per-kind callbacks, unset ones skip their kind.
+   * \throws std::runtime_error if the result was not ready.
+   */
+  void
+  for_each_ready(const ReadyEntityVisitors & visitors)
+  {
+    this->get_wait_set().for_each_ready_entity(visitors);
+  }
+
+  /// Release any hold on the wait set, making the result inactive again.
+  /**
+   * Must be called, directly or via wait_into(), before the same wait set can
+   * be waited on again, since the hold blocks the next acquisition.
+   * After this the result behaves like a timeout.
+   */
+  void
+  reset() noexcept
+  {
+    if (wait_set_pointer_) {
+      wait_set_pointer_->wait_result_release();
+      wait_set_pointer_ = nullptr;
+    }
+    wait_result_kind_ = WaitResultKind::Timeout;
+  }
+
   ~WaitResult()
   {
     if (wait_set_pointer_) {
@@ -137,6 +342,21 @@ public:
 private:
   RCLCPP_DISABLE_COPY(WaitResult)
 
+  /// Sort ready indices descending by priority, missing entries rank as 0.
+  static
+  void
+  sort_by_priority(std::vector<size_t> & indexes, const std::vector<int> & priorities)
+  {
+    auto priority_of = [&priorities](size_t index) {
+        return index < priorities.size() ? priorities[index] : 0;
+      };
+    std::stable_sort(
+      indexes.begin(), indexes.end(),
+      [&priority_of](size_t left, size_t right) {
+        return priority_of(left) > priority_of(right);
+      });
+  }
+
   explicit WaitResult(WaitResultKind wait_result_kind)
   : wait_result_kind_(wait_result_kind)
   {
@@ -154,7 +374,7 @@ private:
     wait_set_pointer_->wait_result_acquire();
   }
 
-  const WaitResultKind wait_result_kind_;
+  WaitResultKind wait_result_kind_;
 
   WaitSetT * wait_set_pointer_ = nullptr;
 };
@@ -23,7 +23,9 @@
 #include "rclcpp/macros.hpp"
 #include "rclcpp/visibility_control.hpp"
 #include "rclcpp/wait_set_policies/dynamic_storage.hpp"
+#include "rclcpp/wait_set_policies/event_notify_synchronization.hpp"
 #include "rclcpp/wait_set_policies/sequential_synchronization.hpp"
+#include "rclcpp/wait_set_policies/sharded_synchronization.hpp"
 #include "rclcpp/wait_set_policies/static_storage.hpp"
 #include "rclcpp/wait_set_policies/thread_safe_synchronization.hpp"
 #include "rclcpp/wait_set_template.hpp"
@@ -101,6 +103,40 @@ using ThreadSafeWaitSet = rclcpp::WaitSetTemplate<
   rclcpp::wait_set_policies::DynamicStorage
 >;
 
+/// Like ThreadSafeWaitSet, but registration does not stall behind waiting.
+/**
+ * This wait set is thread-safe like ThreadSafeWaitSet, but the entity lists
+ * are guarded by one shared mutex per entity kind rather than a single
+ * single-reader lock, so adding and removing entities only contends with a
+ * concurrent rebuild of the rcl wait set, not with a blocking wait() or a
+ * WaitResult held in scope.
+ *
+ * \sa rclcpp::WaitSetTemplate for API documentation
+ */
+using ConcurrentWaitSet = rclcpp::WaitSetTemplate<
+  rclcpp::wait_set_policies::ShardedSynchronization,
+  rclcpp::wait_set_policies::DynamicStorage
+>;
+
+/// Like WaitSet, but wait() blocks on entity readiness listeners.
+/**
+ * This wait set registers each entity's rmw listener callback when the entity
+ * is added, so waiting blocks until the middleware pushes a readiness event
+ * and the cost of a wakeup scales with what fired, not with the total number
+ * of entities registered with the middleware each wait.
+ *
+ * Entities must be added with the add_*() methods after construction;
+ * entities passed to the constructor do not get listeners registered.
+ * Like WaitSet, it is not thread-safe to add and remove entities while
+ * waiting.
+ *
+ * \sa rclcpp::WaitSetTemplate for API documentation
+ */
+using EventNotifyWaitSet = rclcpp::WaitSetTemplate<
+  rclcpp::wait_set_policies::EventNotifySynchronization,
+  rclcpp::wait_set_policies::DynamicStorage
+>;
+
 }  // namespace rclcpp
 
 #endif  // RCLCPP__WAIT_SET_HPP_
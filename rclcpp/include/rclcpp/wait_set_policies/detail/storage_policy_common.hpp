@@ -18,6 +18,7 @@
 #include <memory>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 #include "rcl/wait.h"
 
@@ -29,11 +30,49 @@
 
 namespace rclcpp
 {
+
+class ClientBase;
+class GuardCondition;
+class ServiceBase;
+class SubscriptionBase;
+class TimerBase;
+
 namespace wait_set_policies
 {
 namespace detail
 {
 
+/// Entities recorded per rcl wait set slot during the last rebuild.
+/**
+ * Each vector is parallel to the leading entries of the matching rcl wait set
+ * array, in the order the storage policy added them during the last rebuild.
+ * Entries which entered the rcl wait set through a waitable are not recorded
+ * individually; instead the waitables themselves are recorded, in add order.
+ *
+ * The vectors keep their capacity when cleared, so rebuilding each wait cycle
+ * does not allocate in the steady state.
+ */
+struct RclWaitSetSlots
+{
+  std::vector<rclcpp::SubscriptionBase *> subscriptions;
+  std::vector<rclcpp::GuardCondition *> guard_conditions;
+  std::vector<rclcpp::TimerBase *> timers;
+  std::vector<rclcpp::ClientBase *> clients;
+  std::vector<rclcpp::ServiceBase *> services;
+  std::vector<rclcpp::Waitable *> waitables;
+
+  void
+  clear()
+  {
+    subscriptions.clear();
+    guard_conditions.clear();
+    timers.clear();
+    clients.clear();
+    services.clear();
+    waitables.clear();
+  }
+};
+
 /// Common structure for storage policies, which provides rcl wait set access.
 template<bool HasStrongOwnership>
 class StoragePolicyCommon
@@ -242,6 +281,10 @@ protected:
       }
     }
 
+    // Reset the per-slot entity records; they are refilled below as entities
+    // are re-added, so that they stay parallel to the rcl wait set arrays.
+    slot_entities_.clear();
+
     // Add subscriptions.
     for (const auto & subscription_entry : subscriptions) {
       auto subscription_ptr_pair =
@@ -264,6 +307,7 @@ protected:
       if (RCL_RET_OK != ret) {
         rclcpp::exceptions::throw_from_rcl_error(ret);
       }
+      slot_entities_.subscriptions.push_back(subscription_ptr_pair.second);
     }
 
     // Setup common code to add guard_conditions.
@@ -290,6 +334,9 @@ protected:
           if (RCL_RET_OK != ret) {
             rclcpp::exceptions::throw_from_rcl_error(ret);
           }
+          // Being re-added for a new wait cycle, deliver any suppressed trigger.
+          guard_condition_ptr_pair.second->retrigger_if_pending();
+          slot_entities_.guard_conditions.push_back(guard_condition_ptr_pair.second);
         }
       };
 
@@ -320,6 +367,7 @@ protected:
       if (RCL_RET_OK != ret) {
         rclcpp::exceptions::throw_from_rcl_error(ret);
       }
+      slot_entities_.timers.push_back(timer_ptr_pair.second);
     }
 
     // Add clients.
@@ -343,6 +391,7 @@ protected:
       if (RCL_RET_OK != ret) {
         rclcpp::exceptions::throw_from_rcl_error(ret);
       }
+      slot_entities_.clients.push_back(client_ptr_pair.second);
     }
 
     // Add services.
@@ -366,6 +415,7 @@ protected:
       if (RCL_RET_OK != ret) {
         rclcpp::exceptions::throw_from_rcl_error(ret);
       }
+      slot_entities_.services.push_back(service_ptr_pair.second);
     }
 
     // Add waitables.
@@ -384,6 +434,7 @@ protected:
       }
       rclcpp::Waitable & waitable = *waitable_ptr_pair.second;
       waitable.add_to_wait_set(&rcl_wait_set_);
+      slot_entities_.waitables.push_back(waitable_ptr_pair.second);
     }
   }
 
@@ -399,6 +450,13 @@ protected:
     return rcl_wait_set_;
   }
 
+  /// Return the entities recorded per rcl wait set slot by the last rebuild.
+  const RclWaitSetSlots &
+  storage_get_rcl_wait_set_slots() const
+  {
+    return slot_entities_;
+  }
+
   void
   storage_flag_for_resize()
   {
@@ -408,6 +466,8 @@ protected:
   rcl_wait_set_t rcl_wait_set_;
   rclcpp::Context::SharedPtr context_;
 
+  RclWaitSetSlots slot_entities_;
+
   bool needs_pruning_ = false;
   bool needs_resize_ = false;
 };
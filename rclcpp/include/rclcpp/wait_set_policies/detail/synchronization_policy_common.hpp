@@ -47,6 +47,20 @@ protected:
     }
   }
 
+  /// Equivalent of the predicate from create_loop_predicate, without the
+  /// std::function, so wait loops can check it with no allocations.
+  bool
+  should_keep_looping(
+    std::chrono::nanoseconds time_to_wait_ns,
+    std::chrono::steady_clock::time_point start)
+  {
+    if (time_to_wait_ns < std::chrono::nanoseconds(0)) {
+      // Negative timeouts loop forever.
+      return true;
+    }
+    return std::chrono::steady_clock::now() < start + time_to_wait_ns;
+  }
+
   std::chrono::nanoseconds
   calculate_time_left_to_wait(
     std::chrono::nanoseconds original_time_to_wait_ns,
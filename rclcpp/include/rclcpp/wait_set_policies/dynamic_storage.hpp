@@ -391,6 +391,10 @@ public:
     waitables_.erase(std::remove_if(waitables_.begin(), waitables_.end(), p), waitables_.end());
   }
 
+  // The shared_* caches below are preallocated and reused across waits: the
+  // resize is a no-op while the entity sets are unchanged and releasing only
+  // resets the elements, so a steady-state wait loop performs no allocations
+  // and an entity keeps the same index in its cache between waits.
   void
   storage_acquire_ownerships()
   {
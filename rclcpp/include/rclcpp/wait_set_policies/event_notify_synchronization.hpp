@@ -0,0 +1,555 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__WAIT_SET_POLICIES__EVENT_NOTIFY_SYNCHRONIZATION_HPP_
+#define RCLCPP__WAIT_SET_POLICIES__EVENT_NOTIFY_SYNCHRONIZATION_HPP_
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "rclcpp/client.hpp"
+#include "rclcpp/exceptions.hpp"
+#include "rclcpp/guard_condition.hpp"
+#include "rclcpp/macros.hpp"
+#include "rclcpp/service.hpp"
+#include "rclcpp/subscription_base.hpp"
+#include "rclcpp/subscription_wait_set_mask.hpp"
+#include "rclcpp/timer.hpp"
+#include "rclcpp/visibility_control.hpp"
+#include "rclcpp/wait_result.hpp"
+#include "rclcpp/wait_result_kind.hpp"
+#include "rclcpp/wait_set_policies/detail/synchronization_policy_common.hpp"
+#include "rclcpp/waitable.hpp"
+
+namespace rclcpp
+{
+namespace wait_set_policies
+{
+
+/// WaitSet policy that blocks on entity readiness listeners instead of rcl_wait().
+/**
+ * When an entity is added, this policy registers the entity's on-ready
+ * listener callback (the same rmw facility the events executor uses), so the
+ * middleware pushes readiness to the wait set as it happens.
+ * Waiting blocks on a condition variable until at least one listener has
+ * fired, then collects the ready entities with a single non-blocking poll of
+ * the rcl wait set; while idle no entity is scanned or re-registered with the
+ * middleware.
+ *
+ * Timers have no listener callback, so the block is additionally bounded by
+ * the earliest added timer's time until trigger.
+ *
+ * Entities passed to the wait set constructor bypass the add functions and do
+ * not get listeners registered; with this policy entities must be added with
+ * the add_*() methods after construction instead.
+ *
+ * Like SequentialSynchronization, this policy provides no thread-safety
+ * between waiting and adding or removing entities; the listener callbacks
+ * themselves may safely fire from middleware threads at any time.
+ */
+class EventNotifySynchronization : public detail::SynchronizationPolicyCommon
+{
+protected:
+  explicit EventNotifySynchronization(rclcpp::Context::SharedPtr)
+  : notifier_(std::make_shared<EventNotifier>())
+  {}
+
+  ~EventNotifySynchronization()
+  {
+    // Clear listener callbacks registered with entities that outlive the wait
+    // set, so they stop notifying a notifier nothing will ever wait on again.
+    for (const auto & weak_subscription : subscriptions_) {
+      auto subscription = weak_subscription.lock();
+      if (subscription) {
+        subscription->clear_on_new_message_callback();
+      }
+    }
+    for (const auto & weak_guard_condition : guard_conditions_) {
+      auto guard_condition = weak_guard_condition.lock();
+      if (guard_condition) {
+        guard_condition->set_on_trigger_callback(nullptr);
+      }
+    }
+    for (const auto & weak_timer : timers_) {
+      auto timer = weak_timer.lock();
+      if (timer) {
+        timer->clear_on_reset_callback();
+      }
+    }
+    for (const auto & weak_client : clients_) {
+      auto client = weak_client.lock();
+      if (client) {
+        client->clear_on_new_response_callback();
+      }
+    }
+    for (const auto & weak_service : services_) {
+      auto service = weak_service.lock();
+      if (service) {
+        service->clear_on_new_request_callback();
+      }
+    }
+    for (const auto & weak_waitable : waitables_) {
+      auto waitable = weak_waitable.lock();
+      if (waitable) {
+        waitable->clear_on_ready_callback();
+      }
+    }
+  }
+
+  /// Return any "extra" guard conditions needed to implement the synchronization policy.
+  /**
+   * Readiness is pushed through the notifier rather than a guard condition,
+   * so no extra guard conditions are needed.
+   */
+  const std::array<std::shared_ptr<rclcpp::GuardCondition>, 0> &
+  get_extra_guard_conditions()
+  {
+    static const std::array<std::shared_ptr<rclcpp::GuardCondition>, 0> empty{};
+    return empty;
+  }
+
+  /// Add subscription and register its readiness listeners.
+  /**
+   * Does not throw, but storage function may throw.
+   */
+  void
+  sync_add_subscription(
+    std::shared_ptr<rclcpp::SubscriptionBase> && subscription,
+    const rclcpp::SubscriptionWaitSetMask & mask,
+    std::function<
+      void(std::shared_ptr<rclcpp::SubscriptionBase>&&, const rclcpp::SubscriptionWaitSetMask &)
+    > add_subscription_function)
+  {
+    auto local_subscription = subscription;
+    add_subscription_function(std::move(subscription), mask);
+    auto notifier = notifier_;
+    if (mask.include_subscription) {
+      local_subscription->set_on_new_message_callback(
+        [notifier](size_t count) {notifier->notify(count);});
+      subscriptions_.push_back(local_subscription);
+    }
+    if (mask.include_events) {
+      for (auto key_event_pair : local_subscription->get_event_handlers()) {
+        this->register_waitable_listener(key_event_pair.second);
+      }
+    }
+    if (mask.include_intra_process_waitable) {
+      auto waitable = local_subscription->get_intra_process_waitable();
+      if (nullptr != waitable) {
+        this->register_waitable_listener(waitable);
+      }
+    }
+  }
+
+  /// Remove subscription and clear its readiness listeners.
+  /**
+   * Does not throw, but storage function may throw.
+   */
+  void
+  sync_remove_subscription(
+    std::shared_ptr<rclcpp::SubscriptionBase> && subscription,
+    const rclcpp::SubscriptionWaitSetMask & mask,
+    std::function<
+      void(std::shared_ptr<rclcpp::SubscriptionBase>&&, const rclcpp::SubscriptionWaitSetMask &)
+    > remove_subscription_function)
+  {
+    auto local_subscription = subscription;
+    remove_subscription_function(std::move(subscription), mask);
+    if (mask.include_subscription) {
+      local_subscription->clear_on_new_message_callback();
+      remove_from_weak_list(subscriptions_, local_subscription);
+    }
+    if (mask.include_events) {
+      for (auto key_event_pair : local_subscription->get_event_handlers()) {
+        this->clear_waitable_listener(key_event_pair.second);
+      }
+    }
+    if (mask.include_intra_process_waitable) {
+      auto waitable = local_subscription->get_intra_process_waitable();
+      if (nullptr != waitable) {
+        this->clear_waitable_listener(waitable);
+      }
+    }
+  }
+
+  /// Add guard condition and register its trigger listener.
+  /**
+   * Does not throw, but storage function may throw.
+   */
+  void
+  sync_add_guard_condition(
+    std::shared_ptr<rclcpp::GuardCondition> && guard_condition,
+    std::function<void(std::shared_ptr<rclcpp::GuardCondition>&&)> add_guard_condition_function)
+  {
+    auto local_guard_condition = guard_condition;
+    add_guard_condition_function(std::move(guard_condition));
+    auto notifier = notifier_;
+    local_guard_condition->set_on_trigger_callback(
+      [notifier](size_t count) {notifier->notify(count);});
+    guard_conditions_.push_back(local_guard_condition);
+  }
+
+  /// Remove guard condition and clear its trigger listener.
+  /**
+   * Does not throw, but storage function may throw.
+   */
+  void
+  sync_remove_guard_condition(
+    std::shared_ptr<rclcpp::GuardCondition> && guard_condition,
+    std::function<void(std::shared_ptr<rclcpp::GuardCondition>&&)> remove_guard_condition_function)
+  {
+    auto local_guard_condition = guard_condition;
+    remove_guard_condition_function(std::move(guard_condition));
+    local_guard_condition->set_on_trigger_callback(nullptr);
+    remove_from_weak_list(guard_conditions_, local_guard_condition);
+  }
+
+  /// Add timer, tracking it to bound the wait by its deadline.
+  /**
+   * Does not throw, but storage function may throw.
+   */
+  void
+  sync_add_timer(
+    std::shared_ptr<rclcpp::TimerBase> && timer,
+    std::function<void(std::shared_ptr<rclcpp::TimerBase>&&)> add_timer_function)
+  {
+    auto local_timer = timer;
+    add_timer_function(std::move(timer));
+    auto notifier = notifier_;
+    // There is no listener for timer expiry; the reset listener recomputes
+    // the deadline bound when the timer is reset, expiry itself is covered by
+    // bounding the wait with time until trigger.
+    local_timer->set_on_reset_callback(
+      [notifier](size_t count) {notifier->notify(count);});
+    timers_.push_back(local_timer);
+  }
+
+  /// Remove timer and stop tracking its deadline.
+  /**
+   * Does not throw, but storage function may throw.
+   */
+  void
+  sync_remove_timer(
+    std::shared_ptr<rclcpp::TimerBase> && timer,
+    std::function<void(std::shared_ptr<rclcpp::TimerBase>&&)> remove_timer_function)
+  {
+    auto local_timer = timer;
+    remove_timer_function(std::move(timer));
+    local_timer->clear_on_reset_callback();
+    remove_from_weak_list(timers_, local_timer);
+  }
+
+  /// Add client and register its response listener.
+  /**
+   * Does not throw, but storage function may throw.
+   */
+  void
+  sync_add_client(
+    std::shared_ptr<rclcpp::ClientBase> && client,
+    std::function<void(std::shared_ptr<rclcpp::ClientBase>&&)> add_client_function)
+  {
+    auto local_client = client;
+    add_client_function(std::move(client));
+    auto notifier = notifier_;
+    local_client->set_on_new_response_callback(
+      [notifier](size_t count) {notifier->notify(count);});
+    clients_.push_back(local_client);
+  }
+
+  /// Remove client and clear its response listener.
+  /**
+   * Does not throw, but storage function may throw.
+   */
+  void
+  sync_remove_client(
+    std::shared_ptr<rclcpp::ClientBase> && client,
+    std::function<void(std::shared_ptr<rclcpp::ClientBase>&&)> remove_client_function)
+  {
+    auto local_client = client;
+    remove_client_function(std::move(client));
+    local_client->clear_on_new_response_callback();
+    remove_from_weak_list(clients_, local_client);
+  }
+
+  /// Add service and register its request listener.
+  /**
+   * Does not throw, but storage function may throw.
+   */
+  void
+  sync_add_service(
+    std::shared_ptr<rclcpp::ServiceBase> && service,
+    std::function<void(std::shared_ptr<rclcpp::ServiceBase>&&)> add_service_function)
+  {
+    auto local_service = service;
+    add_service_function(std::move(service));
+    auto notifier = notifier_;
+    local_service->set_on_new_request_callback(
+      [notifier](size_t count) {notifier->notify(count);});
+    services_.push_back(local_service);
+  }
+
+  /// Remove service and clear its request listener.
+  /**
+   * Does not throw, but storage function may throw.
+   */
+  void
+  sync_remove_service(
+    std::shared_ptr<rclcpp::ServiceBase> && service,
+    std::function<void(std::shared_ptr<rclcpp::ServiceBase>&&)> remove_service_function)
+  {
+    auto local_service = service;
+    remove_service_function(std::move(service));
+    local_service->clear_on_new_request_callback();
+    remove_from_weak_list(services_, local_service);
+  }
+
+  /// Add waitable and register its readiness listener.
+  /**
+   * Does not throw, but storage function may throw.
+   */
+  void
+  sync_add_waitable(
+    std::shared_ptr<rclcpp::Waitable> && waitable,
+    std::shared_ptr<void> && associated_entity,
+    std::function<
+      void(std::shared_ptr<rclcpp::Waitable>&&, std::shared_ptr<void> &&)
+    > add_waitable_function)
+  {
+    auto local_waitable = waitable;
+    add_waitable_function(std::move(waitable), std::move(associated_entity));
+    this->register_waitable_listener(local_waitable);
+  }
+
+  /// Remove waitable and clear its readiness listener.
+  /**
+   * Does not throw, but storage function may throw.
+   */
+  void
+  sync_remove_waitable(
+    std::shared_ptr<rclcpp::Waitable> && waitable,
+    std::function<void(std::shared_ptr<rclcpp::Waitable>&&)> remove_waitable_function)
+  {
+    auto local_waitable = waitable;
+    remove_waitable_function(std::move(waitable));
+    this->clear_waitable_listener(local_waitable);
+  }
+
+  /// Prune deleted entities without thread-safety.
+  /**
+   * Does not throw, but storage function may throw.
+   */
+  void
+  sync_prune_deleted_entities(std::function<void()> prune_deleted_entities_function)
+  {
+    // Expired entries in the listener bookkeeping lists are pruned lazily as
+    // they are encountered, nothing extra to do here.
+    prune_deleted_entities_function();
+  }
+
+  /// Implements wait by blocking until a readiness listener fires.
+  template<class WaitResultT, class RebuildRclWaitSetF, class GetRclWaitSetF, class CreateResultF>
+  WaitResultT
+  sync_wait(
+    std::chrono::nanoseconds time_to_wait_ns,
+    RebuildRclWaitSetF rebuild_rcl_wait_set,
+    GetRclWaitSetF get_rcl_wait_set,
+    CreateResultF create_wait_result)
+  {
+    // Assumption: as with SequentialSynchronization, the calling code ensures
+    // the entities being waited on cannot go out of scope during this call.
+
+    // Record the start time for the looping deadline check.
+    auto start = std::chrono::steady_clock::now();
+
+    // Wait until exit condition is met.
+    do {
+      // Block until a listener fires, bounding the block by the time left to
+      // wait and by the earliest timer deadline, since timer expiry has no
+      // listener to fire.
+      std::chrono::nanoseconds block_for(-1);
+      if (time_to_wait_ns >= std::chrono::nanoseconds(0)) {
+        block_for = this->calculate_time_left_to_wait(time_to_wait_ns, start);
+      }
+      const std::chrono::nanoseconds timer_bound = this->next_timer_deadline();
+      if (
+        timer_bound >= std::chrono::nanoseconds(0) &&
+        (block_for < std::chrono::nanoseconds(0) || timer_bound < block_for))
+      {
+        block_for = timer_bound;
+      }
+      notifier_->consume_or_wait(block_for);
+
+      // Collect whatever became ready, including expired timers, with a
+      // non-blocking poll; the blocking part of the wait is already done.
+      rebuild_rcl_wait_set();
+      rcl_wait_set_t & rcl_wait_set = get_rcl_wait_set();
+      rcl_ret_t ret = rcl_wait(&rcl_wait_set, 0);
+      if (RCL_RET_OK == ret) {
+        // Something has become ready in the wait set.
+        return create_wait_result(WaitResultKind::Ready);
+      } else if (RCL_RET_WAIT_SET_EMPTY == ret) {
+        // Wait set was empty, return Empty.
+        return create_wait_result(WaitResultKind::Empty);
+      } else if (RCL_RET_TIMEOUT != ret) {
+        // Some other error case, throw.
+        rclcpp::exceptions::throw_from_rcl_error(ret);
+      }
+      // Nothing was ready, e.g. a listener fired for data that was consumed
+      // elsewhere in the meantime, so block again.
+    } while (this->should_keep_looping(time_to_wait_ns, start));
+
+    // Wait did not result in ready items, return timeout.
+    return create_wait_result(WaitResultKind::Timeout);
+  }
+
+  void
+  sync_wait_result_acquire()
+  {
+    // Explicitly do nothing.
+  }
+
+  void
+  sync_wait_result_release()
+  {
+    // Explicitly do nothing.
+  }
+
+private:
+  /// Counts listener events and wakes the waiting thread.
+  /**
+   * Held by shared pointer so listener callbacks left registered on entities
+   * can never dangle, even if an entity outlives the wait set.
+   */
+  class EventNotifier
+  {
+public:
+    void
+    notify(size_t count)
+    {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_ += count;
+      }
+      cv_.notify_one();
+    }
+
+    /// Block until an event is pending or the timeout expires, consuming events.
+    /**
+     * \param[in] timeout maximum time to block, negative blocks indefinitely.
+     * \return true if at least one event was pending.
+     */
+    bool
+    consume_or_wait(std::chrono::nanoseconds timeout)
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      auto something_pending = [this]() {return pending_ > 0u;};
+      if (timeout < std::chrono::nanoseconds(0)) {
+        cv_.wait(lock, something_pending);
+      } else {
+        cv_.wait_for(lock, timeout, something_pending);
+      }
+      bool was_pending = pending_ > 0u;
+      pending_ = 0u;
+      return was_pending;
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    size_t pending_{0u};
+  };
+
+  void
+  register_waitable_listener(const std::shared_ptr<rclcpp::Waitable> & waitable)
+  {
+    auto notifier = notifier_;
+    waitable->set_on_ready_callback(
+      [notifier](size_t count, int) {notifier->notify(count);});
+    waitables_.push_back(waitable);
+  }
+
+  void
+  clear_waitable_listener(const std::shared_ptr<rclcpp::Waitable> & waitable)
+  {
+    waitable->clear_on_ready_callback();
+    remove_from_weak_list(waitables_, waitable);
+  }
+
+  /// Smallest time until an added timer triggers, or -1 if there are none.
+  std::chrono::nanoseconds
+  next_timer_deadline()
+  {
+    std::chrono::nanoseconds deadline(-1);
+    for (auto it = timers_.begin(); it != timers_.end(); ) {
+      auto timer = it->lock();
+      if (nullptr == timer) {
+        it = timers_.erase(it);
+        continue;
+      }
+      if (!timer->is_canceled()) {
+        std::chrono::nanoseconds time_until_trigger = timer->time_until_trigger();
+        if (time_until_trigger < std::chrono::nanoseconds(0)) {
+          time_until_trigger = std::chrono::nanoseconds(0);
+        }
+        if (deadline < std::chrono::nanoseconds(0) || time_until_trigger < deadline) {
+          deadline = time_until_trigger;
+        }
+      }
+      ++it;
+    }
+    return deadline;
+  }
+
+  template<class EntityT>
+  static void
+  remove_from_weak_list(
+    std::vector<std::weak_ptr<EntityT>> & list,
+    const std::shared_ptr<EntityT> & entity)
+  {
+    for (auto it = list.begin(); it != list.end(); ) {
+      auto locked = it->lock();
+      if (nullptr == locked) {
+        it = list.erase(it);
+        continue;
+      }
+      if (locked == entity) {
+        list.erase(it);
+        return;
+      }
+      ++it;
+    }
+  }
+
+  std::shared_ptr<EventNotifier> notifier_;
+
+  // Entities with registered listeners, kept weakly so the callbacks can be
+  // cleared on removal and destruction; ownership stays with the storage
+  // policy.
+  std::vector<std::weak_ptr<rclcpp::SubscriptionBase>> subscriptions_;
+  std::vector<std::weak_ptr<rclcpp::GuardCondition>> guard_conditions_;
+  std::vector<std::weak_ptr<rclcpp::TimerBase>> timers_;
+  std::vector<std::weak_ptr<rclcpp::ClientBase>> clients_;
+  std::vector<std::weak_ptr<rclcpp::ServiceBase>> services_;
+  std::vector<std::weak_ptr<rclcpp::Waitable>> waitables_;
+};
+
+}  // namespace wait_set_policies
+}  // namespace rclcpp
+
+#endif  // RCLCPP__WAIT_SET_POLICIES__EVENT_NOTIFY_SYNCHRONIZATION_HPP_
@@ -235,13 +235,13 @@ protected:
   }
 
   /// Implements wait without any thread-safety.
-  template<class WaitResultT>
+  template<class WaitResultT, class RebuildRclWaitSetF, class GetRclWaitSetF, class CreateResultF>
   WaitResultT
   sync_wait(
     std::chrono::nanoseconds time_to_wait_ns,
-    std::function<void()> rebuild_rcl_wait_set,
-    std::function<rcl_wait_set_t & ()> get_rcl_wait_set,
-    std::function<WaitResultT(WaitResultKind wait_result_kind)> create_wait_result)
+    RebuildRclWaitSetF rebuild_rcl_wait_set,
+    GetRclWaitSetF get_rcl_wait_set,
+    CreateResultF create_wait_result)
   {
     // Assumption: this function assumes that some measure has been taken to
     // ensure none of the entities being waited on by the wait set are allowed
@@ -252,9 +252,8 @@ protected:
     // which calls this function, by acquiring shared ownership of the entites
     // for the duration of this function.
 
-    // Setup looping predicate.
+    // Record the start time for the looping deadline check.
     auto start = std::chrono::steady_clock::now();
-    std::function<bool()> should_loop = this->create_loop_predicate(time_to_wait_ns, start);
 
     // Wait until exit condition is met.
     do {
@@ -292,7 +291,7 @@ protected:
         // Some other error case, throw.
         rclcpp::exceptions::throw_from_rcl_error(ret);
       }
-    } while (should_loop());
+    } while (this->should_keep_looping(time_to_wait_ns, start));
 
     // Wait did not result in ready items, return timeout.
     return create_wait_result(WaitResultKind::Timeout);
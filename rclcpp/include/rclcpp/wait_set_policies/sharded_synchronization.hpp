@@ -0,0 +1,409 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__WAIT_SET_POLICIES__SHARDED_SYNCHRONIZATION_HPP_
+#define RCLCPP__WAIT_SET_POLICIES__SHARDED_SYNCHRONIZATION_HPP_
+
+#include <array>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <utility>
+
+#include "rclcpp/client.hpp"
+#include "rclcpp/exceptions.hpp"
+#include "rclcpp/guard_condition.hpp"
+#include "rclcpp/macros.hpp"
+#include "rclcpp/service.hpp"
+#include "rclcpp/subscription_base.hpp"
+#include "rclcpp/subscription_wait_set_mask.hpp"
+#include "rclcpp/timer.hpp"
+#include "rclcpp/visibility_control.hpp"
+#include "rclcpp/wait_result.hpp"
+#include "rclcpp/wait_result_kind.hpp"
+#include "rclcpp/wait_set_policies/detail/synchronization_policy_common.hpp"
+#include "rclcpp/waitable.hpp"
+
+namespace rclcpp
+{
+namespace wait_set_policies
+{
+
+/// WaitSet policy that minimizes contention between waiting and registration.
+/**
+ * Unlike ThreadSafeSynchronization, which serializes every wait-related
+ * activity against every add and remove with a single-reader lock, this
+ * policy splits the locking in two:
+ *
+ *   - The entity lists are guarded by one shared mutex per entity kind, so
+ *     adding a timer does not contend with adding a subscription, and the
+ *     wait path only holds these (shared) while it rebuilds the rcl wait set.
+ *   - The rcl wait set itself is guarded by a separate mutex held while
+ *     rebuilding and while a WaitResult is in scope.
+ *
+ * As a result, adding or removing an entity blocks only for the duration of a
+ * concurrent rebuild plus the list update itself; it no longer stalls behind
+ * a blocking wait() (which is interrupted with a guard condition, as with
+ * ThreadSafeSynchronization) nor behind a WaitResult held in scope.
+ * Entities removed while a WaitResult is held stay alive until the result is
+ * released, because the wait path holds shared ownership of everything it
+ * waited on.
+ *
+ * Only one thread may call wait() at a time, as with the other policies,
+ * since concurrent waits share the same underlying rcl wait set.
+ */
+class ShardedSynchronization : public detail::SynchronizationPolicyCommon
+{
+protected:
+  explicit ShardedSynchronization(rclcpp::Context::SharedPtr context)
+  : extra_guard_conditions_{{std::make_shared<rclcpp::GuardCondition>(context)}}
+  {}
+  ~ShardedSynchronization() = default;
+
+  /// Return any "extra" guard conditions needed to implement the synchronization policy.
+  /**
+   * This policy has one guard condition which is used to interrupt the wait
+   * set when adding and removing entities.
+   */
+  const std::array<std::shared_ptr<rclcpp::GuardCondition>, 1> &
+  get_extra_guard_conditions()
+  {
+    return extra_guard_conditions_;
+  }
+
+  /// Interrupt any waiting wait set.
+  /**
+   * Used to wake a blocking wait so the next rebuild observes a change to the
+   * entity lists.
+   */
+  void
+  interrupt_waiting_wait_set()
+  {
+    extra_guard_conditions_[0]->trigger();
+  }
+
+  /// Add subscription.
+  void
+  sync_add_subscription(
+    std::shared_ptr<rclcpp::SubscriptionBase> && subscription,
+    const rclcpp::SubscriptionWaitSetMask & mask,
+    std::function<
+      void(std::shared_ptr<rclcpp::SubscriptionBase>&&, const rclcpp::SubscriptionWaitSetMask &)
+    > add_subscription_function)
+  {
+    {
+      // The mask may route the subscription's event handlers and intra-process
+      // waitable into the waitable list, so both shards are needed.
+      std::scoped_lock lock(shards_[kSubscriptionShard], shards_[kWaitableShard]);
+      add_subscription_function(std::move(subscription), mask);
+    }
+    this->interrupt_waiting_wait_set();
+  }
+
+  /// Remove subscription.
+  void
+  sync_remove_subscription(
+    std::shared_ptr<rclcpp::SubscriptionBase> && subscription,
+    const rclcpp::SubscriptionWaitSetMask & mask,
+    std::function<
+      void(std::shared_ptr<rclcpp::SubscriptionBase>&&, const rclcpp::SubscriptionWaitSetMask &)
+    > remove_subscription_function)
+  {
+    {
+      std::scoped_lock lock(shards_[kSubscriptionShard], shards_[kWaitableShard]);
+      remove_subscription_function(std::move(subscription), mask);
+    }
+    this->interrupt_waiting_wait_set();
+  }
+
+  /// Add guard condition.
+  void
+  sync_add_guard_condition(
+    std::shared_ptr<rclcpp::GuardCondition> && guard_condition,
+    std::function<void(std::shared_ptr<rclcpp::GuardCondition>&&)> add_guard_condition_function)
+  {
+    {
+      std::lock_guard<std::shared_timed_mutex> lock(shards_[kGuardConditionShard]);
+      add_guard_condition_function(std::move(guard_condition));
+    }
+    this->interrupt_waiting_wait_set();
+  }
+
+  /// Remove guard condition.
+  void
+  sync_remove_guard_condition(
+    std::shared_ptr<rclcpp::GuardCondition> && guard_condition,
+    std::function<void(std::shared_ptr<rclcpp::GuardCondition>&&)> remove_guard_condition_function)
+  {
+    {
+      std::lock_guard<std::shared_timed_mutex> lock(shards_[kGuardConditionShard]);
+      remove_guard_condition_function(std::move(guard_condition));
+    }
+    this->interrupt_waiting_wait_set();
+  }
+
+  /// Add timer.
+  void
+  sync_add_timer(
+    std::shared_ptr<rclcpp::TimerBase> && timer,
+    std::function<void(std::shared_ptr<rclcpp::TimerBase>&&)> add_timer_function)
+  {
+    {
+      std::lock_guard<std::shared_timed_mutex> lock(shards_[kTimerShard]);
+      add_timer_function(std::move(timer));
+    }
+    this->interrupt_waiting_wait_set();
+  }
+
+  /// Remove timer.
+  void
+  sync_remove_timer(
+    std::shared_ptr<rclcpp::TimerBase> && timer,
+    std::function<void(std::shared_ptr<rclcpp::TimerBase>&&)> remove_timer_function)
+  {
+    {
+      std::lock_guard<std::shared_timed_mutex> lock(shards_[kTimerShard]);
+      remove_timer_function(std::move(timer));
+    }
+    this->interrupt_waiting_wait_set();
+  }
+
+  /// Add client.
+  void
+  sync_add_client(
+    std::shared_ptr<rclcpp::ClientBase> && client,
+    std::function<void(std::shared_ptr<rclcpp::ClientBase>&&)> add_client_function)
+  {
+    {
+      std::lock_guard<std::shared_timed_mutex> lock(shards_[kClientShard]);
+      add_client_function(std::move(client));
+    }
+    this->interrupt_waiting_wait_set();
+  }
+
+  /// Remove client.
+  void
+  sync_remove_client(
+    std::shared_ptr<rclcpp::ClientBase> && client,
+    std::function<void(std::shared_ptr<rclcpp::ClientBase>&&)> remove_client_function)
+  {
+    {
+      std::lock_guard<std::shared_timed_mutex> lock(shards_[kClientShard]);
+      remove_client_function(std::move(client));
+    }
+    this->interrupt_waiting_wait_set();
+  }
+
+  /// Add service.
+  void
+  sync_add_service(
+    std::shared_ptr<rclcpp::ServiceBase> && service,
+    std::function<void(std::shared_ptr<rclcpp::ServiceBase>&&)> add_service_function)
+  {
+    {
+      std::lock_guard<std::shared_timed_mutex> lock(shards_[kServiceShard]);
+      add_service_function(std::move(service));
+    }
+    this->interrupt_waiting_wait_set();
+  }
+
+  /// Remove service.
+  void
+  sync_remove_service(
+    std::shared_ptr<rclcpp::ServiceBase> && service,
+    std::function<void(std::shared_ptr<rclcpp::ServiceBase>&&)> remove_service_function)
+  {
+    {
+      std::lock_guard<std::shared_timed_mutex> lock(shards_[kServiceShard]);
+      remove_service_function(std::move(service));
+    }
+    this->interrupt_waiting_wait_set();
+  }
+
+  /// Add waitable.
+  void
+  sync_add_waitable(
+    std::shared_ptr<rclcpp::Waitable> && waitable,
+    std::shared_ptr<void> && associated_entity,
+    std::function<
+      void(std::shared_ptr<rclcpp::Waitable>&&, std::shared_ptr<void> &&)
+    > add_waitable_function)
+  {
+    {
+      std::lock_guard<std::shared_timed_mutex> lock(shards_[kWaitableShard]);
+      add_waitable_function(std::move(waitable), std::move(associated_entity));
+    }
+    this->interrupt_waiting_wait_set();
+  }
+
+  /// Remove waitable.
+  void
+  sync_remove_waitable(
+    std::shared_ptr<rclcpp::Waitable> && waitable,
+    std::function<void(std::shared_ptr<rclcpp::Waitable>&&)> remove_waitable_function)
+  {
+    {
+      std::lock_guard<std::shared_timed_mutex> lock(shards_[kWaitableShard]);
+      remove_waitable_function(std::move(waitable));
+    }
+    this->interrupt_waiting_wait_set();
+  }
+
+  /// Prune deleted entities.
+  void
+  sync_prune_deleted_entities(std::function<void()> prune_deleted_entities_function)
+  {
+    {
+      // Pruning mutates every entity list and the pruning flag shared with
+      // the rebuild, so take the rcl wait set mutex and all shards exclusively.
+      std::lock_guard<std::mutex> rcl_set_lock(rcl_wait_set_mutex_);
+      std::scoped_lock lock(
+        shards_[kSubscriptionShard],
+        shards_[kGuardConditionShard],
+        shards_[kTimerShard],
+        shards_[kClientShard],
+        shards_[kServiceShard],
+        shards_[kWaitableShard]);
+      prune_deleted_entities_function();
+    }
+    this->interrupt_waiting_wait_set();
+  }
+
+  /// Implements wait.
+  template<class WaitResultT, class RebuildRclWaitSetF, class GetRclWaitSetF, class CreateResultF>
+  WaitResultT
+  sync_wait(
+    std::chrono::nanoseconds time_to_wait_ns,
+    RebuildRclWaitSetF rebuild_rcl_wait_set,
+    GetRclWaitSetF get_rcl_wait_set,
+    CreateResultF create_wait_result)
+  {
+    // Assumption: this function assumes that some measure has been taken to
+    // ensure none of the entities being waited on by the wait set are allowed
+    // to go out of scope and therefore be deleted, see the comment in
+    // ThreadSafeSynchronization::sync_wait().
+
+    // Record the start time for the looping deadline check.
+    auto start = std::chrono::steady_clock::now();
+
+    // Wait until exit condition is met.
+    do {
+      {
+        // Rebuilding writes the rcl wait set and reads every entity list, so
+        // it must exclude WaitResult holders and concurrent rebuilds, and
+        // take every shard shared; concurrent adds and removes only contend
+        // for this long.
+        std::lock_guard<std::mutex> rcl_set_lock(rcl_wait_set_mutex_);
+        std::array<std::shared_lock<std::shared_timed_mutex>, kNumberOfShards> shard_locks;
+        for (size_t index = 0; index < kNumberOfShards; ++index) {
+          shard_locks[index] = std::shared_lock<std::shared_timed_mutex>(shards_[index]);
+        }
+        rebuild_rcl_wait_set();
+      }
+
+      rcl_wait_set_t & rcl_wait_set = get_rcl_wait_set();
+
+      // Calculate how much time there is left to wait, unless blocking indefinitely.
+      auto time_left_to_wait_ns = this->calculate_time_left_to_wait(time_to_wait_ns, start);
+
+      // Then wait for entities to become ready.
+      // It is ok to wait while not holding any lock, because the rcl wait set
+      // is not updated again until this method loops and rebuilds it.
+      rcl_ret_t ret = rcl_wait(&rcl_wait_set, time_left_to_wait_ns.count());
+      if (RCL_RET_OK == ret) {
+        // Something has become ready in the wait set, first check if it was
+        // the guard condition added by this class and/or a user defined guard condition.
+        const rcl_guard_condition_t * interrupt_guard_condition_ptr =
+          &(extra_guard_conditions_[0]->get_rcl_guard_condition());
+        bool was_interrupted_by_this_class = false;
+        bool any_user_guard_conditions_triggered = false;
+        for (size_t index = 0; index < rcl_wait_set.size_of_guard_conditions; ++index) {
+          const rcl_guard_condition_t * current = rcl_wait_set.guard_conditions[index];
+          if (nullptr != current) {
+            // Something is ready.
+            if (current == interrupt_guard_condition_ptr) {
+              // This means that this class triggered a guard condition to interrupt this wait.
+              was_interrupted_by_this_class = true;
+            } else {
+              // This means it was a user guard condition.
+              any_user_guard_conditions_triggered = true;
+            }
+          }
+        }
+
+        if (!was_interrupted_by_this_class || any_user_guard_conditions_triggered) {
+          // Something the user cares about is ready; user guard conditions
+          // cannot be ignored because waiting again would clear them.
+          return create_wait_result(WaitResultKind::Ready);
+        }
+        // Otherwise this class interrupted the wait to pick up an entity list
+        // change, so loop and rebuild the rcl wait set.
+      } else if (RCL_RET_TIMEOUT == ret) {
+        // The wait set timed out, exit the loop.
+        break;
+      } else if (RCL_RET_WAIT_SET_EMPTY == ret) {
+        // Wait set was empty, return Empty.
+        return create_wait_result(WaitResultKind::Empty);
+      } else {
+        // Some other error case, throw.
+        rclcpp::exceptions::throw_from_rcl_error(ret);
+      }
+    } while (this->should_keep_looping(time_to_wait_ns, start));
+
+    // Wait did not result in ready items, return timeout.
+    return create_wait_result(WaitResultKind::Timeout);
+  }
+
+  void
+  sync_wait_result_acquire()
+  {
+    // Only the rcl wait set needs protecting while results are introspected;
+    // registration can proceed against the entity lists concurrently.
+    rcl_wait_set_mutex_.lock();
+  }
+
+  void
+  sync_wait_result_release()
+  {
+    rcl_wait_set_mutex_.unlock();
+  }
+
+protected:
+  /// One lock shard per entity kind.
+  enum ShardIndex : std::size_t
+  {
+    kSubscriptionShard = 0,
+    kGuardConditionShard,
+    kTimerShard,
+    kClientShard,
+    kServiceShard,
+    kWaitableShard,
+    kNumberOfShards,
+  };
+
+  std::array<std::shared_ptr<rclcpp::GuardCondition>, 1> extra_guard_conditions_;
+  /// Guards the entity lists, sharded so registrations of different kinds
+  /// do not contend with each other.
+  std::array<std::shared_timed_mutex, kNumberOfShards> shards_;
+  /// Guards the rcl wait set arrays, held while rebuilding and while a
+  /// WaitResult is in scope.
+  std::mutex rcl_wait_set_mutex_;
+};
+
+}  // namespace wait_set_policies
+}  // namespace rclcpp
+
+#endif  // RCLCPP__WAIT_SET_POLICIES__SHARDED_SYNCHRONIZATION_HPP_
@@ -20,6 +20,7 @@
 #include <utility>
 
 #include "rclcpp/client.hpp"
+#include "rclcpp/exceptions.hpp"
 #include "rclcpp/guard_condition.hpp"
 #include "rclcpp/macros.hpp"
 #include "rclcpp/service.hpp"
@@ -39,6 +40,15 @@ namespace wait_set_policies
 /**
  * Note the underlying rcl_wait_set_t is still dynamically allocated, but only
  * once during construction, and deallocated once during destruction.
+ *
+ * The capacities are fixed by the template arguments and the entity arrays
+ * are exactly that size, so exceeding a capacity is rejected at compile time
+ * rather than at runtime.
+ * Construction rejects empty slots, so after construction every slot is known
+ * to be occupied and the per-wait preparation refills the rcl wait set from
+ * rcl handles cached once at construction, without the per-entity null checks
+ * or resize and prune bookkeeping the dynamic storage needs; entity kinds
+ * with zero capacity compile to nothing.
  */
 template<
   std::size_t NumberOfSubscriptions,
@@ -143,7 +153,27 @@ public:
     clients_(clients),
     services_(services),
     waitables_(waitables)
-  {}
+  {
+    // The base class constructor rebuilt the wait set once from the entity
+    // arrays and threw if any slot was empty, so every entry is non-null here
+    // and owned for the life of this storage; cache the rcl handles so
+    // refilling the wait set each wait does not have to reacquire them.
+    for (std::size_t i = 0; i < NumberOfSubscriptions; ++i) {
+      subscription_handles_[i] = subscriptions_[i].subscription->get_subscription_handle().get();
+    }
+    for (std::size_t i = 0; i < NumberOfGuardCondtions; ++i) {
+      guard_condition_handles_[i] = &guard_conditions_[i]->get_rcl_guard_condition();
+    }
+    for (std::size_t i = 0; i < NumberOfTimers; ++i) {
+      timer_handles_[i] = timers_[i]->get_timer_handle().get();
+    }
+    for (std::size_t i = 0; i < NumberOfClients; ++i) {
+      client_handles_[i] = clients_[i]->get_client_handle().get();
+    }
+    for (std::size_t i = 0; i < NumberOfServices; ++i) {
+      service_handles_[i] = services_[i]->get_service_handle().get();
+    }
+  }
 
   ~StaticStorage() = default;
 
@@ -151,15 +181,73 @@ public:
   void
   storage_rebuild_rcl_wait_set(const ArrayOfExtraGuardConditions & extra_guard_conditions)
   {
-    this->storage_rebuild_rcl_wait_set_with_sets(
-      subscriptions_,
-      guard_conditions_,
-      extra_guard_conditions,
-      timers_,
-      clients_,
-      services_,
-      waitables_
-    );
+    // Static storage never needs resizing or pruning, and construction
+    // rejected empty slots, so preparing for a wait degenerates to refilling
+    // the wait set from the cached handles.
+    // Entity kinds with zero capacity are skipped at compile time.
+    rcl_ret_t ret = rcl_wait_set_clear(&this->rcl_wait_set_);
+    if (RCL_RET_OK != ret) {
+      rclcpp::exceptions::throw_from_rcl_error(ret);
+    }
+    if constexpr (NumberOfSubscriptions != 0) {
+      for (auto * subscription_handle : subscription_handles_) {
+        ret = rcl_wait_set_add_subscription(&this->rcl_wait_set_, subscription_handle, nullptr);
+        if (RCL_RET_OK != ret) {
+          rclcpp::exceptions::throw_from_rcl_error(ret);
+        }
+      }
+    }
+    if constexpr (NumberOfGuardCondtions != 0) {
+      for (std::size_t i = 0; i < NumberOfGuardCondtions; ++i) {
+        ret = rcl_wait_set_add_guard_condition(
+          &this->rcl_wait_set_, guard_condition_handles_[i], nullptr);
+        if (RCL_RET_OK != ret) {
+          rclcpp::exceptions::throw_from_rcl_error(ret);
+        }
+        // The wait set now observes the guard condition again, deliver any
+        // trigger that deduplication suppressed while it was not waited on.
+        guard_conditions_[i]->retrigger_if_pending();
+      }
+    }
+    if constexpr (std::tuple_size<ArrayOfExtraGuardConditions>::value != 0) {
+      for (const auto & extra_guard_condition : extra_guard_conditions) {
+        ret = rcl_wait_set_add_guard_condition(
+          &this->rcl_wait_set_, &extra_guard_condition->get_rcl_guard_condition(), nullptr);
+        if (RCL_RET_OK != ret) {
+          rclcpp::exceptions::throw_from_rcl_error(ret);
+        }
+        extra_guard_condition->retrigger_if_pending();
+      }
+    }
+    if constexpr (NumberOfTimers != 0) {
+      for (auto * timer_handle : timer_handles_) {
+        ret = rcl_wait_set_add_timer(&this->rcl_wait_set_, timer_handle, nullptr);
+        if (RCL_RET_OK != ret) {
+          rclcpp::exceptions::throw_from_rcl_error(ret);
+        }
+      }
+    }
+    if constexpr (NumberOfClients != 0) {
+      for (auto * client_handle : client_handles_) {
+        ret = rcl_wait_set_add_client(&this->rcl_wait_set_, client_handle, nullptr);
+        if (RCL_RET_OK != ret) {
+          rclcpp::exceptions::throw_from_rcl_error(ret);
+        }
+      }
+    }
+    if constexpr (NumberOfServices != 0) {
+      for (auto * service_handle : service_handles_) {
+        ret = rcl_wait_set_add_service(&this->rcl_wait_set_, service_handle, nullptr);
+        if (RCL_RET_OK != ret) {
+          rclcpp::exceptions::throw_from_rcl_error(ret);
+        }
+      }
+    }
+    if constexpr (NumberOfWaitables != 0) {
+      for (const auto & waitable_entry : waitables_) {
+        waitable_entry.waitable->add_to_wait_set(&this->rcl_wait_set_);
+      }
+    }
   }
 
   // storage_add_subscription() explicitly not declared here
@@ -194,6 +282,14 @@ public:
   const ArrayOfClients clients_;
   const ArrayOfServices services_;
   const ArrayOfWaitables waitables_;
+
+  // rcl handles cached at construction, valid as long as the owning entity
+  // arrays above, which are const and share ownership for the life of this.
+  std::array<rcl_subscription_t *, NumberOfSubscriptions> subscription_handles_;
+  std::array<rcl_guard_condition_t *, NumberOfGuardCondtions> guard_condition_handles_;
+  std::array<rcl_timer_t *, NumberOfTimers> timer_handles_;
+  std::array<rcl_client_t *, NumberOfClients> client_handles_;
+  std::array<rcl_service_t *, NumberOfServices> service_handles_;
 };
 
 }  // namespace wait_set_policies
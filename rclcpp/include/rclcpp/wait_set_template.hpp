@@ -17,6 +17,7 @@
 
 #include <chrono>
 #include <memory>
+#include <unordered_map>
 #include <utility>
 
 #include "rcl/wait.h"
@@ -52,6 +53,9 @@ public:
   using typename StoragePolicy::SubscriptionEntry;
   using typename StoragePolicy::WaitableEntry;
 
+  /// The result type produced by wait() and reused by wait_into().
+  using ResultT = WaitResult<WaitSetTemplate>;
+
   /// Construct a wait set with optional initial waitable entities and optional custom context.
   /**
    * For the waitables, they have additionally an "associated" entity, which
@@ -119,8 +123,15 @@ public:
    * pointer, for more easily figuring out which subscription which waitable
    * goes with afterwards.
    *
+   * Additionally, an optional user tag may be given, which is reported back
+   * together with the subscription, or with any waitable added on its behalf,
+   * when visiting ready entities after waiting, see
+   * WaitResult::for_each_ready().
+   *
    * \param[in] subscription Subscription to be added.
    * \param[in] mask A class which controls which parts of the subscription to add.
+   * \param[in] tag User tag reported with the subscription when it is ready,
+   *   ignored if nullptr.
    * \throws std::invalid_argument if subscription is nullptr.
    * \throws std::runtime_error if subscription has already been added or is
    *   associated with another wait set.
@@ -129,7 +140,8 @@ public:
   void
   add_subscription(
     std::shared_ptr<rclcpp::SubscriptionBase> subscription,
-    rclcpp::SubscriptionWaitSetMask mask = {})
+    rclcpp::SubscriptionWaitSetMask mask = {},
+    const void * tag = nullptr)
   {
     if (nullptr == subscription) {
       throw std::invalid_argument("subscription is nullptr");
@@ -138,7 +150,7 @@ public:
     this->sync_add_subscription(
       std::move(subscription),
       mask,
-      [this](
+      [this, tag](
         std::shared_ptr<rclcpp::SubscriptionBase> && inner_subscription,
         const rclcpp::SubscriptionWaitSetMask & mask)
       {
@@ -152,6 +164,7 @@ public:
           if (already_in_use) {
             throw std::runtime_error("subscription already associated with a wait set");
           }
+          this->set_entity_tag(local_subscription.get(), tag);
           this->storage_add_subscription(std::move(local_subscription));
         }
         if (mask.include_events) {
@@ -163,6 +176,7 @@ public:
             if (already_in_use) {
               throw std::runtime_error("subscription event already associated with a wait set");
             }
+            this->set_entity_tag(event.get(), tag);
             this->storage_add_waitable(std::move(event), std::move(local_subscription));
           }
         }
@@ -177,6 +191,7 @@ public:
               throw std::runtime_error(
                 "subscription intra-process waitable already associated with a wait set");
             }
+            this->set_entity_tag(waitable.get(), tag);
             this->storage_add_waitable(
               std::move(inner_subscription->get_intra_process_waitable()),
               std::move(local_subscription));
@@ -223,6 +238,7 @@ public:
         if (mask.include_subscription) {
           auto local_subscription = inner_subscription;
           local_subscription->exchange_in_use_by_wait_set_state(local_subscription.get(), false);
+          this->clear_entity_tag(local_subscription.get());
           this->storage_remove_subscription(std::move(local_subscription));
         }
         if (mask.include_events) {
@@ -230,6 +246,7 @@ public:
             auto event = key_event_pair.second;
             auto local_subscription = inner_subscription;
             local_subscription->exchange_in_use_by_wait_set_state(event.get(), false);
+            this->clear_entity_tag(event.get());
             this->storage_remove_waitable(std::move(event));
           }
         }
@@ -238,6 +255,7 @@ public:
           if (nullptr != local_waitable) {
             // This is the case when intra process is enabled for the subscription.
             inner_subscription->exchange_in_use_by_wait_set_state(local_waitable.get(), false);
+            this->clear_entity_tag(local_waitable.get());
             this->storage_remove_waitable(std::move(local_waitable));
           }
         }
@@ -265,14 +283,22 @@ public:
    * This function will not be enabled (will not be available) if the
    * StoragePolicy does not allow editing of the wait set after initialization.
    *
+   * Additionally, an optional user tag may be given, which is reported back
+   * together with the guard condition when visiting ready entities after
+   * waiting, see WaitResult::for_each_ready().
+   *
    * \param[in] guard_condition Guard condition to be added.
+   * \param[in] tag User tag reported with the guard condition when it is
+   *   ready, ignored if nullptr.
    * \throws std::invalid_argument if guard_condition is nullptr.
    * \throws std::runtime_error if guard_condition has already been added or is
    *   associated with another wait set.
    * \throws exceptions based on the policies used.
    */
   void
-  add_guard_condition(std::shared_ptr<rclcpp::GuardCondition> guard_condition)
+  add_guard_condition(
+    std::shared_ptr<rclcpp::GuardCondition> guard_condition,
+    const void * tag = nullptr)
   {
     if (nullptr == guard_condition) {
       throw std::invalid_argument("guard_condition is nullptr");
@@ -280,11 +306,12 @@ public:
     // this method comes from the SynchronizationPolicy
     this->sync_add_guard_condition(
       std::move(guard_condition),
-      [this](std::shared_ptr<rclcpp::GuardCondition> && inner_guard_condition) {
+      [this, tag](std::shared_ptr<rclcpp::GuardCondition> && inner_guard_condition) {
         bool already_in_use = inner_guard_condition->exchange_in_use_by_wait_set_state(true);
         if (already_in_use) {
           throw std::runtime_error("guard condition already in use by another wait set");
         }
+        this->set_entity_tag(inner_guard_condition.get(), tag);
         // This method comes from the StoragePolicy, and it may not exist for
         // fixed sized storage policies.
         // It will throw if the guard condition has already been added.
@@ -322,6 +349,7 @@ public:
       std::move(guard_condition),
       [this](std::shared_ptr<rclcpp::GuardCondition> && inner_guard_condition) {
         inner_guard_condition->exchange_in_use_by_wait_set_state(false);
+        this->clear_entity_tag(inner_guard_condition.get());
         // This method comes from the StoragePolicy, and it may not exist for
         // fixed sized storage policies.
         // It will throw if the guard condition is not in the wait set.
@@ -334,13 +362,15 @@ public:
    * \sa add_guard_condition() for details of how this method works.
    *
    * \param[in] timer Timer to be added.
+   * \param[in] tag User tag reported with the timer when it is ready, see
+   *   add_guard_condition(), ignored if nullptr.
    * \throws std::invalid_argument if timer is nullptr.
    * \throws std::runtime_error if timer has already been added or is
    *   associated with another wait set.
    * \throws exceptions based on the policies used.
    */
   void
-  add_timer(std::shared_ptr<rclcpp::TimerBase> timer)
+  add_timer(std::shared_ptr<rclcpp::TimerBase> timer, const void * tag = nullptr)
   {
     if (nullptr == timer) {
       throw std::invalid_argument("timer is nullptr");
@@ -348,11 +378,12 @@ public:
     // this method comes from the SynchronizationPolicy
     this->sync_add_timer(
       std::move(timer),
-      [this](std::shared_ptr<rclcpp::TimerBase> && inner_timer) {
+      [this, tag](std::shared_ptr<rclcpp::TimerBase> && inner_timer) {
         bool already_in_use = inner_timer->exchange_in_use_by_wait_set_state(true);
         if (already_in_use) {
           throw std::runtime_error("timer already in use by another wait set");
         }
+        this->set_entity_tag(inner_timer.get(), tag);
         // This method comes from the StoragePolicy, and it may not exist for
         // fixed sized storage policies.
         // It will throw if the timer has already been added.
@@ -380,6 +411,7 @@ public:
       std::move(timer),
       [this](std::shared_ptr<rclcpp::TimerBase> && inner_timer) {
         inner_timer->exchange_in_use_by_wait_set_state(false);
+        this->clear_entity_tag(inner_timer.get());
         // This method comes from the StoragePolicy, and it may not exist for
         // fixed sized storage policies.
         // It will throw if the timer is not in the wait set.
@@ -392,13 +424,15 @@ public:
    * \sa add_guard_condition() for details of how this method works.
    *
    * \param[in] client Client to be added.
+   * \param[in] tag User tag reported with the client when it is ready, see
+   *   add_guard_condition(), ignored if nullptr.
    * \throws std::invalid_argument if client is nullptr.
    * \throws std::runtime_error if client has already been added or is
    *   associated with another wait set.
    * \throws exceptions based on the policies used.
    */
   void
-  add_client(std::shared_ptr<rclcpp::ClientBase> client)
+  add_client(std::shared_ptr<rclcpp::ClientBase> client, const void * tag = nullptr)
   {
     if (nullptr == client) {
       throw std::invalid_argument("client is nullptr");
@@ -406,11 +440,12 @@ public:
     // this method comes from the SynchronizationPolicy
     this->sync_add_client(
       std::move(client),
-      [this](std::shared_ptr<rclcpp::ClientBase> && inner_client) {
+      [this, tag](std::shared_ptr<rclcpp::ClientBase> && inner_client) {
         bool already_in_use = inner_client->exchange_in_use_by_wait_set_state(true);
         if (already_in_use) {
           throw std::runtime_error("client already in use by another wait set");
         }
+        this->set_entity_tag(inner_client.get(), tag);
         // This method comes from the StoragePolicy, and it may not exist for
         // fixed sized storage policies.
         // It will throw if the client has already been added.
@@ -438,6 +473,7 @@ public:
       std::move(client),
       [this](std::shared_ptr<rclcpp::ClientBase> && inner_client) {
         inner_client->exchange_in_use_by_wait_set_state(false);
+        this->clear_entity_tag(inner_client.get());
         // This method comes from the StoragePolicy, and it may not exist for
         // fixed sized storage policies.
         // It will throw if the client is not in the wait set.
@@ -450,13 +486,15 @@ public:
    * \sa add_guard_condition() for details of how this method works.
    *
    * \param[in] service Service to be added.
+   * \param[in] tag User tag reported with the service when it is ready, see
+   *   add_guard_condition(), ignored if nullptr.
    * \throws std::invalid_argument if service is nullptr.
    * \throws std::runtime_error if service has already been added or is
    *   associated with another wait set.
    * \throws exceptions based on the policies used.
    */
   void
-  add_service(std::shared_ptr<rclcpp::ServiceBase> service)
+  add_service(std::shared_ptr<rclcpp::ServiceBase> service, const void * tag = nullptr)
   {
     if (nullptr == service) {
       throw std::invalid_argument("service is nullptr");
@@ -464,11 +502,12 @@ public:
     // this method comes from the SynchronizationPolicy
     this->sync_add_service(
       std::move(service),
-      [this](std::shared_ptr<rclcpp::ServiceBase> && inner_service) {
+      [this, tag](std::shared_ptr<rclcpp::ServiceBase> && inner_service) {
         bool already_in_use = inner_service->exchange_in_use_by_wait_set_state(true);
         if (already_in_use) {
           throw std::runtime_error("service already in use by another wait set");
         }
+        this->set_entity_tag(inner_service.get(), tag);
         // This method comes from the StoragePolicy, and it may not exist for
         // fixed sized storage policies.
         // It will throw if the service has already been added.
@@ -496,6 +535,7 @@ public:
       std::move(service),
       [this](std::shared_ptr<rclcpp::ServiceBase> && inner_service) {
         inner_service->exchange_in_use_by_wait_set_state(false);
+        this->clear_entity_tag(inner_service.get());
         // This method comes from the StoragePolicy, and it may not exist for
         // fixed sized storage policies.
         // It will throw if the service is not in the wait set.
@@ -522,6 +562,8 @@ public:
    * \param[in] waitable Waitable to be added.
    * \param[in] associated_entity Type erased shared pointer associated with the waitable.
    *   This may be nullptr.
+   * \param[in] tag User tag reported with the waitable when it is ready, see
+   *   add_guard_condition(), ignored if nullptr.
    * \throws std::invalid_argument if waitable is nullptr.
    * \throws std::runtime_error if waitable has already been added or is
    *   associated with another wait set.
@@ -530,7 +572,8 @@ public:
   void
   add_waitable(
     std::shared_ptr<rclcpp::Waitable> waitable,
-    std::shared_ptr<void> associated_entity = nullptr)
+    std::shared_ptr<void> associated_entity = nullptr,
+    const void * tag = nullptr)
   {
     if (nullptr == waitable) {
       throw std::invalid_argument("waitable is nullptr");
@@ -539,7 +582,7 @@ public:
     this->sync_add_waitable(
       std::move(waitable),
       std::move(associated_entity),
-      [this](
+      [this, tag](
         std::shared_ptr<rclcpp::Waitable> && inner_waitable,
         std::shared_ptr<void> && associated_entity)
       {
@@ -547,6 +590,7 @@ public:
         if (already_in_use) {
           throw std::runtime_error("waitable already in use by another wait set");
         }
+        this->set_entity_tag(inner_waitable.get(), tag);
         // This method comes from the StoragePolicy, and it may not exist for
         // fixed sized storage policies.
         // It will throw if the waitable has already been added.
@@ -574,6 +618,7 @@ public:
       std::move(waitable),
       [this](std::shared_ptr<rclcpp::Waitable> && inner_waitable) {
         inner_waitable->exchange_in_use_by_wait_set_state(false);
+        this->clear_entity_tag(inner_waitable.get());
         // This method comes from the StoragePolicy, and it may not exist for
         // fixed sized storage policies.
         // It will throw if the waitable is not in the wait set.
@@ -696,6 +741,120 @@ public:
     );
   }
 
+  /// Wait, reusing a caller-held WaitResult instead of creating a new one.
+  /**
+   * Re-entrant variant of wait() for tight wait loops: the given result is
+   * released (dropping any hold it still had from the previous cycle) and then
+   * assigned in place, so a loop of the form
+   *
+   *     rclcpp::WaitSet::ResultT result;
+   *     while (ok) {
+   *       if (wait_set.wait_into(result, timeout) == rclcpp::WaitResultKind::Ready) {
+   *         // introspect result.get_wait_set() ...
+   *       }
+   *     }
+   *
+   * performs no allocations per cycle: the result is a kind plus a back
+   * reference, and the storage policies reuse their preallocated ownership
+   * caches, whose indices are stable between waits unless entities are added
+   * or removed.
+   *
+   * \sa wait() for the waiting semantics and possible exceptions.
+   * \param[inout] result Result object to be reused; any previous hold it has
+   *   on this or another wait set is released first.
+   * \param[in] time_to_wait Same semantics as the wait() parameter.
+   * \returns the kind of the result, same as result.kind() afterwards.
+   */
+  template<class Rep = int64_t, class Period = std::milli>
+  WaitResultKind
+  wait_into(
+    WaitResult<WaitSetTemplate> & result,
+    std::chrono::duration<Rep, Period> time_to_wait = std::chrono::duration<Rep, Period>(-1))
+  {
+    // Release up front: a result still holding this wait set would otherwise
+    // make the acquisition for the new wait throw.
+    result.reset();
+    result = this->wait(time_to_wait);
+    return result.kind();
+  }
+
+  /// Visit each entity left ready by the most recent wait, with its user tag.
+  /**
+   * Walks the entities this wait set added directly to the rcl wait set, in
+   * parallel with the rcl wait set arrays, and invokes the matching visitor
+   * for each entry left ready by the wait, together with the tag given when
+   * the entity was added, nullptr if none was given.
+   * Entries contributed by waitables are not reported individually; instead
+   * each waitable which reports itself ready is passed to the waitable
+   * visitor.
+   * Guard conditions internal to the synchronization policy may also be
+   * visited, with a nullptr tag, just as they are visible when scanning the
+   * rcl wait set directly.
+   *
+   * This should only be called between a wait returning ready and the next
+   * wait, while the WaitResult is held, normally via
+   * WaitResult::for_each_ready() rather than directly.
+   *
+   * \param[in] visitors per-kind callbacks, unset ones skip their kind.
+   */
+  void
+  for_each_ready_entity(const ReadyEntityVisitors & visitors)
+  {
+    // Both methods used here come from the StoragePolicy.
+    auto & rcl_wait_set = this->storage_get_rcl_wait_set();
+    const auto & slots = this->storage_get_rcl_wait_set_slots();
+    // The slot records only cover the leading entries of each rcl array;
+    // any trailing entries were added by waitables and are reported through
+    // the waitable visitor instead.
+    if (visitors.subscription) {
+      for (size_t ii = 0; ii < slots.subscriptions.size(); ++ii) {
+        if (nullptr != rcl_wait_set.subscriptions[ii]) {
+          auto entity = slots.subscriptions[ii];
+          visitors.subscription(*entity, this->get_entity_tag(entity));
+        }
+      }
+    }
+    if (visitors.guard_condition) {
+      for (size_t ii = 0; ii < slots.guard_conditions.size(); ++ii) {
+        if (nullptr != rcl_wait_set.guard_conditions[ii]) {
+          auto entity = slots.guard_conditions[ii];
+          visitors.guard_condition(*entity, this->get_entity_tag(entity));
+        }
+      }
+    }
+    if (visitors.timer) {
+      for (size_t ii = 0; ii < slots.timers.size(); ++ii) {
+        if (nullptr != rcl_wait_set.timers[ii]) {
+          auto entity = slots.timers[ii];
+          visitors.timer(*entity, this->get_entity_tag(entity));
+        }
+      }
+    }
+    if (visitors.client) {
+      for (size_t ii = 0; ii < slots.clients.size(); ++ii) {
+        if (nullptr != rcl_wait_set.clients[ii]) {
+          auto entity = slots.clients[ii];
+          visitors.client(*entity, this->get_entity_tag(entity));
+        }
+      }
+    }
+    if (visitors.service) {
+      for (size_t ii = 0; ii < slots.services.size(); ++ii) {
+        if (nullptr != rcl_wait_set.services[ii]) {
+          auto entity = slots.services[ii];
+          visitors.service(*entity, this->get_entity_tag(entity));
+        }
+      }
+    }
+    if (visitors.waitable) {
+      for (auto entity : slots.waitables) {
+        if (entity->is_ready(&rcl_wait_set)) {
+          visitors.waitable(*entity, this->get_entity_tag(entity));
+        }
+      }
+    }
+  }
+
 private:
   // Add WaitResult type as a friend so it can call private methods for
   // acquiring and releasing resources as the WaitResult is initialized and
@@ -740,7 +899,40 @@ private:
     this->sync_wait_result_release();
   }
 
+  /// Record the user tag for an entity, a nullptr tag erases any record.
+  /**
+   * Only called from within the add functions' lambdas, which the
+   * SynchronizationPolicy protects from running concurrently with waiting.
+   */
+  void
+  set_entity_tag(const void * entity, const void * tag)
+  {
+    if (nullptr != tag) {
+      entity_tags_[entity] = tag;
+    } else {
+      entity_tags_.erase(entity);
+    }
+  }
+
+  /// Remove any user tag recorded for an entity.
+  void
+  clear_entity_tag(const void * entity)
+  {
+    entity_tags_.erase(entity);
+  }
+
+  /// Return the user tag recorded for an entity, nullptr if there is none.
+  const void *
+  get_entity_tag(const void * entity) const
+  {
+    auto it = entity_tags_.find(entity);
+    return it != entity_tags_.end() ? it->second : nullptr;
+  }
+
   bool wait_result_holding_ = false;
+
+  /// User tags by entity, only entities with a non-null tag have an entry.
+  std::unordered_map<const void *, const void *> entity_tags_;
 };
 
 }  // namespace rclcpp
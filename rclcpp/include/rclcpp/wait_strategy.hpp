@@ -0,0 +1,144 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__WAIT_STRATEGY_HPP_
+#define RCLCPP__WAIT_STRATEGY_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+
+/// How an executor worker waits when no work is immediately available.
+enum class WaitStrategyKind
+{
+  /// Block right away on the condition variable or mutex; the default and
+  /// the historical behavior.
+  Park,
+  /// Busy-spin for a bounded budget (cpu relax hints early, yields late),
+  /// then park. Removes most futex round trips at high event rates.
+  SpinThenPark,
+  /// Never park: spin until work arrives or spinning stops. Burns one core
+  /// per waiter, only sensible on cores dedicated to the executor.
+  BusySpin
+};
+
+/// Tunable waiting behavior for executor workers and event queues.
+/**
+ * Parking on a condition variable costs a futex round trip, typically 5-15 us
+ * per wakeup. At high event rates most waits would end within that window, so
+ * spinning briefly before parking removes the bulk of the wakeups. With
+ * `adaptive` enabled the spin budget tracks recent event inter-arrival times,
+ * so bursty sources spin just long enough and idle stretches fall back to
+ * parking without burning cpu.
+ */
+struct WaitStrategy
+{
+  WaitStrategyKind kind {WaitStrategyKind::Park};
+
+  /// Upper bound for the spin budget with SpinThenPark.
+  std::chrono::nanoseconds max_spin_duration {std::chrono::microseconds(20)};
+
+  /// Learn the SpinThenPark budget from recent event inter-arrival times.
+  bool adaptive {true};
+};
+
+/// Turns a WaitStrategy and observed event arrivals into a spin budget.
+/**
+ * Thread safe: arrival bookkeeping uses relaxed atomics, the budget is a
+ * heuristic and tolerates lost updates.
+ */
+class AdaptiveSpinWaiter
+{
+public:
+  explicit AdaptiveSpinWaiter(const WaitStrategy & strategy)
+  : strategy_(strategy)
+  {}
+
+  /// Record that work arrived, updating the inter-arrival average.
+  void
+  record_event()
+  {
+    if (WaitStrategyKind::SpinThenPark != strategy_.kind || !strategy_.adaptive) {
+      return;
+    }
+    const int64_t now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+    const int64_t last_ns = last_event_ns_.exchange(now_ns, std::memory_order_relaxed);
+    if (0 == last_ns) {
+      return;
+    }
+    // Exponential moving average with 1/8 weight: smooth, and cheap enough
+    // to pay on every event.
+    const int64_t interval_ns = now_ns - last_ns;
+    const int64_t average_ns = ewma_interval_ns_.load(std::memory_order_relaxed);
+    const int64_t updated_ns =
+      0 == average_ns ? interval_ns : average_ns + (interval_ns - average_ns) / 8;
+    ewma_interval_ns_.store(updated_ns, std::memory_order_relaxed);
+  }
+
+  /// Return how long to spin before parking; zero means park immediately.
+  std::chrono::nanoseconds
+  spin_budget() const
+  {
+    if (WaitStrategyKind::Park == strategy_.kind) {
+      return std::chrono::nanoseconds(0);
+    }
+    if (WaitStrategyKind::BusySpin == strategy_.kind) {
+      return std::chrono::nanoseconds::max();
+    }
+    if (!strategy_.adaptive) {
+      return strategy_.max_spin_duration;
+    }
+    const int64_t average_ns = ewma_interval_ns_.load(std::memory_order_relaxed);
+    if (0 == average_ns) {
+      return strategy_.max_spin_duration;
+    }
+    // Spin for twice the typical gap: catches the common arrival without
+    // spinning through idle stretches.
+    return std::min(strategy_.max_spin_duration, std::chrono::nanoseconds(2 * average_ns));
+  }
+
+  /// One spin-loop iteration: relax the cpu early in the budget, yield late.
+  static void
+  pause(std::chrono::nanoseconds elapsed, std::chrono::nanoseconds budget)
+  {
+    if (budget != std::chrono::nanoseconds::max() && elapsed * 2 > budget) {
+      std::this_thread::yield();
+      return;
+    }
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile ("yield");
+#else
+    std::this_thread::yield();
+#endif
+  }
+
+private:
+  WaitStrategy strategy_;
+  std::atomic<int64_t> last_event_ns_ {0};
+  std::atomic<int64_t> ewma_interval_ns_ {0};
+};
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__WAIT_STRATEGY_HPP_
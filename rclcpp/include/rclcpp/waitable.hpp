@@ -258,8 +258,19 @@ public:
   void
   clear_on_ready_callback();
 
+  /// Set the opaque callback group membership handle, see rclcpp::CallbackGroup.
+  /**
+   * \param[in] membership the handle, nullptr to unlink from the group.
+   */
+  RCLCPP_PUBLIC
+  void
+  set_callback_group_membership(std::shared_ptr<void> membership);
+
 private:
   std::atomic<bool> in_use_by_wait_set_{false};
+
+  // Unlinks this waitable from its callback group on destruction.
+  std::shared_ptr<void> callback_group_membership_;
 };  // class Waitable
 
 }  // namespace rclcpp
@@ -0,0 +1,124 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__WALL_TIMER_POOL_HPP_
+#define RCLCPP__WALL_TIMER_POOL_HPP_
+
+#include <chrono>
+#include <functional>
+#include <memory>
+
+#include "rclcpp/callback_group.hpp"
+#include "rclcpp/macros.hpp"
+#include "rclcpp/node_interfaces/node_base_interface.hpp"
+#include "rclcpp/node_interfaces/node_timers_interface.hpp"
+#include "rclcpp/timer.hpp"
+#include "rclcpp/visibility_control.hpp"
+
+namespace rclcpp
+{
+
+/// Pool of recycled one-shot wall timers.
+/**
+ * Creating a wall timer allocates the rcl timer, its clock, and the callback
+ * wrapper; applications that arm and tear down many transient timeouts pay
+ * that cost on every use.
+ * This pool keeps the underlying timers alive and rearms them in place with
+ * TimerBase::exchange_period() and TimerBase::reset(), so after warm-up
+ * transient timer usage does not allocate.
+ *
+ * Timers handed out by call_later() fire exactly once and then return to the
+ * pool; cancel() returns a pending timer to the pool without firing it.
+ * All pooled timers run in the callback group given on construction.
+ */
+class WallTimerPool
+{
+public:
+  RCLCPP_SMART_PTR_DEFINITIONS_NOT_COPYABLE(WallTimerPool)
+
+  /// Construct a pool from node interfaces.
+  /**
+   * \param[in] node_base the node base interface of the owning node.
+   * \param[in] node_timers the timers interface pooled timers are added to.
+   * \param[in] group the callback group for the pooled timers, the node's
+   *   default callback group if nullptr.
+   * \throws std::invalid_argument if node_base or node_timers is nullptr
+   */
+  RCLCPP_PUBLIC
+  WallTimerPool(
+    rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_base,
+    rclcpp::node_interfaces::NodeTimersInterface::SharedPtr node_timers,
+    rclcpp::CallbackGroup::SharedPtr group = nullptr);
+
+  /// Construct a pool with a node's resources.
+  template<typename NodeT>
+  explicit WallTimerPool(NodeT && node, rclcpp::CallbackGroup::SharedPtr group = nullptr)
+  : WallTimerPool(
+      node->get_node_base_interface(),
+      node->get_node_timers_interface(),
+      group)
+  {}
+
+  RCLCPP_PUBLIC
+  ~WallTimerPool();
+
+  /// Arm a one-shot timer.
+  /**
+   * An idle recycled timer is rearmed in place when one is available;
+   * otherwise a new wall timer is created and added to the node.
+   * The callback is invoked at most once, after which the timer returns to
+   * the pool.
+   *
+   * \param[in] delay time until the callback fires.
+   * \param[in] callback the callback to invoke.
+   * \return the armed timer, which may be passed to cancel().
+   * \throws std::invalid_argument if delay is not positive or callback is null
+   */
+  RCLCPP_PUBLIC
+  rclcpp::TimerBase::SharedPtr
+  call_later(std::chrono::nanoseconds delay, std::function<void()> callback);
+
+  /// Cancel a pending one-shot timer and return it to the pool.
+  /**
+   * Does nothing if the timer already fired, was already canceled, or did
+   * not come from this pool.
+   *
+   * \param[in] timer a timer previously returned by call_later().
+   */
+  RCLCPP_PUBLIC
+  void
+  cancel(const rclcpp::TimerBase::SharedPtr & timer);
+
+  /// Return the number of timers owned by the pool, armed and idle.
+  RCLCPP_PUBLIC
+  size_t
+  size() const;
+
+  /// Return the number of idle timers that can be rearmed without allocating.
+  RCLCPP_PUBLIC
+  size_t
+  idle_count() const;
+
+private:
+  RCLCPP_DISABLE_COPY(WallTimerPool)
+
+  struct State;
+
+  /// Shared so timer callbacks can outlive the pool without dangling.
+  std::shared_ptr<State> state_;
+};
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__WALL_TIMER_POOL_HPP_
@@ -20,6 +20,7 @@
 #include <sstream>
 #include <type_traits>
 
+#include "rclcpp/detail/log_site.hpp"
 #include "rclcpp/logger.hpp"
 #include "rcutils/logging_macros.h"
 #include "rclcpp/utilities.hpp"
@@ -127,6 +128,12 @@ def get_rclcpp_suffix_from_features(features):
       ::std::is_same<typename std::remove_cv_t<typename std::remove_reference_t<decltype(logger)>>, \
       typename ::rclcpp::Logger>::value, \
       "First argument to logging macros must be an rclcpp::Logger"); \
+    static ::rclcpp::detail::LogSite rclcpp_logging_log_site; \
+    if (!::rclcpp::detail::log_site_is_enabled( \
+        rclcpp_logging_log_site, (logger).get_name(), RCUTILS_LOG_SEVERITY_@(severity))) \
+    { \
+      break; \
+    } \
 @[ if 'throttle' in feature_combination]@ \
     auto get_time_point = [&c=clock](rcutils_time_point_value_t * time_point) -> rcutils_ret_t { \
       try { \
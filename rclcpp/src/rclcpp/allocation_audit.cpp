@@ -0,0 +1,172 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/allocation_audit.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace rclcpp
+{
+
+namespace
+{
+
+std::atomic<bool> g_init_complete {false};
+
+}  // namespace
+
+void
+mark_init_complete()
+{
+  g_init_complete.store(true, std::memory_order_release);
+}
+
+bool
+init_complete()
+{
+  return g_init_complete.load(std::memory_order_acquire);
+}
+
+namespace allocation_audit
+{
+
+namespace
+{
+
+struct CallsiteCounters
+{
+  size_t pre_init_count = 0;
+  size_t pre_init_bytes = 0;
+  size_t post_init_count = 0;
+  size_t post_init_bytes = 0;
+};
+
+std::atomic<bool> g_enabled {false};
+
+std::mutex g_registry_mutex;
+
+// Keyed by pointer: callsites are required to be static strings, and a
+// pointer key keeps the hot recording path free of string copies.
+std::map<const char *, CallsiteCounters> & registry()
+{
+  static std::map<const char *, CallsiteCounters> registry;
+  return registry;
+}
+
+}  // namespace
+
+void
+enable()
+{
+  g_enabled.store(true, std::memory_order_release);
+}
+
+void
+disable()
+{
+  g_enabled.store(false, std::memory_order_release);
+}
+
+bool
+enabled()
+{
+  return g_enabled.load(std::memory_order_acquire);
+}
+
+void
+record(const char * callsite, size_t bytes)
+{
+  if (!enabled()) {
+    return;
+  }
+  const bool post_init = init_complete();
+  std::lock_guard<std::mutex> lock(g_registry_mutex);
+  CallsiteCounters & counters = registry()[callsite];
+  if (post_init) {
+    counters.post_init_count += 1;
+    counters.post_init_bytes += bytes;
+  } else {
+    counters.pre_init_count += 1;
+    counters.pre_init_bytes += bytes;
+  }
+}
+
+std::vector<CallsiteReport>
+report()
+{
+  std::vector<CallsiteReport> result;
+  std::lock_guard<std::mutex> lock(g_registry_mutex);
+  result.reserve(registry().size());
+  for (const auto & [callsite, counters] : registry()) {
+    result.push_back(
+      {callsite, counters.pre_init_count, counters.pre_init_bytes,
+        counters.post_init_count, counters.post_init_bytes});
+  }
+  return result;
+}
+
+std::vector<CallsiteReport>
+post_init_report()
+{
+  std::vector<CallsiteReport> result = report();
+  result.erase(
+    std::remove_if(
+      result.begin(), result.end(),
+      [](const CallsiteReport & entry) {return 0u == entry.post_init_count;}),
+    result.end());
+  return result;
+}
+
+void
+reset()
+{
+  {
+    std::lock_guard<std::mutex> lock(g_registry_mutex);
+    registry().clear();
+  }
+  g_init_complete.store(false, std::memory_order_release);
+}
+
+AuditingMemoryResource::AuditingMemoryResource(
+  const char * callsite,
+  std::pmr::memory_resource * upstream)
+: callsite_(callsite), upstream_(upstream)
+{}
+
+void *
+AuditingMemoryResource::do_allocate(size_t bytes, size_t alignment)
+{
+  record(callsite_, bytes);
+  return upstream_->allocate(bytes, alignment);
+}
+
+void
+AuditingMemoryResource::do_deallocate(void * pointer, size_t bytes, size_t alignment)
+{
+  upstream_->deallocate(pointer, bytes, alignment);
+}
+
+bool
+AuditingMemoryResource::do_is_equal(const std::pmr::memory_resource & other) const noexcept
+{
+  return this == &other;
+}
+
+}  // namespace allocation_audit
+}  // namespace rclcpp
@@ -34,3 +34,16 @@ AnyExecutable::~AnyExecutable()
     callback_group->can_be_taken_from().store(true);
   }
 }
+
+void
+AnyExecutable::reset()
+{
+  subscription.reset();
+  timer.reset();
+  service.reset();
+  client.reset();
+  waitable.reset();
+  callback_group.reset();
+  node_base.reset();
+  data.reset();
+}
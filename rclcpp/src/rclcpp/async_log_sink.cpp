@@ -0,0 +1,269 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "rcl/logging.h"
+#include "rcutils/logging.h"
+#include "rcutils/macros.h"
+
+#include "./async_log_sink.hpp"
+#include "./logging_mutex.hpp"
+
+namespace
+{
+
+/// Re-enter the rcl output handler with a fresh va_list for the given arguments.
+void
+forward_to_rcl_sinks(
+  const rcutils_log_location_t * location,
+  int severity, const char * name, rcutils_time_point_value_t timestamp,
+  const char * format, ...)
+{
+  va_list args;
+  va_start(args, format);
+  rcl_logging_multiple_output_handler(location, severity, name, timestamp, format, &args);
+  va_end(args);
+}
+
+}  // namespace
+
+namespace rclcpp
+{
+
+AsyncLogSink &
+AsyncLogSink::get_global_async_log_sink()
+{
+  static AsyncLogSink sink;
+  return sink;
+}
+
+AsyncLogSink::AsyncLogSink()
+: cells_(kRingCapacity)
+{
+  for (size_t i = 0; i < kRingCapacity; ++i) {
+    cells_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+AsyncLogSink::~AsyncLogSink()
+{
+  this->stop();
+}
+
+void
+AsyncLogSink::start()
+{
+  std::lock_guard<std::mutex> lock(drain_thread_mutex_);
+  if (running_.load(std::memory_order_acquire)) {
+    return;
+  }
+  running_.store(true, std::memory_order_release);
+  drain_thread_ = std::thread(&AsyncLogSink::drain_loop, this);
+}
+
+void
+AsyncLogSink::stop()
+{
+  {
+    std::lock_guard<std::mutex> lock(drain_thread_mutex_);
+    if (!running_.load(std::memory_order_acquire)) {
+      return;
+    }
+    running_.store(false, std::memory_order_release);
+    drain_thread_cv_.notify_one();
+  }
+  if (drain_thread_.joinable()) {
+    drain_thread_.join();
+  }
+  // The drain thread exits as soon as it observes running_ == false; flush
+  // whatever it left behind so no record is lost across a clean shutdown.
+  std::vector<LogRecord> batch;
+  LogRecord record;
+  while (this->dequeue(record)) {
+    batch.push_back(std::move(record));
+  }
+  this->flush_batch(batch);
+}
+
+bool
+AsyncLogSink::submit(
+  const rcutils_log_location_t * location,
+  int severity, const char * name, rcutils_time_point_value_t timestamp,
+  const char * format, va_list * args)
+{
+  if (!running_.load(std::memory_order_acquire)) {
+    return false;
+  }
+
+  // Format in the calling thread: the va_list cannot outlive this call, but
+  // the finished string can.  Most messages fit the stack buffer.
+  LogRecord record;
+  char stack_buffer[512];
+  va_list args_copy;
+  va_copy(args_copy, *args);
+  int length = vsnprintf(stack_buffer, sizeof(stack_buffer), format, args_copy);
+  va_end(args_copy);
+  if (length < 0) {
+    return false;
+  }
+  if (static_cast<size_t>(length) < sizeof(stack_buffer)) {
+    record.message.assign(stack_buffer, static_cast<size_t>(length));
+  } else {
+    std::vector<char> heap_buffer(static_cast<size_t>(length) + 1);
+    va_copy(args_copy, *args);
+    vsnprintf(heap_buffer.data(), heap_buffer.size(), format, args_copy);
+    va_end(args_copy);
+    record.message.assign(heap_buffer.data(), static_cast<size_t>(length));
+  }
+
+  record.has_location = (nullptr != location);
+  if (record.has_location) {
+    record.location = *location;
+  }
+  record.severity = severity;
+  if (nullptr != name) {
+    record.name = name;
+  }
+  record.timestamp = timestamp;
+
+  if (!this->enqueue(std::move(record))) {
+    // Ring is full: bounded loss, count and move on without blocking.
+    dropped_count_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  if (drain_thread_waiting_.load(std::memory_order_acquire)) {
+    drain_thread_cv_.notify_one();
+  }
+  return true;
+}
+
+uint64_t
+AsyncLogSink::get_dropped_count() const
+{
+  return dropped_count_.load(std::memory_order_relaxed);
+}
+
+bool
+AsyncLogSink::enqueue(LogRecord && record)
+{
+  size_t position = enqueue_position_.load(std::memory_order_relaxed);
+  while (true) {
+    RecordCell & cell = cells_[position & (kRingCapacity - 1)];
+    size_t sequence = cell.sequence.load(std::memory_order_acquire);
+    intptr_t difference =
+      static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+    if (0 == difference) {
+      if (enqueue_position_.compare_exchange_weak(
+          position, position + 1, std::memory_order_relaxed))
+      {
+        cell.record = std::move(record);
+        cell.sequence.store(position + 1, std::memory_order_release);
+        return true;
+      }
+    } else if (difference < 0) {
+      // The cell still holds an unconsumed record: the ring is full.
+      return false;
+    } else {
+      position = enqueue_position_.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+bool
+AsyncLogSink::dequeue(LogRecord & record)
+{
+  size_t position = dequeue_position_.load(std::memory_order_relaxed);
+  while (true) {
+    RecordCell & cell = cells_[position & (kRingCapacity - 1)];
+    size_t sequence = cell.sequence.load(std::memory_order_acquire);
+    intptr_t difference =
+      static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+    if (0 == difference) {
+      if (dequeue_position_.compare_exchange_weak(
+          position, position + 1, std::memory_order_relaxed))
+      {
+        record = std::move(cell.record);
+        cell.sequence.store(position + kRingCapacity, std::memory_order_release);
+        return true;
+      }
+    } else if (difference < 0) {
+      return false;
+    } else {
+      position = dequeue_position_.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+void
+AsyncLogSink::drain_loop()
+{
+  std::vector<LogRecord> batch;
+  batch.reserve(kMaxBatchSize);
+  while (running_.load(std::memory_order_acquire)) {
+    batch.clear();
+    LogRecord record;
+    while (batch.size() < kMaxBatchSize && this->dequeue(record)) {
+      batch.push_back(std::move(record));
+    }
+    if (!batch.empty()) {
+      this->flush_batch(batch);
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(drain_thread_mutex_);
+    drain_thread_waiting_.store(true, std::memory_order_release);
+    drain_thread_cv_.wait_for(lock, std::chrono::milliseconds(100));
+    drain_thread_waiting_.store(false, std::memory_order_release);
+  }
+}
+
+void
+AsyncLogSink::flush_batch(std::vector<LogRecord> & batch)
+{
+  uint64_t dropped = dropped_count_.load(std::memory_order_relaxed);
+  if (batch.empty() && dropped == reported_dropped_count_) {
+    return;
+  }
+  // One mutex acquisition per batch, instead of one per message.
+  std::shared_ptr<std::recursive_mutex> logging_mutex = get_global_logging_mutex();
+  std::lock_guard<std::recursive_mutex> guard(*logging_mutex);
+  for (LogRecord & record : batch) {
+    forward_to_rcl_sinks(
+      record.has_location ? &record.location : nullptr,
+      record.severity,
+      record.name.empty() ? nullptr : record.name.c_str(),
+      record.timestamp,
+      "%s", record.message.c_str());
+  }
+  if (dropped != reported_dropped_count_) {
+    rcutils_time_point_value_t now = 0;
+    if (RCUTILS_RET_OK != rcutils_system_time_now(&now)) {
+      now = batch.empty() ? 0 : batch.back().timestamp;
+    }
+    forward_to_rcl_sinks(
+      nullptr, RCUTILS_LOG_SEVERITY_WARN, "rclcpp", now,
+      "asynchronous logging dropped %llu log message(s)",
+      static_cast<unsigned long long>(dropped - reported_dropped_count_));  // NOLINT
+    reported_dropped_count_ = dropped;
+  }
+}
+
+}  // namespace rclcpp
@@ -0,0 +1,149 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP__ASYNC_LOG_SINK_HPP_
+#define RCLCPP__ASYNC_LOG_SINK_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdarg>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "rcutils/logging.h"
+#include "rcutils/time.h"
+
+namespace rclcpp
+{
+
+/// Asynchronous hand-off point between log call sites and the logging sinks.
+/**
+ * When asynchronous logging is enabled, the rclcpp logging output handler
+ * formats each log message in the calling thread and pushes the finished
+ * record onto a bounded lock-free ring owned by this sink.  A dedicated
+ * thread drains the ring and forwards records in batches to the rcl logging
+ * sinks (console, file and rosout) under the global logging mutex, so log
+ * call sites never block on sink I/O or on each other.
+ *
+ * The ring has a bounded-loss overflow policy: when it is full new records
+ * are counted and dropped, and the drain thread reports the loss once the
+ * ring has caught up.
+ *
+ * \internal
+ */
+class AsyncLogSink final
+{
+public:
+  /// Return the global singleton of this class.
+  static
+  AsyncLogSink &
+  get_global_async_log_sink();
+
+  /// Start the drain thread, if it is not already running.
+  void
+  start();
+
+  /// Drain any queued records, then stop and join the drain thread.
+  /**
+   * Must be called before the rcl logging system is finalized, so that no
+   * record is forwarded to a sink that no longer exists.
+   */
+  void
+  stop();
+
+  /// Format the message and queue it for the drain thread.
+  /**
+   * Safe to call from any thread while the sink is running.  If the ring is
+   * full the record is dropped and counted instead of blocking the caller.
+   *
+   * \return true if the record was queued or dropped asynchronously, false
+   *   if the sink is not running and the caller should log synchronously.
+   */
+  bool
+  submit(
+    const rcutils_log_location_t * location,
+    int severity, const char * name, rcutils_time_point_value_t timestamp,
+    const char * format, va_list * args);
+
+  /// Return the number of records dropped because the ring was full.
+  uint64_t
+  get_dropped_count() const;
+
+private:
+  struct LogRecord
+  {
+    // The location points at static call-site data, so copying the struct
+    // (not what it points to) is enough to keep it valid.
+    rcutils_log_location_t location;
+    bool has_location;
+    int severity;
+    std::string name;
+    rcutils_time_point_value_t timestamp;
+    std::string message;
+  };
+
+  // One cell of the Vyukov-style bounded queue; the sequence number encodes
+  // whether the cell currently holds a record.
+  struct alignas(64) RecordCell
+  {
+    std::atomic<size_t> sequence;
+    LogRecord record;
+  };
+
+  AsyncLogSink();
+
+  ~AsyncLogSink();
+
+  AsyncLogSink(const AsyncLogSink &) = delete;
+  AsyncLogSink &
+  operator=(const AsyncLogSink &) = delete;
+
+  bool
+  enqueue(LogRecord && record);
+
+  bool
+  dequeue(LogRecord & record);
+
+  void
+  drain_loop();
+
+  /// Forward a batch of records to the rcl sinks under the global logging mutex.
+  void
+  flush_batch(std::vector<LogRecord> & batch);
+
+  // Must be a power of two, so that sequence arithmetic wraps cleanly.
+  static constexpr size_t kRingCapacity = 1024;
+  static constexpr size_t kMaxBatchSize = 64;
+
+  std::vector<RecordCell> cells_;
+  std::atomic<size_t> enqueue_position_{0};
+  std::atomic<size_t> dequeue_position_{0};
+
+  std::atomic<uint64_t> dropped_count_{0};
+  uint64_t reported_dropped_count_{0};
+
+  std::atomic<bool> running_{false};
+  std::atomic<bool> drain_thread_waiting_{false};
+  std::mutex drain_thread_mutex_;
+  std::condition_variable drain_thread_cv_;
+  std::thread drain_thread_;
+};
+
+}  // namespace rclcpp
+
+#endif  // RCLCPP__ASYNC_LOG_SINK_HPP_
@@ -12,12 +12,15 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "rclcpp/callback_group.hpp"
 #include "rclcpp/client.hpp"
@@ -56,15 +59,86 @@ CallbackGroup::type() const
   return type_;
 }
 
+size_t
+CallbackGroup::entities_version() const
+{
+  return entities_version_.load(std::memory_order_relaxed);
+}
+
+void
+CallbackGroup::set_scheduling_deadline(std::chrono::nanoseconds deadline)
+{
+  scheduling_deadline_ns_.store(deadline.count(), std::memory_order_relaxed);
+}
+
+std::chrono::nanoseconds
+CallbackGroup::scheduling_deadline() const
+{
+  return std::chrono::nanoseconds(scheduling_deadline_ns_.load(std::memory_order_relaxed));
+}
+
+void
+CallbackGroup::set_scheduling_priority(int priority)
+{
+  scheduling_priority_.store(priority, std::memory_order_relaxed);
+}
+
+int
+CallbackGroup::scheduling_priority() const
+{
+  return scheduling_priority_.load(std::memory_order_relaxed);
+}
+
+void
+CallbackGroup::set_thread_pool_name(const std::string & name)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  thread_pool_name_ = name;
+}
+
+std::string
+CallbackGroup::thread_pool_name() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return thread_pool_name_;
+}
+
+CallbackGroup::Stats
+CallbackGroup::get_stats() const
+{
+  Stats stats;
+  stats.cpu_time =
+    std::chrono::nanoseconds(stats_cpu_time_ns_.load(std::memory_order_relaxed));
+  stats.executions = stats_executions_.load(std::memory_order_relaxed);
+  stats.max_execution_time =
+    std::chrono::nanoseconds(stats_max_execution_ns_.load(std::memory_order_relaxed));
+  return stats;
+}
+
+void
+CallbackGroup::record_execution(std::chrono::nanoseconds cpu_time)
+{
+  const int64_t cpu_time_ns = cpu_time.count();
+  stats_cpu_time_ns_.fetch_add(cpu_time_ns, std::memory_order_relaxed);
+  stats_executions_.fetch_add(1, std::memory_order_relaxed);
+  int64_t previous_max = stats_max_execution_ns_.load(std::memory_order_relaxed);
+  while (cpu_time_ns > previous_max &&
+    !stats_max_execution_ns_.compare_exchange_weak(
+      previous_max, cpu_time_ns, std::memory_order_relaxed))
+  {
+  }
+}
+
 size_t
 CallbackGroup::size() const
 {
+  std::lock_guard<std::mutex> lock(mutex_);
   return
-    subscription_ptrs_.size() +
-    service_ptrs_.size() +
-    client_ptrs_.size() +
-    timer_ptrs_.size() +
-    waitable_ptrs_.size();
+    subscription_entries_.size() +
+    service_entries_.size() +
+    client_entries_.size() +
+    timer_entries_.size() +
+    waitable_entries_.size();
 }
 void CallbackGroup::collect_all_ptrs(
   std::function<void(const rclcpp::SubscriptionBase::SharedPtr &)> sub_func,
@@ -73,40 +147,53 @@ void CallbackGroup::collect_all_ptrs(
   std::function<void(const rclcpp::TimerBase::SharedPtr &)> timer_func,
   std::function<void(const rclcpp::Waitable::SharedPtr &)> waitable_func) const
 {
+  // Declared before the lock so the references are released after it, for
+  // the same reason as in _find_ptrs_if_impl().
+  std::vector<rclcpp::SubscriptionBase::SharedPtr> subscriptions;
+  std::vector<rclcpp::ServiceBase::SharedPtr> services;
+  std::vector<rclcpp::ClientBase::SharedPtr> clients;
+  std::vector<rclcpp::TimerBase::SharedPtr> timers;
+  std::vector<rclcpp::Waitable::SharedPtr> waitables;
+
   std::lock_guard<std::mutex> lock(mutex_);
 
-  for (const rclcpp::SubscriptionBase::WeakPtr & weak_ptr : subscription_ptrs_) {
-    rclcpp::SubscriptionBase::SharedPtr ref_ptr = weak_ptr.lock();
+  for (const auto & entry : subscription_entries_) {
+    rclcpp::SubscriptionBase::SharedPtr ref_ptr = entry.weak.lock();
     if (ref_ptr) {
       sub_func(ref_ptr);
+      subscriptions.push_back(std::move(ref_ptr));
     }
   }
 
-  for (const rclcpp::ServiceBase::WeakPtr & weak_ptr : service_ptrs_) {
-    rclcpp::ServiceBase::SharedPtr ref_ptr = weak_ptr.lock();
+  for (const auto & entry : service_entries_) {
+    rclcpp::ServiceBase::SharedPtr ref_ptr = entry.weak.lock();
     if (ref_ptr) {
       service_func(ref_ptr);
+      services.push_back(std::move(ref_ptr));
     }
   }
 
-  for (const rclcpp::ClientBase::WeakPtr & weak_ptr : client_ptrs_) {
-    rclcpp::ClientBase::SharedPtr ref_ptr = weak_ptr.lock();
+  for (const auto & entry : client_entries_) {
+    rclcpp::ClientBase::SharedPtr ref_ptr = entry.weak.lock();
     if (ref_ptr) {
       client_func(ref_ptr);
+      clients.push_back(std::move(ref_ptr));
     }
   }
 
-  for (const rclcpp::TimerBase::WeakPtr & weak_ptr : timer_ptrs_) {
-    rclcpp::TimerBase::SharedPtr ref_ptr = weak_ptr.lock();
+  for (const auto & entry : timer_entries_) {
+    rclcpp::TimerBase::SharedPtr ref_ptr = entry.weak.lock();
     if (ref_ptr) {
       timer_func(ref_ptr);
+      timers.push_back(std::move(ref_ptr));
     }
   }
 
-  for (const rclcpp::Waitable::WeakPtr & weak_ptr : waitable_ptrs_) {
-    rclcpp::Waitable::SharedPtr ref_ptr = weak_ptr.lock();
+  for (const auto & entry : waitable_entries_) {
+    rclcpp::Waitable::SharedPtr ref_ptr = entry.weak.lock();
     if (ref_ptr) {
       waitable_func(ref_ptr);
+      waitables.push_back(std::move(ref_ptr));
     }
   }
 }
@@ -178,77 +265,53 @@ void
 CallbackGroup::add_subscription(
   const rclcpp::SubscriptionBase::SharedPtr subscription_ptr)
 {
-  std::lock_guard<std::mutex> lock(mutex_);
-  subscription_ptrs_.push_back(subscription_ptr);
-  subscription_ptrs_.erase(
-    std::remove_if(
-      subscription_ptrs_.begin(),
-      subscription_ptrs_.end(),
-      [](rclcpp::SubscriptionBase::WeakPtr x) {return x.expired();}),
-    subscription_ptrs_.end());
+  subscription_ptr->set_callback_group_membership(
+    register_entity<rclcpp::SubscriptionBase>(subscription_entries_, subscription_ptr));
 }
 
 void
 CallbackGroup::add_timer(const rclcpp::TimerBase::SharedPtr timer_ptr)
 {
-  std::lock_guard<std::mutex> lock(mutex_);
-  timer_ptrs_.push_back(timer_ptr);
-  timer_ptrs_.erase(
-    std::remove_if(
-      timer_ptrs_.begin(),
-      timer_ptrs_.end(),
-      [](rclcpp::TimerBase::WeakPtr x) {return x.expired();}),
-    timer_ptrs_.end());
+  timer_ptr->set_callback_group_membership(
+    register_entity<rclcpp::TimerBase>(timer_entries_, timer_ptr));
 }
 
 void
 CallbackGroup::add_service(const rclcpp::ServiceBase::SharedPtr service_ptr)
 {
-  std::lock_guard<std::mutex> lock(mutex_);
-  service_ptrs_.push_back(service_ptr);
-  service_ptrs_.erase(
-    std::remove_if(
-      service_ptrs_.begin(),
-      service_ptrs_.end(),
-      [](rclcpp::ServiceBase::WeakPtr x) {return x.expired();}),
-    service_ptrs_.end());
+  service_ptr->set_callback_group_membership(
+    register_entity<rclcpp::ServiceBase>(service_entries_, service_ptr));
 }
 
 void
 CallbackGroup::add_client(const rclcpp::ClientBase::SharedPtr client_ptr)
 {
-  std::lock_guard<std::mutex> lock(mutex_);
-  client_ptrs_.push_back(client_ptr);
-  client_ptrs_.erase(
-    std::remove_if(
-      client_ptrs_.begin(),
-      client_ptrs_.end(),
-      [](rclcpp::ClientBase::WeakPtr x) {return x.expired();}),
-    client_ptrs_.end());
+  client_ptr->set_callback_group_membership(
+    register_entity<rclcpp::ClientBase>(client_entries_, client_ptr));
 }
 
 void
 CallbackGroup::add_waitable(const rclcpp::Waitable::SharedPtr waitable_ptr)
 {
-  std::lock_guard<std::mutex> lock(mutex_);
-  waitable_ptrs_.push_back(waitable_ptr);
-  waitable_ptrs_.erase(
-    std::remove_if(
-      waitable_ptrs_.begin(),
-      waitable_ptrs_.end(),
-      [](rclcpp::Waitable::WeakPtr x) {return x.expired();}),
-    waitable_ptrs_.end());
+  waitable_ptr->set_callback_group_membership(
+    register_entity<rclcpp::Waitable>(waitable_entries_, waitable_ptr));
 }
 
 void
 CallbackGroup::remove_waitable(const rclcpp::Waitable::SharedPtr waitable_ptr) noexcept
 {
-  std::lock_guard<std::mutex> lock(mutex_);
-  for (auto iter = waitable_ptrs_.begin(); iter != waitable_ptrs_.end(); ++iter) {
-    const auto shared_ptr = iter->lock();
-    if (shared_ptr.get() == waitable_ptr.get()) {
-      waitable_ptrs_.erase(iter);
-      break;
+  bool registered_here = false;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto & entry : waitable_entries_) {
+      if (entry.raw == waitable_ptr.get()) {
+        registered_here = true;
+        break;
+      }
     }
   }
+  if (registered_here) {
+    // Clearing the handle unlinks the entry and bumps entities_version_.
+    waitable_ptr->set_callback_group_membership(nullptr);
+  }
 }
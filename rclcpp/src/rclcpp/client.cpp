@@ -24,8 +24,10 @@
 #include "rcl/node.h"
 #include "rcl/wait.h"
 
+#include "rclcpp/context.hpp"
 #include "rclcpp/exceptions.hpp"
 #include "rclcpp/node_interfaces/node_base_interface.hpp"
+#include "rclcpp/node_interfaces/node_graph.hpp"
 #include "rclcpp/node_interfaces/node_graph_interface.hpp"
 #include "rclcpp/qos.hpp"
 #include "rclcpp/utilities.hpp"
@@ -67,6 +69,21 @@ ClientBase::ClientBase(
     });
 }
 
+ClientBase::~ClientBase()
+{
+  if (context_ && context_->is_deferred_finalization_active()) {
+    // Detach the rmw listener first; the handle outlives this object and must
+    // not call back into it.  The deleter only weakly references the node, so
+    // the closure holds the node handle and drops the client while it is live.
+    this->clear_on_new_response_callback();
+    context_->defer_entity_finalization(
+      [handle = std::move(client_handle_), node_handle = node_handle_]() mutable
+      {
+        handle.reset();
+      });
+  }
+}
+
 bool
 ClientBase::take_type_erased_response(void * response_out, rmw_request_id_t & request_header_out)
 {
@@ -82,6 +99,20 @@ ClientBase::take_type_erased_response(void * response_out, rmw_request_id_t & re
   return true;
 }
 
+rcl_ret_t
+ClientBase::try_take_type_erased_response(
+  void * response_out, rmw_request_id_t & request_header_out) noexcept
+{
+  rcl_ret_t ret = rcl_take_response(
+    this->get_client_handle().get(),
+    &request_header_out,
+    response_out);
+  if (RCL_RET_OK != ret) {
+    rcl_reset_error();
+  }
+  return ret;
+}
+
 const char *
 ClientBase::get_service_name() const
 {
@@ -138,6 +169,15 @@ ClientBase::wait_for_service_nanoseconds(std::chrono::nanoseconds timeout)
     // check was non-blocking, return immediately
     return false;
   }
+  // Prefer blocking on a graph event filtered to this service name, which
+  // only wakes when the named server appears, disappears, or changes types.
+  // Falling back to the unfiltered event keeps custom NodeGraphInterface
+  // implementations working, at the cost of waking on every graph change.
+  auto concrete_node_graph =
+    std::dynamic_pointer_cast<rclcpp::node_interfaces::NodeGraph>(node_ptr);
+  if (concrete_node_graph) {
+    return wait_for_service_filtered_nanoseconds(concrete_node_graph, timeout, start);
+  }
   auto event = node_ptr->get_graph_event();
   // update the time even on the first loop to account for time spent in the first call
   // to this->server_is_ready()
@@ -178,6 +218,53 @@ ClientBase::wait_for_service_nanoseconds(std::chrono::nanoseconds timeout)
   return false;  // timeout exceeded while waiting for the server to be ready
 }
 
+bool
+ClientBase::wait_for_service_filtered_nanoseconds(
+  std::shared_ptr<rclcpp::node_interfaces::NodeGraph> node_graph,
+  std::chrono::nanoseconds timeout,
+  std::chrono::steady_clock::time_point start)
+{
+  // Register the filtered event before re-checking readiness: the baseline
+  // graph snapshot is taken at registration, so a server appearing after the
+  // check below is guaranteed to set the event.
+  auto event = node_graph->get_service_graph_event(this->get_service_name());
+  if (this->service_is_ready()) {
+    return true;
+  }
+  std::chrono::nanoseconds time_to_wait =
+    timeout > std::chrono::nanoseconds(0) ?
+    timeout - (std::chrono::steady_clock::now() - start) :
+    std::chrono::nanoseconds::max();
+  if (time_to_wait < std::chrono::nanoseconds(0)) {
+    time_to_wait = std::chrono::nanoseconds(0);
+  }
+  // Once the graph has shown a matching change but the middleware has not
+  // matched the client yet, fall back to short waits so the imminent match
+  // is picked up promptly; until then sleep for the full remaining time.
+  bool graph_changed = false;
+  do {
+    if (!rclcpp::ok(this->context_)) {
+      return false;
+    }
+    auto wait_slice = time_to_wait;
+    if (graph_changed) {
+      wait_slice = std::min(time_to_wait, std::chrono::nanoseconds(RCL_MS_TO_NS(100)));
+    }
+    node_graph->wait_for_filtered_graph_event(event, wait_slice);
+    if (event->check_and_clear()) {
+      graph_changed = true;
+    }
+    if (this->service_is_ready()) {
+      return true;
+    }
+    if (timeout > std::chrono::nanoseconds(0)) {
+      time_to_wait = timeout - (std::chrono::steady_clock::now() - start);
+    }
+    // if timeout is negative, time_to_wait will never reach zero
+  } while (time_to_wait > std::chrono::nanoseconds(0));
+  return false;  // timeout exceeded while waiting for the server to be ready
+}
+
 rcl_node_t *
 ClientBase::get_rcl_node_handle()
 {
@@ -196,6 +283,13 @@ ClientBase::exchange_in_use_by_wait_set_state(bool in_use_state)
   return in_use_by_wait_set_.exchange(in_use_state);
 }
 
+void
+ClientBase::setup_intra_process(IntraProcessManagerWeakPtr weak_ipm)
+{
+  weak_ipm_ = weak_ipm;
+  use_intra_process_ = true;
+}
+
 rclcpp::QoS
 ClientBase::get_request_publisher_actual_qos() const
 {
@@ -246,3 +340,9 @@ ClientBase::set_on_new_response_callback(rcl_event_callback_t callback, const vo
     throw_from_rcl_error(ret, "failed to set the on new response callback for client");
   }
 }
+
+void
+ClientBase::set_callback_group_membership(std::shared_ptr<void> membership)
+{
+  callback_group_membership_ = membership;
+}
@@ -14,7 +14,9 @@
 
 #include "rclcpp/clock.hpp"
 
+#include <atomic>
 #include <condition_variable>
+#include <map>
 #include <memory>
 #include <thread>
 
@@ -37,6 +39,25 @@ public:
     if (ret != RCL_RET_OK) {
       exceptions::throw_from_rcl_error(ret, "failed to initialize rcl clock");
     }
+    if (RCL_ROS_TIME == clock_type) {
+      // Keep the lock-free now() fast path in sync with every ROS time
+      // override update, including ones made directly through the rcl API
+      // on get_clock_handle(), by observing the clock's own jump callbacks.
+      rcl_jump_threshold_t threshold;
+      threshold.on_clock_change = true;
+      // 0 is disable, so -1 and 1 are smallest possible time changes
+      threshold.min_backward.nanoseconds = -1;
+      threshold.min_forward.nanoseconds = 1;
+      ret = rcl_clock_add_jump_callback(
+        &rcl_clock_, threshold, Impl::on_ros_time_update, this);
+      if (ret != RCL_RET_OK) {
+        rcl_ret_t fini_ret = rcl_clock_fini(&rcl_clock_);
+        if (fini_ret != RCL_RET_OK) {
+          RCUTILS_LOG_ERROR("Failed to fini rcl clock.");
+        }
+        exceptions::throw_from_rcl_error(ret, "failed to add jump callback to rcl clock");
+      }
+    }
   }
 
   ~Impl()
@@ -47,9 +68,89 @@ public:
     }
   }
 
+  /// Seqlock writer side of the lock-free ROS time fast path in now().
+  /**
+   * The pre-jump call makes the sequence odd, so readers fall back to
+   * rcl_clock_get_now() while the override changes and the user's jump
+   * handlers run. The post-jump call publishes the new override state and
+   * makes the sequence even again. rcl invokes this for every override
+   * update and activation change, no matter which API performed it.
+   */
+  static void
+  on_ros_time_update(const rcl_time_jump_t * time_jump, bool before_jump, void * user_data)
+  {
+    auto * impl = static_cast<Clock::Impl *>(user_data);
+    if (before_jump) {
+      impl->ros_time_seq_.fetch_add(1, std::memory_order_acq_rel);
+      return;
+    }
+    const bool active =
+      RCL_ROS_TIME_ACTIVATED == time_jump->clock_change ||
+      RCL_ROS_TIME_NO_CHANGE == time_jump->clock_change;
+    rcl_time_point_value_t now_ns = 0;
+    if (active && RCL_RET_OK != rcl_clock_get_now(&impl->rcl_clock_, &now_ns)) {
+      // Leave the sequence odd; readers keep using the rcl path.
+      return;
+    }
+    impl->ros_time_active_.store(active, std::memory_order_relaxed);
+    impl->ros_time_value_.store(now_ns, std::memory_order_relaxed);
+    impl->ros_time_seq_.fetch_add(1, std::memory_order_release);
+    impl->wake_ros_time_sleepers(
+      RCL_ROS_TIME_NO_CHANGE != time_jump->clock_change, now_ns);
+  }
+
+  /// A thread blocked in sleep_until() while ROS time is active.
+  /**
+   * Sleepers are enlisted in a deadline-ordered map shared by the whole
+   * clock, so each ROS time update only wakes the threads whose deadline
+   * has passed instead of broadcasting to every sleeping thread.
+   */
+  struct RosTimeSleeper
+  {
+    std::condition_variable cv;
+    // Set under sleepers_mutex_ by the waker; once set the entry has been
+    // removed from the map and the sleeper must not erase it again.
+    bool woken {false};
+    bool time_source_changed {false};
+  };
+
+  /// Wake the due sleepers, or all of them when the time source changed.
+  void
+  wake_ros_time_sleepers(bool time_source_changed, rcl_time_point_value_t now_ns)
+  {
+    std::lock_guard<std::mutex> lock(sleepers_mutex_);
+    if (time_source_changed) {
+      for (auto & entry : ros_time_sleepers_) {
+        entry.second->time_source_changed = true;
+        entry.second->woken = true;
+        entry.second->cv.notify_one();
+      }
+      ros_time_sleepers_.clear();
+      return;
+    }
+    auto it = ros_time_sleepers_.begin();
+    while (it != ros_time_sleepers_.end() && it->first <= now_ns) {
+      it->second->woken = true;
+      it->second->cv.notify_one();
+      it = ros_time_sleepers_.erase(it);
+    }
+  }
+
   rcl_clock_t rcl_clock_;
   rcl_allocator_t allocator_;
   std::mutex clock_mutex_;
+  // Seqlock guarding the lock-free ROS time fast path in now(). Zero means
+  // no override update has been observed yet and an odd value means an
+  // update (with its jump handlers) is in flight; in both cases readers
+  // fall back to rcl_clock_get_now().
+  std::atomic<uint64_t> ros_time_seq_ {0};
+  std::atomic<bool> ros_time_active_ {false};
+  std::atomic<rcl_time_point_value_t> ros_time_value_ {0};
+  // Protects the shared sleeper list below, see `RosTimeSleeper`.
+  std::mutex sleepers_mutex_;
+  // Threads blocked in sleep_until() while ROS time is active, keyed and
+  // ordered by their wake deadline.
+  std::multimap<rcl_time_point_value_t, RosTimeSleeper *> ros_time_sleepers_;
 };
 
 JumpHandler::JumpHandler(
@@ -71,6 +172,23 @@ Clock::now() const
 {
   Time now(0, 0, impl_->rcl_clock_.type);
 
+  if (RCL_ROS_TIME == impl_->rcl_clock_.type) {
+    // Lock-free fast path: read the last published ROS time override through
+    // the seqlock. Falls through to rcl when no override has been observed
+    // yet, when an update is in flight, or when ROS time is not active.
+    const uint64_t seq = impl_->ros_time_seq_.load(std::memory_order_acquire);
+    if (0u != seq && 0u == (seq & 1u)) {
+      const bool active = impl_->ros_time_active_.load(std::memory_order_relaxed);
+      const rcl_time_point_value_t value =
+        impl_->ros_time_value_.load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (active && impl_->ros_time_seq_.load(std::memory_order_relaxed) == seq) {
+        now.rcl_time_.nanoseconds = value;
+        return now;
+      }
+    }
+  }
+
   auto ret = rcl_clock_get_now(&impl_->rcl_clock_, &now.rcl_time_.nanoseconds);
   if (ret != RCL_RET_OK) {
     exceptions::throw_from_rcl_error(ret, "could not get current time stamp");
@@ -91,7 +209,8 @@ Clock::sleep_until(Time until, Context::SharedPtr context)
   }
   bool time_source_changed = false;
 
-  std::condition_variable cv;
+  Clock::Impl::RosTimeSleeper sleeper;
+  std::condition_variable & cv = sleeper.cv;
 
   // Wake this thread if the context is shutdown
   rclcpp::OnShutdownCallbackHandle shutdown_cb_handle = context->add_on_shutdown_callback(
@@ -129,14 +248,15 @@ Clock::sleep_until(Time until, Context::SharedPtr context)
       cv.wait_until(lock, system_time);
     }
   } else if (this_clock_type == RCL_ROS_TIME) {
-    // Install jump handler for any amount of time change, for two purposes:
-    // - if ROS time is active, check if time reached on each new clock sample
-    // - Trigger via on_clock_change to detect if time source changes, to invalidate sleep
+    // Install a jump handler triggered only via on_clock_change, to detect if the
+    // time source changes and invalidate the sleep. Per-sample wakeups while ROS
+    // time is active go through the clock's shared sleeper list instead, so this
+    // handler stays quiet on ordinary clock ticks.
     rcl_jump_threshold_t threshold;
     threshold.on_clock_change = true;
-    // 0 is disable, so -1 and 1 are smallest possible time changes
-    threshold.min_backward.nanoseconds = -1;
-    threshold.min_forward.nanoseconds = 1;
+    // 0 disables the time-change triggers, leaving only clock change events
+    threshold.min_backward.nanoseconds = 0;
+    threshold.min_forward.nanoseconds = 0;
     auto clock_handler = create_jump_callback(
       nullptr,
       [&cv, &time_source_changed](const rcl_time_jump_t & jump) {
@@ -160,12 +280,25 @@ Clock::sleep_until(Time until, Context::SharedPtr context)
       }
     } else {
       // RCL_ROS_TIME with ros_time_is_active.
-      // Just wait without "until" because installed
-      // jump callbacks wake the cv on every new sample.
-      std::unique_lock lock(impl_->clock_mutex_);
-      while (now() < until && context->is_valid() && !time_source_changed) {
+      // Enlist this thread in the clock's shared deadline-ordered sleeper
+      // list: each ROS time update wakes only the sleepers whose deadline
+      // has passed, instead of broadcasting to every sleeping thread.
+      std::unique_lock lock(impl_->sleepers_mutex_);
+      auto sleeper_it =
+        impl_->ros_time_sleepers_.emplace(until.nanoseconds(), &sleeper);
+      while (!sleeper.woken && now() < until &&
+        context->is_valid() && !time_source_changed)
+      {
         cv.wait(lock);
       }
+      if (!sleeper.woken) {
+        // Left the loop without being woken (e.g. shutdown); the waker did
+        // not remove the entry, so it has to be removed here.
+        impl_->ros_time_sleepers_.erase(sleeper_it);
+      }
+      if (sleeper.time_source_changed) {
+        time_source_changed = true;
+      }
     }
   }
 
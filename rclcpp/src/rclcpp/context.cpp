@@ -14,10 +14,13 @@
 
 #include "rclcpp/context.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 #include <unordered_set>
 #include <utility>
@@ -25,17 +28,59 @@
 #include "rcl/init.h"
 #include "rcl/logging.h"
 
+#include "rclcpp/detail/log_site.hpp"
 #include "rclcpp/detail/utilities.hpp"
 #include "rclcpp/exceptions.hpp"
+#include "rclcpp/experimental/intra_process_manager.hpp"
 #include "rclcpp/logging.hpp"
 
 #include "rcutils/error_handling.h"
 #include "rcutils/macros.h"
 
+#include "./async_log_sink.hpp"
 #include "./logging_mutex.hpp"
 
 using rclcpp::Context;
 
+namespace
+{
+
+/// Run the given shutdown callbacks, optionally striped over a small thread pool.
+void
+execute_shutdown_callbacks(
+  const std::vector<std::shared_ptr<rclcpp::ShutdownCallbackHandle::ShutdownCallbackType>> &
+  callbacks,
+  bool parallel)
+{
+  if (parallel && callbacks.size() > 1) {
+    const size_t hardware_threads = std::max<size_t>(std::thread::hardware_concurrency(), 1u);
+    const size_t thread_count = std::min({callbacks.size(), hardware_threads, size_t(4)});
+    if (thread_count > 1) {
+      std::atomic<size_t> next_index {0};
+      std::vector<std::thread> workers;
+      workers.reserve(thread_count);
+      for (size_t i = 0; i < thread_count; ++i) {
+        workers.emplace_back(
+          [&callbacks, &next_index]() {
+            size_t index;
+            while ((index = next_index.fetch_add(1)) < callbacks.size()) {
+              (*callbacks[index])();
+            }
+          });
+      }
+      for (auto & worker : workers) {
+        worker.join();
+      }
+      return;
+    }
+  }
+  for (const auto & callback : callbacks) {
+    (*callback)();
+  }
+}
+
+}  // namespace
+
 namespace rclcpp
 {
 /// Class to manage vector of weak pointers to all created contexts
@@ -118,6 +163,42 @@ get_logging_reference_count()
   return ref_count;
 }
 
+/// Cache of rclcpp-side init state, keyed by argv identity.
+/**
+ * rcl_init() must still run for every context, since each context owns its
+ * own rmw init context and global arguments.  What can be shared across
+ * contexts is the rclcpp-side work done per init: validating that every ROS
+ * argument was consumed, and recognizing that a repeated logging
+ * initialization with an identical command line is a deliberate secondary
+ * context rather than a configuration conflict.
+ */
+struct InitStateCache
+{
+  std::mutex mutex;
+  /// argv vectors, joined with NUL separators, that already validated clean.
+  std::unordered_set<std::string> validated_argv;
+};
+
+static
+InitStateCache &
+get_init_state_cache()
+{
+  static InitStateCache cache;
+  return cache;
+}
+
+static
+std::string
+make_argv_key(int argc, char const * const * argv)
+{
+  std::string key;
+  for (int i = 0; i < argc; ++i) {
+    key.append(argv[i]);
+    key.push_back('\0');
+  }
+  return key;
+}
+
 extern "C"
 {
 static
@@ -128,6 +209,14 @@ rclcpp_logging_output_handler(
   const char * format, va_list * args)
 {
   try {
+    // When the asynchronous sink is running, the record is formatted here and
+    // queued; the sink's drain thread does the sink I/O.  Otherwise fall back
+    // to the historical synchronous path under the global logging mutex.
+    if (rclcpp::AsyncLogSink::get_global_async_log_sink().submit(
+        location, severity, name, timestamp, format, args))
+    {
+      return;
+    }
     std::shared_ptr<std::recursive_mutex> logging_mutex;
     logging_mutex = get_global_logging_mutex();
     std::lock_guard<std::recursive_mutex> guard(*logging_mutex);
@@ -200,6 +289,13 @@ Context::init(
     throw rclcpp::ContextAlreadyInitialized();
   }
   this->clean_up();
+  const std::string argv_key = make_argv_key(argc, argv);
+  bool argv_already_validated = false;
+  {
+    InitStateCache & cache = get_init_state_cache();
+    std::lock_guard<std::mutex> cache_lock(cache.mutex);
+    argv_already_validated = cache.validated_argv.count(argv_key) != 0u;
+  }
   rcl_context_t * context = new rcl_context_t;
   if (!context) {
     throw std::runtime_error("failed to allocate memory for rcl context");
@@ -225,7 +321,14 @@ Context::init(
         rcl_context_.reset();
         rclcpp::exceptions::throw_from_rcl_error(ret, "failed to configure logging");
       }
-    } else {
+      if (init_options.asynchronous_logging()) {
+        AsyncLogSink::get_global_async_log_sink().start();
+      }
+      // Command line arguments may have changed logger severities.
+      rclcpp::detail::LogSiteRegistry::refresh_all();
+    } else if (!argv_already_validated) {
+      // A secondary context with a command line this process already
+      // initialized logging for is expected; only warn on a new one.
       RCLCPP_WARN(
         rclcpp::get_logger("rclcpp"),
         "logging was initialized more than once");
@@ -234,10 +337,15 @@ Context::init(
   }
 
   try {
-    std::vector<std::string> unparsed_ros_arguments = detail::get_unparsed_ros_arguments(
-      argc, argv, &(rcl_context_->global_arguments), rcl_get_default_allocator());
-    if (!unparsed_ros_arguments.empty()) {
-      throw exceptions::UnknownROSArgsError(std::move(unparsed_ros_arguments));
+    if (!argv_already_validated) {
+      std::vector<std::string> unparsed_ros_arguments = detail::get_unparsed_ros_arguments(
+        argc, argv, &(rcl_context_->global_arguments), rcl_get_default_allocator());
+      if (!unparsed_ros_arguments.empty()) {
+        throw exceptions::UnknownROSArgsError(std::move(unparsed_ros_arguments));
+      }
+      InitStateCache & cache = get_init_state_cache();
+      std::lock_guard<std::mutex> cache_lock(cache.mutex);
+      cache.validated_argv.insert(argv_key);
     }
 
     init_options_ = init_options;
@@ -257,6 +365,72 @@ Context::init(
   }
 }
 
+bool
+Context::is_deferred_finalization_active() const
+{
+  return deferred_finalization_active_.load(std::memory_order_acquire);
+}
+
+void
+Context::defer_entity_finalization(std::function<void()> finalize)
+{
+  {
+    std::lock_guard<std::mutex> lock(deferred_finalization_mutex_);
+    if (this->is_deferred_finalization_active() && !deferred_finalization_exit_) {
+      if (!deferred_finalization_thread_.joinable()) {
+        deferred_finalization_thread_ = std::thread(
+          [this]() {
+            std::unique_lock<std::mutex> thread_lock(deferred_finalization_mutex_);
+            while (true) {
+              deferred_finalization_cv_.wait(
+                thread_lock,
+                [this]() {
+                  return !deferred_finalization_queue_.empty() || deferred_finalization_exit_;
+                });
+              if (deferred_finalization_queue_.empty()) {
+                break;
+              }
+              auto tasks = std::move(deferred_finalization_queue_);
+              deferred_finalization_queue_.clear();
+              thread_lock.unlock();
+              for (const auto & task : tasks) {
+                task();
+              }
+              thread_lock.lock();
+            }
+          });
+      }
+      deferred_finalization_queue_.push_back(std::move(finalize));
+      deferred_finalization_cv_.notify_one();
+      return;
+    }
+  }
+  // Mode not active (or already torn down), run the work inline.
+  finalize();
+}
+
+void
+Context::wait_for_deferred_finalization()
+{
+  std::thread worker;
+  {
+    std::lock_guard<std::mutex> lock(deferred_finalization_mutex_);
+    deferred_finalization_exit_ = true;
+    worker = std::move(deferred_finalization_thread_);
+  }
+  deferred_finalization_cv_.notify_all();
+  if (worker.joinable()) {
+    worker.join();
+  }
+  {
+    // Re-arm for a future init/shutdown cycle; anything deferred from here on
+    // runs inline.
+    std::lock_guard<std::mutex> lock(deferred_finalization_mutex_);
+    deferred_finalization_exit_ = false;
+  }
+  deferred_finalization_active_.store(false, std::memory_order_release);
+}
+
 bool
 Context::is_valid() const
 {
@@ -310,12 +484,8 @@ Context::shutdown(const std::string & reason)
   }
 
   // call each pre-shutdown callback
-  {
-    std::lock_guard<std::mutex> lock{pre_shutdown_callbacks_mutex_};
-    for (const auto & callback : pre_shutdown_callbacks_) {
-      (*callback)();
-    }
-  }
+  execute_shutdown_callbacks(
+    pre_shutdown_callbacks_.collect(), init_options_.parallel_shutdown_callbacks);
 
   // rcl shutdown
   rcl_ret_t ret = rcl_shutdown(rcl_context_.get());
@@ -324,13 +494,19 @@ Context::shutdown(const std::string & reason)
   }
   // set shutdown reason
   shutdown_reason_ = reason;
-  // call each shutdown callback
-  {
-    std::lock_guard<std::mutex> lock(on_shutdown_callbacks_mutex_);
-    for (const auto & callback : on_shutdown_callbacks_) {
-      (*callback)();
+  if (init_options_.deferred_entity_finalization) {
+    // Sever all intra-process endpoints in one pass, so the entity
+    // destructors that follow find nothing left to unregister, and start
+    // accepting finalization work on the teardown thread.
+    auto ipm = this->peek_sub_context<rclcpp::experimental::IntraProcessManager>();
+    if (ipm) {
+      ipm->clear();
     }
+    deferred_finalization_active_.store(true, std::memory_order_release);
   }
+  // call each shutdown callback
+  execute_shutdown_callbacks(
+    on_shutdown_callbacks_.collect(), init_options_.parallel_shutdown_callbacks);
 
   // interrupt all blocking sleep_for() and all blocking executors or wait sets
   this->interrupt_all_sleep_for();
@@ -339,6 +515,17 @@ Context::shutdown(const std::string & reason)
   // shutdown logger
   if (logging_mutex_) {
     // logging was initialized by this context
+    bool last_logging_user = false;
+    {
+      std::lock_guard<std::recursive_mutex> guard(*logging_mutex_);
+      last_logging_user = (1u == get_logging_reference_count());
+    }
+    if (last_logging_user) {
+      // Flush and stop the asynchronous sink (a no-op when it is not running)
+      // before finalizing logging, and while the logging mutex is not held,
+      // since the sink's drain thread takes that mutex to flush.
+      AsyncLogSink::get_global_async_log_sink().stop();
+    }
     std::lock_guard<std::recursive_mutex> guard(*logging_mutex_);
     size_t & count = get_logging_reference_count();
     if (0u == --count) {
@@ -387,6 +574,47 @@ Context::remove_pre_shutdown_callback(
   return remove_shutdown_callback<ShutdownType::pre_shutdown>(callback_handle);
 }
 
+uint64_t
+Context::ShutdownCallbackRegistry::add(
+  std::shared_ptr<ShutdownCallbackHandle::ShutdownCallbackType> callback)
+{
+  const uint64_t id = next_id_.fetch_add(1, std::memory_order_relaxed);
+  Shard & shard = shards_[id % kShardCount];
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  shard.slots.emplace(id, std::move(callback));
+  return id;
+}
+
+bool
+Context::ShutdownCallbackRegistry::remove(uint64_t id)
+{
+  Shard & shard = shards_[id % kShardCount];
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  return shard.slots.erase(id) > 0u;
+}
+
+std::vector<std::shared_ptr<rclcpp::ShutdownCallbackHandle::ShutdownCallbackType>>
+Context::ShutdownCallbackRegistry::collect() const
+{
+  std::vector<
+    std::pair<uint64_t, std::shared_ptr<ShutdownCallbackHandle::ShutdownCallbackType>>> slots;
+  for (const Shard & shard : shards_) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    slots.insert(slots.end(), shard.slots.begin(), shard.slots.end());
+  }
+  // Ids are assigned monotonically, so this restores registration order.
+  std::sort(
+    slots.begin(), slots.end(),
+    [](const auto & lhs, const auto & rhs) {return lhs.first < rhs.first;});
+
+  std::vector<std::shared_ptr<ShutdownCallbackHandle::ShutdownCallbackType>> callbacks;
+  callbacks.reserve(slots.size());
+  for (auto & slot : slots) {
+    callbacks.push_back(std::move(slot.second));
+  }
+  return callbacks;
+}
+
 template<Context::ShutdownType shutdown_type>
 rclcpp::ShutdownCallbackHandle
 Context::add_shutdown_callback(
@@ -398,16 +626,13 @@ Context::add_shutdown_callback(
   static_assert(
     shutdown_type == ShutdownType::pre_shutdown || shutdown_type == ShutdownType::on_shutdown);
 
+  ShutdownCallbackHandle callback_handle;
+  callback_handle.callback = callback_shared_ptr;
   if constexpr (shutdown_type == ShutdownType::pre_shutdown) {
-    std::lock_guard<std::mutex> lock(pre_shutdown_callbacks_mutex_);
-    pre_shutdown_callbacks_.emplace_back(callback_shared_ptr);
+    callback_handle.id = pre_shutdown_callbacks_.add(std::move(callback_shared_ptr));
   } else {
-    std::lock_guard<std::mutex> lock(on_shutdown_callbacks_mutex_);
-    on_shutdown_callbacks_.emplace_back(callback_shared_ptr);
+    callback_handle.id = on_shutdown_callbacks_.add(std::move(callback_shared_ptr));
   }
-
-  ShutdownCallbackHandle callback_handle;
-  callback_handle.callback = callback_shared_ptr;
   return callback_handle;
 }
 
@@ -421,28 +646,13 @@ Context::remove_shutdown_callback(
     return false;
   }
 
-  const auto remove_callback = [&callback_shared_ptr](auto & mutex, auto & callback_vector) {
-      const std::lock_guard<std::mutex> lock(mutex);
-      auto iter = callback_vector.begin();
-      for (; iter != callback_vector.end(); iter++) {
-        if ((*iter).get() == callback_shared_ptr.get()) {
-          break;
-        }
-      }
-      if (iter == callback_vector.end()) {
-        return false;
-      }
-      callback_vector.erase(iter);
-      return true;
-    };
-
   static_assert(
     shutdown_type == ShutdownType::pre_shutdown || shutdown_type == ShutdownType::on_shutdown);
 
   if constexpr (shutdown_type == ShutdownType::pre_shutdown) {
-    return remove_callback(pre_shutdown_callbacks_mutex_, pre_shutdown_callbacks_);
+    return pre_shutdown_callbacks_.remove(callback_handle.id);
   } else {
-    return remove_callback(on_shutdown_callbacks_mutex_, on_shutdown_callbacks_);
+    return on_shutdown_callbacks_.remove(callback_handle.id);
   }
 }
 
@@ -462,10 +672,9 @@ template<Context::ShutdownType shutdown_type>
 std::vector<rclcpp::Context::ShutdownCallback>
 Context::get_shutdown_callback() const
 {
-  const auto get_callback_vector = [this](auto & mutex, auto & callback_set) {
-      const std::lock_guard<std::mutex> lock(mutex);
+  const auto get_callback_vector = [](const ShutdownCallbackRegistry & registry) {
       std::vector<rclcpp::Context::ShutdownCallback> callbacks;
-      for (auto & callback : callback_set) {
+      for (auto & callback : registry.collect()) {
         callbacks.push_back(*callback);
       }
       return callbacks;
@@ -475,9 +684,9 @@ Context::get_shutdown_callback() const
     shutdown_type == ShutdownType::pre_shutdown || shutdown_type == ShutdownType::on_shutdown);
 
   if constexpr (shutdown_type == ShutdownType::pre_shutdown) {
-    return get_callback_vector(pre_shutdown_callbacks_mutex_, pre_shutdown_callbacks_);
+    return get_callback_vector(pre_shutdown_callbacks_);
   } else {
-    return get_callback_vector(on_shutdown_callbacks_mutex_, on_shutdown_callbacks_);
+    return get_callback_vector(on_shutdown_callbacks_);
   }
 }
 
@@ -513,6 +722,7 @@ Context::interrupt_all_sleep_for()
 void
 Context::clean_up()
 {
+  this->wait_for_deferred_finalization();
   shutdown_reason_ = "";
   rcl_context_.reset();
   sub_contexts_.clear();
@@ -33,6 +33,9 @@ add_guard_condition_to_rcl_wait_set(
     rclcpp::exceptions::throw_from_rcl_error(
       ret, "failed to add guard condition to wait set");
   }
+
+  // Being added for a new wait cycle, deliver any suppressed trigger.
+  guard_condition.retrigger_if_pending();
 }
 
 }  // namespace detail
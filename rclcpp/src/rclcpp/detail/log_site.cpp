@@ -0,0 +1,104 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "rcutils/logging.h"
+#include "rcutils/logging_macros.h"
+
+#include "rclcpp/detail/log_site.hpp"
+
+namespace
+{
+
+struct RegisteredSite
+{
+  rclcpp::detail::LogSite * site;
+  // Interned copy of the logger name: the pointer the site registered with
+  // may not outlive the Logger it came from.
+  const std::string * logger_name;
+};
+
+std::mutex &
+get_registry_mutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+std::vector<RegisteredSite> &
+get_registry()
+{
+  static std::vector<RegisteredSite> registry;
+  return registry;
+}
+
+// Node-based so the stored strings keep their addresses for the lifetime of
+// the process; sites publish pointers into this pool. Never freed, but
+// bounded by the number of distinct logger names used at cached sites.
+std::unordered_set<std::string> &
+get_interned_names()
+{
+  static std::unordered_set<std::string> names;
+  return names;
+}
+
+bool
+compute_enabled(const char * logger_name, int severity)
+{
+  RCUTILS_LOGGING_AUTOINIT;
+  return rcutils_logging_logger_is_enabled_for(logger_name, severity);
+}
+
+}  // namespace
+
+namespace rclcpp
+{
+namespace detail
+{
+
+bool
+LogSiteRegistry::register_site(LogSite * site, const char * logger_name, int severity)
+{
+  const bool enabled = compute_enabled(logger_name, severity);
+  std::lock_guard<std::mutex> lock(get_registry_mutex());
+  // Another thread may have won the registration race; keep its entry.
+  if (nullptr == site->logger_name.load(std::memory_order_relaxed)) {
+    const std::string & interned = *get_interned_names().insert(logger_name).first;
+    site->severity = severity;
+    site->enabled.store(enabled, std::memory_order_relaxed);
+    get_registry().push_back({site, &interned});
+    // Publish last: readers treat a non-null name as a fully set up site.
+    site->logger_name.store(interned.c_str(), std::memory_order_release);
+  }
+  return enabled;
+}
+
+void
+LogSiteRegistry::refresh_all()
+{
+  std::lock_guard<std::mutex> lock(get_registry_mutex());
+  for (RegisteredSite & entry : get_registry()) {
+    entry.site->enabled.store(
+      compute_enabled(entry.logger_name->c_str(), entry.site->severity),
+      std::memory_order_relaxed);
+  }
+}
+
+}  // namespace detail
+}  // namespace rclcpp
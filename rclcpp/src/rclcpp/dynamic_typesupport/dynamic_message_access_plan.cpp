@@ -0,0 +1,366 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rosidl_runtime_c/type_description/field__struct.h>
+#include <rosidl_runtime_c/type_description/field_type__struct.h>
+#include <rosidl_runtime_c/type_description/individual_type_description__struct.h>
+#include <rosidl_runtime_c/type_description/type_description__struct.h>
+#include <rosidl_runtime_c/type_hash.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "rcl/type_hash.h"
+#include "rcl/types.h"
+#include "rcutils/allocator.h"
+#include "rcutils/types/rcutils_ret.h"
+#include "type_description_interfaces/msg/type_description.h"
+
+#include "rclcpp/dynamic_typesupport/dynamic_message_access_plan.hpp"
+#include "rclcpp/exceptions.hpp"
+
+using rclcpp::dynamic_typesupport::DynamicMessageAccessPlan;
+
+namespace
+{
+
+using IndividualTypeDescription = rosidl_runtime_c__type_description__IndividualTypeDescription;
+using ReferencedTypeMap = std::unordered_map<std::string, const IndividualTypeDescription *>;
+
+// The field type id blocks are laid out as value, fixed array, bounded
+// sequence, unbounded sequence; derive the block offsets from the constants
+// instead of hard coding them.
+constexpr uint8_t kArrayOffset =
+  rosidl_runtime_c__type_description__FieldType__FIELD_TYPE_NESTED_TYPE_ARRAY -
+  rosidl_runtime_c__type_description__FieldType__FIELD_TYPE_NESTED_TYPE;
+constexpr uint8_t kBoundedSequenceOffset =
+  rosidl_runtime_c__type_description__FieldType__FIELD_TYPE_NESTED_TYPE_BOUNDED_SEQUENCE -
+  rosidl_runtime_c__type_description__FieldType__FIELD_TYPE_NESTED_TYPE;
+constexpr uint8_t kUnboundedSequenceOffset =
+  rosidl_runtime_c__type_description__FieldType__FIELD_TYPE_NESTED_TYPE_UNBOUNDED_SEQUENCE -
+  rosidl_runtime_c__type_description__FieldType__FIELD_TYPE_NESTED_TYPE;
+
+// Strings and sequences own their payload externally; in the packed layout
+// they occupy one pointer-plus-length reference slot.
+constexpr size_t kReferenceSlotSize = sizeof(void *) + sizeof(size_t);
+constexpr size_t kReferenceSlotAlignment = alignof(void *);
+
+// Guards against reference cycles in a malformed description.
+constexpr size_t kMaxNestingDepth = 64;
+
+struct Layout
+{
+  size_t size;
+  size_t alignment;
+};
+
+uint8_t
+base_type_id_of(uint8_t type_id)
+{
+  if (type_id >= kUnboundedSequenceOffset) {
+    return type_id - kUnboundedSequenceOffset;
+  }
+  if (type_id >= kBoundedSequenceOffset) {
+    return type_id - kBoundedSequenceOffset;
+  }
+  if (type_id >= kArrayOffset) {
+    return type_id - kArrayOffset;
+  }
+  return type_id;
+}
+
+bool
+is_fixed_array(uint8_t type_id)
+{
+  return type_id >= kArrayOffset && type_id < kBoundedSequenceOffset;
+}
+
+bool
+is_sequence(uint8_t type_id)
+{
+  return type_id >= kBoundedSequenceOffset;
+}
+
+Layout
+value_layout_of(uint8_t base_type_id, uint64_t string_capacity)
+{
+  switch (base_type_id) {
+    case rosidl_runtime_c__type_description__FieldType__FIELD_TYPE_INT8:
+    case rosidl_runtime_c__type_description__FieldType__FIELD_TYPE_UINT8:
+    case rosidl_runtime_c__type_description__FieldType__FIELD_TYPE_CHAR:
+    case rosidl_runtime_c__type_description__FieldType__FIELD_TYPE_BOOLEAN:
+    case rosidl_runtime_c__type_description__FieldType__FIELD_TYPE_BYTE:
+      return {1, 1};
+    case rosidl_runtime_c__type_description__FieldType__FIELD_TYPE_INT16:
+    case rosidl_runtime_c__type_description__FieldType__FIELD_TYPE_UINT16:
+    case rosidl_runtime_c__type_description__FieldType__FIELD_TYPE_WCHAR:
+      return {2, 2};
+    case rosidl_runtime_c__type_description__FieldType__FIELD_TYPE_INT32:
+    case rosidl_runtime_c__type_description__FieldType__FIELD_TYPE_UINT32:
+    case rosidl_runtime_c__type_description__FieldType__FIELD_TYPE_FLOAT:
+      return {4, 4};
+    case rosidl_runtime_c__type_description__FieldType__FIELD_TYPE_INT64:
+    case rosidl_runtime_c__type_description__FieldType__FIELD_TYPE_UINT64:
+    case rosidl_runtime_c__type_description__FieldType__FIELD_TYPE_DOUBLE:
+      return {8, 8};
+    case rosidl_runtime_c__type_description__FieldType__FIELD_TYPE_LONG_DOUBLE:
+      return {sizeof(long double), alignof(long double)};
+    case rosidl_runtime_c__type_description__FieldType__FIELD_TYPE_FIXED_STRING:
+      return {static_cast<size_t>(string_capacity) + 1, 1};
+    case rosidl_runtime_c__type_description__FieldType__FIELD_TYPE_FIXED_WSTRING:
+      return {(static_cast<size_t>(string_capacity) + 1) * 2, 2};
+    case rosidl_runtime_c__type_description__FieldType__FIELD_TYPE_STRING:
+    case rosidl_runtime_c__type_description__FieldType__FIELD_TYPE_WSTRING:
+    case rosidl_runtime_c__type_description__FieldType__FIELD_TYPE_BOUNDED_STRING:
+    case rosidl_runtime_c__type_description__FieldType__FIELD_TYPE_BOUNDED_WSTRING:
+      return {kReferenceSlotSize, kReferenceSlotAlignment};
+    default:
+      throw std::runtime_error(
+              "can not compile access plan: unsupported field type id " +
+              std::to_string(base_type_id));
+  }
+}
+
+size_t
+align_up(size_t offset, size_t alignment)
+{
+  return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+const IndividualTypeDescription &
+resolve_nested(const ReferencedTypeMap & referenced, const std::string & nested_type_name)
+{
+  auto it = referenced.find(nested_type_name);
+  if (it == referenced.end()) {
+    throw std::runtime_error(
+            "can not compile access plan: nested type '" + nested_type_name +
+            "' is missing from the referenced type descriptions");
+  }
+  return *it->second;
+}
+
+/// Lay out the fields of one individual description at base_offset.
+/**
+ * Emits one FieldAccess per leaf field into `out` when it is non-null;
+ * a null `out` only measures, which is used to size nested fixed arrays
+ * and to learn a nested type's alignment before placing it.
+ */
+Layout
+layout_fields(
+  const IndividualTypeDescription & description,
+  const ReferencedTypeMap & referenced,
+  const std::string & prefix,
+  size_t base_offset,
+  size_t depth,
+  std::vector<DynamicMessageAccessPlan::FieldAccess> * out)
+{
+  if (depth > kMaxNestingDepth) {
+    throw std::runtime_error(
+            "can not compile access plan: type description nests deeper than " +
+            std::to_string(kMaxNestingDepth) + " levels");
+  }
+
+  size_t offset = 0;
+  size_t max_alignment = 1;
+
+  for (size_t i = 0; i < description.fields.size; ++i) {
+    const auto & field = description.fields.data[i];
+    const uint8_t type_id = field.type.type_id;
+    const uint8_t base_type_id = base_type_id_of(type_id);
+    const std::string field_name(field.name.data, field.name.size);
+    const bool is_nested =
+      rosidl_runtime_c__type_description__FieldType__FIELD_TYPE_NESTED_TYPE == base_type_id;
+
+    std::string nested_type_name;
+    if (is_nested) {
+      nested_type_name.assign(
+        field.type.nested_type_name.data, field.type.nested_type_name.size);
+    }
+
+    if (is_nested && !is_fixed_array(type_id) && !is_sequence(type_id)) {
+      // Plain nested message: flatten its fields inline. Only the leaves get
+      // plan entries; intermediate path components exist in the dotted names.
+      const auto & nested = resolve_nested(referenced, nested_type_name);
+      Layout nested_layout =
+        layout_fields(nested, referenced, "", 0, depth + 1, nullptr);
+      offset = align_up(offset, nested_layout.alignment);
+      layout_fields(
+        nested, referenced, prefix + field_name + ".",
+        base_offset + offset, depth + 1, out);
+      offset += nested_layout.size;
+      max_alignment = std::max(max_alignment, nested_layout.alignment);
+      continue;
+    }
+
+    Layout element_layout;
+    if (is_nested) {
+      if (is_sequence(type_id)) {
+        // Sequences of nested types stay behind a reference slot.
+        element_layout = {kReferenceSlotSize, kReferenceSlotAlignment};
+      } else {
+        const auto & nested = resolve_nested(referenced, nested_type_name);
+        element_layout =
+          layout_fields(nested, referenced, "", 0, depth + 1, nullptr);
+      }
+    } else if (is_sequence(type_id)) {
+      element_layout = {kReferenceSlotSize, kReferenceSlotAlignment};
+    } else {
+      element_layout = value_layout_of(base_type_id, field.type.string_capacity);
+    }
+
+    size_t stride = align_up(element_layout.size, element_layout.alignment);
+    size_t total_size = element_layout.size;
+    if (is_fixed_array(type_id)) {
+      total_size = stride * static_cast<size_t>(field.type.capacity);
+    } else {
+      stride = total_size;
+    }
+
+    offset = align_up(offset, element_layout.alignment);
+    if (nullptr != out) {
+      DynamicMessageAccessPlan::FieldAccess access;
+      access.name = prefix + field_name;
+      access.type_id = type_id;
+      access.base_type_id = base_type_id;
+      access.capacity = field.type.capacity;
+      access.string_capacity = field.type.string_capacity;
+      access.nested_type_name = std::move(nested_type_name);
+      access.offset = base_offset + offset;
+      access.size = total_size;
+      access.stride = stride;
+      out->push_back(std::move(access));
+    }
+    offset += total_size;
+    max_alignment = std::max(max_alignment, element_layout.alignment);
+  }
+
+  return {align_up(offset, max_alignment), max_alignment};
+}
+
+std::string
+stringified_type_hash_of(const rosidl_runtime_c__type_description__TypeDescription & description)
+{
+  rosidl_type_hash_t type_hash = rosidl_get_zero_initialized_type_hash();
+  // The rosidl_runtime_c type description structs are layout compatible
+  // copies of the type_description_interfaces messages, which is what the
+  // hashing entry point in rcl takes.
+  rcl_ret_t ret = rcl_calculate_type_hash(
+    reinterpret_cast<const type_description_interfaces__msg__TypeDescription *>(&description),
+    &type_hash);
+  if (RCL_RET_OK != ret) {
+    rclcpp::exceptions::throw_from_rcl_error(ret, "failed to calculate type hash");
+  }
+
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  char * hash_string = nullptr;
+  rcutils_ret_t stringify_ret =
+    rosidl_stringify_type_hash(&type_hash, allocator, &hash_string);
+  if (RCUTILS_RET_OK != stringify_ret || nullptr == hash_string) {
+    throw std::runtime_error("failed to stringify type hash");
+  }
+  std::string result(hash_string);
+  allocator.deallocate(hash_string, allocator.state);
+  return result;
+}
+
+}  // namespace
+
+DynamicMessageAccessPlan::DynamicMessageAccessPlan(
+  const rosidl_runtime_c__type_description__TypeDescription & description,
+  std::string type_hash)
+: type_name_(
+    description.type_description.type_name.data,
+    description.type_description.type_name.size),
+  type_hash_(std::move(type_hash))
+{
+  ReferencedTypeMap referenced;
+  for (size_t i = 0; i < description.referenced_type_descriptions.size; ++i) {
+    const auto & individual = description.referenced_type_descriptions.data[i];
+    referenced.emplace(
+      std::string(individual.type_name.data, individual.type_name.size), &individual);
+  }
+
+  Layout layout = layout_fields(
+    description.type_description, referenced, "", 0, 0, &fields_);
+  packed_size_ = layout.size;
+
+  field_index_.reserve(fields_.size());
+  for (size_t i = 0; i < fields_.size(); ++i) {
+    field_index_.emplace(fields_[i].name, i);
+  }
+}
+
+DynamicMessageAccessPlan::SharedPtr
+DynamicMessageAccessPlan::get_or_build(
+  const rosidl_runtime_c__type_description__TypeDescription & description)
+{
+  static std::mutex registry_mutex;
+  static std::unordered_map<std::string, DynamicMessageAccessPlan::SharedPtr> registry;
+
+  std::string type_hash = stringified_type_hash_of(description);
+
+  std::lock_guard<std::mutex> lock(registry_mutex);
+  auto it = registry.find(type_hash);
+  if (it != registry.end()) {
+    return it->second;
+  }
+  // Plans are immutable and shared by every consumer of the type; keep them
+  // cached for the lifetime of the process.
+  DynamicMessageAccessPlan::SharedPtr plan(
+    new DynamicMessageAccessPlan(description, type_hash));
+  registry.emplace(std::move(type_hash), plan);
+  return plan;
+}
+
+const std::vector<DynamicMessageAccessPlan::FieldAccess> &
+DynamicMessageAccessPlan::fields() const
+{
+  return fields_;
+}
+
+const DynamicMessageAccessPlan::FieldAccess *
+DynamicMessageAccessPlan::find_field(const std::string & name) const
+{
+  auto it = field_index_.find(name);
+  if (it == field_index_.end()) {
+    return nullptr;
+  }
+  return &fields_[it->second];
+}
+
+size_t
+DynamicMessageAccessPlan::packed_size() const
+{
+  return packed_size_;
+}
+
+const std::string &
+DynamicMessageAccessPlan::type_hash() const
+{
+  return type_hash_;
+}
+
+const std::string &
+DynamicMessageAccessPlan::type_name() const
+{
+  return type_name_;
+}
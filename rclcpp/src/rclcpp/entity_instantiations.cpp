@@ -0,0 +1,22 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/entity_instantiations.hpp"
+
+// Definitions for the extern template declarations in entity_instantiations.hpp.
+// This translation unit is the only place these templates are compiled.
+
+RCLCPP_DEFINE_ENTITY_INSTANTIATIONS(rcl_interfaces::msg::ParameterEvent)
+RCLCPP_DEFINE_ENTITY_INSTANTIATIONS(rosgraph_msgs::msg::Clock)
+RCLCPP_DEFINE_ENTITY_INSTANTIATIONS(statistics_msgs::msg::MetricsMessage)
@@ -13,6 +13,9 @@
 // limitations under the License.
 
 #include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <functional>
 #include <memory>
 #include <map>
 #include <string>
@@ -27,7 +30,10 @@
 #include "rclcpp/dynamic_typesupport/dynamic_message.hpp"
 #include "rclcpp/exceptions.hpp"
 #include "rclcpp/executor.hpp"
+#include "rclcpp/executor_introspection.hpp"
+#include "rclcpp/executor_schedule.hpp"
 #include "rclcpp/guard_condition.hpp"
+#include "rclcpp/introspection.hpp"
 #include "rclcpp/memory_strategy.hpp"
 #include "rclcpp/node.hpp"
 #include "rclcpp/utilities.hpp"
@@ -85,6 +91,8 @@ Executor::Executor(const rclcpp::ExecutorOptions & options)
 
 Executor::~Executor()
 {
+  // Stop the watchdog thread before tearing down the state it observes.
+  this->watchdog_stop();
   // Disassociate all callback groups.
   for (auto & pair : weak_groups_to_nodes_) {
     auto group = pair.first.lock();
@@ -232,7 +240,7 @@ Executor::add_callback_group_to_map(
   if (notify) {
     // Interrupt waiting to handle new node
     try {
-      interrupt_guard_condition_->trigger();
+      trigger_interrupt_guard_condition();
     } catch (const rclcpp::exceptions::RCLError & ex) {
       throw std::runtime_error(
               std::string(
@@ -320,7 +328,7 @@ Executor::remove_callback_group_from_map(
 
     if (notify) {
       try {
-        interrupt_guard_condition_->trigger();
+        trigger_interrupt_guard_condition();
       } catch (const rclcpp::exceptions::RCLError & ex) {
         throw std::runtime_error(
                 std::string(
@@ -431,6 +439,17 @@ void Executor::spin_some(std::chrono::nanoseconds max_duration)
   return this->spin_some_impl(max_duration, false);
 }
 
+void Executor::spin_some(std::chrono::nanoseconds max_duration, size_t max_callbacks)
+{
+  if (max_duration < 0ns) {
+    throw std::invalid_argument("max_duration must be greater than or equal to 0");
+  }
+  if (0u == max_callbacks) {
+    throw std::invalid_argument("max_callbacks must be greater than 0");
+  }
+  return this->spin_some_impl(max_duration, false, max_callbacks);
+}
+
 void Executor::spin_all(std::chrono::nanoseconds max_duration)
 {
   if (max_duration < 0ns) {
@@ -440,7 +459,8 @@ void Executor::spin_all(std::chrono::nanoseconds max_duration)
 }
 
 void
-Executor::spin_some_impl(std::chrono::nanoseconds max_duration, bool exhaustive)
+Executor::spin_some_impl(
+  std::chrono::nanoseconds max_duration, bool exhaustive, size_t max_callbacks)
 {
   auto start = std::chrono::steady_clock::now();
   auto max_duration_not_elapsed = [max_duration, start]() {
@@ -459,14 +479,36 @@ Executor::spin_some_impl(std::chrono::nanoseconds max_duration, bool exhaustive)
     throw std::runtime_error("spin_some() called while already spinning");
   }
   RCPPUTILS_SCOPE_EXIT(this->spinning.store(false); );
+
+  const bool budgeted = max_callbacks > 0u;
+  if (budgeted) {
+    // Resume the category rotation where the previous budgeted slice stopped, so leftover
+    // work is picked up first next frame rather than re-starting at the timers.
+    ready_dispatch_offset_ = spin_some_category_cursor_;
+  }
+  RCPPUTILS_SCOPE_EXIT(
+    if (budgeted) {
+      this->spin_some_category_cursor_ = this->ready_dispatch_offset_;
+      this->ready_dispatch_offset_ = 0;
+    });
+
   bool work_available = false;
-  while (rclcpp::ok(context_) && spinning.load() && max_duration_not_elapsed()) {
-    AnyExecutable any_exec;
+  size_t executed = 0;
+  // One recycled record for the whole spin, see AnyExecutable::reset().
+  AnyExecutable any_exec;
+  while (rclcpp::ok(context_) && spinning.load() && max_duration_not_elapsed() &&
+    (!budgeted || executed < max_callbacks))
+  {
     if (!work_available) {
       wait_for_work(std::chrono::milliseconds::zero());
     }
     if (get_next_ready_executable(any_exec)) {
       execute_any_executable(any_exec);
+      any_exec.reset();
+      ++executed;
+      if (budgeted) {
+        ready_dispatch_offset_ = (ready_dispatch_offset_ + 1) % ready_category_count;
+      }
       work_available = true;
     } else {
       if (!work_available || !exhaustive) {
@@ -480,10 +522,12 @@ Executor::spin_some_impl(std::chrono::nanoseconds max_duration, bool exhaustive)
 void
 Executor::spin_once_impl(std::chrono::nanoseconds timeout)
 {
-  AnyExecutable any_exec;
-  if (get_next_executable(any_exec, timeout)) {
-    execute_any_executable(any_exec);
+  // Reuse the executor-owned record; spin exclusivity (the `spinning` flag) guarantees
+  // only one spin path touches it at a time.  See AnyExecutable::reset().
+  if (get_next_executable(spin_once_executable_, timeout)) {
+    execute_any_executable(spin_once_executable_);
   }
+  spin_once_executable_.reset();
 }
 
 void
@@ -496,18 +540,70 @@ Executor::spin_once(std::chrono::nanoseconds timeout)
   spin_once_impl(timeout);
 }
 
+rclcpp::FutureReturnCode
+Executor::spin_until_ready_impl(
+  const rclcpp::detail::InplaceFunction<bool()> & future_ready,
+  std::chrono::nanoseconds timeout)
+{
+  auto end_time = std::chrono::steady_clock::now();
+  if (timeout > std::chrono::nanoseconds::zero()) {
+    end_time += timeout;
+  }
+  std::chrono::nanoseconds timeout_left = timeout;
+
+  if (spinning.exchange(true)) {
+    throw std::runtime_error("spin_until_future_complete() called while already spinning");
+  }
+  RCPPUTILS_SCOPE_EXIT(this->spinning.store(false); );
+  while (rclcpp::ok(this->context_) && spinning.load()) {
+    // Do one item of work; the wait inside parks on the wait set, which includes the
+    // interrupt guard condition, so cancel() and entity changes wake it promptly.
+    spin_once_impl(timeout_left);
+
+    // Check if the future is set, return SUCCESS if it is.
+    if (future_ready()) {
+      return FutureReturnCode::SUCCESS;
+    }
+    // If the original timeout is < 0, then this is blocking, never TIMEOUT.
+    if (timeout < std::chrono::nanoseconds::zero()) {
+      continue;
+    }
+    // Otherwise check if we still have time to wait, return TIMEOUT if not.
+    auto now = std::chrono::steady_clock::now();
+    if (now >= end_time) {
+      return FutureReturnCode::TIMEOUT;
+    }
+    // Subtract the elapsed time from the original timeout.
+    timeout_left = std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - now);
+  }
+
+  // The future did not complete before ok() returned false, return INTERRUPTED.
+  return FutureReturnCode::INTERRUPTED;
+}
+
 void
 Executor::cancel()
 {
   spinning.store(false);
   try {
-    interrupt_guard_condition_->trigger();
+    trigger_interrupt_guard_condition();
   } catch (const rclcpp::exceptions::RCLError & ex) {
     throw std::runtime_error(
             std::string("Failed to trigger guard condition in cancel: ") + ex.what());
   }
 }
 
+void
+Executor::trigger_interrupt_guard_condition()
+{
+  if (interrupt_pending_.exchange(true)) {
+    // A wakeup is already on its way and the wait set has not consumed it
+    // yet, so this trigger rides along with it.
+    return;
+  }
+  interrupt_guard_condition_->trigger();
+}
+
 void
 Executor::set_memory_strategy(rclcpp::memory_strategy::MemoryStrategy::SharedPtr memory_strategy)
 {
@@ -518,12 +614,197 @@ Executor::set_memory_strategy(rclcpp::memory_strategy::MemoryStrategy::SharedPtr
   memory_strategy_ = memory_strategy;
 }
 
+void
+Executor::add_idle_work(std::function<bool()> callback, std::chrono::nanoseconds budget)
+{
+  if (nullptr == callback) {
+    throw std::invalid_argument("callback is nullptr");
+  }
+  if (budget <= std::chrono::nanoseconds::zero()) {
+    throw std::invalid_argument("budget must be positive");
+  }
+  std::lock_guard<std::mutex> guard{mutex_};
+  idle_work_.push_back({std::move(callback), budget});
+}
+
+void
+Executor::set_callback_deadline(std::chrono::nanoseconds deadline)
+{
+  if (deadline < std::chrono::nanoseconds::zero()) {
+    throw std::invalid_argument("deadline cannot be negative");
+  }
+  if (deadline == std::chrono::nanoseconds::zero()) {
+    this->watchdog_stop();
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(watchdog_.mutex);
+    watchdog_.deadline = deadline;
+  }
+  if (!watchdog_thread_.joinable()) {
+    watchdog_thread_ = std::thread([this]() {this->watchdog_run();});
+  }
+  watchdog_enabled_.store(true, std::memory_order_relaxed);
+}
+
+void
+Executor::watchdog_arm(const AnyExecutable & any_exec)
+{
+  std::string description = "unknown";
+  if (any_exec.timer) {
+    description = "timer";
+  } else if (any_exec.subscription) {
+    description = std::string("subscription '") + any_exec.subscription->get_topic_name() + "'";
+  } else if (any_exec.service) {
+    description = std::string("service '") + any_exec.service->get_service_name() + "'";
+  } else if (any_exec.client) {
+    description = std::string("client '") + any_exec.client->get_service_name() + "'";
+  } else if (any_exec.waitable) {
+    description = "waitable";
+  }
+  std::lock_guard<std::mutex> lock(watchdog_.mutex);
+  watchdog_.description = std::move(description);
+  watchdog_.dispatch_start = std::chrono::steady_clock::now();
+  ++watchdog_.generation;  // now odd: armed
+  watchdog_.cv.notify_all();
+}
+
+void
+Executor::watchdog_disarm()
+{
+  std::lock_guard<std::mutex> lock(watchdog_.mutex);
+  ++watchdog_.generation;  // now even: idle
+  watchdog_.cv.notify_all();
+}
+
+void
+Executor::watchdog_run()
+{
+  std::unique_lock<std::mutex> lock(watchdog_.mutex);
+  while (!watchdog_.shutdown) {
+    if (0u == (watchdog_.generation & 1u)) {
+      // Nothing armed, sleep until a dispatch starts or we shut down.
+      watchdog_.cv.wait(lock);
+      continue;
+    }
+    const uint64_t armed_generation = watchdog_.generation;
+    const auto wake_at = watchdog_.dispatch_start + watchdog_.deadline;
+    const bool disarmed_in_time = watchdog_.cv.wait_until(
+      lock, wake_at,
+      [this, armed_generation]() {
+        return watchdog_.shutdown || watchdog_.generation != armed_generation;
+      });
+    if (disarmed_in_time) {
+      continue;
+    }
+    // The same dispatch is still running past its deadline, flag it.
+    const auto running = std::chrono::steady_clock::now() - watchdog_.dispatch_start;
+    rclcpp::introspection::record_stall(
+      watchdog_.description,
+      static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(running).count()));
+    // One record per dispatch: wait for it to finish before re-arming.
+    watchdog_.cv.wait(
+      lock,
+      [this, armed_generation]() {
+        return watchdog_.shutdown || watchdog_.generation != armed_generation;
+      });
+  }
+}
+
+void
+Executor::watchdog_stop()
+{
+  watchdog_enabled_.store(false, std::memory_order_relaxed);
+  if (!watchdog_thread_.joinable()) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(watchdog_.mutex);
+    watchdog_.shutdown = true;
+    watchdog_.cv.notify_all();
+  }
+  watchdog_thread_.join();
+  watchdog_thread_ = std::thread();
+  std::lock_guard<std::mutex> lock(watchdog_.mutex);
+  watchdog_.shutdown = false;
+  watchdog_.deadline = std::chrono::nanoseconds::zero();
+}
+
+bool
+Executor::run_idle_work()
+{
+  size_t remaining_entries;
+  {
+    std::lock_guard<std::mutex> guard{mutex_};
+    remaining_entries = idle_work_.size();
+  }
+  // At most one full rotation: every entry gets one chance to claim the slice.
+  while (remaining_entries-- > 0u) {
+    IdleWork entry;
+    {
+      std::lock_guard<std::mutex> guard{mutex_};
+      if (idle_work_.empty()) {
+        return false;
+      }
+      idle_work_cursor_ %= idle_work_.size();
+      entry = idle_work_[idle_work_cursor_];
+      idle_work_cursor_ = (idle_work_cursor_ + 1u) % idle_work_.size();
+    }
+    // Run the slice without the lock; idle callbacks may register more work.
+    auto deadline = std::chrono::steady_clock::now() + entry.budget;
+    bool did_work = false;
+    do {
+      if (!entry.callback()) {
+        break;  // this entry has nothing (more) to do right now
+      }
+      did_work = true;
+    } while (std::chrono::steady_clock::now() < deadline && spinning.load());
+    if (did_work) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/// Return the CPU time consumed by the calling thread.
+/**
+ * Windows has no cheap equivalent of CLOCK_THREAD_CPUTIME_ID without pulling
+ * in windows.h, so wall time stands in there; blocking callbacks are then
+ * over-attributed, which is acceptable for utilization accounting.
+ */
+static std::chrono::nanoseconds
+thread_cpu_time_now()
+{
+#if defined(_WIN32)
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch());
+#else
+  struct timespec ts;
+  if (0 != clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts)) {
+    return std::chrono::nanoseconds(0);
+  }
+  return std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec);
+#endif
+}
+
 void
 Executor::execute_any_executable(AnyExecutable & any_exec)
 {
   if (!spinning.load()) {
     return;
   }
+  const std::chrono::nanoseconds cpu_start = thread_cpu_time_now();
+  const bool record_introspection = rclcpp::executor_introspection::enabled();
+  const bool record_schedule = rclcpp::executor_schedule::recording();
+  std::chrono::steady_clock::time_point dispatch_start;
+  if (record_introspection || record_schedule) {
+    dispatch_start = std::chrono::steady_clock::now();
+  }
+  const bool watchdog_enabled = watchdog_enabled_.load(std::memory_order_relaxed);
+  if (watchdog_enabled) {
+    this->watchdog_arm(any_exec);
+  }
   if (any_exec.timer) {
     TRACETOOLS_TRACEPOINT(
       rclcpp_executor_execute,
@@ -537,20 +818,67 @@ Executor::execute_any_executable(AnyExecutable & any_exec)
     execute_subscription(any_exec.subscription);
   }
   if (any_exec.service) {
+    TRACETOOLS_TRACEPOINT(
+      rclcpp_executor_execute,
+      static_cast<const void *>(any_exec.service->get_service_handle().get()));
     execute_service(any_exec.service);
   }
   if (any_exec.client) {
+    TRACETOOLS_TRACEPOINT(
+      rclcpp_executor_execute,
+      static_cast<const void *>(any_exec.client->get_client_handle().get()));
     execute_client(any_exec.client);
   }
   if (any_exec.waitable) {
+    TRACETOOLS_TRACEPOINT(
+      rclcpp_executor_execute,
+      static_cast<const void *>(any_exec.waitable.get()));
     any_exec.waitable->execute(any_exec.data);
   }
+  if (watchdog_enabled) {
+    this->watchdog_disarm();
+  }
+  if (record_introspection || record_schedule) {
+    const auto dispatch_end = std::chrono::steady_clock::now();
+    if (record_introspection) {
+      rclcpp::executor_introspection::record_dispatch(dispatch_start, dispatch_end);
+    }
+    if (record_schedule) {
+      // Same identifiers as the rclcpp_executor_execute tracepoints above.
+      uint64_t entity_id = 0;
+      auto kind = rclcpp::executor_schedule::ExecutableKind::Waitable;
+      if (any_exec.timer) {
+        entity_id = reinterpret_cast<uint64_t>(any_exec.timer->get_timer_handle().get());
+        kind = rclcpp::executor_schedule::ExecutableKind::Timer;
+      } else if (any_exec.subscription) {
+        entity_id =
+          reinterpret_cast<uint64_t>(any_exec.subscription->get_subscription_handle().get());
+        kind = rclcpp::executor_schedule::ExecutableKind::Subscription;
+      } else if (any_exec.service) {
+        entity_id = reinterpret_cast<uint64_t>(any_exec.service->get_service_handle().get());
+        kind = rclcpp::executor_schedule::ExecutableKind::Service;
+      } else if (any_exec.client) {
+        entity_id = reinterpret_cast<uint64_t>(any_exec.client->get_client_handle().get());
+        kind = rclcpp::executor_schedule::ExecutableKind::Client;
+      } else if (any_exec.waitable) {
+        entity_id = reinterpret_cast<uint64_t>(any_exec.waitable.get());
+      }
+      rclcpp::executor_schedule::record_dispatch(
+        entity_id, kind,
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+          dispatch_start.time_since_epoch()).count(),
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+          dispatch_end.time_since_epoch()).count());
+    }
+  }
+  // Attribute the CPU time of the dispatch to the callback group.
+  any_exec.callback_group->record_execution(thread_cpu_time_now() - cpu_start);
   // Reset the callback_group, regardless of type
   any_exec.callback_group->can_be_taken_from().store(true);
   // Wake the wait, because it may need to be recalculated or work that
   // was previously blocked is now available.
   try {
-    interrupt_guard_condition_->trigger();
+    trigger_interrupt_guard_condition();
   } catch (const rclcpp::exceptions::RCLError & ex) {
     throw std::runtime_error(
             std::string(
@@ -560,7 +888,7 @@ Executor::execute_any_executable(AnyExecutable & any_exec)
 
 template<typename Taker, typename Handler>
 static
-void
+bool
 take_and_do_error_handling(
   const char * action_description,
   const char * topic_or_service_name,
@@ -593,6 +921,7 @@ take_and_do_error_handling(
       action_description,
       topic_or_service_name);
   }
+  return taken;
 }
 
 void
@@ -603,91 +932,169 @@ Executor::execute_subscription(rclcpp::SubscriptionBase::SharedPtr subscription)
   rclcpp::MessageInfo message_info;
   message_info.get_rmw_message_info().from_intra_process = false;
 
-  switch (subscription->get_delivered_message_kind()) {
-    // Deliver ROS message
-    case rclcpp::DeliveredMessageKind::ROS_MESSAGE:
+  // Drain up to the configured batch of pending messages in this activation,
+  // stopping as soon as a take comes back empty.
+  // The default batch size of 1 preserves the one-message-per-wakeup behavior.
+  const size_t take_batch_size = subscription->get_take_batch_size();
+
+  if (take_batch_size > 1 &&
+    rclcpp::DeliveredMessageKind::ROS_MESSAGE == subscription->get_delivered_message_kind() &&
+    !subscription->can_loan_messages())
+  {
+    // Burst path: drain the whole batch with a single take-sequence round
+    // trip into preallocated messages instead of one rcl_take per message.
+    std::vector<std::shared_ptr<void>> messages(take_batch_size);
+    std::vector<void *> raw_messages(take_batch_size);
+    std::vector<rclcpp::MessageInfo> message_infos(take_batch_size);
+    for (size_t i = 0; i < take_batch_size; ++i) {
+      messages[i] = subscription->create_message();
+      raw_messages[i] = messages[i].get();
+      message_infos[i].get_rmw_message_info().from_intra_process = false;
+    }
+    size_t taken_count = 0;
+    take_and_do_error_handling(
+      "taking a batch of messages from topic",
+      subscription->get_topic_name(),
+      [&]()
       {
-        if (subscription->can_loan_messages()) {
-          // This is the case where a loaned message is taken from the middleware via
-          // inter-process communication, given to the user for their callback,
-          // and then returned.
-          void * loaned_msg = nullptr;
-          // TODO(wjwwood): refactor this into methods on subscription when LoanedMessage
-          //   is extened to support subscriptions as well.
-          take_and_do_error_handling(
-            "taking a loaned message from topic",
-            subscription->get_topic_name(),
-            [&]()
-            {
-              rcl_ret_t ret = rcl_take_loaned_message(
-                subscription->get_subscription_handle().get(),
-                &loaned_msg,
-                &message_info.get_rmw_message_info(),
-                nullptr);
-              if (RCL_RET_SUBSCRIPTION_TAKE_FAILED == ret) {
-                return false;
-              } else if (RCL_RET_OK != ret) {
-                rclcpp::exceptions::throw_from_rcl_error(ret);
+        taken_count = subscription->take_type_erased_sequence(
+          take_batch_size, raw_messages.data(), message_infos.data());
+        return taken_count > 0;
+      },
+      [&]()
+      {
+        for (size_t i = 0; i < taken_count; ++i) {
+          if (subscription->matches_any_intra_process_publishers(
+              &message_infos[i].get_rmw_message_info().publisher_gid))
+          {
+            // Delivered via intra-process, ignore this copy of the message.
+            continue;
+          }
+          if (subscription->shed_stale_message(message_infos[i])) {
+            // Exceeded the configured age, drop it unread.
+            continue;
+          }
+          if (subscription->matches_content_filter(raw_messages[i], message_infos[i])) {
+            subscription->handle_message(messages[i], message_infos[i]);
+          }
+        }
+      });
+    for (size_t i = 0; i < take_batch_size; ++i) {
+      subscription->return_message(messages[i]);
+    }
+    return;
+  }
+
+  for (size_t taken_count = 0; taken_count < take_batch_size; taken_count++) {
+    bool taken = false;
+    switch (subscription->get_delivered_message_kind()) {
+      // Deliver ROS message
+      case rclcpp::DeliveredMessageKind::ROS_MESSAGE:
+        {
+          if (subscription->can_loan_messages()) {
+            // This is the case where a loaned message is taken from the middleware via
+            // inter-process communication, given to the user for their callback,
+            // and then returned.
+            void * loaned_msg = nullptr;
+            // TODO(wjwwood): refactor this into methods on subscription when LoanedMessage
+            //   is extened to support subscriptions as well.
+            taken = take_and_do_error_handling(
+              "taking a loaned message from topic",
+              subscription->get_topic_name(),
+              [&]()
+              {
+                rcl_ret_t ret = rcl_take_loaned_message(
+                  subscription->get_subscription_handle().get(),
+                  &loaned_msg,
+                  &message_info.get_rmw_message_info(),
+                  nullptr);
+                if (RCL_RET_SUBSCRIPTION_TAKE_FAILED == ret) {
+                  return false;
+                } else if (RCL_RET_OK != ret) {
+                  rclcpp::exceptions::throw_from_rcl_error(ret);
+                }
+                return true;
+              },
+              [&]()
+              {
+                if (!subscription->shed_stale_message(message_info) &&
+                  subscription->matches_content_filter(loaned_msg, message_info))
+                {
+                  subscription->handle_loaned_message(loaned_msg, message_info);
+                }
+              });
+            if (nullptr != loaned_msg) {
+              rcl_ret_t ret = rcl_return_loaned_message_from_subscription(
+                subscription->get_subscription_handle().get(), loaned_msg);
+              if (RCL_RET_OK != ret) {
+                RCLCPP_ERROR(
+                  rclcpp::get_logger("rclcpp"),
+                  "rcl_return_loaned_message_from_subscription() failed for subscription on topic "
+                  "'%s': %s",
+                  subscription->get_topic_name(), rcl_get_error_string().str);
               }
-              return true;
-            },
-            [&]() {subscription->handle_loaned_message(loaned_msg, message_info);});
-          if (nullptr != loaned_msg) {
-            rcl_ret_t ret = rcl_return_loaned_message_from_subscription(
-              subscription->get_subscription_handle().get(), loaned_msg);
-            if (RCL_RET_OK != ret) {
-              RCLCPP_ERROR(
-                rclcpp::get_logger("rclcpp"),
-                "rcl_return_loaned_message_from_subscription() failed for subscription on topic "
-                "'%s': %s",
-                subscription->get_topic_name(), rcl_get_error_string().str);
+              loaned_msg = nullptr;
             }
-            loaned_msg = nullptr;
+          } else {
+            // This case is taking a copy of the message data from the middleware via
+            // inter-process communication.
+            std::shared_ptr<void> message = subscription->create_message();
+            taken = take_and_do_error_handling(
+              "taking a message from topic",
+              subscription->get_topic_name(),
+              [&]() {return subscription->take_type_erased(message.get(), message_info);},
+              [&]()
+              {
+                if (!subscription->shed_stale_message(message_info) &&
+                  subscription->matches_content_filter(message.get(), message_info))
+                {
+                  subscription->handle_message(message, message_info);
+                }
+              });
+            subscription->return_message(message);
           }
-        } else {
-          // This case is taking a copy of the message data from the middleware via
-          // inter-process communication.
-          std::shared_ptr<void> message = subscription->create_message();
-          take_and_do_error_handling(
-            "taking a message from topic",
-            subscription->get_topic_name(),
-            [&]() {return subscription->take_type_erased(message.get(), message_info);},
-            [&]() {subscription->handle_message(message, message_info);});
-          subscription->return_message(message);
+          break;
         }
-        break;
-      }
 
-    // Deliver serialized message
-    case rclcpp::DeliveredMessageKind::SERIALIZED_MESSAGE:
-      {
-        // This is the case where a copy of the serialized message is taken from
-        // the middleware via inter-process communication.
-        std::shared_ptr<SerializedMessage> serialized_msg =
-          subscription->create_serialized_message();
-        take_and_do_error_handling(
-          "taking a serialized message from topic",
-          subscription->get_topic_name(),
-          [&]() {return subscription->take_serialized(*serialized_msg.get(), message_info);},
-          [&]()
-          {
-            subscription->handle_serialized_message(serialized_msg, message_info);
-          });
-        subscription->return_serialized_message(serialized_msg);
-        break;
-      }
+      // Deliver serialized message
+      case rclcpp::DeliveredMessageKind::SERIALIZED_MESSAGE:
+        {
+          // This is the case where a copy of the serialized message is taken from
+          // the middleware via inter-process communication.
+          std::shared_ptr<SerializedMessage> serialized_msg =
+            subscription->create_serialized_message();
+          taken = take_and_do_error_handling(
+            "taking a serialized message from topic",
+            subscription->get_topic_name(),
+            [&]() {return subscription->take_serialized(*serialized_msg.get(), message_info);},
+            [&]()
+            {
+              if (!subscription->shed_stale_message(message_info) &&
+                subscription->matches_content_filter(serialized_msg.get(), message_info))
+              {
+                subscription->handle_serialized_message(serialized_msg, message_info);
+              }
+            });
+          subscription->return_serialized_message(serialized_msg);
+          break;
+        }
 
-    // DYNAMIC SUBSCRIPTION ========================================================================
-    // Deliver dynamic message
-    case rclcpp::DeliveredMessageKind::DYNAMIC_MESSAGE:
-      {
-        throw std::runtime_error("Unimplemented");
-      }
+      // DYNAMIC SUBSCRIPTION ========================================================================
+      // Deliver dynamic message
+      case rclcpp::DeliveredMessageKind::DYNAMIC_MESSAGE:
+        {
+          throw std::runtime_error("Unimplemented");
+        }
 
-    default:
-      {
-        throw std::runtime_error("Delivered message kind is not supported");
-      }
+      default:
+        {
+          throw std::runtime_error("Delivered message kind is not supported");
+        }
+    }
+    if (!taken) {
+      // Nothing left to take, the rest of the batch would also come back empty.
+      return;
+    }
   }
   return;
 }
@@ -701,13 +1108,19 @@ Executor::execute_timer(rclcpp::TimerBase::SharedPtr timer)
 void
 Executor::execute_service(rclcpp::ServiceBase::SharedPtr service)
 {
-  auto request_header = service->create_request_header();
-  std::shared_ptr<void> request = service->create_request();
-  take_and_do_error_handling(
-    "taking a service server request from service",
-    service->get_service_name(),
-    [&]() {return service->take_type_erased_request(request.get(), *request_header);},
-    [&]() {service->handle_request(request_header, request);});
+  bool taken = false;
+  do {
+    auto request_header = service->create_request_header();
+    std::shared_ptr<void> request = service->create_request();
+    taken = false;
+    take_and_do_error_handling(
+      "taking a service server request from service",
+      service->get_service_name(),
+      [&]() {return taken = service->take_type_erased_request(request.get(), *request_header);},
+      [&]() {service->handle_request(request_header, request);});
+    // In drain mode, keep taking until the middleware has no requests left,
+    // so a burst costs one wait-set round trip instead of one per request.
+  } while (taken && service->drain_requests_on_execute());
 }
 
 void
@@ -802,6 +1215,9 @@ Executor::wait_for_work(std::chrono::nanoseconds timeout)
 
   rcl_ret_t status =
     rcl_wait(&wait_set_, std::chrono::duration_cast<std::chrono::nanoseconds>(timeout).count());
+  // The wait consumed any pending trigger: open a fresh coalescing window so
+  // triggers from here on produce a wakeup of their own.
+  interrupt_pending_.store(false);
   if (status == RCL_RET_WAIT_SET_EMPTY) {
     RCUTILS_LOG_WARN_NAMED(
       "rclcpp",
@@ -811,6 +1227,13 @@ Executor::wait_for_work(std::chrono::nanoseconds timeout)
     throw_from_rcl_error(status, "rcl_wait() failed");
   }
 
+  if (rclcpp::executor_introspection::enabled()) {
+    rclcpp::executor_introspection::mark_wakeup();
+  }
+  if (rclcpp::executor_schedule::recording()) {
+    rclcpp::executor_schedule::mark_wakeup();
+  }
+
   // check the null handles in the wait set and remove them from the handles in memory strategy
   // for callback-based entities
   std::lock_guard<std::mutex> guard(mutex_);
@@ -885,38 +1308,39 @@ Executor::get_next_ready_executable_from_map(
   TRACETOOLS_TRACEPOINT(rclcpp_executor_get_next_ready);
   bool success = false;
   std::lock_guard<std::mutex> guard{mutex_};
-  // Check the timers to see if there are any that are ready
-  memory_strategy_->get_next_timer(any_executable, weak_groups_to_nodes);
-  if (any_executable.timer) {
-    success = true;
-  }
-  if (!success) {
-    // Check the subscriptions to see if there are any that are ready
-    memory_strategy_->get_next_subscription(any_executable, weak_groups_to_nodes);
-    if (any_executable.subscription) {
-      success = true;
-    }
-  }
-  if (!success) {
-    // Check the services to see if there are any that are ready
-    memory_strategy_->get_next_service(any_executable, weak_groups_to_nodes);
-    if (any_executable.service) {
-      success = true;
-    }
-  }
-  if (!success) {
-    // Check the clients to see if there are any that are ready
-    memory_strategy_->get_next_client(any_executable, weak_groups_to_nodes);
-    if (any_executable.client) {
-      success = true;
-    }
-  }
-  if (!success) {
-    // Check the waitables to see if there are any that are ready
-    memory_strategy_->get_next_waitable(any_executable, weak_groups_to_nodes);
-    if (any_executable.waitable) {
-      any_executable.data = any_executable.waitable->take_data();
-      success = true;
+  // Probe the entity categories starting at ready_dispatch_offset_, which stays 0 for the
+  // classic spin paths (preserving timers-first ordering) and rotates during budgeted
+  // spin_some slices so one ready-heavy category cannot monopolize a slice.
+  for (size_t i = 0; !success && i < ready_category_count; ++i) {
+    switch ((ready_dispatch_offset_ + i) % ready_category_count) {
+      case 0:
+        // Check the timers to see if there are any that are ready
+        memory_strategy_->get_next_timer(any_executable, weak_groups_to_nodes);
+        success = nullptr != any_executable.timer;
+        break;
+      case 1:
+        // Check the subscriptions to see if there are any that are ready
+        memory_strategy_->get_next_subscription(any_executable, weak_groups_to_nodes);
+        success = nullptr != any_executable.subscription;
+        break;
+      case 2:
+        // Check the services to see if there are any that are ready
+        memory_strategy_->get_next_service(any_executable, weak_groups_to_nodes);
+        success = nullptr != any_executable.service;
+        break;
+      case 3:
+        // Check the clients to see if there are any that are ready
+        memory_strategy_->get_next_client(any_executable, weak_groups_to_nodes);
+        success = nullptr != any_executable.client;
+        break;
+      case 4:
+        // Check the waitables to see if there are any that are ready
+        memory_strategy_->get_next_waitable(any_executable, weak_groups_to_nodes);
+        if (any_executable.waitable) {
+          any_executable.data = any_executable.waitable->take_data();
+          success = true;
+        }
+        break;
     }
   }
   // At this point any_executable should be valid with either a valid subscription
@@ -956,7 +1380,33 @@ Executor::get_next_executable(AnyExecutable & any_executable, std::chrono::nanos
   success = get_next_ready_executable(any_executable);
   // If there are none
   if (!success) {
-    // Wait for subscriptions or timers to work on
+    // Spend what would otherwise be blocking time on registered idle work:
+    // alternate bounded housekeeping slices with non-blocking polls for real
+    // work, so ready callbacks are delayed by at most one slice.  The given
+    // timeout bounds the whole idle phase, like it bounds the wait below.
+    auto start = std::chrono::steady_clock::now();
+    while (run_idle_work()) {
+      if (!spinning.load()) {
+        return false;
+      }
+      wait_for_work(std::chrono::milliseconds::zero());
+      success = get_next_ready_executable(any_executable);
+      if (success) {
+        return true;
+      }
+      if (timeout >= std::chrono::nanoseconds::zero() &&
+        std::chrono::steady_clock::now() - start >= timeout)
+      {
+        return false;
+      }
+    }
+    // No idle work pending; wait for subscriptions or timers to work on
+    if (timeout >= std::chrono::nanoseconds::zero()) {
+      timeout -= std::min(
+        timeout,
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now() - start));
+    }
     wait_for_work(timeout);
     if (!spinning.load()) {
       return false;
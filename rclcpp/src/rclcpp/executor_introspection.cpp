@@ -0,0 +1,251 @@
+// Copyright 2024 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/executor_introspection.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+
+using rclcpp::executor_introspection::kHistogramBuckets;
+
+// Number of bits of sub-bucket precision per power of two.
+constexpr size_t kSubBucketBits = 2;
+constexpr uint64_t kSubBuckets = uint64_t(1) << kSubBucketBits;
+
+/// Histogram with logarithmic buckets that can be recorded into without locks.
+/**
+ * Each executor thread owns one instance and is the only writer; readers
+ * aggregate the atomic counters of all instances into a snapshot.
+ */
+class Histogram
+{
+public:
+  void record(uint64_t value_ns)
+  {
+    const size_t index = rclcpp::executor_introspection::bucket_index(value_ns);
+    buckets_[index].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(value_ns, std::memory_order_relaxed);
+    // Only the owning thread records, so a plain read-then-store max is fine.
+    if (value_ns > max_.load(std::memory_order_relaxed)) {
+      max_.store(value_ns, std::memory_order_relaxed);
+    }
+  }
+
+  void accumulate_into(rclcpp::executor_introspection::HistogramSnapshot & snapshot) const
+  {
+    snapshot.count += count_.load(std::memory_order_relaxed);
+    snapshot.sum_ns += sum_.load(std::memory_order_relaxed);
+    snapshot.max_ns = std::max(snapshot.max_ns, max_.load(std::memory_order_relaxed));
+    for (size_t i = 0; i < kHistogramBuckets; i++) {
+      snapshot.buckets[i] += buckets_[i].load(std::memory_order_relaxed);
+    }
+  }
+
+  void reset()
+  {
+    count_.store(0, std::memory_order_relaxed);
+    sum_.store(0, std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+    for (size_t i = 0; i < kHistogramBuckets; i++) {
+      buckets_[i].store(0, std::memory_order_relaxed);
+    }
+  }
+
+private:
+  std::array<std::atomic<uint64_t>, kHistogramBuckets> buckets_ {};
+  std::atomic<uint64_t> count_ {0};
+  std::atomic<uint64_t> sum_ {0};
+  std::atomic<uint64_t> max_ {0};
+};
+
+/// Per-thread recording state, kept alive past thread exit by the registry.
+struct ThreadRecorder
+{
+  Histogram wakeup_to_dispatch;
+  Histogram dispatch_duration;
+  // Time of the last `mark_wakeup()` on this thread, only touched by it.
+  std::chrono::steady_clock::time_point last_wakeup;
+  bool has_wakeup = false;
+};
+
+std::atomic<bool> g_enabled {false};
+
+std::mutex & registry_mutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+std::vector<std::shared_ptr<ThreadRecorder>> & registry()
+{
+  static std::vector<std::shared_ptr<ThreadRecorder>> recorders;
+  return recorders;
+}
+
+ThreadRecorder & local_recorder()
+{
+  thread_local std::shared_ptr<ThreadRecorder> recorder = []() {
+      auto new_recorder = std::make_shared<ThreadRecorder>();
+      std::lock_guard<std::mutex> lock(registry_mutex());
+      registry().push_back(new_recorder);
+      return new_recorder;
+    }();
+  return *recorder;
+}
+
+template<typename HistogramSelector>
+rclcpp::executor_introspection::HistogramSnapshot
+make_snapshot(HistogramSelector select)
+{
+  rclcpp::executor_introspection::HistogramSnapshot snapshot;
+  snapshot.count = 0;
+  snapshot.sum_ns = 0;
+  snapshot.max_ns = 0;
+  snapshot.buckets.fill(0);
+  std::lock_guard<std::mutex> lock(registry_mutex());
+  for (const auto & recorder : registry()) {
+    select(*recorder).accumulate_into(snapshot);
+  }
+  return snapshot;
+}
+
+}  // namespace
+
+namespace rclcpp
+{
+namespace executor_introspection
+{
+
+std::chrono::nanoseconds
+HistogramSnapshot::quantile(double q) const
+{
+  if (count == 0) {
+    return std::chrono::nanoseconds::zero();
+  }
+  q = std::min(std::max(q, 0.0), 1.0);
+  const uint64_t target = static_cast<uint64_t>(std::ceil(q * static_cast<double>(count)));
+  uint64_t cumulative = 0;
+  for (size_t i = 0; i < kHistogramBuckets; i++) {
+    cumulative += buckets[i];
+    if (cumulative >= target) {
+      return std::chrono::nanoseconds(static_cast<int64_t>(bucket_lower_bound(i)));
+    }
+  }
+  return std::chrono::nanoseconds(static_cast<int64_t>(max_ns));
+}
+
+void
+enable()
+{
+  g_enabled.store(true, std::memory_order_relaxed);
+}
+
+void
+disable()
+{
+  g_enabled.store(false, std::memory_order_relaxed);
+}
+
+bool
+enabled()
+{
+  return g_enabled.load(std::memory_order_relaxed);
+}
+
+HistogramSnapshot
+get_wakeup_to_dispatch_histogram()
+{
+  return make_snapshot(
+    [](ThreadRecorder & recorder) -> Histogram & {return recorder.wakeup_to_dispatch;});
+}
+
+HistogramSnapshot
+get_dispatch_duration_histogram()
+{
+  return make_snapshot(
+    [](ThreadRecorder & recorder) -> Histogram & {return recorder.dispatch_duration;});
+}
+
+void
+reset()
+{
+  std::lock_guard<std::mutex> lock(registry_mutex());
+  for (const auto & recorder : registry()) {
+    recorder->wakeup_to_dispatch.reset();
+    recorder->dispatch_duration.reset();
+  }
+}
+
+size_t
+bucket_index(uint64_t value_ns)
+{
+  if (value_ns < kSubBuckets) {
+    // Exact buckets for the smallest values.
+    return static_cast<size_t>(value_ns);
+  }
+  // Position of the most significant set bit.
+  size_t msb = 63;
+  while ((value_ns & (uint64_t(1) << msb)) == 0) {
+    msb--;
+  }
+  const size_t group = msb - kSubBucketBits;
+  const size_t sub = static_cast<size_t>((value_ns >> group) & (kSubBuckets - 1));
+  return (group + 1) * kSubBuckets + sub;
+}
+
+uint64_t
+bucket_lower_bound(size_t index)
+{
+  if (index < kSubBuckets) {
+    return index;
+  }
+  const size_t group = index / kSubBuckets - 1;
+  const uint64_t sub = index % kSubBuckets;
+  return (kSubBuckets + sub) << group;
+}
+
+void
+mark_wakeup()
+{
+  ThreadRecorder & recorder = local_recorder();
+  recorder.last_wakeup = std::chrono::steady_clock::now();
+  recorder.has_wakeup = true;
+}
+
+void
+record_dispatch(
+  std::chrono::steady_clock::time_point dispatch_start,
+  std::chrono::steady_clock::time_point dispatch_end)
+{
+  ThreadRecorder & recorder = local_recorder();
+  if (recorder.has_wakeup && dispatch_start >= recorder.last_wakeup) {
+    recorder.wakeup_to_dispatch.record(
+      static_cast<uint64_t>((dispatch_start - recorder.last_wakeup).count()));
+  }
+  if (dispatch_end >= dispatch_start) {
+    recorder.dispatch_duration.record(
+      static_cast<uint64_t>((dispatch_end - dispatch_start).count()));
+  }
+}
+
+}  // namespace executor_introspection
+}  // namespace rclcpp
@@ -0,0 +1,246 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/executor_schedule.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <istream>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace rclcpp
+{
+namespace executor_schedule
+{
+namespace
+{
+
+constexpr uint32_t kScheduleMagic = 0x52435353;  // "RCSS"
+constexpr uint32_t kScheduleVersion = 1;
+
+/// Recording state: a bounded ring overwriting its oldest records.
+struct ScheduleRing
+{
+  std::vector<DispatchRecord> records;
+  size_t capacity {0};
+  /// Next slot to write; wraps around capacity once the ring is full.
+  size_t next {0};
+  /// Whether the ring has wrapped, i.e. `next` points at the oldest record.
+  bool wrapped {false};
+};
+
+std::atomic<bool> g_recording {false};
+
+std::mutex &
+get_ring_mutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+ScheduleRing &
+get_ring()
+{
+  static ScheduleRing ring;
+  return ring;
+}
+
+/// When the calling executor thread last woke up with ready work.
+thread_local int64_t t_last_wakeup_ns = 0;
+
+int64_t
+steady_now_ns()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+}  // namespace
+
+void
+start_recording(size_t capacity)
+{
+  if (0u == capacity) {
+    throw std::invalid_argument("capacity must be positive");
+  }
+  std::lock_guard<std::mutex> lock(get_ring_mutex());
+  ScheduleRing & ring = get_ring();
+  ring.records.clear();
+  ring.records.resize(capacity);
+  ring.capacity = capacity;
+  ring.next = 0;
+  ring.wrapped = false;
+  g_recording.store(true, std::memory_order_release);
+}
+
+void
+stop_recording()
+{
+  g_recording.store(false, std::memory_order_release);
+}
+
+bool
+recording()
+{
+  return g_recording.load(std::memory_order_acquire);
+}
+
+std::vector<DispatchRecord>
+drain()
+{
+  std::lock_guard<std::mutex> lock(get_ring_mutex());
+  ScheduleRing & ring = get_ring();
+  std::vector<DispatchRecord> result;
+  if (ring.wrapped) {
+    result.reserve(ring.capacity);
+    result.insert(
+      result.end(), ring.records.begin() + ring.next, ring.records.end());
+    result.insert(
+      result.end(), ring.records.begin(), ring.records.begin() + ring.next);
+  } else {
+    result.insert(
+      result.end(), ring.records.begin(), ring.records.begin() + ring.next);
+  }
+  ring.next = 0;
+  ring.wrapped = false;
+  return result;
+}
+
+void
+mark_wakeup()
+{
+  t_last_wakeup_ns = steady_now_ns();
+}
+
+void
+record_dispatch(
+  uint64_t entity_id,
+  ExecutableKind kind,
+  int64_t start_time_ns,
+  int64_t end_time_ns)
+{
+  std::lock_guard<std::mutex> lock(get_ring_mutex());
+  ScheduleRing & ring = get_ring();
+  if (0u == ring.capacity) {
+    return;  // stopped and drained concurrently
+  }
+  DispatchRecord & record = ring.records[ring.next];
+  record.entity_id = entity_id;
+  record.kind = kind;
+  record.ready_time_ns = t_last_wakeup_ns;
+  record.start_time_ns = start_time_ns;
+  record.end_time_ns = end_time_ns;
+  if (++ring.next == ring.capacity) {
+    ring.next = 0;
+    ring.wrapped = true;
+  }
+}
+
+void
+write_schedule(std::ostream & out, const std::vector<DispatchRecord> & records)
+{
+  const uint32_t magic = kScheduleMagic;
+  const uint32_t version = kScheduleVersion;
+  const uint64_t count = records.size();
+  out.write(reinterpret_cast<const char *>(&magic), sizeof(magic));
+  out.write(reinterpret_cast<const char *>(&version), sizeof(version));
+  out.write(reinterpret_cast<const char *>(&count), sizeof(count));
+  for (const DispatchRecord & record : records) {
+    out.write(reinterpret_cast<const char *>(&record), sizeof(record));
+  }
+}
+
+std::vector<DispatchRecord>
+read_schedule(std::istream & in)
+{
+  uint32_t magic = 0;
+  uint32_t version = 0;
+  uint64_t count = 0;
+  in.read(reinterpret_cast<char *>(&magic), sizeof(magic));
+  in.read(reinterpret_cast<char *>(&version), sizeof(version));
+  in.read(reinterpret_cast<char *>(&count), sizeof(count));
+  if (!in || kScheduleMagic != magic) {
+    throw std::runtime_error("stream does not hold an executor schedule");
+  }
+  if (kScheduleVersion != version) {
+    throw std::runtime_error("unsupported executor schedule version");
+  }
+  std::vector<DispatchRecord> records(count);
+  for (DispatchRecord & record : records) {
+    in.read(reinterpret_cast<char *>(&record), sizeof(record));
+  }
+  if (!in) {
+    throw std::runtime_error("truncated executor schedule");
+  }
+  return records;
+}
+
+ScheduleReplayer::ScheduleReplayer(std::vector<DispatchRecord> records)
+: records_(std::move(records))
+{}
+
+void
+ScheduleReplayer::set_stub(
+  uint64_t entity_id, std::function<void(const DispatchRecord &)> stub)
+{
+  stubs_[entity_id] = std::move(stub);
+}
+
+void
+ScheduleReplayer::set_fallback_stub(std::function<void(const DispatchRecord &)> stub)
+{
+  fallback_stub_ = std::move(stub);
+}
+
+size_t
+ScheduleReplayer::replay(bool pace) const
+{
+  size_t invoked = 0;
+  const auto replay_start = std::chrono::steady_clock::now();
+  const int64_t recorded_start =
+    records_.empty() ? 0 : records_.front().start_time_ns;
+  for (const DispatchRecord & record : records_) {
+    if (pace) {
+      // Reproduce the recorded gap between dispatch start times; a stub
+      // running longer than its original simply starts the next one late,
+      // like a slow callback would have in the original run.
+      const auto due = replay_start +
+        std::chrono::nanoseconds(record.start_time_ns - recorded_start);
+      std::this_thread::sleep_until(due);
+    }
+    auto it = stubs_.find(record.entity_id);
+    if (it != stubs_.end()) {
+      it->second(record);
+      ++invoked;
+    } else if (fallback_stub_) {
+      fallback_stub_(record);
+      ++invoked;
+    }
+  }
+  return invoked;
+}
+
+const std::vector<DispatchRecord> &
+ScheduleReplayer::get_records() const
+{
+  return records_;
+}
+
+}  // namespace executor_schedule
+}  // namespace rclcpp
@@ -0,0 +1,95 @@
+// Copyright 2024 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/executors/edf_executor.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+#include <vector>
+
+#include "rcpputils/scope_exit.hpp"
+
+#include "rclcpp/utilities.hpp"
+
+using rclcpp::executors::EdfExecutor;
+
+EdfExecutor::EdfExecutor(const rclcpp::ExecutorOptions & options)
+: rclcpp::Executor(options)
+{}
+
+EdfExecutor::~EdfExecutor() {}
+
+void
+EdfExecutor::collect_ready(std::vector<ScheduledExecutable> & ready)
+{
+  auto now = std::chrono::steady_clock::now();
+
+  rclcpp::AnyExecutable any_exec;
+  while (get_next_ready_executable(any_exec)) {
+    ScheduledExecutable scheduled;
+    scheduled.deadline = std::chrono::steady_clock::time_point::max();
+    scheduled.priority = 0;
+    if (any_exec.callback_group) {
+      auto relative_deadline = any_exec.callback_group->scheduling_deadline();
+      if (relative_deadline > std::chrono::nanoseconds::zero()) {
+        scheduled.deadline = now + relative_deadline;
+      }
+      scheduled.priority = any_exec.callback_group->scheduling_priority();
+    }
+    // Hand the references off by move; the emptied record is refilled by the
+    // next get_next_ready_executable() call.
+    scheduled.any_exec = std::move(any_exec);
+    ready.push_back(std::move(scheduled));
+  }
+
+  // Earliest deadline first; groups without a deadline sort last and are
+  // ordered among themselves by descending priority.
+  std::stable_sort(
+    ready.begin(), ready.end(),
+    [](const ScheduledExecutable & a, const ScheduledExecutable & b) {
+      if (a.deadline != b.deadline) {
+        return a.deadline < b.deadline;
+      }
+      return a.priority > b.priority;
+    });
+}
+
+void
+EdfExecutor::spin()
+{
+  if (spinning.exchange(true)) {
+    throw std::runtime_error("spin() called while already spinning");
+  }
+  RCPPUTILS_SCOPE_EXIT(this->spinning.store(false); );
+  while (rclcpp::ok(this->context_) && spinning.load()) {
+    wait_for_work(std::chrono::nanoseconds(-1));
+    if (!rclcpp::ok(this->context_) || !spinning.load()) {
+      break;
+    }
+
+    ready_.clear();
+    collect_ready(ready_);
+
+    for (auto & scheduled : ready_) {
+      if (!rclcpp::ok(this->context_) || !spinning.load()) {
+        break;
+      }
+      execute_any_executable(scheduled.any_exec);
+    }
+    // Release callback groups (and their `can_be_taken_from` flags) before the
+    // next wait, see the note in MultiThreadedExecutor::run.
+    ready_.clear();
+  }
+}
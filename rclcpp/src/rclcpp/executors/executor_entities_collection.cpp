@@ -12,6 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <utility>
+#include <vector>
+
 #include "rclcpp/executors/executor_entities_collection.hpp"
 
 namespace rclcpp
@@ -55,6 +58,10 @@ build_entities_collection(
     if (group_ptr->can_be_taken_from().load()) {
       group_ptr->collect_all_ptrs(
         [&collection, weak_group_ptr](const rclcpp::SubscriptionBase::SharedPtr & subscription) {
+          if (subscription->is_busy_polled()) {
+            // Delivered by a dedicated busy-poll thread, never by an executor.
+            return;
+          }
           collection.subscriptions.insert(
             {
               subscription->get_subscription_handle().get(),
@@ -94,6 +101,140 @@ build_entities_collection(
   }
 }
 
+namespace
+{
+
+/// Collect the entities of a single callback group into a collection.
+void
+collect_group_entities(
+  const rclcpp::CallbackGroup::SharedPtr & group_ptr,
+  const rclcpp::CallbackGroup::WeakPtr & weak_group_ptr,
+  ExecutorEntitiesCollection & collection)
+{
+  group_ptr->collect_all_ptrs(
+    [&collection, weak_group_ptr](const rclcpp::SubscriptionBase::SharedPtr & subscription) {
+      if (subscription->is_busy_polled()) {
+        // Delivered by a dedicated busy-poll thread, never by an executor.
+        return;
+      }
+      collection.subscriptions.insert(
+        {
+          subscription->get_subscription_handle().get(),
+          {subscription, weak_group_ptr}
+        });
+    },
+    [&collection, weak_group_ptr](const rclcpp::ServiceBase::SharedPtr & service) {
+      collection.services.insert(
+        {
+          service->get_service_handle().get(),
+          {service, weak_group_ptr}
+        });
+    },
+    [&collection, weak_group_ptr](const rclcpp::ClientBase::SharedPtr & client) {
+      collection.clients.insert(
+        {
+          client->get_client_handle().get(),
+          {client, weak_group_ptr}
+        });
+    },
+    [&collection, weak_group_ptr](const rclcpp::TimerBase::SharedPtr & timer) {
+      collection.timers.insert(
+        {
+          timer->get_timer_handle().get(),
+          {timer, weak_group_ptr}
+        });
+    },
+    [&collection, weak_group_ptr](const rclcpp::Waitable::SharedPtr & waitable) {
+      collection.waitables.insert(
+        {
+          waitable.get(),
+          {waitable, weak_group_ptr}
+        });
+    }
+  );
+}
+
+/// Check whether any entity captured in a snapshot has since been destroyed.
+bool
+has_expired_entities(const ExecutorEntitiesCollection & entities)
+{
+  for (const auto & entry : entities.subscriptions) {
+    if (entry.second.entity.expired()) {return true;}
+  }
+  for (const auto & entry : entities.timers) {
+    if (entry.second.entity.expired()) {return true;}
+  }
+  for (const auto & entry : entities.clients) {
+    if (entry.second.entity.expired()) {return true;}
+  }
+  for (const auto & entry : entities.services) {
+    if (entry.second.entity.expired()) {return true;}
+  }
+  for (const auto & entry : entities.waitables) {
+    if (entry.second.entity.expired()) {return true;}
+  }
+  return false;
+}
+
+/// Merge the contents of one collection into another.
+void
+merge_into(const ExecutorEntitiesCollection & from, ExecutorEntitiesCollection & into)
+{
+  into.subscriptions.insert(from.subscriptions.begin(), from.subscriptions.end());
+  into.timers.insert(from.timers.begin(), from.timers.end());
+  into.clients.insert(from.clients.begin(), from.clients.end());
+  into.services.insert(from.services.begin(), from.services.end());
+  into.guard_conditions.insert(from.guard_conditions.begin(), from.guard_conditions.end());
+  into.waitables.insert(from.waitables.begin(), from.waitables.end());
+}
+
+}  // namespace
+
+void
+build_entities_collection(
+  const std::vector<rclcpp::CallbackGroup::WeakPtr> & callback_groups,
+  ExecutorEntitiesCollection & collection,
+  GroupEntitiesCache & cache)
+{
+  collection.clear();
+
+  // Rebuilding the cache from the visited groups prunes entries belonging to
+  // groups that have been removed from the executor or destroyed.
+  GroupEntitiesCache updated_cache;
+
+  for (auto weak_group_ptr : callback_groups) {
+    auto group_ptr = weak_group_ptr.lock();
+    if (!group_ptr) {
+      continue;
+    }
+    if (!group_ptr->can_be_taken_from().load()) {
+      continue;
+    }
+
+    // Read the version before collecting so that a concurrent entity addition
+    // at worst invalidates a snapshot that is already current.
+    size_t version = group_ptr->entities_version();
+
+    auto cache_it = cache.find(weak_group_ptr);
+    if (cache_it != cache.end() &&
+      cache_it->second.entities_version == version &&
+      !has_expired_entities(cache_it->second.entities))
+    {
+      merge_into(cache_it->second.entities, collection);
+      updated_cache.insert(*cache_it);
+      continue;
+    }
+
+    GroupEntitiesCacheEntry new_entry;
+    new_entry.entities_version = version;
+    collect_group_entities(group_ptr, weak_group_ptr, new_entry.entities);
+    merge_into(new_entry.entities, collection);
+    updated_cache.insert({weak_group_ptr, std::move(new_entry)});
+  }
+
+  cache.swap(updated_cache);
+}
+
 size_t
 ready_executables(
   const ExecutorEntitiesCollection & collection,
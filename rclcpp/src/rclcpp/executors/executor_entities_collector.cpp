@@ -211,6 +211,12 @@ ExecutorEntitiesCollector::get_automatically_added_callback_groups() const
   return groups;
 }
 
+uint64_t
+ExecutorEntitiesCollector::get_generation() const
+{
+  return generation_.load();
+}
+
 void
 ExecutorEntitiesCollector::update_collections()
 {
@@ -237,6 +243,10 @@ ExecutorEntitiesCollector::remove_weak_node(NodeCollection::iterator weak_node)
     has_executor.store(false);
   }
 
+  // Drop the node's entry in the per-node group registry
+  weak_nodes_to_groups_.erase(*weak_node);
+  ++generation_;
+
   // Remove the node from tracked nodes
   return weak_nodes_.erase(weak_node);
 }
@@ -271,6 +281,8 @@ ExecutorEntitiesCollector::remove_weak_callback_group(
     has_executor.store(false);
   }
 
+  ++generation_;
+
   // Remove the node from tracked nodes
   return collection.erase(weak_group_it);
 }
@@ -289,6 +301,7 @@ ExecutorEntitiesCollector::add_callback_group_to_collection(
   auto group_guard_condition = group_ptr->get_notify_guard_condition();
   weak_groups_to_guard_conditions_.insert({group_ptr, group_guard_condition});
   this->notify_waitable_->add_guard_condition(group_guard_condition);
+  ++generation_;
 }
 
 void
@@ -300,6 +313,7 @@ ExecutorEntitiesCollector::process_queues()
       continue;
     }
     weak_nodes_.insert(weak_node_ptr);
+    ++generation_;
     this->add_automatically_associated_callback_groups({weak_node_ptr});
 
     // Store node guard condition in map and add it to the notify waitable
@@ -311,25 +325,25 @@ ExecutorEntitiesCollector::process_queues()
 
   for (auto weak_node_ptr : pending_removed_nodes_) {
     auto node_it = weak_nodes_.find(weak_node_ptr);
-    if (node_it != weak_nodes_.end()) {
-      remove_weak_node(node_it);
-    } else {
+    if (node_it == weak_nodes_.end()) {
       throw std::runtime_error("Node needs to be associated with this executor.");
     }
 
-    auto node_ptr = weak_node_ptr.lock();
-    if (node_ptr) {
-      for (auto group_it = automatically_added_groups_.begin();
-        group_it != automatically_added_groups_.end(); )
-      {
-        auto group_ptr = group_it->lock();
-        if (node_ptr->callback_group_in_node(group_ptr)) {
-          group_it = remove_weak_callback_group(group_it, automatically_added_groups_);
-        } else {
-          ++group_it;
+    // Remove the node's automatically added groups via its registry entry,
+    // in time proportional to the node's own groups rather than by testing
+    // every group tracked by the executor.  This also removes the groups of
+    // nodes that were destroyed before being removed.
+    auto groups_it = weak_nodes_to_groups_.find(weak_node_ptr);
+    if (groups_it != weak_nodes_to_groups_.end()) {
+      for (const auto & weak_group_ptr : groups_it->second) {
+        auto group_it = automatically_added_groups_.find(weak_group_ptr);
+        if (group_it != automatically_added_groups_.end()) {
+          remove_weak_callback_group(group_it, automatically_added_groups_);
         }
       }
     }
+
+    remove_weak_node(node_it);
   }
   pending_removed_nodes_.clear();
 
@@ -374,6 +388,8 @@ ExecutorEntitiesCollector::add_automatically_associated_callback_groups(
               throw std::runtime_error("Callback group has already been added to an executor.");
             }
             this->add_callback_group_to_collection(group_ptr, this->automatically_added_groups_);
+            // Record ownership so removing the node can splice its groups out
+            this->weak_nodes_to_groups_[node].insert(group_ptr);
           }
         });
     }
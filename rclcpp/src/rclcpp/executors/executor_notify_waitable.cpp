@@ -60,6 +60,10 @@ ExecutorNotifyWaitable::add_to_wait_set(rcl_wait_set_t * wait_set)
         rclcpp::exceptions::throw_from_rcl_error(
           ret, "failed to add guard condition to wait set");
       }
+
+      // The wait set now observes the guard condition again, deliver any
+      // trigger that deduplication suppressed while it was not waited on.
+      guard_condition->retrigger_if_pending();
     }
   }
 }
@@ -90,6 +94,9 @@ void
 ExecutorNotifyWaitable::execute(std::shared_ptr<void> & data)
 {
   (void) data;
+  // Clear before running the callback so changes arriving during the rebuild
+  // raise a new notification instead of being absorbed into this one.
+  this->notification_pending_.store(false);
   this->execute_callback_();
 }
 
@@ -113,7 +120,13 @@ ExecutorNotifyWaitable::set_on_ready_callback(std::function<void(size_t, int)> c
   // triggered the event.
   // We could indicate which of the guard conditions was triggered, but the executor
   // is already going to check that.
-  auto gc_callback = [callback](size_t count) {
+  // Bursts of triggers are coalesced: only the first one since the last
+  // execute is forwarded, the executor processes all accumulated changes in
+  // one rebuild anyway.
+  auto gc_callback = [this, callback](size_t count) {
+      if (this->notification_pending_.exchange(true)) {
+        return;
+      }
       callback(count, 0);
     };
 
@@ -136,6 +149,9 @@ ExecutorNotifyWaitable::clear_on_ready_callback()
   std::lock_guard<std::mutex> lock(guard_condition_mutex_);
 
   on_ready_callback_ = nullptr;
+  // Do not leave a stale pending flag behind: a callback registered later
+  // would otherwise never see its first trigger.
+  notification_pending_.store(false);
   for (auto weak_gc : notify_guard_conditions_) {
     auto gc = weak_gc.lock();
     if (!gc) {
@@ -17,6 +17,8 @@
 #include <chrono>
 #include <functional>
 #include <memory>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "rcpputils/scope_exit.hpp"
@@ -32,6 +34,8 @@ MultiThreadedExecutor::MultiThreadedExecutor(
   bool yield_before_execute,
   std::chrono::nanoseconds next_exec_timeout)
 : rclcpp::Executor(options),
+  thread_attributes_(options.thread_attributes),
+  spin_waiter_(options.wait_strategy),
   yield_before_execute_(yield_before_execute),
   next_exec_timeout_(next_exec_timeout)
 {
@@ -57,6 +61,7 @@ MultiThreadedExecutor::spin()
   }
   RCPPUTILS_SCOPE_EXIT(this->spinning.store(false); );
   std::vector<std::thread> threads;
+  std::vector<std::thread> pool_threads;
   size_t thread_id = 0;
   {
     std::lock_guard wait_lock{wait_mutex_};
@@ -65,11 +70,26 @@ MultiThreadedExecutor::spin()
       threads.emplace_back(func);
     }
   }
+  for (auto & name_and_pool : thread_pools_) {
+    ThreadPool & pool = *name_and_pool.second;
+    for (size_t i = 0; i < pool.number_of_threads; ++i) {
+      pool_threads.emplace_back(&MultiThreadedExecutor::run_pool, this, std::ref(pool));
+    }
+  }
 
   run(thread_id);
   for (auto & thread : threads) {
     thread.join();
   }
+  // The default threads are done feeding the pools; wake the pool workers so
+  // they can drain their queues and exit.
+  spinning.store(false);
+  for (auto & name_and_pool : thread_pools_) {
+    name_and_pool.second->cv.notify_all();
+  }
+  for (auto & thread : pool_threads) {
+    thread.join();
+  }
 }
 
 size_t
@@ -78,20 +98,128 @@ MultiThreadedExecutor::get_number_of_threads()
   return number_of_threads_;
 }
 
+void
+MultiThreadedExecutor::add_thread_pool(const std::string & name, size_t number_of_threads)
+{
+  if (spinning.load()) {
+    throw std::runtime_error("add_thread_pool() called while spinning");
+  }
+  if (name.empty()) {
+    throw std::invalid_argument("thread pool name must not be empty");
+  }
+  if (0u == number_of_threads) {
+    throw std::invalid_argument("thread pool must have at least one thread");
+  }
+  auto pool = std::make_unique<ThreadPool>();
+  pool->number_of_threads = number_of_threads;
+  if (!thread_pools_.emplace(name, std::move(pool)).second) {
+    throw std::invalid_argument("thread pool '" + name + "' already added");
+  }
+}
+
+bool
+MultiThreadedExecutor::dispatch_to_thread_pool(rclcpp::AnyExecutable & any_exec)
+{
+  if (thread_pools_.empty() || !any_exec.callback_group) {
+    return false;
+  }
+  const std::string pool_name = any_exec.callback_group->thread_pool_name();
+  if (pool_name.empty()) {
+    return false;
+  }
+  auto it = thread_pools_.find(pool_name);
+  if (it == thread_pools_.end()) {
+    // No such pool on this executor, fall back to the default threads.
+    return false;
+  }
+  ThreadPool & pool = *it->second;
+  {
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    pool.queue.push_back(std::move(any_exec));
+  }
+  pool.cv.notify_one();
+  return true;
+}
+
+void
+MultiThreadedExecutor::run_pool(ThreadPool & pool)
+{
+  if (thread_attributes_) {
+    rclcpp::apply_attributes_to_current_thread(*thread_attributes_);
+  }
+  // One recycled record per pool thread, see run().
+  rclcpp::AnyExecutable any_exec;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(pool.mutex);
+      pool.cv.wait(
+        lock,
+        [this, &pool]() {
+          return !pool.queue.empty() || !spinning.load() || !rclcpp::ok(this->context_);
+        });
+      if (pool.queue.empty()) {
+        // Queues are drained before exiting so taken work from mutually
+        // exclusive groups is not abandoned with the group still locked.
+        return;
+      }
+      any_exec = std::move(pool.queue.front());
+      pool.queue.pop_front();
+    }
+    if (yield_before_execute_) {
+      std::this_thread::yield();
+    }
+
+    execute_any_executable(any_exec);
+
+    // Recycle the record: release the references without the destructor's
+    // callback group restore, which execute_any_executable already did.
+    any_exec.reset();
+  }
+}
+
 void
 MultiThreadedExecutor::run(size_t this_thread_number)
 {
   (void)this_thread_number;
+  if (thread_attributes_) {
+    rclcpp::apply_attributes_to_current_thread(*thread_attributes_);
+  }
+  // One recycled record per worker thread instead of a fresh one per
+  // dispatch; the shared_ptrs it holds are released explicitly below.
+  rclcpp::AnyExecutable any_exec;
   while (rclcpp::ok(this->context_) && spinning.load()) {
-    rclcpp::AnyExecutable any_exec;
     {
-      std::lock_guard wait_lock{wait_mutex_};
+      std::unique_lock<std::mutex> wait_lock{wait_mutex_, std::defer_lock};
+      // While another worker holds the lock (typically blocked in rcl_wait),
+      // spin on try_lock for the strategy's budget: picking up the release
+      // directly avoids the futex wakeup a blocking lock() pays.
+      const auto spin_budget = spin_waiter_.spin_budget();
+      if (spin_budget > std::chrono::nanoseconds(0)) {
+        const auto spin_start = std::chrono::steady_clock::now();
+        std::chrono::nanoseconds elapsed(0);
+        while (!wait_lock.try_lock()) {
+          rclcpp::AdaptiveSpinWaiter::pause(elapsed, spin_budget);
+          elapsed = std::chrono::steady_clock::now() - spin_start;
+          if (elapsed >= spin_budget || !spinning.load()) {
+            break;
+          }
+        }
+      }
+      if (!wait_lock.owns_lock()) {
+        wait_lock.lock();
+      }
       if (!rclcpp::ok(this->context_) || !spinning.load()) {
         return;
       }
       if (!get_next_executable(any_exec, next_exec_timeout_)) {
         continue;
       }
+      spin_waiter_.record_event();
+    }
+    if (dispatch_to_thread_pool(any_exec)) {
+      // Handed off to a dedicated pool by move, the record is already empty;
+      // go back to waiting for more work.
+      continue;
     }
     if (yield_before_execute_) {
       std::this_thread::yield();
@@ -99,8 +227,8 @@ MultiThreadedExecutor::run(size_t this_thread_number)
 
     execute_any_executable(any_exec);
 
-    // Clear the callback_group to prevent the AnyExecutable destructor from
-    // resetting the callback group `can_be_taken_from`
-    any_exec.callback_group.reset();
+    // Recycle the record: release the references without the destructor's
+    // callback group restore, which execute_any_executable already did.
+    any_exec.reset();
   }
 }
@@ -0,0 +1,201 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/executors/multiplexed_executor.hpp"
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "rcpputils/scope_exit.hpp"
+
+#include "rclcpp/utilities.hpp"
+
+using rclcpp::executors::MultiplexedExecutor;
+
+MultiplexedExecutor::MultiplexedExecutor(
+  const rclcpp::ExecutorOptions & options,
+  size_t number_of_threads,
+  std::chrono::nanoseconds next_exec_timeout)
+: rclcpp::Executor(options),
+  next_exec_timeout_(next_exec_timeout)
+{
+  number_of_threads_ = number_of_threads > 0 ?
+    number_of_threads :
+    std::max(std::thread::hardware_concurrency(), 2U);
+
+  // Index 0 is the default domain, for nodes added without an assignment.
+  domains_.push_back(std::make_unique<Domain>());
+}
+
+MultiplexedExecutor::~MultiplexedExecutor() {}
+
+void
+MultiplexedExecutor::spin()
+{
+  if (spinning.exchange(true)) {
+    throw std::runtime_error("spin() called while already spinning");
+  }
+  RCPPUTILS_SCOPE_EXIT(this->spinning.store(false); );
+  std::vector<std::thread> threads;
+  {
+    std::lock_guard wait_lock{wait_mutex_};
+    for (size_t i = 0; i < number_of_threads_ - 1; ++i) {
+      threads.emplace_back(&MultiplexedExecutor::run, this);
+    }
+  }
+  run();
+  for (auto & thread : threads) {
+    thread.join();
+  }
+}
+
+size_t
+MultiplexedExecutor::get_number_of_threads()
+{
+  return number_of_threads_;
+}
+
+void
+MultiplexedExecutor::add_node_to_domain(
+  rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_ptr,
+  const std::string & domain_name,
+  bool notify)
+{
+  if (domain_name.empty()) {
+    throw std::invalid_argument("domain_name must not be empty");
+  }
+  {
+    std::lock_guard<std::mutex> lock(domains_mutex_);
+    const size_t index = this->domain_index(domain_name);
+    node_domains_.emplace_back(node_ptr, index);
+    // Callback groups of this node may have been resolved to the default
+    // domain before the assignment; drop the cache so they resolve again.
+    group_domains_.clear();
+  }
+  this->add_node(node_ptr, notify);
+}
+
+void
+MultiplexedExecutor::add_node_to_domain(
+  std::shared_ptr<rclcpp::Node> node_ptr,
+  const std::string & domain_name,
+  bool notify)
+{
+  this->add_node_to_domain(node_ptr->get_node_base_interface(), domain_name, notify);
+}
+
+size_t
+MultiplexedExecutor::domain_index(const std::string & domain_name)
+{
+  auto it = domain_names_.find(domain_name);
+  if (it != domain_names_.end()) {
+    return it->second;
+  }
+  domains_.push_back(std::make_unique<Domain>());
+  const size_t index = domains_.size() - 1;
+  domain_names_.emplace(domain_name, index);
+  return index;
+}
+
+MultiplexedExecutor::Domain &
+MultiplexedExecutor::resolve_domain(const rclcpp::AnyExecutable & any_exec)
+{
+  std::lock_guard<std::mutex> lock(domains_mutex_);
+  const rclcpp::CallbackGroup * group = any_exec.callback_group.get();
+  if (nullptr != group) {
+    auto it = group_domains_.find(group);
+    if (it != group_domains_.end()) {
+      return *domains_[it->second];
+    }
+    // First executable of this group: find the assigned node owning it.
+    for (auto & node_and_index : node_domains_) {
+      auto node = node_and_index.first.lock();
+      if (!node) {
+        continue;
+      }
+      bool owned = false;
+      node->for_each_callback_group(
+        [group, &owned](rclcpp::CallbackGroup::SharedPtr node_group) {
+          if (node_group.get() == group) {
+            owned = true;
+          }
+        });
+      if (owned) {
+        group_domains_.emplace(group, node_and_index.second);
+        return *domains_[node_and_index.second];
+      }
+    }
+    // The group's node was never assigned: cache the default domain.
+    group_domains_.emplace(group, 0u);
+  }
+  return *domains_[0];
+}
+
+void
+MultiplexedExecutor::execute_in_domain(rclcpp::AnyExecutable & any_exec, Domain & domain)
+{
+  {
+    std::lock_guard<std::mutex> lock(domain.mutex);
+    if (domain.busy) {
+      // Another worker is executing for this domain: park the executable,
+      // that worker will run it before releasing the domain.
+      domain.queue.push_back(std::move(any_exec));
+      return;
+    }
+    domain.busy = true;
+  }
+
+  execute_any_executable(any_exec);
+  any_exec.reset();
+
+  // Drain the work parked on the domain while this thread owned it, keeping
+  // the single-threaded in-order semantics of the domain.
+  while (true) {
+    {
+      std::lock_guard<std::mutex> lock(domain.mutex);
+      if (domain.queue.empty()) {
+        domain.busy = false;
+        return;
+      }
+      any_exec = std::move(domain.queue.front());
+      domain.queue.pop_front();
+    }
+    execute_any_executable(any_exec);
+    any_exec.reset();
+  }
+}
+
+void
+MultiplexedExecutor::run()
+{
+  // One recycled record per worker thread, see AnyExecutable::reset().
+  rclcpp::AnyExecutable any_exec;
+  while (rclcpp::ok(this->context_) && spinning.load()) {
+    {
+      std::lock_guard wait_lock{wait_mutex_};
+      if (!rclcpp::ok(this->context_) || !spinning.load()) {
+        return;
+      }
+      if (!get_next_executable(any_exec, next_exec_timeout_)) {
+        continue;
+      }
+    }
+    Domain & domain = this->resolve_domain(any_exec);
+    this->execute_in_domain(any_exec, domain);
+  }
+}
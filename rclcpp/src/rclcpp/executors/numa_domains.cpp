@@ -0,0 +1,223 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/executors/numa_domains.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace rclcpp
+{
+namespace executors
+{
+
+namespace
+{
+
+/// Parse a sysfs cpulist string like "0-15,32-47" into cpu indices.
+std::vector<size_t>
+parse_cpulist(const std::string & cpulist)
+{
+  std::vector<size_t> cpus;
+  std::stringstream stream(cpulist);
+  std::string range;
+  while (std::getline(stream, range, ',')) {
+    const auto dash = range.find('-');
+    try {
+      if (dash == std::string::npos) {
+        cpus.push_back(std::stoul(range));
+      } else {
+        const size_t first = std::stoul(range.substr(0, dash));
+        const size_t last = std::stoul(range.substr(dash + 1));
+        for (size_t cpu = first; cpu <= last; cpu++) {
+          cpus.push_back(cpu);
+        }
+      }
+    } catch (const std::exception &) {
+      // Malformed entry, skip it; the caller falls back if nothing parsed.
+    }
+  }
+  return cpus;
+}
+
+/// A single domain spanning every hardware thread.
+std::vector<NumaDomain>
+single_domain_fallback()
+{
+  NumaDomain domain;
+  domain.id = 0;
+  const size_t cpu_count = std::max<size_t>(1, std::thread::hardware_concurrency());
+  for (size_t cpu = 0; cpu < cpu_count; cpu++) {
+    domain.cpu_set.push_back(cpu);
+  }
+  return {domain};
+}
+
+}  // namespace
+
+std::vector<NumaDomain>
+detect_numa_domains()
+{
+  std::vector<NumaDomain> domains;
+  // Probe node ids in order; sysfs node directories are contiguous in
+  // practice, but tolerate gaps (memory-less nodes can be offlined).
+  size_t misses = 0;
+  for (size_t node_id = 0; misses < 8; node_id++) {
+    std::ifstream cpulist_file(
+      "/sys/devices/system/node/node" + std::to_string(node_id) + "/cpulist");
+    if (!cpulist_file.is_open()) {
+      misses++;
+      continue;
+    }
+    misses = 0;
+    std::string cpulist;
+    std::getline(cpulist_file, cpulist);
+    auto cpus = parse_cpulist(cpulist);
+    if (cpus.empty()) {
+      // CPU-less (memory-only) node, not useful for executor placement.
+      continue;
+    }
+    NumaDomain domain;
+    domain.id = node_id;
+    domain.cpu_set = std::move(cpus);
+    domains.push_back(std::move(domain));
+  }
+  if (domains.empty()) {
+    return single_domain_fallback();
+  }
+  return domains;
+}
+
+rclcpp::ThreadAttributes
+thread_attributes_for_numa_domain(const NumaDomain & domain)
+{
+  rclcpp::ThreadAttributes attributes;
+  attributes.cpu_set = domain.cpu_set;
+  attributes.name = "numa" + std::to_string(domain.id);
+  return attributes;
+}
+
+NumaExecutorSet::NumaExecutorSet(
+  const rclcpp::ExecutorOptions & options,
+  std::vector<NumaDomain> domains)
+: domains_(domains.empty() ? detect_numa_domains() : std::move(domains))
+{
+  domain_executors_.reserve(domains_.size());
+  nodes_per_domain_.assign(domains_.size(), 0);
+  for (const auto & domain : domains_) {
+    rclcpp::ExecutorOptions domain_options = options;
+    domain_options.thread_attributes = thread_attributes_for_numa_domain(domain);
+    // Size each pool to its domain's core count rather than the machine's,
+    // so pinned workers do not oversubscribe their domain.
+    domain_executors_.push_back(
+      std::make_unique<MultiThreadedExecutor>(domain_options, domain.cpu_set.size()));
+  }
+}
+
+NumaExecutorSet::~NumaExecutorSet()
+{
+  if (spinning_.load()) {
+    this->cancel();
+  }
+}
+
+size_t
+NumaExecutorSet::add_node(rclcpp::Node::SharedPtr node_ptr)
+{
+  size_t domain_index = std::numeric_limits<size_t>::max();
+  const size_t hint = node_ptr->get_node_options().numa_domain();
+  for (size_t i = 0; i < domains_.size(); i++) {
+    if (domains_[i].id == hint) {
+      domain_index = i;
+      break;
+    }
+  }
+  if (domain_index == std::numeric_limits<size_t>::max()) {
+    // No (valid) hint: pick the domain with the fewest nodes so far.
+    domain_index = static_cast<size_t>(
+      std::min_element(nodes_per_domain_.begin(), nodes_per_domain_.end()) -
+      nodes_per_domain_.begin());
+  }
+  domain_executors_[domain_index]->add_node(node_ptr);
+  nodes_per_domain_[domain_index]++;
+  return domain_index;
+}
+
+void
+NumaExecutorSet::add_callback_group(
+  rclcpp::CallbackGroup::SharedPtr group_ptr,
+  rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_ptr,
+  size_t domain_index)
+{
+  if (domain_index >= domain_executors_.size()) {
+    throw std::out_of_range(
+            "domain_index " + std::to_string(domain_index) + " out of range, have " +
+            std::to_string(domain_executors_.size()) + " domains");
+  }
+  domain_executors_[domain_index]->add_callback_group(group_ptr, node_ptr);
+}
+
+void
+NumaExecutorSet::spin()
+{
+  bool expected = false;
+  if (!spinning_.compare_exchange_strong(expected, true)) {
+    throw std::runtime_error("spin() called while already spinning");
+  }
+  std::vector<std::thread> spinners;
+  spinners.reserve(domain_executors_.size());
+  for (auto & executor : domain_executors_) {
+    spinners.emplace_back([&executor]() {executor->spin();});
+  }
+  for (auto & spinner : spinners) {
+    spinner.join();
+  }
+  spinning_.store(false);
+}
+
+void
+NumaExecutorSet::cancel()
+{
+  for (auto & executor : domain_executors_) {
+    executor->cancel();
+  }
+}
+
+const std::vector<NumaDomain> &
+NumaExecutorSet::domains() const
+{
+  return domains_;
+}
+
+rclcpp::executors::MultiThreadedExecutor &
+NumaExecutorSet::get_executor(size_t domain_index)
+{
+  if (domain_index >= domain_executors_.size()) {
+    throw std::out_of_range(
+            "domain_index " + std::to_string(domain_index) + " out of range, have " +
+            std::to_string(domain_executors_.size()) + " domains");
+  }
+  return *domain_executors_[domain_index];
+}
+
+}  // namespace executors
+}  // namespace rclcpp
@@ -0,0 +1,320 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/executors/sealed_executor.hpp"
+
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "rcpputils/scope_exit.hpp"
+
+using rclcpp::executors::SealedExecutor;
+
+SealedExecutor::SealedExecutor(
+  const rclcpp::ExecutorOptions & options)
+: StaticSingleThreadedExecutor(options)
+{}
+
+SealedExecutor::~SealedExecutor() {}
+
+void
+SealedExecutor::seal()
+{
+  if (sealed_) {
+    throw std::runtime_error("seal() called on an already sealed executor");
+  }
+
+  // Collect the entities of everything added so far and size the wait set.
+  if (!entities_collector_->is_init()) {
+    entities_collector_->init(&wait_set_, memory_strategy_);
+  }
+
+  const size_t number_of_subscriptions = entities_collector_->get_number_of_subscriptions();
+  const size_t number_of_timers = entities_collector_->get_number_of_timers();
+  const size_t number_of_services = entities_collector_->get_number_of_services();
+  const size_t number_of_clients = entities_collector_->get_number_of_clients();
+  const size_t number_of_waitables = entities_collector_->get_number_of_waitables();
+
+  // Freeze the entities into flat storage first, so the dispatch entries can
+  // point at stable addresses.
+  subscriptions_.reserve(number_of_subscriptions);
+  for (size_t i = 0; i < number_of_subscriptions; ++i) {
+    subscriptions_.push_back(entities_collector_->get_subscription(i));
+  }
+  timers_.reserve(number_of_timers);
+  for (size_t i = 0; i < number_of_timers; ++i) {
+    timers_.push_back(entities_collector_->get_timer(i));
+  }
+  services_.reserve(number_of_services);
+  for (size_t i = 0; i < number_of_services; ++i) {
+    services_.push_back(entities_collector_->get_service(i));
+  }
+  clients_.reserve(number_of_clients);
+  for (size_t i = 0; i < number_of_clients; ++i) {
+    clients_.push_back(entities_collector_->get_client(i));
+  }
+  waitables_.reserve(number_of_waitables);
+  for (size_t i = 0; i < number_of_waitables; ++i) {
+    auto waitable = entities_collector_->get_waitable(i);
+    // The collector re-collects entities when a node changes; a sealed
+    // configuration cannot change, so don't dispatch it.
+    if (waitable == entities_collector_) {
+      continue;
+    }
+    waitables_.push_back(std::move(waitable));
+  }
+
+  dispatch_table_.reserve(
+    subscriptions_.size() + timers_.size() + services_.size() +
+    clients_.size() + waitables_.size());
+  for (size_t i = 0; i < subscriptions_.size(); ++i) {
+    dispatch_table_.push_back({&SealedExecutor::dispatch_subscription, &subscriptions_[i], i});
+  }
+  for (size_t i = 0; i < timers_.size(); ++i) {
+    dispatch_table_.push_back({&SealedExecutor::dispatch_timer, &timers_[i], i});
+  }
+  for (size_t i = 0; i < services_.size(); ++i) {
+    dispatch_table_.push_back({&SealedExecutor::dispatch_service, &services_[i], i});
+  }
+  for (size_t i = 0; i < clients_.size(); ++i) {
+    dispatch_table_.push_back({&SealedExecutor::dispatch_client, &clients_[i], i});
+  }
+  for (size_t i = 0; i < waitables_.size(); ++i) {
+    // Waitables check their own readiness against the wait set.
+    dispatch_table_.push_back({&SealedExecutor::dispatch_waitable, &waitables_[i], 0u});
+  }
+
+  sealed_ = true;
+}
+
+bool
+SealedExecutor::is_sealed() const
+{
+  return sealed_;
+}
+
+void
+SealedExecutor::spin()
+{
+  throw_if_not_sealed();
+  if (spinning.exchange(true)) {
+    throw std::runtime_error("spin() called while already spinning");
+  }
+  RCPPUTILS_SCOPE_EXIT(this->spinning.store(false); );
+
+  while (rclcpp::ok(this->context_) && spinning.load()) {
+    // Re-arm the preallocated wait set and wait for work.
+    entities_collector_->refresh_wait_set();
+    run_dispatch_table(false);
+  }
+}
+
+void
+SealedExecutor::spin_some(std::chrono::nanoseconds max_duration)
+{
+  // In this context a 0 input max_duration means no duration limit
+  if (std::chrono::nanoseconds(0) == max_duration) {
+    max_duration = std::chrono::nanoseconds::max();
+  }
+
+  return this->spin_some_impl(max_duration, false);
+}
+
+void
+SealedExecutor::spin_all(std::chrono::nanoseconds max_duration)
+{
+  if (max_duration < std::chrono::nanoseconds(0)) {
+    throw std::invalid_argument("max_duration must be greater than or equal to 0");
+  }
+  return this->spin_some_impl(max_duration, true);
+}
+
+void
+SealedExecutor::spin_some_impl(std::chrono::nanoseconds max_duration, bool exhaustive)
+{
+  throw_if_not_sealed();
+
+  auto start = std::chrono::steady_clock::now();
+  auto max_duration_not_elapsed = [max_duration, start]() {
+      if (std::chrono::nanoseconds(0) == max_duration) {
+        // told to spin forever if need be
+        return true;
+      } else if (std::chrono::steady_clock::now() - start < max_duration) {
+        // told to spin only for some maximum amount of time
+        return true;
+      }
+      // spun too long
+      return false;
+    };
+
+  if (spinning.exchange(true)) {
+    throw std::runtime_error("spin_some() called while already spinning");
+  }
+  RCPPUTILS_SCOPE_EXIT(this->spinning.store(false); );
+
+  while (rclcpp::ok(context_) && spinning.load() && max_duration_not_elapsed()) {
+    // Get executables that are ready now
+    entities_collector_->refresh_wait_set(std::chrono::milliseconds::zero());
+    // Execute ready executables
+    bool work_available = run_dispatch_table(false);
+    if (!work_available || !exhaustive) {
+      break;
+    }
+  }
+}
+
+void
+SealedExecutor::spin_once_impl(std::chrono::nanoseconds timeout)
+{
+  throw_if_not_sealed();
+
+  if (rclcpp::ok(context_) && spinning.load()) {
+    // Wait until we have a ready entity or timeout expired
+    entities_collector_->refresh_wait_set(timeout);
+    run_dispatch_table(true);
+  }
+}
+
+void
+SealedExecutor::add_callback_group(
+  rclcpp::CallbackGroup::SharedPtr group_ptr,
+  rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_ptr,
+  bool notify)
+{
+  throw_if_sealed();
+  StaticSingleThreadedExecutor::add_callback_group(group_ptr, node_ptr, notify);
+}
+
+void
+SealedExecutor::remove_callback_group(
+  rclcpp::CallbackGroup::SharedPtr group_ptr, bool notify)
+{
+  throw_if_sealed();
+  StaticSingleThreadedExecutor::remove_callback_group(group_ptr, notify);
+}
+
+void
+SealedExecutor::add_node(
+  rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_ptr, bool notify)
+{
+  throw_if_sealed();
+  StaticSingleThreadedExecutor::add_node(node_ptr, notify);
+}
+
+void
+SealedExecutor::remove_node(
+  rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_ptr, bool notify)
+{
+  throw_if_sealed();
+  StaticSingleThreadedExecutor::remove_node(node_ptr, notify);
+}
+
+bool
+SealedExecutor::run_dispatch_table(bool spin_once)
+{
+  bool any_ready_executable = false;
+
+  for (const auto & entry : dispatch_table_) {
+    if (entry.dispatch(*this, entry)) {
+      if (spin_once) {
+        return true;
+      }
+      any_ready_executable = true;
+    }
+  }
+  return any_ready_executable;
+}
+
+void
+SealedExecutor::throw_if_sealed() const
+{
+  if (sealed_) {
+    throw std::runtime_error("cannot modify the entities of a sealed executor");
+  }
+}
+
+void
+SealedExecutor::throw_if_not_sealed() const
+{
+  if (!sealed_) {
+    throw std::runtime_error("the executor must be sealed with seal() before spinning");
+  }
+}
+
+bool
+SealedExecutor::dispatch_subscription(SealedExecutor & self, const DispatchEntry & entry)
+{
+  if (entry.index >= self.wait_set_.size_of_subscriptions ||
+    nullptr == self.wait_set_.subscriptions[entry.index])
+  {
+    return false;
+  }
+  execute_subscription(*static_cast<const rclcpp::SubscriptionBase::SharedPtr *>(entry.entity));
+  return true;
+}
+
+bool
+SealedExecutor::dispatch_timer(SealedExecutor & self, const DispatchEntry & entry)
+{
+  if (entry.index >= self.wait_set_.size_of_timers ||
+    nullptr == self.wait_set_.timers[entry.index])
+  {
+    return false;
+  }
+  const auto & timer = *static_cast<const rclcpp::TimerBase::SharedPtr *>(entry.entity);
+  if (!timer->is_ready()) {
+    return false;
+  }
+  timer->call();
+  execute_timer(timer);
+  return true;
+}
+
+bool
+SealedExecutor::dispatch_service(SealedExecutor & self, const DispatchEntry & entry)
+{
+  if (entry.index >= self.wait_set_.size_of_services ||
+    nullptr == self.wait_set_.services[entry.index])
+  {
+    return false;
+  }
+  execute_service(*static_cast<const rclcpp::ServiceBase::SharedPtr *>(entry.entity));
+  return true;
+}
+
+bool
+SealedExecutor::dispatch_client(SealedExecutor & self, const DispatchEntry & entry)
+{
+  if (entry.index >= self.wait_set_.size_of_clients ||
+    nullptr == self.wait_set_.clients[entry.index])
+  {
+    return false;
+  }
+  execute_client(*static_cast<const rclcpp::ClientBase::SharedPtr *>(entry.entity));
+  return true;
+}
+
+bool
+SealedExecutor::dispatch_waitable(SealedExecutor & self, const DispatchEntry & entry)
+{
+  const auto & waitable = *static_cast<const rclcpp::Waitable::SharedPtr *>(entry.entity);
+  if (!waitable->is_ready(&self.wait_set_)) {
+    return false;
+  }
+  auto data = waitable->take_data();
+  waitable->execute(data);
+  return true;
+}
@@ -31,10 +31,15 @@ SingleThreadedExecutor::spin()
     throw std::runtime_error("spin() called while already spinning");
   }
   RCPPUTILS_SCOPE_EXIT(this->spinning.store(false); );
+  // One recycled record for the whole spin instead of a fresh one per
+  // dispatch; the shared_ptrs it holds are released explicitly below.
+  rclcpp::AnyExecutable any_executable;
   while (rclcpp::ok(this->context_) && spinning.load()) {
-    rclcpp::AnyExecutable any_executable;
     if (get_next_executable(any_executable)) {
       execute_any_executable(any_executable);
+      // Recycle the record: release the references without the destructor's
+      // callback group restore, which execute_any_executable already did.
+      any_executable.reset();
     }
   }
 }
@@ -53,6 +53,9 @@ StaticSingleThreadedExecutor::spin()
   while (rclcpp::ok(this->context_) && spinning.load()) {
     // Refresh wait set and wait for work
     entities_collector_->refresh_wait_set();
+    // The wait consumed any pending interrupt trigger; this executor waits
+    // here instead of in wait_for_work, so reopen the coalescing window too.
+    interrupt_pending_.store(false);
     execute_ready_executables();
   }
 }
@@ -106,6 +109,7 @@ StaticSingleThreadedExecutor::spin_some_impl(std::chrono::nanoseconds max_durati
   while (rclcpp::ok(context_) && spinning.load() && max_duration_not_elapsed()) {
     // Get executables that are ready now
     entities_collector_->refresh_wait_set(std::chrono::milliseconds::zero());
+    interrupt_pending_.store(false);
     // Execute ready executables
     bool work_available = execute_ready_executables();
     if (!work_available || !exhaustive) {
@@ -125,6 +129,7 @@ StaticSingleThreadedExecutor::spin_once_impl(std::chrono::nanoseconds timeout)
   if (rclcpp::ok(context_) && spinning.load()) {
     // Wait until we have a ready entity or timeout expired
     entities_collector_->refresh_wait_set(timeout);
+    interrupt_pending_.store(false);
     // Execute ready executables
     execute_ready_executables(true);
   }
@@ -0,0 +1,192 @@
+// Copyright 2024 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/executors/work_stealing_executor.hpp"
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "rcpputils/scope_exit.hpp"
+
+#include "rclcpp/logging.hpp"
+#include "rclcpp/utilities.hpp"
+
+using rclcpp::executors::WorkStealingExecutor;
+
+WorkStealingExecutor::WorkStealingExecutor(
+  const rclcpp::ExecutorOptions & options,
+  size_t number_of_threads,
+  std::chrono::nanoseconds next_exec_timeout)
+: rclcpp::Executor(options),
+  thread_attributes_(options.thread_attributes),
+  next_exec_timeout_(next_exec_timeout)
+{
+  number_of_threads_ = number_of_threads > 0 ?
+    number_of_threads :
+    std::max(std::thread::hardware_concurrency(), 2U);
+
+  if (number_of_threads_ == 1) {
+    RCLCPP_WARN(
+      rclcpp::get_logger("rclcpp"),
+      "WorkStealingExecutor is used with a single thread.\n"
+      "Use the SingleThreadedExecutor instead.");
+  }
+
+  queues_.reserve(number_of_threads_);
+  for (size_t i = 0; i < number_of_threads_; ++i) {
+    queues_.push_back(std::make_unique<WorkQueue>());
+  }
+}
+
+WorkStealingExecutor::~WorkStealingExecutor() {}
+
+void
+WorkStealingExecutor::spin()
+{
+  if (spinning.exchange(true)) {
+    throw std::runtime_error("spin() called while already spinning");
+  }
+  RCPPUTILS_SCOPE_EXIT(this->spinning.store(false); );
+  std::vector<std::thread> threads;
+  size_t thread_id = 0;
+  for (; thread_id < number_of_threads_ - 1; ++thread_id) {
+    auto func = std::bind(&WorkStealingExecutor::run, this, thread_id);
+    threads.emplace_back(func);
+  }
+
+  run(thread_id);
+  idle_cv_.notify_all();
+  for (auto & thread : threads) {
+    thread.join();
+  }
+}
+
+size_t
+WorkStealingExecutor::get_number_of_threads()
+{
+  return number_of_threads_;
+}
+
+size_t
+WorkStealingExecutor::shard_for(const rclcpp::AnyExecutable & any_exec) const
+{
+  // Executables without a callback group (e.g. waitables added directly) can
+  // go anywhere; hash the group pointer so one group always lands on one
+  // queue and its mutual exclusion never forces cross-queue coordination.
+  const void * key = any_exec.callback_group.get();
+  return std::hash<const void *>()(key) % number_of_threads_;
+}
+
+bool
+WorkStealingExecutor::pop_local(size_t this_thread_number, rclcpp::AnyExecutable & any_exec)
+{
+  WorkQueue & queue = *queues_[this_thread_number];
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  if (queue.executables.empty()) {
+    return false;
+  }
+  any_exec = std::move(queue.executables.front());
+  queue.executables.pop_front();
+  return true;
+}
+
+bool
+WorkStealingExecutor::steal(size_t this_thread_number, rclcpp::AnyExecutable & any_exec)
+{
+  for (size_t offset = 1; offset < number_of_threads_; ++offset) {
+    size_t victim = (this_thread_number + offset) % number_of_threads_;
+    WorkQueue & queue = *queues_[victim];
+    std::unique_lock<std::mutex> lock(queue.mutex, std::try_to_lock);
+    if (!lock.owns_lock() || queue.executables.empty()) {
+      continue;
+    }
+    // Steal from the back to avoid interleaving with the victim's own pops.
+    // Executables from a currently-executing mutually exclusive group are not
+    // distributed (see collect()), so stealing cannot violate group exclusion.
+    any_exec = std::move(queue.executables.back());
+    queue.executables.pop_back();
+    return true;
+  }
+  return false;
+}
+
+size_t
+WorkStealingExecutor::collect(size_t this_thread_number)
+{
+  size_t collected = 0;
+  if (!rclcpp::ok(this->context_) || !spinning.load()) {
+    return collected;
+  }
+
+  wait_for_work(next_exec_timeout_);
+
+  // Drain everything that is ready and shard it across the worker queues.
+  rclcpp::AnyExecutable any_exec;
+  while (get_next_ready_executable(any_exec)) {
+    size_t shard = shard_for(any_exec);
+    // Keep one unit of work for ourselves to execute without re-queueing.
+    if (collected == 0) {
+      shard = this_thread_number;
+    }
+    {
+      WorkQueue & queue = *queues_[shard];
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      queue.executables.push_back(std::move(any_exec));
+    }
+    ++collected;
+  }
+
+  if (collected > 1) {
+    idle_cv_.notify_all();
+  }
+  return collected;
+}
+
+void
+WorkStealingExecutor::run(size_t this_thread_number)
+{
+  if (thread_attributes_) {
+    rclcpp::apply_attributes_to_current_thread(*thread_attributes_);
+  }
+  // One recycled record per worker thread instead of a fresh one per
+  // dispatch; the shared_ptrs it holds are released explicitly below.
+  rclcpp::AnyExecutable any_exec;
+  while (rclcpp::ok(this->context_) && spinning.load()) {
+    bool has_work = pop_local(this_thread_number, any_exec) ||
+      steal(this_thread_number, any_exec);
+
+    if (!has_work) {
+      // No queued work anywhere we could reach: try to become the collector.
+      std::unique_lock<std::mutex> collect_lock(collect_mutex_, std::try_to_lock);
+      if (collect_lock.owns_lock()) {
+        collect(this_thread_number);
+        continue;
+      }
+      // Another thread is already collecting; park until it distributes work.
+      std::unique_lock<std::mutex> idle_lock(idle_mutex_);
+      idle_cv_.wait_for(idle_lock, std::chrono::milliseconds(1));
+      continue;
+    }
+
+    execute_any_executable(any_exec);
+
+    // Recycle the record: release the references without the destructor's
+    // callback group restore, which execute_any_executable already did.
+    any_exec.reset();
+  }
+  idle_cv_.notify_all();
+}
@@ -14,12 +14,20 @@
 
 #include "rclcpp/experimental/executors/events_executor/events_executor.hpp"
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <chrono>
 #include <memory>
 #include <utility>
 #include <vector>
 
 #include "rcpputils/scope_exit.hpp"
 
+#include "rclcpp/executor_introspection.hpp"
+
 using namespace std::chrono_literals;
 
 using rclcpp::experimental::executors::EventsExecutor;
@@ -27,28 +35,38 @@ using rclcpp::experimental::executors::EventsExecutor;
 EventsExecutor::EventsExecutor(
   rclcpp::experimental::executors::EventsQueue::UniquePtr events_queue,
   bool execute_timers_separate_thread,
-  const rclcpp::ExecutorOptions & options)
-: rclcpp::Executor(options)
+  const rclcpp::ExecutorOptions & options,
+  rclcpp::experimental::TimersManager::TimersStorage timers_storage,
+  bool execute_timers_inline)
+: rclcpp::Executor(options),
+  inline_timers_(execute_timers_inline)
 {
   // Get ownership of the queue used to store events.
   if (!events_queue) {
     throw std::invalid_argument("events_queue can't be a null pointer");
   }
+  if (execute_timers_separate_thread && execute_timers_inline) {
+    throw std::invalid_argument(
+            "execute_timers_separate_thread and execute_timers_inline are mutually exclusive");
+  }
   events_queue_ = std::move(events_queue);
 
   // Create timers manager
   // The timers manager can be used either to only track timers (in this case an expired
   // timer will generate an executor event and then it will be executed by the executor thread)
   // or it can also take care of executing expired timers in its dedicated thread.
+  // In the inline mode the timers thread is not started at all and the spin loop
+  // drives the timers itself, so no on-ready callback is needed either.
   std::function<void(const rclcpp::TimerBase *)> timer_on_ready_cb = nullptr;
-  if (!execute_timers_separate_thread) {
+  if (!execute_timers_separate_thread && !execute_timers_inline) {
     timer_on_ready_cb = [this](const rclcpp::TimerBase * timer_id) {
         ExecutorEvent event = {timer_id, -1, ExecutorEventType::TIMER_EVENT, 1};
-        this->events_queue_->enqueue(event);
+        this->enqueue_event(event);
       };
   }
   timers_manager_ =
-    std::make_shared<rclcpp::experimental::TimersManager>(context_, timer_on_ready_cb);
+    std::make_shared<rclcpp::experimental::TimersManager>(
+    context_, timer_on_ready_cb, options.thread_attributes, timers_storage);
 
   this->current_entities_collection_ =
     std::make_shared<rclcpp::executors::ExecutorEntitiesCollection>();
@@ -61,6 +79,9 @@ EventsExecutor::EventsExecutor(
       // - a node or callback group guard condition is triggered:
       //    ---> the entities collection is changed, we need to update callbacks
       notify_waitable_event_pushed_ = false;
+      // This executor consumes interrupt triggers here rather than in
+      // wait_for_work, so reopen the trigger coalescing window as well.
+      interrupt_pending_.store(false);
       this->refresh_current_collection_from_callback_groups();
     });
 
@@ -71,12 +92,17 @@ EventsExecutor::EventsExecutor(
   notify_waitable_->add_guard_condition(interrupt_guard_condition_);
   notify_waitable_->add_guard_condition(shutdown_guard_condition_);
 
-  notify_waitable_->set_on_ready_callback(
-    this->create_waitable_callback(notify_waitable_.get()));
+  // Register the notify waitable in the entity slab so that dispatch resolves
+  // it with the O(1) slab lookup instead of the collection map fallback.
+  // Store the waitable sub-object pointer, matching what dispatch casts back to.
+  const auto notify_slab_slot = this->slab_register(
+    notify_waitable_.get(), std::static_pointer_cast<rclcpp::Waitable>(notify_waitable_));
 
   auto notify_waitable_entity_id = notify_waitable_.get();
   notify_waitable_->set_on_ready_callback(
-    [this, notify_waitable_entity_id](size_t num_events, int waitable_data) {
+    [this, notify_waitable_entity_id,
+      slab_entity_id = notify_slab_slot.first,
+      slab_generation = notify_slab_slot.second](size_t num_events, int waitable_data) {
       // The notify waitable has a special callback.
       // We don't care about how many events as when we wake up the executor we are going to
       // process everything regardless.
@@ -88,8 +114,9 @@ EventsExecutor::EventsExecutor(
       }
 
       ExecutorEvent event =
-      {notify_waitable_entity_id, waitable_data, ExecutorEventType::WAITABLE_EVENT, 1};
-      this->events_queue_->enqueue(event);
+      {notify_waitable_entity_id, waitable_data, ExecutorEventType::WAITABLE_EVENT, 1,
+        slab_entity_id, slab_generation};
+      this->enqueue_event(event);
     });
 
   this->entities_collector_ =
@@ -101,6 +128,16 @@ EventsExecutor::~EventsExecutor()
   spinning.store(false);
   notify_waitable_->clear_on_ready_callback();
   this->refresh_current_collection({});
+#ifndef _WIN32
+  // Disable signaling before closing, entities may still hold callbacks.
+  const int write_fd = wakeup_write_fd_.exchange(-1);
+  if (write_fd >= 0) {
+    close(write_fd);
+  }
+  if (wakeup_read_fd_ >= 0) {
+    close(wakeup_read_fd_);
+  }
+#endif
 }
 
 void
@@ -111,6 +148,26 @@ EventsExecutor::spin()
   }
   RCPPUTILS_SCOPE_EXIT(this->spinning.store(false); );
 
+  if (inline_timers_) {
+    // Threadless timers mode: the spin loop computes the next timer deadline,
+    // uses it as the dequeue timeout and executes expired timers in place.
+    // Timer expiration never crosses a thread boundary this way.
+    while (rclcpp::ok(context_) && spinning.load()) {
+      const auto next_timer_timeout = timers_manager_->get_head_timeout();
+      ExecutorEvent event;
+      bool has_event = events_queue_->dequeue(event, next_timer_timeout);
+      if (rclcpp::executor_introspection::enabled()) {
+        rclcpp::executor_introspection::mark_wakeup();
+      }
+      if (has_event) {
+        this->execute_event(event);
+      } else {
+        timers_manager_->execute_head_timer();
+      }
+    }
+    return;
+  }
+
   timers_manager_->start();
   RCPPUTILS_SCOPE_EXIT(timers_manager_->stop(); );
 
@@ -119,6 +176,9 @@ EventsExecutor::spin()
     ExecutorEvent event;
     bool has_event = events_queue_->dequeue(event);
     if (has_event) {
+      if (rclcpp::executor_introspection::enabled()) {
+        rclcpp::executor_introspection::mark_wakeup();
+      }
       this->execute_event(event);
     }
   }
@@ -177,6 +237,9 @@ EventsExecutor::spin_some_impl(std::chrono::nanoseconds max_duration, bool exhau
         ExecutorEvent event;
         bool ret = events_queue_->dequeue(event, std::chrono::nanoseconds(0));
         if (ret) {
+          if (rclcpp::executor_introspection::enabled()) {
+            rclcpp::executor_introspection::mark_wakeup();
+          }
           this->execute_event(event);
           executed_events++;
           continue;
@@ -220,12 +283,115 @@ EventsExecutor::spin_once_impl(std::chrono::nanoseconds timeout)
   // If we wake up from the wait with an event, it means that it
   // arrived before any of the timers expired.
   if (has_event) {
+    if (rclcpp::executor_introspection::enabled()) {
+      rclcpp::executor_introspection::mark_wakeup();
+    }
     this->execute_event(event);
   } else if (is_timer_timeout) {
     timers_manager_->execute_head_timer();
   }
 }
 
+int
+EventsExecutor::get_wakeup_fd()
+{
+#ifdef _WIN32
+  throw std::runtime_error("the wakeup fd is not supported on this platform");
+#else
+  std::lock_guard<std::mutex> lock(wakeup_fd_mutex_);
+  if (wakeup_read_fd_ >= 0) {
+    return wakeup_read_fd_;
+  }
+  int pipe_fds[2];
+  if (pipe(pipe_fds) != 0) {
+    throw std::runtime_error("failed to create the wakeup pipe");
+  }
+  for (int fd : pipe_fds) {
+    if (fcntl(fd, F_SETFL, O_NONBLOCK) != 0) {
+      close(pipe_fds[0]);
+      close(pipe_fds[1]);
+      throw std::runtime_error("failed to make the wakeup pipe non-blocking");
+    }
+  }
+  wakeup_read_fd_ = pipe_fds[0];
+  // Publishing the write end enables signaling from the enqueue paths.
+  wakeup_write_fd_.store(pipe_fds[1], std::memory_order_release);
+  // Events may have been queued before the pipe existed; make sure the
+  // caller's first poll wakes up for them.
+  if (!events_queue_->empty()) {
+    this->signal_wakeup_fd();
+  }
+  return wakeup_read_fd_;
+#endif
+}
+
+size_t
+EventsExecutor::process_ready()
+{
+  if (spinning.exchange(true)) {
+    throw std::runtime_error("process_ready() called while already spinning");
+  }
+  RCPPUTILS_SCOPE_EXIT(this->spinning.store(false); );
+
+  // Drain before dequeuing: events pushed from here on re-signal the
+  // descriptor, so the external loop calls in again for anything missed.
+  this->drain_wakeup_fd();
+
+  size_t executed = 0;
+  ExecutorEvent event;
+  while (rclcpp::ok(context_) && events_queue_->dequeue(event, 0ns)) {
+    this->execute_event(event);
+    executed++;
+  }
+  while (rclcpp::ok(context_) && timers_manager_->execute_head_timer()) {
+    executed++;
+  }
+  return executed;
+}
+
+std::chrono::nanoseconds
+EventsExecutor::time_until_next_timer()
+{
+  return timers_manager_->get_head_timeout();
+}
+
+void
+EventsExecutor::enqueue_event(const ExecutorEvent & event)
+{
+  events_queue_->enqueue(event);
+  this->signal_wakeup_fd();
+}
+
+void
+EventsExecutor::signal_wakeup_fd()
+{
+#ifndef _WIN32
+  const int fd = wakeup_write_fd_.load(std::memory_order_acquire);
+  if (fd < 0) {
+    return;
+  }
+  const uint8_t one = 1;
+  // A full pipe already guarantees a pending wakeup, and there is nobody
+  // to report other failures to on this path; best effort is fine.
+  const ssize_t rc = write(fd, &one, sizeof(one));
+  (void)rc;
+#endif
+}
+
+void
+EventsExecutor::drain_wakeup_fd()
+{
+#ifndef _WIN32
+  std::lock_guard<std::mutex> lock(wakeup_fd_mutex_);
+  if (wakeup_read_fd_ < 0) {
+    return;
+  }
+  uint8_t buffer[64];
+  while (read(wakeup_read_fd_, buffer, sizeof(buffer)) > 0) {
+  }
+#endif
+}
+
 void
 EventsExecutor::add_node(
   rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_ptr, bool notify)
@@ -270,15 +436,19 @@ EventsExecutor::remove_node(std::shared_ptr<rclcpp::Node> node_ptr, bool notify)
 void
 EventsExecutor::execute_event(const ExecutorEvent & event)
 {
+  const bool record_introspection = rclcpp::executor_introspection::enabled();
+  std::chrono::steady_clock::time_point dispatch_start;
+  if (record_introspection) {
+    dispatch_start = std::chrono::steady_clock::now();
+  }
   switch (event.type) {
     case ExecutorEventType::CLIENT_EVENT:
       {
         rclcpp::ClientBase::SharedPtr client;
         {
           std::lock_guard<std::recursive_mutex> lock(collection_mutex_);
-          client = this->retrieve_entity(
-            static_cast<const rcl_client_t *>(event.entity_key),
-            current_entities_collection_->clients);
+          client = this->retrieve_event_entity<rclcpp::ClientBase>(
+            event, current_entities_collection_->clients);
         }
         if (client) {
           for (size_t i = 0; i < event.num_events; i++) {
@@ -293,9 +463,8 @@ EventsExecutor::execute_event(const ExecutorEvent & event)
         rclcpp::SubscriptionBase::SharedPtr subscription;
         {
           std::lock_guard<std::recursive_mutex> lock(collection_mutex_);
-          subscription = this->retrieve_entity(
-            static_cast<const rcl_subscription_t *>(event.entity_key),
-            current_entities_collection_->subscriptions);
+          subscription = this->retrieve_event_entity<rclcpp::SubscriptionBase>(
+            event, current_entities_collection_->subscriptions);
         }
         if (subscription) {
           for (size_t i = 0; i < event.num_events; i++) {
@@ -309,9 +478,8 @@ EventsExecutor::execute_event(const ExecutorEvent & event)
         rclcpp::ServiceBase::SharedPtr service;
         {
           std::lock_guard<std::recursive_mutex> lock(collection_mutex_);
-          service = this->retrieve_entity(
-            static_cast<const rcl_service_t *>(event.entity_key),
-            current_entities_collection_->services);
+          service = this->retrieve_event_entity<rclcpp::ServiceBase>(
+            event, current_entities_collection_->services);
         }
         if (service) {
           for (size_t i = 0; i < event.num_events; i++) {
@@ -332,9 +500,8 @@ EventsExecutor::execute_event(const ExecutorEvent & event)
         rclcpp::Waitable::SharedPtr waitable;
         {
           std::lock_guard<std::recursive_mutex> lock(collection_mutex_);
-          waitable = this->retrieve_entity(
-            static_cast<const rclcpp::Waitable *>(event.entity_key),
-            current_entities_collection_->waitables);
+          waitable = this->retrieve_event_entity<rclcpp::Waitable>(
+            event, current_entities_collection_->waitables);
         }
         if (waitable) {
           for (size_t i = 0; i < event.num_events; i++) {
@@ -345,6 +512,10 @@ EventsExecutor::execute_event(const ExecutorEvent & event)
         break;
       }
   }
+  if (record_introspection) {
+    rclcpp::executor_introspection::record_dispatch(
+      dispatch_start, std::chrono::steady_clock::now());
+  }
 }
 
 void
@@ -404,7 +575,8 @@ EventsExecutor::refresh_current_collection_from_callback_groups()
   this->entities_collector_->update_collections();
   auto callback_groups = this->entities_collector_->get_all_callback_groups();
   rclcpp::executors::ExecutorEntitiesCollection new_collection;
-  rclcpp::executors::build_entities_collection(callback_groups, new_collection);
+  rclcpp::executors::build_entities_collection(
+    callback_groups, new_collection, collection_build_cache_);
 
   // TODO(alsora): this may be implemented in a better way.
   // We need the notify waitable to be included in the executor "current_collection"
@@ -440,27 +612,37 @@ EventsExecutor::refresh_current_collection(
     [this](auto subscription) {
       subscription->set_on_new_message_callback(
         this->create_entity_callback(
-          subscription->get_subscription_handle().get(), ExecutorEventType::SUBSCRIPTION_EVENT));
+          subscription->get_subscription_handle().get(), subscription,
+          ExecutorEventType::SUBSCRIPTION_EVENT));
     },
-    [](auto subscription) {subscription->clear_on_new_message_callback();});
+    [this](auto subscription) {
+      subscription->clear_on_new_message_callback();
+      this->slab_unregister(subscription->get_subscription_handle().get());
+    });
 
   current_entities_collection_->clients.update(
     new_collection.clients,
     [this](auto client) {
       client->set_on_new_response_callback(
         this->create_entity_callback(
-          client->get_client_handle().get(), ExecutorEventType::CLIENT_EVENT));
+          client->get_client_handle().get(), client, ExecutorEventType::CLIENT_EVENT));
     },
-    [](auto client) {client->clear_on_new_response_callback();});
+    [this](auto client) {
+      client->clear_on_new_response_callback();
+      this->slab_unregister(client->get_client_handle().get());
+    });
 
   current_entities_collection_->services.update(
     new_collection.services,
     [this](auto service) {
       service->set_on_new_request_callback(
         this->create_entity_callback(
-          service->get_service_handle().get(), ExecutorEventType::SERVICE_EVENT));
+          service->get_service_handle().get(), service, ExecutorEventType::SERVICE_EVENT));
     },
-    [](auto service) {service->clear_on_new_request_callback();});
+    [this](auto service) {
+      service->clear_on_new_request_callback();
+      this->slab_unregister(service->get_service_handle().get());
+    });
 
   // DO WE NEED THIS? WE ARE NOT DOING ANYTHING WITH GUARD CONDITIONS
   /*
@@ -473,35 +655,91 @@ EventsExecutor::refresh_current_collection(
     new_collection.waitables,
     [this](auto waitable) {
       waitable->set_on_ready_callback(
-        this->create_waitable_callback(waitable.get()));
+        this->create_waitable_callback(waitable.get(), waitable));
     },
-    [](auto waitable) {waitable->clear_on_ready_callback();});
+    [this](auto waitable) {
+      waitable->clear_on_ready_callback();
+      this->slab_unregister(waitable.get());
+    });
 }
 
 std::function<void(size_t)>
 EventsExecutor::create_entity_callback(
-  void * entity_key, ExecutorEventType event_type)
+  void * entity_key, std::weak_ptr<void> entity, ExecutorEventType event_type)
 {
+  const auto slab_slot = this->slab_register(entity_key, std::move(entity));
+  const uint32_t entity_id = slab_slot.first;
+  const uint32_t generation = slab_slot.second;
   std::function<void(size_t)>
-  callback = [this, entity_key, event_type](size_t num_events) {
-      ExecutorEvent event = {entity_key, -1, event_type, num_events};
-      this->events_queue_->enqueue(event);
+  callback = [this, entity_key, event_type, entity_id, generation](size_t num_events) {
+      ExecutorEvent event = {entity_key, -1, event_type, num_events, entity_id, generation};
+      this->enqueue_event(event);
     };
   return callback;
 }
 
 std::function<void(size_t, int)>
-EventsExecutor::create_waitable_callback(const rclcpp::Waitable * entity_key)
+EventsExecutor::create_waitable_callback(
+  const rclcpp::Waitable * entity_key, std::weak_ptr<void> entity)
 {
+  const auto slab_slot = this->slab_register(entity_key, std::move(entity));
+  const uint32_t entity_id = slab_slot.first;
+  const uint32_t generation = slab_slot.second;
   std::function<void(size_t, int)>
-  callback = [this, entity_key](size_t num_events, int waitable_data) {
+  callback = [this, entity_key, entity_id, generation](size_t num_events, int waitable_data) {
       ExecutorEvent event =
-      {entity_key, waitable_data, ExecutorEventType::WAITABLE_EVENT, num_events};
-      this->events_queue_->enqueue(event);
+      {entity_key, waitable_data, ExecutorEventType::WAITABLE_EVENT, num_events,
+        entity_id, generation};
+      this->enqueue_event(event);
     };
   return callback;
 }
 
+std::pair<uint32_t, uint32_t>
+EventsExecutor::slab_register(const void * entity_key, std::weak_ptr<void> entity)
+{
+  std::lock_guard<std::recursive_mutex> lock(collection_mutex_);
+  // Re-registering an entity (e.g. when its callback is re-created) reuses
+  // its slot with a bumped generation, invalidating already queued events.
+  uint32_t entity_id;
+  auto it = slab_index_.find(entity_key);
+  if (it != slab_index_.end()) {
+    entity_id = it->second;
+  } else if (!free_slots_.empty()) {
+    entity_id = free_slots_.back();
+    free_slots_.pop_back();
+    slab_index_[entity_key] = entity_id;
+  } else {
+    entity_id = static_cast<uint32_t>(entity_slab_.size());
+    entity_slab_.emplace_back();
+    slab_index_[entity_key] = entity_id;
+  }
+  EntitySlot & slot = entity_slab_[entity_id];
+  slot.entity = std::move(entity);
+  if (0 == ++slot.generation) {
+    // Generation 0 means "no slab id"; skip it on wrap-around.
+    ++slot.generation;
+  }
+  return {entity_id, slot.generation};
+}
+
+void
+EventsExecutor::slab_unregister(const void * entity_key)
+{
+  std::lock_guard<std::recursive_mutex> lock(collection_mutex_);
+  auto it = slab_index_.find(entity_key);
+  if (it == slab_index_.end()) {
+    return;
+  }
+  EntitySlot & slot = entity_slab_[it->second];
+  slot.entity.reset();
+  if (0 == ++slot.generation) {
+    ++slot.generation;
+  }
+  free_slots_.push_back(it->second);
+  slab_index_.erase(it);
+}
+
 void
 EventsExecutor::add_notify_waitable_to_collection(
   rclcpp::executors::ExecutorEntitiesCollection::WaitableCollection & collection)
@@ -22,15 +22,64 @@
 #include <stdexcept>
 
 #include "rcpputils/scope_exit.hpp"
+#include "tracetools/tracetools.h"
 
 using rclcpp::experimental::TimersManager;
 
+namespace
+{
+
+/// Emit the executor dispatch tracepoint for a timer about to be executed.
+void
+trace_timer_dispatch(rclcpp::TimerBase & timer)
+{
+  (void)timer;
+  TRACETOOLS_TRACEPOINT(
+    rclcpp_executor_execute,
+    static_cast<const void *>(timer.get_timer_handle().get()));
+}
+
+}  // namespace
+
 TimersManager::TimersManager(
   std::shared_ptr<rclcpp::Context> context,
-  std::function<void(const rclcpp::TimerBase *)> on_ready_callback)
+  std::function<void(const rclcpp::TimerBase *)> on_ready_callback,
+  std::optional<rclcpp::ThreadAttributes> thread_attributes,
+  TimersStorage storage,
+  std::chrono::nanoseconds timer_slack,
+  size_t num_timer_threads,
+  std::vector<std::chrono::nanoseconds> shard_period_boundaries)
 {
   context_ = context;
   on_ready_callback_ = on_ready_callback;
+  thread_attributes_ = thread_attributes;
+  storage_ = storage;
+  timer_slack_ = timer_slack;
+
+  if (0 == num_timer_threads) {
+    throw std::invalid_argument("TimersManager() num_timer_threads can't be zero");
+  }
+  if (num_timer_threads > 1) {
+    if (!shard_period_boundaries.empty()) {
+      if (shard_period_boundaries.size() != num_timer_threads - 1) {
+        throw std::invalid_argument(
+                "TimersManager() shard_period_boundaries size must be num_timer_threads - 1");
+      }
+      if (!std::is_sorted(shard_period_boundaries.begin(), shard_period_boundaries.end())) {
+        throw std::invalid_argument(
+                "TimersManager() shard_period_boundaries must be ascending");
+      }
+    }
+    shard_period_boundaries_ = std::move(shard_period_boundaries);
+    // Each shard is a regular single-threaded manager; this object only
+    // routes timers to them and aggregates their state.
+    shards_.reserve(num_timer_threads);
+    for (size_t i = 0; i < num_timer_threads; i++) {
+      shards_.push_back(
+        TimersManager::UniquePtr(
+          new TimersManager(context, on_ready_callback, thread_attributes, storage, timer_slack)));
+    }
+  }
 }
 
 TimersManager::~TimersManager()
@@ -48,10 +97,30 @@ void TimersManager::add_timer(rclcpp::TimerBase::SharedPtr timer)
     throw std::invalid_argument("TimersManager::add_timer() trying to add nullptr timer");
   }
 
+  if (!shards_.empty()) {
+    size_t shard;
+    {
+      std::unique_lock<std::mutex> lock(timers_mutex_);
+      auto it = shard_assignment_.find(timer.get());
+      if (it != shard_assignment_.end()) {
+        shard = it->second;
+      } else {
+        shard = this->select_shard(timer);
+        shard_assignment_[timer.get()] = shard;
+      }
+    }
+    shards_[shard]->add_timer(std::move(timer));
+    return;
+  }
+
   bool added = false;
   {
     std::unique_lock<std::mutex> lock(timers_mutex_);
-    added = weak_timers_heap_.add_timer(timer);
+    if (storage_ == TimersStorage::WHEEL) {
+      added = timer_wheel_.add_timer(timer);
+    } else {
+      added = weak_timers_heap_.add_timer(timer);
+    }
     timers_updated_ = timers_updated_ || added;
   }
 
@@ -61,6 +130,8 @@ void TimersManager::add_timer(rclcpp::TimerBase::SharedPtr timer)
         (void)arg;
         std::unique_lock<std::mutex> lock(timers_mutex_);
         timers_updated_ = true;
+        timer_wheel_.mark_dirty();
+        heap_dirty_ = true;
       }
       timers_cv_.notify_one();
     });
@@ -78,6 +149,14 @@ void TimersManager::start()
     throw std::runtime_error("TimersManager::start() can't start timers thread as already running");
   }
 
+  if (!shards_.empty()) {
+    // One timers thread per shard, no thread for the routing object itself.
+    for (auto & shard : shards_) {
+      shard->start();
+    }
+    return;
+  }
+
   timers_thread_ = std::thread(&TimersManager::run_timers, this);
 }
 
@@ -87,6 +166,10 @@ void TimersManager::stop()
   std::unique_lock<std::mutex> lock(stop_mutex_);
   running_ = false;
 
+  for (auto & shard : shards_) {
+    shard->stop();
+  }
+
   // Notify the timers manager thread to wake up
   {
     std::unique_lock<std::mutex> lock(timers_mutex_);
@@ -108,6 +191,14 @@ std::chrono::nanoseconds TimersManager::get_head_timeout()
             "get_head_timeout() can't be used while timers thread is running");
   }
 
+  if (!shards_.empty()) {
+    auto head_timeout = std::chrono::nanoseconds::max();
+    for (auto & shard : shards_) {
+      head_timeout = std::min(head_timeout, shard->get_head_timeout());
+    }
+    return head_timeout;
+  }
+
   std::unique_lock<std::mutex> lock(timers_mutex_);
   return this->get_head_timeout_unsafe();
 }
@@ -120,7 +211,18 @@ size_t TimersManager::get_number_ready_timers()
             "get_number_ready_timers() can't be used while timers thread is running");
   }
 
+  if (!shards_.empty()) {
+    size_t ready_timers = 0;
+    for (auto & shard : shards_) {
+      ready_timers += shard->get_number_ready_timers();
+    }
+    return ready_timers;
+  }
+
   std::unique_lock<std::mutex> lock(timers_mutex_);
+  if (storage_ == TimersStorage::WHEEL) {
+    return timer_wheel_.get_number_ready_timers();
+  }
   TimersHeap locked_heap = weak_timers_heap_.validate_and_lock();
   return locked_heap.get_number_ready_timers();
 }
@@ -133,8 +235,42 @@ bool TimersManager::execute_head_timer()
             "execute_head_timer() can't be used while timers thread is running");
   }
 
+  if (!shards_.empty()) {
+    // Execute the head of the shard holding the globally earliest timer.
+    size_t head_shard = shards_.size();
+    auto head_timeout = std::chrono::nanoseconds::max();
+    for (size_t i = 0; i < shards_.size(); i++) {
+      const auto shard_timeout = shards_[i]->get_head_timeout();
+      if (shard_timeout < head_timeout) {
+        head_timeout = shard_timeout;
+        head_shard = i;
+      }
+    }
+    if (head_shard == shards_.size()) {
+      return false;
+    }
+    return shards_[head_shard]->execute_head_timer();
+  }
+
   std::unique_lock<std::mutex> lock(timers_mutex_);
 
+  if (storage_ == TimersStorage::WHEEL) {
+    TimerPtr head_timer = timer_wheel_.head_timer();
+    if (!head_timer) {
+      return false;
+    }
+    const bool timer_ready = head_timer->is_ready();
+    if (timer_ready) {
+      // NOTE: here we always execute the timer, regardless of whether the
+      // on_ready_callback is set or not.
+      head_timer->call();
+      trace_timer_dispatch(*head_timer);
+      head_timer->execute_callback();
+      timer_wheel_.reschedule(head_timer);
+    }
+    return timer_ready;
+  }
+
   TimersHeap timers_heap = weak_timers_heap_.validate_and_lock();
 
   // Nothing to do if we don't have any timer
@@ -142,6 +278,13 @@ bool TimersManager::execute_head_timer()
     return false;
   }
 
+  // Restore the heap order if some timer was rescheduled in place.
+  if (heap_dirty_) {
+    heap_dirty_ = false;
+    timers_heap.heapify();
+    weak_timers_heap_.store(timers_heap);
+  }
+
   TimerPtr head_timer = timers_heap.front();
 
   const bool timer_ready = head_timer->is_ready();
@@ -149,6 +292,7 @@ bool TimersManager::execute_head_timer()
     // NOTE: here we always execute the timer, regardless of whether the
     // on_ready_callback is set or not.
     head_timer->call();
+    trace_timer_dispatch(*head_timer);
     head_timer->execute_callback();
     timers_heap.heapify_root();
     weak_timers_heap_.store(timers_heap);
@@ -162,19 +306,51 @@ void TimersManager::execute_ready_timer(const rclcpp::TimerBase * timer_id)
   TimerPtr ready_timer;
   {
     std::unique_lock<std::mutex> lock(timers_mutex_);
-    ready_timer = weak_timers_heap_.get_timer(timer_id);
+    if (!shards_.empty()) {
+      auto it = shard_assignment_.find(timer_id);
+      if (it != shard_assignment_.end()) {
+        const size_t shard = it->second;
+        lock.unlock();
+        shards_[shard]->execute_ready_timer(timer_id);
+      }
+      return;
+    }
+    if (storage_ == TimersStorage::WHEEL) {
+      ready_timer = timer_wheel_.get_timer(timer_id);
+    } else {
+      ready_timer = weak_timers_heap_.get_timer(timer_id);
+    }
   }
   if (ready_timer) {
+    trace_timer_dispatch(*ready_timer);
     ready_timer->execute_callback();
   }
 }
 
 std::chrono::nanoseconds TimersManager::get_head_timeout_unsafe()
 {
+  if (storage_ == TimersStorage::WHEEL) {
+    // Make sure that reset timers are scheduled into the correct slot before
+    // computing how long to sleep.
+    timer_wheel_.refresh_if_dirty();
+    return timer_wheel_.time_until_next();
+  }
+
   // If we don't have any weak pointer, then we just return maximum timeout
   if (weak_timers_heap_.empty()) {
     return std::chrono::nanoseconds::max();
   }
+
+  // A timer may have been rescheduled in place (e.g. its period exchanged),
+  // leaving the heap out of order: restore it with a single heapify, amortized
+  // over however many timers were retuned since the last wakeup.
+  if (heap_dirty_) {
+    heap_dirty_ = false;
+    TimersHeap locked_heap = weak_timers_heap_.validate_and_lock();
+    locked_heap.heapify();
+    weak_timers_heap_.store(locked_heap);
+  }
+
   // Weak heap is not empty, so try to lock the first element.
   // If it is still a valid pointer, it is guaranteed to be the correct head
   TimerPtr head_timer = weak_timers_heap_.front().lock();
@@ -197,6 +373,28 @@ std::chrono::nanoseconds TimersManager::get_head_timeout_unsafe()
 
 void TimersManager::execute_ready_timers_unsafe()
 {
+  if (storage_ == TimersStorage::WHEEL) {
+    timer_wheel_.refresh_if_dirty();
+    // Advance the wheel and dispatch all the timers that expired since the
+    // last wakeup as a single batch.
+    expired_timers_.clear();
+    timer_wheel_.collect_expired(expired_timers_);
+    for (TimerPtr & timer : expired_timers_) {
+      timer->call();
+      if (on_ready_callback_) {
+        on_ready_callback_(timer.get());
+      } else {
+        trace_timer_dispatch(*timer);
+        timer->execute_callback();
+      }
+      // Executing a timer will result in updating its time_until_trigger,
+      // so schedule it into its next slot.
+      timer_wheel_.reschedule(timer);
+    }
+    expired_timers_.clear();
+    return;
+  }
+
   // We start by locking the timers
   TimersHeap locked_heap = weak_timers_heap_.validate_and_lock();
 
@@ -217,6 +415,7 @@ void TimersManager::execute_ready_timers_unsafe()
     if (on_ready_callback_) {
       on_ready_callback_(head_timer.get());
     } else {
+      trace_timer_dispatch(*head_timer);
       head_timer->execute_callback();
     }
 
@@ -232,18 +431,51 @@ void TimersManager::execute_ready_timers_unsafe()
   weak_timers_heap_.store(locked_heap);
 }
 
+size_t TimersManager::select_shard(const TimerPtr & timer)
+{
+  if (shard_period_boundaries_.empty()) {
+    return next_shard_++ % shards_.size();
+  }
+  int64_t period_ns = 0;
+  rcl_ret_t ret = rcl_timer_get_period(timer->get_timer_handle().get(), &period_ns);
+  if (RCL_RET_OK != ret) {
+    // Without a period there is no class to match: treat it as the slowest.
+    return shards_.size() - 1;
+  }
+  const auto period = std::chrono::nanoseconds(period_ns);
+  for (size_t i = 0; i < shard_period_boundaries_.size(); i++) {
+    if (period < shard_period_boundaries_[i]) {
+      return i;
+    }
+  }
+  return shards_.size() - 1;
+}
+
 void TimersManager::run_timers()
 {
   // Make sure the running flag is set to false when we exit from this function
   // to allow restarting the timers thread.
   RCPPUTILS_SCOPE_EXIT(this->running_.store(false); );
 
+  if (thread_attributes_) {
+    rclcpp::apply_attributes_to_current_thread(*thread_attributes_);
+  }
+
   while (rclcpp::ok(context_) && running_) {
     // Lock mutex
     std::unique_lock<std::mutex> lock(timers_mutex_);
 
     std::chrono::nanoseconds time_to_sleep = get_head_timeout_unsafe();
 
+    // Oversleep the head deadline by the slack window, so every timer due
+    // within it is gathered into this wakeup and executed back-to-back below.
+    if (timer_slack_ > std::chrono::nanoseconds::zero() &&
+      time_to_sleep > std::chrono::nanoseconds::zero() &&
+      time_to_sleep != std::chrono::nanoseconds::max())
+    {
+      time_to_sleep += timer_slack_;
+    }
+
     // No need to wait if a timer is already available
     if (time_to_sleep > std::chrono::nanoseconds::zero()) {
       if (time_to_sleep != std::chrono::nanoseconds::max()) {
@@ -265,14 +497,31 @@ void TimersManager::run_timers()
 
 void TimersManager::clear()
 {
+  if (!shards_.empty()) {
+    {
+      std::unique_lock<std::mutex> lock(timers_mutex_);
+      shard_assignment_.clear();
+      next_shard_ = 0;
+    }
+    for (auto & shard : shards_) {
+      shard->clear();
+    }
+    return;
+  }
+
   {
     // Lock mutex and then clear all data structures
     std::unique_lock<std::mutex> lock(timers_mutex_);
 
-    TimersHeap locked_heap = weak_timers_heap_.validate_and_lock();
-    locked_heap.clear_timers_on_reset_callbacks();
+    if (storage_ == TimersStorage::WHEEL) {
+      timer_wheel_.clear_timers_on_reset_callbacks();
+      timer_wheel_.clear();
+    } else {
+      TimersHeap locked_heap = weak_timers_heap_.validate_and_lock();
+      locked_heap.clear_timers_on_reset_callbacks();
 
-    weak_timers_heap_.clear();
+      weak_timers_heap_.clear();
+    }
 
     timers_updated_ = true;
   }
@@ -283,10 +532,29 @@ void TimersManager::clear()
 
 void TimersManager::remove_timer(TimerPtr timer)
 {
+  if (!shards_.empty()) {
+    size_t shard;
+    {
+      std::unique_lock<std::mutex> lock(timers_mutex_);
+      auto it = shard_assignment_.find(timer.get());
+      if (it == shard_assignment_.end()) {
+        return;
+      }
+      shard = it->second;
+      shard_assignment_.erase(it);
+    }
+    shards_[shard]->remove_timer(std::move(timer));
+    return;
+  }
+
   bool removed = false;
   {
     std::unique_lock<std::mutex> lock(timers_mutex_);
-    removed = weak_timers_heap_.remove_timer(timer);
+    if (storage_ == TimersStorage::WHEEL) {
+      removed = timer_wheel_.remove_timer(timer);
+    } else {
+      removed = weak_timers_heap_.remove_timer(timer);
+    }
 
     timers_updated_ = timers_updated_ || removed;
   }
@@ -16,19 +16,81 @@
 #include "rclcpp/generic_publisher.hpp"
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
+#include <vector>
+
+#include "rcutils/allocator.h"
+
+#include "tracetools/tracetools.h"
 
 namespace rclcpp
 {
 
 void GenericPublisher::publish(const rclcpp::SerializedMessage & message)
 {
+  if (codec_) {
+    // Encode into the reusable scratch buffer; the lock serializes concurrent
+    // publishes through it.
+    std::lock_guard<std::mutex> lock(codec_mutex_);
+    codec_->encode(message, codec_buffer_);
+    do_publish(codec_buffer_);
+    return;
+  }
+  do_publish(message);
+}
+
+void GenericPublisher::set_codec(rclcpp::SerializedMessageCodec::SharedPtr codec)
+{
+  codec_ = std::move(codec);
+}
+
+void GenericPublisher::do_publish(const rclcpp::SerializedMessage & message)
+{
+  TRACETOOLS_TRACEPOINT(
+    rclcpp_publish,
+    static_cast<const void *>(get_publisher_handle().get()),
+    static_cast<const void *>(&message));
   auto return_code = rcl_publish_serialized_message(
     get_publisher_handle().get(), &message.get_rcl_serialized_message(), NULL);
 
   if (return_code != RCL_RET_OK) {
     rclcpp::exceptions::throw_from_rcl_error(return_code, "failed to publish serialized message");
   }
+  get_introspection_counters()->messages.fetch_add(1, std::memory_order_relaxed);
+  this->count_publish_latency();
+}
+
+void GenericPublisher::publish_batch(const SerializedBufferView * views, size_t count)
+{
+  // One view message is set up for the whole batch and re-pointed at each payload.
+  // The buffers stay owned by the caller: rcl_publish_serialized_message() only reads
+  // them, so nothing below allocates, copies or frees the payloads.
+  rcl_serialized_message_t view_message = rmw_get_zero_initialized_serialized_message();
+  view_message.allocator = rcutils_get_default_allocator();
+  for (size_t i = 0u; i < count; ++i) {
+    view_message.buffer = const_cast<uint8_t *>(views[i].data);
+    view_message.buffer_length = views[i].size;
+    view_message.buffer_capacity = views[i].size;
+    TRACETOOLS_TRACEPOINT(
+      rclcpp_publish,
+      static_cast<const void *>(get_publisher_handle().get()),
+      static_cast<const void *>(&view_message));
+    auto return_code = rcl_publish_serialized_message(
+      get_publisher_handle().get(), &view_message, NULL);
+
+    if (return_code != RCL_RET_OK) {
+      rclcpp::exceptions::throw_from_rcl_error(
+        return_code, "failed to publish serialized message batch");
+    }
+  }
+  get_introspection_counters()->messages.fetch_add(count, std::memory_order_relaxed);
+}
+
+void GenericPublisher::publish_batch(const std::vector<SerializedBufferView> & views)
+{
+  publish_batch(views.data(), views.size());
 }
 
 void GenericPublisher::publish_as_loaned_msg(const rclcpp::SerializedMessage & message)
@@ -68,12 +130,17 @@ void GenericPublisher::deserialize_message(
 
 void GenericPublisher::publish_loaned_message(void * loaned_message)
 {
+  TRACETOOLS_TRACEPOINT(
+    rclcpp_publish,
+    static_cast<const void *>(get_publisher_handle().get()),
+    static_cast<const void *>(loaned_message));
   auto return_code = rcl_publish_loaned_message(
     get_publisher_handle().get(), loaned_message, NULL);
 
   if (return_code != RCL_RET_OK) {
     rclcpp::exceptions::throw_from_rcl_error(return_code, "failed to publish loaned message");
   }
+  get_introspection_counters()->messages.fetch_add(1, std::memory_order_relaxed);
 }
 
 }  // namespace rclcpp
@@ -15,12 +15,16 @@
 
 #include "rclcpp/generic_subscription.hpp"
 
+#include <chrono>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
 
 #include "rcl/subscription.h"
 
 #include "rclcpp/exceptions.hpp"
+#include "rclcpp/serialized_message_view.hpp"
 
 namespace rclcpp
 {
@@ -34,6 +38,14 @@ GenericSubscription::create_message()
 std::shared_ptr<rclcpp::SerializedMessage>
 GenericSubscription::create_serialized_message()
 {
+  if (buffer_pool_) {
+    std::lock_guard<std::mutex> lock(buffer_pool_->mutex);
+    if (!buffer_pool_->buffers.empty()) {
+      auto message = std::move(buffer_pool_->buffers.back());
+      buffer_pool_->buffers.pop_back();
+      return message;
+    }
+  }
   return std::make_shared<rclcpp::SerializedMessage>(0);
 }
 
@@ -46,12 +58,48 @@ GenericSubscription::handle_message(
           "handle_message is not implemented for GenericSubscription");
 }
 
+void
+GenericSubscription::set_codec(rclcpp::SerializedMessageCodec::SharedPtr codec)
+{
+  codec_ = std::move(codec);
+}
+
 void
 GenericSubscription::handle_serialized_message(
   const std::shared_ptr<rclcpp::SerializedMessage> & message,
   const rclcpp::MessageInfo &)
 {
+  const auto callback_start = std::chrono::steady_clock::now();
+  if (codec_) {
+    // Decode into the scratch buffer, then swap it with the take buffer so
+    // the callback sees the decoded payload and the encoded buffer becomes
+    // the next scratch; the lock serializes concurrent handling through it.
+    std::lock_guard<std::mutex> lock(codec_mutex_);
+    codec_->decode(*message, codec_buffer_);
+    std::swap(*message, codec_buffer_);
+  }
+  if (view_callback_) {
+    // Hand out a borrowed view over the take buffer. The view keeps its own
+    // reference, so the buffer stays valid after the executor has returned the
+    // message, and is recycled into the pool when the view is destroyed.
+    std::weak_ptr<BufferPool> weak_pool = buffer_pool_;
+    view_callback_(
+      rclcpp::SerializedMessageView(
+        message,
+        [weak_pool](std::shared_ptr<rclcpp::SerializedMessage> returned_message) {
+          auto pool = weak_pool.lock();
+          if (!pool) {
+            // The subscription is gone, let the buffer be released.
+            return;
+          }
+          std::lock_guard<std::mutex> lock(pool->mutex);
+          pool->buffers.push_back(std::move(returned_message));
+        }));
+    this->count_callback_executed(callback_start);
+    return;
+  }
   callback_(message);
+  this->count_callback_executed(callback_start);
 }
 
 void
@@ -14,10 +14,16 @@
 
 #include "rclcpp/graph_listener.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <cstdio>
 #include <exception>
+#include <functional>
+#include <map>
 #include <memory>
+#include <regex>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "rcl/error_handling.h"
@@ -156,8 +162,9 @@ GraphListener::run_loop()
     std::vector<size_t> graph_gc_indexes(node_graph_interfaces_size, 0u);
     for (size_t i = 0u; i < node_graph_interfaces_size; ++i) {
       auto node_ptr = node_graph_interfaces_[i];
-      // Only wait on graph changes if some user of the node is watching.
-      if (node_ptr->count_graph_users() == 0) {
+      // Only wait on graph changes if some user of the node is watching,
+      // unless the graph cache is active, which needs every change observed.
+      if (node_ptr->count_graph_users() == 0 && !graph_cache_active_.load()) {
         continue;
       }
       // Add the graph guard condition for the node to the wait set.
@@ -181,6 +188,7 @@ GraphListener::run_loop()
     }
 
     // Notify nodes who's guard conditions are set (triggered).
+    bool any_graph_changes = false;
     for (size_t i = 0u; i < node_graph_interfaces_size; ++i) {
       const auto node_ptr = node_graph_interfaces_[i];
       auto graph_gc = node_ptr->get_graph_guard_condition();
@@ -188,6 +196,10 @@ GraphListener::run_loop()
         throw_from_rcl_error(RCL_RET_ERROR, "failed to get graph guard condition");
       }
       if (graph_gc == wait_set_.guard_conditions[graph_gc_indexes[i]]) {
+        // Invalidate cached graph queries before notifying, so anything woken
+        // up by the notification re-queries rather than seeing stale data.
+        graph_generation_.fetch_add(1);
+        any_graph_changes = true;
         node_ptr->notify_graph_change();
       }
       if (is_shutdown_) {
@@ -195,6 +207,9 @@ GraphListener::run_loop()
         node_ptr->notify_shutdown();
       }
     }
+    if (any_graph_changes) {
+      notify_filtered_graph_events_();
+    }
   }  // while (true)
 }
 
@@ -233,6 +248,289 @@ has_node_(
   return false;
 }
 
+std::shared_ptr<const std::map<std::string, std::vector<std::string>>>
+GraphListener::get_cached_topic_names_and_types(
+  bool no_demangle,
+  const std::function<std::map<std::string, std::vector<std::string>>()> & query)
+{
+  using NamesAndTypesMap = std::map<std::string, std::vector<std::string>>;
+  if (is_shutdown_.load()) {
+    // The listen thread is gone and nothing invalidates the cache, bypass it.
+    return std::make_shared<const NamesAndTypesMap>(query());
+  }
+  if (!graph_cache_active_.exchange(true)) {
+    // Wake up the listen thread so it starts watching every node's graph
+    // guard condition, see run_loop().
+    interrupt_(&interrupt_guard_condition_);
+  }
+  const size_t index = no_demangle ? 1u : 0u;
+  std::lock_guard<std::mutex> cache_lock(graph_cache_mutex_);
+  // Record the generation before querying, so that a graph change observed
+  // by the listen thread during the query marks this snapshot stale.
+  const uint64_t generation = graph_generation_.load();
+  if (
+    cached_topic_names_and_types_[index] &&
+    cached_topic_names_and_types_generations_[index] == generation)
+  {
+    return cached_topic_names_and_types_[index];
+  }
+  cached_topic_names_and_types_generations_[index] = generation;
+  cached_topic_names_and_types_[index] = std::make_shared<const NamesAndTypesMap>(query());
+  return cached_topic_names_and_types_[index];
+}
+
+size_t
+GraphListener::get_cached_publisher_count(
+  const std::string & fq_topic_name,
+  const std::function<size_t()> & query)
+{
+  return get_cached_count_(cached_publisher_counts_, fq_topic_name, query);
+}
+
+size_t
+GraphListener::get_cached_subscriber_count(
+  const std::string & fq_topic_name,
+  const std::function<size_t()> & query)
+{
+  return get_cached_count_(cached_subscriber_counts_, fq_topic_name, query);
+}
+
+size_t
+GraphListener::get_cached_count_(
+  std::map<std::string, CachedCount> & counts,
+  const std::string & fq_topic_name,
+  const std::function<size_t()> & query)
+{
+  if (is_shutdown_.load()) {
+    return query();
+  }
+  if (!graph_cache_active_.exchange(true)) {
+    interrupt_(&interrupt_guard_condition_);
+  }
+  std::lock_guard<std::mutex> cache_lock(graph_cache_mutex_);
+  const uint64_t generation = graph_generation_.load();
+  auto it = counts.find(fq_topic_name);
+  if (it != counts.end() && it->second.generation == generation) {
+    return it->second.count;
+  }
+  const size_t count = query();
+  counts[fq_topic_name] = {generation, count};
+  return count;
+}
+
+rclcpp::Event::SharedPtr
+GraphListener::add_filtered_graph_event(
+  rclcpp::node_interfaces::NodeGraphInterface * node_graph,
+  const std::string & topic_filter)
+{
+  if (!node_graph) {
+    throw std::invalid_argument("node is nullptr");
+  }
+  if (is_shutdown_.load()) {
+    throw GraphListenerShutdownError();
+  }
+  auto event = rclcpp::Event::make_shared();
+  std::lock_guard<std::mutex> filters_lock(filtered_graph_events_mutex_);
+  if (filtered_graph_events_.empty()) {
+    // Baseline for the first diff; later snapshots come from the listen
+    // thread. Going through the node also activates the graph cache, which
+    // makes the listen thread watch every registered node's guard condition.
+    diffed_topic_names_and_types_ = node_graph->get_topic_names_and_types(false);
+  }
+  filtered_graph_events_.push_back({std::regex(topic_filter), event});
+  return event;
+}
+
+rclcpp::Event::SharedPtr
+GraphListener::add_filtered_service_graph_event(
+  rclcpp::node_interfaces::NodeGraphInterface * node_graph,
+  const std::string & service_name)
+{
+  if (!node_graph) {
+    throw std::invalid_argument("node is nullptr");
+  }
+  if (is_shutdown_.load()) {
+    throw GraphListenerShutdownError();
+  }
+  auto event = rclcpp::Event::make_shared();
+  std::lock_guard<std::mutex> filters_lock(filtered_graph_events_mutex_);
+  if (filtered_service_graph_events_.empty()) {
+    // Baseline for the first diff, see add_filtered_graph_event().
+    diffed_service_names_and_types_ = node_graph->get_service_names_and_types();
+  }
+  filtered_service_graph_events_.push_back({service_name, event});
+  return event;
+}
+
+void
+GraphListener::wait_for_filtered_graph_event(
+  rclcpp::Event::SharedPtr event,
+  std::chrono::nanoseconds timeout)
+{
+  using rclcpp::exceptions::InvalidEventError;
+  using rclcpp::exceptions::EventNotRegisteredError;
+  if (!event) {
+    throw InvalidEventError();
+  }
+  std::unique_lock<std::mutex> filters_lock(filtered_graph_events_mutex_);
+  bool event_in_filtered_events = false;
+  for (const auto & filtered : filtered_graph_events_) {
+    if (event == filtered.event.lock()) {
+      event_in_filtered_events = true;
+      break;
+    }
+  }
+  for (const auto & filtered : filtered_service_graph_events_) {
+    if (event_in_filtered_events) {
+      break;
+    }
+    if (event == filtered.event.lock()) {
+      event_in_filtered_events = true;
+    }
+  }
+  if (!event_in_filtered_events) {
+    throw EventNotRegisteredError();
+  }
+  auto pred = [this, &event]() {
+      return event->check() || is_shutdown_.load();
+    };
+  if (!pred()) {
+    filtered_graph_events_cv_.wait_for(filters_lock, timeout, pred);
+  }
+}
+
+void
+GraphListener::notify_filtered_graph_events_()
+{
+  std::lock_guard<std::mutex> filters_lock(filtered_graph_events_mutex_);
+  if (node_graph_interfaces_.empty() ||
+    (filtered_graph_events_.empty() && filtered_service_graph_events_.empty()))
+  {
+    return;
+  }
+  // Every node in the context sees the same graph, so query through any
+  // registered node; registered nodes do not re-enter add_node() from their
+  // query path, which would deadlock against the held nodes mutex.
+  bool any_event_set = false;
+  if (!filtered_graph_events_.empty()) {
+    std::map<std::string, std::vector<std::string>> current_topic_names_and_types;
+    try {
+      current_topic_names_and_types =
+        node_graph_interfaces_.front()->get_topic_names_and_types(false);
+    } catch (const std::exception & exc) {
+      RCLCPP_ERROR(
+        rclcpp::get_logger("rclcpp"),
+        "failed to query graph for filtered graph events: %s", exc.what());
+      return;
+    }
+    const std::vector<std::string> changed_topics =
+      collect_changed_keys_(diffed_topic_names_and_types_, current_topic_names_and_types);
+    diffed_topic_names_and_types_ = std::move(current_topic_names_and_types);
+    bool bad_ptr_encountered = false;
+    for (auto & filtered : filtered_graph_events_) {
+      auto event = filtered.event.lock();
+      if (!event) {
+        bad_ptr_encountered = true;
+        continue;
+      }
+      for (const auto & topic : changed_topics) {
+        if (std::regex_search(topic, filtered.pattern)) {
+          event->set();
+          any_event_set = true;
+          break;
+        }
+      }
+    }
+    if (bad_ptr_encountered) {
+      // remove invalid pointers with the erase-remove idiom
+      filtered_graph_events_.erase(
+        std::remove_if(
+          filtered_graph_events_.begin(),
+          filtered_graph_events_.end(),
+          [](const FilteredGraphEvent & filtered) {
+            return filtered.event.expired();
+          }),
+        filtered_graph_events_.end());
+    }
+  }
+  if (!filtered_service_graph_events_.empty()) {
+    std::map<std::string, std::vector<std::string>> current_service_names_and_types;
+    try {
+      current_service_names_and_types =
+        node_graph_interfaces_.front()->get_service_names_and_types();
+    } catch (const std::exception & exc) {
+      RCLCPP_ERROR(
+        rclcpp::get_logger("rclcpp"),
+        "failed to query graph for filtered service graph events: %s", exc.what());
+      return;
+    }
+    const std::vector<std::string> changed_services =
+      collect_changed_keys_(diffed_service_names_and_types_, current_service_names_and_types);
+    diffed_service_names_and_types_ = std::move(current_service_names_and_types);
+    bool bad_ptr_encountered = false;
+    for (auto & filtered : filtered_service_graph_events_) {
+      auto event = filtered.event.lock();
+      if (!event) {
+        bad_ptr_encountered = true;
+        continue;
+      }
+      for (const auto & service : changed_services) {
+        if (service == filtered.service_name) {
+          event->set();
+          any_event_set = true;
+          break;
+        }
+      }
+    }
+    if (bad_ptr_encountered) {
+      filtered_service_graph_events_.erase(
+        std::remove_if(
+          filtered_service_graph_events_.begin(),
+          filtered_service_graph_events_.end(),
+          [](const FilteredServiceGraphEvent & filtered) {
+            return filtered.event.expired();
+          }),
+        filtered_service_graph_events_.end());
+    }
+  }
+  if (any_event_set) {
+    filtered_graph_events_cv_.notify_all();
+  }
+}
+
+std::vector<std::string>
+GraphListener::collect_changed_keys_(
+  const std::map<std::string, std::vector<std::string>> & old_map,
+  const std::map<std::string, std::vector<std::string>> & new_map)
+{
+  // Collect keys which were added, removed, or changed values.
+  std::vector<std::string> changed_keys;
+  auto old_it = old_map.cbegin();
+  auto new_it = new_map.cbegin();
+  while (old_it != old_map.cend() || new_it != new_map.cend()) {
+    if (old_it == old_map.cend()) {
+      changed_keys.push_back(new_it->first);
+      ++new_it;
+    } else if (new_it == new_map.cend()) {
+      changed_keys.push_back(old_it->first);
+      ++old_it;
+    } else if (old_it->first < new_it->first) {
+      changed_keys.push_back(old_it->first);
+      ++old_it;
+    } else if (new_it->first < old_it->first) {
+      changed_keys.push_back(new_it->first);
+      ++new_it;
+    } else {
+      if (old_it->second != new_it->second) {
+        changed_keys.push_back(new_it->first);
+      }
+      ++old_it;
+      ++new_it;
+    }
+  }
+  return changed_keys;
+}
+
 bool
 GraphListener::has_node(rclcpp::node_interfaces::NodeGraphInterface * node_graph)
 {
@@ -332,6 +630,8 @@ GraphListener::__shutdown()
 {
   std::lock_guard<std::mutex> shutdown_lock(shutdown_mutex_);
   if (!is_shutdown_.exchange(true)) {
+    // Wake up anything blocked in wait_for_filtered_graph_event().
+    filtered_graph_events_cv_.notify_all();
     if (is_started_) {
       interrupt_(&interrupt_guard_condition_);
       listener_thread_.join();
@@ -74,9 +74,18 @@ GuardCondition::get_rcl_guard_condition() const
 void
 GuardCondition::trigger()
 {
-  rcl_ret_t ret = rcl_trigger_guard_condition(&rcl_guard_condition_);
-  if (RCL_RET_OK != ret) {
-    rclcpp::exceptions::throw_from_rcl_error(ret);
+  // While a trigger is already pending, the wait set is guaranteed to wake
+  // (or the executor is already awake); the middleware syscall would be
+  // redundant, so this collapses to the flag exchange. Suppressed triggers
+  // are remembered so the next wait cycle can deliver one catch-up wakeup.
+  if (trigger_pending_.exchange(true, std::memory_order_acq_rel)) {
+    trigger_suppressed_.store(true, std::memory_order_release);
+  } else {
+    rcl_ret_t ret = rcl_trigger_guard_condition(&rcl_guard_condition_);
+    if (RCL_RET_OK != ret) {
+      trigger_pending_.store(false, std::memory_order_release);
+      rclcpp::exceptions::throw_from_rcl_error(ret);
+    }
   }
 
   {
@@ -114,6 +123,29 @@ GuardCondition::add_to_wait_set(rcl_wait_set_t * wait_set)
     rclcpp::exceptions::throw_from_rcl_error(
       ret, "failed to add guard condition to wait set");
   }
+
+  this->retrigger_if_pending();
+}
+
+void
+GuardCondition::retrigger_if_pending() const
+{
+  // Start a new deduplication cycle: clear the pending state first, so
+  // concurrent triggers from here on do their own syscall, then deliver one
+  // catch-up trigger if any was suppressed since the last cycle, as the
+  // wakeup it piggybacked on may already have been consumed; the upcoming
+  // wait then returns and readiness is re-checked instead of sleeping
+  // over it.
+  trigger_pending_.store(false, std::memory_order_release);
+  if (trigger_suppressed_.exchange(false, std::memory_order_acq_rel)) {
+    // Triggering does not mutate the handle in a user-visible way, but the
+    // rcl function takes a non-const pointer.
+    auto * rcl_guard_condition = const_cast<rcl_guard_condition_t *>(&rcl_guard_condition_);
+    rcl_ret_t ret = rcl_trigger_guard_condition(rcl_guard_condition);
+    if (RCL_RET_OK != ret) {
+      rclcpp::exceptions::throw_from_rcl_error(ret);
+    }
+  }
 }
 
 void
@@ -44,7 +44,9 @@ InitOptions::InitOptions(const InitOptions & other)
 : InitOptions(*other.get_rcl_init_options())
 {
   shutdown_on_signal = other.shutdown_on_signal;
+  parallel_shutdown_callbacks = other.parallel_shutdown_callbacks;
   initialize_logging_ = other.initialize_logging_;
+  asynchronous_logging_ = other.asynchronous_logging_;
 }
 
 bool
@@ -60,6 +62,19 @@ InitOptions::auto_initialize_logging(bool initialize_logging)
   return *this;
 }
 
+bool
+InitOptions::asynchronous_logging() const
+{
+  return asynchronous_logging_;
+}
+
+InitOptions &
+InitOptions::asynchronous_logging(bool asynchronous_logging)
+{
+  asynchronous_logging_ = asynchronous_logging;
+  return *this;
+}
+
 InitOptions &
 InitOptions::operator=(const InitOptions & other)
 {
@@ -71,7 +86,9 @@ InitOptions::operator=(const InitOptions & other)
       rclcpp::exceptions::throw_from_rcl_error(ret, "failed to copy rcl init options");
     }
     this->shutdown_on_signal = other.shutdown_on_signal;
+    this->parallel_shutdown_callbacks = other.parallel_shutdown_callbacks;
     this->initialize_logging_ = other.initialize_logging_;
+    this->asynchronous_logging_ = other.asynchronous_logging_;
   }
   return *this;
 }
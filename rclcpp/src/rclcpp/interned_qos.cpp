@@ -0,0 +1,125 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/interned_qos.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+using rclcpp::InternedQoS;
+
+namespace
+{
+
+template<typename FieldT>
+void append_field(std::string & key, FieldT field)
+{
+  key.append(reinterpret_cast<const char *>(&field), sizeof(field));
+}
+
+/// Pack the fields QoS::operator== compares into a byte string.
+std::string profile_key(const rmw_qos_profile_t & profile)
+{
+  std::string key;
+  key.reserve(80u);
+  append_field(key, profile.history);
+  append_field(key, profile.depth);
+  append_field(key, profile.reliability);
+  append_field(key, profile.durability);
+  append_field(key, profile.deadline.sec);
+  append_field(key, profile.deadline.nsec);
+  append_field(key, profile.lifespan.sec);
+  append_field(key, profile.lifespan.nsec);
+  append_field(key, profile.liveliness);
+  append_field(key, profile.liveliness_lease_duration.sec);
+  append_field(key, profile.liveliness_lease_duration.nsec);
+  append_field(key, profile.avoid_ros_namespace_conventions);
+  return key;
+}
+
+}  // unnamed namespace
+
+InternedQoS::InternedQoS(const rclcpp::QoS & qos)
+: interned_(intern(qos))
+{}
+
+const rclcpp::QoS &
+InternedQoS::qos() const
+{
+  static const rclcpp::QoS default_qos(10);
+  return interned_ ? interned_->qos : default_qos;
+}
+
+const rmw_qos_profile_t &
+InternedQoS::get_rmw_qos_profile() const
+{
+  return this->qos().get_rmw_qos_profile();
+}
+
+size_t
+InternedQoS::hash() const
+{
+  return interned_ ? interned_->hash : 0u;
+}
+
+bool
+InternedQoS::empty() const
+{
+  return nullptr == interned_;
+}
+
+bool
+InternedQoS::operator==(const InternedQoS & other) const
+{
+  return interned_ == other.interned_;
+}
+
+bool
+InternedQoS::operator!=(const InternedQoS & other) const
+{
+  return !(*this == other);
+}
+
+std::shared_ptr<const InternedQoS::Interned>
+InternedQoS::intern(const rclcpp::QoS & qos)
+{
+  static std::mutex table_mutex;
+  static std::unordered_map<std::string, std::weak_ptr<const Interned>> table;
+  static size_t purge_threshold = 16u;
+
+  const std::string key = profile_key(qos.get_rmw_qos_profile());
+
+  std::lock_guard<std::mutex> lock(table_mutex);
+  auto it = table.find(key);
+  if (it != table.end()) {
+    if (auto existing = it->second.lock()) {
+      return existing;
+    }
+  }
+  auto interned = std::make_shared<Interned>(qos, std::hash<std::string>()(key));
+  table[key] = interned;
+  // Drop records of profiles whose last user is gone, so processes with
+  // churning entities do not grow the table without bound.
+  if (table.size() >= purge_threshold) {
+    for (auto entry = table.begin(); entry != table.end(); ) {
+      entry = entry->second.expired() ? table.erase(entry) : std::next(entry);
+    }
+    purge_threshold = std::max<size_t>(16u, 2u * table.size());
+  }
+  return interned;
+}
@@ -14,9 +14,13 @@
 
 #include "rclcpp/experimental/intra_process_manager.hpp"
 
+#include <algorithm>
 #include <atomic>
+#include <limits>
 #include <memory>
 #include <mutex>
+#include <utility>
+#include <vector>
 
 namespace rclcpp
 {
@@ -26,10 +30,17 @@ namespace experimental
 static std::atomic<uint64_t> _next_unique_id {1};
 
 IntraProcessManager::IntraProcessManager()
-{}
+{
+  endpoint_state_.store(new EndpointState(), std::memory_order_release);
+}
 
 IntraProcessManager::~IntraProcessManager()
-{}
+{
+  // No publish can be in flight anymore; retire the last snapshot so the
+  // hazard pointer domain reclaims it together with anything still pending.
+  endpoint_state_domain_.retire(
+    endpoint_state_.exchange(nullptr, std::memory_order_acq_rel));
+}
 
 uint64_t
 IntraProcessManager::add_publisher(rclcpp::PublisherBase::SharedPtr publisher)
@@ -55,6 +66,8 @@ IntraProcessManager::add_publisher(rclcpp::PublisherBase::SharedPtr publisher)
     }
   }
 
+  publish_endpoint_state();
+
   return pub_id;
 }
 
@@ -68,6 +81,9 @@ IntraProcessManager::add_subscription(SubscriptionIntraProcessBase::SharedPtr su
   subscriptions_[sub_id] = subscription;
 
   // adds the subscription id to all the matchable publishers
+  const bool replay_latched_samples =
+    subscription->get_actual_qos().durability() == rclcpp::DurabilityPolicy::TransientLocal;
+  std::vector<uint64_t> latched_pub_ids;
   for (auto & pair : publishers_) {
     auto publisher = pair.second.lock();
     if (!publisher) {
@@ -76,6 +92,20 @@ IntraProcessManager::add_subscription(SubscriptionIntraProcessBase::SharedPtr su
     if (can_communicate(publisher, subscription)) {
       uint64_t pub_id = pair.first;
       insert_sub_id_for_pub(sub_id, pub_id, subscription->use_take_shared_method());
+      if (replay_latched_samples && retained_samples_.count(pub_id) != 0u) {
+        latched_pub_ids.push_back(pub_id);
+      }
+    }
+  }
+
+  publish_endpoint_state();
+
+  // Replay the latched samples of matching transient local publishers, so a
+  // late joining subscription receives them through the intra-process buffer
+  // instead of falling back to the rmw path.
+  for (const auto pub_id : latched_pub_ids) {
+    for (const auto & replay : retained_samples_[pub_id]) {
+      replay(subscription);
     }
   }
 
@@ -87,7 +117,11 @@ IntraProcessManager::remove_subscription(uint64_t intra_process_subscription_id)
 {
   std::unique_lock<std::shared_timed_mutex> lock(mutex_);
 
-  subscriptions_.erase(intra_process_subscription_id);
+  if (0u == subscriptions_.erase(intra_process_subscription_id)) {
+    // Already severed, e.g. by clear() during context shutdown; skip the
+    // subscription lists and the snapshot rebuild.
+    return;
+  }
 
   for (auto & pair : pub_to_subs_) {
     pair.second.take_shared_subscriptions.erase(
@@ -104,6 +138,8 @@ IntraProcessManager::remove_subscription(uint64_t intra_process_subscription_id)
         intra_process_subscription_id),
       pair.second.take_ownership_subscriptions.end());
   }
+
+  publish_endpoint_state();
 }
 
 void
@@ -111,16 +147,163 @@ IntraProcessManager::remove_publisher(uint64_t intra_process_publisher_id)
 {
   std::unique_lock<std::shared_timed_mutex> lock(mutex_);
 
-  publishers_.erase(intra_process_publisher_id);
+  if (0u == publishers_.erase(intra_process_publisher_id)) {
+    // Already severed, e.g. by clear() during context shutdown.
+    return;
+  }
   pub_to_subs_.erase(intra_process_publisher_id);
+  retained_samples_.erase(intra_process_publisher_id);
+
+  publish_endpoint_state();
+}
+
+void
+IntraProcessManager::clear()
+{
+  std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+
+  pub_to_subs_.clear();
+  subscriptions_.clear();
+  publishers_.clear();
+  services_.clear();
+  action_servers_.clear();
+  action_clients_.clear();
+  retained_samples_.clear();
+
+  publish_endpoint_state();
+}
+
+uint64_t
+IntraProcessManager::add_service(
+  rclcpp::ServiceBase::SharedPtr service,
+  const rosidl_service_type_support_t * type_support)
+{
+  std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+
+  uint64_t service_id = IntraProcessManager::get_next_unique_id();
+
+  services_[service_id] = ServiceEntry{service, type_support, service->get_service_name()};
+
+  return service_id;
+}
+
+void
+IntraProcessManager::remove_service(uint64_t intra_process_service_id)
+{
+  std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+
+  services_.erase(intra_process_service_id);
+}
+
+rclcpp::ServiceBase::SharedPtr
+IntraProcessManager::get_matching_service(
+  const std::string & service_name,
+  const rosidl_service_type_support_t * type_support) const
+{
+  std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+
+  for (const auto & pair : services_) {
+    const auto & entry = pair.second;
+    if (entry.type_support == type_support && entry.service_name == service_name) {
+      auto service = entry.service.lock();
+      if (service) {
+        return service;
+      }
+    }
+  }
+  return nullptr;
+}
+
+uint64_t
+IntraProcessManager::add_action_server(
+  std::shared_ptr<void> server,
+  const void * type_support,
+  const std::string & action_name)
+{
+  std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+
+  uint64_t action_server_id = IntraProcessManager::get_next_unique_id();
+
+  action_servers_[action_server_id] = ActionEndpointEntry{server, type_support, action_name};
+
+  return action_server_id;
+}
+
+void
+IntraProcessManager::remove_action_server(uint64_t intra_process_action_server_id)
+{
+  std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+
+  action_servers_.erase(intra_process_action_server_id);
 }
 
 bool
-IntraProcessManager::matches_any_publishers(const rmw_gid_t * id) const
+IntraProcessManager::has_matching_action_server(
+  const std::string & action_name,
+  const void * type_support) const
+{
+  std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+
+  for (const auto & pair : action_servers_) {
+    const auto & entry = pair.second;
+    if (entry.type_support == type_support && entry.action_name == action_name &&
+      !entry.endpoint.expired())
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+uint64_t
+IntraProcessManager::add_action_client(
+  std::shared_ptr<void> client,
+  const void * type_support,
+  const std::string & action_name)
+{
+  std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+
+  uint64_t action_client_id = IntraProcessManager::get_next_unique_id();
+
+  action_clients_[action_client_id] = ActionEndpointEntry{client, type_support, action_name};
+
+  return action_client_id;
+}
+
+void
+IntraProcessManager::remove_action_client(uint64_t intra_process_action_client_id)
+{
+  std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+
+  action_clients_.erase(intra_process_action_client_id);
+}
+
+std::vector<std::shared_ptr<void>>
+IntraProcessManager::get_matching_action_clients(
+  const std::string & action_name,
+  const void * type_support) const
 {
   std::shared_lock<std::shared_timed_mutex> lock(mutex_);
 
-  for (auto & publisher_pair : publishers_) {
+  std::vector<std::shared_ptr<void>> matches;
+  for (const auto & pair : action_clients_) {
+    const auto & entry = pair.second;
+    if (entry.type_support == type_support && entry.action_name == action_name) {
+      auto client = entry.endpoint.lock();
+      if (client) {
+        matches.push_back(std::move(client));
+      }
+    }
+  }
+  return matches;
+}
+
+bool
+IntraProcessManager::matches_any_publishers(const rmw_gid_t * id) const
+{
+  auto state = get_endpoint_state();
+
+  for (auto & publisher_pair : state->publishers) {
     auto publisher = publisher_pair.second.lock();
     if (!publisher) {
       continue;
@@ -135,10 +318,10 @@ IntraProcessManager::matches_any_publishers(const rmw_gid_t * id) const
 size_t
 IntraProcessManager::get_subscription_count(uint64_t intra_process_publisher_id) const
 {
-  std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+  auto state = get_endpoint_state();
 
-  auto publisher_it = pub_to_subs_.find(intra_process_publisher_id);
-  if (publisher_it == pub_to_subs_.end()) {
+  auto publisher_it = state->fanouts.find(intra_process_publisher_id);
+  if (publisher_it == state->fanouts.end()) {
     // Publisher is either invalid or no longer exists.
     RCLCPP_WARN(
       rclcpp::get_logger("rclcpp"),
@@ -156,20 +339,15 @@ IntraProcessManager::get_subscription_count(uint64_t intra_process_publisher_id)
 SubscriptionIntraProcessBase::SharedPtr
 IntraProcessManager::get_subscription_intra_process(uint64_t intra_process_subscription_id)
 {
-  std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+  auto state = get_endpoint_state();
 
-  auto subscription_it = subscriptions_.find(intra_process_subscription_id);
-  if (subscription_it == subscriptions_.end()) {
+  auto subscription_it = state->subscriptions.find(intra_process_subscription_id);
+  if (subscription_it == state->subscriptions.end()) {
     return nullptr;
-  } else {
-    auto subscription = subscription_it->second.lock();
-    if (subscription) {
-      return subscription;
-    } else {
-      subscriptions_.erase(subscription_it);
-      return nullptr;
-    }
   }
+  // An expired entry is pruned from the maps when the subscription is removed;
+  // the snapshot is immutable so there is nothing to erase here.
+  return subscription_it->second.lock();
 }
 
 uint64_t
@@ -194,6 +372,66 @@ IntraProcessManager::get_next_unique_id()
   return next_id;
 }
 
+void
+IntraProcessManager::publish_endpoint_state()
+{
+  auto new_state = std::make_unique<EndpointState>();
+  new_state->subscriptions = subscriptions_;
+  new_state->publishers = publishers_;
+  // Resolve the per-publisher subscription ids to weak pointers once, here,
+  // so the publish paths do not pay a hash lookup per recipient per publish.
+  auto resolve = [this](const std::vector<uint64_t> & sub_ids) {
+      std::vector<rclcpp::experimental::SubscriptionIntraProcessBase::WeakPtr> resolved;
+      resolved.reserve(sub_ids.size());
+      for (const auto sub_id : sub_ids) {
+        auto subscription_it = subscriptions_.find(sub_id);
+        if (subscription_it == subscriptions_.end()) {
+          throw std::runtime_error("subscription has unexpectedly gone out of scope");
+        }
+        resolved.push_back(subscription_it->second);
+      }
+      return resolved;
+    };
+  for (const auto & pair : pub_to_subs_) {
+    ResolvedFanout fanout;
+    fanout.take_shared_subscriptions = resolve(pair.second.take_shared_subscriptions);
+    fanout.take_ownership_subscriptions = resolve(pair.second.take_ownership_subscriptions);
+    fanout.all_subscriptions = fanout.take_shared_subscriptions;
+    fanout.all_subscriptions.insert(
+      fanout.all_subscriptions.end(),
+      fanout.take_ownership_subscriptions.begin(),
+      fanout.take_ownership_subscriptions.end());
+    auto publisher_it = publishers_.find(pair.first);
+    if (publisher_it != publishers_.end()) {
+      auto publisher = publisher_it->second.lock();
+      if (publisher &&
+        publisher->get_actual_qos().durability() == rclcpp::DurabilityPolicy::TransientLocal)
+      {
+        fanout.retained_depth = publisher->get_actual_qos().depth();
+      }
+    }
+    new_state->fanouts.emplace(pair.first, std::move(fanout));
+  }
+  const EndpointState * old_state =
+    endpoint_state_.exchange(new_state.release(), std::memory_order_acq_rel);
+  endpoint_state_domain_.retire(old_state);
+}
+
+void
+IntraProcessManager::retain_sample(
+  uint64_t intra_process_publisher_id,
+  size_t depth,
+  RetainedSampleReplayFn replay)
+{
+  std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+
+  auto & samples = retained_samples_[intra_process_publisher_id];
+  samples.push_back(std::move(replay));
+  while (samples.size() > depth) {
+    samples.erase(samples.begin());
+  }
+}
+
 void
 IntraProcessManager::insert_sub_id_for_pub(
   uint64_t sub_id,
@@ -212,11 +450,20 @@ IntraProcessManager::can_communicate(
   rclcpp::PublisherBase::SharedPtr pub,
   rclcpp::experimental::SubscriptionIntraProcessBase::SharedPtr sub) const
 {
-  // publisher and subscription must be on the same topic
-  if (strcmp(pub->get_topic_name(), sub->get_topic_name()) != 0) {
+  // publisher and subscription must be on the same topic; the interned names
+  // make this a pointer comparison
+  if (pub->get_interned_topic_name() != sub->get_interned_topic_name()) {
     return false;
   }
 
+  // identical interned profiles are always compatible; this pointer
+  // comparison covers the common case of both sides using the same profile
+  if (pub->get_interned_actual_qos() == sub->get_interned_actual_qos() &&
+    !pub->get_interned_actual_qos().empty())
+  {
+    return true;
+  }
+
   auto check_result = rclcpp::qos_check_compatible(pub->get_actual_qos(), sub->get_actual_qos());
   if (check_result.compatibility == rclcpp::QoSCompatibility::Error) {
     return false;
@@ -230,8 +477,10 @@ IntraProcessManager::lowest_available_capacity(const uint64_t intra_process_publ
 {
   size_t capacity = std::numeric_limits<size_t>::max();
 
-  auto publisher_it = pub_to_subs_.find(intra_process_publisher_id);
-  if (publisher_it == pub_to_subs_.end()) {
+  auto state = get_endpoint_state();
+
+  auto publisher_it = state->fanouts.find(intra_process_publisher_id);
+  if (publisher_it == state->fanouts.end()) {
     // Publisher is either invalid or no longer exists.
     RCLCPP_WARN(
       rclcpp::get_logger("rclcpp"),
@@ -239,38 +488,81 @@ IntraProcessManager::lowest_available_capacity(const uint64_t intra_process_publ
     return 0u;
   }
 
-  if (publisher_it->second.take_shared_subscriptions.empty() &&
-    publisher_it->second.take_ownership_subscriptions.empty())
-  {
+  if (publisher_it->second.all_subscriptions.empty()) {
     // no subscriptions available
     return 0u;
   }
 
-  auto available_capacity = [this, &capacity](const uint64_t intra_process_subscription_id)
-    {
-      auto subscription_it = subscriptions_.find(intra_process_subscription_id);
-      if (subscription_it != subscriptions_.end()) {
-        auto subscription = subscription_it->second.lock();
+  for (const auto & recipient : publisher_it->second.all_subscriptions) {
+    auto subscription = recipient.lock();
+    if (subscription) {
+      capacity = std::min(capacity, subscription->available_capacity());
+    }
+  }
+
+  return capacity;
+}
+
+IntraProcessManager::TopologySnapshot
+IntraProcessManager::get_topology_snapshot() const
+{
+  TopologySnapshot snapshot;
+
+  auto state = get_endpoint_state();
+
+  snapshot.subscriptions.reserve(state->subscriptions.size());
+  for (const auto & pair : state->subscriptions) {
+    auto subscription = pair.second.lock();
+    if (!subscription) {
+      continue;
+    }
+    SubscriptionBufferStatus status;
+    status.subscription_id = pair.first;
+    status.topic_name = subscription->get_topic_name();
+    status.buffer_type = subscription->use_take_shared_method() ?
+      rclcpp::IntraProcessBufferType::SharedPtr :
+      rclcpp::IntraProcessBufferType::UniquePtr;
+    const rclcpp::QoS qos = subscription->get_actual_qos();
+    status.capacity =
+      (rclcpp::HistoryPolicy::KeepAll == qos.history()) ? 0u : qos.depth();
+    const size_t available = subscription->available_capacity();
+    status.occupancy =
+      (status.capacity > available) ? (status.capacity - available) : 0u;
+    auto counters = subscription->get_introspection_counters();
+    status.overwrites =
+      counters ? counters->buffer_overwrites.load(std::memory_order_relaxed) : 0u;
+    snapshot.subscriptions.push_back(std::move(status));
+  }
+
+  snapshot.publishers.reserve(state->publishers.size());
+  for (const auto & pair : state->publishers) {
+    auto publisher = pair.second.lock();
+    if (!publisher) {
+      continue;
+    }
+    PublisherStatus status;
+    status.publisher_id = pair.first;
+    status.topic_name = publisher->get_topic_name();
+    status.matched_subscription_count = 0u;
+    status.lowest_available_capacity = 0u;
+    auto fanout_it = state->fanouts.find(pair.first);
+    if (fanout_it != state->fanouts.end() && !fanout_it->second.all_subscriptions.empty()) {
+      size_t capacity = std::numeric_limits<size_t>::max();
+      for (const auto & recipient : fanout_it->second.all_subscriptions) {
+        auto subscription = recipient.lock();
         if (subscription) {
+          ++status.matched_subscription_count;
           capacity = std::min(capacity, subscription->available_capacity());
         }
-      } else {
-        // Subscription is either invalid or no longer exists.
-        RCLCPP_WARN(
-          rclcpp::get_logger("rclcpp"),
-          "Calling available_capacity for invalid or no longer existing subscription id");
       }
-    };
-
-  for (const auto sub_id : publisher_it->second.take_shared_subscriptions) {
-    available_capacity(sub_id);
-  }
-
-  for (const auto sub_id : publisher_it->second.take_ownership_subscriptions) {
-    available_capacity(sub_id);
+      if (status.matched_subscription_count > 0u) {
+        status.lowest_available_capacity = capacity;
+      }
+    }
+    snapshot.publishers.push_back(std::move(status));
   }
 
-  return capacity;
+  return snapshot;
 }
 }  // namespace experimental
 }  // namespace rclcpp
@@ -0,0 +1,164 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/introspection.hpp"
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace rclcpp
+{
+namespace introspection
+{
+namespace
+{
+
+struct RegisteredEntity
+{
+  EntityKind kind;
+  std::string name;
+  std::weak_ptr<EntityCounters> counters;
+};
+
+std::mutex &
+get_registry_mutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+std::vector<RegisteredEntity> &
+get_registry()
+{
+  static std::vector<RegisteredEntity> registry;
+  return registry;
+}
+
+/// Fixed capacity of the stall ring, see record_stall().
+constexpr size_t stall_ring_capacity = 64;
+
+std::mutex &
+get_stall_mutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+std::vector<StallEvent> &
+get_stall_ring()
+{
+  static std::vector<StallEvent> ring;
+  return ring;
+}
+
+/// Total events recorded so far; modulo capacity gives the write slot.
+uint64_t &
+get_stall_count()
+{
+  static uint64_t count = 0;
+  return count;
+}
+
+}  // namespace
+
+void
+record_stall(const std::string & description, uint64_t running_ns)
+{
+  StallEvent event;
+  event.description = description;
+  event.running_ns = running_ns;
+  event.detected_at_ns = static_cast<uint64_t>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::system_clock::now().time_since_epoch()).count());
+  std::lock_guard<std::mutex> lock(get_stall_mutex());
+  auto & ring = get_stall_ring();
+  uint64_t & count = get_stall_count();
+  if (ring.size() < stall_ring_capacity) {
+    ring.push_back(std::move(event));
+  } else {
+    ring[count % stall_ring_capacity] = std::move(event);
+  }
+  ++count;
+}
+
+std::vector<StallEvent>
+stall_events()
+{
+  std::lock_guard<std::mutex> lock(get_stall_mutex());
+  const auto & ring = get_stall_ring();
+  const uint64_t count = get_stall_count();
+  std::vector<StallEvent> result;
+  result.reserve(ring.size());
+  if (count <= stall_ring_capacity) {
+    result = ring;
+  } else {
+    for (size_t i = 0; i < stall_ring_capacity; ++i) {
+      result.push_back(ring[(count + i) % stall_ring_capacity]);
+    }
+  }
+  return result;
+}
+
+std::shared_ptr<EntityCounters>
+register_entity(EntityKind kind, const std::string & name)
+{
+  auto counters = std::make_shared<EntityCounters>();
+  std::lock_guard<std::mutex> lock(get_registry_mutex());
+  get_registry().push_back({kind, name, counters});
+  return counters;
+}
+
+std::vector<EntitySnapshot>
+snapshot()
+{
+  std::vector<EntitySnapshot> result;
+  std::lock_guard<std::mutex> lock(get_registry_mutex());
+  auto & registry = get_registry();
+  // Prune entities that have been destroyed since the last snapshot.
+  for (auto it = registry.begin(); it != registry.end(); ) {
+    auto counters = it->counters.lock();
+    if (!counters) {
+      it = registry.erase(it);
+      continue;
+    }
+    EntitySnapshot entry;
+    entry.kind = it->kind;
+    entry.name = it->name;
+    entry.id = static_cast<const void *>(counters.get());
+    entry.messages = counters->messages.load(std::memory_order_relaxed);
+    entry.empty_takes = counters->empty_takes.load(std::memory_order_relaxed);
+    entry.buffer_overwrites = counters->buffer_overwrites.load(std::memory_order_relaxed);
+    entry.shed_messages = counters->shed_messages.load(std::memory_order_relaxed);
+    entry.callbacks = counters->callbacks.load(std::memory_order_relaxed);
+    entry.callback_duration_ns = counters->callback_duration_ns.load(std::memory_order_relaxed);
+    entry.latency_samples = counters->latency_samples.load(std::memory_order_relaxed);
+    entry.latency_sum_ns = counters->latency_sum_ns.load(std::memory_order_relaxed);
+    const uint64_t latency_min = counters->latency_min_ns.load(std::memory_order_relaxed);
+    entry.latency_min_ns = 0 == entry.latency_samples ? 0u : latency_min;
+    entry.latency_max_ns = counters->latency_max_ns.load(std::memory_order_relaxed);
+    entry.timer_jitter_ns = counters->timer_jitter_ns.load(std::memory_order_relaxed);
+    entry.timer_jitter_max_ns = counters->timer_jitter_max_ns.load(std::memory_order_relaxed);
+    entry.timer_overruns = counters->timer_overruns.load(std::memory_order_relaxed);
+    result.push_back(std::move(entry));
+    ++it;
+  }
+  return result;
+}
+
+}  // namespace introspection
+}  // namespace rclcpp
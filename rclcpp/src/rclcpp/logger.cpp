@@ -13,12 +13,15 @@
 // limitations under the License.
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <utility>
 
 #include "rcl_logging_interface/rcl_logging_interface.h"
 #include "rcl/logging_rosout.h"
 
+#include "rclcpp/detail/log_site.hpp"
 #include "rclcpp/exceptions.hpp"
 #include "rclcpp/logger.hpp"
 #include "rclcpp/logging.hpp"
@@ -28,6 +31,18 @@
 namespace rclcpp
 {
 
+/// Children created through get_child(), keyed by suffix.
+struct Logger::ChildCache
+{
+  std::mutex mutex;
+  std::unordered_map<std::string, Logger> children;
+};
+
+Logger::Logger(const std::string & name)
+: name_(new std::string(name)),
+  child_cache_(new ChildCache())
+{}
+
 Logger
 get_logger(const std::string & name)
 {
@@ -74,6 +89,16 @@ Logger::get_child(const std::string & suffix)
     return Logger();
   }
 
+  if (child_cache_) {
+    std::lock_guard<std::mutex> guard(child_cache_->mutex);
+    auto it = child_cache_->children.find(suffix);
+    if (it != child_cache_->children.end()) {
+      // Hot scopes land here: one hash probe and two handle copies, no name
+      // rebuild and no sublogger re-registration.
+      return it->second;
+    }
+  }
+
   rcl_ret_t rcl_ret = RCL_RET_OK;
   std::shared_ptr<std::recursive_mutex> logging_mutex;
   logging_mutex = get_global_logging_mutex();
@@ -104,6 +129,10 @@ Logger::get_child(const std::string & suffix)
         }
       });
   }
+  if (child_cache_) {
+    std::lock_guard<std::mutex> guard(child_cache_->mutex);
+    child_cache_->children.emplace(suffix, logger);
+  }
   return logger;
 }
 
@@ -123,6 +152,9 @@ Logger::set_level(Level level)
       RCL_RET_ERROR, "Couldn't set logger level",
       rcutils_get_error_state(), rcutils_reset_error);
   }
+  // Changing a level can affect any descendant logger, so recompute every
+  // cached per-call-site gate.
+  rclcpp::detail::LogSiteRegistry::refresh_all();
 }
 
 Logger::Level
@@ -36,4 +36,30 @@ MessageInfo::get_rmw_message_info()
   return rmw_message_info_;
 }
 
+rmw_time_point_value_t
+MessageInfo::get_origin_timestamp() const
+{
+  if (0 != origin_timestamp_) {
+    return origin_timestamp_;
+  }
+  return rmw_message_info_.source_timestamp;
+}
+
+void
+MessageInfo::set_origin_timestamp(rmw_time_point_value_t origin_timestamp)
+{
+  origin_timestamp_ = origin_timestamp;
+}
+
+rmw_time_point_value_t
+MessageInfo::get_pipeline_latency() const
+{
+  const rmw_time_point_value_t origin = this->get_origin_timestamp();
+  const rmw_time_point_value_t received = rmw_message_info_.received_timestamp;
+  if (0 == origin || 0 == received || received < origin) {
+    return 0;
+  }
+  return received - origin;
+}
+
 }  // namespace rclcpp
@@ -40,6 +40,8 @@
 #include "rclcpp/node_interfaces/node_waitables.hpp"
 #include "rclcpp/qos_overriding_options.hpp"
 
+#include "rcpputils/scope_exit.hpp"
+
 #include "rmw/validate_namespace.h"
 
 #include "./detail/resolve_parameter_overrides.hpp"
@@ -180,58 +182,20 @@ Node::Node(
       node_logging_,
       options.clock_type()
     )),
-  node_parameters_(new rclcpp::node_interfaces::NodeParameters(
-      node_base_,
-      node_logging_,
-      node_topics_,
-      node_services_,
-      node_clock_,
-      options.parameter_overrides(),
-      options.start_parameter_services(),
-      options.start_parameter_event_publisher(),
-      // This is needed in order to apply parameter overrides to the qos profile provided in
-      // options.
-      get_parameter_events_qos(*node_base_, options),
-      options.parameter_event_publisher_options(),
-      options.allow_undeclared_parameters(),
-      options.automatically_declare_parameters_from_overrides()
-    )),
-  node_time_source_(new rclcpp::node_interfaces::NodeTimeSource(
-      node_base_,
-      node_topics_,
-      node_graph_,
-      node_services_,
-      node_logging_,
-      node_clock_,
-      node_parameters_,
-      options.clock_qos(),
-      options.use_clock_thread()
-    )),
-  node_type_descriptions_(new rclcpp::node_interfaces::NodeTypeDescriptions(
-      node_base_,
-      node_logging_,
-      node_parameters_,
-      node_services_
-    )),
   node_waitables_(new rclcpp::node_interfaces::NodeWaitables(node_base_.get())),
   node_options_(options),
   sub_namespace_(""),
   effective_namespace_(create_effective_namespace(this->get_namespace(), sub_namespace_))
 {
-  // we have got what we wanted directly from the overrides,
-  // but declare the parameters anyway so they are visible.
-  rclcpp::detail::declare_qos_parameters(
-    rclcpp::QosOverridingOptions
-  {
-    QosPolicyKind::Depth,
-    QosPolicyKind::Durability,
-    QosPolicyKind::History,
-    QosPolicyKind::Reliability,
-  },
-    node_parameters_,
-    node_topics_->resolve_topic_name("/parameter_events"),
-    options.parameter_event_qos(),
-    rclcpp::detail::PublisherQosParametersTraits{});
+  // The parameters interface, the time source (which depends on it), and the
+  // type descriptions interface are only constructed here when laziness was
+  // not requested; otherwise they materialize on first use.
+  if (!options.lazy_parameters()) {
+    materialize_parameters_unlocked();
+    if (!options.lazy_time_source()) {
+      materialize_time_source_unlocked();
+    }
+  }
 
   if (options.enable_logger_service()) {
     node_logging_->create_logger_services(node_services_);
@@ -248,8 +212,10 @@ Node::Node(
   node_topics_(other.node_topics_),
   node_services_(other.node_services_),
   node_clock_(other.node_clock_),
-  node_parameters_(other.node_parameters_),
-  node_time_source_(other.node_time_source_),
+  // Sub-nodes share the parent's interfaces by pointer, so any deferred
+  // construction has to happen on the parent before the copy.
+  node_parameters_(other.ensure_node_parameters()),
+  node_time_source_(other.ensure_node_time_source()),
   node_waitables_(other.node_waitables_),
   node_options_(other.node_options_),
   sub_namespace_(extend_sub_namespace(other.get_sub_namespace(), sub_namespace)),
@@ -290,6 +256,104 @@ Node::~Node()
   node_graph_.reset();
 }
 
+void
+Node::materialize_parameters_unlocked() const
+{
+  if (node_parameters_) {
+    return;
+  }
+  node_parameters_.reset(
+    new rclcpp::node_interfaces::NodeParameters(
+      node_base_,
+      node_logging_,
+      node_topics_,
+      node_services_,
+      node_clock_,
+      node_options_.parameter_overrides(),
+      node_options_.start_parameter_services(),
+      node_options_.use_shared_parameter_service(),
+      node_options_.start_parameter_event_publisher(),
+      // This is needed in order to apply parameter overrides to the qos profile provided in
+      // options.
+      get_parameter_events_qos(*node_base_, node_options_),
+      node_options_.parameter_event_publisher_options(),
+      node_options_.allow_undeclared_parameters(),
+      node_options_.automatically_declare_parameters_from_overrides()));
+  node_type_descriptions_.reset(
+    new rclcpp::node_interfaces::NodeTypeDescriptions(
+      node_base_,
+      node_logging_,
+      node_parameters_,
+      node_services_));
+
+  if (!node_options_.qos_profile_manifest().empty()) {
+    // Make the frozen profiles reachable from entity creation, which only has
+    // the parameters interface in hand at QoS resolution time.
+    rclcpp::detail::QosProfileManifestRegistry::instance().set(
+      node_parameters_, node_options_.qos_profile_manifest());
+  }
+
+  // we have got what we wanted directly from the overrides,
+  // but declare the parameters anyway so they are visible.
+  rclcpp::detail::declare_qos_parameters(
+    rclcpp::QosOverridingOptions
+  {
+    QosPolicyKind::Depth,
+    QosPolicyKind::Durability,
+    QosPolicyKind::History,
+    QosPolicyKind::Reliability,
+  },
+    node_parameters_,
+    node_topics_->resolve_topic_name("/parameter_events"),
+    node_options_.parameter_event_qos(),
+    rclcpp::detail::PublisherQosParametersTraits{});
+}
+
+void
+Node::materialize_time_source_unlocked() const
+{
+  if (node_time_source_) {
+    return;
+  }
+  materialize_parameters_unlocked();
+  node_time_source_.reset(
+    new rclcpp::node_interfaces::NodeTimeSource(
+      node_base_,
+      node_topics_,
+      node_graph_,
+      node_services_,
+      node_logging_,
+      node_clock_,
+      node_parameters_,
+      node_options_.clock_qos(),
+      node_options_.use_clock_thread()));
+}
+
+const rclcpp::node_interfaces::NodeParametersInterface::SharedPtr &
+Node::ensure_node_parameters() const
+{
+  if (node_options_.lazy_parameters()) {
+    std::lock_guard<std::mutex> lock(lazy_interfaces_mutex_);
+    materialize_parameters_unlocked();
+    if (!node_options_.lazy_time_source()) {
+      // The time source was only deferred because it needs the parameters
+      // interface, so it materializes along with it.
+      materialize_time_source_unlocked();
+    }
+  }
+  return node_parameters_;
+}
+
+const rclcpp::node_interfaces::NodeTimeSourceInterface::SharedPtr &
+Node::ensure_node_time_source() const
+{
+  if (node_options_.lazy_time_source() || node_options_.lazy_parameters()) {
+    std::lock_guard<std::mutex> lock(lazy_interfaces_mutex_);
+    materialize_time_source_unlocked();
+  }
+  return node_time_source_;
+}
+
 const char *
 Node::get_name() const
 {
@@ -329,7 +393,7 @@ Node::declare_parameter(
   const rcl_interfaces::msg::ParameterDescriptor & parameter_descriptor,
   bool ignore_override)
 {
-  return this->node_parameters_->declare_parameter(
+  return this->ensure_node_parameters()->declare_parameter(
     name,
     default_value,
     parameter_descriptor,
@@ -343,7 +407,7 @@ Node::declare_parameter(
   const rcl_interfaces::msg::ParameterDescriptor & parameter_descriptor,
   bool ignore_override)
 {
-  return this->node_parameters_->declare_parameter(
+  return this->ensure_node_parameters()->declare_parameter(
     name,
     type,
     parameter_descriptor,
@@ -353,56 +417,56 @@ Node::declare_parameter(
 void
 Node::undeclare_parameter(const std::string & name)
 {
-  this->node_parameters_->undeclare_parameter(name);
+  this->ensure_node_parameters()->undeclare_parameter(name);
 }
 
 bool
 Node::has_parameter(const std::string & name) const
 {
-  return this->node_parameters_->has_parameter(name);
+  return this->ensure_node_parameters()->has_parameter(name);
 }
 
 rcl_interfaces::msg::SetParametersResult
 Node::set_parameter(const rclcpp::Parameter & parameter)
 {
-  return node_parameters_->set_parameters_atomically({parameter});
+  return ensure_node_parameters()->set_parameters_atomically({parameter});
 }
 
 std::vector<rcl_interfaces::msg::SetParametersResult>
 Node::set_parameters(const std::vector<rclcpp::Parameter> & parameters)
 {
-  return node_parameters_->set_parameters(parameters);
+  return ensure_node_parameters()->set_parameters(parameters);
 }
 
 rcl_interfaces::msg::SetParametersResult
 Node::set_parameters_atomically(const std::vector<rclcpp::Parameter> & parameters)
 {
-  return node_parameters_->set_parameters_atomically(parameters);
+  return ensure_node_parameters()->set_parameters_atomically(parameters);
 }
 
 rclcpp::Parameter
 Node::get_parameter(const std::string & name) const
 {
-  return node_parameters_->get_parameter(name);
+  return ensure_node_parameters()->get_parameter(name);
 }
 
 bool
 Node::get_parameter(const std::string & name, rclcpp::Parameter & parameter) const
 {
-  return node_parameters_->get_parameter(name, parameter);
+  return ensure_node_parameters()->get_parameter(name, parameter);
 }
 
 std::vector<rclcpp::Parameter>
 Node::get_parameters(
   const std::vector<std::string> & names) const
 {
-  return node_parameters_->get_parameters(names);
+  return ensure_node_parameters()->get_parameters(names);
 }
 
 rcl_interfaces::msg::ParameterDescriptor
 Node::describe_parameter(const std::string & name) const
 {
-  auto result = node_parameters_->describe_parameters({name});
+  auto result = ensure_node_parameters()->describe_parameters({name});
   if (0 == result.size()) {
     throw rclcpp::exceptions::ParameterNotDeclaredException(name);
   }
@@ -415,55 +479,55 @@ Node::describe_parameter(const std::string & name) const
 std::vector<rcl_interfaces::msg::ParameterDescriptor>
 Node::describe_parameters(const std::vector<std::string> & names) const
 {
-  return node_parameters_->describe_parameters(names);
+  return ensure_node_parameters()->describe_parameters(names);
 }
 
 std::vector<uint8_t>
 Node::get_parameter_types(const std::vector<std::string> & names) const
 {
-  return node_parameters_->get_parameter_types(names);
+  return ensure_node_parameters()->get_parameter_types(names);
 }
 
 rcl_interfaces::msg::ListParametersResult
 Node::list_parameters(const std::vector<std::string> & prefixes, uint64_t depth) const
 {
-  return node_parameters_->list_parameters(prefixes, depth);
+  return ensure_node_parameters()->list_parameters(prefixes, depth);
 }
 
 rclcpp::Node::PreSetParametersCallbackHandle::SharedPtr
 Node::add_pre_set_parameters_callback(PreSetParametersCallbackType callback)
 {
-  return node_parameters_->add_pre_set_parameters_callback(callback);
+  return ensure_node_parameters()->add_pre_set_parameters_callback(callback);
 }
 
 rclcpp::Node::OnSetParametersCallbackHandle::SharedPtr
 Node::add_on_set_parameters_callback(OnSetParametersCallbackType callback)
 {
-  return node_parameters_->add_on_set_parameters_callback(callback);
+  return ensure_node_parameters()->add_on_set_parameters_callback(callback);
 }
 
 rclcpp::Node::PostSetParametersCallbackHandle::SharedPtr
 Node::add_post_set_parameters_callback(PostSetParametersCallbackType callback)
 {
-  return node_parameters_->add_post_set_parameters_callback(callback);
+  return ensure_node_parameters()->add_post_set_parameters_callback(callback);
 }
 
 void
 Node::remove_pre_set_parameters_callback(const PreSetParametersCallbackHandle * const handler)
 {
-  node_parameters_->remove_pre_set_parameters_callback(handler);
+  ensure_node_parameters()->remove_pre_set_parameters_callback(handler);
 }
 
 void
 Node::remove_on_set_parameters_callback(const OnSetParametersCallbackHandle * const handler)
 {
-  node_parameters_->remove_on_set_parameters_callback(handler);
+  ensure_node_parameters()->remove_on_set_parameters_callback(handler);
 }
 
 void
 Node::remove_post_set_parameters_callback(const PostSetParametersCallbackHandle * const handler)
 {
-  node_parameters_->remove_post_set_parameters_callback(handler);
+  ensure_node_parameters()->remove_post_set_parameters_callback(handler);
 }
 
 std::vector<std::string>
@@ -524,6 +588,28 @@ Node::for_each_callback_group(
   node_base_->for_each_callback_group(func);
 }
 
+void
+Node::create_entities(const std::function<void()> & batch)
+{
+  if (!batch) {
+    throw std::invalid_argument("batch is nullptr");
+  }
+  // The node base is always the concrete NodeBase created by the
+  // constructors above, including for sub-nodes, which share it.
+  auto node_base = static_cast<rclcpp::node_interfaces::NodeBase *>(node_base_.get());
+  node_base->begin_notify_transaction();
+  RCPPUTILS_SCOPE_EXIT(node_base->end_notify_transaction(); );
+  batch();
+}
+
+void
+Node::destroy_entities(const std::function<void()> & batch)
+{
+  // Same mechanics as creation: any triggers from releasing the entities
+  // are coalesced into one commit-time notification.
+  this->create_entities(batch);
+}
+
 rclcpp::Event::SharedPtr
 Node::get_graph_event()
 {
@@ -541,18 +627,22 @@ Node::wait_for_graph_change(
 rclcpp::Clock::SharedPtr
 Node::get_clock()
 {
+  // Attaches the deferred time source, so the clock honors use_sim_time.
+  ensure_node_time_source();
   return node_clock_->get_clock();
 }
 
 rclcpp::Clock::ConstSharedPtr
 Node::get_clock() const
 {
+  ensure_node_time_source();
   return node_clock_->get_clock();
 }
 
 rclcpp::Time
 Node::now() const
 {
+  ensure_node_time_source();
   return node_clock_->get_clock()->now();
 }
 
@@ -583,7 +673,7 @@ Node::get_node_logging_interface()
 rclcpp::node_interfaces::NodeTimeSourceInterface::SharedPtr
 Node::get_node_time_source_interface()
 {
-  return node_time_source_;
+  return ensure_node_time_source();
 }
 
 rclcpp::node_interfaces::NodeTimersInterface::SharedPtr
@@ -601,6 +691,8 @@ Node::get_node_topics_interface()
 rclcpp::node_interfaces::NodeTypeDescriptionsInterface::SharedPtr
 Node::get_node_type_descriptions_interface()
 {
+  // Materializes along with the parameters interface, which it depends on.
+  ensure_node_parameters();
   return node_type_descriptions_;
 }
 
@@ -613,7 +705,7 @@ Node::get_node_services_interface()
 rclcpp::node_interfaces::NodeParametersInterface::SharedPtr
 Node::get_node_parameters_interface()
 {
-  return node_parameters_;
+  return ensure_node_parameters();
 }
 
 rclcpp::node_interfaces::NodeWaitablesInterface::SharedPtr
@@ -292,9 +292,39 @@ NodeBase::trigger_notify_guard_condition()
   if (!notify_guard_condition_is_valid_) {
     throw std::runtime_error("failed to trigger notify guard condition because it is invalid");
   }
+  if (notify_transaction_depth_ > 0) {
+    // A transaction is open, coalesce into one trigger at commit.
+    notify_trigger_pending_ = true;
+    return;
+  }
   notify_guard_condition_->trigger();
 }
 
+void
+NodeBase::begin_notify_transaction()
+{
+  std::lock_guard<std::recursive_mutex> notify_condition_lock(notify_guard_condition_mutex_);
+  ++notify_transaction_depth_;
+}
+
+void
+NodeBase::end_notify_transaction()
+{
+  std::lock_guard<std::recursive_mutex> notify_condition_lock(notify_guard_condition_mutex_);
+  if (0 == notify_transaction_depth_) {
+    throw std::runtime_error("end_notify_transaction() called without an open transaction");
+  }
+  if (0 == --notify_transaction_depth_ && notify_trigger_pending_) {
+    notify_trigger_pending_ = false;
+    // The guard condition may have been invalidated while the transaction
+    // was open (e.g. during shutdown); losing the trigger is fine then,
+    // there is nobody left to notify.
+    if (notify_guard_condition_is_valid_) {
+      notify_guard_condition_->trigger();
+    }
+  }
+}
+
 bool
 NodeBase::get_use_intra_process_default() const
 {
@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <map>
+#include <memory>
 #include <string>
 #include <tuple>
 #include <utility>
@@ -54,14 +55,17 @@ NodeGraph::~NodeGraph()
   }
 }
 
+static
 std::map<std::string, std::vector<std::string>>
-NodeGraph::get_topic_names_and_types(bool no_demangle) const
+fetch_topic_names_and_types(
+  rclcpp::node_interfaces::NodeBaseInterface * node_base,
+  bool no_demangle)
 {
   rcl_names_and_types_t topic_names_and_types = rcl_get_zero_initialized_names_and_types();
 
   rcl_allocator_t allocator = rcl_get_default_allocator();
   auto ret = rcl_get_topic_names_and_types(
-    node_base_->get_rcl_node_handle(),
+    node_base->get_rcl_node_handle(),
     &allocator,
     no_demangle,
     &topic_names_and_types);
@@ -96,6 +100,21 @@ NodeGraph::get_topic_names_and_types(bool no_demangle) const
   return topics_and_types;
 }
 
+std::map<std::string, std::vector<std::string>>
+NodeGraph::get_topic_names_and_types(bool no_demangle) const
+{
+  return *get_cached_topic_names_and_types(no_demangle);
+}
+
+std::shared_ptr<const std::map<std::string, std::vector<std::string>>>
+NodeGraph::get_cached_topic_names_and_types(bool no_demangle) const
+{
+  ensure_graph_change_monitoring();
+  return graph_listener_->get_cached_topic_names_and_types(
+    no_demangle,
+    [this, no_demangle]() {return fetch_topic_names_and_types(node_base_, no_demangle);});
+}
+
 std::map<std::string, std::vector<std::string>>
 NodeGraph::get_service_names_and_types() const
 {
@@ -465,15 +484,20 @@ NodeGraph::count_publishers(const std::string & topic_name) const
     rcl_node_get_namespace(rcl_node_handle),
     false);    // false = not a service
 
-  size_t count;
-  auto ret = rcl_count_publishers(rcl_node_handle, fqdn.c_str(), &count);
-  if (ret != RMW_RET_OK) {
-    // *INDENT-OFF*
-    throw std::runtime_error(
-      std::string("could not count publishers: ") + rmw_get_error_string().str);
-    // *INDENT-ON*
-  }
-  return count;
+  ensure_graph_change_monitoring();
+  return graph_listener_->get_cached_publisher_count(
+    fqdn,
+    [rcl_node_handle, &fqdn]() {
+      size_t count;
+      auto ret = rcl_count_publishers(rcl_node_handle, fqdn.c_str(), &count);
+      if (ret != RMW_RET_OK) {
+        // *INDENT-OFF*
+        throw std::runtime_error(
+          std::string("could not count publishers: ") + rmw_get_error_string().str);
+        // *INDENT-ON*
+      }
+      return count;
+    });
 }
 
 size_t
@@ -487,15 +511,32 @@ NodeGraph::count_subscribers(const std::string & topic_name) const
     rcl_node_get_namespace(rcl_node_handle),
     false);    // false = not a service
 
-  size_t count;
-  auto ret = rcl_count_subscribers(rcl_node_handle, fqdn.c_str(), &count);
-  if (ret != RMW_RET_OK) {
-    // *INDENT-OFF*
-    throw std::runtime_error(
-      std::string("could not count subscribers: ") + rmw_get_error_string().str);
-    // *INDENT-ON*
+  ensure_graph_change_monitoring();
+  return graph_listener_->get_cached_subscriber_count(
+    fqdn,
+    [rcl_node_handle, &fqdn]() {
+      size_t count;
+      auto ret = rcl_count_subscribers(rcl_node_handle, fqdn.c_str(), &count);
+      if (ret != RMW_RET_OK) {
+        // *INDENT-OFF*
+        throw std::runtime_error(
+          std::string("could not count subscribers: ") + rmw_get_error_string().str);
+        // *INDENT-ON*
+      }
+      return count;
+    });
+}
+
+void
+NodeGraph::ensure_graph_change_monitoring() const
+{
+  // Mirrors get_graph_event(): add this node to the graph listener once, so
+  // that its listen thread observes this node's graph guard condition and
+  // invalidates cached graph queries on changes.
+  if (should_add_to_graph_listener_.exchange(false)) {
+    graph_listener_->add_node(const_cast<NodeGraph *>(this));
+    graph_listener_->start_if_not_started();
   }
-  return count;
 }
 
 const rcl_guard_condition_t *
@@ -565,6 +606,32 @@ NodeGraph::get_graph_event()
   return event;
 }
 
+rclcpp::Event::SharedPtr
+NodeGraph::get_filtered_graph_event(const std::string & topic_filter)
+{
+  // Register with the listener first, so that taking the baseline snapshot
+  // inside the listener does not re-enter it through add_node().
+  ensure_graph_change_monitoring();
+  return graph_listener_->add_filtered_graph_event(this, topic_filter);
+}
+
+rclcpp::Event::SharedPtr
+NodeGraph::get_service_graph_event(const std::string & service_name)
+{
+  // Register with the listener first, so that taking the baseline snapshot
+  // inside the listener does not re-enter it through add_node().
+  ensure_graph_change_monitoring();
+  return graph_listener_->add_filtered_service_graph_event(this, service_name);
+}
+
+void
+NodeGraph::wait_for_filtered_graph_event(
+  rclcpp::Event::SharedPtr event,
+  std::chrono::nanoseconds timeout)
+{
+  graph_listener_->wait_for_filtered_graph_event(event, timeout);
+}
+
 void
 NodeGraph::wait_for_graph_change(
   rclcpp::Event::SharedPtr event,
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include "rclcpp/detail/log_site.hpp"
 #include "rclcpp/node_impl.hpp"
 #include "rclcpp/node_interfaces/node_logging.hpp"
 #include "rclcpp/node_interfaces/node_services_interface.hpp"
@@ -88,6 +89,8 @@ void NodeLogging::create_logger_services(
         }
         response->results.push_back(std::move(result));
       }
+      // Keep the per-call-site gates in sync with the new severities.
+      rclcpp::detail::LogSiteRegistry::refresh_all();
     },
     qos_profile, callback_group);
 }
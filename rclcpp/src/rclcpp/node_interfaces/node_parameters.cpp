@@ -30,8 +30,10 @@
 #include <vector>
 
 #include "rcl_interfaces/srv/list_parameters.hpp"
+#include "rclcpp/allocation_audit.hpp"
 #include "rclcpp/create_publisher.hpp"
 #include "rclcpp/parameter_map.hpp"
+#include "rclcpp/shared_parameter_service.hpp"
 #include "rcutils/logging_macros.h"
 #include "rmw/qos_profiles.h"
 
@@ -72,12 +74,16 @@ NodeParameters::NodeParameters(
   const rclcpp::node_interfaces::NodeClockInterface::SharedPtr node_clock,
   const std::vector<rclcpp::Parameter> & parameter_overrides,
   bool start_parameter_services,
+  bool use_shared_parameter_service,
   bool start_parameter_event_publisher,
   const rclcpp::QoS & parameter_event_qos,
   const rclcpp::PublisherOptionsBase & parameter_event_publisher_options,
   bool allow_undeclared_parameters,
   bool automatically_declare_parameters_from_overrides)
-: allow_undeclared_(allow_undeclared_parameters),
+: snapshot_(
+    std::make_shared<const ParameterSnapshot>(
+      std::map<std::string, ParameterInfo>(), allow_undeclared_parameters)),
+  allow_undeclared_(allow_undeclared_parameters),
   events_publisher_(nullptr),
   node_logging_(node_logging),
   node_clock_(node_clock)
@@ -91,7 +97,12 @@ NodeParameters::NodeParameters(
   publisher_options.allocator = std::make_shared<AllocatorT>();
 
   if (start_parameter_services) {
-    parameter_service_ = std::make_shared<ParameterService>(node_base, node_services, this);
+    if (use_shared_parameter_service) {
+      rclcpp::SharedParameterService::instance().register_node(node_base, node_services, this);
+      shared_parameter_service_name_ = node_base->get_fully_qualified_name();
+    } else {
+      parameter_service_ = std::make_shared<ParameterService>(node_base, node_services, this);
+    }
   }
 
   if (start_parameter_event_publisher) {
@@ -164,7 +175,11 @@ NodeParameters::perform_automatically_declare_parameters_from_overrides()
 }
 
 NodeParameters::~NodeParameters()
-{}
+{
+  if (!shared_parameter_service_name_.empty()) {
+    rclcpp::SharedParameterService::instance().unregister_node(shared_parameter_service_name_);
+  }
+}
 
 RCLCPP_LOCAL
 bool
@@ -175,6 +190,106 @@ __lockless_has_parameter(
   return parameters.find(name) != parameters.end();
 }
 
+using rclcpp::node_interfaces::ParameterInfo;
+using rclcpp::node_interfaces::ParameterSnapshot;
+
+ParameterSnapshot::ParameterSnapshot(
+  const std::map<std::string, ParameterInfo> & parameters,
+  bool allow_undeclared)
+: allow_undeclared_(allow_undeclared)
+{
+  entries_.reserve(parameters.size());
+  for (const auto & name_and_info : parameters) {
+    entries_.push_back(
+      {name_and_info.first, name_and_info.second,
+        std::hash<std::string>{}(name_and_info.first)});
+  }
+
+  // Keep the slot table a power of two and at most half full, so probe
+  // sequences stay short.
+  size_t num_slots = 8;
+  while (num_slots < entries_.size() * 2) {
+    num_slots <<= 1;
+  }
+  slots_.assign(num_slots, 0u);
+  slot_mask_ = num_slots - 1;
+  for (size_t i = 0; i < entries_.size(); ++i) {
+    size_t slot = entries_[i].hash & slot_mask_;
+    while (0u != slots_[slot]) {
+      slot = (slot + 1) & slot_mask_;
+    }
+    slots_[slot] = static_cast<uint32_t>(i + 1);
+  }
+}
+
+const ParameterInfo *
+ParameterSnapshot::find(const std::string & name) const
+{
+  const size_t hash = std::hash<std::string>{}(name);
+  size_t slot = hash & slot_mask_;
+  while (0u != slots_[slot]) {
+    const Entry & entry = entries_[slots_[slot] - 1u];
+    if (entry.hash == hash && entry.name == name) {
+      return &entry.info;
+    }
+    slot = (slot + 1) & slot_mask_;
+  }
+  return nullptr;
+}
+
+bool
+ParameterSnapshot::has_parameter(const std::string & name) const
+{
+  return nullptr != this->find(name);
+}
+
+rclcpp::Parameter
+ParameterSnapshot::get_parameter(const std::string & name) const
+{
+  const ParameterInfo * info = this->find(name);
+  if (nullptr != info) {
+    if (
+      info->value.get_type() != rclcpp::ParameterType::PARAMETER_NOT_SET ||
+      info->descriptor.dynamic_typing)
+    {
+      return rclcpp::Parameter{name, info->value};
+    }
+    throw rclcpp::exceptions::ParameterUninitializedException(name);
+  } else if (allow_undeclared_) {
+    return rclcpp::Parameter{name};
+  } else {
+    throw rclcpp::exceptions::ParameterNotDeclaredException(name);
+  }
+}
+
+bool
+ParameterSnapshot::get_parameter(const std::string & name, rclcpp::Parameter & parameter) const
+{
+  const ParameterInfo * info = this->find(name);
+  if (nullptr != info && info->value.get_type() != rclcpp::ParameterType::PARAMETER_NOT_SET) {
+    parameter = {name, info->value};
+    return true;
+  }
+  return false;
+}
+
+std::vector<rclcpp::Parameter>
+ParameterSnapshot::get_parameters(const std::vector<std::string> & names) const
+{
+  std::vector<rclcpp::Parameter> results;
+  results.reserve(names.size());
+  for (const auto & name : names) {
+    results.emplace_back(this->get_parameter(name));
+  }
+  return results;
+}
+
+size_t
+ParameterSnapshot::size() const
+{
+  return entries_.size();
+}
+
 // see https://en.cppreference.com/w/cpp/types/numeric_limits/epsilon
 RCLCPP_LOCAL
 bool
@@ -400,7 +515,8 @@ __set_parameters_atomically_common(
   std::map<std::string, rclcpp::node_interfaces::ParameterInfo> & parameter_infos,
   OnSetCallbacksHandleContainer & on_set_callback_container,
   PostSetCallbacksHandleContainer & post_set_callback_container,
-  bool allow_undeclared = false)
+  bool allow_undeclared = false,
+  const std::function<void()> & on_values_applied = {})
 {
   // Check if the value being set complies with the descriptor.
   rcl_interfaces::msg::SetParametersResult result = __check_parameters(
@@ -422,6 +538,12 @@ __set_parameters_atomically_common(
       parameter_infos[name].descriptor.type = parameters[i].get_type();
       parameter_infos[name].value = parameters[i].get_parameter_value();
     }
+    // Let the caller publish the updated storage before the post set
+    // callbacks run, so a callback reading parameters back through the node
+    // observes the values just applied rather than a stale snapshot.
+    if (on_values_applied) {
+      on_values_applied();
+    }
     // Call the user post set parameter callback
     __call_post_set_parameters_callbacks(parameters, post_set_callback_container);
   }
@@ -581,7 +703,7 @@ NodeParameters::declare_parameter(
   std::lock_guard<std::recursive_mutex> lock(mutex_);
   ParameterMutationRecursionGuard guard(parameter_modification_enabled_);
 
-  return declare_parameter_helper(
+  const rclcpp::ParameterValue & value = declare_parameter_helper(
     name,
     rclcpp::PARAMETER_NOT_SET,
     default_value,
@@ -594,6 +716,9 @@ NodeParameters::declare_parameter(
     events_publisher_.get(),
     combined_name_,
     *node_clock_);
+
+  refresh_parameter_snapshot();
+  return value;
 }
 
 const rclcpp::ParameterValue &
@@ -617,7 +742,7 @@ NodeParameters::declare_parameter(
             "with `dynamic_typing=true`"};
   }
 
-  return declare_parameter_helper(
+  const rclcpp::ParameterValue & value = declare_parameter_helper(
     name,
     type,
     rclcpp::ParameterValue{},
@@ -630,6 +755,98 @@ NodeParameters::declare_parameter(
     events_publisher_.get(),
     combined_name_,
     *node_clock_);
+
+  refresh_parameter_snapshot();
+  return value;
+}
+
+std::vector<rclcpp::ParameterValue>
+NodeParameters::declare_parameters(const std::vector<ParameterDeclaration> & declarations)
+{
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  ParameterMutationRecursionGuard guard(parameter_modification_enabled_);
+
+  // Validate all of the names up front, so that nothing is applied on failure.
+  for (const auto & declaration : declarations) {
+    // TODO(sloretz) parameter name validation
+    if (declaration.name.empty()) {
+      throw rclcpp::exceptions::InvalidParametersException("parameter name must not be empty");
+    }
+    if (__lockless_has_parameter(parameters_, declaration.name)) {
+      throw rclcpp::exceptions::ParameterAlreadyDeclaredException(
+              "parameter '" + declaration.name + "' has already been declared");
+    }
+  }
+
+  // Declare parameters into a temporary "staging area", in case one of the
+  // declares fails, collecting everything into one consolidated event.
+  std::map<std::string, rclcpp::node_interfaces::ParameterInfo> staged_parameter_changes;
+  rcl_interfaces::msg::ParameterEvent parameter_event_msg;
+  parameter_event_msg.node = combined_name_;
+
+  for (const auto & declaration : declarations) {
+    if (__lockless_has_parameter(staged_parameter_changes, declaration.name)) {
+      throw rclcpp::exceptions::ParameterAlreadyDeclaredException(
+              "parameter '" + declaration.name + "' is declared twice in the same batch");
+    }
+
+    rcl_interfaces::msg::ParameterDescriptor parameter_descriptor = declaration.descriptor;
+    if (!parameter_descriptor.dynamic_typing) {
+      rclcpp::ParameterType type = declaration.default_value.get_type();
+      if (rclcpp::PARAMETER_NOT_SET == type) {
+        throw rclcpp::exceptions::InvalidParameterTypeException{
+                declaration.name,
+                "cannot declare a statically typed parameter with an uninitialized value"
+        };
+      }
+      parameter_descriptor.type = static_cast<uint8_t>(type);
+    }
+
+    auto result = __declare_parameter_common(
+      declaration.name,
+      declaration.default_value,
+      parameter_descriptor,
+      staged_parameter_changes,
+      parameter_overrides_,
+      on_set_parameters_callback_container_,
+      post_set_parameters_callback_container_,
+      &parameter_event_msg,
+      declaration.ignore_override);
+
+    // If it failed to be set, then throw an exception, as declare_parameter() would.
+    if (!result.successful) {
+      constexpr const char type_error_msg_start[] = "Wrong parameter type";
+      if (
+        0u == std::strncmp(
+          result.reason.c_str(), type_error_msg_start, sizeof(type_error_msg_start) - 1))
+      {
+        throw rclcpp::exceptions::InvalidParameterTypeException(declaration.name, result.reason);
+      }
+      throw rclcpp::exceptions::InvalidParameterValueException(
+              "parameter '" + declaration.name + "' could not be set: " + result.reason);
+    }
+  }
+
+  // Everything was validated; commit the staged changes in one step.
+  std::vector<rclcpp::ParameterValue> values;
+  values.reserve(declarations.size());
+  for (const auto & declaration : declarations) {
+    allocation_audit::record(
+      "NodeParameters::declare_parameter",
+      sizeof(decltype(parameters_)::value_type) + declaration.name.size());
+    parameters_[declaration.name] = staged_parameter_changes.at(declaration.name);
+    values.push_back(parameters_.at(declaration.name).value);
+  }
+
+  refresh_parameter_snapshot();
+
+  // Publish if events_publisher_ is not nullptr, which may be if disabled in the constructor.
+  if (nullptr != events_publisher_) {
+    parameter_event_msg.stamp = node_clock_->get_clock()->now();
+    events_publisher_->publish(parameter_event_msg);
+  }
+
+  return values;
 }
 
 void
@@ -655,14 +872,14 @@ NodeParameters::undeclare_parameter(const std::string & name)
   }
 
   parameters_.erase(parameter_info);
+
+  refresh_parameter_snapshot();
 }
 
 bool
 NodeParameters::has_parameter(const std::string & name) const
 {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
-
-  return __lockless_has_parameter(parameters_, name);
+  return this->get_parameter_snapshot()->has_parameter(name);
 }
 
 std::vector<rcl_interfaces::msg::SetParametersResult>
@@ -843,7 +1060,10 @@ NodeParameters::set_parameters_atomically(const std::vector<rclcpp::Parameter> &
     // the remaining aren't called
     on_set_parameters_callback_container_,
     post_set_parameters_callback_container_,
-    allow_undeclared_);  // allow undeclared
+    allow_undeclared_,  // allow undeclared
+    // Publish the new values before the post set callbacks run, so that they
+    // can read them back through the lock-free snapshot getters.
+    [this]() {refresh_parameter_snapshot();});
 
   // If not successful, then stop here.
   if (!result.successful) {
@@ -893,6 +1113,8 @@ NodeParameters::set_parameters_atomically(const std::vector<rclcpp::Parameter> &
     parameter_event_msg.changed_parameters.push_back(parameter.to_parameter_msg());
   }
 
+  refresh_parameter_snapshot();
+
   // Publish if events_publisher_ is not nullptr, which may be if disabled in the constructor.
   if (nullptr != events_publisher_) {
     parameter_event_msg.stamp = node_clock_->get_clock()->now();
@@ -904,35 +1126,14 @@ NodeParameters::set_parameters_atomically(const std::vector<rclcpp::Parameter> &
 std::vector<rclcpp::Parameter>
 NodeParameters::get_parameters(const std::vector<std::string> & names) const
 {
-  std::vector<rclcpp::Parameter> results;
-  results.reserve(names.size());
-
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
-  for (auto & name : names) {
-    results.emplace_back(this->get_parameter(name));
-  }
-  return results;
+  // A single snapshot gives a consistent view across all requested names.
+  return this->get_parameter_snapshot()->get_parameters(names);
 }
 
 rclcpp::Parameter
 NodeParameters::get_parameter(const std::string & name) const
 {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
-
-  auto param_iter = parameters_.find(name);
-  if (parameters_.end() != param_iter) {
-    if (
-      param_iter->second.value.get_type() != rclcpp::ParameterType::PARAMETER_NOT_SET ||
-      param_iter->second.descriptor.dynamic_typing)
-    {
-      return rclcpp::Parameter{name, param_iter->second.value};
-    }
-    throw rclcpp::exceptions::ParameterUninitializedException(name);
-  } else if (this->allow_undeclared_) {
-    return rclcpp::Parameter{name};
-  } else {
-    throw rclcpp::exceptions::ParameterNotDeclaredException(name);
-  }
+  return this->get_parameter_snapshot()->get_parameter(name);
 }
 
 bool
@@ -940,18 +1141,7 @@ NodeParameters::get_parameter(
   const std::string & name,
   rclcpp::Parameter & parameter) const
 {
-  std::lock_guard<std::recursive_mutex> lock(mutex_);
-
-  auto param_iter = parameters_.find(name);
-  if (
-    parameters_.end() != param_iter &&
-    param_iter->second.value.get_type() != rclcpp::ParameterType::PARAMETER_NOT_SET)
-  {
-    parameter = {name, param_iter->second.value};
-    return true;
-  } else {
-    return false;
-  }
+  return this->get_parameter_snapshot()->get_parameter(name, parameter);
 }
 
 bool
@@ -1178,3 +1368,81 @@ NodeParameters::get_parameter_overrides() const
 {
   return parameter_overrides_;
 }
+
+ParameterSnapshot::ConstSharedPtr
+NodeParameters::get_parameter_snapshot() const
+{
+  return std::atomic_load(&snapshot_);
+}
+
+using rclcpp::node_interfaces::ParameterHandle;
+
+ParameterHandle
+NodeParameters::get_parameter_handle(const std::string & name) const
+{
+  return ParameterHandle(this, name);
+}
+
+ParameterHandle::ParameterHandle(const NodeParameters * node_parameters, const std::string & name)
+: node_parameters_(node_parameters),
+  name_(name)
+{}
+
+const std::string &
+ParameterHandle::get_name() const
+{
+  return name_;
+}
+
+const ParameterInfo *
+ParameterHandle::resolve(const ParameterSnapshot::ConstSharedPtr & snapshot) const
+{
+  auto cache = std::atomic_load(&cache_);
+  if (nullptr == cache || cache->snapshot != snapshot) {
+    // The snapshot changed (or this is the first read), re-resolve the name.
+    // Concurrent readers may race to store here, but every candidate cache
+    // is internally consistent, so whichever store wins is valid.
+    cache = std::make_shared<const Cache>(Cache{snapshot, snapshot->find(name_)});
+    std::atomic_store(&cache_, cache);
+  }
+  return cache->info;
+}
+
+rclcpp::Parameter
+ParameterHandle::get_parameter() const
+{
+  auto snapshot = node_parameters_->get_parameter_snapshot();
+  const ParameterInfo * info = this->resolve(snapshot);
+  if (nullptr != info) {
+    if (
+      info->value.get_type() != rclcpp::ParameterType::PARAMETER_NOT_SET ||
+      info->descriptor.dynamic_typing)
+    {
+      return rclcpp::Parameter{name_, info->value};
+    }
+    throw rclcpp::exceptions::ParameterUninitializedException(name_);
+  }
+  // Not in the snapshot, defer to its handling of undeclared parameters.
+  return snapshot->get_parameter(name_);
+}
+
+bool
+ParameterHandle::get_parameter(rclcpp::Parameter & parameter) const
+{
+  auto snapshot = node_parameters_->get_parameter_snapshot();
+  const ParameterInfo * info = this->resolve(snapshot);
+  if (nullptr != info && info->value.get_type() != rclcpp::ParameterType::PARAMETER_NOT_SET) {
+    parameter = {name_, info->value};
+    return true;
+  }
+  return false;
+}
+
+void
+NodeParameters::refresh_parameter_snapshot()
+{
+  std::atomic_store(
+    &snapshot_,
+    ParameterSnapshot::ConstSharedPtr(
+      std::make_shared<const ParameterSnapshot>(parameters_, allow_undeclared_)));
+}
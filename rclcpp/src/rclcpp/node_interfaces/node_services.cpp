@@ -41,6 +41,13 @@ NodeServices::add_service(
 
   group->add_service(service_base_ptr);
 
+  auto intra_process_waitable = service_base_ptr->get_intra_process_waitable();
+  if (nullptr != intra_process_waitable) {
+    // Requests buffered by intra-process clients are then dispatched through
+    // this group, under the same concurrency rules as middleware ones.
+    group->add_waitable(intra_process_waitable);
+  }
+
   // Notify the executor that a new service was created using the parent Node.
   try {
     node_base_->trigger_notify_guard_condition();
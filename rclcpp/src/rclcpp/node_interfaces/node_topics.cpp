@@ -112,8 +112,10 @@ NodeTopics::add_subscription(
   }
 
   auto intra_process_waitable = subscription->get_intra_process_waitable();
-  if (nullptr != intra_process_waitable) {
+  if (nullptr != intra_process_waitable && !subscription->is_busy_polled()) {
     // Add to the callback group to be notified about intra-process msgs.
+    // Busy-polled subscriptions drain their buffer from the poll thread, so
+    // no executor should ever be notified about them.
     callback_group->add_waitable(intra_process_waitable);
   }
 
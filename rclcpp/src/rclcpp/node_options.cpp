@@ -14,12 +14,19 @@
 
 #include "rclcpp/node_options.hpp"
 
+#include <deque>
 #include <limits>
+#include <map>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <utility>
 
+#include "rcl/arguments.h"
+
+#include "rclcpp/allocator/pmr_allocator.hpp"
 #include "rclcpp/detail/utilities.hpp"
 #include "rclcpp/exceptions.hpp"
 #include "rclcpp/logging.hpp"
@@ -53,6 +60,86 @@ rcl_node_options_t_destructor(rcl_node_options_t * node_options)
 }
 }  // namespace detail
 
+namespace
+{
+
+/// Process-wide cache of parsed argument vectors.
+/**
+ * Components loaded into a container frequently share identical argument
+ * lists, and rcl_parse_arguments() is far more expensive than copying an
+ * existing parse result.  Entries are only made for argument vectors parsed
+ * with the default allocator, so cached copies can be handed to any node
+ * options using it.  The cache is bounded; the oldest entry is dropped when
+ * it is full.
+ */
+class ParsedArgumentsCache
+{
+public:
+  static ParsedArgumentsCache &
+  instance()
+  {
+    static ParsedArgumentsCache cache;
+    return cache;
+  }
+
+  /// Copy the cached parse result for the given arguments into `out`, if present.
+  bool
+  fill(const std::vector<std::string> & arguments, rcl_arguments_t * out)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(arguments);
+    if (it == entries_.end()) {
+      return false;
+    }
+    rcl_ret_t ret = rcl_arguments_copy(it->second.get(), out);
+    if (RCL_RET_OK != ret) {
+      rcl_reset_error();
+      return false;
+    }
+    return true;
+  }
+
+  /// Remember the parse result for the given arguments.
+  void
+  store(const std::vector<std::string> & arguments, const rcl_arguments_t * parsed)
+  {
+    auto copy = std::shared_ptr<rcl_arguments_t>(
+      new rcl_arguments_t,
+      [](rcl_arguments_t * args) {
+        if (NULL != args->impl) {
+          if (RCL_RET_OK != rcl_arguments_fini(args)) {
+            rcl_reset_error();
+          }
+        }
+        delete args;
+      });
+    *copy = rcl_get_zero_initialized_arguments();
+    if (RCL_RET_OK != rcl_arguments_copy(parsed, copy.get())) {
+      // Not being able to cache is not an error, the caller keeps its result
+      rcl_reset_error();
+      return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (entries_.count(arguments) != 0) {
+      return;
+    }
+    if (entries_.size() >= max_entries_) {
+      entries_.erase(insertion_order_.front());
+      insertion_order_.pop_front();
+    }
+    insertion_order_.push_back(arguments);
+    entries_.emplace(arguments, std::move(copy));
+  }
+
+private:
+  static constexpr size_t max_entries_ = 32;
+  std::mutex mutex_;
+  std::map<std::vector<std::string>, std::shared_ptr<rcl_arguments_t>> entries_;
+  std::deque<std::vector<std::string>> insertion_order_;
+};
+
+}  // namespace
+
 NodeOptions::NodeOptions(rcl_allocator_t allocator)
 : node_options_(nullptr, detail::rcl_node_options_t_destructor), allocator_(allocator)
 {}
@@ -74,19 +161,25 @@ NodeOptions::operator=(const NodeOptions & other)
     this->use_global_arguments_ = other.use_global_arguments_;
     this->enable_rosout_ = other.enable_rosout_;
     this->use_intra_process_comms_ = other.use_intra_process_comms_;
+    this->numa_domain_ = other.numa_domain_;
     this->enable_topic_statistics_ = other.enable_topic_statistics_;
     this->start_parameter_services_ = other.start_parameter_services_;
+    this->use_shared_parameter_service_ = other.use_shared_parameter_service_;
     this->start_parameter_event_publisher_ = other.start_parameter_event_publisher_;
+    this->lazy_parameters_ = other.lazy_parameters_;
+    this->lazy_time_source_ = other.lazy_time_source_;
     this->clock_type_ = other.clock_type_;
     this->clock_qos_ = other.clock_qos_;
     this->use_clock_thread_ = other.use_clock_thread_;
     this->parameter_event_qos_ = other.parameter_event_qos_;
     this->rosout_qos_ = other.rosout_qos_;
+    this->qos_profile_manifest_ = other.qos_profile_manifest_;
     this->parameter_event_publisher_options_ = other.parameter_event_publisher_options_;
     this->allow_undeclared_parameters_ = other.allow_undeclared_parameters_;
     this->automatically_declare_parameters_from_overrides_ =
       other.automatically_declare_parameters_from_overrides_;
     this->allocator_ = other.allocator_;
+    this->memory_resource_ = other.memory_resource_;
   }
   return *this;
 }
@@ -98,7 +191,11 @@ NodeOptions::get_rcl_node_options() const
   if (!node_options_) {
     node_options_.reset(new rcl_node_options_t);
     *node_options_ = rcl_node_get_default_options();
-    node_options_->allocator = this->allocator_;
+    // A memory resource, when set, overrides the plain rcl allocator.
+    rcl_allocator_t node_allocator = this->memory_resource_ ?
+      rclcpp::allocator::get_rcl_allocator_from_memory_resource(this->memory_resource_) :
+      this->allocator_;
+    node_options_->allocator = node_allocator;
     node_options_->use_global_arguments = this->use_global_arguments_;
     node_options_->enable_rosout = this->enable_rosout_;
     node_options_->rosout_qos = this->rosout_qos_.get_rmw_qos_profile();
@@ -118,18 +215,34 @@ NodeOptions::get_rcl_node_options() const
       }
     }
 
+    // Only argument vectors parsed with the default allocator are shared through
+    // the cache; cached entries already passed the unknown arguments check.
+    bool cacheable =
+      !this->arguments_.empty() &&
+      nullptr == this->memory_resource_ &&
+      node_allocator.allocate == rcl_get_default_allocator().allocate;
+    if (cacheable &&
+      ParsedArgumentsCache::instance().fill(this->arguments_, &(node_options_->arguments)))
+    {
+      return node_options_.get();
+    }
+
     rcl_ret_t ret = rcl_parse_arguments(
-      c_argc, c_argv.get(), this->allocator_, &(node_options_->arguments));
+      c_argc, c_argv.get(), node_allocator, &(node_options_->arguments));
 
     if (RCL_RET_OK != ret) {
       throw_from_rcl_error(ret, "failed to parse arguments");
     }
 
     std::vector<std::string> unparsed_ros_arguments = detail::get_unparsed_ros_arguments(
-      c_argc, c_argv.get(), &(node_options_->arguments), this->allocator_);
+      c_argc, c_argv.get(), &(node_options_->arguments), node_allocator);
     if (!unparsed_ros_arguments.empty()) {
       throw exceptions::UnknownROSArgsError(std::move(unparsed_ros_arguments));
     }
+
+    if (cacheable) {
+      ParsedArgumentsCache::instance().store(this->arguments_, &(node_options_->arguments));
+    }
   }
 
   return node_options_.get();
@@ -157,8 +270,10 @@ NodeOptions::arguments() const
 NodeOptions &
 NodeOptions::arguments(const std::vector<std::string> & arguments)
 {
-  this->node_options_.reset();  // reset node options to make it be recreated on next access.
-  this->arguments_ = arguments;
+  if (this->arguments_ != arguments) {
+    this->node_options_.reset();  // reset node options to make it be recreated on next access.
+    this->arguments_ = arguments;
+  }
   return *this;
 }
 
@@ -190,8 +305,10 @@ NodeOptions::use_global_arguments() const
 NodeOptions &
 NodeOptions::use_global_arguments(bool use_global_arguments)
 {
-  this->node_options_.reset();  // reset node options to make it be recreated on next access.
-  this->use_global_arguments_ = use_global_arguments;
+  if (this->use_global_arguments_ != use_global_arguments) {
+    this->node_options_.reset();  // reset node options to make it be recreated on next access.
+    this->use_global_arguments_ = use_global_arguments;
+  }
   return *this;
 }
 
@@ -204,8 +321,10 @@ NodeOptions::enable_rosout() const
 NodeOptions &
 NodeOptions::enable_rosout(bool enable_rosout)
 {
-  this->node_options_.reset();  // reset node options to make it be recreated on next access.
-  this->enable_rosout_ = enable_rosout;
+  if (this->enable_rosout_ != enable_rosout) {
+    this->node_options_.reset();  // reset node options to make it be recreated on next access.
+    this->enable_rosout_ = enable_rosout;
+  }
   return *this;
 }
 
@@ -222,6 +341,19 @@ NodeOptions::use_intra_process_comms(bool use_intra_process_comms)
   return *this;
 }
 
+size_t
+NodeOptions::numa_domain() const
+{
+  return this->numa_domain_;
+}
+
+NodeOptions &
+NodeOptions::numa_domain(size_t numa_domain)
+{
+  this->numa_domain_ = numa_domain;
+  return *this;
+}
+
 bool
 NodeOptions::enable_topic_statistics() const
 {
@@ -248,6 +380,45 @@ NodeOptions::start_parameter_services(bool start_parameter_services)
   return *this;
 }
 
+bool
+NodeOptions::use_shared_parameter_service() const
+{
+  return this->use_shared_parameter_service_;
+}
+
+NodeOptions &
+NodeOptions::use_shared_parameter_service(bool use_shared_parameter_service)
+{
+  this->use_shared_parameter_service_ = use_shared_parameter_service;
+  return *this;
+}
+
+bool
+NodeOptions::lazy_parameters() const
+{
+  return this->lazy_parameters_;
+}
+
+NodeOptions &
+NodeOptions::lazy_parameters(bool lazy_parameters)
+{
+  this->lazy_parameters_ = lazy_parameters;
+  return *this;
+}
+
+bool
+NodeOptions::lazy_time_source() const
+{
+  return this->lazy_time_source_;
+}
+
+NodeOptions &
+NodeOptions::lazy_time_source(bool lazy_time_source)
+{
+  this->lazy_time_source_ = lazy_time_source;
+  return *this;
+}
+
 bool
 NodeOptions::enable_logger_service() const
 {
@@ -335,8 +506,23 @@ NodeOptions::rosout_qos() const
 NodeOptions &
 NodeOptions::rosout_qos(const rclcpp::QoS & rosout_qos)
 {
-  this->node_options_.reset();
-  this->rosout_qos_ = rosout_qos;
+  if (!(this->rosout_qos_ == rosout_qos)) {
+    this->node_options_.reset();
+    this->rosout_qos_ = rosout_qos;
+  }
+  return *this;
+}
+
+const std::map<std::string, rclcpp::QoS> &
+NodeOptions::qos_profile_manifest() const
+{
+  return this->qos_profile_manifest_;
+}
+
+NodeOptions &
+NodeOptions::qos_profile_manifest(const std::map<std::string, rclcpp::QoS> & qos_profile_manifest)
+{
+  this->qos_profile_manifest_ = qos_profile_manifest;
   return *this;
 }
 
@@ -396,4 +582,20 @@ NodeOptions::allocator(rcl_allocator_t allocator)
   return *this;
 }
 
+std::pmr::memory_resource *
+NodeOptions::memory_resource() const
+{
+  return this->memory_resource_;
+}
+
+NodeOptions &
+NodeOptions::memory_resource(std::pmr::memory_resource * memory_resource)
+{
+  if (this->memory_resource_ != memory_resource) {
+    this->node_options_.reset();  // reset node options to make it be recreated on next access.
+    this->memory_resource_ = memory_resource;
+  }
+  return *this;
+}
+
 }  // namespace rclcpp
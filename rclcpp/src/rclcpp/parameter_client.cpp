@@ -15,6 +15,7 @@
 #include "rclcpp/parameter_client.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <functional>
 #include <future>
@@ -22,6 +23,7 @@
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "./parameter_service_names.hpp"
@@ -240,6 +242,94 @@ AsyncParametersClient::set_parameters(
   return future_result;
 }
 
+std::shared_future<std::vector<rcl_interfaces::msg::SetParametersResult>>
+AsyncParametersClient::set_parameters_bulk(
+  const std::vector<rclcpp::Parameter> & parameters,
+  size_t chunk_size,
+  std::function<
+    void(std::shared_future<std::vector<rcl_interfaces::msg::SetParametersResult>>)
+  > callback)
+{
+  if (0u == chunk_size) {
+    throw std::invalid_argument("chunk_size must be positive");
+  }
+
+  auto promise_result =
+    std::make_shared<std::promise<std::vector<rcl_interfaces::msg::SetParametersResult>>>();
+  auto future_result = promise_result->get_future().share();
+
+  if (parameters.empty()) {
+    promise_result->set_value({});
+    if (callback != nullptr) {
+      callback(future_result);
+    }
+    return future_result;
+  }
+
+  // Shared across the chunk callbacks; the last one to finish fulfills the
+  // promise.  Each chunk writes a disjoint slice of the results vector, so
+  // only the completion counter needs to be atomic.
+  struct BulkState
+  {
+    std::vector<rcl_interfaces::msg::SetParametersResult> results;
+    std::atomic<size_t> chunks_remaining;
+  };
+  auto state = std::make_shared<BulkState>();
+  state->results.resize(parameters.size());
+  state->chunks_remaining = (parameters.size() + chunk_size - 1) / chunk_size;
+
+  for (size_t offset = 0; offset < parameters.size(); offset += chunk_size) {
+    auto request = std::make_shared<rcl_interfaces::srv::SetParameters::Request>();
+    const size_t chunk_end = std::min(offset + chunk_size, parameters.size());
+    for (size_t i = offset; i < chunk_end; ++i) {
+      request->parameters.push_back(parameters[i].to_parameter_msg());
+    }
+
+    set_parameters_client_->async_send_request(
+      request,
+      [state, offset, promise_result, future_result, callback](
+        rclcpp::Client<rcl_interfaces::srv::SetParameters>::SharedFuture cb_f)
+      {
+        auto & chunk_results = cb_f.get()->results;
+        std::copy(
+          chunk_results.begin(), chunk_results.end(),
+          state->results.begin() + static_cast<ptrdiff_t>(offset));
+        if (1u == state->chunks_remaining.fetch_sub(1)) {
+          promise_result->set_value(std::move(state->results));
+          if (callback != nullptr) {
+            callback(future_result);
+          }
+        }
+      }
+    );
+  }
+
+  return future_result;
+}
+
+std::shared_future<std::vector<rcl_interfaces::msg::SetParametersResult>>
+AsyncParametersClient::set_parameters_delta(
+  const std::vector<rclcpp::Parameter> & parameters,
+  const std::vector<rclcpp::Parameter> & snapshot,
+  size_t chunk_size)
+{
+  std::unordered_map<std::string, const rclcpp::Parameter *> snapshot_by_name;
+  snapshot_by_name.reserve(snapshot.size());
+  for (const rclcpp::Parameter & parameter : snapshot) {
+    snapshot_by_name.emplace(parameter.get_name(), &parameter);
+  }
+
+  std::vector<rclcpp::Parameter> changed;
+  for (const rclcpp::Parameter & parameter : parameters) {
+    auto it = snapshot_by_name.find(parameter.get_name());
+    if (it == snapshot_by_name.end() || !(*it->second == parameter)) {
+      changed.push_back(parameter);
+    }
+  }
+
+  return set_parameters_bulk(changed, chunk_size);
+}
+
 std::shared_future<rcl_interfaces::msg::SetParametersResult>
 AsyncParametersClient::set_parameters_atomically(
   const std::vector<rclcpp::Parameter> & parameters,
@@ -166,17 +166,38 @@ ParameterEventHandler::Callbacks::event_callback(const rcl_interfaces::msg::Para
 {
   std::lock_guard<std::recursive_mutex> lock(mutex_);
 
-  for (auto it = parameter_callbacks_.begin(); it != parameter_callbacks_.end(); ++it) {
-    rclcpp::Parameter p;
-    if (get_parameter_from_event(event, p, it->first.first, it->first.second)) {
-      for (auto cb = it->second.begin(); cb != it->second.end(); ++cb) {
-        auto shared_handle = cb->lock();
-        if (nullptr != shared_handle) {
-          shared_handle->callback(p);
-        } else {
-          cb = it->second.erase(cb);
+  if (!parameter_callbacks_.empty()) {
+    // Probe the callback index once per parameter carried by the event, rather than
+    // re-scanning the event arrays once per registered callback.  The key object is
+    // reused so each probe only assigns into existing string capacity.
+    std::pair<std::string, std::string> key;
+    key.second = event.node;
+    auto dispatch = [this, &key](const rcl_interfaces::msg::Parameter & parameter_msg) {
+        key.first = parameter_msg.name;
+        auto it = parameter_callbacks_.find(key);
+        if (it == parameter_callbacks_.end()) {
+          return;
         }
-      }
+        const auto p = rclcpp::Parameter::from_parameter_msg(parameter_msg);
+        for (auto cb = it->second.begin(); cb != it->second.end(); ++cb) {
+          auto shared_handle = cb->lock();
+          if (nullptr != shared_handle) {
+            shared_handle->callback(p);
+          } else {
+            cb = it->second.erase(cb);
+          }
+        }
+        // Keep the index bounded when every handle for this key has been dropped
+        // without an explicit remove_parameter_callback call.
+        if (it->second.empty()) {
+          parameter_callbacks_.erase(it);
+        }
+      };
+    for (auto & new_parameter : event.new_parameters) {
+      dispatch(new_parameter);
+    }
+    for (auto & changed_parameter : event.changed_parameters) {
+      dispatch(changed_parameter);
     }
   }
 
@@ -59,3 +59,45 @@ ParameterEventsFilter::get_events() const
 {
   return result_;
 }
+
+using rclcpp::IndexedParameterEventsFilter;
+
+IndexedParameterEventsFilter::IndexedParameterEventsFilter(
+  const std::vector<std::string> & names,
+  const std::vector<EventType> & types)
+: names_(names.begin(), names.end()),
+  match_new_(std::find(types.begin(), types.end(), EventType::NEW) != types.end()),
+  match_changed_(std::find(types.begin(), types.end(), EventType::CHANGED) != types.end()),
+  match_deleted_(std::find(types.begin(), types.end(), EventType::DELETED) != types.end())
+{
+}
+
+const std::vector<EventPair> &
+IndexedParameterEventsFilter::evaluate(
+  std::shared_ptr<const rcl_interfaces::msg::ParameterEvent> event)
+{
+  result_.clear();
+  event_ = event;
+  if (match_new_) {
+    for (auto & new_parameter : event->new_parameters) {
+      if (names_.count(new_parameter.name) != 0) {
+        result_.push_back(EventPair(EventType::NEW, &new_parameter));
+      }
+    }
+  }
+  if (match_changed_) {
+    for (auto & changed_parameter : event->changed_parameters) {
+      if (names_.count(changed_parameter.name) != 0) {
+        result_.push_back(EventPair(EventType::CHANGED, &changed_parameter));
+      }
+    }
+  }
+  if (match_deleted_) {
+    for (auto & deleted_parameter : event->deleted_parameters) {
+      if (names_.count(deleted_parameter.name) != 0) {
+        result_.push_back(EventPair(EventType::DELETED, &deleted_parameter));
+      }
+    }
+  }
+  return result_;
+}
@@ -0,0 +1,131 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/parameter_file_source.hpp"
+
+#include <rcl_yaml_param_parser/parser.h>
+
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "rclcpp/exceptions.hpp"
+
+using rclcpp::ParameterFileSource;
+
+namespace
+{
+
+struct CacheEntry
+{
+  std::weak_ptr<ParameterFileSource> source;
+  uintmax_t file_size {0};
+  std::filesystem::file_time_type write_time;
+};
+
+std::mutex g_cache_mutex;
+std::map<std::string, CacheEntry> g_cache;
+
+}  // namespace
+
+ParameterFileSource::SharedPtr
+ParameterFileSource::open(const std::string & yaml_filename)
+{
+  std::error_code ec;
+  const uintmax_t file_size = std::filesystem::file_size(yaml_filename, ec);
+  const auto write_time = std::filesystem::last_write_time(yaml_filename, ec);
+
+  std::lock_guard<std::mutex> lock(g_cache_mutex);
+  CacheEntry & entry = g_cache[yaml_filename];
+  auto source = entry.source.lock();
+  if (source && !ec && entry.file_size == file_size && entry.write_time == write_time) {
+    return source;
+  }
+  // Not parsed yet, all users released it, or the file changed on disk.
+  source = SharedPtr(new ParameterFileSource(yaml_filename));
+  entry.source = source;
+  entry.file_size = file_size;
+  entry.write_time = write_time;
+  return source;
+}
+
+ParameterFileSource::ParameterFileSource(const std::string & yaml_filename)
+: yaml_filename_(yaml_filename)
+{
+  rcutils_allocator_t allocator = rcutils_get_default_allocator();
+  params_ = rcl_yaml_node_struct_init(allocator);
+  if (!rcl_parse_yaml_file(yaml_filename.c_str(), params_)) {
+    // The destructor does not run when the constructor throws.
+    rcl_yaml_node_struct_fini(params_);
+    params_ = nullptr;
+    rclcpp::exceptions::throw_from_rcl_error(RCL_RET_ERROR);
+  }
+}
+
+ParameterFileSource::~ParameterFileSource()
+{
+  if (nullptr != params_) {
+    rcl_yaml_node_struct_fini(params_);
+  }
+}
+
+std::vector<std::string>
+ParameterFileSource::node_names() const
+{
+  std::vector<std::string> names;
+  names.reserve(params_->num_nodes);
+  for (size_t n = 0; n < params_->num_nodes; ++n) {
+    const char * c_node_name = params_->node_names[n];
+    if (nullptr == c_node_name) {
+      continue;
+    }
+    // Normalize to a leading slash, matching the keys of parameter_map_from().
+    if ('/' != c_node_name[0]) {
+      names.push_back(std::string("/") + c_node_name);
+    } else {
+      names.emplace_back(c_node_name);
+    }
+  }
+  return names;
+}
+
+std::vector<rclcpp::Parameter>
+ParameterFileSource::parameters(const std::string & node_fqn)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = slices_.find(node_fqn);
+  if (it != slices_.end()) {
+    return it->second;
+  }
+  // Only the matching sections are converted; everything else stays in the
+  // parsed tree's own storage untouched.
+  ParameterMap map = rclcpp::parameter_map_from(params_, node_fqn.c_str());
+  std::vector<Parameter> slice;
+  auto map_it = map.find(node_fqn);
+  if (map_it != map.end()) {
+    slice = std::move(map_it->second);
+  }
+  it = slices_.emplace(node_fqn, std::move(slice)).first;
+  return it->second;
+}
+
+rclcpp::ParameterMap
+ParameterFileSource::parameter_map()
+{
+  return rclcpp::parameter_map_from(params_);
+}
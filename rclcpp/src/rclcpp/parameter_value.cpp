@@ -14,7 +14,9 @@
 
 #include "rclcpp/parameter_value.hpp"
 
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 using rclcpp::ParameterType;
@@ -108,25 +110,46 @@ rclcpp::to_string(const ParameterValue & value)
   }
 }
 
+namespace
+{
+
+/// Build the shared immutable payload used for string and array values.
+std::shared_ptr<rcl_interfaces::msg::ParameterValue>
+make_payload(uint8_t type)
+{
+  auto payload = std::make_shared<rcl_interfaces::msg::ParameterValue>();
+  payload->type = type;
+  return payload;
+}
+
+}  // namespace
+
 ParameterValue::ParameterValue()
 {
-  value_.type = rcl_interfaces::msg::ParameterType::PARAMETER_NOT_SET;
 }
 
 ParameterValue::ParameterValue(const rcl_interfaces::msg::ParameterValue & value)
+: type_(value.type)
 {
-  value_ = value;
   switch (value.type) {
+    case PARAMETER_NOT_SET:
+      break;
     case PARAMETER_BOOL:
+      bool_value_ = value.bool_value;
+      break;
     case PARAMETER_INTEGER:
+      integer_value_ = value.integer_value;
+      break;
     case PARAMETER_DOUBLE:
+      double_value_ = value.double_value;
+      break;
     case PARAMETER_STRING:
     case PARAMETER_BYTE_ARRAY:
     case PARAMETER_BOOL_ARRAY:
     case PARAMETER_INTEGER_ARRAY:
     case PARAMETER_DOUBLE_ARRAY:
     case PARAMETER_STRING_ARRAY:
-    case PARAMETER_NOT_SET:
+      payload_ = std::make_shared<const rcl_interfaces::msg::ParameterValue>(value);
       break;
     default:
       // TODO(wjwwood): use custom exception
@@ -135,39 +158,41 @@ ParameterValue::ParameterValue(const rcl_interfaces::msg::ParameterValue & value
 }
 
 ParameterValue::ParameterValue(const bool bool_value)
+: type_(rcl_interfaces::msg::ParameterType::PARAMETER_BOOL),
+  bool_value_(bool_value)
 {
-  value_.bool_value = bool_value;
-  value_.type = rcl_interfaces::msg::ParameterType::PARAMETER_BOOL;
 }
 
 ParameterValue::ParameterValue(const int int_value)
+: type_(rcl_interfaces::msg::ParameterType::PARAMETER_INTEGER),
+  integer_value_(int_value)
 {
-  value_.integer_value = int_value;
-  value_.type = rcl_interfaces::msg::ParameterType::PARAMETER_INTEGER;
 }
 
 ParameterValue::ParameterValue(const int64_t int_value)
+: type_(rcl_interfaces::msg::ParameterType::PARAMETER_INTEGER),
+  integer_value_(int_value)
 {
-  value_.integer_value = int_value;
-  value_.type = rcl_interfaces::msg::ParameterType::PARAMETER_INTEGER;
 }
 
 ParameterValue::ParameterValue(const float double_value)
+: type_(rcl_interfaces::msg::ParameterType::PARAMETER_DOUBLE),
+  double_value_(static_cast<double>(double_value))
 {
-  value_.double_value = static_cast<double>(double_value);
-  value_.type = rcl_interfaces::msg::ParameterType::PARAMETER_DOUBLE;
 }
 
 ParameterValue::ParameterValue(const double double_value)
+: type_(rcl_interfaces::msg::ParameterType::PARAMETER_DOUBLE),
+  double_value_(double_value)
 {
-  value_.double_value = double_value;
-  value_.type = rcl_interfaces::msg::ParameterType::PARAMETER_DOUBLE;
 }
 
 ParameterValue::ParameterValue(const std::string & string_value)
+: type_(rcl_interfaces::msg::ParameterType::PARAMETER_STRING)
 {
-  value_.string_value = string_value;
-  value_.type = rcl_interfaces::msg::ParameterType::PARAMETER_STRING;
+  auto payload = make_payload(type_);
+  payload->string_value = string_value;
+  payload_ = std::move(payload);
 }
 
 ParameterValue::ParameterValue(const char * string_value)
@@ -175,67 +200,114 @@ ParameterValue::ParameterValue(const char * string_value)
 {}
 
 ParameterValue::ParameterValue(const std::vector<uint8_t> & byte_array_value)
+: type_(rcl_interfaces::msg::ParameterType::PARAMETER_BYTE_ARRAY)
 {
-  value_.byte_array_value = byte_array_value;
-  value_.type = rcl_interfaces::msg::ParameterType::PARAMETER_BYTE_ARRAY;
+  auto payload = make_payload(type_);
+  payload->byte_array_value = byte_array_value;
+  payload_ = std::move(payload);
 }
 
 ParameterValue::ParameterValue(const std::vector<bool> & bool_array_value)
+: type_(rcl_interfaces::msg::ParameterType::PARAMETER_BOOL_ARRAY)
 {
-  value_.bool_array_value = bool_array_value;
-  value_.type = rcl_interfaces::msg::ParameterType::PARAMETER_BOOL_ARRAY;
+  auto payload = make_payload(type_);
+  payload->bool_array_value = bool_array_value;
+  payload_ = std::move(payload);
 }
 
 ParameterValue::ParameterValue(const std::vector<int> & int_array_value)
+: type_(rcl_interfaces::msg::ParameterType::PARAMETER_INTEGER_ARRAY)
 {
-  value_.integer_array_value.assign(int_array_value.cbegin(), int_array_value.cend());
-  value_.type = rcl_interfaces::msg::ParameterType::PARAMETER_INTEGER_ARRAY;
+  auto payload = make_payload(type_);
+  payload->integer_array_value.assign(int_array_value.cbegin(), int_array_value.cend());
+  payload_ = std::move(payload);
 }
 
 ParameterValue::ParameterValue(const std::vector<int64_t> & int_array_value)
+: type_(rcl_interfaces::msg::ParameterType::PARAMETER_INTEGER_ARRAY)
 {
-  value_.integer_array_value = int_array_value;
-  value_.type = rcl_interfaces::msg::ParameterType::PARAMETER_INTEGER_ARRAY;
+  auto payload = make_payload(type_);
+  payload->integer_array_value = int_array_value;
+  payload_ = std::move(payload);
 }
 
 ParameterValue::ParameterValue(const std::vector<float> & float_array_value)
+: type_(rcl_interfaces::msg::ParameterType::PARAMETER_DOUBLE_ARRAY)
 {
-  value_.double_array_value.assign(float_array_value.cbegin(), float_array_value.cend());
-  value_.type = rcl_interfaces::msg::ParameterType::PARAMETER_DOUBLE_ARRAY;
+  auto payload = make_payload(type_);
+  payload->double_array_value.assign(float_array_value.cbegin(), float_array_value.cend());
+  payload_ = std::move(payload);
 }
 
 ParameterValue::ParameterValue(const std::vector<double> & double_array_value)
+: type_(rcl_interfaces::msg::ParameterType::PARAMETER_DOUBLE_ARRAY)
 {
-  value_.double_array_value = double_array_value;
-  value_.type = rcl_interfaces::msg::ParameterType::PARAMETER_DOUBLE_ARRAY;
+  auto payload = make_payload(type_);
+  payload->double_array_value = double_array_value;
+  payload_ = std::move(payload);
 }
 
 ParameterValue::ParameterValue(const std::vector<std::string> & string_array_value)
+: type_(rcl_interfaces::msg::ParameterType::PARAMETER_STRING_ARRAY)
 {
-  value_.string_array_value = string_array_value;
-  value_.type = rcl_interfaces::msg::ParameterType::PARAMETER_STRING_ARRAY;
+  auto payload = make_payload(type_);
+  payload->string_array_value = string_array_value;
+  payload_ = std::move(payload);
 }
 
 ParameterType
 ParameterValue::get_type() const
 {
-  return static_cast<ParameterType>(value_.type);
+  return static_cast<ParameterType>(type_);
 }
 
 rcl_interfaces::msg::ParameterValue
 ParameterValue::to_value_msg() const
 {
-  return value_;
+  if (payload_) {
+    return *payload_;
+  }
+  rcl_interfaces::msg::ParameterValue value;
+  value.type = type_;
+  switch (type_) {
+    case PARAMETER_BOOL:
+      value.bool_value = bool_value_;
+      break;
+    case PARAMETER_INTEGER:
+      value.integer_value = integer_value_;
+      break;
+    case PARAMETER_DOUBLE:
+      value.double_value = double_value_;
+      break;
+    default:
+      break;
+  }
+  return value;
 }
 
 bool
 ParameterValue::operator==(const ParameterValue & rhs) const
 {
-  return this->value_ == rhs.value_;
+  if (type_ != rhs.type_) {
+    return false;
+  }
+  switch (type_) {
+    case PARAMETER_NOT_SET:
+      return true;
+    case PARAMETER_BOOL:
+      return bool_value_ == rhs.bool_value_;
+    case PARAMETER_INTEGER:
+      return integer_value_ == rhs.integer_value_;
+    case PARAMETER_DOUBLE:
+      return double_value_ == rhs.double_value_;
+    default:
+      // Values sharing one payload are equal without inspecting it.
+      return payload_ == rhs.payload_ || *payload_ == *rhs.payload_;
+  }
 }
 
 bool
 ParameterValue::operator!=(const ParameterValue & rhs) const
 {
-  return this->value_ != rhs.value_;
+  return !(*this == rhs);
 }
@@ -17,12 +17,17 @@
 #include <rmw/error_handling.h>
 #include <rmw/rmw.h>
 
+#include <chrono>
+#include <condition_variable>
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "rcutils/logging_macros.h"
@@ -30,9 +35,11 @@
 
 #include "rclcpp/allocator/allocator_common.hpp"
 #include "rclcpp/allocator/allocator_deleter.hpp"
+#include "rclcpp/context.hpp"
 #include "rclcpp/exceptions.hpp"
 #include "rclcpp/expand_topic_or_service_name.hpp"
 #include "rclcpp/experimental/intra_process_manager.hpp"
+#include "rclcpp/introspection.hpp"
 #include "rclcpp/logging.hpp"
 #include "rclcpp/macros.hpp"
 #include "rclcpp/network_flow_endpoint.hpp"
@@ -41,6 +48,139 @@
 
 using rclcpp::PublisherBase;
 
+namespace
+{
+
+/// Shared poller completing asynchronous wait_for_all_acked requests for every publisher.
+/**
+ * The middleware offers no acknowledgment-complete event, so completion is detected by
+ * polling rcl_publisher_wait_for_all_acked with a zero timeout.
+ * One lazily started thread services all pending waits in the process, which keeps the
+ * cost independent of the number of publishers with waits in flight.
+ */
+class AckWaiterPool
+{
+public:
+  static AckWaiterPool &
+  instance()
+  {
+    static AckWaiterPool pool;
+    return pool;
+  }
+
+  void
+  add(
+    std::shared_ptr<const rcl_publisher_t> publisher_handle,
+    std::chrono::nanoseconds timeout,
+    std::function<void(bool)> callback)
+  {
+    Waiter waiter;
+    waiter.publisher_handle = std::move(publisher_handle);
+    if (timeout < std::chrono::nanoseconds::zero()) {
+      waiter.deadline = std::chrono::steady_clock::time_point::max();
+    } else {
+      waiter.deadline = std::chrono::steady_clock::now() + timeout;
+    }
+    waiter.callback = std::move(callback);
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      waiters_.push_back(std::move(waiter));
+      if (!thread_.joinable()) {
+        thread_ = std::thread(&AckWaiterPool::run, this);
+      }
+    }
+    cv_.notify_one();
+  }
+
+private:
+  struct Waiter
+  {
+    std::shared_ptr<const rcl_publisher_t> publisher_handle;
+    std::chrono::steady_clock::time_point deadline;
+    std::function<void(bool)> callback;
+  };
+
+  AckWaiterPool() = default;
+
+  ~AckWaiterPool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      shutdown_ = true;
+    }
+    cv_.notify_one();
+    if (thread_.joinable()) {
+      thread_.join();
+    }
+    // Any wait still pending at shutdown is reported as timed out.
+    for (auto & waiter : waiters_) {
+      waiter.callback(false);
+    }
+  }
+
+  void
+  run()
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!shutdown_) {
+      if (waiters_.empty()) {
+        cv_.wait(lock, [this]() {return shutdown_ || !waiters_.empty();});
+        continue;
+      }
+
+      std::vector<std::function<void(bool)>> completed_callbacks;
+      std::vector<bool> completed_results;
+      auto now = std::chrono::steady_clock::now();
+      for (auto it = waiters_.begin(); it != waiters_.end(); ) {
+        rcl_ret_t ret = rcl_publisher_wait_for_all_acked(it->publisher_handle.get(), 0);
+        bool done = false;
+        bool acked = false;
+        if (RCL_RET_OK == ret) {
+          done = true;
+          acked = true;
+        } else if (RCL_RET_TIMEOUT == ret) {
+          done = now >= it->deadline;
+        } else {
+          // Surfacing the error through the callback keeps the poller alive; log and
+          // report the wait as not acknowledged.
+          RCUTILS_LOG_ERROR_NAMED(
+            "rclcpp", "failed to poll for acknowledgments: %s", rcl_get_error_string().str);
+          rcl_reset_error();
+          done = true;
+        }
+        if (done) {
+          completed_callbacks.push_back(std::move(it->callback));
+          completed_results.push_back(acked);
+          it = waiters_.erase(it);
+        } else {
+          ++it;
+        }
+      }
+
+      if (!completed_callbacks.empty()) {
+        // Invoke user callbacks without holding the lock so they may register new waits.
+        lock.unlock();
+        for (size_t i = 0; i < completed_callbacks.size(); ++i) {
+          completed_callbacks[i](completed_results[i]);
+        }
+        lock.lock();
+        continue;
+      }
+
+      cv_.wait_for(lock, std::chrono::milliseconds(1));
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::thread thread_;
+  std::vector<Waiter> waiters_;
+  bool shutdown_ {false};
+};
+
+}  // namespace
+
 PublisherBase::PublisherBase(
   rclcpp::node_interfaces::NodeBaseInterface * node_base,
   const std::string & topic,
@@ -49,6 +189,7 @@ PublisherBase::PublisherBase(
   const PublisherEventCallbacks & event_callbacks,
   bool use_default_callbacks)
 : rcl_node_handle_(node_base->get_shared_rcl_node_handle()),
+  weak_context_(node_base->get_context()),
   intra_process_is_enabled_(false),
   intra_process_publisher_id_(0),
   type_support_(type_support),
@@ -103,6 +244,14 @@ PublisherBase::PublisherBase(
   }
 
   bind_event_callbacks(event_callbacks_, use_default_callbacks);
+
+  // Intern the fully-qualified name and the rmw-resolved profile once; hot
+  // paths compare both by pointer.
+  interned_topic_name_ = rclcpp::TopicName(this->get_topic_name());
+  interned_actual_qos_ = rclcpp::InternedQoS(this->get_actual_qos());
+
+  introspection_counters_ = rclcpp::introspection::register_entity(
+    rclcpp::introspection::EntityKind::Publisher, this->get_topic_name());
 }
 
 PublisherBase::~PublisherBase()
@@ -110,6 +259,14 @@ PublisherBase::~PublisherBase()
   // must fini the events before fini-ing the publisher
   event_handlers_.clear();
 
+  if (auto context = weak_context_.lock()) {
+    if (context->is_deferred_finalization_active()) {
+      // Hand the rcl handle to the context's teardown thread; the deleter
+      // owns the node handle, so the node outlives the deferred fini.
+      context->defer_entity_finalization([handle = std::move(publisher_handle_)]() {});
+    }
+  }
+
   auto ipm = weak_ipm_.lock();
 
   if (!intra_process_is_enabled_) {
@@ -125,6 +282,18 @@ PublisherBase::~PublisherBase()
   ipm->remove_publisher(intra_process_publisher_id_);
 }
 
+const rclcpp::TopicName &
+PublisherBase::get_interned_topic_name() const
+{
+  return interned_topic_name_;
+}
+
+const rclcpp::InternedQoS &
+PublisherBase::get_interned_actual_qos() const
+{
+  return interned_actual_qos_;
+}
+
 const char *
 PublisherBase::get_topic_name() const
 {
@@ -283,6 +452,44 @@ PublisherBase::get_actual_qos() const
   return rclcpp::QoS(rclcpp::QoSInitialization::from_rmw(*qos), *qos);
 }
 
+std::shared_ptr<rclcpp::introspection::EntityCounters>
+PublisherBase::get_introspection_counters() const
+{
+  return introspection_counters_;
+}
+
+void
+PublisherBase::set_origin_timestamp(rmw_time_point_value_t origin_timestamp)
+{
+  origin_timestamp_.store(origin_timestamp, std::memory_order_relaxed);
+}
+
+rmw_time_point_value_t
+PublisherBase::get_origin_timestamp() const
+{
+  return origin_timestamp_.load(std::memory_order_relaxed);
+}
+
+void
+PublisherBase::count_publish_latency()
+{
+  if (0 == origin_timestamp_.load(std::memory_order_relaxed)) {
+    return;
+  }
+  const rmw_time_point_value_t origin = origin_timestamp_.exchange(0, std::memory_order_relaxed);
+  if (0 == origin) {
+    return;
+  }
+  // The rmw timestamps are system clock nanoseconds, so the origin is
+  // compared against the same clock here.
+  const rmw_time_point_value_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::system_clock::now().time_since_epoch()).count();
+  if (now > origin) {
+    rclcpp::introspection::record_latency(
+      *introspection_counters_, static_cast<uint64_t>(now - origin));
+  }
+}
+
 bool
 PublisherBase::assert_liveliness() const
 {
@@ -385,6 +592,26 @@ std::vector<rclcpp::NetworkFlowEndpoint> PublisherBase::get_network_flow_endpoin
   return network_flow_endpoint_vector;
 }
 
+std::shared_ptr<const std::vector<rclcpp::NetworkFlowEndpoint>>
+PublisherBase::get_network_flow_endpoints_view() const
+{
+  // The endpoints this publisher sends on can only change when the set of
+  // matched subscriptions changes, so use the matched count as a cheap,
+  // allocation-free freshness probe.
+  const size_t matched_count = this->get_subscription_count();
+  std::lock_guard<std::mutex> lock(network_flow_endpoints_mutex_);
+  if (network_flow_endpoints_cache_ &&
+    matched_count == network_flow_endpoints_matched_count_)
+  {
+    return network_flow_endpoints_cache_;
+  }
+  network_flow_endpoints_cache_ =
+    std::make_shared<const std::vector<rclcpp::NetworkFlowEndpoint>>(
+    this->get_network_flow_endpoints());
+  network_flow_endpoints_matched_count_ = matched_count;
+  return network_flow_endpoints_cache_;
+}
+
 size_t PublisherBase::lowest_available_ipm_capacity() const
 {
   if (!intra_process_is_enabled_) {
@@ -403,3 +630,77 @@ size_t PublisherBase::lowest_available_ipm_capacity() const
 
   return ipm->lowest_available_capacity(intra_process_publisher_id_);
 }
+
+bool
+PublisherBase::ipm_buffers_have_capacity() const
+{
+  if (!intra_process_is_enabled_) {
+    return true;
+  }
+
+  auto ipm = weak_ipm_.lock();
+
+  if (!ipm) {
+    RCLCPP_WARN(
+      rclcpp::get_logger("rclcpp"),
+      "Intra process manager died for a publisher.");
+    return true;
+  }
+
+  if (0u == ipm->get_subscription_count(intra_process_publisher_id_)) {
+    // Nothing matched, nothing to overwrite.
+    return true;
+  }
+
+  return ipm->lowest_available_capacity(intra_process_publisher_id_) > 0u;
+}
+
+void
+PublisherBase::set_backpressure_callback(
+  size_t low_capacity_threshold, std::function<void (size_t)> callback)
+{
+  std::lock_guard<std::mutex> lock(backpressure_mutex_);
+  backpressure_threshold_ = low_capacity_threshold;
+  backpressure_callback_ = std::move(callback);
+  backpressure_callback_set_.store(nullptr != backpressure_callback_, std::memory_order_release);
+}
+
+void
+PublisherBase::check_backpressure()
+{
+  if (!backpressure_callback_set_.load(std::memory_order_relaxed)) {
+    return;
+  }
+
+  auto ipm = weak_ipm_.lock();
+  if (!ipm || 0u == ipm->get_subscription_count(intra_process_publisher_id_)) {
+    return;
+  }
+  const size_t capacity = ipm->lowest_available_capacity(intra_process_publisher_id_);
+
+  std::function<void (size_t)> callback;
+  {
+    std::lock_guard<std::mutex> lock(backpressure_mutex_);
+    if (!backpressure_callback_ || capacity > backpressure_threshold_) {
+      return;
+    }
+    callback = backpressure_callback_;
+  }
+  // Invoked outside the lock so the callback may re-register itself.
+  callback(capacity);
+}
+
+void
+PublisherBase::async_wait_for_all_acked(
+  std::chrono::nanoseconds timeout,
+  std::function<void(bool)> callback) const
+{
+  if (!callback) {
+    throw std::invalid_argument(
+            "The callback passed to async_wait_for_all_acked is not callable.");
+  }
+
+  // The shared handle keeps the rcl publisher alive until the wait has completed, even if
+  // this PublisherBase is destroyed in the meantime.
+  AckWaiterPool::instance().add(publisher_handle_, timeout, std::move(callback));
+}
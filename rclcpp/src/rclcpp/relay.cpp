@@ -0,0 +1,44 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/relay.hpp"
+
+#include <chrono>
+#include <memory>
+
+namespace rclcpp
+{
+
+void
+Relay::handle_serialized_message(
+  const std::shared_ptr<rclcpp::SerializedMessage> & serialized_message,
+  const rclcpp::MessageInfo & message_info)
+{
+  const auto callback_start = std::chrono::steady_clock::now();
+  if (!filter_ || filter_(message_info)) {
+    // Preserve the entry time of the message across this hop, so the output
+    // publisher records accumulated pipeline latency rather than zero.
+    publisher_->set_origin_timestamp(message_info.get_origin_timestamp());
+    publisher_->publish(*serialized_message);
+  }
+  this->count_callback_executed(callback_start);
+}
+
+rclcpp::GenericPublisher::SharedPtr
+Relay::get_publisher() const
+{
+  return publisher_;
+}
+
+}  // namespace rclcpp
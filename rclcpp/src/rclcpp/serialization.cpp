@@ -19,6 +19,7 @@
 
 #include "rclcpp/exceptions.hpp"
 #include "rclcpp/serialized_message.hpp"
+#include "rclcpp/serialized_message_pool.hpp"
 
 #include "rcpputils/asserts.hpp"
 
@@ -27,6 +28,50 @@
 namespace rclcpp
 {
 
+SerializationBackendRegistry &
+SerializationBackendRegistry::instance()
+{
+  static SerializationBackendRegistry registry;
+  return registry;
+}
+
+void
+SerializationBackendRegistry::register_backend(
+  const rosidl_message_type_support_t * type_support,
+  SerializationBackend backend)
+{
+  rcpputils::check_true(nullptr != type_support, "Typesupport is nullpointer.");
+  if (!backend.serialize || !backend.deserialize) {
+    throw std::invalid_argument("serialization backend functions must be callable");
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  backends_[type_support] =
+    std::make_shared<const SerializationBackend>(std::move(backend));
+  ever_registered_.store(true, std::memory_order_release);
+}
+
+void
+SerializationBackendRegistry::unregister_backend(
+  const rosidl_message_type_support_t * type_support)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  backends_.erase(type_support);
+  // ever_registered_ stays set; an empty map lookup is still cheap and this
+  // keeps the flag monotonic so no release/acquire dance is needed.
+}
+
+std::shared_ptr<const SerializationBackend>
+SerializationBackendRegistry::get_backend(
+  const rosidl_message_type_support_t * type_support) const
+{
+  if (!ever_registered_.load(std::memory_order_acquire)) {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = backends_.find(type_support);
+  return it != backends_.end() ? it->second : nullptr;
+}
+
 SerializationBase::SerializationBase(const rosidl_message_type_support_t * type_support)
 : type_support_(type_support)
 {
@@ -40,6 +85,20 @@ void SerializationBase::serialize_message(
   rcpputils::check_true(nullptr != ros_message, "ROS message is nullpointer.");
   rcpputils::check_true(nullptr != serialized_message, "Serialized message is nullpointer.");
 
+  // Growing from a (near) empty buffer makes the serializer crawl upward through
+  // repeated reallocations.  Capacity up to the inline buffer is free of heap
+  // traffic, so start there; larger messages grow from that in one or two steps.
+  if (serialized_message->capacity() < SerializedMessage::kInlineBufferCapacity) {
+    serialized_message->reserve(SerializedMessage::kInlineBufferCapacity);
+  }
+
+  auto backend = SerializationBackendRegistry::instance().get_backend(type_support_);
+  if (backend &&
+    backend->serialize(ros_message, &serialized_message->get_rcl_serialized_message()))
+  {
+    return;
+  }
+  // No backend, or the backend declined this message; use the generic path.
   const auto ret = rmw_serialize(
     ros_message,
     type_support_,
@@ -49,6 +108,14 @@ void SerializationBase::serialize_message(
   }
 }
 
+std::shared_ptr<SerializedMessage> SerializationBase::serialize_message(
+  const void * ros_message, SerializedMessagePool & pool) const
+{
+  auto serialized_message = pool.acquire();
+  serialize_message(ros_message, serialized_message.get());
+  return serialized_message;
+}
+
 void SerializationBase::deserialize_message(
   const SerializedMessage * serialized_message, void * ros_message) const
 {
@@ -62,6 +129,13 @@ void SerializationBase::deserialize_message(
     "Wrongly initialized. Serialized message has a size of zero.");
   rcpputils::check_true(nullptr != ros_message, "ROS message is a nullpointer.");
 
+  auto backend = SerializationBackendRegistry::instance().get_backend(type_support_);
+  if (backend &&
+    backend->deserialize(&serialized_message->get_rcl_serialized_message(), ros_message))
+  {
+    return;
+  }
+  // No backend, or the backend declined this message; use the generic path.
   const auto ret = rmw_deserialize(
     &serialized_message->get_rcl_serialized_message(), type_support_, ros_message);
   if (ret != RMW_RET_OK) {
@@ -15,6 +15,8 @@
 #include "rclcpp/serialized_message.hpp"
 
 #include <cstring>
+#include <new>
+#include <utility>
 
 #include "rclcpp/exceptions.hpp"
 #include "rclcpp/logging.hpp"
@@ -24,19 +26,115 @@
 namespace rclcpp
 {
 
-inline void copy_rcl_message(const rcl_serialized_message_t & from, rcl_serialized_message_t & to)
+void * SerializedMessage::inline_buffer_allocate(size_t size, void * state)
 {
-  const auto ret = rmw_serialized_message_init(
-    &to, from.buffer_capacity, &from.allocator);
-  if (RCL_RET_OK != ret) {
-    rclcpp::exceptions::throw_from_rcl_error(ret);
+  auto * storage = static_cast<InlineStorage *>(state);
+  return storage->base_allocator.allocate(size, storage->base_allocator.state);
+}
+
+void SerializedMessage::inline_buffer_deallocate(void * pointer, void * state)
+{
+  auto * storage = static_cast<InlineStorage *>(state);
+  if (pointer == storage->buffer) {
+    // The inline buffer lives and dies with the SerializedMessage.
+    return;
+  }
+  storage->base_allocator.deallocate(pointer, storage->base_allocator.state);
+}
+
+void * SerializedMessage::inline_buffer_reallocate(void * pointer, size_t size, void * state)
+{
+  auto * storage = static_cast<InlineStorage *>(state);
+  if (pointer == storage->buffer) {
+    if (size <= kInlineBufferCapacity) {
+      return pointer;
+    }
+    // Outgrew the inline buffer, migrate the content to the heap.
+    void * grown = storage->base_allocator.allocate(size, storage->base_allocator.state);
+    if (nullptr != grown) {
+      std::memcpy(grown, pointer, kInlineBufferCapacity);
+    }
+    return grown;
+  }
+  return storage->base_allocator.reallocate(pointer, size, storage->base_allocator.state);
+}
+
+void * SerializedMessage::inline_buffer_zero_allocate(
+  size_t number_of_elements, size_t size_of_element, void * state)
+{
+  auto * storage = static_cast<InlineStorage *>(state);
+  return storage->base_allocator.zero_allocate(
+    number_of_elements, size_of_element, storage->base_allocator.state);
+}
+
+const rcl_allocator_t &
+SerializedMessage::base_allocator_of(const rcl_serialized_message_t & message)
+{
+  if (&SerializedMessage::inline_buffer_deallocate == message.allocator.deallocate &&
+    nullptr != message.allocator.state)
+  {
+    return static_cast<const InlineStorage *>(message.allocator.state)->base_allocator;
+  }
+  return message.allocator;
+}
+
+rcl_allocator_t SerializedMessage::make_inline_allocator()
+{
+  rcl_allocator_t allocator = rcutils_get_zero_initialized_allocator();
+  allocator.allocate = &SerializedMessage::inline_buffer_allocate;
+  allocator.deallocate = &SerializedMessage::inline_buffer_deallocate;
+  allocator.reallocate = &SerializedMessage::inline_buffer_reallocate;
+  allocator.zero_allocate = &SerializedMessage::inline_buffer_zero_allocate;
+  allocator.state = &inline_storage_;
+  return allocator;
+}
+
+bool SerializedMessage::buffer_is_inline() const
+{
+  return serialized_message_.buffer == inline_storage_.buffer;
+}
+
+void SerializedMessage::init_storage(size_t capacity, const rcl_allocator_t & base_allocator)
+{
+  inline_storage_.base_allocator = base_allocator;
+  serialized_message_ = rmw_get_zero_initialized_serialized_message();
+  if (capacity <= kInlineBufferCapacity && rcutils_allocator_is_valid(&base_allocator)) {
+    serialized_message_.buffer = inline_storage_.buffer;
+    serialized_message_.buffer_capacity = capacity;
+  } else {
+    const auto ret = rmw_serialized_message_init(
+      &serialized_message_, capacity, &base_allocator);
+    if (RCL_RET_OK != ret) {
+      rclcpp::exceptions::throw_from_rcl_error(ret);
+    }
   }
+  serialized_message_.allocator = make_inline_allocator();
+}
 
+void SerializedMessage::init_from(const rcl_serialized_message_t & other)
+{
+  init_storage(other.buffer_capacity, base_allocator_of(other));
   // do not call memcpy if the pointer is "static"
-  if (to.buffer != from.buffer) {
-    std::memcpy(to.buffer, from.buffer, from.buffer_length);
+  if (serialized_message_.buffer != other.buffer && other.buffer_length > 0u) {
+    std::memcpy(serialized_message_.buffer, other.buffer, other.buffer_length);
   }
-  to.buffer_length = from.buffer_length;
+  serialized_message_.buffer_length = other.buffer_length;
+}
+
+void SerializedMessage::adopt_inline_storage(const InlineStorage & source)
+{
+  if (&source != serialized_message_.allocator.state) {
+    // Not set up by a SerializedMessage (e.g. adopted from a plain
+    // rcl_serialized_message_t), nothing refers back to the peer.
+    return;
+  }
+  inline_storage_.base_allocator = source.base_allocator;
+  if (serialized_message_.buffer == source.buffer) {
+    // Inline capacity never exceeds kInlineBufferCapacity, see inline_buffer_reallocate().
+    std::memcpy(inline_storage_.buffer, source.buffer, serialized_message_.buffer_capacity);
+    serialized_message_.buffer = inline_storage_.buffer;
+  }
+  serialized_message_.allocator.state = &inline_storage_;
 }
 
 /// Object oriented version of rcl_serialized_message_t with destructor to avoid memory leaks
@@ -46,13 +144,8 @@ SerializedMessage::SerializedMessage(const rcl_allocator_t & allocator)
 
 SerializedMessage::SerializedMessage(
   size_t initial_capacity, const rcl_allocator_t & allocator)
-: serialized_message_(rmw_get_zero_initialized_serialized_message())
 {
-  const auto ret = rmw_serialized_message_init(
-    &serialized_message_, initial_capacity, &allocator);
-  if (RCL_RET_OK != ret) {
-    rclcpp::exceptions::throw_from_rcl_error(ret);
-  }
+  init_storage(initial_capacity, allocator);
 }
 
 SerializedMessage::SerializedMessage(const SerializedMessage & other)
@@ -60,15 +153,16 @@ SerializedMessage::SerializedMessage(const SerializedMessage & other)
 {}
 
 SerializedMessage::SerializedMessage(const rcl_serialized_message_t & other)
-: serialized_message_(rmw_get_zero_initialized_serialized_message())
 {
-  copy_rcl_message(other, serialized_message_);
+  init_from(other);
 }
 
 SerializedMessage::SerializedMessage(SerializedMessage && other)
 : serialized_message_(
     std::exchange(other.serialized_message_, rmw_get_zero_initialized_serialized_message()))
-{}
+{
+  adopt_inline_storage(other.inline_storage_);
+}
 
 SerializedMessage::SerializedMessage(rcl_serialized_message_t && other)
 : serialized_message_(
@@ -78,8 +172,7 @@ SerializedMessage::SerializedMessage(rcl_serialized_message_t && other)
 SerializedMessage & SerializedMessage::operator=(const SerializedMessage & other)
 {
   if (this != &other) {
-    serialized_message_ = rmw_get_zero_initialized_serialized_message();
-    copy_rcl_message(other.serialized_message_, serialized_message_);
+    init_from(other.serialized_message_);
   }
 
   return *this;
@@ -88,8 +181,7 @@ SerializedMessage & SerializedMessage::operator=(const SerializedMessage & other
 SerializedMessage & SerializedMessage::operator=(const rcl_serialized_message_t & other)
 {
   if (&serialized_message_ != &other) {
-    serialized_message_ = rmw_get_zero_initialized_serialized_message();
-    copy_rcl_message(other, serialized_message_);
+    init_from(other);
   }
 
   return *this;
@@ -100,6 +192,7 @@ SerializedMessage & SerializedMessage::operator=(SerializedMessage && other)
   if (this != &other) {
     serialized_message_ =
       std::exchange(other.serialized_message_, rmw_get_zero_initialized_serialized_message());
+    adopt_inline_storage(other.inline_storage_);
   }
 
   return *this;
@@ -156,7 +249,30 @@ void SerializedMessage::reserve(size_t capacity)
 
 rcl_serialized_message_t SerializedMessage::release_rcl_serialized_message()
 {
+  if (buffer_is_inline()) {
+    // The inline buffer cannot leave this object, copy the content out.
+    rcl_serialized_message_t released = rmw_get_zero_initialized_serialized_message();
+    released.allocator = inline_storage_.base_allocator;
+    if (serialized_message_.buffer_capacity > 0u) {
+      released.buffer = static_cast<uint8_t *>(
+        released.allocator.allocate(
+          serialized_message_.buffer_capacity, released.allocator.state));
+      if (nullptr == released.buffer) {
+        throw std::bad_alloc();
+      }
+      std::memcpy(released.buffer, serialized_message_.buffer, serialized_message_.buffer_length);
+      released.buffer_capacity = serialized_message_.buffer_capacity;
+      released.buffer_length = serialized_message_.buffer_length;
+    }
+    serialized_message_ = rmw_get_zero_initialized_serialized_message();
+    return released;
+  }
+
   auto ret = serialized_message_;
+  if (&inline_storage_ == ret.allocator.state) {
+    // Hand out the user-facing allocator so the handle no longer refers to this object.
+    ret.allocator = inline_storage_.base_allocator;
+  }
   serialized_message_ = rmw_get_zero_initialized_serialized_message();
 
   return ret;
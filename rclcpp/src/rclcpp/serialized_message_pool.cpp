@@ -0,0 +1,112 @@
+// Copyright 2024 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/serialized_message_pool.hpp"
+
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace rclcpp
+{
+
+SerializedMessagePool::SerializedMessagePool(size_t high_watermark)
+: state_(std::make_shared<State>())
+{
+  state_->high_watermark = high_watermark;
+}
+
+size_t SerializedMessagePool::size_class_index(size_t capacity)
+{
+  size_t class_index = 0;
+  size_t class_capacity = kMinClassCapacity;
+  while (class_capacity < capacity && class_index < kNumClasses - 1) {
+    class_capacity <<= 1;
+    class_index++;
+  }
+  return class_index;
+}
+
+size_t SerializedMessagePool::size_class_capacity(size_t class_index)
+{
+  return kMinClassCapacity << class_index;
+}
+
+std::shared_ptr<SerializedMessage> SerializedMessagePool::acquire(size_t capacity_hint)
+{
+  const size_t class_index = size_class_index(capacity_hint);
+
+  std::unique_ptr<SerializedMessage> message;
+  {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    auto & pooled = state_->classes[class_index];
+    if (!pooled.empty()) {
+      message = std::move(pooled.back());
+      pooled.pop_back();
+    }
+  }
+  if (!message) {
+    // Allocate at the class capacity, so the buffer lands back in the same
+    // class when released, unless the serializer had to grow it.
+    message = std::make_unique<SerializedMessage>(size_class_capacity(class_index));
+  }
+  message->get_rcl_serialized_message().buffer_length = 0u;
+
+  std::weak_ptr<State> weak_state = state_;
+  return std::shared_ptr<SerializedMessage>(
+    message.release(),
+    [weak_state](SerializedMessage * released) {
+      std::unique_ptr<SerializedMessage> returned(released);
+      auto state = weak_state.lock();
+      if (!state) {
+        // The pool is gone, let the buffer be freed.
+        return;
+      }
+      // Key by the capacity the buffer has grown to, not the class it was
+      // handed out from, so repeatedly grown buffers migrate upwards.
+      std::lock_guard<std::mutex> lock(state->mutex);
+      auto & pooled = state->classes[size_class_index(returned->capacity())];
+      if (pooled.size() < state->high_watermark) {
+        pooled.push_back(std::move(returned));
+      }
+    });
+}
+
+void SerializedMessagePool::reserve(size_t count, size_t capacity)
+{
+  const size_t class_index = size_class_index(capacity);
+  std::lock_guard<std::mutex> lock(state_->mutex);
+  auto & pooled = state_->classes[class_index];
+  while (pooled.size() < count && pooled.size() < state_->high_watermark) {
+    pooled.push_back(std::make_unique<SerializedMessage>(size_class_capacity(class_index)));
+  }
+}
+
+size_t SerializedMessagePool::available() const
+{
+  std::lock_guard<std::mutex> lock(state_->mutex);
+  size_t total = 0;
+  for (const auto & pooled : state_->classes) {
+    total += pooled.size();
+  }
+  return total;
+}
+
+size_t SerializedMessagePool::get_high_watermark() const
+{
+  std::lock_guard<std::mutex> lock(state_->mutex);
+  return state_->high_watermark;
+}
+
+}  // namespace rclcpp
@@ -0,0 +1,79 @@
+// Copyright 2024 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/serialized_message_view.hpp"
+
+#include <memory>
+#include <utility>
+
+namespace rclcpp
+{
+
+SerializedMessageView::SerializedMessageView(
+  std::shared_ptr<rclcpp::SerializedMessage> message,
+  ReturnCallbackT return_callback)
+: message_(std::move(message)),
+  return_callback_(std::move(return_callback))
+{}
+
+SerializedMessageView::SerializedMessageView(SerializedMessageView && other) noexcept
+: message_(std::move(other.message_)),
+  return_callback_(std::move(other.return_callback_))
+{
+  other.message_.reset();
+  other.return_callback_ = nullptr;
+}
+
+SerializedMessageView & SerializedMessageView::operator=(SerializedMessageView && other) noexcept
+{
+  if (this != &other) {
+    if (message_ && return_callback_) {
+      return_callback_(std::move(message_));
+    }
+    message_ = std::move(other.message_);
+    return_callback_ = std::move(other.return_callback_);
+    other.message_.reset();
+    other.return_callback_ = nullptr;
+  }
+  return *this;
+}
+
+SerializedMessageView::~SerializedMessageView()
+{
+  if (message_ && return_callback_) {
+    return_callback_(std::move(message_));
+  }
+}
+
+const rcl_serialized_message_t & SerializedMessageView::get_rcl_serialized_message() const
+{
+  return message_->get_rcl_serialized_message();
+}
+
+const uint8_t * SerializedMessageView::data() const
+{
+  return message_->get_rcl_serialized_message().buffer;
+}
+
+size_t SerializedMessageView::size() const
+{
+  return message_->size();
+}
+
+rclcpp::SerializedMessage SerializedMessageView::to_serialized_message() const
+{
+  return rclcpp::SerializedMessage(*message_);
+}
+
+}  // namespace rclcpp
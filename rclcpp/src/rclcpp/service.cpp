@@ -14,6 +14,7 @@
 
 #include "rclcpp/service.hpp"
 
+#include <chrono>
 #include <functional>
 #include <iostream>
 #include <memory>
@@ -21,6 +22,7 @@
 #include <string>
 
 #include "rclcpp/any_service_callback.hpp"
+#include "rclcpp/experimental/intra_process_manager.hpp"
 #include "rclcpp/macros.hpp"
 #include "rclcpp/qos.hpp"
 #include "rmw/error_handling.h"
@@ -33,6 +35,36 @@ ServiceBase::ServiceBase(std::shared_ptr<rcl_node_t> node_handle)
   node_logger_(rclcpp::get_node_logger(node_handle_.get()))
 {}
 
+ServiceBase::~ServiceBase()
+{
+  if (!use_intra_process_) {
+    return;
+  }
+  auto ipm = weak_ipm_.lock();
+  if (!ipm) {
+    RCLCPP_WARN(
+      rclcpp::get_logger("rclcpp"),
+      "Intra process manager died before than a service.");
+    return;
+  }
+  ipm->remove_service(intra_process_service_id_);
+}
+
+void
+ServiceBase::setup_intra_process(
+  uint64_t intra_process_service_id,
+  IntraProcessManagerWeakPtr weak_ipm)
+{
+  intra_process_service_id_ = intra_process_service_id;
+  weak_ipm_ = weak_ipm;
+  use_intra_process_ = true;
+}
+
+rclcpp::Waitable::SharedPtr
+ServiceBase::get_intra_process_waitable()
+{
+  return nullptr;
+}
 
 bool
 ServiceBase::take_type_erased_request(void * request_out, rmw_request_id_t & request_id_out)
@@ -55,6 +87,30 @@ ServiceBase::get_service_name()
   return rcl_service_get_service_name(this->get_service_handle().get());
 }
 
+std::shared_ptr<rclcpp::introspection::EntityCounters>
+ServiceBase::get_introspection_counters() const
+{
+  return introspection_counters_;
+}
+
+void
+ServiceBase::register_introspection_counters()
+{
+  introspection_counters_ = rclcpp::introspection::register_entity(
+    rclcpp::introspection::EntityKind::Service, this->get_service_name());
+}
+
+void
+ServiceBase::count_request_handled(std::chrono::steady_clock::time_point callback_start)
+{
+  const auto callback_duration = std::chrono::steady_clock::now() - callback_start;
+  introspection_counters_->messages.fetch_add(1, std::memory_order_relaxed);
+  introspection_counters_->callbacks.fetch_add(1, std::memory_order_relaxed);
+  introspection_counters_->callback_duration_ns.fetch_add(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(callback_duration).count(),
+    std::memory_order_relaxed);
+}
+
 std::shared_ptr<rcl_service_t>
 ServiceBase::get_service_handle()
 {
@@ -85,6 +141,18 @@ ServiceBase::exchange_in_use_by_wait_set_state(bool in_use_state)
   return in_use_by_wait_set_.exchange(in_use_state);
 }
 
+void
+ServiceBase::set_drain_requests_on_execute(bool drain)
+{
+  drain_requests_on_execute_.store(drain);
+}
+
+bool
+ServiceBase::drain_requests_on_execute() const
+{
+  return drain_requests_on_execute_.load();
+}
+
 rclcpp::QoS
 ServiceBase::get_response_publisher_actual_qos() const
 {
@@ -136,3 +204,9 @@ ServiceBase::set_on_new_request_callback(rcl_event_callback_t callback, const vo
       ret, "failed to set the on new request callback for service");
   }
 }
+
+void
+ServiceBase::set_callback_group_membership(std::shared_ptr<void> membership)
+{
+  callback_group_membership_ = membership;
+}
@@ -0,0 +1,346 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/shared_parameter_service.hpp"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "rclcpp/create_service.hpp"
+#include "rclcpp/exceptions.hpp"
+#include "rclcpp/logging.hpp"
+#include "rclcpp/parameter.hpp"
+
+#include "./parameter_service_names.hpp"
+
+using rclcpp::SharedParameterService;
+
+SharedParameterService &
+SharedParameterService::instance()
+{
+  static SharedParameterService shared_parameter_service;
+  return shared_parameter_service;
+}
+
+void
+SharedParameterService::register_node(
+  const std::shared_ptr<rclcpp::node_interfaces::NodeBaseInterface> node_base,
+  const std::shared_ptr<rclcpp::node_interfaces::NodeServicesInterface> node_services,
+  rclcpp::node_interfaces::NodeParametersInterface * node_params,
+  const rclcpp::QoS & qos_profile)
+{
+  if (!node_base || !node_services || nullptr == node_params) {
+    throw std::invalid_argument("node interfaces unexpectedly nullptr");
+  }
+  const std::string fully_qualified_name = node_base->get_fully_qualified_name();
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (entries_.count(fully_qualified_name) != 0) {
+    throw std::invalid_argument(
+            "node '" + fully_qualified_name + "' is already registered with the "
+            "shared parameter service");
+  }
+  Entry entry{node_base, node_services, node_params, qos_profile};
+  entries_.emplace(fully_qualified_name, entry);
+  if (host_name_.empty()) {
+    host_services(fully_qualified_name, entry);
+  }
+}
+
+void
+SharedParameterService::unregister_node(const std::string & fully_qualified_name)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (0 == entries_.erase(fully_qualified_name)) {
+    return;
+  }
+  if (fully_qualified_name != host_name_) {
+    return;
+  }
+  // The host is going away; tear its services down and re-host on any
+  // remaining registered node that is still alive.
+  get_parameters_service_.reset();
+  get_parameter_types_service_.reset();
+  set_parameters_service_.reset();
+  set_parameters_atomically_service_.reset();
+  describe_parameters_service_.reset();
+  list_parameters_service_.reset();
+  host_name_.clear();
+  for (const auto & kv : entries_) {
+    if (kv.second.node_base.lock() && kv.second.node_services.lock()) {
+      host_services(kv.first, kv.second);
+      break;
+    }
+  }
+}
+
+size_t
+SharedParameterService::registered_node_count() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return entries_.size();
+}
+
+std::pair<rclcpp::node_interfaces::NodeParametersInterface *, std::string>
+SharedParameterService::resolve(const std::string & name) const
+{
+  // Longest registered fully qualified name that prefixes the requested name
+  // wins; node names contain '/' while parameter names cannot, so a match is
+  // never ambiguous with a plain parameter name.
+  const std::map<std::string, Entry>::const_iterator end = entries_.end();
+  std::map<std::string, Entry>::const_iterator best = end;
+  for (auto it = entries_.begin(); it != end; ++it) {
+    const std::string & fqn = it->first;
+    if (name.size() > fqn.size() + 1 &&
+      0 == name.compare(0, fqn.size(), fqn) &&
+      '/' == name[fqn.size()] &&
+      (best == end || fqn.size() > best->first.size()))
+    {
+      best = it;
+    }
+  }
+  if (best != end) {
+    return {best->second.node_params, name.substr(best->first.size() + 1)};
+  }
+  // Unprefixed names address the hosting node's own parameters.
+  auto host_it = entries_.find(host_name_);
+  if (host_it == end) {
+    return {nullptr, name};
+  }
+  return {host_it->second.node_params, name};
+}
+
+void
+SharedParameterService::host_services(
+  const std::string & fully_qualified_name, const Entry & entry)
+{
+  auto node_base = entry.node_base.lock();
+  auto node_services = entry.node_services.lock();
+  if (!node_base || !node_services) {
+    return;
+  }
+  host_name_ = fully_qualified_name;
+  const std::string node_name = node_base->get_name();
+  const rclcpp::QoS & qos_profile = entry.qos_profile;
+
+  get_parameters_service_ = create_service<rcl_interfaces::srv::GetParameters>(
+    node_base, node_services,
+    node_name + "/" + parameter_service_names::get_parameters,
+    [this](
+      const std::shared_ptr<rmw_request_id_t>,
+      const std::shared_ptr<rcl_interfaces::srv::GetParameters::Request> request,
+      std::shared_ptr<rcl_interfaces::srv::GetParameters::Response> response)
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (const auto & name : request->names) {
+        auto resolved = resolve(name);
+        if (nullptr == resolved.first) {
+          continue;
+        }
+        try {
+          auto parameters = resolved.first->get_parameters({resolved.second});
+          for (const auto & param : parameters) {
+            response->values.push_back(param.get_value_message());
+          }
+        } catch (const rclcpp::exceptions::ParameterNotDeclaredException & ex) {
+          RCLCPP_DEBUG(rclcpp::get_logger("rclcpp"), "Failed to get parameters: %s", ex.what());
+        } catch (const rclcpp::exceptions::ParameterUninitializedException & ex) {
+          RCLCPP_DEBUG(rclcpp::get_logger("rclcpp"), "Failed to get parameters: %s", ex.what());
+        }
+      }
+    },
+    qos_profile, nullptr);
+
+  get_parameter_types_service_ = create_service<rcl_interfaces::srv::GetParameterTypes>(
+    node_base, node_services,
+    node_name + "/" + parameter_service_names::get_parameter_types,
+    [this](
+      const std::shared_ptr<rmw_request_id_t>,
+      const std::shared_ptr<rcl_interfaces::srv::GetParameterTypes::Request> request,
+      std::shared_ptr<rcl_interfaces::srv::GetParameterTypes::Response> response)
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (const auto & name : request->names) {
+        auto resolved = resolve(name);
+        if (nullptr == resolved.first) {
+          continue;
+        }
+        try {
+          auto types = resolved.first->get_parameter_types({resolved.second});
+          std::transform(
+            types.cbegin(), types.cend(),
+            std::back_inserter(response->types), [](const uint8_t & type) {
+              return static_cast<rclcpp::ParameterType>(type);
+            });
+        } catch (const rclcpp::exceptions::ParameterNotDeclaredException & ex) {
+          RCLCPP_DEBUG(
+            rclcpp::get_logger("rclcpp"), "Failed to get parameter types: %s", ex.what());
+        }
+      }
+    },
+    qos_profile, nullptr);
+
+  set_parameters_service_ = create_service<rcl_interfaces::srv::SetParameters>(
+    node_base, node_services,
+    node_name + "/" + parameter_service_names::set_parameters,
+    [this](
+      const std::shared_ptr<rmw_request_id_t>,
+      const std::shared_ptr<rcl_interfaces::srv::SetParameters::Request> request,
+      std::shared_ptr<rcl_interfaces::srv::SetParameters::Response> response)
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      // Set parameters one-by-one, since there's no way to return a partial result if
+      // set_parameters() fails.
+      for (auto & p : request->parameters) {
+        auto result = rcl_interfaces::msg::SetParametersResult();
+        auto resolved = resolve(p.name);
+        if (nullptr == resolved.first) {
+          result.successful = false;
+          result.reason = "no registered node matches parameter name '" + p.name + "'";
+          response->results.push_back(result);
+          continue;
+        }
+        try {
+          auto param = rclcpp::Parameter::from_parameter_msg(p);
+          result = resolved.first->set_parameters_atomically(
+            {rclcpp::Parameter(resolved.second, param.get_parameter_value())});
+        } catch (const rclcpp::exceptions::ParameterNotDeclaredException & ex) {
+          RCLCPP_DEBUG(rclcpp::get_logger("rclcpp"), "Failed to set parameter: %s", ex.what());
+          result.successful = false;
+          result.reason = ex.what();
+        }
+        response->results.push_back(result);
+      }
+    },
+    qos_profile, nullptr);
+
+  set_parameters_atomically_service_ = create_service<rcl_interfaces::srv::SetParametersAtomically>(
+    node_base, node_services,
+    node_name + "/" + parameter_service_names::set_parameters_atomically,
+    [this](
+      const std::shared_ptr<rmw_request_id_t>,
+      const std::shared_ptr<rcl_interfaces::srv::SetParametersAtomically::Request> request,
+      std::shared_ptr<rcl_interfaces::srv::SetParametersAtomically::Response> response)
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      // Atomicity is only available within a single node; requests spanning
+      // multiple registered nodes are rejected.
+      rclcpp::node_interfaces::NodeParametersInterface * target = nullptr;
+      std::vector<rclcpp::Parameter> pvariants;
+      for (const auto & p : request->parameters) {
+        auto resolved = resolve(p.name);
+        if (nullptr == resolved.first || (nullptr != target && resolved.first != target)) {
+          response->result.successful = false;
+          response->result.reason =
+            "parameters do not all resolve to a single registered node";
+          return;
+        }
+        target = resolved.first;
+        auto param = rclcpp::Parameter::from_parameter_msg(p);
+        pvariants.emplace_back(resolved.second, param.get_parameter_value());
+      }
+      if (nullptr == target) {
+        response->result.successful = false;
+        response->result.reason = "no parameters given";
+        return;
+      }
+      try {
+        response->result = target->set_parameters_atomically(pvariants);
+      } catch (const rclcpp::exceptions::ParameterNotDeclaredException & ex) {
+        RCLCPP_DEBUG(
+          rclcpp::get_logger("rclcpp"), "Failed to set parameters atomically: %s", ex.what());
+        response->result.successful = false;
+        response->result.reason = "One or more parameters were not declared before setting";
+      }
+    },
+    qos_profile, nullptr);
+
+  describe_parameters_service_ = create_service<rcl_interfaces::srv::DescribeParameters>(
+    node_base, node_services,
+    node_name + "/" + parameter_service_names::describe_parameters,
+    [this](
+      const std::shared_ptr<rmw_request_id_t>,
+      const std::shared_ptr<rcl_interfaces::srv::DescribeParameters::Request> request,
+      std::shared_ptr<rcl_interfaces::srv::DescribeParameters::Response> response)
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (const auto & name : request->names) {
+        auto resolved = resolve(name);
+        if (nullptr == resolved.first) {
+          continue;
+        }
+        try {
+          auto descriptors = resolved.first->describe_parameters({resolved.second});
+          for (auto & descriptor : descriptors) {
+            // Report the name as requested, so callers can correlate results.
+            descriptor.name = name;
+            response->descriptors.push_back(descriptor);
+          }
+        } catch (const rclcpp::exceptions::ParameterNotDeclaredException & ex) {
+          RCLCPP_DEBUG(
+            rclcpp::get_logger("rclcpp"), "Failed to describe parameters: %s", ex.what());
+        }
+      }
+    },
+    qos_profile, nullptr);
+
+  list_parameters_service_ = create_service<rcl_interfaces::srv::ListParameters>(
+    node_base, node_services,
+    node_name + "/" + parameter_service_names::list_parameters,
+    [this](
+      const std::shared_ptr<rmw_request_id_t>,
+      const std::shared_ptr<rcl_interfaces::srv::ListParameters::Request> request,
+      std::shared_ptr<rcl_interfaces::srv::ListParameters::Response> response)
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      // Aggregate the listing of every registered node, returning each name
+      // prefixed with the owning node's fully qualified name. A request
+      // prefix that names a node (or a subtree within it) restricts the
+      // listing accordingly.
+      for (const auto & kv : entries_) {
+        const std::string & fqn = kv.first;
+        std::vector<std::string> local_prefixes;
+        bool node_matches = request->prefixes.empty();
+        for (const auto & prefix : request->prefixes) {
+          if (prefix == fqn) {
+            node_matches = true;
+            local_prefixes.clear();
+            break;
+          }
+          if (prefix.size() > fqn.size() + 1 &&
+            0 == prefix.compare(0, fqn.size(), fqn) &&
+            '/' == prefix[fqn.size()])
+          {
+            node_matches = true;
+            local_prefixes.push_back(prefix.substr(fqn.size() + 1));
+          }
+        }
+        if (!node_matches) {
+          continue;
+        }
+        auto result = kv.second.node_params->list_parameters(local_prefixes, request->depth);
+        for (const auto & name : result.names) {
+          response->result.names.push_back(fqn + "/" + name);
+        }
+        for (const auto & prefix : result.prefixes) {
+          response->result.prefixes.push_back(fqn + "/" + prefix);
+        }
+      }
+    },
+    qos_profile, nullptr);
+}
@@ -20,11 +20,14 @@
 #include <string>
 #include <thread>
 
-// includes for semaphore notification code
+// includes for signal notification code
 #if defined(_WIN32)
 #include <windows.h>
 #elif defined(__APPLE__)
 #include <dispatch/dispatch.h>
+#elif defined(__linux__)
+#include <sys/eventfd.h>
+#include <unistd.h>
 #else  // posix
 #include <semaphore.h>
 #endif
@@ -120,6 +123,12 @@ SignalHandler::get_global_signal_handler()
 bool
 SignalHandler::install(SignalHandlerOptions signal_handler_options)
 {
+  // Fast path to avoid serializing concurrent installs (e.g. many contexts
+  // being initialized at once) on the install mutex; install_mutex_ below
+  // still arbitrates with a racing uninstall().
+  if (installed_.load()) {
+    return false;
+  }
   std::lock_guard<std::mutex> lock(install_mutex_);
   bool already_installed = installed_.exchange(true);
   if (already_installed) {
@@ -168,6 +177,10 @@ SignalHandler::install(SignalHandlerOptions signal_handler_options)
 bool
 SignalHandler::uninstall()
 {
+  // Fast path mirroring install(): already uninstalled means nothing to do.
+  if (!installed_.load()) {
+    return false;
+  }
   std::lock_guard<std::mutex> lock(install_mutex_);
   bool installed = installed_.exchange(false);
   if (!installed) {
@@ -298,6 +311,11 @@ SignalHandler::setup_wait_for_signal()
   }
 #elif defined(__APPLE__)
   signal_handler_sem_ = dispatch_semaphore_create(0);
+#elif defined(__linux__)
+  signal_handler_fd_ = eventfd(0, EFD_CLOEXEC);
+  if (-1 == signal_handler_fd_) {
+    throw std::runtime_error(std::string("eventfd() failed: ") + strerror(errno));
+  }
 #else  // posix
   if (-1 == sem_init(&signal_handler_sem_, 0, 0)) {
     throw std::runtime_error(std::string("sem_init() failed: ") + strerror(errno));
@@ -316,6 +334,11 @@ SignalHandler::teardown_wait_for_signal() noexcept
   CloseHandle(signal_handler_sem_);
 #elif defined(__APPLE__)
   dispatch_release(signal_handler_sem_);
+#elif defined(__linux__)
+  if (-1 == close(signal_handler_fd_)) {
+    RCLCPP_ERROR(get_logger(), "invalid eventfd in teardown_wait_for_signal()");
+  }
+  signal_handler_fd_ = -1;
 #else  // posix
   if (-1 == sem_destroy(&signal_handler_sem_)) {
     RCLCPP_ERROR(get_logger(), "invalid semaphore in teardown_wait_for_signal()");
@@ -355,6 +378,17 @@ SignalHandler::wait_for_signal()
   }
 #elif defined(__APPLE__)
   dispatch_semaphore_wait(signal_handler_sem_, DISPATCH_TIME_FOREVER);
+#elif defined(__linux__)
+  // The read drains the counter, so any number of notifications since the
+  // last wait (e.g. a burst of signals) results in exactly one wakeup.
+  uint64_t value;
+  ssize_t s;
+  do {
+    s = read(signal_handler_fd_, &value, sizeof(value));
+  } while (-1 == s && EINTR == errno);
+  if (-1 == s) {
+    RCLCPP_ERROR(get_logger(), "read() failed in wait_for_signal()");
+  }
 #else  // posix
   int s;
   do {
@@ -376,6 +410,13 @@ SignalHandler::notify_signal_handler() noexcept
   }
 #elif defined(__APPLE__)
   dispatch_semaphore_signal(signal_handler_sem_);
+#elif defined(__linux__)
+  // write() on an eventfd is async-signal safe and only increments the
+  // counter, so notifying from the signal handler never blocks.
+  const uint64_t value = 1;
+  if (-1 == write(signal_handler_fd_, &value, sizeof(value))) {
+    RCLCPP_ERROR(get_logger(), "write() failed in notify_signal_handler()");
+  }
 #else  // posix
   if (-1 == sem_post(&signal_handler_sem_)) {
     RCLCPP_ERROR(get_logger(), "sem_post failed in notify_signal_handler()");
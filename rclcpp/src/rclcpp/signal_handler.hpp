@@ -23,11 +23,13 @@
 #include "rclcpp/logging.hpp"
 #include "rclcpp/utilities.hpp"
 
-// includes for semaphore notification code
+// includes for signal notification code
 #if defined(_WIN32)
 #include <windows.h>
 #elif defined(__APPLE__)
 #include <dispatch/dispatch.h>
+#elif defined(__linux__)
+#include <sys/eventfd.h>
 #else  // posix
 #include <semaphore.h>
 #endif
@@ -197,13 +199,18 @@ private:
   // Whether or not the signal handler has been installed.
   std::atomic_bool installed_ = false;
 
-  // Whether or not the semaphore for wait_for_signal is setup.
+  // Whether or not the notification primitive for wait_for_signal is setup.
   std::atomic_bool wait_for_signal_is_setup_;
-  // Storage for the wait_for_signal semaphore.
+  // Storage for the wait_for_signal notification primitive.
 #if defined(_WIN32)
   HANDLE signal_handler_sem_;
 #elif defined(__APPLE__)
   dispatch_semaphore_t signal_handler_sem_;
+#elif defined(__linux__)
+  // An eventfd is used instead of a semaphore: writing it is async-signal
+  // safe, its counter coalesces signal bursts into a single wakeup, and it
+  // could be polled from an existing event loop thread in the future.
+  int signal_handler_fd_ = -1;
 #else  // posix
   sem_t signal_handler_sem_;
 #endif
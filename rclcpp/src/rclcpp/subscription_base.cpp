@@ -14,20 +14,28 @@
 
 #include "rclcpp/subscription_base.hpp"
 
+#include <chrono>
+#include <cstdint>
 #include <cstdio>
+#include <cstring>
+#include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "rcpputils/scope_exit.hpp"
 
+#include "rclcpp/context.hpp"
 #include "rclcpp/dynamic_typesupport/dynamic_message.hpp"
 #include "rclcpp/exceptions.hpp"
 #include "rclcpp/expand_topic_or_service_name.hpp"
 #include "rclcpp/experimental/intra_process_manager.hpp"
+#include "rclcpp/introspection.hpp"
 #include "rclcpp/logging.hpp"
 #include "rclcpp/node_interfaces/node_base_interface.hpp"
+#include "rclcpp/subscription_busy_poller.hpp"
 #include "rclcpp/event_handler.hpp"
 
 #include "rmw/error_handling.h"
@@ -47,6 +55,7 @@ SubscriptionBase::SubscriptionBase(
   DeliveredMessageKind delivered_message_kind)
 : node_base_(node_base),
   node_handle_(node_base_->get_shared_rcl_node_handle()),
+  weak_context_(node_base_->get_context()),
   node_logger_(rclcpp::get_node_logger(node_handle_.get())),
   use_intra_process_(false),
   intra_process_subscription_id_(0),
@@ -90,10 +99,31 @@ SubscriptionBase::SubscriptionBase(
   }
 
   bind_event_callbacks(event_callbacks_, use_default_callbacks);
+
+  // Intern the fully-qualified name and the rmw-resolved profile once; hot
+  // paths compare both by pointer.
+  interned_topic_name_ = rclcpp::TopicName(this->get_topic_name());
+  interned_actual_qos_ = rclcpp::InternedQoS(this->get_actual_qos());
+
+  introspection_counters_ = rclcpp::introspection::register_entity(
+    rclcpp::introspection::EntityKind::Subscription, this->get_topic_name());
 }
 
 SubscriptionBase::~SubscriptionBase()
 {
+  // Join the busy-poll thread, if any, before tearing anything else down.
+  busy_poller_.reset();
+
+  if (auto context = weak_context_.lock()) {
+    if (context->is_deferred_finalization_active()) {
+      // Detach the rmw listener first; the handle outlives this object and must
+      // not call back into it.  The deleter owns the node handle, so the node
+      // outlives the deferred fini.
+      this->clear_on_new_message_callback();
+      context->defer_entity_finalization([handle = std::move(subscription_handle_)]() {});
+    }
+  }
+
   if (!use_intra_process_) {
     return;
   }
@@ -177,6 +207,18 @@ SubscriptionBase::get_topic_name() const
   return rcl_subscription_get_topic_name(subscription_handle_.get());
 }
 
+const rclcpp::TopicName &
+SubscriptionBase::get_interned_topic_name() const
+{
+  return interned_topic_name_;
+}
+
+const rclcpp::InternedQoS &
+SubscriptionBase::get_interned_actual_qos() const
+{
+  return interned_actual_qos_;
+}
+
 std::shared_ptr<rcl_subscription_t>
 SubscriptionBase::get_subscription_handle()
 {
@@ -209,6 +251,32 @@ SubscriptionBase::get_actual_qos() const
   return rclcpp::QoS(rclcpp::QoSInitialization::from_rmw(*qos), *qos);
 }
 
+std::shared_ptr<rclcpp::introspection::EntityCounters>
+SubscriptionBase::get_introspection_counters() const
+{
+  return introspection_counters_;
+}
+
+void
+SubscriptionBase::count_callback_executed(std::chrono::steady_clock::time_point callback_start)
+{
+  const auto callback_duration = std::chrono::steady_clock::now() - callback_start;
+  introspection_counters_->callbacks.fetch_add(1, std::memory_order_relaxed);
+  introspection_counters_->callback_duration_ns.fetch_add(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(callback_duration).count(),
+    std::memory_order_relaxed);
+}
+
+void
+SubscriptionBase::count_pipeline_latency(const rclcpp::MessageInfo & message_info)
+{
+  const rmw_time_point_value_t latency = message_info.get_pipeline_latency();
+  if (latency > 0) {
+    rclcpp::introspection::record_latency(
+      *introspection_counters_, static_cast<uint64_t>(latency));
+  }
+}
+
 bool
 SubscriptionBase::take_type_erased(void * message_out, rclcpp::MessageInfo & message_info_out)
 {
@@ -220,6 +288,7 @@ SubscriptionBase::take_type_erased(void * message_out, rclcpp::MessageInfo & mes
   );
   TRACETOOLS_TRACEPOINT(rclcpp_take, static_cast<const void *>(message_out));
   if (RCL_RET_SUBSCRIPTION_TAKE_FAILED == ret) {
+    introspection_counters_->empty_takes.fetch_add(1, std::memory_order_relaxed);
     return false;
   } else if (RCL_RET_OK != ret) {
     rclcpp::exceptions::throw_from_rcl_error(ret);
@@ -231,9 +300,112 @@ SubscriptionBase::take_type_erased(void * message_out, rclcpp::MessageInfo & mes
     // we should ignore this copy of the message.
     return false;
   }
+  introspection_counters_->messages.fetch_add(1, std::memory_order_relaxed);
+  this->count_pipeline_latency(message_info_out);
   return true;
 }
 
+rcl_ret_t
+SubscriptionBase::try_take_type_erased(
+  void * message_out, rclcpp::MessageInfo & message_info_out) noexcept
+{
+  rcl_ret_t ret = rcl_take(
+    this->get_subscription_handle().get(),
+    message_out,
+    &message_info_out.get_rmw_message_info(),
+    nullptr  // rmw_subscription_allocation_t is unused here
+  );
+  TRACETOOLS_TRACEPOINT(rclcpp_take, static_cast<const void *>(message_out));
+  if (RCL_RET_OK != ret) {
+    rcl_reset_error();
+    if (RCL_RET_SUBSCRIPTION_TAKE_FAILED == ret) {
+      introspection_counters_->empty_takes.fetch_add(1, std::memory_order_relaxed);
+    }
+    return ret;
+  }
+  if (
+    matches_any_intra_process_publishers(&message_info_out.get_rmw_message_info().publisher_gid))
+  {
+    // The message will be delivered via intra-process; drop this copy.
+    return RCL_RET_SUBSCRIPTION_TAKE_FAILED;
+  }
+  introspection_counters_->messages.fetch_add(1, std::memory_order_relaxed);
+  this->count_pipeline_latency(message_info_out);
+  return RCL_RET_OK;
+}
+
+size_t
+SubscriptionBase::take_type_erased_sequence(
+  size_t count,
+  void ** messages_out,
+  rclcpp::MessageInfo * message_infos_out)
+{
+  if (0 == count) {
+    return 0;
+  }
+
+  rmw_subscription_t * rmw_subscription = rcl_subscription_get_rmw_handle(
+    this->get_subscription_handle().get());
+  if (nullptr == rmw_subscription) {
+    rcl_reset_error();
+    take_sequence_supported_.store(false, std::memory_order_relaxed);
+  }
+
+  if (take_sequence_supported_.load(std::memory_order_relaxed)) {
+    std::vector<rmw_message_info_t> raw_infos(count, rmw_get_zero_initialized_message_info());
+
+    // The sequences wrap caller provided storage, so nothing is allocated or
+    // freed here; size is filled in by the middleware.
+    rmw_message_sequence_t message_sequence;
+    message_sequence.data = messages_out;
+    message_sequence.size = 0u;
+    message_sequence.capacity = count;
+    message_sequence.allocator = nullptr;
+    rmw_message_info_sequence_t info_sequence;
+    info_sequence.data = raw_infos.data();
+    info_sequence.size = 0u;
+    info_sequence.capacity = count;
+    info_sequence.allocator = nullptr;
+
+    size_t taken_count = 0;
+    rmw_ret_t ret = rmw_take_sequence(
+      rmw_subscription, count, &message_sequence, &info_sequence, &taken_count, nullptr);
+    if (RMW_RET_UNSUPPORTED == ret) {
+      rmw_reset_error();
+      take_sequence_supported_.store(false, std::memory_order_relaxed);
+    } else if (RMW_RET_OK != ret) {
+      auto error_message =
+        std::string("failed to take message sequence: ") + rmw_get_error_string().str;
+      rmw_reset_error();
+      throw std::runtime_error(error_message);
+    } else {
+      for (size_t i = 0; i < taken_count; ++i) {
+        message_infos_out[i].get_rmw_message_info() = raw_infos[i];
+        TRACETOOLS_TRACEPOINT(rclcpp_take, static_cast<const void *>(messages_out[i]));
+      }
+      if (0 == taken_count) {
+        introspection_counters_->empty_takes.fetch_add(1, std::memory_order_relaxed);
+      } else {
+        introspection_counters_->messages.fetch_add(taken_count, std::memory_order_relaxed);
+        for (size_t i = 0; i < taken_count; ++i) {
+          this->count_pipeline_latency(message_infos_out[i]);
+        }
+      }
+      return taken_count;
+    }
+  }
+
+  // One-at-a-time fallback for middlewares without take-sequence support.
+  size_t taken_count = 0;
+  while (taken_count < count) {
+    if (!take_type_erased(messages_out[taken_count], message_infos_out[taken_count])) {
+      break;
+    }
+    ++taken_count;
+  }
+  return taken_count;
+}
+
 bool
 SubscriptionBase::take_serialized(
   rclcpp::SerializedMessage & message_out,
@@ -244,14 +416,177 @@ SubscriptionBase::take_serialized(
     &message_out.get_rcl_serialized_message(),
     &message_info_out.get_rmw_message_info(),
     nullptr);
+  TRACETOOLS_TRACEPOINT(rclcpp_take, static_cast<const void *>(&message_out));
   if (RCL_RET_SUBSCRIPTION_TAKE_FAILED == ret) {
+    introspection_counters_->empty_takes.fetch_add(1, std::memory_order_relaxed);
     return false;
   } else if (RCL_RET_OK != ret) {
     rclcpp::exceptions::throw_from_rcl_error(ret);
   }
+  introspection_counters_->messages.fetch_add(1, std::memory_order_relaxed);
+  this->count_pipeline_latency(message_info_out);
   return true;
 }
 
+namespace
+{
+
+/// Allocator state serving takes from a caller-owned arena, see take_serialized_into().
+struct ArenaAllocatorState
+{
+  uint8_t * base;
+  size_t capacity;
+  rcutils_allocator_t fallback;
+  bool overflowed;
+};
+
+void *
+arena_allocate(size_t size, void * untyped_state)
+{
+  auto * state = static_cast<ArenaAllocatorState *>(untyped_state);
+  if (size <= state->capacity) {
+    return state->base;
+  }
+  state->overflowed = true;
+  return state->fallback.allocate(size, state->fallback.state);
+}
+
+void *
+arena_reallocate(void * pointer, size_t size, void * untyped_state)
+{
+  auto * state = static_cast<ArenaAllocatorState *>(untyped_state);
+  if (pointer != state->base) {
+    return state->fallback.reallocate(pointer, size, state->fallback.state);
+  }
+  if (size <= state->capacity) {
+    return state->base;
+  }
+  // The arena is too small, grow into the heap keeping the contents.
+  state->overflowed = true;
+  void * grown = state->fallback.allocate(size, state->fallback.state);
+  if (nullptr != grown) {
+    std::memcpy(grown, state->base, state->capacity);
+  }
+  return grown;
+}
+
+void
+arena_deallocate(void * pointer, void * untyped_state)
+{
+  auto * state = static_cast<ArenaAllocatorState *>(untyped_state);
+  if (pointer != state->base) {
+    state->fallback.deallocate(pointer, state->fallback.state);
+  }
+}
+
+void *
+arena_zero_allocate(size_t count, size_t size, void * untyped_state)
+{
+  const size_t total = count * size;
+  void * pointer = arena_allocate(total, untyped_state);
+  if (nullptr != pointer) {
+    std::memset(pointer, 0, total);
+  }
+  return pointer;
+}
+
+}  // namespace
+
+bool
+SubscriptionBase::take_serialized_into(
+  uint8_t * arena,
+  size_t arena_capacity,
+  SerializedView & view_out,
+  rclcpp::MessageInfo & message_info_out)
+{
+  if (nullptr == arena || 0u == arena_capacity) {
+    throw std::invalid_argument("arena must be non-null and non-empty");
+  }
+
+  ArenaAllocatorState state{arena, arena_capacity, rcutils_get_default_allocator(), false};
+  rcutils_allocator_t allocator;
+  allocator.allocate = arena_allocate;
+  allocator.deallocate = arena_deallocate;
+  allocator.reallocate = arena_reallocate;
+  allocator.zero_allocate = arena_zero_allocate;
+  allocator.state = &state;
+
+  rcl_serialized_message_t message = rmw_get_zero_initialized_serialized_message();
+  message.buffer = arena;
+  message.buffer_length = 0u;
+  message.buffer_capacity = arena_capacity;
+  message.allocator = allocator;
+
+  rcl_ret_t ret = rcl_take_serialized_message(
+    this->get_subscription_handle().get(),
+    &message,
+    &message_info_out.get_rmw_message_info(),
+    nullptr);
+  TRACETOOLS_TRACEPOINT(rclcpp_take, static_cast<const void *>(arena));
+  if (RCL_RET_OK != ret) {
+    if (state.overflowed && message.buffer != arena) {
+      state.fallback.deallocate(message.buffer, state.fallback.state);
+    }
+    if (RCL_RET_SUBSCRIPTION_TAKE_FAILED == ret) {
+      introspection_counters_->empty_takes.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    rclcpp::exceptions::throw_from_rcl_error(ret);
+  }
+
+  if (state.overflowed) {
+    // The message outgrew the arena; adopt the heap buffer into the
+    // fallback holder so it outlives this call, freeing the previous one.
+    rcl_serialized_message_t & fallback = arena_take_fallback_.get_rcl_serialized_message();
+    if (nullptr != fallback.buffer) {
+      fallback.allocator.deallocate(fallback.buffer, fallback.allocator.state);
+    }
+    fallback.buffer = message.buffer;
+    fallback.buffer_length = message.buffer_length;
+    fallback.buffer_capacity = message.buffer_capacity;
+    fallback.allocator = state.fallback;
+    view_out = {fallback.buffer, fallback.buffer_length, false};
+  } else {
+    view_out = {arena, message.buffer_length, true};
+  }
+
+  introspection_counters_->messages.fetch_add(1, std::memory_order_relaxed);
+  this->count_pipeline_latency(message_info_out);
+  return true;
+}
+
+size_t
+SubscriptionBase::take_serialized_sequence_into(
+  uint8_t * arena,
+  size_t arena_capacity,
+  size_t max_messages,
+  SerializedView * views_out,
+  rclcpp::MessageInfo * message_infos_out)
+{
+  if (nullptr == views_out || nullptr == message_infos_out || 0u == max_messages) {
+    throw std::invalid_argument("output arrays must be non-null and max_messages positive");
+  }
+
+  size_t taken = 0u;
+  size_t offset = 0u;
+  while (taken < max_messages && offset < arena_capacity) {
+    if (!this->take_serialized_into(
+        arena + offset, arena_capacity - offset, views_out[taken], message_infos_out[taken]))
+    {
+      break;
+    }
+    const bool in_arena = views_out[taken].in_arena;
+    // Keep every message start eight-byte aligned for in-place reads.
+    offset += (views_out[taken].size + 7u) & ~size_t{7u};
+    ++taken;
+    if (!in_arena) {
+      // The fallback slot holds one message at a time, end the batch here.
+      break;
+    }
+  }
+  return taken;
+}
+
 const rosidl_message_type_support_t &
 SubscriptionBase::get_message_type_support_handle() const
 {
@@ -285,6 +620,65 @@ SubscriptionBase::get_publisher_count() const
   return inter_process_publisher_count;
 }
 
+size_t
+SubscriptionBase::get_take_batch_size() const
+{
+  return take_batch_size_;
+}
+
+void
+SubscriptionBase::set_take_batch_size(size_t take_batch_size)
+{
+  take_batch_size_ = take_batch_size > 0 ? take_batch_size : 1;
+}
+
+std::chrono::nanoseconds
+SubscriptionBase::get_max_message_age() const
+{
+  return max_message_age_;
+}
+
+void
+SubscriptionBase::set_max_message_age(std::chrono::nanoseconds max_message_age)
+{
+  max_message_age_ =
+    max_message_age > std::chrono::nanoseconds::zero() ?
+    max_message_age : std::chrono::nanoseconds::zero();
+}
+
+bool
+SubscriptionBase::shed_stale_message(const rclcpp::MessageInfo & message_info)
+{
+  if (max_message_age_ <= std::chrono::nanoseconds::zero()) {
+    return false;
+  }
+  const rmw_time_point_value_t source_timestamp =
+    message_info.get_rmw_message_info().source_timestamp;
+  if (source_timestamp <= 0) {
+    // No timestamp to age against, deliver rather than guess.
+    return false;
+  }
+  const rmw_time_point_value_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::system_clock::now().time_since_epoch()).count();
+  if (now - source_timestamp <= max_message_age_.count()) {
+    return false;
+  }
+  introspection_counters_->shed_messages.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
+
+bool
+SubscriptionBase::is_busy_polled() const
+{
+  return nullptr != busy_poller_;
+}
+
+void
+SubscriptionBase::set_busy_poller(std::shared_ptr<rclcpp::SubscriptionBusyPoller> busy_poller)
+{
+  busy_poller_ = std::move(busy_poller);
+}
+
 void
 SubscriptionBase::setup_intra_process(
   uint64_t intra_process_subscription_id,
@@ -421,6 +815,26 @@ SubscriptionBase::get_network_flow_endpoints() const
   return network_flow_endpoint_vector;
 }
 
+std::shared_ptr<const std::vector<rclcpp::NetworkFlowEndpoint>>
+SubscriptionBase::get_network_flow_endpoints_view() const
+{
+  // The endpoints this subscription receives on can only change when the set
+  // of matched publishers changes, so use the matched count as a cheap,
+  // allocation-free freshness probe.
+  const size_t matched_count = this->get_publisher_count();
+  std::lock_guard<std::mutex> lock(network_flow_endpoints_mutex_);
+  if (network_flow_endpoints_cache_ &&
+    matched_count == network_flow_endpoints_matched_count_)
+  {
+    return network_flow_endpoints_cache_;
+  }
+  network_flow_endpoints_cache_ =
+    std::make_shared<const std::vector<rclcpp::NetworkFlowEndpoint>>(
+    this->get_network_flow_endpoints());
+  network_flow_endpoints_matched_count_ = matched_count;
+  return network_flow_endpoints_cache_;
+}
+
 void
 SubscriptionBase::set_on_new_message_callback(
   rcl_event_callback_t callback,
@@ -524,6 +938,33 @@ SubscriptionBase::get_content_filter() const
   return ret_options;
 }
 
+void
+SubscriptionBase::set_content_filter_predicate(
+  std::function<bool(const void *, const rclcpp::MessageInfo &)> predicate)
+{
+  auto predicate_ptr = predicate ?
+    std::make_shared<const std::function<bool(const void *, const rclcpp::MessageInfo &)>>(
+    std::move(predicate)) :
+    nullptr;
+  std::lock_guard<std::mutex> lock(content_filter_predicate_mutex_);
+  content_filter_predicate_ = std::move(predicate_ptr);
+}
+
+bool
+SubscriptionBase::matches_content_filter(
+  const void * message, const rclcpp::MessageInfo & message_info) const
+{
+  std::shared_ptr<const std::function<bool(const void *, const rclcpp::MessageInfo &)>> predicate;
+  {
+    std::lock_guard<std::mutex> lock(content_filter_predicate_mutex_);
+    predicate = content_filter_predicate_;
+  }
+  if (!predicate) {
+    return true;
+  }
+  return (*predicate)(message, message_info);
+}
+
 
 // DYNAMIC TYPE ==================================================================================
 bool
@@ -534,3 +975,9 @@ SubscriptionBase::take_dynamic_message(
   throw std::runtime_error("Unimplemented");
   return false;
 }
+
+void
+SubscriptionBase::set_callback_group_membership(std::shared_ptr<void> membership)
+{
+  callback_group_membership_ = membership;
+}
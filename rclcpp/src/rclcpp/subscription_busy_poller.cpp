@@ -0,0 +1,72 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/subscription_busy_poller.hpp"
+
+#include <memory>
+#include <utility>
+
+#include "rclcpp/executor.hpp"
+
+namespace rclcpp
+{
+
+SubscriptionBusyPoller::SubscriptionBusyPoller(
+  rclcpp::SubscriptionBase::SharedPtr subscription,
+  rclcpp::Context::SharedPtr context,
+  const rclcpp::ThreadAttributes & thread_attributes)
+: subscription_(subscription),
+  intra_process_waitable_(subscription->get_intra_process_waitable()),
+  context_(std::move(context))
+{
+  thread_ = std::thread(&SubscriptionBusyPoller::run, this, thread_attributes);
+}
+
+SubscriptionBusyPoller::~SubscriptionBusyPoller()
+{
+  this->stop();
+}
+
+void
+SubscriptionBusyPoller::stop()
+{
+  spinning_.store(false, std::memory_order_relaxed);
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+void
+SubscriptionBusyPoller::run(const rclcpp::ThreadAttributes & thread_attributes)
+{
+  rclcpp::apply_attributes_to_current_thread(thread_attributes);
+
+  while (spinning_.load(std::memory_order_relaxed) && context_->is_valid()) {
+    // The subscription reference is reacquired per iteration so the poller
+    // never keeps a dying subscription alive across loop iterations.
+    auto subscription = subscription_.lock();
+    if (!subscription) {
+      break;
+    }
+    if (intra_process_waitable_ && intra_process_waitable_->is_ready(nullptr)) {
+      auto data = intra_process_waitable_->take_data();
+      intra_process_waitable_->execute(data);
+    }
+    // One inter-process take attempt; dispatches inline when a message is
+    // available and is a cheap failed take otherwise.
+    rclcpp::Executor::execute_subscription(subscription);
+  }
+}
+
+}  // namespace rclcpp
@@ -29,6 +29,12 @@ SubscriptionIntraProcessBase::get_topic_name() const
   return topic_name_.c_str();
 }
 
+const rclcpp::TopicName &
+SubscriptionIntraProcessBase::get_interned_topic_name() const
+{
+  return interned_topic_name_;
+}
+
 rclcpp::QoS
 SubscriptionIntraProcessBase::get_actual_qos() const
 {
@@ -0,0 +1,93 @@
+// Copyright 2024 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/thread_attributes.hpp"
+
+#include <string>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "rclcpp/logging.hpp"
+
+namespace rclcpp
+{
+
+void
+apply_attributes_to_current_thread(const ThreadAttributes & attributes)
+{
+#ifdef __linux__
+  if (!attributes.cpu_set.empty()) {
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    for (size_t cpu : attributes.cpu_set) {
+      if (cpu < CPU_SETSIZE) {
+        CPU_SET(cpu, &cpuset);
+      }
+    }
+    int ret = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset);
+    if (ret != 0) {
+      RCLCPP_WARN(
+        rclcpp::get_logger("rclcpp"),
+        "Failed to set thread cpu affinity: %d", ret);
+    }
+  }
+
+  if (attributes.scheduling_policy != ThreadSchedulingPolicy::Inherit) {
+    int policy = SCHED_OTHER;
+    switch (attributes.scheduling_policy) {
+      case ThreadSchedulingPolicy::FIFO:
+        policy = SCHED_FIFO;
+        break;
+      case ThreadSchedulingPolicy::RoundRobin:
+        policy = SCHED_RR;
+        break;
+      default:
+        break;
+    }
+    struct sched_param param;
+    param.sched_priority = attributes.priority;
+    int ret = pthread_setschedparam(pthread_self(), policy, &param);
+    if (ret != 0) {
+      RCLCPP_WARN(
+        rclcpp::get_logger("rclcpp"),
+        "Failed to set thread scheduling policy (missing privileges?): %d", ret);
+    }
+  }
+
+  if (!attributes.name.empty()) {
+    // Linux limits thread names to 16 bytes including the terminator.
+    std::string truncated_name = attributes.name.substr(0, 15);
+    int ret = pthread_setname_np(pthread_self(), truncated_name.c_str());
+    if (ret != 0) {
+      RCLCPP_WARN(
+        rclcpp::get_logger("rclcpp"),
+        "Failed to set thread name: %d", ret);
+    }
+  }
+#else
+  if (!attributes.cpu_set.empty() ||
+    attributes.scheduling_policy != ThreadSchedulingPolicy::Inherit ||
+    !attributes.name.empty())
+  {
+    RCLCPP_WARN(
+      rclcpp::get_logger("rclcpp"),
+      "ThreadAttributes are not supported on this platform, ignoring them");
+  }
+#endif
+}
+
+}  // namespace rclcpp
@@ -149,21 +149,36 @@ public:
     }
   }
 
-  // Internal helper function
-  void set_all_clocks(
-    const builtin_interfaces::msg::Time::SharedPtr msg,
-    bool set_ros_time_enabled)
+  // Propagate one /clock sample to every attached clock.
+  // This is the per-message hot path: the enable state of every attached
+  // clock was already synchronized by enable_ros_time(), disable_ros_time()
+  // or attachClock(), so the time is converted once and only the override
+  // value is written per clock, without re-querying the override status.
+  void set_all_clock_values(const builtin_interfaces::msg::Time & msg)
   {
+    const rcl_time_point_value_t time_ns = rclcpp::Time(msg).nanoseconds();
     std::lock_guard<std::mutex> guard(clock_list_lock_);
-    for (auto it = associated_clocks_.begin(); it != associated_clocks_.end(); ++it) {
-      set_clock(msg, set_ros_time_enabled, *it);
+    for (auto & clock : associated_clocks_) {
+      if (clock->get_clock_type() != RCL_ROS_TIME) {
+        continue;
+      }
+      std::lock_guard<std::mutex> clock_guard(clock->get_clock_mutex());
+      auto ret = rcl_set_ros_time_override(clock->get_clock_handle(), time_ns);
+      if (ret != RCL_RET_OK) {
+        rclcpp::exceptions::throw_from_rcl_error(
+          ret, "Failed to set ros_time_override_status");
+      }
     }
   }
 
   // Cache the last clock message received
   void cache_last_msg(std::shared_ptr<const rosgraph_msgs::msg::Clock> msg)
   {
-    last_time_msg_ = std::make_shared<builtin_interfaces::msg::Time>(msg->clock);
+    // Update in place under the list lock, so the per-message hot path does
+    // not allocate and readers handing last_time_msg_ to newly attached
+    // clocks never observe a half-written stamp.
+    std::lock_guard<std::mutex> guard(clock_list_lock_);
+    *last_time_msg_ = msg->clock;
   }
 
   bool are_all_clocks_rcl_ros_time()
@@ -363,10 +378,9 @@ private:
     }
     // Cache the last message in case a new clock is attached.
     clocks_state_.cache_last_msg(msg);
-    auto time_msg = std::make_shared<builtin_interfaces::msg::Time>(msg->clock);
 
     if (SET_TRUE == this->parameter_state_) {
-      clocks_state_.set_all_clocks(time_msg, true);
+      clocks_state_.set_all_clock_values(msg->clock);
     }
   }
 
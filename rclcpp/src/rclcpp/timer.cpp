@@ -72,6 +72,9 @@ TimerBase::TimerBase(
       rclcpp::exceptions::throw_from_rcl_error(ret, "Couldn't initialize rcl timer handle");
     }
   }
+
+  introspection_counters_ = rclcpp::introspection::register_entity(
+    rclcpp::introspection::EntityKind::Timer, "");
 }
 
 TimerBase::~TimerBase()
@@ -79,6 +82,72 @@ TimerBase::~TimerBase()
   clear_on_reset_callback();
 }
 
+std::shared_ptr<rclcpp::introspection::EntityCounters>
+TimerBase::get_introspection_counters() const
+{
+  return introspection_counters_;
+}
+
+void
+TimerBase::count_callback_executed(std::chrono::steady_clock::time_point callback_start)
+{
+  const auto callback_duration = std::chrono::steady_clock::now() - callback_start;
+  introspection_counters_->callbacks.fetch_add(1, std::memory_order_relaxed);
+  introspection_counters_->callback_duration_ns.fetch_add(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(callback_duration).count(),
+    std::memory_order_relaxed);
+
+  int64_t period = 0;
+  if (RCL_RET_OK != rcl_timer_get_period(timer_handle_.get(), &period)) {
+    // Statistics must not turn a successful callback into a failure.
+    rcl_reset_error();
+    return;
+  }
+  if (period > 0 && callback_duration > std::chrono::nanoseconds(period)) {
+    introspection_counters_->timer_overruns.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void
+TimerBase::count_timer_fired()
+{
+  int64_t time_until_next_call = 0;
+  rcl_ret_t ret = rcl_timer_get_time_until_next_call(
+    timer_handle_.get(), &time_until_next_call);
+  if (ret != RCL_RET_OK) {
+    // Canceled or broken timers record no jitter; rcl_timer_call() will
+    // surface any real error right after this.
+    rcl_reset_error();
+    return;
+  }
+  // The timer is firing, so its scheduled time has already passed; the
+  // amount by which it passed is the activation jitter.
+  const uint64_t jitter_ns =
+    time_until_next_call < 0 ? static_cast<uint64_t>(-time_until_next_call) : 0u;
+  introspection_counters_->timer_jitter_ns.fetch_add(jitter_ns, std::memory_order_relaxed);
+  uint64_t observed =
+    introspection_counters_->timer_jitter_max_ns.load(std::memory_order_relaxed);
+  while (jitter_ns > observed &&
+    !introspection_counters_->timer_jitter_max_ns.compare_exchange_weak(
+      observed, jitter_ns, std::memory_order_relaxed))
+  {
+  }
+}
+
+TimerBase::Stats
+TimerBase::get_stats() const
+{
+  Stats stats;
+  stats.callbacks = introspection_counters_->callbacks.load(std::memory_order_relaxed);
+  stats.callback_duration_ns =
+    introspection_counters_->callback_duration_ns.load(std::memory_order_relaxed);
+  stats.jitter_sum_ns = introspection_counters_->timer_jitter_ns.load(std::memory_order_relaxed);
+  stats.jitter_max_ns =
+    introspection_counters_->timer_jitter_max_ns.load(std::memory_order_relaxed);
+  stats.overruns = introspection_counters_->timer_overruns.load(std::memory_order_relaxed);
+  return stats;
+}
+
 void
 TimerBase::cancel()
 {
@@ -112,6 +181,58 @@ TimerBase::reset()
   }
 }
 
+std::chrono::nanoseconds
+TimerBase::exchange_period(std::chrono::nanoseconds period)
+{
+  int64_t old_period = 0;
+  {
+    std::lock_guard<std::recursive_mutex> lock(callback_mutex_);
+    rcl_ret_t ret = rcl_timer_exchange_period(
+      timer_handle_.get(), period.count(), &old_period);
+    if (ret != RCL_RET_OK) {
+      rclcpp::exceptions::throw_from_rcl_error(ret, "Couldn't exchange timer period");
+    }
+    // rcl only fires the on-reset callback on rcl_timer_reset(), so tracking
+    // entities are notified about the schedule change from here.
+    if (on_reset_callback_) {
+      on_reset_callback_(1);
+    }
+  }
+  return std::chrono::nanoseconds(old_period);
+}
+
+void
+TimerBase::set_phase(std::chrono::nanoseconds phase)
+{
+  if (phase < std::chrono::nanoseconds::zero()) {
+    throw std::invalid_argument("timer phase cannot be negative");
+  }
+  if (phase == std::chrono::nanoseconds::zero()) {
+    return;
+  }
+  int64_t period = 0;
+  rcl_ret_t ret = rcl_timer_get_period(timer_handle_.get(), &period);
+  if (ret != RCL_RET_OK) {
+    rclcpp::exceptions::throw_from_rcl_error(ret, "Couldn't get timer period");
+  }
+  phase_restore_period_ = period;
+  // Inflate the period so the next trigger lands one phase later than it
+  // would have; clear_phase_offset() restores the original period right
+  // after that trigger, so only the first fire is delayed.
+  this->exchange_period(std::chrono::nanoseconds(period) + phase);
+  phase_pending_.store(true, std::memory_order_release);
+}
+
+void
+TimerBase::clear_phase_offset()
+{
+  if (!phase_pending_.load(std::memory_order_acquire)) {
+    return;
+  }
+  phase_pending_.store(false, std::memory_order_relaxed);
+  this->exchange_period(std::chrono::nanoseconds(phase_restore_period_));
+}
+
 bool
 TimerBase::is_ready()
 {
@@ -218,3 +339,9 @@ TimerBase::set_on_reset_callback(rcl_event_callback_t callback, const void * use
     rclcpp::exceptions::throw_from_rcl_error(ret, "Failed to set timer on reset callback");
   }
 }
+
+void
+TimerBase::set_callback_group_membership(std::shared_ptr<void> membership)
+{
+  callback_group_membership_ = membership;
+}
@@ -0,0 +1,93 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/topic_name.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+using rclcpp::TopicName;
+
+TopicName::TopicName(const std::string & name)
+: interned_(intern(name))
+{}
+
+const std::string &
+TopicName::str() const
+{
+  static const std::string empty_name;
+  return interned_ ? interned_->name : empty_name;
+}
+
+const char *
+TopicName::c_str() const
+{
+  return this->str().c_str();
+}
+
+size_t
+TopicName::hash() const
+{
+  return interned_ ? interned_->hash : 0u;
+}
+
+bool
+TopicName::empty() const
+{
+  return nullptr == interned_;
+}
+
+bool
+TopicName::operator==(const TopicName & other) const
+{
+  return interned_ == other.interned_;
+}
+
+bool
+TopicName::operator!=(const TopicName & other) const
+{
+  return !(*this == other);
+}
+
+std::shared_ptr<const TopicName::Interned>
+TopicName::intern(const std::string & name)
+{
+  static std::mutex table_mutex;
+  static std::unordered_map<std::string, std::weak_ptr<const Interned>> table;
+  static size_t purge_threshold = 64u;
+
+  std::lock_guard<std::mutex> lock(table_mutex);
+  auto it = table.find(name);
+  if (it != table.end()) {
+    if (auto existing = it->second.lock()) {
+      return existing;
+    }
+  }
+  auto interned = std::make_shared<Interned>();
+  interned->name = name;
+  interned->hash = std::hash<std::string>()(name);
+  table[name] = interned;
+  // Drop records of names whose last user is gone, so processes with
+  // churning topics do not grow the table without bound.
+  if (table.size() >= purge_threshold) {
+    for (auto entry = table.begin(); entry != table.end(); ) {
+      entry = entry->second.expired() ? table.erase(entry) : std::next(entry);
+    }
+    purge_threshold = std::max<size_t>(64u, 2u * table.size());
+  }
+  return interned;
+}
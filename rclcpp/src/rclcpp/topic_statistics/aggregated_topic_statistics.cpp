@@ -0,0 +1,112 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/topic_statistics/aggregated_topic_statistics.hpp"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace rclcpp
+{
+namespace topic_statistics
+{
+
+AggregatedTopicStatisticsSink::AggregatedTopicStatisticsSink(
+  rclcpp::Publisher<statistics_msgs::msg::MetricsMessage>::SharedPtr publisher)
+: publisher_(std::move(publisher))
+{
+  if (nullptr == publisher_) {
+    throw std::invalid_argument("publisher pointer is nullptr");
+  }
+}
+
+AggregatedTopicStatisticsSink::~AggregatedTopicStatisticsSink()
+{
+  if (publisher_timer_) {
+    publisher_timer_->cancel();
+    publisher_timer_.reset();
+  }
+}
+
+void
+AggregatedTopicStatisticsSink::add_source(
+  std::weak_ptr<AggregatedTopicStatisticsSource> source)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  sources_.push_back(std::move(source));
+}
+
+void
+AggregatedTopicStatisticsSink::set_publisher_timer(
+  rclcpp::TimerBase::SharedPtr publisher_timer)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  publisher_timer_ = std::move(publisher_timer);
+}
+
+void
+AggregatedTopicStatisticsSink::publish_batch()
+{
+  std::vector<std::shared_ptr<AggregatedTopicStatisticsSource>> live_sources;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    live_sources.reserve(sources_.size());
+    auto it = sources_.begin();
+    while (it != sources_.end()) {
+      auto source = it->lock();
+      if (source) {
+        live_sources.push_back(std::move(source));
+        ++it;
+      } else {
+        it = sources_.erase(it);
+      }
+    }
+  }
+
+  // Collect and publish without holding the lock, so sources registering
+  // concurrently are not blocked on the publishes.
+  for (const auto & source : live_sources) {
+    for (const auto & message : source->collect_and_reset_measurements()) {
+      publisher_->publish(message);
+    }
+  }
+}
+
+std::shared_ptr<AggregatedTopicStatisticsSink>
+AggregatedTopicStatisticsSink::get_or_create(
+  const std::string & publish_topic,
+  const std::function<std::shared_ptr<AggregatedTopicStatisticsSink>()> & make)
+{
+  static std::mutex registry_mutex;
+  static std::unordered_map<std::string, std::weak_ptr<AggregatedTopicStatisticsSink>> registry;
+
+  std::lock_guard<std::mutex> lock(registry_mutex);
+  auto it = registry.find(publish_topic);
+  if (it != registry.end()) {
+    auto existing = it->second.lock();
+    if (existing) {
+      return existing;
+    }
+  }
+  auto sink = make();
+  registry[publish_topic] = sink;
+  return sink;
+}
+
+}  // namespace topic_statistics
+}  // namespace rclcpp
@@ -17,10 +17,12 @@
 
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
 
 #include "ament_index_cpp/get_package_prefix.hpp"
@@ -91,6 +93,40 @@ extract_type_identifier(const std::string & full_type)
   return std::make_tuple(package_name, middle_module, type_name);
 }
 
+// One cached load attempt per type and typesupport identifier; either the
+// pinned library with its resolved handle, or the error of the failed attempt.
+struct TypesupportCacheEntry
+{
+  std::shared_ptr<rcpputils::SharedLibrary> library;
+  const rosidl_message_type_support_t * handle {nullptr};
+  std::string error;
+};
+
+// Process-wide cache so that e.g. generic recorders subscribing to many
+// topics of the same type load and resolve each typesupport library once.
+TypesupportCacheEntry &
+get_typesupport_cache_entry(const std::string & type, const std::string & typesupport_identifier)
+{
+  static std::mutex cache_mutex;
+  static std::unordered_map<std::string, TypesupportCacheEntry> cache;
+
+  const std::string key = typesupport_identifier + "@" + type;
+  std::lock_guard<std::mutex> lock(cache_mutex);
+  auto it = cache.find(key);
+  if (it == cache.end()) {
+    TypesupportCacheEntry entry;
+    try {
+      entry.library = rclcpp::get_typesupport_library(type, typesupport_identifier);
+      entry.handle = rclcpp::get_typesupport_handle(type, typesupport_identifier, *entry.library);
+    } catch (const std::runtime_error & e) {
+      entry.library.reset();
+      entry.error = e.what();
+    }
+    it = cache.emplace(key, std::move(entry)).first;
+  }
+  return it->second;
+}
+
 }  // anonymous namespace
 
 std::shared_ptr<rcpputils::SharedLibrary>
@@ -133,4 +169,24 @@ get_typesupport_handle(
   }
 }
 
+std::shared_ptr<rcpputils::SharedLibrary>
+get_cached_typesupport_library(const std::string & type, const std::string & typesupport_identifier)
+{
+  const TypesupportCacheEntry & entry = get_typesupport_cache_entry(type, typesupport_identifier);
+  if (!entry.error.empty()) {
+    throw std::runtime_error(entry.error);
+  }
+  return entry.library;
+}
+
+const rosidl_message_type_support_t *
+get_cached_typesupport_handle(const std::string & type, const std::string & typesupport_identifier)
+{
+  const TypesupportCacheEntry & entry = get_typesupport_cache_entry(type, typesupport_identifier);
+  if (!entry.error.empty()) {
+    throw std::runtime_error(entry.error);
+  }
+  return entry.handle;
+}
+
 }  // namespace rclcpp
@@ -86,3 +86,9 @@ Waitable::clear_on_ready_callback()
           "Custom waitables should override clear_on_ready_callback if they "
           "want to use it and make sure to call it on the waitable destructor.");
 }
+
+void
+Waitable::set_callback_group_membership(std::shared_ptr<void> membership)
+{
+  callback_group_membership_ = membership;
+}
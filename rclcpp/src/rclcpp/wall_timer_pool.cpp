@@ -0,0 +1,164 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp/wall_timer_pool.hpp"
+
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace rclcpp
+{
+
+struct WallTimerPool::State
+{
+  /// One pooled timer and its currently armed callback.
+  struct Slot
+  {
+    rclcpp::TimerBase::SharedPtr timer;
+    std::function<void()> user_callback;
+    bool armed {false};
+  };
+
+  rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_base;
+  rclcpp::node_interfaces::NodeTimersInterface::SharedPtr node_timers;
+  rclcpp::CallbackGroup::SharedPtr group;
+
+  mutable std::mutex mutex;
+  // Slots are heap allocated so timer callbacks can hold stable pointers.
+  std::vector<std::unique_ptr<Slot>> slots;
+  std::vector<Slot *> idle_slots;
+};
+
+WallTimerPool::WallTimerPool(
+  rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_base,
+  rclcpp::node_interfaces::NodeTimersInterface::SharedPtr node_timers,
+  rclcpp::CallbackGroup::SharedPtr group)
+: state_(std::make_shared<State>())
+{
+  if (nullptr == node_base) {
+    throw std::invalid_argument("node_base cannot be null");
+  }
+  if (nullptr == node_timers) {
+    throw std::invalid_argument("node_timers cannot be null");
+  }
+  state_->node_base = node_base;
+  state_->node_timers = node_timers;
+  state_->group = group ? group : node_base->get_default_callback_group();
+}
+
+WallTimerPool::~WallTimerPool()
+{}
+
+rclcpp::TimerBase::SharedPtr
+WallTimerPool::call_later(std::chrono::nanoseconds delay, std::function<void()> callback)
+{
+  if (delay <= std::chrono::nanoseconds::zero()) {
+    throw std::invalid_argument("delay must be positive");
+  }
+  if (!callback) {
+    throw std::invalid_argument("callback cannot be null");
+  }
+
+  std::lock_guard<std::mutex> lock(state_->mutex);
+
+  if (!state_->idle_slots.empty()) {
+    State::Slot * slot = state_->idle_slots.back();
+    state_->idle_slots.pop_back();
+    slot->user_callback = std::move(callback);
+    slot->armed = true;
+    slot->timer->exchange_period(delay);
+    slot->timer->reset();
+    // The timer was added to the node when it was created; wake waiting
+    // executors so they pick up the new trigger time.
+    state_->node_base->trigger_notify_guard_condition();
+    state_->group->trigger_notify_guard_condition();
+    return slot->timer;
+  }
+
+  auto slot_owner = std::make_unique<State::Slot>();
+  State::Slot * slot = slot_owner.get();
+  slot->user_callback = std::move(callback);
+  slot->armed = true;
+
+  // The timer outlives the pool if a caller keeps its shared pointer, so its
+  // callback must not hold the state alive or assume it still exists.
+  std::weak_ptr<State> weak_state = state_;
+  auto timer = rclcpp::WallTimer<std::function<void()>>::make_shared(
+    delay,
+    [weak_state, slot]() {
+      std::function<void()> user_callback;
+      {
+        auto state = weak_state.lock();
+        if (!state) {
+          return;
+        }
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (!slot->armed) {
+          // Lost the race with cancel(), the slot is already idle again.
+          return;
+        }
+        slot->armed = false;
+        user_callback = std::move(slot->user_callback);
+        slot->user_callback = nullptr;
+        slot->timer->cancel();
+        state->idle_slots.push_back(slot);
+      }
+      // Invoke outside the lock so the callback may rearm the pool.
+      user_callback();
+    },
+    state_->node_base->get_context());
+  slot->timer = timer;
+  state_->slots.push_back(std::move(slot_owner));
+  state_->node_timers->add_timer(timer, state_->group);
+  return timer;
+}
+
+void
+WallTimerPool::cancel(const rclcpp::TimerBase::SharedPtr & timer)
+{
+  if (nullptr == timer) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(state_->mutex);
+  for (const auto & slot : state_->slots) {
+    if (slot->timer == timer) {
+      if (slot->armed) {
+        slot->armed = false;
+        slot->user_callback = nullptr;
+        slot->timer->cancel();
+        state_->idle_slots.push_back(slot.get());
+      }
+      return;
+    }
+  }
+}
+
+size_t
+WallTimerPool::size() const
+{
+  std::lock_guard<std::mutex> lock(state_->mutex);
+  return state_->slots.size();
+}
+
+size_t
+WallTimerPool::idle_count() const
+{
+  std::lock_guard<std::mutex> lock(state_->mutex);
+  return state_->idle_slots.size();
+}
+
+}  // namespace rclcpp
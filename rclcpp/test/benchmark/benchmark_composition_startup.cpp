@@ -0,0 +1,147 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+
+#include "rclcpp/rclcpp.hpp"
+#include "test_msgs/msg/basic_types.hpp"
+
+using namespace std::chrono_literals;
+using performance_test_fixture::PerformanceTest;
+
+namespace
+{
+
+constexpr size_t kNumNodes = 4;
+constexpr size_t kPublishersPerNode = 2;
+constexpr size_t kSubscriptionsPerNode = 2;
+
+uint64_t
+now_nanoseconds()
+{
+  return static_cast<uint64_t>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+}  // namespace
+
+/// Composition bring-up: wall time from a cold context to the first delivered message.
+/**
+ * Each iteration performs a full bring-up the way a composed process does on
+ * deploy: context init, node construction, entity creation (which includes
+ * QoS override parameter resolution), executor registration, and finally the
+ * first end-to-end message delivery. The per-phase averages are reported as
+ * counters so a regression in any one startup phase is attributable, not
+ * just visible in the total.
+ */
+BENCHMARK_F(PerformanceTest, composition_time_to_first_message)(benchmark::State & state)
+{
+  double context_init_ns = 0.0;
+  double node_construction_ns = 0.0;
+  double entity_creation_ns = 0.0;
+  double executor_registration_ns = 0.0;
+  double first_delivery_ns = 0.0;
+  size_t iterations = 0;
+
+  for (auto _ : state) {
+    (void)_;
+    const uint64_t start = now_nanoseconds();
+
+    auto context = std::make_shared<rclcpp::Context>();
+    context->init(0, nullptr, rclcpp::InitOptions().auto_initialize_logging(false));
+    const uint64_t after_context_init = now_nanoseconds();
+
+    std::vector<rclcpp::Node::SharedPtr> nodes;
+    const auto node_options = rclcpp::NodeOptions().context(context);
+    for (size_t i = 0; i < kNumNodes; i++) {
+      nodes.push_back(
+        std::make_shared<rclcpp::Node>("startup_node_" + std::to_string(i), node_options));
+    }
+    const uint64_t after_node_construction = now_nanoseconds();
+
+    std::atomic<bool> delivered {false};
+    std::vector<rclcpp::Publisher<test_msgs::msg::BasicTypes>::SharedPtr> publishers;
+    std::vector<rclcpp::Subscription<test_msgs::msg::BasicTypes>::SharedPtr> subscriptions;
+    auto callback = [&delivered](test_msgs::msg::BasicTypes::ConstSharedPtr) {
+        delivered.store(true);
+      };
+    for (const auto & node : nodes) {
+      for (size_t i = 0; i < kPublishersPerNode; i++) {
+        publishers.push_back(
+          node->create_publisher<test_msgs::msg::BasicTypes>(
+            "/composition_startup", rclcpp::QoS(10)));
+      }
+      for (size_t i = 0; i < kSubscriptionsPerNode; i++) {
+        subscriptions.push_back(
+          node->create_subscription<test_msgs::msg::BasicTypes>(
+            "/composition_startup", rclcpp::QoS(10), callback));
+      }
+    }
+    const uint64_t after_entity_creation = now_nanoseconds();
+
+    rclcpp::ExecutorOptions exec_options;
+    exec_options.context = context;
+    rclcpp::executors::SingleThreadedExecutor executor(exec_options);
+    for (const auto & node : nodes) {
+      executor.add_node(node);
+    }
+    const uint64_t after_executor_registration = now_nanoseconds();
+
+    test_msgs::msg::BasicTypes msg;
+    publishers.front()->publish(msg);
+    const auto deadline = std::chrono::steady_clock::now() + 10s;
+    while (!delivered.load() && std::chrono::steady_clock::now() < deadline) {
+      executor.spin_some();
+    }
+    const uint64_t after_first_delivery = now_nanoseconds();
+    if (!delivered.load()) {
+      state.SkipWithError("Timed out waiting for the first message delivery");
+      break;
+    }
+
+    context_init_ns += static_cast<double>(after_context_init - start);
+    node_construction_ns += static_cast<double>(after_node_construction - after_context_init);
+    entity_creation_ns += static_cast<double>(after_entity_creation - after_node_construction);
+    executor_registration_ns +=
+      static_cast<double>(after_executor_registration - after_entity_creation);
+    first_delivery_ns += static_cast<double>(after_first_delivery - after_executor_registration);
+    iterations++;
+
+    state.PauseTiming();
+    for (const auto & node : nodes) {
+      executor.remove_node(node);
+    }
+    subscriptions.clear();
+    publishers.clear();
+    nodes.clear();
+    context->shutdown("benchmark iteration complete");
+    state.ResumeTiming();
+  }
+
+  if (iterations > 0) {
+    const double count = static_cast<double>(iterations);
+    state.counters["context_init_ns"] = context_init_ns / count;
+    state.counters["node_construction_ns"] = node_construction_ns / count;
+    state.counters["entity_creation_ns"] = entity_creation_ns / count;
+    state.counters["executor_registration_ns"] = executor_registration_ns / count;
+    state.counters["first_delivery_ns"] = first_delivery_ns / count;
+  }
+}
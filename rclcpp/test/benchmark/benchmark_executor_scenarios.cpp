@@ -0,0 +1,278 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+
+#include "rclcpp/rclcpp.hpp"
+#include "rclcpp/experimental/executors/events_executor/events_executor.hpp"
+#include "test_msgs/msg/basic_types.hpp"
+
+using namespace std::chrono_literals;
+using performance_test_fixture::PerformanceTest;
+
+namespace
+{
+
+constexpr size_t kMessagesPerPublisherPerIteration = 10;
+constexpr size_t kQueueDepth = 1000;
+
+uint64_t
+now_nanoseconds()
+{
+  return static_cast<uint64_t>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+double
+percentile(const std::vector<double> & sorted_samples, double fraction)
+{
+  if (sorted_samples.empty()) {
+    return 0.0;
+  }
+  size_t index = static_cast<size_t>(fraction * static_cast<double>(sorted_samples.size() - 1));
+  return sorted_samples[index];
+}
+
+}  // namespace
+
+/// Executor scenarios the hot paths are tuned against.
+/**
+ * Each scenario publishes stamped messages through a fan-in topology and
+ * drains them with the executor under test, reporting delivered messages as
+ * items processed (throughput) and p50/p99/p999 publish-to-callback latency
+ * as counters, so changes to the executor hot paths show up as more than an
+ * average.
+ */
+class ExecutorScenarios : public PerformanceTest
+{
+public:
+  void SetUp(benchmark::State & st)
+  {
+    rclcpp::init(0, nullptr);
+    delivered_count = 0;
+    expected_count = 0;
+    latency_samples.clear();
+    PerformanceTest::SetUp(st);
+  }
+
+  void TearDown(benchmark::State & st)
+  {
+    PerformanceTest::TearDown(st);
+    subscriptions.clear();
+    publishers.clear();
+    subscription_node.reset();
+    publisher_node.reset();
+    rclcpp::shutdown();
+  }
+
+protected:
+  /// Create N publishers and M subscriptions on one topic.
+  void
+  create_fan_in_workload(
+    size_t num_publishers,
+    size_t num_subscriptions,
+    bool intra_process = false,
+    rclcpp::CallbackGroupType group_type = rclcpp::CallbackGroupType::MutuallyExclusive,
+    bool shared_group = false)
+  {
+    auto node_options = rclcpp::NodeOptions().use_intra_process_comms(intra_process);
+    publisher_node = std::make_shared<rclcpp::Node>("scenario_publishers", node_options);
+    subscription_node = std::make_shared<rclcpp::Node>("scenario_subscriptions", node_options);
+
+    for (size_t i = 0; i < num_publishers; i++) {
+      publishers.push_back(
+        publisher_node->create_publisher<test_msgs::msg::BasicTypes>(
+          "/executor_scenarios", rclcpp::QoS(kQueueDepth)));
+    }
+
+    rclcpp::CallbackGroup::SharedPtr group = nullptr;
+    for (size_t i = 0; i < num_subscriptions; i++) {
+      if (nullptr == group || !shared_group) {
+        group = subscription_node->create_callback_group(group_type);
+      }
+      rclcpp::SubscriptionOptions subscription_options;
+      subscription_options.callback_group = group;
+      auto callback = [this](test_msgs::msg::BasicTypes::ConstSharedPtr msg) {
+          double latency = static_cast<double>(now_nanoseconds() - msg->uint64_value);
+          std::lock_guard<std::mutex> lock(delivery_mutex);
+          latency_samples.push_back(latency);
+          if (++delivered_count >= expected_count) {
+            delivery_cv.notify_one();
+          }
+        };
+      subscriptions.push_back(
+        subscription_node->create_subscription<test_msgs::msg::BasicTypes>(
+          "/executor_scenarios", rclcpp::QoS(kQueueDepth), std::move(callback),
+          subscription_options));
+    }
+  }
+
+  /// Publish a batch from every publisher and block until every delivery landed.
+  bool
+  publish_and_drain(benchmark::State & st)
+  {
+    {
+      std::lock_guard<std::mutex> lock(delivery_mutex);
+      expected_count +=
+        publishers.size() * subscriptions.size() * kMessagesPerPublisherPerIteration;
+    }
+    test_msgs::msg::BasicTypes msg;
+    for (size_t i = 0; i < kMessagesPerPublisherPerIteration; i++) {
+      for (const auto & publisher : publishers) {
+        msg.uint64_value = now_nanoseconds();
+        publisher->publish(msg);
+      }
+    }
+    std::unique_lock<std::mutex> lock(delivery_mutex);
+    if (!delivery_cv.wait_for(lock, 10s, [this]() {return delivered_count >= expected_count;})) {
+      st.SkipWithError("Timed out waiting for messages to be delivered");
+      return false;
+    }
+    return true;
+  }
+
+  /// Spin the executor on its own thread(s) and run the fan-in workload through it.
+  void
+  run_scenario(benchmark::State & st, rclcpp::Executor & executor)
+  {
+    executor.add_node(publisher_node);
+    executor.add_node(subscription_node);
+    std::thread spin_thread([&executor]() {executor.spin();});
+
+    // Warm up discovery and any lazily initialized executor state.
+    if (this->publish_and_drain(st)) {
+      {
+        std::lock_guard<std::mutex> lock(delivery_mutex);
+        latency_samples.clear();
+      }
+      reset_heap_counters();
+
+      for (auto _ : st) {
+        (void)_;
+        if (!this->publish_and_drain(st)) {
+          break;
+        }
+      }
+    }
+
+    executor.cancel();
+    spin_thread.join();
+    executor.remove_node(subscription_node);
+    executor.remove_node(publisher_node);
+
+    std::lock_guard<std::mutex> lock(delivery_mutex);
+    st.SetItemsProcessed(static_cast<int64_t>(latency_samples.size()));
+    std::sort(latency_samples.begin(), latency_samples.end());
+    st.counters["latency_p50_ns"] = percentile(latency_samples, 0.50);
+    st.counters["latency_p99_ns"] = percentile(latency_samples, 0.99);
+    st.counters["latency_p999_ns"] = percentile(latency_samples, 0.999);
+  }
+
+  rclcpp::Node::SharedPtr publisher_node;
+  rclcpp::Node::SharedPtr subscription_node;
+  std::vector<rclcpp::Publisher<test_msgs::msg::BasicTypes>::SharedPtr> publishers;
+  std::vector<rclcpp::Subscription<test_msgs::msg::BasicTypes>::SharedPtr> subscriptions;
+
+  std::mutex delivery_mutex;
+  std::condition_variable delivery_cv;
+  size_t delivered_count{0};
+  size_t expected_count{0};
+  std::vector<double> latency_samples;
+};
+
+/// N publishers fanning into M subscriptions on a single threaded executor.
+BENCHMARK_DEFINE_F(ExecutorScenarios, fan_in_single_threaded)(benchmark::State & st)
+{
+  this->create_fan_in_workload(
+    static_cast<size_t>(st.range(0)), static_cast<size_t>(st.range(1)));
+  rclcpp::executors::SingleThreadedExecutor executor;
+  this->run_scenario(st, executor);
+}
+BENCHMARK_REGISTER_F(ExecutorScenarios, fan_in_single_threaded)
+->Args({1, 1})->Args({4, 1})->Args({1, 4})->Args({4, 4})->Args({8, 8})
+->UseRealTime()->Unit(benchmark::kMillisecond);
+
+/// Thread-count scaling curve for the multi threaded executor.
+/**
+ * Subscriptions use one reentrant group so added threads can actually run
+ * callbacks concurrently; a flat curve here means the wait/collect path is
+ * the bottleneck, not the callbacks.
+ */
+BENCHMARK_DEFINE_F(ExecutorScenarios, fan_in_multi_threaded_scaling)(benchmark::State & st)
+{
+  this->create_fan_in_workload(
+    4, 8, false, rclcpp::CallbackGroupType::Reentrant, true);
+  rclcpp::executors::MultiThreadedExecutor executor(
+    rclcpp::ExecutorOptions(), static_cast<size_t>(st.range(0)));
+  this->run_scenario(st, executor);
+}
+BENCHMARK_REGISTER_F(ExecutorScenarios, fan_in_multi_threaded_scaling)
+->Arg(1)->Arg(2)->Arg(4)->Arg(8)
+->UseRealTime()->Unit(benchmark::kMillisecond);
+
+/// Mutually exclusive vs reentrant group mix under the multi threaded executor.
+/**
+ * range(0) == 0 gives every subscription its own mutually exclusive group,
+ * range(0) == 1 puts all subscriptions in a single reentrant group.
+ */
+BENCHMARK_DEFINE_F(ExecutorScenarios, fan_in_callback_group_mix)(benchmark::State & st)
+{
+  const bool reentrant = (st.range(0) != 0);
+  this->create_fan_in_workload(
+    4, 8, false,
+    reentrant ? rclcpp::CallbackGroupType::Reentrant :
+    rclcpp::CallbackGroupType::MutuallyExclusive,
+    reentrant);
+  rclcpp::executors::MultiThreadedExecutor executor(rclcpp::ExecutorOptions(), 4);
+  this->run_scenario(st, executor);
+}
+BENCHMARK_REGISTER_F(ExecutorScenarios, fan_in_callback_group_mix)
+->Arg(0)->Arg(1)
+->UseRealTime()->Unit(benchmark::kMillisecond);
+
+/// Same fan-in workload on the events executor, to compare with the
+/// wait-set based executors above.
+BENCHMARK_DEFINE_F(ExecutorScenarios, fan_in_events_executor)(benchmark::State & st)
+{
+  this->create_fan_in_workload(
+    static_cast<size_t>(st.range(0)), static_cast<size_t>(st.range(1)));
+  rclcpp::experimental::executors::EventsExecutor executor;
+  this->run_scenario(st, executor);
+}
+BENCHMARK_REGISTER_F(ExecutorScenarios, fan_in_events_executor)
+->Args({1, 1})->Args({4, 4})->Args({8, 8})
+->UseRealTime()->Unit(benchmark::kMillisecond);
+
+/// Intra-process vs inter-process delivery of the same fan-in workload.
+BENCHMARK_DEFINE_F(ExecutorScenarios, fan_in_intra_process)(benchmark::State & st)
+{
+  const bool intra_process = (st.range(0) != 0);
+  this->create_fan_in_workload(4, 4, intra_process);
+  rclcpp::executors::SingleThreadedExecutor executor;
+  this->run_scenario(st, executor);
+}
+BENCHMARK_REGISTER_F(ExecutorScenarios, fan_in_intra_process)
+->Arg(0)->Arg(1)
+->UseRealTime()->Unit(benchmark::kMillisecond);
@@ -0,0 +1,229 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+
+#include "rclcpp/rclcpp.hpp"
+#include "test_msgs/msg/strings.hpp"
+
+using namespace std::chrono_literals;
+using performance_test_fixture::PerformanceTest;
+
+namespace
+{
+
+constexpr size_t kMessagesPerIteration = 10;
+constexpr size_t kQueueDepth = 100;
+constexpr size_t kDefaultMessageSize = 4096;
+
+}  // namespace
+
+/// Intra-process delivery through the IntraProcessManager and its buffers.
+/**
+ * All scenarios publish std::unique_ptr messages on an intra-process enabled
+ * node and drain them with spin_some, so the measured path is
+ * do_intra_process_publish, the buffers under experimental/buffers/ and the
+ * waitable hand-off -- not the middleware.  The heap counters of the fixture
+ * report allocations per iteration, which divided by the message count gives
+ * allocations per delivered message.
+ */
+class PerformanceTestIntraProcess : public PerformanceTest
+{
+public:
+  void SetUp(benchmark::State & st)
+  {
+    rclcpp::init(0, nullptr);
+    node = std::make_shared<rclcpp::Node>(
+      "intra_process_node", rclcpp::NodeOptions().use_intra_process_comms(true));
+    callback_count = 0;
+    PerformanceTest::SetUp(st);
+  }
+
+  void TearDown(benchmark::State & st)
+  {
+    PerformanceTest::TearDown(st);
+    subscriptions.clear();
+    publishers.clear();
+    node.reset();
+    rclcpp::shutdown();
+  }
+
+protected:
+  /// Publish a batch from every publisher and spin until every delivery landed.
+  void
+  publish_and_drain(
+    benchmark::State & st, rclcpp::Executor & executor, size_t message_size)
+  {
+    const size_t expected =
+      callback_count + publishers.size() * subscriptions.size() * kMessagesPerIteration;
+    for (size_t i = 0; i < kMessagesPerIteration; i++) {
+      for (const auto & publisher : publishers) {
+        auto msg = std::make_unique<test_msgs::msg::Strings>();
+        msg->string_value.assign(message_size, 'a');
+        publisher->publish(std::move(msg));
+      }
+    }
+    size_t attempts = 0;
+    while (callback_count < expected) {
+      executor.spin_some(1s);
+      if (++attempts > 100) {
+        st.SkipWithError("Not all intra-process messages were delivered");
+        break;
+      }
+    }
+  }
+
+  void
+  add_publishers(size_t count)
+  {
+    for (size_t i = 0; i < count; i++) {
+      publishers.push_back(
+        node->create_publisher<test_msgs::msg::Strings>(
+          "/intra_process_benchmark", rclcpp::QoS(kQueueDepth)));
+    }
+  }
+
+  /// Add subscriptions taking ConstSharedPtr, i.e. shared buffers.
+  void
+  add_shared_ptr_subscriptions(
+    size_t count, const rclcpp::SubscriptionOptions & options = rclcpp::SubscriptionOptions())
+  {
+    for (size_t i = 0; i < count; i++) {
+      subscriptions.push_back(
+        node->create_subscription<test_msgs::msg::Strings>(
+          "/intra_process_benchmark", rclcpp::QoS(kQueueDepth),
+          [this](test_msgs::msg::Strings::ConstSharedPtr) {this->callback_count++;},
+          options));
+    }
+  }
+
+  /// Add subscriptions taking unique_ptr, i.e. ownership-transfer buffers.
+  void
+  add_unique_ptr_subscriptions(size_t count)
+  {
+    for (size_t i = 0; i < count; i++) {
+      subscriptions.push_back(
+        node->create_subscription<test_msgs::msg::Strings>(
+          "/intra_process_benchmark", rclcpp::QoS(kQueueDepth),
+          [this](std::unique_ptr<test_msgs::msg::Strings>) {this->callback_count++;}));
+    }
+  }
+
+  void
+  run_and_report(benchmark::State & st, size_t message_size)
+  {
+    rclcpp::executors::SingleThreadedExecutor executor;
+    executor.add_node(node);
+
+    // Warm up the buffers and any lazily created executor state.
+    this->publish_and_drain(st, executor, message_size);
+    callback_count = 0;
+    reset_heap_counters();
+
+    size_t delivered = 0;
+    for (auto _ : st) {
+      (void)_;
+      this->publish_and_drain(st, executor, message_size);
+      delivered += publishers.size() * subscriptions.size() * kMessagesPerIteration;
+    }
+    st.SetItemsProcessed(static_cast<int64_t>(delivered));
+    st.SetBytesProcessed(static_cast<int64_t>(delivered * message_size));
+  }
+
+  rclcpp::Node::SharedPtr node;
+  std::vector<rclcpp::Publisher<test_msgs::msg::Strings>::SharedPtr> publishers;
+  std::vector<rclcpp::Subscription<test_msgs::msg::Strings>::SharedPtr> subscriptions;
+  size_t callback_count;
+};
+
+/// Message size sweep with one publisher and one shared_ptr subscription.
+BENCHMARK_DEFINE_F(PerformanceTestIntraProcess, message_size_shared_ptr)(benchmark::State & st)
+{
+  this->add_publishers(1);
+  this->add_shared_ptr_subscriptions(1);
+  this->run_and_report(st, static_cast<size_t>(st.range(0)));
+}
+BENCHMARK_REGISTER_F(PerformanceTestIntraProcess, message_size_shared_ptr)
+->RangeMultiplier(8)->Range(64, 8 << 20);
+
+/// Message size sweep with one publisher and one unique_ptr subscription.
+/**
+ * With a single ownership-transfer taker the published message should move
+ * through the buffer without being copied, so this curve staying flat as the
+ * size grows is the zero-copy property itself.
+ */
+BENCHMARK_DEFINE_F(PerformanceTestIntraProcess, message_size_unique_ptr)(benchmark::State & st)
+{
+  this->add_publishers(1);
+  this->add_unique_ptr_subscriptions(1);
+  this->run_and_report(st, static_cast<size_t>(st.range(0)));
+}
+BENCHMARK_REGISTER_F(PerformanceTestIntraProcess, message_size_unique_ptr)
+->RangeMultiplier(8)->Range(64, 8 << 20);
+
+/// Publisher/subscription count sweep at a fixed message size.
+BENCHMARK_DEFINE_F(PerformanceTestIntraProcess, fan_out)(benchmark::State & st)
+{
+  this->add_publishers(static_cast<size_t>(st.range(0)));
+  this->add_shared_ptr_subscriptions(static_cast<size_t>(st.range(1)));
+  this->run_and_report(st, kDefaultMessageSize);
+}
+BENCHMARK_REGISTER_F(PerformanceTestIntraProcess, fan_out)
+->Args({1, 1})->Args({1, 4})->Args({4, 1})->Args({4, 4})->Args({8, 8});
+
+/// Mixed shared_ptr and unique_ptr takers on one topic.
+/**
+ * The interesting case for the IntraProcessManager: it has to hand
+ * ownership to exactly one taker and shared references to the rest.
+ */
+BENCHMARK_DEFINE_F(PerformanceTestIntraProcess, mixed_taker_kinds)(benchmark::State & st)
+{
+  this->add_publishers(1);
+  this->add_shared_ptr_subscriptions(static_cast<size_t>(st.range(0)));
+  this->add_unique_ptr_subscriptions(static_cast<size_t>(st.range(1)));
+  this->run_and_report(st, kDefaultMessageSize);
+}
+BENCHMARK_REGISTER_F(PerformanceTestIntraProcess, mixed_taker_kinds)
+->Args({1, 1})->Args({3, 1})->Args({1, 3});
+
+/// Per-subscription mutually exclusive groups vs one shared reentrant group.
+/**
+ * Group membership decides how the subscriptions are collected and
+ * dispatched; even on a single thread the bookkeeping differs.
+ */
+BENCHMARK_DEFINE_F(PerformanceTestIntraProcess, callback_group_mix)(benchmark::State & st)
+{
+  this->add_publishers(1);
+  if (0 == st.range(0)) {
+    for (size_t i = 0; i < 4; i++) {
+      rclcpp::SubscriptionOptions options;
+      options.callback_group =
+        node->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+      this->add_shared_ptr_subscriptions(1, options);
+    }
+  } else {
+    rclcpp::SubscriptionOptions options;
+    options.callback_group =
+      node->create_callback_group(rclcpp::CallbackGroupType::Reentrant);
+    this->add_shared_ptr_subscriptions(4, options);
+  }
+  this->run_and_report(st, kDefaultMessageSize);
+}
+BENCHMARK_REGISTER_F(PerformanceTestIntraProcess, callback_group_mix)
+->Arg(0)->Arg(1);
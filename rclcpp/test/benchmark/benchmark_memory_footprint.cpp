@@ -0,0 +1,236 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+
+#include "rclcpp/allocation_audit.hpp"
+#include "rclcpp/rclcpp.hpp"
+#include "test_msgs/msg/basic_types.hpp"
+#include "test_msgs/srv/basic_types.hpp"
+
+using namespace std::chrono_literals;
+using performance_test_fixture::PerformanceTest;
+
+namespace
+{
+
+/// Net bytes currently allocated through the replaced global operator new.
+std::atomic<int64_t> g_live_bytes {0};
+
+/// Prefix storing the allocation size, kept maximally aligned.
+constexpr size_t kHeaderSize = alignof(std::max_align_t);
+
+constexpr size_t kEntitiesPerSample = 64;
+
+}  // namespace
+
+// Replace the global allocation functions with counting versions, so the
+// measured footprint covers every C++-side allocation an entity retains,
+// including the ones made inside the library. The array and nothrow forms
+// forward to these per the standard; over-aligned allocations bypass the
+// counter but pair with their own deallocation functions, so the balance
+// stays correct.
+void *
+operator new(std::size_t size)
+{
+  void * raw = std::malloc(size + kHeaderSize);
+  if (nullptr == raw) {
+    throw std::bad_alloc();
+  }
+  *static_cast<size_t *>(raw) = size;
+  g_live_bytes.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed);
+  return static_cast<char *>(raw) + kHeaderSize;
+}
+
+void
+operator delete(void * pointer) noexcept
+{
+  if (nullptr == pointer) {
+    return;
+  }
+  void * raw = static_cast<char *>(pointer) - kHeaderSize;
+  const size_t size = *static_cast<size_t *>(raw);
+  g_live_bytes.fetch_sub(static_cast<int64_t>(size), std::memory_order_relaxed);
+  std::free(raw);
+}
+
+void
+operator delete(void * pointer, std::size_t) noexcept
+{
+  operator delete(pointer);
+}
+
+/// Per-entity memory footprint, measured behind a counting allocator.
+/**
+ * Each sample creates a batch of identical entities, reads the net live
+ * bytes they retain and reports the per-entity average as a counter, at
+ * several QoS depths where the history depth shapes the buffers. The
+ * numbers are the end-to-end C++-side cost of keeping one entity alive,
+ * which is what edge-device provisioning needs; the timing dimension of
+ * these benchmarks is meaningless and should be ignored.
+ */
+class MemoryFootprintTest : public PerformanceTest
+{
+public:
+  void SetUp(benchmark::State & state)
+  {
+    rclcpp::init(0, nullptr);
+    node = std::make_shared<rclcpp::Node>("memory_footprint_node");
+    PerformanceTest::SetUp(state);
+  }
+
+  void TearDown(benchmark::State & state)
+  {
+    PerformanceTest::TearDown(state);
+    node.reset();
+    rclcpp::shutdown();
+  }
+
+protected:
+  /// Create a batch of entities and return the average net bytes retained by one.
+  template<typename CreateOneT>
+  double
+  sample_entity_bytes(CreateOneT && create_one)
+  {
+    std::vector<std::shared_ptr<void>> entities;
+    entities.reserve(kEntitiesPerSample);
+    const int64_t before = g_live_bytes.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < kEntitiesPerSample; i++) {
+      entities.push_back(create_one());
+    }
+    const int64_t after = g_live_bytes.load(std::memory_order_relaxed);
+    return static_cast<double>(after - before) / static_cast<double>(kEntitiesPerSample);
+  }
+
+  std::shared_ptr<rclcpp::Node> node;
+};
+
+BENCHMARK_F(MemoryFootprintTest, publisher_footprint)(benchmark::State & state)
+{
+  for (auto _ : state) {
+    (void)_;
+    for (size_t depth : {1u, 10u, 100u, 1000u}) {
+      state.counters["bytes_per_publisher_depth_" + std::to_string(depth)] =
+        sample_entity_bytes(
+        [this, depth]() {
+          return node->create_publisher<test_msgs::msg::BasicTypes>(
+            "/memory_footprint", rclcpp::QoS(depth));
+        });
+    }
+  }
+}
+
+BENCHMARK_F(MemoryFootprintTest, subscription_footprint)(benchmark::State & state)
+{
+  auto callback = [](test_msgs::msg::BasicTypes::ConstSharedPtr) {};
+  for (auto _ : state) {
+    (void)_;
+    for (size_t depth : {1u, 10u, 100u, 1000u}) {
+      state.counters["bytes_per_subscription_depth_" + std::to_string(depth)] =
+        sample_entity_bytes(
+        [this, depth, callback]() {
+          return node->create_subscription<test_msgs::msg::BasicTypes>(
+            "/memory_footprint", rclcpp::QoS(depth), callback);
+        });
+    }
+  }
+}
+
+BENCHMARK_F(MemoryFootprintTest, timer_footprint)(benchmark::State & state)
+{
+  for (auto _ : state) {
+    (void)_;
+    state.counters["bytes_per_timer"] =
+      sample_entity_bytes([this]() {return node->create_wall_timer(1h, []() {});});
+  }
+}
+
+BENCHMARK_F(MemoryFootprintTest, service_footprint)(benchmark::State & state)
+{
+  auto callback = [](const std::shared_ptr<test_msgs::srv::BasicTypes::Request>,
+      std::shared_ptr<test_msgs::srv::BasicTypes::Response>) {};
+  for (auto _ : state) {
+    (void)_;
+    state.counters["bytes_per_service"] =
+      sample_entity_bytes(
+      [this, callback]() {
+        return node->create_service<test_msgs::srv::BasicTypes>("/memory_footprint", callback);
+      });
+  }
+}
+
+BENCHMARK_F(MemoryFootprintTest, client_footprint)(benchmark::State & state)
+{
+  for (auto _ : state) {
+    (void)_;
+    state.counters["bytes_per_client"] =
+      sample_entity_bytes(
+      [this]() {
+        return node->create_client<test_msgs::srv::BasicTypes>("/memory_footprint");
+      });
+  }
+}
+
+BENCHMARK_F(MemoryFootprintTest, audited_entity_footprint)(benchmark::State & state)
+{
+  // The same measurement through the allocation-audit resource: a node backed
+  // by an AuditingMemoryResource records the allocations the library routes
+  // through the node's memory resource, which is the arena-sizing view (what
+  // a preallocated arena must hold) as opposed to the whole-process view of
+  // the counting allocator above.
+  rclcpp::allocation_audit::AuditingMemoryResource audited_resource("memory_footprint_benchmark");
+  auto audited_node = std::make_shared<rclcpp::Node>(
+    "memory_footprint_audited_node",
+    rclcpp::NodeOptions().memory_resource(&audited_resource));
+
+  auto callback = [](test_msgs::msg::BasicTypes::ConstSharedPtr) {};
+  for (auto _ : state) {
+    (void)_;
+    rclcpp::allocation_audit::reset();
+    rclcpp::allocation_audit::enable();
+
+    std::vector<std::shared_ptr<void>> entities;
+    entities.reserve(2 * kEntitiesPerSample);
+    for (size_t i = 0; i < kEntitiesPerSample; i++) {
+      entities.push_back(
+        audited_node->create_publisher<test_msgs::msg::BasicTypes>(
+          "/memory_footprint", rclcpp::QoS(10)));
+      entities.push_back(
+        audited_node->create_subscription<test_msgs::msg::BasicTypes>(
+          "/memory_footprint", rclcpp::QoS(10), callback));
+    }
+
+    rclcpp::allocation_audit::disable();
+    double audited_bytes = 0.0;
+    for (const auto & callsite : rclcpp::allocation_audit::report()) {
+      audited_bytes += static_cast<double>(callsite.pre_init_bytes + callsite.post_init_bytes);
+    }
+    state.counters["audited_bytes_per_entity"] =
+      audited_bytes / static_cast<double>(2 * kEntitiesPerSample);
+
+    state.PauseTiming();
+    entities.clear();
+    state.ResumeTiming();
+  }
+}
@@ -0,0 +1,121 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <memory_resource>
+
+#include "rclcpp/allocator/allocator_common.hpp"
+#include "rclcpp/allocator/pmr_allocator.hpp"
+
+namespace
+{
+
+/// Counts bytes through to the default resource, to verify sizes match.
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+  size_t allocated_bytes = 0;
+  size_t deallocated_bytes = 0;
+
+protected:
+  void * do_allocate(size_t bytes, size_t alignment) override
+  {
+    allocated_bytes += bytes;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void * pointer, size_t bytes, size_t alignment) override
+  {
+    deallocated_bytes += bytes;
+    std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource & other) const noexcept override
+  {
+    return this == &other;
+  }
+};
+
+}  // namespace
+
+TEST(TestPmrAllocator, null_resource_throws) {
+  EXPECT_THROW(
+    rclcpp::allocator::get_rcl_allocator_from_memory_resource(nullptr),
+    std::invalid_argument);
+}
+
+TEST(TestPmrAllocator, allocate_deallocate) {
+  CountingResource resource;
+  rcl_allocator_t allocator =
+    rclcpp::allocator::get_rcl_allocator_from_memory_resource(&resource);
+  EXPECT_EQ(&resource, allocator.state);
+
+  void * pointer = allocator.allocate(100, allocator.state);
+  ASSERT_NE(nullptr, pointer);
+  std::memset(pointer, 0xab, 100);
+  allocator.deallocate(pointer, allocator.state);
+
+  EXPECT_GE(resource.allocated_bytes, 100u);
+  // Deallocation must pass the exact size back to the resource.
+  EXPECT_EQ(resource.allocated_bytes, resource.deallocated_bytes);
+}
+
+TEST(TestPmrAllocator, zero_allocate) {
+  CountingResource resource;
+  rcl_allocator_t allocator =
+    rclcpp::allocator::get_rcl_allocator_from_memory_resource(&resource);
+
+  auto pointer = static_cast<char *>(allocator.zero_allocate(10, 4, allocator.state));
+  ASSERT_NE(nullptr, pointer);
+  for (size_t i = 0; i < 40; ++i) {
+    EXPECT_EQ(0, pointer[i]);
+  }
+  allocator.deallocate(pointer, allocator.state);
+  EXPECT_EQ(resource.allocated_bytes, resource.deallocated_bytes);
+}
+
+TEST(TestPmrAllocator, reallocate) {
+  CountingResource resource;
+  rcl_allocator_t allocator =
+    rclcpp::allocator::get_rcl_allocator_from_memory_resource(&resource);
+
+  // Reallocating a null pointer allocates.
+  auto pointer = static_cast<char *>(allocator.reallocate(nullptr, 8, allocator.state));
+  ASSERT_NE(nullptr, pointer);
+  std::memcpy(pointer, "abcdefg", 8);
+
+  // Growing preserves the old contents.
+  pointer = static_cast<char *>(allocator.reallocate(pointer, 64, allocator.state));
+  ASSERT_NE(nullptr, pointer);
+  EXPECT_STREQ("abcdefg", pointer);
+
+  // Reallocating to zero frees.
+  EXPECT_EQ(nullptr, allocator.reallocate(pointer, 0, allocator.state));
+  EXPECT_EQ(resource.allocated_bytes, resource.deallocated_bytes);
+}
+
+TEST(TestPmrAllocator, get_rcl_allocator_wraps_resource) {
+  CountingResource resource;
+  rclcpp::allocator::PolymorphicAllocator<void *> polymorphic_allocator(&resource);
+
+  rcl_allocator_t allocator = rclcpp::allocator::get_rcl_allocator<void *>(polymorphic_allocator);
+  EXPECT_EQ(&resource, allocator.state);
+
+  void * pointer = allocator.allocate(32, allocator.state);
+  ASSERT_NE(nullptr, pointer);
+  allocator.deallocate(pointer, allocator.state);
+  EXPECT_EQ(resource.allocated_bytes, resource.deallocated_bytes);
+}
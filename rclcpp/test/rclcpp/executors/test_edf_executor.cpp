@@ -0,0 +1,171 @@
+// Copyright 2024 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "rclcpp/exceptions.hpp"
+#include "rclcpp/node.hpp"
+#include "rclcpp/rclcpp.hpp"
+#include "rclcpp/executors/edf_executor.hpp"
+
+using namespace std::chrono_literals;
+
+class TestEdfExecutor : public ::testing::Test
+{
+protected:
+  static void SetUpTestCase()
+  {
+    rclcpp::init(0, nullptr);
+  }
+};
+
+namespace
+{
+
+// A labelled timer in its own mutually exclusive callback group. Every timer
+// is ready well before spin() is called, so the first scheduling round sees
+// them all at once and the recorded order is the executor's, not the wakeup's.
+struct LabelledTimer
+{
+  rclcpp::CallbackGroup::SharedPtr group;
+  rclcpp::TimerBase::SharedPtr timer;
+};
+
+LabelledTimer
+add_timer(
+  rclcpp::Node & node,
+  rclcpp::executors::EdfExecutor & executor,
+  std::vector<std::string> & order,
+  const std::string & label,
+  size_t expected_count)
+{
+  LabelledTimer result;
+  result.group = node.create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+  result.timer = node.create_wall_timer(
+    1ms,
+    [&order, &executor, label, expected_count]() {
+      if (order.size() < expected_count) {
+        order.push_back(label);
+      }
+      if (order.size() >= expected_count) {
+        executor.cancel();
+      }
+    },
+    result.group);
+  return result;
+}
+
+}  // namespace
+
+/*
+   Ready callbacks run in order of their groups' deadlines, not in the order
+   the entities were added.
+ */
+TEST_F(TestEdfExecutor, earliest_deadline_first) {
+  rclcpp::executors::EdfExecutor executor;
+  auto node = std::make_shared<rclcpp::Node>("test_edf_deadlines");
+
+  std::vector<std::string> order;
+  auto late = add_timer(*node, executor, order, "late", 3u);
+  auto early = add_timer(*node, executor, order, "early", 3u);
+  auto middle = add_timer(*node, executor, order, "middle", 3u);
+  late.group->set_scheduling_deadline(300ms);
+  early.group->set_scheduling_deadline(100ms);
+  middle.group->set_scheduling_deadline(200ms);
+
+  executor.add_node(node);
+  // Let every timer become ready before the first scheduling round.
+  std::this_thread::sleep_for(50ms);
+  executor.spin();
+
+  ASSERT_EQ(3u, order.size());
+  EXPECT_EQ("early", order[0]);
+  EXPECT_EQ("middle", order[1]);
+  EXPECT_EQ("late", order[2]);
+}
+
+/*
+   Groups without a deadline fall back to descending priority order.
+ */
+TEST_F(TestEdfExecutor, priority_fallback_without_deadlines) {
+  rclcpp::executors::EdfExecutor executor;
+  auto node = std::make_shared<rclcpp::Node>("test_edf_priorities");
+
+  std::vector<std::string> order;
+  auto low = add_timer(*node, executor, order, "low", 3u);
+  auto high = add_timer(*node, executor, order, "high", 3u);
+  auto medium = add_timer(*node, executor, order, "medium", 3u);
+  low.group->set_scheduling_priority(1);
+  high.group->set_scheduling_priority(10);
+  medium.group->set_scheduling_priority(5);
+
+  executor.add_node(node);
+  std::this_thread::sleep_for(50ms);
+  executor.spin();
+
+  ASSERT_EQ(3u, order.size());
+  EXPECT_EQ("high", order[0]);
+  EXPECT_EQ("medium", order[1]);
+  EXPECT_EQ("low", order[2]);
+}
+
+/*
+   Any deadline-bearing group outranks every group without one, regardless of
+   priorities, and priority breaks the tie among the deadline-less rest.
+ */
+TEST_F(TestEdfExecutor, deadlines_outrank_priorities) {
+  rclcpp::executors::EdfExecutor executor;
+  auto node = std::make_shared<rclcpp::Node>("test_edf_mixed");
+
+  std::vector<std::string> order;
+  auto urgent = add_timer(*node, executor, order, "deadline", 3u);
+  auto loud = add_timer(*node, executor, order, "high_priority", 3u);
+  auto quiet = add_timer(*node, executor, order, "low_priority", 3u);
+  urgent.group->set_scheduling_deadline(1s);
+  loud.group->set_scheduling_priority(100);
+  quiet.group->set_scheduling_priority(-100);
+
+  executor.add_node(node);
+  std::this_thread::sleep_for(50ms);
+  executor.spin();
+
+  ASSERT_EQ(3u, order.size());
+  EXPECT_EQ("deadline", order[0]);
+  EXPECT_EQ("high_priority", order[1]);
+  EXPECT_EQ("low_priority", order[2]);
+}
+
+/*
+   Calling spin() while already spinning throws.
+ */
+TEST_F(TestEdfExecutor, spin_twice_throws) {
+  rclcpp::executors::EdfExecutor executor;
+  auto node = std::make_shared<rclcpp::Node>("test_edf_spin_twice");
+
+  auto group = node->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+  auto timer = node->create_wall_timer(1ms, []() {}, group);
+  executor.add_node(node);
+
+  std::thread spinner([&executor]() {executor.spin();});
+  std::this_thread::sleep_for(50ms);
+  EXPECT_THROW(executor.spin(), std::runtime_error);
+  executor.cancel();
+  spinner.join();
+}
@@ -53,6 +53,43 @@ TEST_F(TestExecutorEntitiesCollector, add_remove_node) {
   EXPECT_NO_THROW(entities_collector->update_collections());
 }
 
+TEST_F(TestExecutorEntitiesCollector, generation_tracks_membership) {
+  auto node1 = std::make_shared<rclcpp::Node>("node1", "ns");
+
+  auto generation = entities_collector->get_generation();
+
+  // Adding a node changes the generation once the queues are processed
+  entities_collector->add_node(node1->get_node_base_interface());
+  EXPECT_EQ(generation, entities_collector->get_generation());
+  entities_collector->update_collections();
+  EXPECT_NE(generation, entities_collector->get_generation());
+
+  // Updating with unchanged membership leaves the generation alone
+  generation = entities_collector->get_generation();
+  entities_collector->update_collections();
+  EXPECT_EQ(generation, entities_collector->get_generation());
+
+  // Removing the node changes the generation again
+  entities_collector->remove_node(node1->get_node_base_interface());
+  entities_collector->update_collections();
+  EXPECT_NE(generation, entities_collector->get_generation());
+}
+
+TEST_F(TestExecutorEntitiesCollector, remove_destroyed_node) {
+  auto node1 = std::make_shared<rclcpp::Node>("node1", "ns");
+  auto node1_base = node1->get_node_base_interface();
+
+  entities_collector->add_node(node1_base);
+  entities_collector->update_collections();
+
+  // Destroy the node before removing it; its automatically added groups must
+  // still be released via the per-node registry
+  entities_collector->remove_node(node1_base);
+  node1.reset();
+  EXPECT_NO_THROW(entities_collector->update_collections());
+  EXPECT_EQ(0u, entities_collector->get_all_callback_groups().size());
+}
+
 TEST_F(TestExecutorEntitiesCollector, add_node_twice) {
   auto node1 = std::make_shared<rclcpp::Node>("node1", "ns");
 
@@ -14,9 +14,14 @@
 
 #include <gtest/gtest.h>
 
+#ifndef _WIN32
+#include <poll.h>
+#endif
+
 #include <chrono>
 #include <memory>
 #include <string>
+#include <thread>
 
 #include "rclcpp/experimental/executors/events_executor/events_executor.hpp"
 
@@ -321,6 +326,68 @@ TEST_F(TestEventsExecutor, spin_all_max_duration)
   EXPECT_THROW(executor.spin_all(-5ms), std::invalid_argument);
 }
 
+TEST_F(TestEventsExecutor, inline_timers_mode)
+{
+  auto node = std::make_shared<rclcpp::Node>("node");
+
+  // The inline mode drives timers from the spin loop, without the timers thread.
+  EventsExecutor executor(
+    std::make_unique<rclcpp::experimental::executors::SimpleEventsQueue>(),
+    false,
+    rclcpp::ExecutorOptions(),
+    rclcpp::experimental::TimersManager::TimersStorage::HEAP,
+    true);
+  executor.add_node(node);
+
+  size_t timer_runs = 0;
+  std::thread::id timer_thread_id;
+  auto timer = node->create_wall_timer(
+    10ms,
+    [&]() {
+      timer_runs++;
+      timer_thread_id = std::this_thread::get_id();
+    });
+
+  bool msg_received = false;
+  auto sub = node->create_subscription<test_msgs::msg::Empty>(
+    "topic", rclcpp::SensorDataQoS(),
+    [&msg_received](test_msgs::msg::Empty::ConstSharedPtr) {
+      msg_received = true;
+    });
+  auto publisher = node->create_publisher<test_msgs::msg::Empty>("topic", rclcpp::SensorDataQoS());
+
+  std::thread spinner([&executor, this]() {executor.spin();});
+
+  test_msgs::msg::Empty msg;
+  publisher->publish(msg);
+
+  auto start = std::chrono::steady_clock::now();
+  while ((timer_runs == 0 || !msg_received) &&
+    (std::chrono::steady_clock::now() - start < 10s))
+  {
+    std::this_thread::sleep_for(25ms);
+  }
+
+  executor.cancel();
+  auto spinner_id = spinner.get_id();
+  spinner.join();
+
+  EXPECT_TRUE(msg_received);
+  ASSERT_GT(timer_runs, 0u);
+  // Timer callbacks ran on the executor thread itself.
+  EXPECT_EQ(spinner_id, timer_thread_id);
+
+  // Inline and separate-thread timers are mutually exclusive.
+  EXPECT_THROW(
+    EventsExecutor(
+      std::make_unique<rclcpp::experimental::executors::SimpleEventsQueue>(),
+      true,
+      rclcpp::ExecutorOptions(),
+      rclcpp::experimental::TimersManager::TimersStorage::HEAP,
+      true),
+    std::invalid_argument);
+}
+
 TEST_F(TestEventsExecutor, cancel_while_timers_running)
 {
   auto node = std::make_shared<rclcpp::Node>("node");
@@ -429,6 +496,42 @@ TEST_F(TestEventsExecutor, destroy_entities)
   spinner.join();
 }
 
+TEST_F(TestEventsExecutor, stale_events_dropped_after_remove)
+{
+  auto node = std::make_shared<rclcpp::Node>("node");
+  size_t callback_count = 0;
+  auto subscription = node->create_subscription<test_msgs::msg::Empty>(
+    "topic", rclcpp::QoS(10), [&](test_msgs::msg::Empty::ConstSharedPtr) {callback_count++;});
+  auto publisher = node->create_publisher<test_msgs::msg::Empty>("topic", rclcpp::QoS(10));
+
+  EventsExecutor executor;
+  executor.add_node(node);
+
+  // Queue an event for the subscription, then remove the node before spinning.
+  // The queued event's entity id is stale by the time it is dispatched, so it
+  // must be dropped without executing the subscription.
+  publisher->publish(std::make_unique<test_msgs::msg::Empty>());
+  std::this_thread::sleep_for(100ms);
+  executor.remove_node(node);
+  executor.spin_some(10ms);
+  EXPECT_EQ(0u, callback_count);
+
+  // Re-adding the node re-registers its entities and delivery resumes.
+  executor.add_node(node);
+  publisher->publish(std::make_unique<test_msgs::msg::Empty>());
+  auto start = std::chrono::high_resolution_clock::now();
+  while (
+    callback_count == 0 &&
+    (std::chrono::high_resolution_clock::now() - start < 1s))
+  {
+    executor.spin_some(10ms);
+    std::this_thread::sleep_for(25ms);
+  }
+  EXPECT_EQ(1u, callback_count);
+
+  executor.remove_node(node);
+}
+
 // Testing construction of a subscriptions with QoS event callback functions.
 std::string * g_pub_log_msg;
 std::string * g_sub_log_msg;
@@ -492,3 +595,60 @@ TEST_F(TestEventsExecutor, test_default_incompatible_qos_callbacks)
 
   rcutils_logging_set_output_handler(original_output_handler);
 }
+
+#ifndef _WIN32
+TEST_F(TestEventsExecutor, wakeup_fd_drives_external_loop)
+{
+  auto node = std::make_shared<rclcpp::Node>("node");
+
+  size_t messages_received = 0;
+  auto subscription = node->create_subscription<test_msgs::msg::Empty>(
+    "topic", rclcpp::SensorDataQoS(),
+    [&messages_received](test_msgs::msg::Empty::ConstSharedPtr) {messages_received++;});
+  auto publisher = node->create_publisher<test_msgs::msg::Empty>("topic", rclcpp::SensorDataQoS());
+
+  EventsExecutor executor;
+  executor.add_node(node);
+
+  int wakeup_fd = executor.get_wakeup_fd();
+  ASSERT_GE(wakeup_fd, 0);
+  // Repeated calls hand out the same descriptor.
+  EXPECT_EQ(wakeup_fd, executor.get_wakeup_fd());
+
+  publisher->publish(test_msgs::msg::Empty());
+
+  // A minimal external event loop: poll the descriptor, process on wakeup.
+  struct pollfd poll_entry;
+  poll_entry.fd = wakeup_fd;
+  poll_entry.events = POLLIN;
+  auto start = std::chrono::steady_clock::now();
+  while (0 == messages_received && (std::chrono::steady_clock::now() - start) < 5s) {
+    if (poll(&poll_entry, 1, 100) > 0) {
+      executor.process_ready();
+    }
+  }
+  EXPECT_EQ(1u, messages_received);
+
+  executor.remove_node(node);
+}
+
+TEST_F(TestEventsExecutor, process_ready_executes_expired_timers)
+{
+  auto node = std::make_shared<rclcpp::Node>("node");
+
+  size_t timer_calls = 0;
+  auto timer = node->create_wall_timer(10ms, [&timer_calls]() {timer_calls++;});
+
+  EventsExecutor executor;
+  executor.add_node(node);
+
+  // With no thread watching timers, the external loop polls with this timeout.
+  EXPECT_LE(executor.time_until_next_timer(), 10ms);
+
+  std::this_thread::sleep_for(15ms);
+  EXPECT_GE(executor.process_ready(), 1u);
+  EXPECT_GE(timer_calls, 1u);
+
+  executor.remove_node(node);
+}
+#endif  // _WIN32
@@ -15,9 +15,13 @@
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <thread>
+#include <vector>
 
 #include "rclcpp/experimental/executors/events_executor/events_executor_event_types.hpp"
+#include "rclcpp/experimental/executors/events_executor/lock_free_events_queue.hpp"
 #include "rclcpp/experimental/executors/events_executor/simple_events_queue.hpp"
+#include "rclcpp/wait_strategy.hpp"
 
 using namespace std::chrono_literals;
 
@@ -80,3 +84,158 @@ TEST(TestEventsQueue, SimpleQueueTest)
   EXPECT_EQ(push_event.type, event.type);
   EXPECT_EQ(push_event.num_events, event.num_events);
 }
+
+TEST(TestEventsQueue, SimpleQueueSpinThenPark)
+{
+  // The spinning queue keeps the same dequeue contract as the parking one
+  rclcpp::WaitStrategy strategy;
+  strategy.kind = rclcpp::WaitStrategyKind::SpinThenPark;
+  auto simple_queue =
+    std::make_unique<rclcpp::experimental::executors::SimpleEventsQueue>(strategy);
+  rclcpp::experimental::executors::ExecutorEvent event {};
+
+  // Timed-out dequeue on an empty queue still reports no event
+  EXPECT_FALSE(simple_queue->dequeue(event, std::chrono::milliseconds(1)));
+
+  // An event enqueued while the consumer waits is picked up, whether the
+  // consumer is still in the spin phase or already parked
+  std::thread producer(
+    [&simple_queue]() {
+      std::this_thread::sleep_for(1ms);
+      rclcpp::experimental::executors::ExecutorEvent stub_event {};
+      stub_event.num_events = 1;
+      simple_queue->enqueue(stub_event);
+    });
+  EXPECT_TRUE(simple_queue->dequeue(event, std::chrono::seconds(5)));
+  producer.join();
+  EXPECT_TRUE(simple_queue->empty());
+}
+
+TEST(TestEventsQueue, AdaptiveSpinWaiterBudget)
+{
+  // Park never spins, BusySpin never stops
+  rclcpp::WaitStrategy park_strategy;
+  rclcpp::AdaptiveSpinWaiter park_waiter(park_strategy);
+  EXPECT_EQ(std::chrono::nanoseconds(0), park_waiter.spin_budget());
+
+  rclcpp::WaitStrategy busy_strategy;
+  busy_strategy.kind = rclcpp::WaitStrategyKind::BusySpin;
+  rclcpp::AdaptiveSpinWaiter busy_waiter(busy_strategy);
+  EXPECT_EQ(std::chrono::nanoseconds::max(), busy_waiter.spin_budget());
+
+  // A fixed strategy uses the configured budget as is
+  rclcpp::WaitStrategy fixed_strategy;
+  fixed_strategy.kind = rclcpp::WaitStrategyKind::SpinThenPark;
+  fixed_strategy.adaptive = false;
+  fixed_strategy.max_spin_duration = 5us;
+  rclcpp::AdaptiveSpinWaiter fixed_waiter(fixed_strategy);
+  EXPECT_EQ(std::chrono::nanoseconds(5us), fixed_waiter.spin_budget());
+
+  // The adaptive budget never exceeds the configured maximum and shrinks
+  // towards the observed inter-arrival times
+  rclcpp::WaitStrategy adaptive_strategy;
+  adaptive_strategy.kind = rclcpp::WaitStrategyKind::SpinThenPark;
+  adaptive_strategy.max_spin_duration = 20us;
+  rclcpp::AdaptiveSpinWaiter adaptive_waiter(adaptive_strategy);
+  EXPECT_EQ(std::chrono::nanoseconds(20us), adaptive_waiter.spin_budget());
+  for (size_t i = 0; i < 100; i++) {
+    adaptive_waiter.record_event();
+  }
+  EXPECT_LE(adaptive_waiter.spin_budget(), std::chrono::nanoseconds(20us));
+  EXPECT_GT(adaptive_waiter.spin_budget(), std::chrono::nanoseconds(0));
+}
+
+TEST(TestEventsQueue, LockFreeQueueTest)
+{
+  // Create a LockFreeEventsQueue and exercise the same contract as the simple queue
+  auto lock_free_queue =
+    std::make_unique<rclcpp::experimental::executors::LockFreeEventsQueue>();
+  rclcpp::experimental::executors::ExecutorEvent event {};
+  bool ret = false;
+
+  // Make sure the queue is empty at startup
+  EXPECT_TRUE(lock_free_queue->empty());
+  EXPECT_EQ(lock_free_queue->size(), 0u);
+
+  // Push 10 messages
+  for (uint32_t i = 1; i < 11; i++) {
+    rclcpp::experimental::executors::ExecutorEvent stub_event {};
+    stub_event.num_events = 1;
+    lock_free_queue->enqueue(stub_event);
+
+    EXPECT_FALSE(lock_free_queue->empty());
+    EXPECT_EQ(lock_free_queue->size(), i);
+  }
+
+  // An event with num_events > 1 is expanded into single events
+  rclcpp::experimental::executors::ExecutorEvent batch_event {};
+  batch_event.num_events = 5;
+  lock_free_queue->enqueue(batch_event);
+  EXPECT_EQ(lock_free_queue->size(), 15u);
+
+  while (!lock_free_queue->empty()) {
+    ret = lock_free_queue->dequeue(event);
+    EXPECT_TRUE(ret);
+    EXPECT_EQ(event.num_events, 1u);
+  }
+
+  EXPECT_TRUE(lock_free_queue->empty());
+  EXPECT_EQ(lock_free_queue->size(), 0u);
+
+  ret = lock_free_queue->dequeue(event, std::chrono::nanoseconds(0));
+  EXPECT_FALSE(ret);
+
+  // Lets push an event into the queue and get it back
+  rclcpp::experimental::executors::ExecutorEvent push_event = {
+    lock_free_queue.get(),
+    99,
+    rclcpp::experimental::executors::ExecutorEventType::SUBSCRIPTION_EVENT,
+    1};
+
+  lock_free_queue->enqueue(push_event);
+  ret = lock_free_queue->dequeue(event);
+  EXPECT_TRUE(ret);
+  EXPECT_EQ(push_event.entity_key, event.entity_key);
+  EXPECT_EQ(push_event.waitable_data, event.waitable_data);
+  EXPECT_EQ(push_event.type, event.type);
+  EXPECT_EQ(push_event.num_events, event.num_events);
+}
+
+TEST(TestEventsQueue, LockFreeQueueConcurrentProducers)
+{
+  // Multiple producers concurrently enqueue while a single consumer drains
+  auto lock_free_queue =
+    std::make_unique<rclcpp::experimental::executors::LockFreeEventsQueue>(128);
+
+  constexpr size_t num_producers = 4;
+  constexpr size_t events_per_producer = 1000;
+
+  std::vector<std::thread> producers;
+  for (size_t p = 0; p < num_producers; p++) {
+    producers.emplace_back(
+      [&lock_free_queue]() {
+        for (size_t i = 0; i < events_per_producer; i++) {
+          rclcpp::experimental::executors::ExecutorEvent stub_event {};
+          stub_event.num_events = 1;
+          lock_free_queue->enqueue(stub_event);
+        }
+      });
+  }
+
+  size_t dequeued = 0;
+  rclcpp::experimental::executors::ExecutorEvent event {};
+  while (dequeued < num_producers * events_per_producer) {
+    if (lock_free_queue->dequeue(event, std::chrono::seconds(5))) {
+      dequeued++;
+    } else {
+      break;
+    }
+  }
+
+  for (auto & producer : producers) {
+    producer.join();
+  }
+
+  EXPECT_EQ(dequeued, num_producers * events_per_producer);
+  EXPECT_TRUE(lock_free_queue->empty());
+}
@@ -95,3 +95,29 @@ TEST_F(TestExecutorNotifyWaitable, wait) {
   executor.spin_all(std::chrono::seconds(1));
   EXPECT_EQ(1u, on_execute_calls);
 }
+
+TEST_F(TestExecutorNotifyWaitable, coalesce_triggers) {
+  int on_ready_calls = 0;
+  auto waitable = std::make_shared<rclcpp::executors::ExecutorNotifyWaitable>([]() {});
+
+  auto node = std::make_shared<rclcpp::Node>("my_node", "/ns");
+  auto notify_guard_condition =
+    node->get_node_base_interface()->get_shared_notify_guard_condition();
+  waitable->add_guard_condition(notify_guard_condition);
+  waitable->set_on_ready_callback(
+    [&on_ready_calls](size_t, int) {on_ready_calls++;});
+
+  // A burst of triggers before the waitable executes collapses to one wakeup
+  for (int i = 0; i < 5; i++) {
+    notify_guard_condition->trigger();
+  }
+  EXPECT_EQ(1, on_ready_calls);
+
+  // Executing the waitable opens a new notification window
+  std::shared_ptr<void> data;
+  waitable->execute(data);
+  notify_guard_condition->trigger();
+  EXPECT_EQ(2, on_ready_calls);
+
+  waitable->clear_on_ready_callback();
+}
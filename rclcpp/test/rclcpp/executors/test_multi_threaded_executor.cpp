@@ -14,9 +14,13 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <chrono>
+#include <mutex>
+#include <set>
 #include <string>
 #include <memory>
+#include <thread>
 
 #include "rclcpp/exceptions.hpp"
 #include "rclcpp/node.hpp"
@@ -97,3 +101,64 @@ TEST_F(TestMultiThreadedExecutor, timer_over_take) {
   executor.add_node(node);
   executor.spin();
 }
+
+/*
+   Test that callback groups tagged with a pool name run on that pool's threads.
+ */
+TEST_F(TestMultiThreadedExecutor, thread_pool_assignment) {
+  rclcpp::executors::MultiThreadedExecutor executor(rclcpp::ExecutorOptions(), 2u);
+
+  EXPECT_THROW(executor.add_thread_pool("", 1u), std::invalid_argument);
+  EXPECT_THROW(executor.add_thread_pool("camera", 0u), std::invalid_argument);
+  executor.add_thread_pool("camera", 2u);
+  EXPECT_THROW(executor.add_thread_pool("camera", 2u), std::invalid_argument);
+
+  std::shared_ptr<rclcpp::Node> node =
+    std::make_shared<rclcpp::Node>("test_multi_threaded_executor_thread_pool");
+
+  auto pool_cbg = node->create_callback_group(rclcpp::CallbackGroupType::Reentrant);
+  pool_cbg->set_thread_pool_name("camera");
+  EXPECT_EQ("camera", pool_cbg->thread_pool_name());
+  // A group naming a pool this executor does not have falls back to the
+  // default threads.
+  auto fallback_cbg = node->create_callback_group(rclcpp::CallbackGroupType::Reentrant);
+  fallback_cbg->set_thread_pool_name("no_such_pool");
+
+  std::mutex thread_ids_mutex;
+  std::set<std::thread::id> pool_thread_ids;
+  std::atomic_int pool_count {0};
+  std::atomic_int fallback_count {0};
+
+  auto pool_timer = node->create_wall_timer(
+    1ms,
+    [&]() {
+      {
+        std::lock_guard<std::mutex> lock(thread_ids_mutex);
+        pool_thread_ids.insert(std::this_thread::get_id());
+      }
+      pool_count++;
+      if (pool_count > 10 && fallback_count > 10) {
+        executor.cancel();
+      }
+    },
+    pool_cbg);
+  auto fallback_timer = node->create_wall_timer(
+    1ms,
+    [&]() {
+      fallback_count++;
+      if (pool_count > 10 && fallback_count > 10) {
+        executor.cancel();
+      }
+    },
+    fallback_cbg);
+
+  executor.add_node(node);
+  executor.spin();
+
+  EXPECT_GT(pool_count, 10);
+  EXPECT_GT(fallback_count, 10);
+  // All pool callbacks ran on the pool's dedicated threads.
+  std::lock_guard<std::mutex> lock(thread_ids_mutex);
+  EXPECT_GE(2u, pool_thread_ids.size());
+  EXPECT_EQ(0u, pool_thread_ids.count(std::this_thread::get_id()));
+}
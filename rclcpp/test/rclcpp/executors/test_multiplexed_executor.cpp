@@ -0,0 +1,114 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "rclcpp/node.hpp"
+#include "rclcpp/rclcpp.hpp"
+#include "rclcpp/executors/multiplexed_executor.hpp"
+
+using namespace std::chrono_literals;
+
+class TestMultiplexedExecutor : public ::testing::Test
+{
+protected:
+  static void SetUpTestCase()
+  {
+    rclcpp::init(0, nullptr);
+  }
+};
+
+/*
+   Test that callbacks of one domain never run concurrently, while the
+   domains together use more than one worker thread.
+ */
+TEST_F(TestMultiplexedExecutor, intra_domain_serialization) {
+  rclcpp::executors::MultiplexedExecutor executor(rclcpp::ExecutorOptions(), 4u);
+
+  ASSERT_GT(executor.get_number_of_threads(), 1u);
+
+  constexpr size_t num_domains = 3;
+  constexpr size_t timers_per_domain = 3;
+  constexpr size_t fires_to_stop = 5 * num_domains * timers_per_domain;
+
+  std::atomic<size_t> fired_count {0};
+  std::atomic<size_t> overlap_count {0};
+  // One "currently executing" flag per domain; reentrant groups let the
+  // executor try to overlap, the domain serialization must prevent it.
+  std::vector<std::unique_ptr<std::atomic<bool>>> domain_running;
+
+  std::vector<std::shared_ptr<rclcpp::Node>> nodes;
+  std::vector<rclcpp::CallbackGroup::SharedPtr> groups;
+  std::vector<rclcpp::TimerBase::SharedPtr> timers;
+  for (size_t d = 0; d < num_domains; d++) {
+    domain_running.push_back(std::make_unique<std::atomic<bool>>(false));
+    auto node = std::make_shared<rclcpp::Node>("mux_node_" + std::to_string(d));
+    for (size_t t = 0; t < timers_per_domain; t++) {
+      auto cbg = node->create_callback_group(rclcpp::CallbackGroupType::Reentrant);
+      groups.push_back(cbg);
+      auto running = domain_running.back().get();
+      timers.push_back(
+        node->create_wall_timer(
+          1ms,
+          [running, &fired_count, &overlap_count, &executor]() {
+            if (running->exchange(true)) {
+              overlap_count++;
+            }
+            std::this_thread::sleep_for(1ms);
+            running->store(false);
+            if (++fired_count >= fires_to_stop) {
+              executor.cancel();
+            }
+          },
+          cbg));
+    }
+    executor.add_node_to_domain(node, "domain_" + std::to_string(d));
+    nodes.push_back(node);
+  }
+
+  executor.spin();
+
+  EXPECT_GE(fired_count.load(), fires_to_stop);
+  EXPECT_EQ(0u, overlap_count.load());
+}
+
+/*
+   Test that nodes added without a domain run in the (serialized) default
+   domain, and that invalid arguments are rejected.
+ */
+TEST_F(TestMultiplexedExecutor, default_domain_and_errors) {
+  rclcpp::executors::MultiplexedExecutor executor(rclcpp::ExecutorOptions(), 2u);
+
+  auto node = std::make_shared<rclcpp::Node>("mux_default_node");
+  std::atomic<size_t> fired_count {0};
+  auto timer = node->create_wall_timer(
+    1ms,
+    [&fired_count, &executor]() {
+      if (++fired_count >= 5) {
+        executor.cancel();
+      }
+    });
+  executor.add_node(node);
+  executor.spin();
+  EXPECT_GE(fired_count.load(), 5u);
+
+  EXPECT_THROW(executor.add_node_to_domain(node, ""), std::invalid_argument);
+}
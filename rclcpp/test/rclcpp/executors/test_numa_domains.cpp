@@ -0,0 +1,114 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "rclcpp/executors/numa_domains.hpp"
+#include "rclcpp/rclcpp.hpp"
+
+using namespace std::chrono_literals;
+
+class TestNumaDomains : public ::testing::Test
+{
+protected:
+  static void SetUpTestCase()
+  {
+    rclcpp::init(0, nullptr);
+  }
+};
+
+/*
+   Detection always yields at least one domain covering at least one cpu.
+ */
+TEST_F(TestNumaDomains, detect_never_empty) {
+  auto domains = rclcpp::executors::detect_numa_domains();
+  ASSERT_FALSE(domains.empty());
+  for (const auto & domain : domains) {
+    EXPECT_FALSE(domain.cpu_set.empty());
+  }
+}
+
+/*
+   Attributes carry the domain cpu set and a numa<id> name.
+ */
+TEST_F(TestNumaDomains, thread_attributes_for_domain) {
+  rclcpp::executors::NumaDomain domain;
+  domain.id = 1;
+  domain.cpu_set = {2, 3};
+  auto attributes = rclcpp::executors::thread_attributes_for_numa_domain(domain);
+  EXPECT_EQ(domain.cpu_set, attributes.cpu_set);
+  EXPECT_EQ("numa1", attributes.name);
+}
+
+/*
+   Nodes land on the hinted domain; unhinted nodes are balanced.
+ */
+TEST_F(TestNumaDomains, node_assignment) {
+  std::vector<rclcpp::executors::NumaDomain> domains(2);
+  domains[0].id = 0;
+  domains[0].cpu_set = {0};
+  domains[1].id = 1;
+  domains[1].cpu_set = {0};
+  rclcpp::executors::NumaExecutorSet executor_set(rclcpp::ExecutorOptions(), domains);
+  ASSERT_EQ(2u, executor_set.domains().size());
+
+  auto hinted_node = std::make_shared<rclcpp::Node>(
+    "numa_hinted_node", rclcpp::NodeOptions().numa_domain(1));
+  EXPECT_EQ(1u, executor_set.add_node(hinted_node));
+
+  // Unhinted nodes fill the least loaded domain first.
+  auto first_node = std::make_shared<rclcpp::Node>("numa_unhinted_node_a");
+  auto second_node = std::make_shared<rclcpp::Node>("numa_unhinted_node_b");
+  EXPECT_EQ(0u, executor_set.add_node(first_node));
+  size_t second_domain = executor_set.add_node(second_node);
+  EXPECT_TRUE(second_domain == 0u || second_domain == 1u);
+
+  EXPECT_THROW(executor_set.get_executor(2u), std::out_of_range);
+}
+
+/*
+   Spinning the set runs callbacks of nodes on every domain.
+ */
+TEST_F(TestNumaDomains, spin_runs_all_domains) {
+  auto executor_set = std::make_shared<rclcpp::executors::NumaExecutorSet>();
+  const size_t domain_count = executor_set->domains().size();
+
+  std::atomic<size_t> fired_count {0};
+  std::vector<std::shared_ptr<rclcpp::Node>> nodes;
+  std::vector<rclcpp::TimerBase::SharedPtr> timers;
+  for (size_t i = 0; i < domain_count + 1; i++) {
+    auto node = std::make_shared<rclcpp::Node>("numa_spin_node_" + std::to_string(i));
+    timers.push_back(node->create_wall_timer(5ms, [&fired_count]() {fired_count++;}));
+    executor_set->add_node(node);
+    nodes.push_back(node);
+  }
+
+  std::thread spinner([executor_set]() {executor_set->spin();});
+  auto start = std::chrono::steady_clock::now();
+  while (fired_count.load() < 2 * (domain_count + 1) &&
+    (std::chrono::steady_clock::now() - start) < 10s)
+  {
+    std::this_thread::sleep_for(1ms);
+  }
+  executor_set->cancel();
+  spinner.join();
+
+  EXPECT_GE(fired_count.load(), 2 * (domain_count + 1));
+}
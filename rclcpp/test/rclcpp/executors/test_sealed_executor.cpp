@@ -0,0 +1,92 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include "rclcpp/node.hpp"
+#include "rclcpp/rclcpp.hpp"
+#include "rclcpp/executors/sealed_executor.hpp"
+
+#include "test_msgs/msg/empty.hpp"
+
+using namespace std::chrono_literals;
+
+class TestSealedExecutor : public ::testing::Test
+{
+protected:
+  static void SetUpTestCase()
+  {
+    rclcpp::init(0, nullptr);
+  }
+};
+
+/*
+   Test that spinning before seal() throws and that the configuration is
+   immutable afterwards.
+ */
+TEST_F(TestSealedExecutor, seal_semantics) {
+  rclcpp::executors::SealedExecutor executor;
+
+  auto node = std::make_shared<rclcpp::Node>("test_sealed_executor_semantics");
+  executor.add_node(node);
+
+  EXPECT_FALSE(executor.is_sealed());
+  EXPECT_THROW(executor.spin_some(), std::runtime_error);
+
+  executor.seal();
+  EXPECT_TRUE(executor.is_sealed());
+
+  EXPECT_THROW(executor.seal(), std::runtime_error);
+  auto other_node = std::make_shared<rclcpp::Node>("test_sealed_executor_other");
+  EXPECT_THROW(executor.add_node(other_node), std::runtime_error);
+  EXPECT_THROW(executor.remove_node(node->get_node_base_interface()), std::runtime_error);
+}
+
+/*
+   Test that timers and subscriptions frozen at seal() time are dispatched.
+ */
+TEST_F(TestSealedExecutor, dispatches_frozen_entities) {
+  rclcpp::executors::SealedExecutor executor;
+
+  auto node = std::make_shared<rclcpp::Node>("test_sealed_executor_dispatch");
+
+  size_t timer_count = 0;
+  auto timer = node->create_wall_timer(1ms, [&timer_count]() {++timer_count;});
+
+  size_t message_count = 0;
+  auto subscription = node->create_subscription<test_msgs::msg::Empty>(
+    "test_sealed_executor_topic", 10,
+    [&message_count](test_msgs::msg::Empty::ConstSharedPtr) {++message_count;});
+  auto publisher = node->create_publisher<test_msgs::msg::Empty>(
+    "test_sealed_executor_topic", 10);
+
+  executor.add_node(node);
+  executor.seal();
+
+  publisher->publish(test_msgs::msg::Empty());
+
+  auto start = std::chrono::steady_clock::now();
+  while ((0 == timer_count || 0 == message_count) &&
+    std::chrono::steady_clock::now() - start < 5s)
+  {
+    executor.spin_some(50ms);
+  }
+
+  EXPECT_GT(timer_count, 0u);
+  EXPECT_EQ(1u, message_count);
+}
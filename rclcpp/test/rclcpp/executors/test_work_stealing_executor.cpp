@@ -0,0 +1,93 @@
+// Copyright 2024 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "rclcpp/exceptions.hpp"
+#include "rclcpp/node.hpp"
+#include "rclcpp/rclcpp.hpp"
+#include "rclcpp/executors.hpp"
+#include "rclcpp/executors/work_stealing_executor.hpp"
+
+using namespace std::chrono_literals;
+
+class TestWorkStealingExecutor : public ::testing::Test
+{
+protected:
+  static void SetUpTestCase()
+  {
+    rclcpp::init(0, nullptr);
+  }
+};
+
+/*
+   Test that timers spread over several callback groups all run.
+ */
+TEST_F(TestWorkStealingExecutor, timers_across_groups) {
+  rclcpp::executors::WorkStealingExecutor executor(rclcpp::ExecutorOptions(), 4u);
+
+  ASSERT_GT(executor.get_number_of_threads(), 1u);
+
+  std::shared_ptr<rclcpp::Node> node =
+    std::make_shared<rclcpp::Node>("test_work_stealing_executor_timers");
+
+  constexpr size_t num_timers = 8;
+  std::atomic<size_t> fired_count {0};
+
+  std::vector<rclcpp::CallbackGroup::SharedPtr> groups;
+  std::vector<rclcpp::TimerBase::SharedPtr> timers;
+  for (size_t i = 0; i < num_timers; i++) {
+    auto cbg = node->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+    groups.push_back(cbg);
+    timers.push_back(
+      node->create_wall_timer(
+        10ms,
+        [&fired_count, &executor]() {
+          if (++fired_count >= 5 * num_timers) {
+            executor.cancel();
+          }
+        },
+        cbg));
+  }
+
+  executor.add_node(node);
+  executor.spin();
+
+  EXPECT_GE(fired_count.load(), 5 * num_timers);
+}
+
+/*
+   Test that spin() twice throws and that cancel unblocks all workers.
+ */
+TEST_F(TestWorkStealingExecutor, spin_twice_throws) {
+  rclcpp::executors::WorkStealingExecutor executor(rclcpp::ExecutorOptions(), 2u);
+
+  std::shared_ptr<rclcpp::Node> node =
+    std::make_shared<rclcpp::Node>("test_work_stealing_executor_spin_twice");
+  executor.add_node(node);
+
+  std::thread spinner([&executor]() {executor.spin();});
+  // Give the spinner time to start.
+  std::this_thread::sleep_for(50ms);
+  EXPECT_THROW(executor.spin(), std::runtime_error);
+  executor.cancel();
+  spinner.join();
+}
@@ -141,6 +141,81 @@ TEST_F(TestNodeGraph, get_topic_names_and_types)
   ASSERT_LT(0u, get_num_topics());
 }
 
+TEST_F(TestNodeGraph, get_cached_topic_names_and_types)
+{
+  ASSERT_LT(0u, get_num_topics());
+
+  // Repeat queries between graph changes share one immutable snapshot.
+  auto first = node_graph()->get_cached_topic_names_and_types();
+  auto second = node_graph()->get_cached_topic_names_and_types();
+  EXPECT_EQ(first.get(), second.get());
+  EXPECT_LT(0u, first->size());
+
+  // A graph change invalidates the snapshot and a later query observes it.
+  auto publisher = node()->create_publisher<test_msgs::msg::Empty>("cached_topic", 10);
+  auto num_matches = get_num_graph_things(
+    [this]() -> size_t {
+      auto cached = node_graph()->get_cached_topic_names_and_types();
+      return cached->count("/ns/cached_topic");
+    });
+  EXPECT_EQ(1u, num_matches);
+}
+
+TEST_F(TestNodeGraph, filtered_graph_event)
+{
+  // The filtered API is non-const, so get a mutable interface pointer.
+  auto * graph = dynamic_cast<rclcpp::node_interfaces::NodeGraph *>(
+    node()->get_node_graph_interface().get());
+  ASSERT_NE(nullptr, graph);
+
+  auto matching_event = graph->get_filtered_graph_event("/ns/filtered_topic");
+  auto other_event = graph->get_filtered_graph_event("/ns/some_other_topic");
+
+  auto publisher = node()->create_publisher<test_msgs::msg::Empty>("filtered_topic", 10);
+
+  constexpr std::chrono::milliseconds timeout(100);
+  size_t tries = 0;
+  while (!matching_event->check() && tries++ < 50) {
+    graph->wait_for_filtered_graph_event(matching_event, timeout);
+  }
+  EXPECT_TRUE(matching_event->check_and_clear());
+  // The unrelated filter must not have been woken by the new topic.
+  EXPECT_FALSE(other_event->check());
+
+  EXPECT_THROW(
+    graph->wait_for_filtered_graph_event(nullptr, timeout),
+    rclcpp::exceptions::InvalidEventError);
+  auto unregistered_event = std::make_shared<rclcpp::Event>();
+  EXPECT_THROW(
+    graph->wait_for_filtered_graph_event(unregistered_event, timeout),
+    rclcpp::exceptions::EventNotRegisteredError);
+}
+
+TEST_F(TestNodeGraph, service_graph_event)
+{
+  auto * graph = dynamic_cast<rclcpp::node_interfaces::NodeGraph *>(
+    node()->get_node_graph_interface().get());
+  ASSERT_NE(nullptr, graph);
+
+  auto matching_event = graph->get_service_graph_event("/ns/watched_service");
+  auto other_event = graph->get_service_graph_event("/ns/some_other_service");
+
+  auto service = node()->create_service<test_msgs::srv::Empty>(
+    "watched_service",
+    [](
+      const test_msgs::srv::Empty::Request::SharedPtr,
+      test_msgs::srv::Empty::Response::SharedPtr) {});
+
+  constexpr std::chrono::milliseconds timeout(100);
+  size_t tries = 0;
+  while (!matching_event->check() && tries++ < 50) {
+    graph->wait_for_filtered_graph_event(matching_event, timeout);
+  }
+  EXPECT_TRUE(matching_event->check_and_clear());
+  // The unrelated filter must not have been woken by the new service.
+  EXPECT_FALSE(other_event->check());
+}
+
 TEST_F(TestNodeGraph, get_topic_names_and_types_rcl_error)
 {
   auto mock_get_topic_names = mocking_utils::patch_and_return(
@@ -447,3 +447,123 @@ TEST_F(TestNodeParameters, complicated_wildcards)
     EXPECT_EQ(0u, parameter_overrides.size());
   }
 }
+
+TEST_F(TestNodeParameters, parameter_snapshot)
+{
+  rcl_interfaces::msg::ParameterDescriptor descriptor;
+  descriptor.dynamic_typing = true;
+  node_parameters->declare_parameter(
+    "snapshot_param1", rclcpp::ParameterValue(1), descriptor, false);
+  node_parameters->declare_parameter(
+    "snapshot_param2", rclcpp::ParameterValue("original"), descriptor, false);
+
+  auto snapshot = node_parameters->get_parameter_snapshot();
+  ASSERT_NE(nullptr, snapshot);
+  EXPECT_TRUE(snapshot->has_parameter("snapshot_param1"));
+  EXPECT_TRUE(snapshot->has_parameter("snapshot_param2"));
+  EXPECT_FALSE(snapshot->has_parameter("not_a_parameter"));
+  EXPECT_EQ(1, snapshot->get_parameter("snapshot_param1").as_int());
+
+  // A snapshot is immutable: sets after it was taken are not observed ...
+  auto results = node_parameters->set_parameters(
+    {rclcpp::Parameter("snapshot_param2", "changed")});
+  ASSERT_EQ(1u, results.size());
+  EXPECT_TRUE(results[0].successful);
+  EXPECT_EQ("original", snapshot->get_parameter("snapshot_param2").as_string());
+
+  // ... while the node and a fresh snapshot see the new value.
+  EXPECT_EQ("changed", node_parameters->get_parameter("snapshot_param2").as_string());
+  auto fresh_snapshot = node_parameters->get_parameter_snapshot();
+  EXPECT_EQ("changed", fresh_snapshot->get_parameter("snapshot_param2").as_string());
+
+  // Multi-parameter reads from one snapshot are consistent with each other.
+  auto parameters = snapshot->get_parameters({"snapshot_param1", "snapshot_param2"});
+  ASSERT_EQ(2u, parameters.size());
+  EXPECT_EQ(1, parameters[0].as_int());
+  EXPECT_EQ("original", parameters[1].as_string());
+
+  // Undeclared parameters follow the node's allow_undeclared setting.
+  EXPECT_NO_THROW(snapshot->get_parameter("not_a_parameter"));
+
+  rclcpp::Parameter parameter;
+  EXPECT_TRUE(snapshot->get_parameter("snapshot_param1", parameter));
+  EXPECT_FALSE(snapshot->get_parameter("not_a_parameter", parameter));
+}
+
+TEST_F(TestNodeParameters, parameter_handle)
+{
+  rcl_interfaces::msg::ParameterDescriptor descriptor;
+  descriptor.dynamic_typing = true;
+  node_parameters->declare_parameter(
+    "handle_param", rclcpp::ParameterValue(7), descriptor, false);
+
+  auto handle = node_parameters->get_parameter_handle("handle_param");
+  EXPECT_EQ("handle_param", handle.get_name());
+  EXPECT_EQ(7, handle.get_parameter().as_int());
+
+  // Repeated reads go through the cached resolution.
+  EXPECT_EQ(7, handle.get_parameter().as_int());
+
+  // A mutation re-resolves the handle transparently.
+  auto results = node_parameters->set_parameters({rclcpp::Parameter("handle_param", 8)});
+  ASSERT_EQ(1u, results.size());
+  EXPECT_TRUE(results[0].successful);
+  EXPECT_EQ(8, handle.get_parameter().as_int());
+
+  rclcpp::Parameter parameter;
+  EXPECT_TRUE(handle.get_parameter(parameter));
+  EXPECT_EQ(8, parameter.as_int());
+
+  // Handles may be created before the parameter exists; reads follow the
+  // node's allow_undeclared setting until it is declared.
+  auto late_handle = node_parameters->get_parameter_handle("late_param");
+  EXPECT_FALSE(late_handle.get_parameter(parameter));
+  EXPECT_NO_THROW(late_handle.get_parameter());
+  node_parameters->declare_parameter(
+    "late_param", rclcpp::ParameterValue("now"), descriptor, false);
+  EXPECT_EQ("now", late_handle.get_parameter().as_string());
+}
+
+TEST_F(TestNodeParameters, batch_declare_parameters)
+{
+  using rclcpp::node_interfaces::ParameterDeclaration;
+
+  std::vector<ParameterDeclaration> declarations(3);
+  declarations[0].name = "batch_param_int";
+  declarations[0].default_value = rclcpp::ParameterValue(1);
+  declarations[1].name = "batch_param_string";
+  declarations[1].default_value = rclcpp::ParameterValue("one");
+  declarations[2].name = "batch_param_double";
+  declarations[2].default_value = rclcpp::ParameterValue(1.0);
+
+  auto values = node_parameters->declare_parameters(declarations);
+  ASSERT_EQ(3u, values.size());
+  EXPECT_EQ(1, values[0].get<int64_t>());
+  EXPECT_EQ("one", values[1].get<std::string>());
+  EXPECT_EQ(1.0, values[2].get<double>());
+  EXPECT_TRUE(node_parameters->has_parameter("batch_param_int"));
+  EXPECT_TRUE(node_parameters->has_parameter("batch_param_string"));
+  EXPECT_TRUE(node_parameters->has_parameter("batch_param_double"));
+
+  // Redeclaring any member of the batch fails before anything is applied.
+  std::vector<ParameterDeclaration> conflicting(2);
+  conflicting[0].name = "batch_param_new";
+  conflicting[0].default_value = rclcpp::ParameterValue(2);
+  conflicting[1].name = "batch_param_int";
+  conflicting[1].default_value = rclcpp::ParameterValue(2);
+  EXPECT_THROW(
+    node_parameters->declare_parameters(conflicting),
+    rclcpp::exceptions::ParameterAlreadyDeclaredException);
+  EXPECT_FALSE(node_parameters->has_parameter("batch_param_new"));
+
+  // A name repeated within one batch is also rejected atomically.
+  std::vector<ParameterDeclaration> repeated(2);
+  repeated[0].name = "batch_param_repeated";
+  repeated[0].default_value = rclcpp::ParameterValue(3);
+  repeated[1].name = "batch_param_repeated";
+  repeated[1].default_value = rclcpp::ParameterValue(4);
+  EXPECT_THROW(
+    node_parameters->declare_parameters(repeated),
+    rclcpp::exceptions::ParameterAlreadyDeclaredException);
+  EXPECT_FALSE(node_parameters->has_parameter("batch_param_repeated"));
+}
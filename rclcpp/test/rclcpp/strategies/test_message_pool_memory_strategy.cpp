@@ -13,6 +13,8 @@
 // limitations under the License.
 
 #include <memory>
+#include <thread>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -71,3 +73,47 @@ TEST_F(TestMessagePoolMemoryStrategy, return_unrecognized) {
     std::runtime_error("Unrecognized message ptr in return_message."));
   EXPECT_NO_THROW(message_memory_strategy_->return_message(message));
 }
+
+TEST_F(TestMessagePoolMemoryStrategy, grow_and_high_water_mark) {
+  auto growing_strategy =
+    std::make_shared<MessagePoolMemoryStrategy<test_msgs::msg::Empty, 1>>(2);
+  EXPECT_EQ(1u, growing_strategy->capacity());
+
+  auto first = growing_strategy->borrow_message();
+  ASSERT_NE(nullptr, first);
+  // Exhausting the first chunk grows the pool by another chunk.
+  auto second = growing_strategy->borrow_message();
+  ASSERT_NE(nullptr, second);
+  EXPECT_EQ(2u, growing_strategy->capacity());
+
+  // At the chunk limit, exhaustion fails just like the fixed pool.
+  RCLCPP_EXPECT_THROW_EQ(
+    growing_strategy->borrow_message(),
+    std::runtime_error("Tried to access message that was still in use! Abort."));
+
+  EXPECT_NO_THROW(growing_strategy->return_message(first));
+  EXPECT_NO_THROW(growing_strategy->return_message(second));
+  EXPECT_EQ(2u, growing_strategy->high_water_mark());
+}
+
+TEST_F(TestMessagePoolMemoryStrategy, concurrent_borrow_return) {
+  constexpr size_t num_threads = 4;
+  auto shared_strategy =
+    std::make_shared<MessagePoolMemoryStrategy<test_msgs::msg::Empty, num_threads>>();
+
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < num_threads; ++i) {
+    threads.emplace_back(
+      [&shared_strategy]() {
+        for (size_t iteration = 0; iteration < 1000; ++iteration) {
+          auto message = shared_strategy->borrow_message();
+          ASSERT_NE(nullptr, message);
+          shared_strategy->return_message(message);
+        }
+      });
+  }
+  for (auto & thread : threads) {
+    thread.join();
+  }
+  EXPECT_LE(shared_strategy->high_water_mark(), num_threads);
+}
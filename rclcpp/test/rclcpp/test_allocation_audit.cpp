@@ -0,0 +1,93 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory_resource>
+
+#include "rclcpp/allocation_audit.hpp"
+
+class TestAllocationAudit : public ::testing::Test
+{
+public:
+  void SetUp() override
+  {
+    rclcpp::allocation_audit::reset();
+    rclcpp::allocation_audit::enable();
+  }
+
+  void TearDown() override
+  {
+    rclcpp::allocation_audit::disable();
+    rclcpp::allocation_audit::reset();
+  }
+};
+
+TEST_F(TestAllocationAudit, disabled_records_nothing) {
+  rclcpp::allocation_audit::disable();
+  rclcpp::allocation_audit::record("test_callsite", 128);
+  EXPECT_TRUE(rclcpp::allocation_audit::report().empty());
+}
+
+TEST_F(TestAllocationAudit, phases_and_reports) {
+  EXPECT_FALSE(rclcpp::init_complete());
+  rclcpp::allocation_audit::record("init_only", 10);
+  rclcpp::allocation_audit::record("init_only", 20);
+  rclcpp::allocation_audit::record("steady_state", 5);
+
+  rclcpp::mark_init_complete();
+  EXPECT_TRUE(rclcpp::init_complete());
+  rclcpp::allocation_audit::record("steady_state", 40);
+
+  auto report = rclcpp::allocation_audit::report();
+  ASSERT_EQ(2u, report.size());
+  for (const auto & entry : report) {
+    if ("init_only" == entry.callsite) {
+      EXPECT_EQ(2u, entry.pre_init_count);
+      EXPECT_EQ(30u, entry.pre_init_bytes);
+      EXPECT_EQ(0u, entry.post_init_count);
+    } else {
+      EXPECT_EQ("steady_state", entry.callsite);
+      EXPECT_EQ(1u, entry.pre_init_count);
+      EXPECT_EQ(1u, entry.post_init_count);
+      EXPECT_EQ(40u, entry.post_init_bytes);
+    }
+  }
+
+  // Only the callsite still allocating after init shows up here.
+  auto post_init_report = rclcpp::allocation_audit::post_init_report();
+  ASSERT_EQ(1u, post_init_report.size());
+  EXPECT_EQ("steady_state", post_init_report[0].callsite);
+
+  // Reset clears the records and reverts to the pre-init phase.
+  rclcpp::allocation_audit::reset();
+  EXPECT_TRUE(rclcpp::allocation_audit::report().empty());
+  EXPECT_FALSE(rclcpp::init_complete());
+}
+
+TEST_F(TestAllocationAudit, auditing_memory_resource) {
+  rclcpp::allocation_audit::AuditingMemoryResource resource("audited_arena");
+  std::pmr::polymorphic_allocator<char> allocator(&resource);
+
+  rclcpp::mark_init_complete();
+  char * pointer = allocator.allocate(256);
+  ASSERT_NE(nullptr, pointer);
+  allocator.deallocate(pointer, 256);
+
+  auto post_init_report = rclcpp::allocation_audit::post_init_report();
+  ASSERT_EQ(1u, post_init_report.size());
+  EXPECT_EQ("audited_arena", post_init_report[0].callsite);
+  EXPECT_EQ(1u, post_init_report[0].post_init_count);
+  EXPECT_EQ(256u, post_init_report[0].post_init_bytes);
+}
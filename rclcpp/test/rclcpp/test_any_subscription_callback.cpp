@@ -198,6 +198,45 @@ TEST_F(TestAnySubscriptionCallback, is_serialized_message_callback) {
   }
 }
 
+TEST_F(TestAnySubscriptionCallback, uses_message_info) {
+  {
+    rclcpp::AnySubscriptionCallback<test_msgs::msg::Empty> asc;
+    asc.set([](const test_msgs::msg::Empty &) {});
+    EXPECT_FALSE(asc.uses_message_info());
+  }
+  {
+    rclcpp::AnySubscriptionCallback<test_msgs::msg::Empty> asc;
+    asc.set([](const test_msgs::msg::Empty &, const rclcpp::MessageInfo &) {});
+    EXPECT_TRUE(asc.uses_message_info());
+  }
+  {
+    rclcpp::AnySubscriptionCallback<test_msgs::msg::Empty> asc;
+    asc.set([](std::unique_ptr<test_msgs::msg::Empty>) {});
+    EXPECT_FALSE(asc.uses_message_info());
+  }
+  {
+    rclcpp::AnySubscriptionCallback<test_msgs::msg::Empty> asc;
+    asc.set([](std::unique_ptr<test_msgs::msg::Empty>, const rclcpp::MessageInfo &) {});
+    EXPECT_TRUE(asc.uses_message_info());
+  }
+  {
+    rclcpp::AnySubscriptionCallback<test_msgs::msg::Empty> asc;
+    asc.set([](std::shared_ptr<const test_msgs::msg::Empty>) {});
+    EXPECT_FALSE(asc.uses_message_info());
+  }
+  {
+    rclcpp::AnySubscriptionCallback<test_msgs::msg::Empty> asc;
+    asc.set(
+      [](std::shared_ptr<const test_msgs::msg::Empty>, const rclcpp::MessageInfo &) {});
+    EXPECT_TRUE(asc.uses_message_info());
+  }
+  {
+    rclcpp::AnySubscriptionCallback<test_msgs::msg::Empty> asc;
+    asc.set([](const rclcpp::SerializedMessage &, const rclcpp::MessageInfo &) {});
+    EXPECT_TRUE(asc.uses_message_info());
+  }
+}
+
 TEST_F(TestAnySubscriptionCallback, unset_dispatch_throw) {
   EXPECT_THROW(
     any_subscription_callback_.dispatch(msg_shared_ptr_, message_info_),
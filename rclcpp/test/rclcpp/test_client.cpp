@@ -202,6 +202,20 @@ TEST_F(TestClient, wait_for_service) {
   EXPECT_TRUE(client->service_is_ready());
 }
 
+/*
+   Dropped responses are recycled instead of allocated anew.
+ */
+TEST_F(TestClient, create_response_recycled) {
+  auto client = node->create_client<rcl_interfaces::srv::ListParameters>("service");
+
+  auto response = client->create_response();
+  void * recycled_ptr = response.get();
+  response.reset();
+
+  response = client->create_response();
+  EXPECT_EQ(recycled_ptr, response.get());
+}
+
 /*
    Testing client construction and destruction for subnodes.
  */
@@ -348,6 +362,92 @@ TEST_F(TestClientWithServer, prune_requests_older_than_with_pruned) {
   EXPECT_EQ(future.request_id, pruned_requests[0]);
 }
 
+TEST_F(TestClientWithServer, reserve_pending_requests) {
+  using SharedFuture = rclcpp::Client<test_msgs::srv::Empty>::SharedFuture;
+
+  auto client = node->create_client<test_msgs::srv::Empty>(service_name);
+  client->reserve_pending_requests(8);
+  ASSERT_TRUE(client->wait_for_service(std::chrono::seconds(1)));
+
+  // Requests round trip through the preallocated slots.
+  auto request = std::make_shared<test_msgs::srv::Empty::Request>();
+  bool received_response = false;
+  auto callback = [&received_response](SharedFuture future_response) {
+      EXPECT_NE(nullptr, future_response.get());
+      received_response = true;
+    };
+  auto req_id = client->async_send_request(request, std::move(callback));
+
+  auto start = std::chrono::steady_clock::now();
+  while (!received_response &&
+    (std::chrono::steady_clock::now() - start) < std::chrono::seconds(1))
+  {
+    rclcpp::spin_some(node);
+  }
+  EXPECT_TRUE(received_response);
+  EXPECT_FALSE(client->remove_pending_request(req_id));
+
+  // Slotted requests can still be removed and pruned.
+  auto future = client->async_send_request(request);
+  EXPECT_TRUE(client->remove_pending_request(future));
+  EXPECT_FALSE(client->remove_pending_request(future));
+
+  auto future2 = client->async_send_request(request);
+  std::vector<int64_t> pruned_requests;
+  EXPECT_EQ(1u, client->prune_requests_older_than(
+      std::chrono::system_clock::now() + 1s, &pruned_requests));
+  ASSERT_EQ(1u, pruned_requests.size());
+  EXPECT_EQ(future2.request_id, pruned_requests[0]);
+
+  // Resizing with a request in flight is rejected.
+  auto future3 = client->async_send_request(request);
+  EXPECT_THROW(client->reserve_pending_requests(16), std::runtime_error);
+  EXPECT_EQ(1u, client->prune_pending_requests());
+}
+
+TEST_F(TestClientWithServer, request_stream) {
+  auto client = node->create_client<test_msgs::srv::Empty>(service_name);
+  ASSERT_TRUE(client->wait_for_service(std::chrono::seconds(1)));
+
+  EXPECT_THROW(client->create_request_stream(0, [](auto) {}), std::invalid_argument);
+  EXPECT_THROW(client->create_request_stream(2, nullptr), std::invalid_argument);
+
+  size_t responses = 0;
+  auto stream = client->create_request_stream(
+    2, [&responses](test_msgs::srv::Empty::Response::SharedPtr response) {
+      EXPECT_NE(nullptr, response);
+      ++responses;
+    });
+  EXPECT_EQ(2u, stream->window_size());
+  EXPECT_EQ(0u, stream->in_flight());
+
+  // The window bounds the number of outstanding requests.
+  auto request = std::make_shared<test_msgs::srv::Empty::Request>();
+  EXPECT_TRUE(stream->try_send(request));
+  EXPECT_TRUE(stream->try_send(request));
+  EXPECT_EQ(2u, stream->in_flight());
+  EXPECT_FALSE(stream->try_send(request));
+
+  auto start = std::chrono::steady_clock::now();
+  while (responses < 2u &&
+    (std::chrono::steady_clock::now() - start) < std::chrono::seconds(1))
+  {
+    rclcpp::spin_some(node);
+  }
+  EXPECT_EQ(2u, responses);
+  EXPECT_EQ(0u, stream->in_flight());
+
+  // Completed responses release their window slots.
+  EXPECT_TRUE(stream->try_send(request));
+  start = std::chrono::steady_clock::now();
+  while (responses < 3u &&
+    (std::chrono::steady_clock::now() - start) < std::chrono::seconds(1))
+  {
+    rclcpp::spin_some(node);
+  }
+  EXPECT_EQ(3u, responses);
+}
+
 TEST_F(TestClientWithServer, async_send_request_rcl_send_request_error) {
   // Checking rcl_send_request in rclcpp::Client::async_send_request()
   auto mock = mocking_utils::patch_and_return("lib:rclcpp", rcl_send_request, RCL_RET_ERROR);
@@ -410,6 +510,40 @@ TEST_F(TestClientWithServer, take_response) {
   }
 }
 
+TEST_F(TestClientWithServer, try_send_request) {
+  auto client = node->create_client<test_msgs::srv::Empty>(service_name);
+  ASSERT_TRUE(client->wait_for_service(std::chrono::seconds(1)));
+  test_msgs::srv::Empty::Request request;
+  test_msgs::srv::Empty::Response response;
+  auto request_header = client->create_request_header();
+
+  int64_t sequence_number = 0;
+  ASSERT_EQ(RCL_RET_OK, client->try_send_request(request, sequence_number));
+
+  // The response is not routed through the pending request tables; poll it.
+  rcl_ret_t ret = RCL_RET_CLIENT_TAKE_FAILED;
+  auto start = std::chrono::steady_clock::now();
+  while (RCL_RET_OK != ret &&
+    (std::chrono::steady_clock::now() - start) < std::chrono::seconds(5))
+  {
+    rclcpp::spin_some(node);
+    ret = client->try_take_response(response, *request_header.get());
+  }
+  ASSERT_EQ(RCL_RET_OK, ret);
+  EXPECT_EQ(sequence_number, request_header->sequence_number);
+
+  EXPECT_EQ(
+    RCL_RET_CLIENT_TAKE_FAILED,
+    client->try_take_response(response, *request_header.get()));
+
+  {
+    // Checking rcl_send_request error propagation without a throw.
+    auto mock = mocking_utils::patch_and_return(
+      "lib:rclcpp", rcl_send_request, RCL_RET_ERROR);
+    EXPECT_EQ(RCL_RET_ERROR, client->try_send_request(request, sequence_number));
+  }
+}
+
 /*
    Testing on_new_response callbacks.
  */
@@ -601,3 +735,58 @@ TEST_F(TestClient, client_qos_depth) {
 
   EXPECT_EQ(client_cb_count_, client_qos_profile.depth());
 }
+
+TEST_F(TestClient, intra_process_request) {
+  auto ipc_node = std::make_shared<rclcpp::Node>(
+    "ipc_node", "/ns", rclcpp::NodeOptions().use_intra_process_comms(true));
+
+  uint64_t server_cb_count = 0;
+  auto service = ipc_node->create_service<test_msgs::srv::Empty>(
+    "ipc_service",
+    [&server_cb_count](
+      const test_msgs::srv::Empty::Request::SharedPtr,
+      test_msgs::srv::Empty::Response::SharedPtr) {server_cb_count++;});
+  auto client = ipc_node->create_client<test_msgs::srv::Empty>("ipc_service");
+
+  // The request is buffered for the service's executor, not run inline on
+  // the calling thread.
+  auto future = client->async_send_request(std::make_shared<test_msgs::srv::Empty::Request>());
+  EXPECT_LT(future.request_id, 0);
+  EXPECT_EQ(0u, server_cb_count);
+  EXPECT_NE(std::future_status::ready, future.wait_for(0s));
+
+  // Spinning dispatches the request in the service's callback group and
+  // completes the future.
+  auto start = std::chrono::steady_clock::now();
+  while (future.wait_for(0s) != std::future_status::ready &&
+    (std::chrono::steady_clock::now() - start) < 1s)
+  {
+    rclcpp::spin_some(ipc_node);
+  }
+  EXPECT_EQ(1u, server_cb_count);
+  ASSERT_EQ(std::future_status::ready, future.wait_for(0s));
+  EXPECT_NE(nullptr, future.get());
+
+  // Callback overloads complete through the executor as well.
+  using SharedFuture = rclcpp::Client<test_msgs::srv::Empty>::SharedFuture;
+  uint64_t client_cb_count = 0;
+  client->async_send_request(
+    std::make_shared<test_msgs::srv::Empty::Request>(),
+    [&client_cb_count](SharedFuture) {client_cb_count++;});
+  EXPECT_EQ(0u, client_cb_count);
+  start = std::chrono::steady_clock::now();
+  while (client_cb_count == 0 && (std::chrono::steady_clock::now() - start) < 1s) {
+    rclcpp::spin_some(ipc_node);
+  }
+  EXPECT_EQ(2u, server_cb_count);
+  EXPECT_EQ(1u, client_cb_count);
+
+  // Once the service is gone, requests fall back to the middleware path
+  // and stay pending.
+  service.reset();
+  auto pending = client->async_send_request(
+    std::make_shared<test_msgs::srv::Empty::Request>());
+  EXPECT_GE(pending.request_id, 0);
+  EXPECT_NE(std::future_status::ready, pending.wait_for(0s));
+  EXPECT_TRUE(client->remove_pending_request(pending));
+}
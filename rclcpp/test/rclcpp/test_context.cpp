@@ -214,3 +214,102 @@ TEST(TestContext, check_on_shutdown_callback_order_after_del) {
 
   EXPECT_TRUE(result[0] == 1 && result[1] == 3 && result[2] == 4 && result[3] == 0);
 }
+
+TEST(TestContext, asynchronous_logging_smoke) {
+  auto context = std::make_shared<rclcpp::Context>();
+  auto init_options = rclcpp::InitOptions().asynchronous_logging(true);
+  context->init(0, nullptr, init_options);
+
+  auto logger = rclcpp::get_logger("test_asynchronous_logging");
+  for (int i = 0; i < 10; ++i) {
+    RCLCPP_INFO(logger, "asynchronous log message %d", i);
+  }
+
+  // Shutdown flushes the queued records and joins the drain thread before
+  // logging is finalized; it must complete without deadlocking.
+  EXPECT_TRUE(context->shutdown("for test"));
+}
+
+TEST(TestContext, parallel_shutdown_callbacks) {
+  auto context = std::make_shared<rclcpp::Context>();
+  auto init_options = rclcpp::InitOptions();
+  init_options.parallel_shutdown_callbacks = true;
+  context->init(0, nullptr, init_options);
+
+  std::atomic<int> pre_count {0};
+  std::atomic<int> on_count {0};
+  for (int i = 0; i < 16; ++i) {
+    context->add_pre_shutdown_callback([&pre_count]() {pre_count++;});
+    context->add_on_shutdown_callback([&on_count]() {on_count++;});
+  }
+
+  context->shutdown("for test");
+
+  // Execution order is unspecified in parallel mode, but every callback runs
+  // exactly once before shutdown() returns.
+  EXPECT_EQ(pre_count.load(), 16);
+  EXPECT_EQ(on_count.load(), 16);
+}
+
+TEST(TestContext, deferred_entity_finalization) {
+  auto context = std::make_shared<rclcpp::Context>();
+  auto init_options = rclcpp::InitOptions();
+  init_options.deferred_entity_finalization = true;
+  context->init(0, nullptr, init_options);
+
+  std::atomic<int> inline_runs {0};
+  EXPECT_FALSE(context->is_deferred_finalization_active());
+  context->defer_entity_finalization([&inline_runs]() {inline_runs++;});
+  // The mode only activates on shutdown; before that the work runs inline.
+  EXPECT_EQ(inline_runs.load(), 1);
+
+  context->shutdown("for test");
+  EXPECT_TRUE(context->is_deferred_finalization_active());
+
+  std::atomic<int> deferred_runs {0};
+  for (int i = 0; i < 8; ++i) {
+    context->defer_entity_finalization([&deferred_runs]() {deferred_runs++;});
+  }
+  context->wait_for_deferred_finalization();
+  EXPECT_EQ(deferred_runs.load(), 8);
+  EXPECT_FALSE(context->is_deferred_finalization_active());
+}
+
+TEST(TestContext, repeated_init_with_identical_argv) {
+  const char * const argv[] = {
+    "process_name",
+    "--ros-args",
+    "--param", "foo:=bar",
+  };
+  int argc = sizeof(argv) / sizeof(const char *);
+
+  // The first init validates the arguments; later contexts with the same
+  // argv reuse the cached validation and still come up fully usable.
+  std::vector<std::shared_ptr<rclcpp::Context>> contexts;
+  for (int i = 0; i < 3; ++i) {
+    auto context = std::make_shared<rclcpp::Context>();
+    context->init(argc, argv);
+    EXPECT_TRUE(context->is_valid());
+    contexts.push_back(context);
+  }
+  for (auto & context : contexts) {
+    context->shutdown("for test");
+  }
+}
+
+TEST(TestContext, repeated_init_with_bad_argv_keeps_throwing) {
+  const char * const argv[] = {
+    "process_name",
+    "--ros-args",
+    "not-a-ros-arg",
+  };
+  int argc = sizeof(argv) / sizeof(const char *);
+
+  // A rejected argv must never be cached as validated.
+  for (int i = 0; i < 2; ++i) {
+    auto context = std::make_shared<rclcpp::Context>();
+    EXPECT_THROW(
+      context->init(argc, argv),
+      rclcpp::exceptions::UnknownROSArgsError);
+  }
+}
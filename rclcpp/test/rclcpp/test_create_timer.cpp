@@ -219,3 +219,68 @@ TEST(TestCreateTimer, timer_without_autostart)
 
   rclcpp::shutdown();
 }
+
+TEST(TestCreateTimer, timer_with_phase_offset)
+{
+  rclcpp::init(0, nullptr);
+  NodeWrapper node("test_create_timer_with_phase_offset");
+  rclcpp::CallbackGroup::SharedPtr group = nullptr;
+  auto node_interface =
+    rclcpp::node_interfaces::get_node_base_interface(node).get();
+  auto timers_interface =
+    rclcpp::node_interfaces::get_node_timers_interface(node).get();
+
+  // Negative phase
+  EXPECT_THROW(
+    rclcpp::create_wall_timer(
+      100ms, []() {}, group, node_interface, timers_interface, true, -1ms),
+    std::invalid_argument);
+
+  // Without a phase the first trigger is at most one period out.
+  auto plain_timer = rclcpp::create_wall_timer(
+    100ms, []() {}, group, node_interface, timers_interface);
+  EXPECT_LE(plain_timer->time_until_trigger(), 100ms);
+
+  // The phase delays the first trigger by the offset, beyond one period.
+  auto phased_timer = rclcpp::create_wall_timer(
+    100ms, []() {}, group, node_interface, timers_interface, true, 50ms);
+  EXPECT_GT(phased_timer->time_until_trigger(), 100ms);
+  EXPECT_LE(phased_timer->time_until_trigger(), 150ms);
+
+  plain_timer->cancel();
+  phased_timer->cancel();
+  rclcpp::shutdown();
+}
+
+TEST(TestCreateTimer, phase_offset_applies_to_first_trigger_only)
+{
+  rclcpp::init(0, nullptr);
+  auto node = std::make_shared<rclcpp::Node>("test_create_timer_node");
+
+  std::atomic<bool> got_callback{false};
+  rclcpp::TimerBase::SharedPtr timer;
+  timer = rclcpp::create_timer(
+    node,
+    node->get_clock(),
+    rclcpp::Duration(10ms),
+    [&got_callback, &timer]() {
+      got_callback = true;
+      timer->cancel();
+    },
+    nullptr,
+    true,
+    rclcpp::Duration(30ms));
+
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(node);
+  while (!got_callback) {
+    executor.spin_once(100ms);
+  }
+  // The phased first trigger consumed the offset; the schedule is back on
+  // the plain period.
+  timer->reset();
+  EXPECT_LE(timer->time_until_trigger(), 10ms);
+
+  timer->cancel();
+  rclcpp::shutdown();
+}
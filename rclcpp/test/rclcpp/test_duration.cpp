@@ -335,3 +335,27 @@ TEST_F(TestDuration, test_some_exceptions) {
     test_duration = test_duration * (std::numeric_limits<double>::infinity()),
     std::runtime_error("abnormal scale in rclcpp::Duration"));
 }
+
+TEST_F(TestDuration, unchecked_arithmetic) {
+  rclcpp::Duration duration = rclcpp::Duration::from_nanoseconds(1500);
+  rclcpp::UncheckedDuration unchecked = duration.unchecked();
+  EXPECT_EQ(1500, unchecked.nanoseconds());
+
+  unchecked += rclcpp::UncheckedDuration(500);
+  EXPECT_EQ(2000, unchecked.nanoseconds());
+  EXPECT_EQ(1000, (unchecked - rclcpp::UncheckedDuration(1000)).nanoseconds());
+  EXPECT_EQ(3000, (unchecked * 1.5).nanoseconds());
+  EXPECT_TRUE(rclcpp::UncheckedDuration(1000) < unchecked);
+
+  EXPECT_EQ(2000, unchecked.checked().nanoseconds());
+
+  // Overflow wraps like two's complement arithmetic instead of throwing.
+  rclcpp::UncheckedDuration max(std::numeric_limits<rcl_duration_value_t>::max());
+  max += rclcpp::UncheckedDuration(1);
+  EXPECT_EQ(std::numeric_limits<rcl_duration_value_t>::min(), max.nanoseconds());
+
+  // Scaling past the representable range saturates at the bounds.
+  rclcpp::UncheckedDuration big(std::numeric_limits<rcl_duration_value_t>::max());
+  EXPECT_EQ(std::numeric_limits<rcl_duration_value_t>::max(), (big * 2.0).nanoseconds());
+  EXPECT_EQ(std::numeric_limits<rcl_duration_value_t>::min(), (big * -2.0).nanoseconds());
+}
@@ -15,11 +15,14 @@
 #include <gtest/gtest.h>
 
 #include <chrono>
+#include <future>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include "rclcpp/executor.hpp"
+#include "rclcpp/introspection.hpp"
 #include "rclcpp/memory_strategy.hpp"
 #include "rclcpp/executors/single_threaded_executor.hpp"
 #include "rclcpp/strategies/allocator_memory_strategy.hpp"
@@ -63,6 +66,11 @@ public:
   {
     return get_group_by_timer(timer);
   }
+
+  bool local_run_idle_work()
+  {
+    return run_idle_work();
+  }
 };
 
 class TestExecutor : public ::testing::Test
@@ -294,6 +302,144 @@ TEST_F(TestExecutor, spin_some_elapsed) {
   ASSERT_TRUE(timer_called);
 }
 
+TEST_F(TestExecutor, add_idle_work_invalid_arguments) {
+  DummyExecutor dummy;
+
+  RCLCPP_EXPECT_THROW_EQ(
+    dummy.add_idle_work(nullptr, std::chrono::milliseconds(1)),
+    std::invalid_argument("callback is nullptr"));
+  RCLCPP_EXPECT_THROW_EQ(
+    dummy.add_idle_work([]() {return false;}, std::chrono::nanoseconds(0)),
+    std::invalid_argument("budget must be positive"));
+}
+
+TEST_F(TestExecutor, idle_work_runs_only_in_spare_time) {
+  DummyExecutor dummy;
+  auto node = std::make_shared<rclcpp::Node>("node", "ns");
+  dummy.add_node(node);
+
+  size_t units_done = 0;
+  dummy.add_idle_work(
+    [&units_done]() {
+      if (units_done >= 5) {
+        return false;  // housekeeping is done for now
+      }
+      ++units_done;
+      return true;
+    },
+    std::chrono::milliseconds(1));
+
+  // No real work is ready: the blocking time is spent on the idle work.
+  dummy.spin_once(std::chrono::milliseconds(10));
+  EXPECT_EQ(5u, units_done);
+
+  // All idle work is done, so an expired timer is executed as usual.
+  bool timer_fired = false;
+  auto timer =
+    node->create_wall_timer(std::chrono::milliseconds(1), [&timer_fired]() {timer_fired = true;});
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  dummy.spin_once(std::chrono::milliseconds(10));
+  EXPECT_TRUE(timer_fired);
+  EXPECT_EQ(5u, units_done);
+}
+
+TEST_F(TestExecutor, idle_work_round_robin) {
+  DummyExecutor dummy;
+
+  // The first registration never has anything to do and must not prevent
+  // the second one from being granted the slice.
+  size_t first_polled = 0;
+  dummy.add_idle_work(
+    [&first_polled]() {
+      ++first_polled;
+      return false;
+    },
+    std::chrono::milliseconds(1));
+  size_t second_units = 0;
+  dummy.add_idle_work(
+    [&second_units]() {
+      if (second_units >= 3) {
+        return false;
+      }
+      ++second_units;
+      return true;
+    },
+    std::chrono::milliseconds(1));
+
+  EXPECT_TRUE(dummy.local_run_idle_work());
+  EXPECT_EQ(3u, second_units);
+  EXPECT_EQ(1u, first_polled);
+
+  // With every callback reporting nothing to do, no slice is granted.
+  EXPECT_FALSE(dummy.local_run_idle_work());
+  EXPECT_EQ(3u, second_units);
+  EXPECT_EQ(2u, first_polled);
+}
+
+TEST_F(TestExecutor, callback_group_stats) {
+  DummyExecutor dummy;
+  auto node = std::make_shared<rclcpp::Node>("node", "ns");
+  auto group = node->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+  auto timer =
+    node->create_wall_timer(
+    std::chrono::milliseconds(1), [&]() {
+      // Burn some CPU so the attributed time is measurably non-zero.
+      volatile size_t accumulator = 0;
+      while (accumulator < 2000000u) {
+        accumulator = accumulator + 1;
+      }
+    }, group);
+
+  const auto before = group->get_stats();
+  EXPECT_EQ(0u, before.executions);
+  EXPECT_EQ(std::chrono::nanoseconds(0), before.cpu_time);
+  EXPECT_EQ(std::chrono::nanoseconds(0), before.max_execution_time);
+
+  dummy.add_node(node);
+  // Wait for the wall timer to have expired.
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  dummy.spin_some(std::chrono::milliseconds(1));
+
+  const auto after = group->get_stats();
+  EXPECT_EQ(1u, after.executions);
+  EXPECT_LT(std::chrono::nanoseconds(0), after.cpu_time);
+  EXPECT_LT(std::chrono::nanoseconds(0), after.max_execution_time);
+  EXPECT_LE(after.max_execution_time, after.cpu_time);
+}
+
+TEST_F(TestExecutor, spin_some_invalid_budget) {
+  DummyExecutor dummy;
+
+  RCLCPP_EXPECT_THROW_EQ(
+    dummy.spin_some(std::chrono::nanoseconds(-1), 1u),
+    std::invalid_argument("max_duration must be greater than or equal to 0"));
+  RCLCPP_EXPECT_THROW_EQ(
+    dummy.spin_some(std::chrono::milliseconds(1), 0u),
+    std::invalid_argument("max_callbacks must be greater than 0"));
+}
+
+TEST_F(TestExecutor, spin_some_callback_budget) {
+  DummyExecutor dummy;
+  auto node = std::make_shared<rclcpp::Node>("node", "ns");
+  size_t timer_one_calls = 0;
+  size_t timer_two_calls = 0;
+  // Periods long enough that a fired timer cannot become ready again between slices.
+  auto timer_one =
+    node->create_wall_timer(std::chrono::milliseconds(50), [&]() {timer_one_calls++;});
+  auto timer_two =
+    node->create_wall_timer(std::chrono::milliseconds(50), [&]() {timer_two_calls++;});
+
+  dummy.add_node(node);
+  // Wait for both wall timers to have expired.
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  dummy.spin_some(std::chrono::milliseconds(0), 1u);
+  // Only one of the two ready timers fits the budget; the other resumes next slice.
+  EXPECT_EQ(1u, timer_one_calls + timer_two_calls);
+  dummy.spin_some(std::chrono::milliseconds(0), 1u);
+  EXPECT_EQ(1u, timer_one_calls);
+  EXPECT_EQ(1u, timer_two_calls);
+}
+
 TEST_F(TestExecutor, spin_once_in_spin_once) {
   DummyExecutor dummy;
   auto node = std::make_shared<rclcpp::Node>("node", "ns");
@@ -557,6 +703,49 @@ TEST_F(TestExecutor, spin_until_future_complete_future_already_complete) {
     dummy.spin_until_future_complete(future, std::chrono::milliseconds(1)));
 }
 
+TEST_F(TestExecutor, spin_until_all_complete) {
+  DummyExecutor dummy;
+  auto node = std::make_shared<rclcpp::Node>("node", "ns");
+  std::vector<std::promise<void>> promises(3);
+  std::vector<std::future<void>> futures;
+  for (auto & promise : promises) {
+    futures.push_back(promise.get_future());
+  }
+
+  // One future still pending times the whole gather out.
+  promises[0].set_value();
+  promises[2].set_value();
+  EXPECT_EQ(
+    rclcpp::FutureReturnCode::TIMEOUT,
+    dummy.spin_until_all_complete(futures, std::chrono::milliseconds(1)));
+
+  // All futures complete without spinning returns immediately.
+  promises[1].set_value();
+  EXPECT_EQ(
+    rclcpp::FutureReturnCode::SUCCESS,
+    dummy.spin_until_all_complete(futures, std::chrono::milliseconds(1)));
+}
+
+TEST_F(TestExecutor, spin_until_any_complete) {
+  DummyExecutor dummy;
+  auto node = std::make_shared<rclcpp::Node>("node", "ns");
+  std::vector<std::promise<void>> promises(3);
+  std::vector<std::future<void>> futures;
+  for (auto & promise : promises) {
+    futures.push_back(promise.get_future());
+  }
+
+  EXPECT_EQ(
+    rclcpp::FutureReturnCode::TIMEOUT,
+    dummy.spin_until_any_complete(futures, std::chrono::milliseconds(1)));
+
+  // A single ready future is enough.
+  promises[1].set_value();
+  EXPECT_EQ(
+    rclcpp::FutureReturnCode::SUCCESS,
+    dummy.spin_until_any_complete(futures, std::chrono::milliseconds(1)));
+}
+
 TEST_F(TestExecutor, is_spinning) {
   DummyExecutor dummy;
   ASSERT_FALSE(dummy.is_spinning());
@@ -577,3 +766,43 @@ TEST_F(TestExecutor, is_spinning) {
 
   ASSERT_TRUE(timer_called);
 }
+
+TEST_F(TestExecutor, set_callback_deadline_invalid_argument) {
+  DummyExecutor dummy;
+
+  RCLCPP_EXPECT_THROW_EQ(
+    dummy.set_callback_deadline(std::chrono::nanoseconds(-1)),
+    std::invalid_argument("deadline cannot be negative"));
+}
+
+TEST_F(TestExecutor, watchdog_records_slow_callback) {
+  DummyExecutor dummy;
+  auto node = std::make_shared<rclcpp::Node>("node", "ns");
+  bool timer_called = false;
+  auto timer =
+    node->create_wall_timer(
+    std::chrono::milliseconds(1), [&]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+      timer_called = true;
+    });
+
+  dummy.add_node(node);
+  dummy.set_callback_deadline(std::chrono::milliseconds(5));
+  const size_t stalls_before = rclcpp::introspection::stall_events().size();
+
+  // Wait for the wall timer to have expired, then dispatch the slow callback.
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  dummy.spin_some(std::chrono::milliseconds(1));
+  ASSERT_TRUE(timer_called);
+
+  const auto events = rclcpp::introspection::stall_events();
+  ASSERT_GT(events.size(), stalls_before);
+  const auto & event = events.back();
+  EXPECT_EQ("timer", event.description);
+  // Flagged no earlier than the deadline, while the callback was running.
+  EXPECT_GE(event.running_ns, 5u * 1000u * 1000u);
+  EXPECT_GT(event.detected_at_ns, 0u);
+
+  // Disabling stops the watchdog thread and leaves later dispatches alone.
+  dummy.set_callback_deadline(std::chrono::nanoseconds::zero());
+}
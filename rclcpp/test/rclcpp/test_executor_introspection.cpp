@@ -0,0 +1,111 @@
+// Copyright 2024 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <memory>
+
+#include "gtest/gtest.h"
+
+#include "rclcpp/executor_introspection.hpp"
+#include "rclcpp/executors/single_threaded_executor.hpp"
+#include "rclcpp/node.hpp"
+#include "rclcpp/utilities.hpp"
+
+using namespace std::chrono_literals;
+
+namespace introspection = rclcpp::executor_introspection;
+
+class TestExecutorIntrospection : public ::testing::Test
+{
+public:
+  void SetUp()
+  {
+    rclcpp::init(0, nullptr);
+    introspection::reset();
+  }
+
+  void TearDown()
+  {
+    introspection::disable();
+    introspection::reset();
+    rclcpp::shutdown();
+  }
+};
+
+TEST_F(TestExecutorIntrospection, enable_disable)
+{
+  EXPECT_FALSE(introspection::enabled());
+  introspection::enable();
+  EXPECT_TRUE(introspection::enabled());
+  introspection::disable();
+  EXPECT_FALSE(introspection::enabled());
+}
+
+TEST_F(TestExecutorIntrospection, bucket_mapping)
+{
+  // Buckets partition the value range: every value maps to the bucket whose
+  // lower bound is the largest one not exceeding it.
+  for (uint64_t value : {0ull, 1ull, 7ull, 8ull, 1000ull, 123456789ull}) {
+    size_t index = introspection::bucket_index(value);
+    EXPECT_LE(introspection::bucket_lower_bound(index), value);
+    if (index + 1 < introspection::kHistogramBuckets) {
+      EXPECT_GT(introspection::bucket_lower_bound(index + 1), value);
+    }
+  }
+}
+
+TEST_F(TestExecutorIntrospection, record_and_snapshot)
+{
+  introspection::enable();
+
+  auto wakeup = std::chrono::steady_clock::now();
+  introspection::mark_wakeup();
+  introspection::record_dispatch(wakeup + 10ms, wakeup + 30ms);
+  introspection::record_dispatch(wakeup + 50ms, wakeup + 51ms);
+
+  auto dispatch_latency = introspection::get_wakeup_to_dispatch_histogram();
+  EXPECT_EQ(2u, dispatch_latency.count);
+  EXPECT_LT(0u, dispatch_latency.sum_ns);
+
+  auto dispatch_duration = introspection::get_dispatch_duration_histogram();
+  EXPECT_EQ(2u, dispatch_duration.count);
+  EXPECT_GE(dispatch_duration.max_ns, 20000000u);
+
+  // The median must not exceed the maximum recorded value.
+  EXPECT_LE(dispatch_duration.quantile(0.5).count(), static_cast<int64_t>(
+      dispatch_duration.max_ns));
+
+  introspection::reset();
+  EXPECT_EQ(0u, introspection::get_wakeup_to_dispatch_histogram().count);
+  EXPECT_EQ(0u, introspection::get_dispatch_duration_histogram().count);
+}
+
+TEST_F(TestExecutorIntrospection, spin_records_samples)
+{
+  introspection::enable();
+
+  auto node = std::make_shared<rclcpp::Node>("introspection_test_node");
+  auto timer = node->create_wall_timer(1ms, []() {});
+
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(node);
+  auto start = std::chrono::steady_clock::now();
+  while (introspection::get_dispatch_duration_histogram().count == 0 &&
+    (std::chrono::steady_clock::now() - start) < 5s)
+  {
+    executor.spin_some(10ms);
+  }
+
+  EXPECT_LT(0u, introspection::get_dispatch_duration_histogram().count);
+}
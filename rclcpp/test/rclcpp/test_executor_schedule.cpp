@@ -0,0 +1,172 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "rclcpp/executor_schedule.hpp"
+#include "rclcpp/executors/single_threaded_executor.hpp"
+#include "rclcpp/node.hpp"
+#include "rclcpp/utilities.hpp"
+
+using namespace std::chrono_literals;
+
+namespace schedule = rclcpp::executor_schedule;
+
+class TestExecutorSchedule : public ::testing::Test
+{
+public:
+  void SetUp()
+  {
+    rclcpp::init(0, nullptr);
+  }
+
+  void TearDown()
+  {
+    schedule::stop_recording();
+    schedule::drain();
+    rclcpp::shutdown();
+  }
+};
+
+TEST_F(TestExecutorSchedule, recording_ring_overwrites_oldest)
+{
+  EXPECT_FALSE(schedule::recording());
+  EXPECT_THROW(schedule::start_recording(0), std::invalid_argument);
+
+  schedule::start_recording(3);
+  EXPECT_TRUE(schedule::recording());
+  for (uint64_t id = 1; id <= 5; ++id) {
+    schedule::record_dispatch(
+      id, schedule::ExecutableKind::Timer,
+      static_cast<int64_t>(id) * 10, static_cast<int64_t>(id) * 10 + 5);
+  }
+  schedule::stop_recording();
+  EXPECT_FALSE(schedule::recording());
+
+  // Five dispatches into a ring of three: only the newest three remain.
+  auto records = schedule::drain();
+  ASSERT_EQ(3u, records.size());
+  EXPECT_EQ(3u, records[0].entity_id);
+  EXPECT_EQ(4u, records[1].entity_id);
+  EXPECT_EQ(5u, records[2].entity_id);
+  EXPECT_EQ(30, records[0].start_time_ns);
+  EXPECT_EQ(35, records[0].end_time_ns);
+
+  // Draining leaves the ring empty.
+  EXPECT_TRUE(schedule::drain().empty());
+}
+
+TEST_F(TestExecutorSchedule, write_and_read_roundtrip)
+{
+  std::vector<schedule::DispatchRecord> records;
+  records.push_back({7u, schedule::ExecutableKind::Subscription, 1, 2, 3});
+  records.push_back({9u, schedule::ExecutableKind::Waitable, 4, 5, 6});
+
+  std::stringstream stream;
+  schedule::write_schedule(stream, records);
+  auto read_back = schedule::read_schedule(stream);
+  ASSERT_EQ(2u, read_back.size());
+  EXPECT_EQ(7u, read_back[0].entity_id);
+  EXPECT_EQ(schedule::ExecutableKind::Subscription, read_back[0].kind);
+  EXPECT_EQ(1, read_back[0].ready_time_ns);
+  EXPECT_EQ(9u, read_back[1].entity_id);
+  EXPECT_EQ(6, read_back[1].end_time_ns);
+
+  std::stringstream garbage("not a schedule");
+  EXPECT_THROW(schedule::read_schedule(garbage), std::runtime_error);
+}
+
+TEST_F(TestExecutorSchedule, replay_preserves_order)
+{
+  std::vector<schedule::DispatchRecord> records;
+  records.push_back({1u, schedule::ExecutableKind::Timer, 0, 0, 1});
+  records.push_back({2u, schedule::ExecutableKind::Subscription, 0, 2, 3});
+  records.push_back({1u, schedule::ExecutableKind::Timer, 0, 4, 5});
+  records.push_back({3u, schedule::ExecutableKind::Service, 0, 6, 7});
+
+  schedule::ScheduleReplayer replayer(records);
+  std::vector<uint64_t> order;
+  replayer.set_stub(
+    1u, [&order](const schedule::DispatchRecord & record) {
+      order.push_back(record.entity_id);
+    });
+  replayer.set_stub(
+    2u, [&order](const schedule::DispatchRecord & record) {
+      order.push_back(record.entity_id);
+    });
+  // Entity 3 has no stub of its own and falls through to the fallback.
+  size_t fallback_calls = 0;
+  replayer.set_fallback_stub(
+    [&fallback_calls](const schedule::DispatchRecord &) {++fallback_calls;});
+
+  EXPECT_EQ(4u, replayer.replay());
+  EXPECT_EQ(std::vector<uint64_t>({1u, 2u, 1u}), order);
+  EXPECT_EQ(1u, fallback_calls);
+  EXPECT_EQ(4u, replayer.get_records().size());
+}
+
+TEST_F(TestExecutorSchedule, replay_paces_to_recorded_gaps)
+{
+  std::vector<schedule::DispatchRecord> records;
+  records.push_back({1u, schedule::ExecutableKind::Timer, 0, 0, 1});
+  records.push_back(
+    {1u, schedule::ExecutableKind::Timer, 0,
+      std::chrono::nanoseconds(20ms).count(),
+      std::chrono::nanoseconds(20ms).count() + 1});
+
+  schedule::ScheduleReplayer replayer(records);
+  replayer.set_fallback_stub([](const schedule::DispatchRecord &) {});
+  auto start = std::chrono::steady_clock::now();
+  EXPECT_EQ(2u, replayer.replay(true));
+  EXPECT_GE(std::chrono::steady_clock::now() - start, 20ms);
+}
+
+TEST_F(TestExecutorSchedule, spin_records_dispatches)
+{
+  schedule::start_recording(128);
+
+  auto node = std::make_shared<rclcpp::Node>("schedule_test_node");
+  auto timer = node->create_wall_timer(1ms, []() {});
+  const uint64_t timer_id = reinterpret_cast<uint64_t>(timer->get_timer_handle().get());
+
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(node);
+  std::vector<schedule::DispatchRecord> records;
+  auto start = std::chrono::steady_clock::now();
+  while (records.empty() && (std::chrono::steady_clock::now() - start) < 5s) {
+    executor.spin_some(10ms);
+    schedule::stop_recording();
+    records = schedule::drain();
+    if (records.empty()) {
+      schedule::start_recording(128);
+    }
+  }
+
+  ASSERT_FALSE(records.empty());
+  bool saw_timer = false;
+  for (const auto & record : records) {
+    EXPECT_LE(record.start_time_ns, record.end_time_ns);
+    if (record.entity_id == timer_id) {
+      EXPECT_EQ(schedule::ExecutableKind::Timer, record.kind);
+      saw_timer = true;
+    }
+  }
+  EXPECT_TRUE(saw_timer);
+}
@@ -15,6 +15,7 @@
 
 #include <gmock/gmock.h>
 
+#include <cstring>
 #include <future>
 #include <memory>
 #include <string>
@@ -25,11 +26,13 @@
 
 #include "rcl/graph.h"
 
+#include "rclcpp/create_lazy_subscription.hpp"
 #include "rclcpp/generic_publisher.hpp"
 #include "rclcpp/generic_subscription.hpp"
 #include "rclcpp/rclcpp.hpp"
 #include "rclcpp/serialization.hpp"
 #include "rclcpp/serialized_message.hpp"
+#include "rclcpp/serialized_message_codec.hpp"
 
 using namespace ::testing;  // NOLINT
 using namespace rclcpp;  // NOLINT
@@ -179,6 +182,52 @@ TEST_F(RclcppGenericNodeFixture, publisher_and_subscriber_work)
   EXPECT_THAT(subscribed_messages[0], StrEq("Hello World"));
 }
 
+TEST_F(RclcppGenericNodeFixture, publish_batch_works)
+{
+  // We currently publish more messages because they can get lost
+  std::vector<std::string> test_messages = {"Hello World", "Hello World"};
+  std::string topic_name = "/batch_string_topic";
+  std::string type = "test_msgs/msg/Strings";
+
+  auto publisher = node_->create_generic_publisher(
+    topic_name, type, rclcpp::QoS(1));
+
+  auto subscriber_future_ = std::async(
+    std::launch::async, [this, topic_name, type] {
+      return subscribe_raw_messages<std::string, test_msgs::msg::Strings>(1, topic_name, type);
+    });
+
+  auto allocator = node_->get_node_options().allocator();
+  auto success = false;
+  auto ret = rcl_wait_for_subscribers(
+    node_->get_node_base_interface()->get_rcl_node_handle(),
+    &allocator,
+    topic_name.c_str(),
+    1u,
+    static_cast<rcutils_duration_value_t>(1e9),
+    &success);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ASSERT_TRUE(success);
+
+  // Build non-owning views over caller-owned serialized messages, as a bag replay
+  // would over a memory-mapped file.
+  std::vector<rclcpp::SerializedMessage> serialized_messages;
+  for (const auto & message : test_messages) {
+    serialized_messages.push_back(
+      serialize_message<std::string, test_msgs::msg::Strings>(message));
+  }
+  std::vector<rclcpp::SerializedBufferView> views;
+  for (const auto & serialized_message : serialized_messages) {
+    const auto & rcl_message = serialized_message.get_rcl_serialized_message();
+    views.push_back({rcl_message.buffer, rcl_message.buffer_length});
+  }
+  publisher->publish_batch(views);
+
+  auto subscribed_messages = subscriber_future_.get();
+  EXPECT_THAT(subscribed_messages, SizeIs(Not(0)));
+  EXPECT_THAT(subscribed_messages[0], StrEq("Hello World"));
+}
+
 TEST_F(RclcppGenericNodeFixture, publish_loaned_msg_work)
 {
   // We currently publish more messages because they can get lost
@@ -263,3 +312,166 @@ TEST_F(RclcppGenericNodeFixture, generic_publisher_uses_qos)
   // It normally takes < 20ms, 5s chosen as "a very long time"
   ASSERT_TRUE(wait_for(connected, 5s));
 }
+
+TEST_F(RclcppGenericNodeFixture, subscription_with_serialized_message_view_works)
+{
+  // We currently publish more messages because they can get lost
+  std::vector<std::string> test_messages = {"Hello World", "Hello World"};
+  std::string topic_name = "/string_view_topic";
+  std::string type = "test_msgs/msg/Strings";
+
+  auto publisher = node_->create_generic_publisher(
+    topic_name, type, rclcpp::QoS(1));
+
+  std::vector<std::string> received_messages;
+  auto subscription = node_->create_generic_subscription(
+    topic_name, type, rclcpp::QoS(1),
+    [&received_messages](rclcpp::SerializedMessageView view) {
+      EXPECT_NE(view.data(), nullptr);
+      EXPECT_GT(view.size(), 0u);
+      // Copying out of the view must not invalidate the borrowed buffer.
+      rclcpp::SerializedMessage copy = view.to_serialized_message();
+      test_msgs::msg::Strings deserialized_message;
+      rclcpp::Serialization<test_msgs::msg::Strings> serializer;
+      serializer.deserialize_message(&copy, &deserialized_message);
+      received_messages.push_back(deserialized_message.string_value);
+    });
+
+  auto allocator = node_->get_node_options().allocator();
+  auto success = false;
+  auto ret = rcl_wait_for_subscribers(
+    node_->get_node_base_interface()->get_rcl_node_handle(),
+    &allocator,
+    topic_name.c_str(),
+    1u,
+    static_cast<rcutils_duration_value_t>(1e9),
+    &success);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ASSERT_TRUE(success);
+
+  for (const auto & message : test_messages) {
+    publisher->publish(serialize_message<std::string, test_msgs::msg::Strings>(message));
+  }
+
+  using namespace std::chrono_literals;
+  ASSERT_TRUE(wait_for([&received_messages]() {return !received_messages.empty();}, 5s));
+  EXPECT_THAT(received_messages[0], StrEq("Hello World"));
+}
+
+// Simple invertible codec standing in for a real compressor.
+class XorCodec : public rclcpp::SerializedMessageCodec
+{
+public:
+  void encode(
+    const rclcpp::SerializedMessage & input, rclcpp::SerializedMessage & output) override
+  {
+    transform(input, output);
+  }
+
+  void decode(
+    const rclcpp::SerializedMessage & input, rclcpp::SerializedMessage & output) override
+  {
+    transform(input, output);
+  }
+
+private:
+  static void transform(
+    const rclcpp::SerializedMessage & input, rclcpp::SerializedMessage & output)
+  {
+    output.reserve(input.size());
+    const auto & in = input.get_rcl_serialized_message();
+    auto & out = output.get_rcl_serialized_message();
+    for (size_t i = 0; i < in.buffer_length; ++i) {
+      out.buffer[i] = in.buffer[i] ^ 0x5A;
+    }
+    out.buffer_length = in.buffer_length;
+  }
+};
+
+TEST_F(RclcppGenericNodeFixture, generic_pubsub_with_codec_works)
+{
+  std::vector<std::string> test_messages = {"Hello Codec", "Hello Codec"};
+  std::string topic_name = "/string_codec_topic";
+  std::string type = "test_msgs/msg/Strings";
+  auto codec = std::make_shared<XorCodec>();
+
+  // The codec must be its own inverse on the wire format.
+  auto serialized = serialize_message<std::string, test_msgs::msg::Strings>(test_messages[0]);
+  rclcpp::SerializedMessage encoded;
+  codec->encode(serialized, encoded);
+  ASSERT_EQ(serialized.size(), encoded.size());
+  EXPECT_NE(
+    0, std::memcmp(
+      serialized.get_rcl_serialized_message().buffer,
+      encoded.get_rcl_serialized_message().buffer,
+      serialized.size()));
+  rclcpp::SerializedMessage decoded;
+  codec->decode(encoded, decoded);
+  ASSERT_EQ(serialized.size(), decoded.size());
+  EXPECT_EQ(
+    0, std::memcmp(
+      serialized.get_rcl_serialized_message().buffer,
+      decoded.get_rcl_serialized_message().buffer,
+      serialized.size()));
+
+  auto publisher = node_->create_generic_publisher(topic_name, type, rclcpp::QoS(1));
+  publisher->set_codec(codec);
+
+  std::vector<std::string> received_messages;
+  auto subscription = node_->create_generic_subscription(
+    topic_name, type, rclcpp::QoS(1),
+    [&received_messages](std::shared_ptr<rclcpp::SerializedMessage> message) {
+      test_msgs::msg::Strings deserialized_message;
+      rclcpp::Serialization<test_msgs::msg::Strings> serializer;
+      serializer.deserialize_message(message.get(), &deserialized_message);
+      received_messages.push_back(deserialized_message.string_value);
+    });
+  subscription->set_codec(codec);
+
+  for (const auto & message : test_messages) {
+    publisher->publish(serialize_message<std::string, test_msgs::msg::Strings>(message));
+  }
+
+  using namespace std::chrono_literals;
+  ASSERT_TRUE(wait_for([&received_messages]() {return !received_messages.empty();}, 5s));
+  EXPECT_THAT(received_messages[0], StrEq("Hello Codec"));
+}
+
+TEST_F(RclcppGenericNodeFixture, lazy_subscription_works)
+{
+  std::vector<std::string> test_messages = {"Hello World", "Hello World"};
+  std::string topic_name = "/lazy_string_topic";
+  std::string type = "test_msgs/msg/Strings";
+
+  auto publisher = node_->create_generic_publisher(
+    topic_name, type, rclcpp::QoS(1));
+
+  std::vector<std::string> received_messages;
+  auto subscription = rclcpp::create_lazy_subscription<test_msgs::msg::Strings>(
+    node_->get_node_topics_interface(),
+    topic_name, rclcpp::QoS(1),
+    [&received_messages](rclcpp::LazyMessage<test_msgs::msg::Strings> message) {
+      EXPECT_FALSE(message.is_deserialized());
+      received_messages.push_back(message->string_value);
+    });
+
+  auto allocator = node_->get_node_options().allocator();
+  auto success = false;
+  auto ret = rcl_wait_for_subscribers(
+    node_->get_node_base_interface()->get_rcl_node_handle(),
+    &allocator,
+    topic_name.c_str(),
+    1u,
+    static_cast<rcutils_duration_value_t>(1e9),
+    &success);
+  ASSERT_EQ(RCL_RET_OK, ret) << rcl_get_error_string().str;
+  ASSERT_TRUE(success);
+
+  for (const auto & message : test_messages) {
+    publisher->publish(serialize_message<std::string, test_msgs::msg::Strings>(message));
+  }
+
+  using namespace std::chrono_literals;
+  ASSERT_TRUE(wait_for([&received_messages]() {return !received_messages.empty();}, 5s));
+  EXPECT_THAT(received_messages[0], StrEq("Hello World"));
+}
@@ -182,3 +182,36 @@ TEST_F(TestGuardCondition, callback_and_waitset) {
   EXPECT_EQ(rclcpp::WaitResultKind::Ready, wait_set.wait(std::chrono::seconds(1)).kind());
   EXPECT_EQ(c1.load(), 1u);
 }
+
+/*
+ * Testing that redundant triggers are deduplicated per wait cycle without
+ * losing wakeups or listener notifications
+ */
+TEST_F(TestGuardCondition, trigger_deduplication) {
+  auto gc = std::make_shared<rclcpp::GuardCondition>();
+  std::atomic<size_t> listener_count {0};
+  gc->set_on_trigger_callback([&listener_count](size_t count) {listener_count += count;});
+
+  rclcpp::WaitSet wait_set;
+  wait_set.add_guard_condition(gc);
+
+  // A burst of triggers collapses into a single wakeup, while every trigger
+  // still reaches the listener callback.
+  gc->trigger();
+  gc->trigger();
+  gc->trigger();
+  EXPECT_EQ(3u, listener_count.load());
+  EXPECT_EQ(rclcpp::WaitResultKind::Ready, wait_set.wait(std::chrono::seconds(1)).kind());
+  EXPECT_EQ(
+    rclcpp::WaitResultKind::Timeout, wait_set.wait(std::chrono::milliseconds(100)).kind());
+
+  // Triggers are never lost across cycles, whether suppressed or not.
+  for (size_t i = 0; i < 3; ++i) {
+    gc->trigger();
+    gc->trigger();
+    EXPECT_EQ(rclcpp::WaitResultKind::Ready, wait_set.wait(std::chrono::seconds(1)).kind());
+  }
+  EXPECT_EQ(9u, listener_count.load());
+  EXPECT_EQ(
+    rclcpp::WaitResultKind::Timeout, wait_set.wait(std::chrono::milliseconds(100)).kind());
+}
@@ -0,0 +1,96 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "rclcpp/experimental/hazard_pointer.hpp"
+
+namespace
+{
+
+struct Counted
+{
+  explicit Counted(int value)
+  : value(value)
+  {
+    ++instances;
+  }
+  ~Counted() {--instances;}
+
+  int value;
+  static std::atomic<int> instances;
+};
+
+std::atomic<int> Counted::instances {0};
+
+}  // namespace
+
+/*
+   A protected object survives being retired; once the protection is gone a
+   later retirement reclaims it.
+ */
+TEST(TestHazardPointer, deferred_reclamation) {
+  rclcpp::experimental::HazardPointerDomain domain;
+  std::atomic<const Counted *> source {new Counted(1)};
+
+  {
+    rclcpp::experimental::HazardPointer<const Counted> guard(domain, source);
+    EXPECT_EQ(1, guard->value);
+
+    // Swap in a new object and retire the old one while it is protected.
+    domain.retire(source.exchange(new Counted(2)));
+    EXPECT_EQ(2, Counted::instances.load());
+    EXPECT_EQ(1, guard->value);
+  }
+
+  // The guard is gone; retiring the current object also reclaims the first.
+  domain.retire(source.exchange(nullptr));
+  EXPECT_EQ(0, Counted::instances.load());
+}
+
+/*
+   Concurrent readers always observe a live object while a writer keeps
+   swapping and retiring, and everything is reclaimed at the end.
+ */
+TEST(TestHazardPointer, concurrent_swap) {
+  rclcpp::experimental::HazardPointerDomain domain;
+  std::atomic<const Counted *> source {new Counted(0)};
+  std::atomic<bool> done {false};
+
+  std::vector<std::thread> readers;
+  for (size_t i = 0; i < 4; i++) {
+    readers.emplace_back(
+      [&domain, &source, &done]() {
+        while (!done.load()) {
+          rclcpp::experimental::HazardPointer<const Counted> guard(domain, source);
+          ASSERT_LE(0, guard->value);
+        }
+      });
+  }
+
+  for (int value = 1; value <= 1000; value++) {
+    domain.retire(source.exchange(new Counted(value)));
+  }
+  done.store(true);
+  for (auto & reader : readers) {
+    reader.join();
+  }
+
+  domain.retire(source.exchange(nullptr));
+  EXPECT_EQ(0, Counted::instances.load());
+}
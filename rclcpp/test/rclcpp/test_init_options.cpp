@@ -65,6 +65,25 @@ TEST(TestInitOptions, test_initialize_logging) {
   }
 }
 
+TEST(TestInitOptions, test_asynchronous_logging) {
+  {
+    auto options = rclcpp::InitOptions();
+    EXPECT_FALSE(options.asynchronous_logging());
+  }
+
+  {
+    auto options = rclcpp::InitOptions().asynchronous_logging(true);
+    EXPECT_TRUE(options.asynchronous_logging());
+    auto options_copy = rclcpp::InitOptions(options);
+    EXPECT_TRUE(options_copy.asynchronous_logging());
+  }
+
+  {
+    auto options = rclcpp::InitOptions().asynchronous_logging(false);
+    EXPECT_FALSE(options.asynchronous_logging());
+  }
+}
+
 TEST(TestInitOptions, test_domain_id) {
   rcl_allocator_t allocator = rcl_get_default_allocator();
   auto options = rclcpp::InitOptions(allocator);
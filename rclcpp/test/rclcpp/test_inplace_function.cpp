@@ -0,0 +1,104 @@
+// Copyright 2024 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include "rclcpp/detail/inplace_function.hpp"
+
+using rclcpp::detail::InplaceFunction;
+
+TEST(TestInplaceFunction, empty_state) {
+  InplaceFunction<void ()> function;
+  EXPECT_FALSE(function);
+  EXPECT_TRUE(function == nullptr);
+  EXPECT_TRUE(nullptr == function);
+  EXPECT_FALSE(function != nullptr);
+  EXPECT_THROW(function(), std::bad_function_call);
+
+  InplaceFunction<void ()> null_function = nullptr;
+  EXPECT_FALSE(null_function);
+}
+
+TEST(TestInplaceFunction, invoke_small_callable) {
+  int call_count = 0;
+  InplaceFunction<int (int)> function = [&call_count](int value) {
+      call_count++;
+      return value * 2;
+    };
+  ASSERT_TRUE(function);
+  EXPECT_NE(function, nullptr);
+  EXPECT_EQ(function(21), 42);
+  EXPECT_EQ(call_count, 1);
+}
+
+TEST(TestInplaceFunction, invoke_large_callable) {
+  // Larger than any reasonable inline capacity, forcing the heap fallback.
+  std::array<char, 4096> payload;
+  payload.fill('x');
+  InplaceFunction<char (size_t)> function = [payload](size_t index) {
+      return payload[index];
+    };
+  ASSERT_TRUE(function);
+  EXPECT_EQ(function(0), 'x');
+}
+
+TEST(TestInplaceFunction, copy_and_move) {
+  auto counter = std::make_shared<int>(0);
+  InplaceFunction<void ()> function = [counter]() {(*counter)++;};
+  EXPECT_EQ(counter.use_count(), 2);
+
+  InplaceFunction<void ()> copy = function;
+  EXPECT_EQ(counter.use_count(), 3);
+  copy();
+  EXPECT_EQ(*counter, 1);
+
+  InplaceFunction<void ()> moved = std::move(copy);
+  EXPECT_EQ(counter.use_count(), 3);
+  EXPECT_FALSE(copy);  // NOLINT(bugprone-use-after-move), moved-from is empty by contract
+  moved();
+  EXPECT_EQ(*counter, 2);
+
+  moved = nullptr;
+  EXPECT_FALSE(moved);
+  EXPECT_EQ(counter.use_count(), 2);
+}
+
+TEST(TestInplaceFunction, assignment_releases_previous_callable) {
+  auto first = std::make_shared<int>(0);
+  auto second = std::make_shared<int>(0);
+  InplaceFunction<void ()> function = [first]() {(*first)++;};
+  function = InplaceFunction<void ()>([second]() {(*second)++;});
+  EXPECT_EQ(first.use_count(), 1);
+  EXPECT_EQ(second.use_count(), 2);
+  function();
+  EXPECT_EQ(*first, 0);
+  EXPECT_EQ(*second, 1);
+}
+
+TEST(TestInplaceFunction, from_std_function_metafunction) {
+  static_assert(
+    std::is_same_v<
+      rclcpp::detail::InplaceFunctionFromStdFunction<std::function<int (double)>>::type,
+      InplaceFunction<int (double)>>,
+    "metafunction should map std::function to the same-signature InplaceFunction");
+
+  std::function<int (int)> std_function = [](int value) {return value + 1;};
+  InplaceFunction<int (int)> function = std_function;
+  EXPECT_EQ(function(1), 2);
+}
@@ -0,0 +1,61 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <unordered_set>
+
+#include "rclcpp/duration.hpp"
+#include "rclcpp/interned_qos.hpp"
+#include "rclcpp/qos.hpp"
+
+TEST(TestInternedQoS, equal_profiles_share_one_record) {
+  rclcpp::QoS profile = rclcpp::QoS(10)
+    .reliable()
+    .deadline(rclcpp::Duration(1, 0u));
+  rclcpp::InternedQoS first(profile);
+  rclcpp::InternedQoS second(rclcpp::QoS(10).reliable().deadline(rclcpp::Duration(1, 0u)));
+  rclcpp::InternedQoS other(rclcpp::QoS(10).best_effort());
+
+  EXPECT_EQ(first, second);
+  EXPECT_NE(first, other);
+  // Interned: equal profiles resolve to the same canonical record.
+  EXPECT_EQ(&first.qos(), &second.qos());
+  EXPECT_EQ(first.hash(), second.hash());
+  EXPECT_EQ(profile, first.qos());
+  EXPECT_EQ(profile.get_rmw_qos_profile().depth, first.get_rmw_qos_profile().depth);
+}
+
+TEST(TestInternedQoS, empty_profiles_compare_equal) {
+  rclcpp::InternedQoS empty;
+  rclcpp::InternedQoS also_empty;
+  rclcpp::InternedQoS interned(rclcpp::QoS(10));
+
+  EXPECT_TRUE(empty.empty());
+  EXPECT_FALSE(interned.empty());
+  EXPECT_EQ(empty, also_empty);
+  EXPECT_NE(empty, interned);
+  // Empty instances fall back to the rclcpp default profile.
+  EXPECT_EQ(rclcpp::QoS(10), empty.qos());
+}
+
+TEST(TestInternedQoS, usable_as_hash_key) {
+  std::unordered_set<rclcpp::InternedQoS> profiles;
+  profiles.insert(rclcpp::InternedQoS(rclcpp::QoS(1)));
+  profiles.insert(rclcpp::InternedQoS(rclcpp::QoS(1)));
+  profiles.insert(rclcpp::InternedQoS(rclcpp::QoS(2)));
+
+  EXPECT_EQ(2u, profiles.size());
+  EXPECT_EQ(1u, profiles.count(rclcpp::InternedQoS(rclcpp::QoS(1))));
+}
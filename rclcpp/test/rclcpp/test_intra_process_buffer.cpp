@@ -310,3 +310,128 @@ TEST(TestIntraProcessBuffer, available_capacity) {
   EXPECT_EQ(second_value, *popped_unique_msg);
   EXPECT_EQ(second_message_pointer, popped_message_pointer);
 }
+
+/*
+  Inline buffer stores small trivially copyable messages by value.
+  - only small trivially copyable types are eligible
+  - use_take_shared_method is false
+  - values round-trip through add_shared / add_unique and the consume methods
+ */
+TEST(TestIntraProcessBuffer, inline_buffer) {
+  using MessageT = char;
+  using Alloc = std::allocator<void>;
+  using Deleter = std::default_delete<MessageT>;
+  using InlineIntraProcessBufferT = rclcpp::experimental::buffers::InlineTypedIntraProcessBuffer<
+    MessageT, Alloc, Deleter>;
+
+  struct OversizedMessage
+  {
+    char payload[rclcpp::experimental::buffers::kInlineBufferMaxMessageSize + 1];
+  };
+  static_assert(
+    rclcpp::experimental::buffers::is_inline_buffer_eligible<MessageT>::value,
+    "small trivially copyable types must be eligible for inline storage");
+  static_assert(
+    !rclcpp::experimental::buffers::is_inline_buffer_eligible<OversizedMessage>::value,
+    "types above the size threshold must not be eligible for inline storage");
+
+  auto buffer_impl =
+    std::make_unique<rclcpp::experimental::buffers::RingBufferImplementation<MessageT>>(2);
+
+  InlineIntraProcessBufferT inline_buffer(std::move(buffer_impl));
+
+  EXPECT_EQ(false, inline_buffer.use_take_shared_method());
+  EXPECT_FALSE(inline_buffer.has_data());
+
+  auto original_shared_msg = std::make_shared<MessageT>('a');
+  inline_buffer.add_shared(original_shared_msg);
+  // The payload is copied into the slot, the input message is not retained.
+  EXPECT_EQ(1u, original_shared_msg.use_count());
+  EXPECT_TRUE(inline_buffer.has_data());
+
+  auto popped_unique_msg = inline_buffer.consume_unique();
+  EXPECT_EQ('a', *popped_unique_msg);
+  EXPECT_FALSE(inline_buffer.has_data());
+
+  auto original_unique_msg = std::make_unique<MessageT>('b');
+  inline_buffer.add_unique(std::move(original_unique_msg));
+
+  auto popped_shared_msg = inline_buffer.consume_shared();
+  EXPECT_EQ('b', *popped_shared_msg);
+  EXPECT_FALSE(inline_buffer.has_data());
+}
+
+// Not trivially copyable for the language (user-provided copy operations),
+// but byte-copyable in practice; stands in for bounded rosidl messages.
+struct RelocatableTestMessage
+{
+  int64_t value {0};
+
+  RelocatableTestMessage() = default;
+  RelocatableTestMessage(const RelocatableTestMessage & other)
+  : value(other.value)
+  {
+    copy_constructions++;
+  }
+  RelocatableTestMessage & operator=(const RelocatableTestMessage & other)
+  {
+    value = other.value;
+    copy_assignments++;
+    return *this;
+  }
+
+  static int copy_constructions;
+  static int copy_assignments;
+};
+int RelocatableTestMessage::copy_constructions = 0;
+int RelocatableTestMessage::copy_assignments = 0;
+
+namespace rclcpp
+{
+template<>
+struct is_trivially_relocatable<RelocatableTestMessage>
+  : std::true_type {};
+}  // namespace rclcpp
+
+/*
+  Messages marked trivially relocatable are copied bytewise.
+  - the trait specialization overrides the std::is_trivially_copyable default
+  - relocatable types qualify for inline slot storage
+  - buffer copies go through memcpy, never the user copy operations
+ */
+TEST(TestIntraProcessBuffer, trivially_relocatable_buffer) {
+  using MessageT = RelocatableTestMessage;
+  using Alloc = std::allocator<void>;
+  using Deleter = std::default_delete<MessageT>;
+  using UniqueMessageT = std::unique_ptr<MessageT, Deleter>;
+  using UniqueIntraProcessBufferT = rclcpp::experimental::buffers::TypedIntraProcessBuffer<
+    MessageT, Alloc, Deleter, UniqueMessageT>;
+
+  static_assert(
+    !std::is_trivially_copyable<MessageT>::value,
+    "the test type must not be trivially copyable for the language");
+  static_assert(
+    rclcpp::is_trivially_relocatable<MessageT>::value,
+    "the trait specialization must mark the test type relocatable");
+  static_assert(
+    rclcpp::experimental::buffers::is_inline_buffer_eligible<MessageT>::value,
+    "relocatable types must be eligible for inline slot storage");
+
+  auto buffer_impl =
+    std::make_unique<rclcpp::experimental::buffers::RingBufferImplementation<UniqueMessageT>>(2);
+  UniqueIntraProcessBufferT buffer(std::move(buffer_impl));
+
+  auto original_shared_msg = std::make_shared<MessageT>();
+  original_shared_msg->value = 42;
+
+  MessageT::copy_constructions = 0;
+  MessageT::copy_assignments = 0;
+
+  // Shared-to-unique promotion clones the message: bytewise, not per field.
+  buffer.add_shared(original_shared_msg);
+  auto popped_unique_msg = buffer.consume_unique();
+
+  EXPECT_EQ(42, popped_unique_msg->value);
+  EXPECT_EQ(0, MessageT::copy_constructions);
+  EXPECT_EQ(0, MessageT::copy_assignments);
+}
@@ -23,8 +23,10 @@
 #define RCLCPP_BUILDING_LIBRARY 1
 #include "rclcpp/allocator/allocator_common.hpp"
 #include "rclcpp/context.hpp"
+#include "rclcpp/introspection.hpp"
 #include "rclcpp/macros.hpp"
 #include "rclcpp/qos.hpp"
+#include "rclcpp/topic_name.hpp"
 #include "rmw/types.h"
 #include "rmw/qos_profiles.h"
 
@@ -66,6 +68,11 @@ public:
     return topic_name.c_str();
   }
 
+  rclcpp::TopicName get_interned_topic_name() const
+  {
+    return rclcpp::TopicName(topic_name);
+  }
+
   void set_intra_process_manager(
     uint64_t intra_process_publisher_id,
     IntraProcessManagerSharedPtr ipm)
@@ -231,12 +238,25 @@ public:
     return topic_name.c_str();
   }
 
+  rclcpp::TopicName
+  get_interned_topic_name() const
+  {
+    return rclcpp::TopicName(topic_name);
+  }
+
   virtual
   size_t
   available_capacity() const = 0;
 
+  std::shared_ptr<rclcpp::introspection::EntityCounters>
+  get_introspection_counters() const
+  {
+    return introspection_counters;
+  }
+
   rclcpp::QoS qos_profile;
   std::string topic_name;
+  std::shared_ptr<rclcpp::introspection::EntityCounters> introspection_counters;
 };
 
 template<
@@ -820,3 +840,133 @@ TEST(TestIntraProcessManager, lowest_available_capacity) {
   c1 = ipm->lowest_available_capacity(p1_id);
   ASSERT_EQ(history_depth - 1u, c1);
 }
+
+/*
+   This tests the method "get_topology_snapshot":
+   - Creates 1 publisher with no subscriptions; the snapshot lists it as
+     unmatched with no available capacity.
+   - Add 2 subscribers; the snapshot lists both, with the publisher matched
+     to them and the buffer capacity from the QoS depth.
+   - Publish two messages without receiving them; occupancy rises to 2 on
+     both buffers and the publisher's lowest available capacity drops by 2.
+   - One subscriber receives one message; its occupancy drops back to 1
+     while the other stays at 2.
+   - Attach a counter block with recorded overwrites to one subscription;
+     the snapshot reports them.
+ */
+TEST(TestIntraProcessManager, get_topology_snapshot) {
+  using IntraProcessManagerT = rclcpp::experimental::IntraProcessManager;
+  using MessageT = rcl_interfaces::msg::Log;
+  using PublisherT = rclcpp::mock::Publisher<MessageT>;
+  using SubscriptionIntraProcessT = rclcpp::experimental::mock::SubscriptionIntraProcess<MessageT>;
+
+  constexpr auto history_depth = 10u;
+
+  auto ipm = std::make_shared<IntraProcessManagerT>();
+
+  auto p1 = std::make_shared<PublisherT>(rclcpp::QoS(history_depth).best_effort());
+  auto p1_id = ipm->add_publisher(p1);
+  p1->set_intra_process_manager(p1_id, ipm);
+
+  auto snapshot = ipm->get_topology_snapshot();
+  ASSERT_EQ(1u, snapshot.publishers.size());
+  ASSERT_EQ(0u, snapshot.subscriptions.size());
+  EXPECT_EQ(p1_id, snapshot.publishers[0].publisher_id);
+  EXPECT_EQ("topic", snapshot.publishers[0].topic_name);
+  EXPECT_EQ(0u, snapshot.publishers[0].matched_subscription_count);
+  EXPECT_EQ(0u, snapshot.publishers[0].lowest_available_capacity);
+
+  auto s1 = std::make_shared<SubscriptionIntraProcessT>(rclcpp::QoS(history_depth).best_effort());
+  auto s2 = std::make_shared<SubscriptionIntraProcessT>(rclcpp::QoS(history_depth).best_effort());
+  auto s1_id = ipm->add_subscription(s1);
+  ipm->add_subscription(s2);
+
+  snapshot = ipm->get_topology_snapshot();
+  ASSERT_EQ(1u, snapshot.publishers.size());
+  ASSERT_EQ(2u, snapshot.subscriptions.size());
+  EXPECT_EQ(2u, snapshot.publishers[0].matched_subscription_count);
+  EXPECT_EQ(history_depth, snapshot.publishers[0].lowest_available_capacity);
+  for (const auto & sub : snapshot.subscriptions) {
+    EXPECT_EQ("topic", sub.topic_name);
+    EXPECT_EQ(rclcpp::IntraProcessBufferType::UniquePtr, sub.buffer_type);
+    EXPECT_EQ(history_depth, sub.capacity);
+    EXPECT_EQ(0u, sub.occupancy);
+    EXPECT_EQ(0u, sub.overwrites);
+  }
+
+  auto unique_msg = std::make_unique<MessageT>();
+  p1->publish(std::move(unique_msg));
+  unique_msg = std::make_unique<MessageT>();
+  p1->publish(std::move(unique_msg));
+
+  snapshot = ipm->get_topology_snapshot();
+  EXPECT_EQ(history_depth - 2u, snapshot.publishers[0].lowest_available_capacity);
+  for (const auto & sub : snapshot.subscriptions) {
+    EXPECT_EQ(2u, sub.occupancy);
+  }
+
+  s1->pop();
+
+  snapshot = ipm->get_topology_snapshot();
+  size_t drained_occupancy = 0u;
+  size_t backed_up_occupancy = 0u;
+  for (const auto & sub : snapshot.subscriptions) {
+    if (sub.subscription_id == s1_id) {
+      drained_occupancy = sub.occupancy;
+    } else {
+      backed_up_occupancy = sub.occupancy;
+    }
+  }
+  EXPECT_EQ(1u, drained_occupancy);
+  EXPECT_EQ(2u, backed_up_occupancy);
+  EXPECT_EQ(history_depth - 2u, snapshot.publishers[0].lowest_available_capacity);
+
+  s1->introspection_counters = std::make_shared<rclcpp::introspection::EntityCounters>();
+  s1->introspection_counters->buffer_overwrites.store(3u);
+
+  snapshot = ipm->get_topology_snapshot();
+  for (const auto & sub : snapshot.subscriptions) {
+    EXPECT_EQ(sub.subscription_id == s1_id ? 3u : 0u, sub.overwrites);
+  }
+}
+
+/*
+   This tests the latched-sample cache for transient local publishers:
+   - Create a transient local publisher with depth 2 and publish 3 messages
+     with no subscription present.
+   - Add a transient local subscription: the last 2 samples are expected to be
+     replayed into its buffer.
+   - Add a volatile subscription on another transient local publisher with no
+     published samples: nothing is expected to be replayed.
+   - Remove the publisher, add another transient local subscription: the
+     retained samples are gone with the publisher.
+ */
+TEST(TestIntraProcessManager, transient_local_replay) {
+  using IntraProcessManagerT = rclcpp::experimental::IntraProcessManager;
+  using MessageT = rcl_interfaces::msg::Log;
+  using PublisherT = rclcpp::mock::Publisher<MessageT>;
+  using SubscriptionIntraProcessT = rclcpp::experimental::mock::SubscriptionIntraProcess<MessageT>;
+
+  auto ipm = std::make_shared<IntraProcessManagerT>();
+
+  auto p1 = std::make_shared<PublisherT>(rclcpp::QoS(2).transient_local());
+  auto p1_id = ipm->add_publisher(p1);
+  p1->set_intra_process_manager(p1_id, ipm);
+
+  p1->publish(std::make_unique<MessageT>());
+  p1->publish(std::make_unique<MessageT>());
+  p1->publish(std::make_unique<MessageT>());
+
+  auto s1 = std::make_shared<SubscriptionIntraProcessT>(rclcpp::QoS(10).transient_local());
+  ipm->add_subscription(s1);
+  ASSERT_EQ(2u, s1->buffer->size());
+
+  auto s2 = std::make_shared<SubscriptionIntraProcessT>(rclcpp::QoS(10));
+  ipm->add_subscription(s2);
+  ASSERT_EQ(0u, s2->buffer->size());
+
+  ipm->remove_publisher(p1_id);
+  auto s3 = std::make_shared<SubscriptionIntraProcessT>(rclcpp::QoS(10).transient_local());
+  ipm->add_subscription(s3);
+  ASSERT_EQ(0u, s3->buffer->size());
+}
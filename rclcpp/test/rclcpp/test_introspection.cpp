@@ -0,0 +1,222 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "rclcpp/introspection.hpp"
+#include "rclcpp/rclcpp.hpp"
+
+#include "test_msgs/msg/empty.hpp"
+#include "test_msgs/srv/empty.hpp"
+
+using namespace std::chrono_literals;
+
+namespace introspection = rclcpp::introspection;
+
+namespace
+{
+
+/// Find the snapshot entry for the given counter block.
+const introspection::EntitySnapshot *
+find_entry(
+  const std::vector<introspection::EntitySnapshot> & entries,
+  const std::shared_ptr<introspection::EntityCounters> & counters)
+{
+  auto it = std::find_if(
+    entries.begin(), entries.end(),
+    [&counters](const introspection::EntitySnapshot & entry) {
+      return entry.id == static_cast<const void *>(counters.get());
+    });
+  return it != entries.end() ? &(*it) : nullptr;
+}
+
+}  // namespace
+
+class TestIntrospection : public ::testing::Test
+{
+public:
+  void SetUp()
+  {
+    rclcpp::init(0, nullptr);
+  }
+
+  void TearDown()
+  {
+    rclcpp::shutdown();
+  }
+};
+
+TEST_F(TestIntrospection, register_and_snapshot)
+{
+  auto counters = introspection::register_entity(
+    introspection::EntityKind::Subscription, "/my_topic");
+  ASSERT_NE(nullptr, counters);
+  counters->messages.fetch_add(3);
+  counters->empty_takes.fetch_add(1);
+
+  auto entries = introspection::snapshot();
+  const auto * entry = find_entry(entries, counters);
+  ASSERT_NE(nullptr, entry);
+  EXPECT_EQ(introspection::EntityKind::Subscription, entry->kind);
+  EXPECT_EQ("/my_topic", entry->name);
+  EXPECT_EQ(3u, entry->messages);
+  EXPECT_EQ(1u, entry->empty_takes);
+  EXPECT_EQ(0u, entry->buffer_overwrites);
+
+  // Destroyed entities disappear from subsequent snapshots.
+  const void * id = entry->id;
+  counters.reset();
+  entries = introspection::snapshot();
+  for (const auto & remaining : entries) {
+    EXPECT_NE(id, remaining.id);
+  }
+}
+
+TEST_F(TestIntrospection, latency_distribution_summary)
+{
+  auto counters = introspection::register_entity(
+    introspection::EntityKind::Subscription, "/latency_topic");
+
+  // No samples yet: the snapshot reports an all-zero summary.
+  auto entries = introspection::snapshot();
+  const auto * entry = find_entry(entries, counters);
+  ASSERT_NE(nullptr, entry);
+  EXPECT_EQ(0u, entry->latency_samples);
+  EXPECT_EQ(0u, entry->latency_sum_ns);
+  EXPECT_EQ(0u, entry->latency_min_ns);
+  EXPECT_EQ(0u, entry->latency_max_ns);
+
+  introspection::record_latency(*counters, 5u);
+  introspection::record_latency(*counters, 2u);
+  introspection::record_latency(*counters, 9u);
+
+  entries = introspection::snapshot();
+  entry = find_entry(entries, counters);
+  ASSERT_NE(nullptr, entry);
+  EXPECT_EQ(3u, entry->latency_samples);
+  EXPECT_EQ(16u, entry->latency_sum_ns);
+  EXPECT_EQ(2u, entry->latency_min_ns);
+  EXPECT_EQ(9u, entry->latency_max_ns);
+}
+
+TEST_F(TestIntrospection, message_info_pipeline_latency)
+{
+  rclcpp::MessageInfo message_info;
+  rmw_message_info_t & rmw_info = message_info.get_rmw_message_info();
+  rmw_info.source_timestamp = 0;
+  rmw_info.received_timestamp = 0;
+
+  // Without timestamps nothing can be computed.
+  EXPECT_EQ(0, message_info.get_origin_timestamp());
+  EXPECT_EQ(0, message_info.get_pipeline_latency());
+
+  // The origin defaults to the source timestamp.
+  rmw_info.source_timestamp = 100;
+  rmw_info.received_timestamp = 130;
+  EXPECT_EQ(100, message_info.get_origin_timestamp());
+  EXPECT_EQ(30, message_info.get_pipeline_latency());
+
+  // An explicit origin, e.g. preserved across a relay hop, takes precedence.
+  message_info.set_origin_timestamp(40);
+  EXPECT_EQ(40, message_info.get_origin_timestamp());
+  EXPECT_EQ(90, message_info.get_pipeline_latency());
+  message_info.set_origin_timestamp(0);
+  EXPECT_EQ(100, message_info.get_origin_timestamp());
+}
+
+TEST_F(TestIntrospection, entities_register_on_construction)
+{
+  auto node = std::make_shared<rclcpp::Node>("introspection_test_node");
+  auto publisher = node->create_publisher<test_msgs::msg::Empty>("topic", 10);
+  auto subscription = node->create_subscription<test_msgs::msg::Empty>(
+    "topic", 10, [](test_msgs::msg::Empty::ConstSharedPtr) {});
+  auto service = node->create_service<test_msgs::srv::Empty>(
+    "service",
+    [](const std::shared_ptr<test_msgs::srv::Empty::Request>,
+    std::shared_ptr<test_msgs::srv::Empty::Response>) {});
+  auto timer = node->create_wall_timer(1s, []() {});
+
+  ASSERT_NE(nullptr, publisher->get_introspection_counters());
+  ASSERT_NE(nullptr, subscription->get_introspection_counters());
+  ASSERT_NE(nullptr, service->get_introspection_counters());
+  ASSERT_NE(nullptr, timer->get_introspection_counters());
+
+  auto entries = introspection::snapshot();
+  const auto * pub_entry = find_entry(entries, publisher->get_introspection_counters());
+  ASSERT_NE(nullptr, pub_entry);
+  EXPECT_EQ(introspection::EntityKind::Publisher, pub_entry->kind);
+  EXPECT_EQ(publisher->get_topic_name(), pub_entry->name);
+  const auto * sub_entry = find_entry(entries, subscription->get_introspection_counters());
+  ASSERT_NE(nullptr, sub_entry);
+  EXPECT_EQ(introspection::EntityKind::Subscription, sub_entry->kind);
+  const auto * srv_entry = find_entry(entries, service->get_introspection_counters());
+  ASSERT_NE(nullptr, srv_entry);
+  EXPECT_EQ(introspection::EntityKind::Service, srv_entry->kind);
+  const auto * timer_entry = find_entry(entries, timer->get_introspection_counters());
+  ASSERT_NE(nullptr, timer_entry);
+  EXPECT_EQ(introspection::EntityKind::Timer, timer_entry->kind);
+}
+
+TEST_F(TestIntrospection, intra_process_counting)
+{
+  auto node = std::make_shared<rclcpp::Node>(
+    "introspection_intra_node", rclcpp::NodeOptions().use_intra_process_comms(true));
+  auto publisher = node->create_publisher<test_msgs::msg::Empty>("topic", 2);
+  size_t received = 0;
+  auto subscription = node->create_subscription<test_msgs::msg::Empty>(
+    "topic", 2, [&received](test_msgs::msg::Empty::ConstSharedPtr) {received++;});
+
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(node);
+
+  // Publish more than the buffer depth without spinning, so the ring buffer
+  // overwrites unread messages, then drain what is left.
+  for (size_t i = 0; i < 5; i++) {
+    publisher->publish(std::make_unique<test_msgs::msg::Empty>());
+  }
+  auto start = std::chrono::steady_clock::now();
+  while (received < 2 && (std::chrono::steady_clock::now() - start) < 5s) {
+    executor.spin_some();
+  }
+
+  auto pub_counters = publisher->get_introspection_counters();
+  EXPECT_EQ(5u, pub_counters->messages.load());
+
+  auto sub_counters = subscription->get_introspection_counters();
+  EXPECT_EQ(3u, sub_counters->buffer_overwrites.load());
+  EXPECT_EQ(2u, sub_counters->messages.load());
+  EXPECT_EQ(2u, sub_counters->callbacks.load());
+}
+
+TEST_F(TestIntrospection, timer_callback_counting)
+{
+  auto node = std::make_shared<rclcpp::Node>("introspection_timer_node");
+  size_t calls = 0;
+  auto timer = node->create_wall_timer(1ms, [&calls]() {calls++;});
+
+  rclcpp::executors::SingleThreadedExecutor executor;
+  executor.add_node(node);
+  auto start = std::chrono::steady_clock::now();
+  while (calls < 3 && (std::chrono::steady_clock::now() - start) < 5s) {
+    executor.spin_some();
+  }
+
+  auto counters = timer->get_introspection_counters();
+  EXPECT_GE(counters->callbacks.load(), 3u);
+}
@@ -0,0 +1,104 @@
+// Copyright 2024 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "rclcpp/lazy_message.hpp"
+#include "rclcpp/serialization.hpp"
+#include "rclcpp/serialized_message.hpp"
+
+#include "test_msgs/msg/strings.hpp"
+
+namespace
+{
+
+/// Build a little-endian CDR buffer starting with std_msgs/Header fields.
+std::shared_ptr<rclcpp::SerializedMessage> make_header_cdr_buffer(
+  int32_t sec, uint32_t nanosec, const std::string & frame_id)
+{
+  std::vector<uint8_t> bytes = {0x00, 0x01, 0x00, 0x00};  // encapsulation, little-endian
+  auto append_uint32 = [&bytes](uint32_t value) {
+      bytes.push_back(static_cast<uint8_t>(value & 0xff));
+      bytes.push_back(static_cast<uint8_t>((value >> 8) & 0xff));
+      bytes.push_back(static_cast<uint8_t>((value >> 16) & 0xff));
+      bytes.push_back(static_cast<uint8_t>((value >> 24) & 0xff));
+    };
+  append_uint32(static_cast<uint32_t>(sec));
+  append_uint32(nanosec);
+  append_uint32(static_cast<uint32_t>(frame_id.size() + 1u));  // length includes terminator
+  for (char c : frame_id) {
+    bytes.push_back(static_cast<uint8_t>(c));
+  }
+  bytes.push_back(0u);
+
+  auto serialized_message = std::make_shared<rclcpp::SerializedMessage>(bytes.size());
+  auto & rcl_message = serialized_message->get_rcl_serialized_message();
+  std::memcpy(rcl_message.buffer, bytes.data(), bytes.size());
+  rcl_message.buffer_length = bytes.size();
+  return serialized_message;
+}
+
+}  // namespace
+
+TEST(TestLazyMessage, deserializes_on_first_access) {
+  test_msgs::msg::Strings message;
+  message.string_value = "Hello World";
+
+  rclcpp::Serialization<test_msgs::msg::Strings> serializer;
+  auto serialized_message = std::make_shared<rclcpp::SerializedMessage>();
+  serializer.serialize_message(&message, serialized_message.get());
+
+  rclcpp::LazyMessage<test_msgs::msg::Strings> lazy_message(serialized_message);
+  EXPECT_FALSE(lazy_message.is_deserialized());
+  EXPECT_GT(lazy_message.serialized_message().size(), 0u);
+
+  EXPECT_EQ(lazy_message->string_value, "Hello World");
+  EXPECT_TRUE(lazy_message.is_deserialized());
+
+  // The deserialized message is cached, repeated accesses return the same one.
+  EXPECT_EQ(lazy_message.get(), lazy_message.get());
+  EXPECT_EQ((*lazy_message).string_value, "Hello World");
+}
+
+TEST(TestLazyMessage, header_accessors_read_cdr_directly) {
+  auto serialized_message = make_header_cdr_buffer(42, 100u, "base_link");
+
+  // The message type is irrelevant for the header accessors, nothing is
+  // deserialized.
+  rclcpp::LazyMessage<test_msgs::msg::Strings> lazy_message(serialized_message);
+
+  auto stamp = lazy_message.stamp();
+  ASSERT_TRUE(stamp.has_value());
+  EXPECT_EQ(stamp->nanoseconds(), 42 * 1000000000LL + 100);
+
+  auto frame_id = lazy_message.frame_id();
+  ASSERT_TRUE(frame_id.has_value());
+  EXPECT_EQ(*frame_id, "base_link");
+
+  EXPECT_FALSE(lazy_message.is_deserialized());
+}
+
+TEST(TestLazyMessage, header_accessors_handle_short_buffers) {
+  auto serialized_message = std::make_shared<rclcpp::SerializedMessage>(4);
+  serialized_message->get_rcl_serialized_message().buffer_length = 4u;
+
+  rclcpp::LazyMessage<test_msgs::msg::Strings> lazy_message(serialized_message);
+  EXPECT_FALSE(lazy_message.stamp().has_value());
+  EXPECT_FALSE(lazy_message.frame_id().has_value());
+}
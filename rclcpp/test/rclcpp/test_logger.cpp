@@ -38,6 +38,23 @@ TEST(TestLogger, hierarchy) {
   EXPECT_STREQ("test_logger.child.grandchild", subsublogger.get_name());
 }
 
+TEST(TestLogger, cached_children) {
+  rclcpp::Logger logger = rclcpp::get_logger("test_logger_cache");
+  rclcpp::Logger first = logger.get_child("io");
+  rclcpp::Logger second = logger.get_child("io");
+  // Cached: both handles share the same interned name storage.
+  EXPECT_EQ(
+    static_cast<const void *>(first.get_name()),
+    static_cast<const void *>(second.get_name()));
+  EXPECT_STREQ("test_logger_cache.io", second.get_name());
+  // Copies of the parent share the cache.
+  rclcpp::Logger copy = logger;
+  EXPECT_EQ(
+    static_cast<const void *>(first.get_name()),
+    static_cast<const void *>(copy.get_child("io").get_name()));
+  EXPECT_STREQ("test_logger_cache.other", logger.get_child("other").get_name());
+}
+
 TEST(TestLogger, get_node_logger) {
   rclcpp::init(0, nullptr);
   auto node = std::make_shared<rclcpp::Node>("my_node", "/ns");
@@ -20,6 +20,7 @@
 #include <vector>
 
 #include "rclcpp/clock.hpp"
+#include "rclcpp/detail/log_site.hpp"
 #include "rclcpp/logger.hpp"
 #include "rclcpp/logging.hpp"
 #include "rcutils/logging.h"
@@ -259,3 +260,44 @@ TEST_F(TestLoggingMacros, test_log_from_node) {
   EXPECT_TRUE(log_function_const(logger));
   EXPECT_TRUE(log_function_const_ref(logger));
 }
+
+TEST(TestLogSite, site_gating) {
+  ASSERT_EQ(RCUTILS_RET_OK, rcutils_logging_initialize());
+  auto logger_a = rclcpp::get_logger("test_log_site_logger_a");
+  auto logger_b = rclcpp::get_logger("test_log_site_logger_b");
+
+  // First use registers the site and caches the gate for that logger.
+  rclcpp::detail::LogSite site;
+  EXPECT_TRUE(
+    rclcpp::detail::log_site_is_enabled(
+      site, logger_a.get_name(), RCUTILS_LOG_SEVERITY_INFO));
+
+  // Severity changes through the Logger API refresh the cached gate.
+  logger_a.set_level(rclcpp::Logger::Level::Error);
+  EXPECT_FALSE(
+    rclcpp::detail::log_site_is_enabled(
+      site, logger_a.get_name(), RCUTILS_LOG_SEVERITY_INFO));
+  logger_a.set_level(rclcpp::Logger::Level::Unset);
+  EXPECT_TRUE(
+    rclcpp::detail::log_site_is_enabled(
+      site, logger_a.get_name(), RCUTILS_LOG_SEVERITY_INFO));
+
+  // The gate is keyed by name, not by the pointer the site first saw, so
+  // another Logger instance with the same name still hits the cache.
+  auto logger_a_again = rclcpp::get_logger("test_log_site_logger_a");
+  logger_a_again.set_level(rclcpp::Logger::Level::Error);
+  EXPECT_FALSE(
+    rclcpp::detail::log_site_is_enabled(
+      site, logger_a_again.get_name(), RCUTILS_LOG_SEVERITY_INFO));
+  logger_a_again.set_level(rclcpp::Logger::Level::Unset);
+
+  // A site reached with a different logger cannot trust its cache and
+  // defers to the severity check inside the logging call.
+  logger_b.set_level(rclcpp::Logger::Level::Error);
+  EXPECT_TRUE(
+    rclcpp::detail::log_site_is_enabled(
+      site, logger_b.get_name(), RCUTILS_LOG_SEVERITY_INFO));
+  logger_b.set_level(rclcpp::Logger::Level::Unset);
+
+  EXPECT_EQ(RCUTILS_RET_OK, rcutils_logging_shutdown());
+}
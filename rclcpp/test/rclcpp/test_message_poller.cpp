@@ -0,0 +1,130 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <memory>
+#include <string>
+
+#include "rclcpp/message_poller.hpp"
+#include "rclcpp/node.hpp"
+
+#include "test_msgs/msg/strings.hpp"
+#include "test_msgs/message_fixtures.hpp"
+
+using namespace std::chrono_literals;
+
+TEST(TestMessagePoller, poll_repeatedly) {
+  rclcpp::init(0, nullptr);
+
+  auto node = std::make_shared<rclcpp::Node>("message_poller_node");
+
+  using MsgT = test_msgs::msg::Strings;
+  auto pub = node->create_publisher<MsgT>("message_poller_topic", 10);
+  rclcpp::MessagePoller<MsgT> poller(node, "message_poller_topic");
+
+  MsgT out;
+  auto received = 0u;
+  auto wait = std::async(
+    [&]() {
+      while (received < 3u) {
+        if (!poller.poll(out, 5s)) {
+          break;
+        }
+        EXPECT_EQ(out, *get_messages_strings()[0]);
+        ++received;
+      }
+    });
+
+  for (auto i = 0u; i < 10 && received < 3u; ++i) {
+    pub->publish(*get_messages_strings()[0]);
+    std::this_thread::sleep_for(100ms);
+  }
+
+  ASSERT_NO_THROW(wait.get());
+  EXPECT_EQ(received, 3u);
+
+  rclcpp::shutdown();
+}
+
+TEST(TestMessagePoller, poll_times_out) {
+  rclcpp::init(0, nullptr);
+
+  auto node = std::make_shared<rclcpp::Node>("message_poller_node2");
+
+  using MsgT = test_msgs::msg::Strings;
+  rclcpp::MessagePoller<MsgT> poller(node, "message_poller_topic");
+
+  MsgT out;
+  EXPECT_FALSE(poller.poll(out, 100ms));
+
+  rclcpp::shutdown();
+}
+
+TEST(TestMessagePoller, poll_unblocked_by_shutdown) {
+  rclcpp::init(0, nullptr);
+
+  auto node = std::make_shared<rclcpp::Node>("message_poller_node3");
+
+  using MsgT = test_msgs::msg::Strings;
+  auto poller = std::make_shared<rclcpp::MessagePoller<MsgT>>(node, "message_poller_topic");
+
+  MsgT out;
+  auto returned = false;
+  auto wait = std::async(
+    [&]() {
+      auto ret = poller->poll(out /*, -1 */);
+      EXPECT_FALSE(ret);
+      returned = true;
+    });
+
+  rclcpp::shutdown();
+
+  ASSERT_NO_THROW(wait.get());
+  ASSERT_TRUE(returned);
+}
+
+TEST(TestMessagePoller, take_batch_drains_queue) {
+  rclcpp::init(0, nullptr);
+
+  auto node = std::make_shared<rclcpp::Node>("message_poller_node4");
+
+  using MsgT = test_msgs::msg::Strings;
+  auto pub = node->create_publisher<MsgT>("message_poller_topic", 10);
+  rclcpp::MessagePoller<MsgT> poller(node, "message_poller_topic");
+
+  std::array<MsgT, 5> batch;
+  // Nothing queued yet.
+  EXPECT_EQ(0u, poller.take_batch(batch.data(), batch.size()));
+
+  // Wait for the first message, then ensure the rest are queued behind it.
+  MsgT out;
+  pub->publish(*get_messages_strings()[0]);
+  ASSERT_TRUE(poller.poll(out, 5s));
+  for (auto i = 0u; i < 3u; ++i) {
+    pub->publish(*get_messages_strings()[0]);
+  }
+  auto taken = 0u;
+  for (auto i = 0u; i < 50 && taken < 3u; ++i) {
+    taken += poller.take_batch(batch.data() + taken, batch.size() - taken);
+    std::this_thread::sleep_for(100ms);
+  }
+  EXPECT_EQ(3u, taken);
+  for (auto i = 0u; i < taken; ++i) {
+    EXPECT_EQ(batch[i], *get_messages_strings()[0]);
+  }
+
+  rclcpp::shutdown();
+}
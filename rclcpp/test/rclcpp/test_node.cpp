@@ -3294,6 +3294,30 @@ TEST_F(TestNode, callback_groups) {
   EXPECT_EQ(2u + num_callback_groups_in_basic_node, num_callback_groups2);
 }
 
+TEST_F(TestNode, callback_group_entity_membership) {
+  auto node = std::make_shared<rclcpp::Node>("node", "ns");
+  auto group = node->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+  const size_t base_size = group->size();
+  const size_t base_version = group->entities_version();
+
+  auto timer = node->create_wall_timer(std::chrono::seconds(60), []() {}, group);
+  EXPECT_EQ(base_size + 1u, group->size());
+  EXPECT_NE(base_version, group->entities_version());
+
+  auto found = group->find_timer_ptrs_if(
+    [&timer](const rclcpp::TimerBase::SharedPtr & t) {return t == timer;});
+  EXPECT_EQ(timer, found);
+
+  // destroying an entity unlinks it from the group immediately
+  const size_t version_before_reset = group->entities_version();
+  timer.reset();
+  EXPECT_EQ(base_size, group->size());
+  EXPECT_NE(version_before_reset, group->entities_version());
+  found = group->find_timer_ptrs_if(
+    [](const rclcpp::TimerBase::SharedPtr &) {return true;});
+  EXPECT_EQ(nullptr, found);
+}
+
 // This is tested more thoroughly in node_interfaces/test_node_graph
 TEST_F(TestNode, get_entity_names) {
   auto node = std::make_shared<rclcpp::Node>("node", "ns");
@@ -3470,3 +3494,72 @@ TEST_F(TestNode, get_parameter_with_node_allow_undeclared) {
     EXPECT_EQ(rclcpp::ParameterValue{}, param.get_parameter_value());
   }
 }
+
+TEST_F(TestNode, lazy_interface_construction) {
+  rclcpp::NodeOptions no;
+  no.lazy_parameters(true);
+  no.lazy_time_source(true);
+  no.parameter_overrides({rclcpp::Parameter("lazy_param", 7)});
+  auto node = std::make_shared<rclcpp::Node>("node", "ns", no);
+
+  // First parameter access materializes the parameters interface and the
+  // overrides take effect as usual.
+  auto param = node->declare_parameter("lazy_param", 0);
+  EXPECT_EQ(7, param);
+  EXPECT_TRUE(node->has_parameter("lazy_param"));
+  EXPECT_NE(nullptr, node->get_node_parameters_interface());
+
+  // First clock access materializes the time source.
+  auto clock = node->get_clock();
+  ASSERT_NE(nullptr, clock);
+  EXPECT_NE(0, node->now().nanoseconds());
+  EXPECT_NE(nullptr, node->get_node_time_source_interface());
+
+  // Sub-nodes share the materialized interfaces.
+  auto subnode = node->create_sub_node("sub");
+  EXPECT_EQ(
+    node->get_node_parameters_interface().get(),
+    subnode->get_node_parameters_interface().get());
+}
+
+TEST_F(TestNode, create_entities_coalesces_notify_triggers) {
+  auto node = std::make_shared<rclcpp::Node>("node", "ns");
+  auto guard_condition = node->get_node_base_interface()->get_shared_notify_guard_condition();
+  ASSERT_NE(nullptr, guard_condition);
+  rclcpp::WaitSet wait_set;
+  wait_set.add_guard_condition(guard_condition);
+  constexpr std::chrono::nanoseconds zero_timeout(0);
+  // Drain any triggers left over from node construction.
+  while (rclcpp::WaitResultKind::Ready == wait_set.wait(zero_timeout).kind()) {
+  }
+
+  EXPECT_THROW(node->create_entities(nullptr), std::invalid_argument);
+  EXPECT_THROW(node->destroy_entities(nullptr), std::invalid_argument);
+
+  auto callback = [](test_msgs::msg::Empty::ConstSharedPtr) {};
+  std::vector<rclcpp::SubscriptionBase::SharedPtr> subscriptions;
+  node->create_entities(
+    [&]() {
+      for (size_t i = 0u; i < 5u; ++i) {
+        subscriptions.push_back(
+          node->create_subscription<test_msgs::msg::Empty>(
+            "topic_" + std::to_string(i), 10, callback));
+      }
+      // Nested batches are allowed; only the outermost end commits.
+      node->create_entities(
+        [&]() {
+          subscriptions.push_back(
+            node->create_subscription<test_msgs::msg::Empty>("topic_nested", 10, callback));
+        });
+      // While the transaction is open no trigger is observable.
+      EXPECT_EQ(rclcpp::WaitResultKind::Timeout, wait_set.wait(zero_timeout).kind());
+    });
+  // Exactly one coalesced trigger fires at commit.
+  EXPECT_EQ(rclcpp::WaitResultKind::Ready, wait_set.wait(zero_timeout).kind());
+  EXPECT_EQ(rclcpp::WaitResultKind::Timeout, wait_set.wait(zero_timeout).kind());
+
+  node->destroy_entities(
+    [&]() {
+      subscriptions.clear();
+    });
+}
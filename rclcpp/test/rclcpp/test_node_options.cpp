@@ -15,6 +15,7 @@
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <memory_resource>
 #include <string>
 #include <vector>
 
@@ -108,6 +109,49 @@ TEST(TestNodeOptions, bad_ros_args) {
     rclcpp::exceptions::UnknownROSArgsError);
 }
 
+TEST(TestNodeOptions, shared_parse_results) {
+  rcl_allocator_t allocator = rcl_get_default_allocator();
+  std::vector<std::string> arguments =
+  {"--ros-args", "-r", "__node:=shared_node", "-r", "__ns:=/shared_ns"};
+
+  // Two options instances with the same argument vector; the second one is
+  // served from the process-wide parse cache and must behave identically.
+  auto first_options = rclcpp::NodeOptions(allocator).arguments(arguments);
+  ASSERT_TRUE(first_options.get_rcl_node_options() != nullptr);
+
+  auto second_options = rclcpp::NodeOptions(allocator).arguments(arguments);
+  const rcl_node_options_t * rcl_options = second_options.get_rcl_node_options();
+  ASSERT_TRUE(rcl_options != nullptr);
+  ASSERT_EQ(0, rcl_arguments_get_count_unparsed(&rcl_options->arguments));
+  ASSERT_EQ(0, rcl_arguments_get_count_unparsed_ros(&rcl_options->arguments));
+
+  char * node_name = nullptr;
+  EXPECT_EQ(
+    RCL_RET_OK, rcl_remap_node_name(
+      &rcl_options->arguments, nullptr, "my_node", allocator, &node_name));
+  ASSERT_TRUE(node_name != nullptr);
+  EXPECT_STREQ("shared_node", node_name);
+  allocator.deallocate(node_name, allocator.state);
+}
+
+TEST(TestNodeOptions, identical_setters_keep_rcl_options) {
+  auto options = rclcpp::NodeOptions()
+    .arguments({"--ros-args", "-r", "__node:=kept_node"});
+  const rcl_node_options_t * rcl_options = options.get_rcl_node_options();
+  ASSERT_TRUE(rcl_options != nullptr);
+
+  // Re-applying the current values must not discard the prepared rcl options.
+  options.arguments(options.arguments());
+  options.use_global_arguments(options.use_global_arguments());
+  options.enable_rosout(options.enable_rosout());
+  options.rosout_qos(options.rosout_qos());
+  EXPECT_EQ(rcl_options, options.get_rcl_node_options());
+
+  // An actual change still invalidates and recreates them.
+  options.enable_rosout(false);
+  EXPECT_FALSE(options.get_rcl_node_options()->enable_rosout);
+}
+
 TEST(TestNodeOptions, use_global_arguments) {
   {
     auto options = rclcpp::NodeOptions();
@@ -271,6 +315,16 @@ TEST(TestNodeOptions, bool_setters_and_getters) {
   EXPECT_FALSE(options.enable_logger_service());
   options.enable_logger_service(true);
   EXPECT_TRUE(options.enable_logger_service());
+
+  options.lazy_parameters(true);
+  EXPECT_TRUE(options.lazy_parameters());
+  options.lazy_parameters(false);
+  EXPECT_FALSE(options.lazy_parameters());
+
+  options.lazy_time_source(true);
+  EXPECT_TRUE(options.lazy_time_source());
+  options.lazy_time_source(false);
+  EXPECT_FALSE(options.lazy_time_source());
 }
 
 TEST(TestNodeOptions, parameter_event_qos) {
@@ -322,6 +376,24 @@ TEST(TestNodeOptions, set_get_allocator) {
   EXPECT_THROW(options.get_rcl_node_options(), std::bad_alloc);
 }
 
+TEST(TestNodeOptions, memory_resource) {
+  std::pmr::monotonic_buffer_resource resource;
+
+  rclcpp::NodeOptions options;
+  EXPECT_EQ(nullptr, options.memory_resource());
+
+  options.memory_resource(&resource);
+  EXPECT_EQ(&resource, options.memory_resource());
+
+  // The memory resource overrides the plain rcl allocator.
+  const rcl_node_options_t * rcl_options = options.get_rcl_node_options();
+  ASSERT_NE(nullptr, rcl_options);
+  EXPECT_EQ(&resource, rcl_options->allocator.state);
+
+  rclcpp::NodeOptions copied_options = options;
+  EXPECT_EQ(&resource, copied_options.memory_resource());
+}
+
 TEST(TestNodeOptions, clock_type) {
   rclcpp::NodeOptions options;
   EXPECT_EQ(RCL_ROS_TIME, options.clock_type());
@@ -947,3 +947,21 @@ TEST_F(TestParameter, parameter_vector_stringification) {
     "\"string_param\": {\"type\": \"string\", \"value\": \"I'm a string\"}}",
     ss.str());
 }
+
+TEST_F(TestParameter, value_copies_share_storage) {
+  const std::vector<int64_t> values{1, 2, 3};
+  const rclcpp::ParameterValue original(values);
+  const rclcpp::ParameterValue copy(original);
+
+  EXPECT_EQ(original, copy);
+  // Copies alias one immutable payload rather than deep-copying it.
+  EXPECT_EQ(
+    original.get<std::vector<int64_t>>().data(),
+    copy.get<std::vector<int64_t>>().data());
+
+  const rclcpp::ParameterValue string_value(std::string("shared"));
+  const rclcpp::ParameterValue string_copy(string_value);
+  EXPECT_EQ(
+    string_value.get<std::string>().c_str(),
+    string_copy.get<std::string>().c_str());
+}
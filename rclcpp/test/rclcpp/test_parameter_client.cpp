@@ -906,6 +906,42 @@ TEST_F(TestParameterClient, async_parameter_delete_parameters) {
     get_future2.get()[0].get_type(),
     rcl_interfaces::msg::ParameterType::PARAMETER_NOT_SET);
 }
+/*
+  Coverage for async set_parameters_bulk and set_parameters_delta
+ */
+TEST_F(TestParameterClient, async_parameter_set_parameters_bulk) {
+  auto asynchronous_client =
+    std::make_shared<rclcpp::AsyncParametersClient>(node_with_option);
+  std::vector<rclcpp::Parameter> parameters;
+  for (int i = 0; i < 5; ++i) {
+    parameters.emplace_back("bulk_param_" + std::to_string(i), i);
+  }
+  // 5 parameters with chunk size 2 pipelines 3 requests.
+  auto bulk_future = asynchronous_client->set_parameters_bulk(parameters, 2u);
+  auto return_code = rclcpp::spin_until_future_complete(
+    node_with_option, bulk_future, std::chrono::milliseconds(500));
+  ASSERT_EQ(rclcpp::FutureReturnCode::SUCCESS, return_code);
+  auto results = bulk_future.get();
+  ASSERT_EQ(parameters.size(), results.size());
+  for (const auto & result : results) {
+    EXPECT_TRUE(result.successful);
+  }
+  // Nothing differs from the snapshot, so the delta sync resolves immediately.
+  auto delta_future = asynchronous_client->set_parameters_delta(parameters, parameters);
+  ASSERT_EQ(std::future_status::ready, delta_future.wait_for(std::chrono::seconds(0)));
+  EXPECT_TRUE(delta_future.get().empty());
+  // Only the one changed parameter is transferred.
+  auto snapshot = parameters;
+  parameters[2] = rclcpp::Parameter("bulk_param_2", 42);
+  auto delta_future2 = asynchronous_client->set_parameters_delta(parameters, snapshot);
+  return_code = rclcpp::spin_until_future_complete(
+    node_with_option, delta_future2, std::chrono::milliseconds(500));
+  ASSERT_EQ(rclcpp::FutureReturnCode::SUCCESS, return_code);
+  ASSERT_EQ(1u, delta_future2.get().size());
+  EXPECT_TRUE(delta_future2.get()[0].successful);
+  EXPECT_THROW(
+    asynchronous_client->set_parameters_bulk(parameters, 0u), std::invalid_argument);
+}
 /*
   Coverage for sync delete_parameters
  */
@@ -203,3 +203,31 @@ TEST_F(TestParameterEventFilter, validate_data) {
   EXPECT_EQ(1, res.get_events()[0].second->value.integer_value);
   EXPECT_EQ(2, res.get_events()[1].second->value.integer_value);
 }
+
+TEST_F(TestParameterEventFilter, indexed_matches_linear) {
+  rclcpp::IndexedParameterEventsFilter indexed(
+    {"new", "changed", "deleted"},
+    {nt, ct, dt});
+  EXPECT_EQ(3u, indexed.evaluate(full).size());
+  EXPECT_EQ(0u, indexed.evaluate(empty).size());
+  EXPECT_EQ(2u, indexed.evaluate(multiple).size());
+  EXPECT_EQ(1u, indexed.evaluate(np).size());
+
+  rclcpp::IndexedParameterEventsFilter by_type(
+    {"new", "changed", "deleted"},
+    {ct, dt});
+  EXPECT_EQ(2u, by_type.evaluate(full).size());
+  EXPECT_EQ(0u, by_type.evaluate(multiple).size());
+}
+
+TEST_F(TestParameterEventFilter, indexed_validate_data) {
+  rclcpp::IndexedParameterEventsFilter indexed({"new", "new2"}, {nt, ct, dt});
+  const auto & res = indexed.evaluate(multiple);
+  ASSERT_EQ(2u, res.size());
+  EXPECT_EQ(nt, res[0].first);
+  EXPECT_EQ(nt, res[1].first);
+  EXPECT_EQ(1, res[0].second->value.integer_value);
+  EXPECT_EQ(2, res[1].second->value.integer_value);
+  // Re-evaluating reuses the result storage and drops the previous event.
+  EXPECT_EQ(1u, indexed.evaluate(np).size());
+}
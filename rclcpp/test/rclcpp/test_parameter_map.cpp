@@ -18,10 +18,13 @@
 #include <rcutils/strdup.h>
 
 #include <cstdio>
+#include <filesystem>
+#include <fstream>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include "rclcpp/parameter_file_source.hpp"
 #include "rclcpp/parameter_map.hpp"
 
 rcl_params_t *
@@ -483,3 +486,45 @@ TEST(Test_parameter_map_from, multi_nodes_diff_param_name_by_node_fqn)
   delete[] c_hello_world;
   rcl_yaml_node_struct_fini(c_params);
 }
+
+TEST(Test_parameter_file_source, shared_parse_and_lazy_slices)
+{
+  const auto path =
+    std::filesystem::temp_directory_path() / "test_parameter_file_source.yaml";
+  {
+    std::ofstream out(path);
+    out << "node1:\n  ros__parameters:\n    param1: 42\n";
+    out << "node2:\n  ros__parameters:\n    param2: hello\n";
+  }
+
+  auto source = rclcpp::ParameterFileSource::open(path.string());
+  // A second open of an unchanged file reuses the same parse.
+  EXPECT_EQ(source.get(), rclcpp::ParameterFileSource::open(path.string()).get());
+
+  EXPECT_EQ(2u, source->node_names().size());
+
+  std::vector<rclcpp::Parameter> params1 = source->parameters("/node1");
+  ASSERT_EQ(1u, params1.size());
+  EXPECT_STREQ("param1", params1.at(0).get_name().c_str());
+  EXPECT_EQ(42, params1.at(0).get_value<int64_t>());
+
+  std::vector<rclcpp::Parameter> params2 = source->parameters("/node2");
+  ASSERT_EQ(1u, params2.size());
+  EXPECT_STREQ("hello", params2.at(0).get_value<std::string>().c_str());
+
+  EXPECT_TRUE(source->parameters("/not_in_file").empty());
+  EXPECT_EQ(2u, source->parameter_map().size());
+
+  // A file that changed on disk is re-parsed on the next open.
+  {
+    std::ofstream out(path);
+    out << "node1:\n  ros__parameters:\n    param1: 7\n";
+  }
+  auto reopened = rclcpp::ParameterFileSource::open(path.string());
+  EXPECT_NE(source.get(), reopened.get());
+  std::vector<rclcpp::Parameter> reparsed = reopened->parameters("/node1");
+  ASSERT_EQ(1u, reparsed.size());
+  EXPECT_EQ(7, reparsed.at(0).get_value<int64_t>());
+
+  std::filesystem::remove(path);
+}
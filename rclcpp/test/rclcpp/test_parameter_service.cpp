@@ -100,6 +100,29 @@ TEST_F(TestParameterService, list_parameters) {
   EXPECT_EQ(1u + number_parameters_in_basic_node, list_result.names.size());
 }
 
+TEST_F(TestParameterService, shared_parameter_service) {
+  auto options = rclcpp::NodeOptions().use_shared_parameter_service(true);
+  auto host = std::make_shared<rclcpp::Node>("shared_param_host", "/shared_ns", options);
+  auto second = std::make_shared<rclcpp::Node>("shared_param_second", "/shared_ns", options);
+  host->declare_parameter("host_param", rclcpp::ParameterValue(1));
+  second->declare_parameter("second_param", rclcpp::ParameterValue(2));
+
+  // All requests go to the services hosted on the first registered node.
+  auto shared_client = std::make_shared<rclcpp::SyncParametersClient>(host);
+  ASSERT_TRUE(shared_client->wait_for_service(std::chrono::seconds(1)));
+
+  // Unprefixed names address the hosting node's own parameters.
+  EXPECT_EQ(1, shared_client->get_parameter("host_param", 0));
+
+  // Names prefixed with a registered fully qualified node name are forwarded.
+  const std::string remote_param = "/shared_ns/shared_param_second/second_param";
+  EXPECT_EQ(2, shared_client->get_parameter(remote_param, 0));
+
+  shared_client->set_parameters({rclcpp::Parameter(remote_param, 5)}, 10s);
+  EXPECT_EQ(5, second->get_parameter("second_param").as_int());
+  EXPECT_EQ(5, shared_client->get_parameter(remote_param, 0));
+}
+
 TEST_F(TestParameterService, describe_parameters) {
   node->declare_parameter("parameter1", rclcpp::ParameterValue(42));
 
@@ -15,8 +15,10 @@
 #include <gtest/gtest.h>
 
 #include <chrono>
+#include <future>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -196,11 +198,7 @@ static std::vector<TestParameters> invalid_qos_profiles()
 {
   std::vector<TestParameters> parameters;
 
-  parameters.reserve(2);
-  parameters.push_back(
-    TestParameters(
-      rclcpp::QoS(rclcpp::KeepLast(10)).transient_local(),
-      "transient_local_qos"));
+  parameters.reserve(1);
   parameters.push_back(
     TestParameters(
       rclcpp::QoS(rclcpp::KeepAll()),
@@ -565,6 +563,34 @@ TEST_F(TestPublisher, get_network_flow_endpoints_errors) {
   }
 }
 
+TEST_F(TestPublisher, get_network_flow_endpoints_view) {
+  initialize();
+  const rclcpp::QoS publisher_qos(1);
+  auto publisher = node->create_publisher<test_msgs::msg::Empty>("topic", publisher_qos);
+
+  auto mock = mocking_utils::patch_and_return(
+    "lib:rclcpp", rcl_publisher_get_network_flow_endpoints, RCL_RET_OK);
+  auto mock_network_flow_endpoint_array_fini = mocking_utils::patch_and_return(
+    "lib:rclcpp", rcl_network_flow_endpoint_array_fini, RCL_RET_OK);
+
+  auto view = publisher->get_network_flow_endpoints_view();
+  ASSERT_NE(nullptr, view);
+  // Steady-state polls return the cached vector.
+  EXPECT_EQ(view, publisher->get_network_flow_endpoints_view());
+
+  // A change in the matched subscription count refreshes the cache.
+  auto subscription = node->create_subscription<test_msgs::msg::Empty>(
+    "topic", publisher_qos, [](std::shared_ptr<const test_msgs::msg::Empty>) {});
+  auto start = std::chrono::steady_clock::now();
+  while (publisher->get_subscription_count() == 0 &&
+    std::chrono::steady_clock::now() - start < std::chrono::seconds(10))
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  }
+  ASSERT_GT(publisher->get_subscription_count(), 0u);
+  EXPECT_NE(view, publisher->get_network_flow_endpoints_view());
+}
+
 TEST_F(TestPublisher, check_wait_for_all_acked_return) {
   initialize();
   const rclcpp::QoS publisher_qos(1);
@@ -607,6 +633,29 @@ TEST_F(TestPublisher, check_wait_for_all_acked_return) {
   }
 }
 
+TEST_F(TestPublisher, async_wait_for_all_acked) {
+  initialize();
+  const rclcpp::QoS publisher_qos(1);
+  auto publisher = node->create_publisher<test_msgs::msg::Empty>("topic", publisher_qos);
+
+  // With nothing published there is nothing to acknowledge, so the wait completes promptly.
+  auto future = publisher->async_wait_for_all_acked(std::chrono::seconds(10));
+  ASSERT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds(10)));
+  EXPECT_TRUE(future.get());
+
+  std::promise<bool> callback_result;
+  publisher->async_wait_for_all_acked(
+    std::chrono::nanoseconds(std::chrono::seconds(10)),
+    [&callback_result](bool acked) {callback_result.set_value(acked);});
+  auto callback_future = callback_result.get_future();
+  ASSERT_EQ(std::future_status::ready, callback_future.wait_for(std::chrono::seconds(10)));
+  EXPECT_TRUE(callback_future.get());
+
+  EXPECT_THROW(
+    publisher->async_wait_for_all_acked(std::chrono::nanoseconds(0), nullptr),
+    std::invalid_argument);
+}
+
 class TestPublisherWaitForAllAcked
   : public TestPublisher, public ::testing::WithParamInterface<std::pair<rclcpp::QoS, rclcpp::QoS>>
 {
@@ -664,6 +713,44 @@ TEST_F(TestPublisher, lowest_available_ipm_capacity) {
   ASSERT_EQ(history_depth - 1u, pub_ipm_enabled->lowest_available_ipm_capacity());
 }
 
+TEST_F(TestPublisher, backpressure_callback_and_publish_if_capacity) {
+  constexpr auto history_depth = 2u;
+
+  initialize(rclcpp::NodeOptions().use_intra_process_comms(true));
+
+  auto do_nothing = [](std::shared_ptr<const test_msgs::msg::Strings>) {};
+  auto pub = node->create_publisher<test_msgs::msg::Strings>("topic", history_depth);
+
+  // No subscription matched: nothing can be overwritten, publishes pass.
+  test_msgs::msg::Strings msg;
+  EXPECT_TRUE(pub->ipm_buffers_have_capacity());
+  EXPECT_TRUE(pub->publish_if_capacity(msg));
+
+  auto sub = node->create_subscription<test_msgs::msg::Strings>(
+    "topic", history_depth, do_nothing);
+  ASSERT_EQ(1u, pub->get_intra_process_subscription_count());
+
+  std::vector<size_t> observed;
+  pub->set_backpressure_callback(
+    1u, [&observed](size_t capacity) {observed.push_back(capacity);});
+
+  // Capacity observed before each publish: 2, then 1 (at the threshold).
+  EXPECT_TRUE(pub->publish_if_capacity(msg));
+  EXPECT_TRUE(pub->publish_if_capacity(msg));
+  ASSERT_EQ(1u, observed.size());
+  EXPECT_EQ(1u, observed[0]);
+
+  // The buffer is full now: fail fast instead of overwriting.
+  EXPECT_EQ(0u, pub->lowest_available_ipm_capacity());
+  EXPECT_FALSE(pub->ipm_buffers_have_capacity());
+  EXPECT_FALSE(pub->publish_if_capacity(msg));
+
+  // Clearing the registration stops the notifications.
+  pub->set_backpressure_callback(1u, nullptr);
+  pub->publish(msg);
+  EXPECT_EQ(1u, observed.size());
+}
+
 INSTANTIATE_TEST_SUITE_P(
   TestWaitForAllAckedWithParm,
   TestPublisherWaitForAllAcked,
@@ -674,3 +761,23 @@ INSTANTIATE_TEST_SUITE_P(
       rclcpp::QoS(1).best_effort(), rclcpp::QoS(1).best_effort()),
     std::pair<rclcpp::QoS, rclcpp::QoS>(
       rclcpp::QoS(1).reliable(), rclcpp::QoS(1).best_effort())));
+
+TEST_F(TestPublisher, slim_option) {
+  initialize();
+
+  rclcpp::PublisherOptionsWithAllocator<std::allocator<void>> slim_options;
+  slim_options.slim = true;
+  auto slim_pub = node->create_publisher<test_msgs::msg::Empty>("topic", 10, slim_options);
+  // Slim publishers carry no event handlers, not even the default ones.
+  EXPECT_TRUE(slim_pub->get_event_handlers().empty());
+
+  auto regular_pub = node->create_publisher<test_msgs::msg::Empty>("topic", 10);
+  EXPECT_FALSE(regular_pub->get_event_handlers().empty());
+
+  rclcpp::PublisherOptionsWithAllocator<std::allocator<void>> bad_options;
+  bad_options.slim = true;
+  bad_options.event_callbacks.matched_callback = [](rclcpp::MatchedInfo &) {};
+  EXPECT_THROW(
+    node->create_publisher<test_msgs::msg::Empty>("topic", 10, bad_options),
+    std::invalid_argument);
+}
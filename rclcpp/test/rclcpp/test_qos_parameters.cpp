@@ -256,6 +256,113 @@ TEST(TestQosParameters, internal_functions_failure_modes) {
     std::invalid_argument);
 }
 
+TEST(TestQosParameters, cached_resolution_per_node) {
+  rclcpp::init(0, nullptr);
+  auto node = std::make_shared<rclcpp::Node>(
+    "my_node", "/ns", rclcpp::NodeOptions().parameter_overrides(
+  {
+    rclcpp::Parameter(
+      "qos_overrides./my/fully/qualified/topic_name.publisher.reliability", "best_effort"),
+  }));
+
+  rclcpp::QoS qos{rclcpp::KeepLast(10)};
+  qos = rclcpp::detail::declare_qos_parameters(
+    rclcpp::QosOverridingOptions::with_default_policies(),
+    node,
+    "/my/fully/qualified/topic_name",
+    qos,
+    rclcpp::detail::PublisherQosParametersTraits{});
+  // A second resolution for the same node, prefix and policy kinds is served from the
+  // per-node cache and must match the first one.
+  rclcpp::QoS cached_qos{rclcpp::KeepLast(10)};
+  cached_qos = rclcpp::detail::declare_qos_parameters(
+    rclcpp::QosOverridingOptions::with_default_policies(),
+    node,
+    "/my/fully/qualified/topic_name",
+    cached_qos,
+    rclcpp::detail::PublisherQosParametersTraits{});
+  EXPECT_EQ(qos, cached_qos);
+  EXPECT_EQ(RMW_QOS_POLICY_RELIABILITY_BEST_EFFORT, cached_qos.get_rmw_qos_profile().reliability);
+
+  // A different node with different overrides must not see the first node's cached profile.
+  auto other_node = std::make_shared<rclcpp::Node>(
+    "other_node", "/ns", rclcpp::NodeOptions().parameter_overrides(
+  {
+    rclcpp::Parameter(
+      "qos_overrides./my/fully/qualified/topic_name.publisher.reliability", "reliable"),
+  }));
+  rclcpp::QoS other_qos{rclcpp::KeepLast(10)};
+  other_qos = rclcpp::detail::declare_qos_parameters(
+    rclcpp::QosOverridingOptions::with_default_policies(),
+    other_node,
+    "/my/fully/qualified/topic_name",
+    other_qos,
+    rclcpp::detail::PublisherQosParametersTraits{});
+  EXPECT_EQ(RMW_QOS_POLICY_RELIABILITY_RELIABLE, other_qos.get_rmw_qos_profile().reliability);
+
+  rclcpp::shutdown();
+}
+
+TEST(TestQosParameters, frozen_profile_manifest) {
+  rclcpp::init(0, nullptr);
+  rclcpp::QoS frozen_qos{rclcpp::KeepLast(42)};
+  frozen_qos.best_effort();
+  auto node = std::make_shared<rclcpp::Node>(
+    "my_node", "/ns", rclcpp::NodeOptions().qos_profile_manifest(
+  {
+    {"/my/fully/qualified/topic_name.publisher", frozen_qos},
+  }));
+
+  rclcpp::QoS qos{rclcpp::KeepLast(10)};
+  qos = rclcpp::detail::declare_qos_parameters(
+    rclcpp::QosOverridingOptions::with_default_policies(),
+    node,
+    "/my/fully/qualified/topic_name",
+    qos,
+    rclcpp::detail::PublisherQosParametersTraits{});
+
+  // The frozen profile is used verbatim and replaces parameter declaration.
+  EXPECT_EQ(frozen_qos, qos);
+  std::map<std::string, rclcpp::Parameter> qos_params;
+  EXPECT_FALSE(
+    node->get_node_parameters_interface()->get_parameters_by_prefix(
+      "qos_overrides./my/fully/qualified/topic_name.publisher", qos_params));
+
+  // Entities without a manifest entry still resolve through parameters.
+  rclcpp::QoS other_qos{rclcpp::KeepLast(10)};
+  other_qos = rclcpp::detail::declare_qos_parameters(
+    rclcpp::QosOverridingOptions::with_default_policies(),
+    node,
+    "/another/topic_name",
+    other_qos,
+    rclcpp::detail::PublisherQosParametersTraits{});
+  EXPECT_EQ(rclcpp::QoS(rclcpp::KeepLast(10)), other_qos);
+  EXPECT_TRUE(
+    node->get_node_parameters_interface()->get_parameters_by_prefix(
+      "qos_overrides./another/topic_name.publisher", qos_params));
+
+  // The validation callback still gets a say on frozen profiles.
+  rclcpp::QosOverridingOptions rejecting_options{
+    {rclcpp::QosPolicyKind::Reliability},
+    [](const rclcpp::QoS &) {
+      rclcpp::QosCallbackResult result;
+      result.successful = false;
+      result.reason = "rejected";
+      return result;
+    }};
+  rclcpp::QoS rejected_qos{rclcpp::KeepLast(10)};
+  EXPECT_THROW(
+    rclcpp::detail::declare_qos_parameters(
+      rejecting_options,
+      node,
+      "/my/fully/qualified/topic_name",
+      rejected_qos,
+      rclcpp::detail::PublisherQosParametersTraits{}),
+    rclcpp::exceptions::InvalidQosOverridesException);
+
+  rclcpp::shutdown();
+}
+
 TEST(TestQosParameters, keep_last_zero) {
   rclcpp::KeepLast keep_last(0);
 
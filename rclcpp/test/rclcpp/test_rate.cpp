@@ -119,3 +119,69 @@ TEST(TestRate, from_double) {
     EXPECT_EQ(std::chrono::milliseconds(250), rate.period());
   }
 }
+
+/*
+   Basic functionality tests for PrecisionRate.
+ */
+TEST(TestRate, precision_rate_basics) {
+  auto period = std::chrono::milliseconds(50);
+  double overrun_ratio = 1.5;
+
+  rclcpp::PrecisionRate r(period);
+  EXPECT_EQ(period, r.period());
+  EXPECT_TRUE(r.is_steady());
+
+  auto start = std::chrono::steady_clock::now();
+  ASSERT_TRUE(r.sleep());
+  auto one = std::chrono::steady_clock::now();
+  auto delta = one - start;
+  EXPECT_LE(period, delta + std::chrono::milliseconds(1));
+  EXPECT_GT(period * overrun_ratio, delta);
+
+  // Overrunning the period returns false without sleeping.
+  rclcpp::sleep_for(period * 2);
+  auto two = std::chrono::steady_clock::now();
+  ASSERT_FALSE(r.sleep());
+  auto three = std::chrono::steady_clock::now();
+  EXPECT_GT(std::chrono::milliseconds(5), three - two);
+
+  r.reset();
+  ASSERT_TRUE(r.sleep());
+}
+
+TEST(TestRate, precision_rate_no_drift) {
+  // Absolute deadlines: jitter inside an iteration must not accumulate.
+  auto period = std::chrono::milliseconds(20);
+  rclcpp::PrecisionRate r(period);
+
+  auto start = std::chrono::steady_clock::now();
+  constexpr int cycles = 5;
+  for (int i = 0; i < cycles; ++i) {
+    // Burn a varying slice of the period.
+    rclcpp::sleep_for(period / (2 + i));
+    ASSERT_TRUE(r.sleep());
+  }
+  auto total = std::chrono::steady_clock::now() - start;
+  EXPECT_LE(cycles * period, total + std::chrono::milliseconds(2));
+  EXPECT_GT(cycles * period + period, total);
+}
+
+TEST(TestRate, precision_rate_overrun_policies) {
+  auto period = std::chrono::milliseconds(20);
+  {
+    // Skip: after an overrun the schedule realigns past now, so the very
+    // next on-time iteration sleeps again.
+    rclcpp::PrecisionRate r(period, rclcpp::RateOverrunPolicy::Skip);
+    rclcpp::sleep_for(period * 3);
+    ASSERT_FALSE(r.sleep());
+    ASSERT_TRUE(r.sleep());
+  }
+  {
+    // CatchUp: missed deadlines stay owed, so sleep() keeps returning false
+    // until the schedule is recovered.
+    rclcpp::PrecisionRate r(period, rclcpp::RateOverrunPolicy::CatchUp);
+    rclcpp::sleep_for(period * 3);
+    ASSERT_FALSE(r.sleep());
+    ASSERT_FALSE(r.sleep());
+  }
+}
@@ -0,0 +1,174 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "test_msgs/msg/basic_types.hpp"
+
+#include "rclcpp/node.hpp"
+#include "rclcpp/node_options.hpp"
+#include "rclcpp/qos.hpp"
+#include "rclcpp/rclcpp.hpp"
+#include "rclcpp/relay.hpp"
+
+using namespace std::chrono_literals;
+
+class TestRelay : public ::testing::Test
+{
+public:
+  static void SetUpTestCase()
+  {
+    rclcpp::init(0, nullptr);
+  }
+
+  static void TearDownTestCase()
+  {
+    rclcpp::shutdown();
+  }
+
+  // Spin the node until the condition holds or the timeout expires.
+  template<typename ConditionT>
+  bool spin_until(rclcpp::Node::SharedPtr node, const ConditionT & condition)
+  {
+    auto start = std::chrono::steady_clock::now();
+    while (!condition()) {
+      if (std::chrono::steady_clock::now() - start > 5s) {
+        return false;
+      }
+      rclcpp::spin_some(node);
+      std::this_thread::sleep_for(1ms);
+    }
+    return true;
+  }
+};
+
+TEST_F(TestRelay, serialized_passthrough)
+{
+  auto node = std::make_shared<rclcpp::Node>("relay_node");
+
+  auto relay = rclcpp::create_relay(
+    node->get_node_topics_interface(),
+    "relay_in", "relay_out", "test_msgs/msg/BasicTypes", rclcpp::QoS(10));
+  EXPECT_NE(nullptr, relay->get_publisher());
+
+  std::vector<int64_t> received;
+  auto subscription = node->create_subscription<test_msgs::msg::BasicTypes>(
+    "relay_out", rclcpp::QoS(10),
+    [&received](const test_msgs::msg::BasicTypes & msg) {
+      received.push_back(msg.int64_value);
+    });
+
+  auto publisher = node->create_publisher<test_msgs::msg::BasicTypes>("relay_in", rclcpp::QoS(10));
+  for (int64_t i = 0; i < 3; i++) {
+    test_msgs::msg::BasicTypes msg;
+    msg.int64_value = i;
+    publisher->publish(msg);
+  }
+
+  ASSERT_TRUE(spin_until(node, [&received]() {return received.size() >= 3u;}));
+  EXPECT_EQ(std::vector<int64_t>({0, 1, 2}), received);
+}
+
+TEST_F(TestRelay, records_pipeline_latency_across_hop)
+{
+  auto node = std::make_shared<rclcpp::Node>("relay_latency_node");
+
+  auto relay = rclcpp::create_relay(
+    node->get_node_topics_interface(),
+    "relay_latency_in", "relay_latency_out", "test_msgs/msg/BasicTypes", rclcpp::QoS(10));
+
+  auto publisher = node->create_publisher<test_msgs::msg::BasicTypes>(
+    "relay_latency_in", rclcpp::QoS(10));
+  publisher->publish(test_msgs::msg::BasicTypes());
+
+  auto counters = relay->get_publisher()->get_introspection_counters();
+  ASSERT_TRUE(
+    spin_until(
+      node, [&counters]() {
+        return counters->messages.load() >= 1u;
+      }));
+
+  // The relay preserved the input's origin timestamp, so its output publisher
+  // recorded the latency accumulated since the original publish.
+  EXPECT_GE(counters->latency_samples.load(), 1u);
+  EXPECT_GT(counters->latency_sum_ns.load(), 0u);
+  // The origin is consumed by the publish which recorded it.
+  EXPECT_EQ(0, relay->get_publisher()->get_origin_timestamp());
+}
+
+TEST_F(TestRelay, filter_decimates_without_payload)
+{
+  auto node = std::make_shared<rclcpp::Node>("relay_filter_node");
+
+  // Drop every other message based only on the message info.
+  size_t seen = 0;
+  auto relay = rclcpp::create_relay(
+    node->get_node_topics_interface(),
+    "relay_filter_in", "relay_filter_out", "test_msgs/msg/BasicTypes", rclcpp::QoS(10),
+    [&seen](const rclcpp::MessageInfo &) {
+      return seen++ % 2 == 0;
+    });
+
+  size_t received = 0;
+  auto subscription = node->create_subscription<test_msgs::msg::BasicTypes>(
+    "relay_filter_out", rclcpp::QoS(10),
+    [&received](const test_msgs::msg::BasicTypes &) {
+      received++;
+    });
+
+  auto publisher = node->create_publisher<test_msgs::msg::BasicTypes>(
+    "relay_filter_in", rclcpp::QoS(10));
+  for (int64_t i = 0; i < 4; i++) {
+    publisher->publish(test_msgs::msg::BasicTypes());
+  }
+
+  ASSERT_TRUE(spin_until(node, [&seen]() {return seen >= 4u;}));
+  ASSERT_TRUE(spin_until(node, [&received]() {return received >= 2u;}));
+  EXPECT_EQ(2u, received);
+}
+
+TEST_F(TestRelay, typed_relay_intra_process)
+{
+  auto node = std::make_shared<rclcpp::Node>(
+    "typed_relay_node", rclcpp::NodeOptions().use_intra_process_comms(true));
+
+  auto relay = rclcpp::create_typed_relay<test_msgs::msg::BasicTypes>(
+    node, "typed_relay_in", "typed_relay_out", rclcpp::QoS(10));
+  EXPECT_NE(nullptr, relay->get_subscription());
+  EXPECT_NE(nullptr, relay->get_publisher());
+
+  std::vector<int64_t> received;
+  auto subscription = node->create_subscription<test_msgs::msg::BasicTypes>(
+    "typed_relay_out", rclcpp::QoS(10),
+    [&received](const test_msgs::msg::BasicTypes & msg) {
+      received.push_back(msg.int64_value);
+    });
+
+  auto publisher = node->create_publisher<test_msgs::msg::BasicTypes>(
+    "typed_relay_in", rclcpp::QoS(10));
+  for (int64_t i = 0; i < 3; i++) {
+    auto msg = std::make_unique<test_msgs::msg::BasicTypes>();
+    msg->int64_value = i;
+    publisher->publish(std::move(msg));
+  }
+
+  ASSERT_TRUE(spin_until(node, [&received]() {return received.size() >= 3u;}));
+  EXPECT_EQ(std::vector<int64_t>({0, 1, 2}), received);
+}
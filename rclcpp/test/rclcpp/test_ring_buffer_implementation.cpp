@@ -13,7 +13,10 @@
 // limitations under the License.
 
 
+#include <atomic>
+#include <chrono>
 #include <memory>
+#include <thread>
 #include <utility>
 
 #include "gtest/gtest.h"
@@ -79,3 +82,53 @@ TEST(TestRingBufferImplementation, basic_usage) {
   EXPECT_EQ(false, rb.has_data());
   EXPECT_EQ(false, rb.is_full());
 }
+
+/*
+   Full-buffer policies
+   - drop-newest keeps the unread history and counts the discarded element
+   - block waits until the consumer frees a slot, or times out and drops
+ */
+TEST(TestRingBufferImplementation, full_policies) {
+  rclcpp::experimental::buffers::RingBufferImplementation<char> rb(2);
+  auto drops = std::make_shared<std::atomic<uint64_t>>(0);
+  rb.set_overwrite_counter(drops);
+  rb.set_full_policy(
+    rclcpp::IntraProcessBufferFullPolicy::DropNewest,
+    std::chrono::nanoseconds(-1));
+
+  rb.enqueue('a');
+  rb.enqueue('b');
+  rb.enqueue('c');
+
+  EXPECT_EQ(1u, drops->load());
+  EXPECT_EQ('a', rb.dequeue());
+  EXPECT_EQ('b', rb.dequeue());
+  EXPECT_EQ(false, rb.has_data());
+
+  rb.set_full_policy(
+    rclcpp::IntraProcessBufferFullPolicy::Block,
+    std::chrono::milliseconds(5));
+
+  rb.enqueue('d');
+  rb.enqueue('e');
+
+  // No consumer: the blocking enqueue times out and drops the element.
+  rb.enqueue('f');
+  EXPECT_EQ(2u, drops->load());
+
+  // With a consumer the blocked producer gets the freed slot.
+  std::thread consumer(
+    [&rb]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds(20));
+      rb.dequeue();
+    });
+  rb.set_full_policy(
+    rclcpp::IntraProcessBufferFullPolicy::Block,
+    std::chrono::seconds(10));
+  rb.enqueue('g');
+  consumer.join();
+
+  EXPECT_EQ(2u, drops->load());
+  EXPECT_EQ('e', rb.dequeue());
+  EXPECT_EQ('g', rb.dequeue());
+}
@@ -21,6 +21,7 @@
 
 #include "rclcpp/serialization.hpp"
 #include "rclcpp/serialized_message.hpp"
+#include "rclcpp/serialized_message_pool.hpp"
 #include "rclcpp/rclcpp.hpp"
 
 #include "rcpputils/asserts.hpp"
@@ -152,6 +153,63 @@ TEST(TestSerializedMessage, reserve) {
     rclcpp::exceptions::RCLBadAlloc);
 }
 
+TEST(TestSerializedMessage, inline_buffer) {
+  const std::string content = "small";
+  const auto content_size = content.size() + 1;  // accounting for null terminator
+
+  rclcpp::SerializedMessage serialized_msg(16);
+  auto & rcl_handle = serialized_msg.get_rcl_serialized_message();
+  const auto * inline_buffer = rcl_handle.buffer;
+  ASSERT_TRUE(nullptr != inline_buffer);
+  std::memcpy(rcl_handle.buffer, content.c_str(), content_size);
+  rcl_handle.buffer_length = content_size;
+
+  // Growing within the inline capacity does not move the buffer.
+  serialized_msg.reserve(rclcpp::SerializedMessage::kInlineBufferCapacity);
+  EXPECT_EQ(inline_buffer, serialized_msg.get_rcl_serialized_message().buffer);
+  EXPECT_EQ(rclcpp::SerializedMessage::kInlineBufferCapacity, serialized_msg.capacity());
+
+  // Growing beyond it migrates the content to the heap.
+  serialized_msg.reserve(rclcpp::SerializedMessage::kInlineBufferCapacity + 1);
+  auto & grown_handle = serialized_msg.get_rcl_serialized_message();
+  EXPECT_NE(inline_buffer, grown_handle.buffer);
+  EXPECT_EQ(rclcpp::SerializedMessage::kInlineBufferCapacity + 1, serialized_msg.capacity());
+  EXPECT_EQ(content_size, serialized_msg.size());
+  EXPECT_STREQ(content.c_str(), reinterpret_cast<char *>(grown_handle.buffer));
+}
+
+TEST(TestSerializedMessage, inline_buffer_move_and_copy) {
+  const std::string content = "small";
+  const auto content_size = content.size() + 1;  // accounting for null terminator
+
+  rclcpp::SerializedMessage serialized_msg(16);
+  auto & rcl_handle = serialized_msg.get_rcl_serialized_message();
+  std::memcpy(rcl_handle.buffer, content.c_str(), content_size);
+  rcl_handle.buffer_length = content_size;
+
+  // A copy gets its own inline buffer.
+  rclcpp::SerializedMessage copied_msg(serialized_msg);
+  auto & copied_handle = copied_msg.get_rcl_serialized_message();
+  EXPECT_NE(rcl_handle.buffer, copied_handle.buffer);
+  EXPECT_EQ(16u, copied_msg.capacity());
+  EXPECT_EQ(content_size, copied_msg.size());
+  EXPECT_STREQ(content.c_str(), reinterpret_cast<char *>(copied_handle.buffer));
+
+  // Moving re-homes the inline content into the target object.
+  rclcpp::SerializedMessage moved_msg(std::move(serialized_msg));
+  auto & moved_handle = moved_msg.get_rcl_serialized_message();
+  EXPECT_TRUE(nullptr == serialized_msg.get_rcl_serialized_message().buffer);
+  EXPECT_EQ(16u, moved_msg.capacity());
+  EXPECT_EQ(content_size, moved_msg.size());
+  EXPECT_STREQ(content.c_str(), reinterpret_cast<char *>(moved_handle.buffer));
+
+  // Resizing the moved-to message through the rmw interface stays valid.
+  EXPECT_EQ(
+    RMW_RET_OK,
+    rmw_serialized_message_resize(&moved_handle, rclcpp::SerializedMessage::kInlineBufferCapacity));
+  EXPECT_STREQ(content.c_str(), reinterpret_cast<char *>(moved_handle.buffer));
+}
+
 TEST(TestSerializedMessage, serialization) {
   using MessageT = test_msgs::msg::BasicTypes;
 
@@ -171,6 +229,82 @@ TEST(TestSerializedMessage, serialization) {
   }
 }
 
+TEST(TestSerializedMessage, serialization_backend) {
+  using MessageT = test_msgs::msg::BasicTypes;
+
+  rclcpp::Serialization<MessageT> serializer;
+  MessageT ros_msg;
+  ros_msg.bool_value = true;
+
+  // A backend that declines every message is consulted but the generic rmw
+  // path still produces the result.
+  size_t declined_serialize_calls = 0;
+  size_t declined_deserialize_calls = 0;
+  rclcpp::register_serialization_backend<MessageT>(
+    {
+      [&declined_serialize_calls](const void *, rcl_serialized_message_t *) {
+        ++declined_serialize_calls;
+        return false;
+      },
+      [&declined_deserialize_calls](const rcl_serialized_message_t *, void *) {
+        ++declined_deserialize_calls;
+        return false;
+      }
+    });
+  {
+    rclcpp::SerializedMessage serialized_msg;
+    serializer.serialize_message(&ros_msg, &serialized_msg);
+    MessageT deserialized_ros_msg;
+    serializer.deserialize_message(&serialized_msg, &deserialized_ros_msg);
+    EXPECT_EQ(ros_msg, deserialized_ros_msg);
+  }
+  EXPECT_EQ(1u, declined_serialize_calls);
+  EXPECT_EQ(1u, declined_deserialize_calls);
+
+  // A backend that handles the message replaces the rmw path entirely; this
+  // toy codec encodes only the bool_value field in a single byte.
+  rclcpp::register_serialization_backend<MessageT>(
+    {
+      [](const void * untyped_msg, rcl_serialized_message_t * out) {
+        const auto * msg = static_cast<const MessageT *>(untyped_msg);
+        if (RMW_RET_OK != rmw_serialized_message_resize(out, 1)) {
+          return false;
+        }
+        out->buffer[0] = msg->bool_value ? 1 : 0;
+        out->buffer_length = 1;
+        return true;
+      },
+      [](const rcl_serialized_message_t * in, void * untyped_msg) {
+        if (1u != in->buffer_length) {
+          return false;
+        }
+        static_cast<MessageT *>(untyped_msg)->bool_value = (1 == in->buffer[0]);
+        return true;
+      }
+    });
+  {
+    rclcpp::SerializedMessage serialized_msg;
+    serializer.serialize_message(&ros_msg, &serialized_msg);
+    EXPECT_EQ(1u, serialized_msg.size());
+    MessageT deserialized_ros_msg;
+    serializer.deserialize_message(&serialized_msg, &deserialized_ros_msg);
+    EXPECT_TRUE(deserialized_ros_msg.bool_value);
+  }
+
+  // After unregistering, the generic path is back in charge.
+  rclcpp::unregister_serialization_backend<MessageT>();
+  {
+    rclcpp::SerializedMessage serialized_msg;
+    serializer.serialize_message(&ros_msg, &serialized_msg);
+    EXPECT_NE(1u, serialized_msg.size());
+  }
+
+  // Backends with missing functions are rejected.
+  EXPECT_THROW(
+    rclcpp::register_serialization_backend<MessageT>({nullptr, nullptr}),
+    std::invalid_argument);
+}
+
 TEST(TestSerializedMessage, assignment_operators) {
   const std::string content = "Hello World";
   const auto content_size = content.size() + 1;  // accounting for null terminator
@@ -294,3 +428,69 @@ TEST(TestSerializedMessage, serialization_empty_messages)
   EXPECT_THROW(deserialize_default_serialized_message(), rcpputils::IllegalStateException);
   EXPECT_THROW(deserialize_nullptr(), rcpputils::IllegalStateException);
 }
+
+TEST(TestSerializedMessagePool, acquire_and_recycle) {
+  rclcpp::SerializedMessagePool pool;
+  EXPECT_EQ(0u, pool.available());
+
+  auto message = pool.acquire(100);
+  ASSERT_NE(nullptr, message);
+  EXPECT_EQ(0u, message->size());
+  EXPECT_GE(message->capacity(), 100u);
+  const auto * buffer = message->get_rcl_serialized_message().buffer;
+
+  // Releasing the message returns the buffer to the pool ...
+  message.reset();
+  EXPECT_EQ(1u, pool.available());
+
+  // ... and a subsequent acquire of the same size class reuses it.
+  auto recycled = pool.acquire(100);
+  EXPECT_EQ(buffer, recycled->get_rcl_serialized_message().buffer);
+  EXPECT_EQ(0u, pool.available());
+}
+
+TEST(TestSerializedMessagePool, reserve_pre_sizes_pool) {
+  rclcpp::SerializedMessagePool pool;
+  pool.reserve(4, 1024);
+  EXPECT_EQ(4u, pool.available());
+
+  // Reserving is idempotent for an already-filled size class.
+  pool.reserve(4, 1024);
+  EXPECT_EQ(4u, pool.available());
+
+  // The high watermark caps how far a size class can be pre-sized.
+  rclcpp::SerializedMessagePool small_pool(2);
+  EXPECT_EQ(2u, small_pool.get_high_watermark());
+  small_pool.reserve(10, 1024);
+  EXPECT_EQ(2u, small_pool.available());
+}
+
+TEST(TestSerializedMessagePool, outstanding_message_survives_pool) {
+  std::shared_ptr<rclcpp::SerializedMessage> message;
+  {
+    rclcpp::SerializedMessagePool pool;
+    message = pool.acquire();
+  }
+  // The pool is gone, releasing the message must simply free the buffer.
+  EXPECT_NO_THROW(message.reset());
+}
+
+TEST(TestSerializedMessagePool, serialization_draws_from_pool) {
+  using MessageT = test_msgs::msg::BasicTypes;
+
+  rclcpp::Serialization<MessageT> serializer;
+  rclcpp::SerializedMessagePool pool;
+
+  auto basic_type_ros_msgs = get_messages_basic_types();
+  for (const auto & ros_msg : basic_type_ros_msgs) {
+    auto serialized_msg = serializer.serialize_message(ros_msg.get(), pool);
+    ASSERT_NE(nullptr, serialized_msg);
+
+    MessageT deserialized_ros_msg;
+    serializer.deserialize_message(serialized_msg.get(), &deserialized_ros_msg);
+    EXPECT_EQ(*ros_msg, deserialized_ros_msg);
+  }
+
+  // All buffers were returned, so the steady state holds a single buffer.
+  EXPECT_EQ(1u, pool.available());
+}
@@ -216,6 +216,23 @@ TEST_F(TestService, take_request) {
   }
 }
 
+/*
+   Dropped requests are recycled instead of allocated anew.
+ */
+TEST_F(TestService, create_request_recycled) {
+  auto callback =
+    [](const test_msgs::srv::Empty::Request::SharedPtr,
+      test_msgs::srv::Empty::Response::SharedPtr) {};
+  auto server = node->create_service<test_msgs::srv::Empty>("service", callback);
+
+  auto request = server->create_request();
+  void * recycled_ptr = request.get();
+  request.reset();
+
+  request = server->create_request();
+  EXPECT_EQ(recycled_ptr, request.get());
+}
+
 TEST_F(TestService, send_response) {
   auto callback =
     [](const test_msgs::srv::Empty::Request::SharedPtr,
@@ -239,6 +256,38 @@ TEST_F(TestService, send_response) {
   }
 }
 
+TEST_F(TestService, drain_requests_on_execute_flag) {
+  auto callback =
+    [](const test_msgs::srv::Empty::Request::SharedPtr,
+      test_msgs::srv::Empty::Response::SharedPtr) {};
+  auto server = node->create_service<test_msgs::srv::Empty>("service", callback);
+
+  EXPECT_FALSE(server->drain_requests_on_execute());
+  server->set_drain_requests_on_execute(true);
+  EXPECT_TRUE(server->drain_requests_on_execute());
+  server->set_drain_requests_on_execute(false);
+  EXPECT_FALSE(server->drain_requests_on_execute());
+}
+
+TEST_F(TestService, response_sender) {
+  auto callback =
+    [](const test_msgs::srv::Empty::Request::SharedPtr,
+      test_msgs::srv::Empty::Response::SharedPtr) {};
+  auto server = node->create_service<test_msgs::srv::Empty>("service", callback);
+
+  auto request_id = server->create_request_header();
+  test_msgs::srv::Empty::Response response;
+  auto sender = server->create_response_sender(request_id);
+  EXPECT_TRUE(sender.is_pending());
+
+  auto mock = mocking_utils::patch_and_return("lib:rclcpp", rcl_send_response, RCL_RET_OK);
+  EXPECT_NO_THROW(sender.send_response(response));
+  EXPECT_FALSE(sender.is_pending());
+
+  // A sender completes exactly one request.
+  EXPECT_THROW(sender.send_response(response), std::runtime_error);
+}
+
 /*
    Testing on_new_request callbacks.
  */
@@ -0,0 +1,209 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "test_msgs/msg/basic_types.hpp"
+
+#include "rclcpp/node.hpp"
+#include "rclcpp/qos.hpp"
+#include "rclcpp/rclcpp.hpp"
+#include "rclcpp/sharding.hpp"
+
+using namespace std::chrono_literals;
+
+class TestSharding : public ::testing::Test
+{
+public:
+  static void SetUpTestCase()
+  {
+    rclcpp::init(0, nullptr);
+  }
+
+  static void TearDownTestCase()
+  {
+    rclcpp::shutdown();
+  }
+
+  // Spin the node until the condition holds or the timeout expires.
+  template<typename ConditionT>
+  bool spin_until(rclcpp::Node::SharedPtr node, const ConditionT & condition)
+  {
+    auto start = std::chrono::steady_clock::now();
+    while (!condition()) {
+      if (std::chrono::steady_clock::now() - start > 5s) {
+        return false;
+      }
+      rclcpp::spin_some(node);
+      std::this_thread::sleep_for(1ms);
+    }
+    return true;
+  }
+};
+
+TEST_F(TestSharding, invalid_arguments)
+{
+  auto node = std::make_shared<rclcpp::Node>("sharding_args_node");
+
+  EXPECT_THROW(
+    rclcpp::ShardedSubscription<test_msgs::msg::BasicTypes>(
+      node, "sharding_args", rclcpp::QoS(10), nullptr),
+    std::invalid_argument);
+
+  rclcpp::ShardingOptions<test_msgs::msg::BasicTypes> options;
+  options.shards = 0;
+  EXPECT_THROW(
+    rclcpp::ShardedSubscription<test_msgs::msg::BasicTypes>(
+      node, "sharding_args", rclcpp::QoS(10),
+      [](const std::shared_ptr<const test_msgs::msg::BasicTypes> &) {}, options),
+    std::invalid_argument);
+}
+
+TEST_F(TestSharding, round_robin_spreads_messages_across_workers)
+{
+  auto node = std::make_shared<rclcpp::Node>("sharding_rr_node");
+  const size_t count = 8;
+
+  std::mutex mutex;
+  std::vector<int32_t> received;
+  std::set<std::thread::id> worker_ids;
+  rclcpp::ShardingOptions<test_msgs::msg::BasicTypes> options;
+  options.shards = 2;
+  auto sharded = std::make_shared<rclcpp::ShardedSubscription<test_msgs::msg::BasicTypes>>(
+    node, "sharding_rr", rclcpp::QoS(10),
+    [&](const std::shared_ptr<const test_msgs::msg::BasicTypes> & message) {
+      std::lock_guard<std::mutex> lock(mutex);
+      received.push_back(message->int32_value);
+      worker_ids.insert(std::this_thread::get_id());
+    },
+    options);
+
+  auto publisher = node->create_publisher<test_msgs::msg::BasicTypes>("sharding_rr", 10);
+  test_msgs::msg::BasicTypes message;
+  for (size_t i = 0; i < count; ++i) {
+    message.int32_value = static_cast<int32_t>(i);
+    publisher->publish(message);
+  }
+
+  ASSERT_TRUE(
+    spin_until(
+      node, [&]() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return received.size() == count;
+      }));
+
+  std::lock_guard<std::mutex> lock(mutex);
+  // Every message was processed exactly once, by both workers.
+  std::sort(received.begin(), received.end());
+  for (size_t i = 0; i < count; ++i) {
+    EXPECT_EQ(static_cast<int32_t>(i), received[i]);
+  }
+  EXPECT_EQ(2u, worker_ids.size());
+}
+
+TEST_F(TestSharding, selector_keeps_keys_on_one_worker)
+{
+  auto node = std::make_shared<rclcpp::Node>("sharding_key_node");
+  const size_t count = 8;
+
+  std::mutex mutex;
+  size_t processed = 0;
+  std::set<std::thread::id> even_ids;
+  std::set<std::thread::id> odd_ids;
+  rclcpp::ShardingOptions<test_msgs::msg::BasicTypes> options;
+  options.shards = 2;
+  options.shard_selector = [](const test_msgs::msg::BasicTypes & message) {
+      return static_cast<size_t>(message.int32_value) % 2u;
+    };
+  auto sharded = std::make_shared<rclcpp::ShardedSubscription<test_msgs::msg::BasicTypes>>(
+    node, "sharding_key", rclcpp::QoS(10),
+    [&](const std::shared_ptr<const test_msgs::msg::BasicTypes> & message) {
+      std::lock_guard<std::mutex> lock(mutex);
+      ++processed;
+      auto & ids = 0 == message->int32_value % 2 ? even_ids : odd_ids;
+      ids.insert(std::this_thread::get_id());
+    },
+    options);
+
+  auto publisher = node->create_publisher<test_msgs::msg::BasicTypes>("sharding_key", 10);
+  test_msgs::msg::BasicTypes message;
+  for (size_t i = 0; i < count; ++i) {
+    message.int32_value = static_cast<int32_t>(i);
+    publisher->publish(message);
+  }
+
+  ASSERT_TRUE(
+    spin_until(
+      node, [&]() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return processed == count;
+      }));
+
+  std::lock_guard<std::mutex> lock(mutex);
+  // Each key class stayed on its shard's worker.
+  EXPECT_EQ(1u, even_ids.size());
+  EXPECT_EQ(1u, odd_ids.size());
+}
+
+TEST_F(TestSharding, in_order_completion_hand_off)
+{
+  auto node = std::make_shared<rclcpp::Node>("sharding_order_node");
+  const size_t count = 6;
+
+  std::mutex mutex;
+  std::vector<int32_t> completed;
+  rclcpp::ShardingOptions<test_msgs::msg::BasicTypes> options;
+  options.shards = 3;
+  options.on_complete = [&](const std::shared_ptr<const test_msgs::msg::BasicTypes> & message) {
+      std::lock_guard<std::mutex> lock(mutex);
+      completed.push_back(message->int32_value);
+    };
+  auto sharded = std::make_shared<rclcpp::ShardedSubscription<test_msgs::msg::BasicTypes>>(
+    node, "sharding_order", rclcpp::QoS(10),
+    [](const std::shared_ptr<const test_msgs::msg::BasicTypes> & message) {
+      // Later messages finish first, forcing the hand-off to reorder.
+      std::this_thread::sleep_for(
+        std::chrono::milliseconds(2 * (static_cast<int32_t>(count) - message->int32_value)));
+    },
+    options);
+
+  auto publisher = node->create_publisher<test_msgs::msg::BasicTypes>("sharding_order", 10);
+  test_msgs::msg::BasicTypes message;
+  for (size_t i = 0; i < count; ++i) {
+    message.int32_value = static_cast<int32_t>(i);
+    publisher->publish(message);
+  }
+
+  ASSERT_TRUE(
+    spin_until(
+      node, [&]() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return completed.size() == count;
+      }));
+
+  std::lock_guard<std::mutex> lock(mutex);
+  // Completions arrive in publish order despite out-of-order processing.
+  for (size_t i = 0; i < count; ++i) {
+    EXPECT_EQ(static_cast<int32_t>(i), completed[i]);
+  }
+}
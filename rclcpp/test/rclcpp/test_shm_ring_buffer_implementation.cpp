@@ -0,0 +1,135 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "gtest/gtest.h"
+
+#include "rclcpp/experimental/buffers/buffer_implementation_base.hpp"
+#include "rclcpp/experimental/buffers/shm_ring_buffer_implementation.hpp"
+
+#if !defined(_WIN32)
+
+#include <unistd.h>
+
+namespace
+{
+
+std::string unique_segment_name(const std::string & suffix)
+{
+  return "rclcpp_test_shm_" + std::to_string(getpid()) + "_" + suffix;
+}
+
+}  // namespace
+
+/*
+   Constructor
+ */
+TEST(TestShmRingBufferImplementation, constructor) {
+  // Cannot create a buffer of size zero.
+  EXPECT_THROW(
+    rclcpp::experimental::buffers::ShmRingBufferImplementation<char> rb(
+      unique_segment_name("ctor"), 0),
+    std::invalid_argument);
+
+  // Segment names must be non-empty and must not contain '/'.
+  EXPECT_THROW(
+    rclcpp::experimental::buffers::ShmRingBufferImplementation<char> rb("", 1),
+    std::invalid_argument);
+  EXPECT_THROW(
+    rclcpp::experimental::buffers::ShmRingBufferImplementation<char> rb("bad/name", 1),
+    std::invalid_argument);
+
+  rclcpp::experimental::buffers::ShmRingBufferImplementation<char> rb(
+    unique_segment_name("ctor"), 1);
+
+  EXPECT_EQ(false, rb.has_data());
+  EXPECT_EQ(1u, rb.available_capacity());
+  EXPECT_EQ(1u, rb.attached_count());
+}
+
+/*
+   Two buffers attached to the same segment see each other's elements; this
+   exercises the create and attach paths that two co-located processes use.
+ */
+TEST(TestShmRingBufferImplementation, shared_segment_usage) {
+  const std::string name = unique_segment_name("shared");
+
+  rclcpp::experimental::buffers::ShmRingBufferImplementation<char> producer(name, 2);
+  rclcpp::experimental::buffers::ShmRingBufferImplementation<char> consumer(name, 2);
+
+  EXPECT_EQ(2u, producer.attached_count());
+
+  // Attaching with a mismatched capacity or element type is refused.
+  EXPECT_THROW(
+    rclcpp::experimental::buffers::ShmRingBufferImplementation<char> rb(name, 3),
+    std::invalid_argument);
+  EXPECT_THROW(
+    rclcpp::experimental::buffers::ShmRingBufferImplementation<uint64_t> rb(name, 2),
+    std::invalid_argument);
+
+  producer.enqueue('a');
+
+  EXPECT_EQ(true, consumer.has_data());
+  EXPECT_EQ(1u, consumer.available_capacity());
+  EXPECT_EQ('a', consumer.dequeue());
+  EXPECT_EQ(false, consumer.has_data());
+
+  producer.enqueue('b');
+  producer.enqueue('c');
+
+  EXPECT_EQ(0u, consumer.available_capacity());
+
+  // Enqueueing on a full buffer drops the oldest element.
+  producer.enqueue('d');
+
+  EXPECT_EQ('c', consumer.dequeue());
+  EXPECT_EQ('d', consumer.dequeue());
+  EXPECT_EQ(false, consumer.has_data());
+  EXPECT_EQ(1u, producer.overwrite_count());
+}
+
+/*
+   The last detaching buffer unlinks the segment, so recreating under the
+   same name starts from an empty buffer.
+ */
+TEST(TestShmRingBufferImplementation, segment_cleanup) {
+  const std::string name = unique_segment_name("cleanup");
+
+  {
+    rclcpp::experimental::buffers::ShmRingBufferImplementation<char> rb(name, 2);
+    rb.enqueue('a');
+  }
+
+  rclcpp::experimental::buffers::ShmRingBufferImplementation<char> rb(name, 2);
+  EXPECT_EQ(false, rb.has_data());
+  EXPECT_EQ(1u, rb.attached_count());
+}
+
+#else
+
+/*
+   Shared memory buffers are POSIX only; the constructor reports that.
+ */
+TEST(TestShmRingBufferImplementation, unsupported_platform) {
+  EXPECT_THROW(
+    rclcpp::experimental::buffers::ShmRingBufferImplementation<char> rb("unsupported", 1),
+    std::runtime_error);
+}
+
+#endif  // !defined(_WIN32)
@@ -0,0 +1,144 @@
+// Copyright 2024 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <utility>
+
+#include "gtest/gtest.h"
+
+#include "rclcpp/experimental/buffers/buffer_implementation_base.hpp"
+#include "rclcpp/experimental/buffers/spsc_ring_buffer_implementation.hpp"
+
+/*
+   Constructor
+ */
+TEST(TestSpscRingBufferImplementation, constructor) {
+  // Cannot create a buffer of size zero.
+  EXPECT_THROW(
+    rclcpp::experimental::buffers::SpscRingBufferImplementation<char> rb(0),
+    std::invalid_argument);
+
+  rclcpp::experimental::buffers::SpscRingBufferImplementation<char> rb(1);
+
+  EXPECT_EQ(false, rb.has_data());
+  EXPECT_EQ(1u, rb.available_capacity());
+}
+
+/*
+   Full policies other than overwrite-oldest are rejected, not silently
+   downgraded.
+ */
+TEST(TestSpscRingBufferImplementation, unsupported_full_policy_throws) {
+  rclcpp::experimental::buffers::SpscRingBufferImplementation<char> rb(2);
+
+  EXPECT_NO_THROW(
+    rb.set_full_policy(
+      rclcpp::IntraProcessBufferFullPolicy::OverwriteOldest, std::chrono::nanoseconds(-1)));
+  EXPECT_THROW(
+    rb.set_full_policy(
+      rclcpp::IntraProcessBufferFullPolicy::DropNewest, std::chrono::nanoseconds(-1)),
+    std::invalid_argument);
+  EXPECT_THROW(
+    rb.set_full_policy(
+      rclcpp::IntraProcessBufferFullPolicy::Block, std::chrono::nanoseconds(100)),
+    std::invalid_argument);
+}
+
+/*
+   Basic usage
+   - insert data and check that it has data
+   - extract data
+   - overwrite old data writing over the buffer capacity
+ */
+TEST(TestSpscRingBufferImplementation, basic_usage) {
+  rclcpp::experimental::buffers::SpscRingBufferImplementation<char> rb(2);
+
+  rb.enqueue('a');
+
+  EXPECT_EQ(true, rb.has_data());
+  EXPECT_EQ(1u, rb.available_capacity());
+
+  char v = rb.dequeue();
+
+  EXPECT_EQ('a', v);
+  EXPECT_EQ(false, rb.has_data());
+
+  rb.enqueue('b');
+  rb.enqueue('c');
+
+  EXPECT_EQ(0u, rb.available_capacity());
+
+  // Enqueueing on a full buffer drops the oldest element.
+  rb.enqueue('d');
+
+  EXPECT_EQ('c', rb.dequeue());
+  EXPECT_EQ('d', rb.dequeue());
+  EXPECT_EQ(false, rb.has_data());
+}
+
+/*
+   Unique pointers are moved through the buffer without copies.
+ */
+TEST(TestSpscRingBufferImplementation, unique_ptr_usage) {
+  rclcpp::experimental::buffers::SpscRingBufferImplementation<std::unique_ptr<int>> rb(2);
+
+  rb.enqueue(std::make_unique<int>(42));
+  auto v = rb.dequeue();
+  ASSERT_NE(nullptr, v);
+  EXPECT_EQ(42, *v);
+
+  // Dequeue on empty returns a default constructed element
+  EXPECT_EQ(nullptr, rb.dequeue());
+}
+
+/*
+   One producer thread and one consumer thread exchange a sequence of values;
+   the consumer must observe a monotonically increasing subsequence (elements
+   may be dropped when the buffer is full, but never reordered or duplicated).
+ */
+TEST(TestSpscRingBufferImplementation, single_producer_single_consumer) {
+  rclcpp::experimental::buffers::SpscRingBufferImplementation<size_t> rb(8);
+
+  constexpr size_t num_values = 100000;
+
+  std::thread producer(
+    [&rb]() {
+      for (size_t i = 1; i <= num_values; i++) {
+        rb.enqueue(i);
+      }
+    });
+
+  size_t last_seen = 0;
+  size_t received = 0;
+  while (last_seen < num_values) {
+    if (!rb.has_data()) {
+      std::this_thread::yield();
+      continue;
+    }
+    size_t value = rb.dequeue();
+    if (value == 0u) {
+      continue;
+    }
+    EXPECT_GT(value, last_seen);
+    last_seen = value;
+    received++;
+  }
+
+  producer.join();
+  EXPECT_LE(received, num_values);
+  EXPECT_EQ(last_seen, num_values);
+}
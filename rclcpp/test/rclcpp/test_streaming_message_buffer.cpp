@@ -0,0 +1,143 @@
+// Copyright 2024 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "rclcpp/experimental/buffers/streaming_message_buffer.hpp"
+
+using rclcpp::experimental::buffers::StreamingMessageBuffer;
+
+namespace
+{
+struct PayloadMessage
+{
+  std::vector<int> data;
+};
+}  // namespace
+
+TEST(TestStreamingMessageBuffer, lifecycle) {
+  StreamingMessageBuffer<PayloadMessage> buffer;
+  EXPECT_EQ(nullptr, buffer.current());
+  EXPECT_EQ(0u, buffer.committed());
+  EXPECT_FALSE(buffer.complete());
+  EXPECT_EQ(nullptr, buffer.take_complete());
+
+  EXPECT_THROW(buffer.begin(nullptr), std::invalid_argument);
+
+  auto message = std::make_shared<PayloadMessage>();
+  message->data.resize(4);
+  buffer.begin(message);
+  EXPECT_EQ(message, buffer.current());
+  EXPECT_EQ(0u, buffer.committed());
+  EXPECT_FALSE(buffer.complete());
+  EXPECT_EQ(nullptr, buffer.take_complete());
+
+  buffer.commit(2u);
+  EXPECT_EQ(2u, buffer.committed());
+  EXPECT_FALSE(buffer.complete());
+
+  buffer.finish();
+  EXPECT_TRUE(buffer.complete());
+  EXPECT_EQ(message, buffer.take_complete());
+  EXPECT_EQ(nullptr, buffer.current());
+
+  // A second finish without a streaming message is a no-op.
+  buffer.finish();
+  EXPECT_TRUE(buffer.complete());
+  EXPECT_EQ(nullptr, buffer.take_complete());
+}
+
+TEST(TestStreamingMessageBuffer, begin_replaces_unfinished_message) {
+  StreamingMessageBuffer<PayloadMessage> buffer;
+  auto first = std::make_shared<PayloadMessage>();
+  auto second = std::make_shared<PayloadMessage>();
+
+  buffer.begin(first);
+  buffer.commit(1u);
+  // The first message is replaced before being finished; the buffer must not
+  // report the replacement as complete or keep the stale committed count.
+  buffer.begin(second);
+  EXPECT_EQ(second, buffer.current());
+  EXPECT_EQ(0u, buffer.committed());
+  EXPECT_FALSE(buffer.complete());
+
+  buffer.finish();
+  EXPECT_EQ(second, buffer.take_complete());
+}
+
+TEST(TestStreamingMessageBuffer, on_commit_callback) {
+  StreamingMessageBuffer<PayloadMessage> buffer;
+  std::vector<size_t> commits;
+  buffer.set_on_commit_callback([&commits](size_t committed) {commits.push_back(committed);});
+
+  auto message = std::make_shared<PayloadMessage>();
+  buffer.begin(message);
+  buffer.commit(1u);
+  buffer.commit(3u);
+  buffer.finish();
+  ASSERT_EQ(3u, commits.size());
+  EXPECT_EQ(1u, commits[0]);
+  EXPECT_EQ(3u, commits[1]);
+  EXPECT_EQ(3u, commits[2]);
+}
+
+/*
+ * The consumer may process the committed prefix while the producer is still
+ * writing later chunks; every observed prefix must be fully written.
+ */
+TEST(TestStreamingMessageBuffer, overlapped_producer_consumer) {
+  constexpr size_t kTotal = 10000u;
+  constexpr size_t kChunk = 250u;
+
+  StreamingMessageBuffer<PayloadMessage> buffer;
+  auto message = std::make_shared<PayloadMessage>();
+  // The payload is sized up front; streaming commits only publish fill
+  // progress, they never reallocate.
+  message->data.resize(kTotal, -1);
+  buffer.begin(message);
+
+  std::thread producer(
+    [&buffer, &message]() {
+      for (size_t offset = 0u; offset < kTotal; offset += kChunk) {
+        for (size_t i = offset; i < offset + kChunk; ++i) {
+          message->data[i] = static_cast<int>(i);
+        }
+        buffer.commit(offset + kChunk);
+      }
+      buffer.finish();
+    });
+
+  size_t max_observed = 0u;
+  std::shared_ptr<const PayloadMessage> streaming;
+  while (nullptr == (streaming = buffer.take_complete())) {
+    size_t committed = buffer.committed();
+    auto current = buffer.current();
+    ASSERT_NE(nullptr, current);
+    for (size_t i = 0u; i < committed; ++i) {
+      ASSERT_EQ(static_cast<int>(i), current->data[i]);
+    }
+    max_observed = std::max(max_observed, committed);
+  }
+  producer.join();
+
+  for (size_t i = 0u; i < kTotal; ++i) {
+    ASSERT_EQ(static_cast<int>(i), streaming->data[i]);
+  }
+}
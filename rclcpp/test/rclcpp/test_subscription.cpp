@@ -15,6 +15,7 @@
 #include <gtest/gtest.h>
 
 #include <chrono>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <ostream>
@@ -25,11 +26,14 @@
 
 #include "rclcpp/exceptions.hpp"
 #include "rclcpp/rclcpp.hpp"
+#include "rclcpp/serialization.hpp"
+#include "rclcpp/sealed_subscription.hpp"
 
 #include "../mocking_utils/patch.hpp"
 #include "../utils/rclcpp_gtest_macros.hpp"
 
 #include "test_msgs/msg/empty.hpp"
+#include "test_msgs/msg/strings.hpp"
 
 using namespace std::chrono_literals;
 
@@ -244,6 +248,143 @@ TEST_F(TestSubscription, take) {
   // TODO(wjwwood): figure out a good way to test the intra-process exclusion behavior.
 }
 
+/*
+   Testing take_type_erased_sequence.
+ */
+TEST_F(TestSubscription, take_type_erased_sequence) {
+  initialize();
+  constexpr size_t batch_size = 5;
+  auto do_nothing = [](std::shared_ptr<const test_msgs::msg::Empty>) {FAIL();};
+  rclcpp::SubscriptionOptions so;
+  so.use_intra_process_comm = rclcpp::IntraProcessSetting::Disable;
+  auto sub = node_->create_subscription<test_msgs::msg::Empty>(
+    "~/test_take_sequence", 10, do_nothing, so);
+
+  std::vector<std::shared_ptr<void>> messages(batch_size);
+  std::vector<void *> raw_messages(batch_size);
+  std::vector<rclcpp::MessageInfo> message_infos(batch_size);
+  for (size_t i = 0; i < batch_size; ++i) {
+    messages[i] = sub->create_message();
+    raw_messages[i] = messages[i].get();
+  }
+
+  // Nothing published yet, the take must come back empty.
+  EXPECT_EQ(
+    0u, sub->take_type_erased_sequence(batch_size, raw_messages.data(), message_infos.data()));
+
+  rclcpp::PublisherOptions po;
+  po.use_intra_process_comm = rclcpp::IntraProcessSetting::Disable;
+  auto pub = node_->create_publisher<test_msgs::msg::Empty>("~/test_take_sequence", 10, po);
+  for (size_t i = 0; i < batch_size; ++i) {
+    test_msgs::msg::Empty msg;
+    pub->publish(msg);
+  }
+
+  size_t taken_count = 0;
+  auto start = std::chrono::steady_clock::now();
+  do {
+    taken_count += sub->take_type_erased_sequence(
+      batch_size - taken_count, raw_messages.data() + taken_count,
+      message_infos.data() + taken_count);
+    std::this_thread::sleep_for(100ms);
+  } while (taken_count < batch_size && std::chrono::steady_clock::now() - start < 10s);
+  EXPECT_EQ(batch_size, taken_count);
+
+  for (size_t i = 0; i < batch_size; ++i) {
+    sub->return_message(messages[i]);
+  }
+}
+
+/*
+   Testing the non-throwing try_take/try_publish hot path variants.
+ */
+TEST_F(TestSubscription, try_take) {
+  initialize();
+  auto do_nothing = [](std::shared_ptr<const test_msgs::msg::Empty>) {FAIL();};
+  rclcpp::SubscriptionOptions so;
+  so.use_intra_process_comm = rclcpp::IntraProcessSetting::Disable;
+  auto sub = node_->create_subscription<test_msgs::msg::Empty>(
+    "~/test_try_take", 10, do_nothing, so);
+
+  test_msgs::msg::Empty msg;
+  rclcpp::MessageInfo message_info;
+  EXPECT_EQ(RCL_RET_SUBSCRIPTION_TAKE_FAILED, sub->try_take(msg, message_info));
+
+  rclcpp::PublisherOptions po;
+  po.use_intra_process_comm = rclcpp::IntraProcessSetting::Disable;
+  auto pub = node_->create_publisher<test_msgs::msg::Empty>("~/test_try_take", 10, po);
+  EXPECT_EQ(RCL_RET_OK, pub->try_publish(msg));
+
+  rcl_ret_t ret = RCL_RET_SUBSCRIPTION_TAKE_FAILED;
+  auto start = std::chrono::steady_clock::now();
+  do {
+    ret = sub->try_take(msg, message_info);
+    std::this_thread::sleep_for(100ms);
+  } while (RCL_RET_OK != ret && std::chrono::steady_clock::now() - start < 10s);
+  EXPECT_EQ(RCL_RET_OK, ret);
+
+  // Intra-process publishers refuse the non-throwing path instead of
+  // publishing a message local subscriptions would filter out.
+  rclcpp::PublisherOptions ipc_po;
+  ipc_po.use_intra_process_comm = rclcpp::IntraProcessSetting::Enable;
+  auto ipc_pub = node_->create_publisher<test_msgs::msg::Empty>("~/test_try_take", 10, ipc_po);
+  EXPECT_EQ(RCL_RET_UNSUPPORTED, ipc_pub->try_publish(msg));
+}
+
+/*
+   Testing sealed direct-dispatch subscriptions.
+ */
+TEST_F(TestSubscription, sealed_dispatch) {
+  initialize();
+  rclcpp::SubscriptionOptions so;
+  so.use_intra_process_comm = rclcpp::IntraProcessSetting::Disable;
+  so.use_sealed_dispatch = true;
+
+  size_t received_count = 0;
+  auto callback = [&received_count](std::shared_ptr<const test_msgs::msg::Empty>) {
+      received_count++;
+    };
+  auto sub = node_->create_subscription<test_msgs::msg::Empty>(
+    "~/test_sealed", 10, callback, so);
+
+  // The factory must have instantiated the sealed class for this callback.
+  using SealedT = rclcpp::SealedSubscription<test_msgs::msg::Empty, decltype(callback)>;
+  EXPECT_NE(nullptr, std::dynamic_pointer_cast<SealedT>(sub));
+
+  // The message-and-info signature is sealable too.
+  bool info_received = false;
+  auto info_callback =
+    [&info_received](const test_msgs::msg::Empty &, const rclcpp::MessageInfo & info) {
+      info_received = !info.get_rmw_message_info().from_intra_process;
+    };
+  auto info_sub = node_->create_subscription<test_msgs::msg::Empty>(
+    "~/test_sealed", 10, info_callback, so);
+  using SealedInfoT = rclcpp::SealedSubscription<test_msgs::msg::Empty, decltype(info_callback)>;
+  EXPECT_NE(nullptr, std::dynamic_pointer_cast<SealedInfoT>(info_sub));
+
+  rclcpp::PublisherOptions po;
+  po.use_intra_process_comm = rclcpp::IntraProcessSetting::Disable;
+  auto pub = node_->create_publisher<test_msgs::msg::Empty>("~/test_sealed", 10, po);
+  pub->publish(test_msgs::msg::Empty());
+
+  auto start = std::chrono::steady_clock::now();
+  while ((0u == received_count || !info_received) &&
+    std::chrono::steady_clock::now() - start < 10s)
+  {
+    rclcpp::spin_some(node_);
+    std::this_thread::sleep_for(10ms);
+  }
+  EXPECT_EQ(1u, received_count);
+  EXPECT_TRUE(info_received);
+
+  // A unique_ptr callback is not sealable and must fall back to the generic
+  // subscription class without the option causing an error.
+  auto unique_callback = [](std::unique_ptr<test_msgs::msg::Empty>) {};
+  auto fallback_sub = node_->create_subscription<test_msgs::msg::Empty>(
+    "~/test_sealed_fallback", 10, unique_callback, so);
+  EXPECT_NE(nullptr, fallback_sub);
+}
+
 /*
    Testing take_serialized.
  */
@@ -279,6 +420,105 @@ TEST_F(TestSubscription, take_serialized) {
   }
 }
 
+/*
+   Testing take_serialized_into and take_serialized_sequence_into.
+ */
+TEST_F(TestSubscription, take_serialized_into_arena) {
+  initialize();
+  auto do_nothing = [](std::shared_ptr<const rclcpp::SerializedMessage>) {FAIL();};
+  rclcpp::SubscriptionOptions so;
+  so.use_intra_process_comm = rclcpp::IntraProcessSetting::Disable;
+  auto sub = node_->create_subscription<test_msgs::msg::Strings>(
+    "~/test_arena", 10, do_nothing, so);
+
+  alignas(8) uint8_t arena[1024];
+  rclcpp::SubscriptionBase::SerializedView view;
+  rclcpp::MessageInfo msg_info;
+  EXPECT_THROW(
+    sub->take_serialized_into(nullptr, sizeof(arena), view, msg_info),
+    std::invalid_argument);
+  EXPECT_FALSE(sub->take_serialized_into(arena, sizeof(arena), view, msg_info));
+
+  rclcpp::PublisherOptions po;
+  po.use_intra_process_comm = rclcpp::IntraProcessSetting::Disable;
+  auto pub = node_->create_publisher<test_msgs::msg::Strings>("~/test_arena", 10, po);
+  test_msgs::msg::Strings msg;
+  msg.string_value = "hello arena";
+  pub->publish(msg);
+  pub->publish(msg);
+
+  rclcpp::SubscriptionBase::SerializedView views[4];
+  rclcpp::MessageInfo msg_infos[4];
+  size_t taken = 0;
+  auto start = std::chrono::steady_clock::now();
+  do {
+    taken += sub->take_serialized_sequence_into(
+      arena, sizeof(arena), 4, &views[taken], &msg_infos[taken]);
+    std::this_thread::sleep_for(100ms);
+  } while (taken < 2 && std::chrono::steady_clock::now() - start < 10s);
+  ASSERT_EQ(2u, taken);
+
+  rclcpp::Serialization<test_msgs::msg::Strings> serializer;
+  for (size_t i = 0; i < taken; ++i) {
+    // Both messages landed in the arena, back to back, and deserialize.
+    EXPECT_TRUE(views[i].in_arena);
+    EXPECT_GE(views[i].data, arena);
+    EXPECT_LE(views[i].data + views[i].size, arena + sizeof(arena));
+    rcl_serialized_message_t borrowed = rmw_get_zero_initialized_serialized_message();
+    borrowed.buffer = const_cast<uint8_t *>(views[i].data);
+    borrowed.buffer_length = views[i].size;
+    borrowed.buffer_capacity = views[i].size;
+    borrowed.allocator = rcl_get_default_allocator();
+    const rclcpp::SerializedMessage copy(borrowed);
+    test_msgs::msg::Strings taken_msg;
+    serializer.deserialize_message(&copy, &taken_msg);
+    EXPECT_EQ("hello arena", taken_msg.string_value);
+  }
+}
+
+/*
+   Testing the heap fallback of take_serialized_into for undersized arenas.
+ */
+TEST_F(TestSubscription, take_serialized_into_arena_overflow) {
+  initialize();
+  auto do_nothing = [](std::shared_ptr<const rclcpp::SerializedMessage>) {FAIL();};
+  rclcpp::SubscriptionOptions so;
+  so.use_intra_process_comm = rclcpp::IntraProcessSetting::Disable;
+  auto sub = node_->create_subscription<test_msgs::msg::Strings>(
+    "~/test_arena_overflow", 10, do_nothing, so);
+  rclcpp::PublisherOptions po;
+  po.use_intra_process_comm = rclcpp::IntraProcessSetting::Disable;
+  auto pub = node_->create_publisher<test_msgs::msg::Strings>("~/test_arena_overflow", 10, po);
+
+  test_msgs::msg::Strings msg;
+  msg.string_value = std::string(64, 'x');
+  pub->publish(msg);
+
+  // Far too small for the message: the take must fall back, not fail.
+  alignas(8) uint8_t arena[8];
+  rclcpp::SubscriptionBase::SerializedView view;
+  rclcpp::MessageInfo msg_info;
+  bool message_received = false;
+  auto start = std::chrono::steady_clock::now();
+  do {
+    message_received = sub->take_serialized_into(arena, sizeof(arena), view, msg_info);
+    std::this_thread::sleep_for(100ms);
+  } while (!message_received && std::chrono::steady_clock::now() - start < 10s);
+  ASSERT_TRUE(message_received);
+  EXPECT_FALSE(view.in_arena);
+
+  rcl_serialized_message_t borrowed = rmw_get_zero_initialized_serialized_message();
+  borrowed.buffer = const_cast<uint8_t *>(view.data);
+  borrowed.buffer_length = view.size;
+  borrowed.buffer_capacity = view.size;
+  borrowed.allocator = rcl_get_default_allocator();
+  const rclcpp::SerializedMessage copy(borrowed);
+  rclcpp::Serialization<test_msgs::msg::Strings> serializer;
+  test_msgs::msg::Strings taken_msg;
+  serializer.deserialize_message(&copy, &taken_msg);
+  EXPECT_EQ(msg.string_value, taken_msg.string_value);
+}
+
 TEST_F(TestSubscription, rcl_subscription_init_error) {
   initialize();
   auto callback = [](std::shared_ptr<const test_msgs::msg::Empty>) {};
@@ -611,11 +851,7 @@ static std::vector<TestParameters> invalid_qos_profiles()
 {
   std::vector<TestParameters> parameters;
 
-  parameters.reserve(3);
-  parameters.push_back(
-    TestParameters(
-      rclcpp::QoS(rclcpp::KeepLast(10)).transient_local(),
-      "transient_local_qos"));
+  parameters.reserve(1);
   parameters.push_back(
     TestParameters(
       rclcpp::QoS(rclcpp::KeepAll()),
@@ -672,3 +908,95 @@ TEST_P(TestSubscriptionInvalidIntraprocessQos, test_subscription_throws_intrapro
         options);},
     std::runtime_error("Unrecognized IntraProcessSetting value"));
 }
+
+/*
+   Testing the slim option.
+ */
+TEST_F(TestSubscription, slim_option) {
+  initialize();
+  auto callback = std::bind(&TestSubscription::on_message, this, std::placeholders::_1);
+
+  rclcpp::SubscriptionOptionsWithAllocator<std::allocator<void>> slim_options;
+  slim_options.slim = true;
+  auto slim_sub = node_->create_subscription<test_msgs::msg::Empty>(
+    "topic", 10, callback, slim_options);
+  // Slim subscriptions carry no event handlers, not even the default ones.
+  EXPECT_TRUE(slim_sub->get_event_handlers().empty());
+
+  auto regular_sub = node_->create_subscription<test_msgs::msg::Empty>("topic", 10, callback);
+  EXPECT_FALSE(regular_sub->get_event_handlers().empty());
+
+  rclcpp::SubscriptionOptionsWithAllocator<std::allocator<void>> bad_callbacks_options;
+  bad_callbacks_options.slim = true;
+  bad_callbacks_options.event_callbacks.matched_callback = [](rclcpp::MatchedInfo &) {};
+  EXPECT_THROW(
+    node_->create_subscription<test_msgs::msg::Empty>(
+      "topic", 10, callback, bad_callbacks_options),
+    std::invalid_argument);
+
+  rclcpp::SubscriptionOptionsWithAllocator<std::allocator<void>> bad_stats_options;
+  bad_stats_options.slim = true;
+  bad_stats_options.topic_stats_options.state = rclcpp::TopicStatisticsState::Enable;
+  EXPECT_THROW(
+    node_->create_subscription<test_msgs::msg::Empty>(
+      "topic", 10, callback, bad_stats_options),
+    std::invalid_argument);
+}
+
+/*
+   Testing the reusable message slot handed out for non-retaining callbacks.
+ */
+TEST_F(TestSubscription, reusable_message_slot) {
+  initialize();
+  rclcpp::SubscriptionOptions so;
+  so.use_intra_process_comm = rclcpp::IntraProcessSetting::Disable;
+  std::vector<const void *> received_addresses;
+  auto const_ref_callback = [&received_addresses](const test_msgs::msg::Empty & msg) {
+      received_addresses.push_back(&msg);
+    };
+  auto sub = node_->create_subscription<test_msgs::msg::Empty>(
+    "~/test_slot", 10, const_ref_callback, so);
+
+  // The slot is handed out once, and concurrent takes fall back to borrowing.
+  auto slot = sub->create_message();
+  const void * slot_address = slot.get();
+  auto fallback = sub->create_message();
+  EXPECT_NE(slot_address, fallback.get());
+  sub->return_message(slot);
+  auto again = sub->create_message();
+  EXPECT_EQ(slot_address, again.get());
+  sub->return_message(again);
+  sub->return_message(fallback);
+
+  // A shared-pointer callback may retain the message, so every take borrows.
+  auto retaining_callback = [](std::shared_ptr<const test_msgs::msg::Empty>) {};
+  auto retaining_sub = node_->create_subscription<test_msgs::msg::Empty>(
+    "~/test_slot_retaining", 10, retaining_callback, so);
+  auto borrowed1 = retaining_sub->create_message();
+  auto borrowed2 = retaining_sub->create_message();
+  EXPECT_NE(borrowed1.get(), borrowed2.get());
+  retaining_sub->return_message(borrowed1);
+  retaining_sub->return_message(borrowed2);
+
+  // The executor's take-dispatch-return protocol delivers every message
+  // through the same slot object.
+  rclcpp::PublisherOptions po;
+  po.use_intra_process_comm = rclcpp::IntraProcessSetting::Disable;
+  auto pub = node_->create_publisher<test_msgs::msg::Empty>("~/test_slot", 10, po);
+  pub->publish(test_msgs::msg::Empty());
+  pub->publish(test_msgs::msg::Empty());
+  auto start = std::chrono::steady_clock::now();
+  while (received_addresses.size() < 2u && std::chrono::steady_clock::now() - start < 10s) {
+    auto message = sub->create_message();
+    rclcpp::MessageInfo message_info;
+    if (sub->take_type_erased(message.get(), message_info)) {
+      sub->handle_message(message, message_info);
+    } else {
+      std::this_thread::sleep_for(100ms);
+    }
+    sub->return_message(message);
+  }
+  ASSERT_EQ(2u, received_addresses.size());
+  EXPECT_EQ(slot_address, received_addresses[0]);
+  EXPECT_EQ(slot_address, received_addresses[1]);
+}
@@ -0,0 +1,140 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "test_msgs/msg/basic_types.hpp"
+
+#include "rclcpp/executors/executor_entities_collection.hpp"
+#include "rclcpp/node.hpp"
+#include "rclcpp/node_options.hpp"
+#include "rclcpp/qos.hpp"
+#include "rclcpp/rclcpp.hpp"
+#include "rclcpp/subscription_options.hpp"
+
+using namespace std::chrono_literals;
+
+class TestSubscriptionBusyPoller : public ::testing::Test
+{
+public:
+  static void SetUpTestCase()
+  {
+    rclcpp::init(0, nullptr);
+  }
+
+  static void TearDownTestCase()
+  {
+    rclcpp::shutdown();
+  }
+
+  // Wait for the condition without spinning anything; busy-polled
+  // subscriptions must deliver with no executor involved.
+  template<typename ConditionT>
+  bool wait_for(const ConditionT & condition)
+  {
+    auto start = std::chrono::steady_clock::now();
+    while (!condition()) {
+      if (std::chrono::steady_clock::now() - start > 5s) {
+        return false;
+      }
+      std::this_thread::sleep_for(1ms);
+    }
+    return true;
+  }
+};
+
+TEST_F(TestSubscriptionBusyPoller, delivers_without_executor)
+{
+  auto node = std::make_shared<rclcpp::Node>("busy_poll_node");
+
+  rclcpp::SubscriptionOptions options;
+  options.busy_poll_options.enabled = true;
+
+  std::atomic<size_t> received {0};
+  auto subscription = node->create_subscription<test_msgs::msg::BasicTypes>(
+    "busy_poll_topic", rclcpp::QoS(10),
+    [&received](const test_msgs::msg::BasicTypes &) {
+      received++;
+    },
+    options);
+  EXPECT_TRUE(subscription->is_busy_polled());
+
+  auto publisher = node->create_publisher<test_msgs::msg::BasicTypes>(
+    "busy_poll_topic", rclcpp::QoS(10));
+  for (size_t i = 0; i < 3; i++) {
+    publisher->publish(test_msgs::msg::BasicTypes());
+  }
+
+  EXPECT_TRUE(wait_for([&received]() {return received >= 3u;}));
+}
+
+TEST_F(TestSubscriptionBusyPoller, delivers_intra_process_without_executor)
+{
+  auto node = std::make_shared<rclcpp::Node>(
+    "busy_poll_intra_node", rclcpp::NodeOptions().use_intra_process_comms(true));
+
+  rclcpp::SubscriptionOptions options;
+  options.busy_poll_options.enabled = true;
+
+  std::atomic<int64_t> last_value {-1};
+  auto subscription = node->create_subscription<test_msgs::msg::BasicTypes>(
+    "busy_poll_intra_topic", rclcpp::QoS(10),
+    [&last_value](const test_msgs::msg::BasicTypes & msg) {
+      last_value = msg.int64_value;
+    },
+    options);
+
+  auto publisher = node->create_publisher<test_msgs::msg::BasicTypes>(
+    "busy_poll_intra_topic", rclcpp::QoS(10));
+  auto msg = std::make_unique<test_msgs::msg::BasicTypes>();
+  msg->int64_value = 42;
+  publisher->publish(std::move(msg));
+
+  EXPECT_TRUE(wait_for([&last_value]() {return last_value == 42;}));
+}
+
+TEST_F(TestSubscriptionBusyPoller, excluded_from_executor_collection)
+{
+  auto node = std::make_shared<rclcpp::Node>("busy_poll_excluded_node");
+
+  rclcpp::SubscriptionOptions options;
+  options.busy_poll_options.enabled = true;
+  auto polled_subscription = node->create_subscription<test_msgs::msg::BasicTypes>(
+    "busy_poll_excluded_topic", rclcpp::QoS(10),
+    [](const test_msgs::msg::BasicTypes &) {},
+    options);
+  auto normal_subscription = node->create_subscription<test_msgs::msg::BasicTypes>(
+    "busy_poll_normal_topic", rclcpp::QoS(10),
+    [](const test_msgs::msg::BasicTypes &) {});
+
+  std::vector<rclcpp::CallbackGroup::WeakPtr> groups;
+  node->get_node_base_interface()->for_each_callback_group(
+    [&groups](rclcpp::CallbackGroup::SharedPtr group) {
+      groups.push_back(group);
+    });
+
+  rclcpp::executors::ExecutorEntitiesCollection collection;
+  rclcpp::executors::build_entities_collection(groups, collection);
+
+  EXPECT_EQ(
+    0u, collection.subscriptions.count(polled_subscription->get_subscription_handle().get()));
+  EXPECT_EQ(
+    1u, collection.subscriptions.count(normal_subscription->get_subscription_handle().get()));
+}
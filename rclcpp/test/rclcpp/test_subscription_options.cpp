@@ -17,12 +17,16 @@
 #include <chrono>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
+#include "rclcpp/executors.hpp"
 #include "rclcpp/node.hpp"
 #include "rclcpp/node_options.hpp"
 #include "rclcpp/subscription_options.hpp"
 
+#include "test_msgs/msg/empty.hpp"
+
 #include "../utils/rclcpp_gtest_macros.hpp"
 
 using namespace std::chrono_literals;
@@ -101,3 +105,70 @@ TEST_F(TestSubscriptionOptions, topic_statistics_options_node_default_mode) {
       *(node->get_node_base_interface())),
     std::runtime_error("Unrecognized EnableTopicStatistics value"));
 }
+
+TEST_F(TestSubscriptionOptions, take_batch_size_default_and_set) {
+  initialize();
+  auto subscription_options = rclcpp::SubscriptionOptions();
+
+  EXPECT_EQ(subscription_options.take_batch_size, 1u);
+
+  auto callback = [](std::shared_ptr<const test_msgs::msg::Empty>) {};
+
+  auto subscription = node->create_subscription<test_msgs::msg::Empty>(
+    "test_topic", 10, callback, subscription_options);
+  EXPECT_EQ(subscription->get_take_batch_size(), 1u);
+
+  subscription_options.take_batch_size = 16;
+  auto batched_subscription = node->create_subscription<test_msgs::msg::Empty>(
+    "batched_test_topic", 10, callback, subscription_options);
+  EXPECT_EQ(batched_subscription->get_take_batch_size(), 16u);
+
+  // Zero is normalized to 1, draining nothing would make no progress.
+  batched_subscription->set_take_batch_size(0);
+  EXPECT_EQ(batched_subscription->get_take_batch_size(), 1u);
+}
+
+TEST_F(TestSubscriptionOptions, max_message_age_default_and_set) {
+  initialize();
+  auto subscription_options = rclcpp::SubscriptionOptions();
+
+  EXPECT_EQ(subscription_options.max_message_age, 0ns);
+
+  auto callback = [](std::shared_ptr<const test_msgs::msg::Empty>) {};
+
+  subscription_options.max_message_age = 50ms;
+  auto subscription = node->create_subscription<test_msgs::msg::Empty>(
+    "test_topic", 10, callback, subscription_options);
+  EXPECT_EQ(subscription->get_max_message_age(), 50ms);
+
+  // Non-positive values disable shedding.
+  subscription->set_max_message_age(-1ns);
+  EXPECT_EQ(subscription->get_max_message_age(), 0ns);
+}
+
+TEST_F(TestSubscriptionOptions, max_message_age_sheds_stale_messages) {
+  initialize();
+  auto subscription_options = rclcpp::SubscriptionOptions();
+  subscription_options.max_message_age = 1ns;
+
+  size_t delivered = 0;
+  auto subscription = node->create_subscription<test_msgs::msg::Empty>(
+    "shedding_topic", 10,
+    [&delivered](std::shared_ptr<const test_msgs::msg::Empty>) {delivered++;},
+    subscription_options);
+  auto publisher = node->create_publisher<test_msgs::msg::Empty>("shedding_topic", 10);
+  publisher->publish(test_msgs::msg::Empty());
+
+  // By the time the executor dispatches the message it is far older than the
+  // 1ns limit, so it is shed before the callback.
+  auto counters = subscription->get_introspection_counters();
+  auto start = std::chrono::steady_clock::now();
+  while (counters->shed_messages.load() < 1u &&
+    (std::chrono::steady_clock::now() - start) < 5s)
+  {
+    rclcpp::spin_some(node);
+    std::this_thread::sleep_for(1ms);
+  }
+  EXPECT_EQ(counters->shed_messages.load(), 1u);
+  EXPECT_EQ(delivered, 0u);
+}
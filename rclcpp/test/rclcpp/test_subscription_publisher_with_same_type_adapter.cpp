@@ -31,6 +31,9 @@
 static const int g_max_loops = 200;
 static const std::chrono::milliseconds g_sleep_per_loop(10);
 
+// Counts conversions done by the double / StatisticDataPoint adapter below.
+static int g_stat_convert_to_ros_count = 0;
+
 class test_intra_process_within_one_node : public ::testing::Test
 {
 public:
@@ -88,6 +91,7 @@ struct TypeAdapter<double, statistics_msgs::msg::StatisticDataPoint>
     const custom_type & source,
     ros_message_type & destination)
   {
+    g_stat_convert_to_ros_count++;
     destination.data_type = 0;
     destination.data = source;
   }
@@ -989,3 +993,86 @@ TEST_F(
     ASSERT_TRUE(is_received);
   }
 }
+
+/*
+ * Testing that a publish converts the adapted type at most once, regardless of
+ * how many ROS-typed intra process subscriptions are attached.
+ */
+TEST_F(
+  test_intra_process_within_one_node,
+  type_adapted_messages_convert_at_most_once_for_mixed_takers)
+{
+  using DoubleTypeAdapter = rclcpp::TypeAdapter<double, statistics_msgs::msg::StatisticDataPoint>;
+  const double message_data = 42.0;
+  const std::string topic_name = "topic_name_mixed_takers";
+
+  auto node = rclcpp::Node::make_shared(
+    "test_intra_process",
+    rclcpp::NodeOptions().use_intra_process_comms(true));
+
+  auto pub = node->create_publisher<DoubleTypeAdapter>(topic_name, 1);
+
+  { // Two ROS-typed shared takers next to an adapted taker: one conversion.
+    int received_count = 0;
+    auto custom_callback =
+      [message_data, &received_count](const double & msg) -> void {
+        received_count++;
+        EXPECT_EQ(message_data, msg);
+      };
+    auto ros_callback =
+      [message_data, &received_count](
+      const statistics_msgs::msg::StatisticDataPoint & msg) -> void {
+        received_count++;
+        EXPECT_EQ(message_data, msg.data);
+      };
+    auto sub_custom = node->create_subscription<DoubleTypeAdapter>(topic_name, 1, custom_callback);
+    auto sub_ros_one = node->create_subscription<statistics_msgs::msg::StatisticDataPoint>(
+      topic_name, 1, ros_callback);
+    auto sub_ros_two = node->create_subscription<statistics_msgs::msg::StatisticDataPoint>(
+      topic_name, 1, ros_callback);
+
+    const int convert_count_before = g_stat_convert_to_ros_count;
+    pub->publish(std::make_unique<double>(message_data));
+
+    rclcpp::executors::SingleThreadedExecutor executor;
+    executor.add_node(node);
+    int i = 0;
+    while (received_count < 3 && i++ < g_max_loops) {
+      executor.spin_once(g_sleep_per_loop);
+    }
+    EXPECT_EQ(3, received_count);
+    EXPECT_EQ(convert_count_before + 1, g_stat_convert_to_ros_count);
+  }
+
+  { // Same with takers requiring ownership: convert once, copy for the rest.
+    int received_count = 0;
+    auto custom_callback =
+      [message_data, &received_count](std::unique_ptr<double> msg) -> void {
+        received_count++;
+        EXPECT_EQ(message_data, *msg);
+      };
+    auto ros_callback =
+      [message_data, &received_count](
+      std::unique_ptr<statistics_msgs::msg::StatisticDataPoint> msg) -> void {
+        received_count++;
+        EXPECT_EQ(message_data, msg->data);
+      };
+    auto sub_custom = node->create_subscription<DoubleTypeAdapter>(topic_name, 1, custom_callback);
+    auto sub_ros_one = node->create_subscription<statistics_msgs::msg::StatisticDataPoint>(
+      topic_name, 1, ros_callback);
+    auto sub_ros_two = node->create_subscription<statistics_msgs::msg::StatisticDataPoint>(
+      topic_name, 1, ros_callback);
+
+    const int convert_count_before = g_stat_convert_to_ros_count;
+    pub->publish(std::make_unique<double>(message_data));
+
+    rclcpp::executors::SingleThreadedExecutor executor;
+    executor.add_node(node);
+    int i = 0;
+    while (received_count < 3 && i++ < g_max_loops) {
+      executor.spin_once(g_sleep_per_loop);
+    }
+    EXPECT_EQ(3, received_count);
+    EXPECT_EQ(convert_count_before + 1, g_stat_convert_to_ros_count);
+  }
+}
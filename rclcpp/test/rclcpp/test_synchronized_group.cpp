@@ -0,0 +1,137 @@
+// Copyright 2024 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "rclcpp/rclcpp.hpp"
+#include "rclcpp/synchronized_group.hpp"
+
+#include "test_msgs/msg/basic_types.hpp"
+
+using test_msgs::msg::BasicTypes;
+
+namespace rclcpp
+{
+// Stamp the test messages through int64_value instead of a header.
+template<>
+struct MessageStamp<BasicTypes>
+{
+  static rcl_time_point_value_t
+  value(const BasicTypes & message)
+  {
+    return message.int64_value;
+  }
+};
+}  // namespace rclcpp
+
+class TestSynchronizedGroup : public ::testing::Test
+{
+protected:
+  static void SetUpTestCase()
+  {
+    rclcpp::init(0, nullptr);
+  }
+
+  static void TearDownTestCase()
+  {
+    rclcpp::shutdown();
+  }
+
+  void SetUp() override
+  {
+    node = std::make_shared<rclcpp::Node>(
+      "synchronized_group_node", rclcpp::NodeOptions().use_intra_process_comms(true));
+    pub_a = node->create_publisher<BasicTypes>("topic_a", 10);
+    pub_b = node->create_publisher<BasicTypes>("topic_b", 10);
+  }
+
+  void publish(const rclcpp::Publisher<BasicTypes>::SharedPtr & publisher, int64_t stamp)
+  {
+    BasicTypes message;
+    message.int64_value = stamp;
+    publisher->publish(message);
+    // Deliver before the next publish, so arrival order is deterministic.
+    rclcpp::spin_some(node);
+  }
+
+  rclcpp::Node::SharedPtr node;
+  rclcpp::Publisher<BasicTypes>::SharedPtr pub_a;
+  rclcpp::Publisher<BasicTypes>::SharedPtr pub_b;
+};
+
+constexpr int64_t kMillisecond = 1000000;
+
+/*
+ * Messages within the slop are delivered as one aligned tuple, messages
+ * beyond it are dropped once they can no longer complete a set.
+ */
+TEST_F(TestSynchronizedGroup, aligns_within_slop) {
+  std::vector<std::pair<int64_t, int64_t>> pairs;
+  rclcpp::SynchronizedGroupOptions options;
+  options.slop = std::chrono::milliseconds(5);
+  rclcpp::SynchronizedGroup<BasicTypes, BasicTypes> group(
+    node, {{"topic_a", "topic_b"}}, rclcpp::QoS(10),
+    [&pairs](std::shared_ptr<const BasicTypes> a, std::shared_ptr<const BasicTypes> b) {
+      pairs.emplace_back(a->int64_value, b->int64_value);
+    },
+    options);
+
+  // Two stamps 2 ms apart complete a set.
+  publish(pub_a, 0);
+  ASSERT_TRUE(pairs.empty());
+  publish(pub_b, 2 * kMillisecond);
+  ASSERT_EQ(1u, pairs.size());
+  EXPECT_EQ(0, pairs[0].first);
+  EXPECT_EQ(2 * kMillisecond, pairs[0].second);
+
+  // 100 ms apart is beyond the slop, no set; the unmatchable older message
+  // is discarded, and a later message close to the pending one matches.
+  publish(pub_a, 100 * kMillisecond);
+  publish(pub_b, 200 * kMillisecond);
+  ASSERT_EQ(1u, pairs.size());
+  publish(pub_a, 201 * kMillisecond);
+  ASSERT_EQ(2u, pairs.size());
+  EXPECT_EQ(201 * kMillisecond, pairs[1].first);
+  EXPECT_EQ(200 * kMillisecond, pairs[1].second);
+}
+
+/*
+ * The closest pending message is chosen, not merely the oldest one.
+ */
+TEST_F(TestSynchronizedGroup, picks_closest_candidate) {
+  std::vector<std::pair<int64_t, int64_t>> pairs;
+  rclcpp::SynchronizedGroupOptions options;
+  options.slop = std::chrono::milliseconds(5);
+  rclcpp::SynchronizedGroup<BasicTypes, BasicTypes> group(
+    node, {{"topic_a", "topic_b"}}, rclcpp::QoS(10),
+    [&pairs](std::shared_ptr<const BasicTypes> a, std::shared_ptr<const BasicTypes> b) {
+      pairs.emplace_back(a->int64_value, b->int64_value);
+    },
+    options);
+
+  // Queue two messages on topic_a; the second is the better match for the
+  // message arriving on topic_b and the first is consumed as spent.
+  publish(pub_a, 0);
+  publish(pub_a, 10 * kMillisecond);
+  publish(pub_b, 11 * kMillisecond);
+  ASSERT_EQ(1u, pairs.size());
+  EXPECT_EQ(10 * kMillisecond, pairs[0].first);
+  EXPECT_EQ(11 * kMillisecond, pairs[0].second);
+}
@@ -15,6 +15,7 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <limits>
 #include <memory>
@@ -95,6 +96,28 @@ TEST_F(TestTime, time_sources) {
   EXPECT_NE(0u, steady_now.nanosec);
 }
 
+TEST_F(TestTime, now_tracks_ros_time_override) {
+  rclcpp::Clock ros_clock(RCL_ROS_TIME);
+  rcl_clock_t * rcl_clock = ros_clock.get_clock_handle();
+
+  // Before any override, now() falls back to system time.
+  EXPECT_NE(0, ros_clock.now().nanoseconds());
+
+  // The lock-free fast path must observe override updates no matter which
+  // API performed them, including direct rcl calls on the clock handle.
+  ASSERT_EQ(RCL_RET_OK, rcl_enable_ros_time_override(rcl_clock));
+  ASSERT_EQ(RCL_RET_OK, rcl_set_ros_time_override(rcl_clock, RCUTILS_MS_TO_NS(100)));
+  EXPECT_EQ(RCUTILS_MS_TO_NS(100), ros_clock.now().nanoseconds());
+  ASSERT_EQ(RCL_RET_OK, rcl_set_ros_time_override(rcl_clock, RCUTILS_MS_TO_NS(200)));
+  EXPECT_EQ(RCUTILS_MS_TO_NS(200), ros_clock.now().nanoseconds());
+  // Repeated reads between updates return the same stamp.
+  EXPECT_EQ(ros_clock.now(), ros_clock.now());
+
+  // Disabling the override goes back to system time.
+  ASSERT_EQ(RCL_RET_OK, rcl_disable_ros_time_override(rcl_clock));
+  EXPECT_NE(RCUTILS_MS_TO_NS(200), ros_clock.now().nanoseconds());
+}
+
 static const int64_t HALF_SEC_IN_NS = RCUTILS_MS_TO_NS(500);
 static const int64_t ONE_SEC_IN_NS = RCUTILS_MS_TO_NS(1000);
 static const int64_t ONE_AND_HALF_SEC_IN_NS = 3 * HALF_SEC_IN_NS;
@@ -671,6 +694,47 @@ TEST_F(TestClockSleep, sleep_until_basic_ros) {
   EXPECT_TRUE(sleep_succeeded);
 }
 
+TEST_F(TestClockSleep, sleep_until_ros_selective_wakeup) {
+  rclcpp::Clock clock(RCL_ROS_TIME);
+  rcl_clock_t * rcl_clock = clock.get_clock_handle();
+
+  const rcl_time_point_value_t start_time = 1337;
+  ASSERT_EQ(RCL_RET_OK, rcl_enable_ros_time_override(rcl_clock));
+  ASSERT_EQ(RCL_RET_OK, rcl_set_ros_time_override(rcl_clock, start_time));
+
+  // Two sleepers with different deadlines share the clock's sleeper list.
+  const auto near_until = rclcpp::Time(start_time + 10, RCL_ROS_TIME);
+  const auto far_until = rclcpp::Time(start_time + 1000, RCL_ROS_TIME);
+
+  std::atomic<bool> near_done{false};
+  std::atomic<bool> far_done{false};
+  auto near_thread = std::thread(
+    [&clock, near_until, &near_done]() {
+      EXPECT_TRUE(clock.sleep_until(near_until));
+      near_done = true;
+    });
+  auto far_thread = std::thread(
+    [&clock, far_until, &far_done]() {
+      EXPECT_TRUE(clock.sleep_until(far_until));
+      far_done = true;
+    });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+  EXPECT_FALSE(near_done);
+  EXPECT_FALSE(far_done);
+
+  // Crossing only the near deadline wakes only the near sleeper.
+  ASSERT_EQ(RCL_RET_OK, rcl_set_ros_time_override(rcl_clock, start_time + 10));
+  near_thread.join();
+  EXPECT_TRUE(near_done);
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+  EXPECT_FALSE(far_done);
+
+  ASSERT_EQ(RCL_RET_OK, rcl_set_ros_time_override(rcl_clock, start_time + 1000));
+  far_thread.join();
+  EXPECT_TRUE(far_done);
+}
+
 TEST_F(TestClockSleep, sleep_for_invalid_context) {
   rclcpp::Clock clock(RCL_SYSTEM_TIME);
   auto rel_time = rclcpp::Duration(1, 0u);
@@ -918,3 +982,32 @@ TEST_F(TestClockStarted, started_timeout) {
   EXPECT_FALSE(ros_clock.wait_until_started());
   t.join();
 }
+
+TEST_F(TestTime, unchecked_arithmetic) {
+  rclcpp::Time time(5000, RCL_ROS_TIME);
+  rclcpp::Duration step = rclcpp::Duration::from_nanoseconds(100);
+
+  rclcpp::UncheckedTime cursor = time.unchecked();
+  rclcpp::UncheckedDuration unchecked_step = step.unchecked();
+  for (int i = 0; i < 10; ++i) {
+    cursor += unchecked_step;
+  }
+  EXPECT_EQ(6000, cursor.nanoseconds());
+  EXPECT_EQ(RCL_ROS_TIME, cursor.get_clock_type());
+
+  rclcpp::Time back = cursor.checked();
+  EXPECT_EQ(6000, back.nanoseconds());
+  EXPECT_EQ(RCL_ROS_TIME, back.get_clock_type());
+
+  EXPECT_EQ(1000, (cursor - time.unchecked()).nanoseconds());
+  EXPECT_EQ(5900, (cursor - unchecked_step).nanoseconds());
+  EXPECT_EQ(6100, (unchecked_step + cursor).nanoseconds());
+  EXPECT_TRUE(time.unchecked() < cursor);
+
+  // No clock compatibility checks; overflow wraps like two's complement
+  // arithmetic instead of throwing.
+  rclcpp::UncheckedTime max(std::numeric_limits<rcl_time_point_value_t>::max(), RCL_SYSTEM_TIME);
+  max += rclcpp::UncheckedDuration(1);
+  EXPECT_EQ(std::numeric_limits<rcl_time_point_value_t>::min(), max.nanoseconds());
+  EXPECT_TRUE(cursor != max);
+}
@@ -18,6 +18,7 @@
 #include <chrono>
 #include <exception>
 #include <memory>
+#include <thread>
 #include <utility>
 
 #include "rcl/timer.h"
@@ -364,3 +365,36 @@ TEST_P(TestTimer, test_timer_without_autostart)
     std::chrono::nanoseconds::max().count());
   EXPECT_FALSE(timer_without_autostart->is_canceled());
 }
+
+/// Stats track activation jitter and overruns of the period
+TEST_P(TestTimer, stats_track_jitter_and_overruns)
+{
+  // A timer that never fired reports all-zero statistics.
+  auto initial_stats = timer_without_autostart->get_stats();
+  EXPECT_EQ(0u, initial_stats.callbacks);
+  EXPECT_EQ(0u, initial_stats.callback_duration_ns);
+  EXPECT_EQ(0u, initial_stats.jitter_sum_ns);
+  EXPECT_EQ(0u, initial_stats.jitter_max_ns);
+  EXPECT_EQ(0u, initial_stats.overruns);
+
+  // Every execution of this callback overruns the 1ms period, so from the
+  // second fire onwards the timer is also activated late.
+  size_t executions = 0;
+  auto overrunning_timer = test_node->create_wall_timer(
+    1ms,
+    [this, &executions]() {
+      std::this_thread::sleep_for(3ms);
+      if (++executions >= 2u) {
+        this->executor->cancel();
+      }
+    });
+  executor->spin();
+  ASSERT_GE(executions, 2u);
+
+  auto stats = overrunning_timer->get_stats();
+  EXPECT_EQ(executions, stats.callbacks);
+  EXPECT_GE(stats.callback_duration_ns, executions * std::chrono::nanoseconds(3ms).count());
+  EXPECT_GE(stats.overruns, executions);
+  EXPECT_GT(stats.jitter_max_ns, 0u);
+  EXPECT_GE(stats.jitter_sum_ns, stats.jitter_max_ns);
+}
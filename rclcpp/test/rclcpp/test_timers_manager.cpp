@@ -17,6 +17,7 @@
 #include <chrono>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "rclcpp/contexts/default_context.hpp"
 #include "rclcpp/experimental/timers_manager.hpp"
@@ -417,3 +418,265 @@ TEST_F(TestTimersManager, infinite_loop)
   EXPECT_LT(0u, t1_runs);
   EXPECT_LT(0u, t2_runs);
 }
+
+TEST_F(TestTimersManager, timer_wheel_add_run_remove_timer)
+{
+  size_t t_runs = 0;
+  auto t = TimerT::make_shared(
+    10ms,
+    [&t_runs]() {
+      t_runs++;
+    },
+    rclcpp::contexts::get_global_default_context());
+  std::weak_ptr<TimerT> t_weak = t;
+
+  // Add the timer to a timers manager using the timer wheel storage
+  auto timers_manager = std::make_shared<TimersManager>(
+    rclcpp::contexts::get_global_default_context(),
+    nullptr,
+    std::nullopt,
+    TimersManager::TimersStorage::WHEEL);
+  timers_manager->add_timer(t);
+
+  // Sleep for more 3 times the timer period
+  std::this_thread::sleep_for(30ms);
+
+  // The timer is executed only once, even if we slept 3 times the period
+  execute_all_ready_timers(timers_manager);
+  EXPECT_EQ(1u, t_runs);
+
+  // Remove the timer from the manager
+  timers_manager->remove_timer(t);
+
+  t.reset();
+  // The timer is now not valid anymore
+  EXPECT_FALSE(t_weak.lock() != nullptr);
+}
+
+TEST_F(TestTimersManager, timer_wheel_timers_thread)
+{
+  auto timers_manager = std::make_shared<TimersManager>(
+    rclcpp::contexts::get_global_default_context(),
+    nullptr,
+    std::nullopt,
+    TimersManager::TimersStorage::WHEEL);
+
+  size_t t1_runs = 0;
+  auto t1 = TimerT::make_shared(
+    1ms,
+    [&t1_runs]() {
+      t1_runs++;
+    },
+    rclcpp::contexts::get_global_default_context());
+
+  size_t t2_runs = 0;
+  auto t2 = TimerT::make_shared(
+    20ms,
+    [&t2_runs]() {
+      t2_runs++;
+    },
+    rclcpp::contexts::get_global_default_context());
+
+  // Add timers with different periods, the short one expires many times
+  // while the long one is parked in a farther wheel slot
+  timers_manager->add_timer(t1);
+  timers_manager->add_timer(t2);
+
+  // Run timers thread for a while
+  timers_manager->start();
+  std::this_thread::sleep_for(100ms);
+  timers_manager->stop();
+
+  EXPECT_LT(10u, t1_runs);
+  EXPECT_LT(1u, t2_runs);
+  EXPECT_GT(t1_runs, t2_runs);
+}
+
+TEST_F(TestTimersManager, timer_slack_coalesces_wakeups)
+{
+  // A large slack window relative to the timer periods coalesces the
+  // expirations of both timers into shared wakeups.
+  auto timers_manager = std::make_shared<TimersManager>(
+    rclcpp::contexts::get_global_default_context(),
+    nullptr,
+    std::nullopt,
+    TimersManager::TimersStorage::HEAP,
+    5ms);
+
+  size_t t1_runs = 0;
+  auto t1 = TimerT::make_shared(
+    10ms,
+    [&t1_runs]() {
+      t1_runs++;
+    },
+    rclcpp::contexts::get_global_default_context());
+
+  size_t t2_runs = 0;
+  auto t2 = TimerT::make_shared(
+    12ms,
+    [&t2_runs]() {
+      t2_runs++;
+    },
+    rclcpp::contexts::get_global_default_context());
+
+  timers_manager->add_timer(t1);
+  timers_manager->add_timer(t2);
+
+  // Run timers thread for a while
+  timers_manager->start();
+  std::this_thread::sleep_for(100ms);
+  timers_manager->stop();
+
+  // Both timers keep running; they may fire up to the slack later than their
+  // deadline, so only a conservative lower bound can be asserted.
+  EXPECT_LT(3u, t1_runs);
+  EXPECT_LT(3u, t2_runs);
+}
+
+TEST_F(TestTimersManager, exchange_period_reschedules_in_place)
+{
+  auto timers_manager = std::make_shared<TimersManager>(
+    rclcpp::contexts::get_global_default_context());
+
+  size_t t_runs = 0;
+  auto t = TimerT::make_shared(
+    10s,
+    [&t_runs]() {
+      t_runs++;
+    },
+    rclcpp::contexts::get_global_default_context());
+
+  timers_manager->add_timer(t);
+  timers_manager->start();
+
+  // The timers thread is parked waiting for the long deadline; retuning the
+  // period in place must wake it up and reorder the schedule lazily.
+  auto old_period = t->exchange_period(1ms);
+  EXPECT_EQ(10s, old_period);
+
+  std::this_thread::sleep_for(50ms);
+  timers_manager->stop();
+
+  EXPECT_LT(5u, t_runs);
+  EXPECT_EQ(1ms, t->exchange_period(1ms));
+}
+
+TEST_F(TestTimersManager, sharded_construction_validation)
+{
+  auto context = rclcpp::contexts::get_global_default_context();
+
+  // Zero timer threads is meaningless.
+  EXPECT_THROW(
+    TimersManager(
+      context, nullptr, std::nullopt, TimersManager::TimersStorage::HEAP, 0ns, 0),
+    std::invalid_argument);
+
+  // With N threads there must be exactly N-1 period boundaries.
+  EXPECT_THROW(
+    TimersManager(
+      context, nullptr, std::nullopt, TimersManager::TimersStorage::HEAP, 0ns, 3,
+      std::vector<std::chrono::nanoseconds>{50ms}),
+    std::invalid_argument);
+
+  // Boundaries must be sorted in ascending order.
+  EXPECT_THROW(
+    TimersManager(
+      context, nullptr, std::nullopt, TimersManager::TimersStorage::HEAP, 0ns, 3,
+      std::vector<std::chrono::nanoseconds>{50ms, 10ms}),
+    std::invalid_argument);
+}
+
+TEST_F(TestTimersManager, sharded_timers_threads)
+{
+  // Two shards split at 50ms: timers faster than that get their own thread,
+  // so a slow timer with a long-running callback can't starve a fast one.
+  auto timers_manager = std::make_shared<TimersManager>(
+    rclcpp::contexts::get_global_default_context(),
+    nullptr,
+    std::nullopt,
+    TimersManager::TimersStorage::HEAP,
+    0ns,
+    2,
+    std::vector<std::chrono::nanoseconds>{50ms});
+
+  size_t fast_runs = 0;
+  auto fast = TimerT::make_shared(
+    10ms,
+    [&fast_runs]() {
+      fast_runs++;
+    },
+    rclcpp::contexts::get_global_default_context());
+
+  size_t slow_runs = 0;
+  auto slow = TimerT::make_shared(
+    60ms,
+    [&slow_runs]() {
+      // Blocks its shard for longer than several fast timer periods.
+      std::this_thread::sleep_for(60ms);
+      slow_runs++;
+    },
+    rclcpp::contexts::get_global_default_context());
+
+  timers_manager->add_timer(fast);
+  timers_manager->add_timer(slow);
+
+  timers_manager->start();
+  std::this_thread::sleep_for(300ms);
+  timers_manager->stop();
+
+  // On a single shared thread the slow callback would cap the fast timer
+  // well below its nominal rate of ~30 runs over the window.
+  EXPECT_LT(15u, fast_runs);
+  EXPECT_LT(0u, slow_runs);
+
+  timers_manager->remove_timer(fast);
+  timers_manager->remove_timer(slow);
+  EXPECT_EQ(0u, timers_manager->get_number_ready_timers());
+}
+
+TEST_F(TestTimersManager, sharded_round_robin_manual_execution)
+{
+  // Without boundaries timers are spread round-robin; the manual execution
+  // APIs must still route to the shard owning each timer.
+  auto timers_manager = std::make_shared<TimersManager>(
+    rclcpp::contexts::get_global_default_context(),
+    nullptr,
+    std::nullopt,
+    TimersManager::TimersStorage::HEAP,
+    0ns,
+    2);
+
+  size_t t1_runs = 0;
+  auto t1 = TimerT::make_shared(
+    1ms,
+    [&t1_runs]() {
+      t1_runs++;
+    },
+    rclcpp::contexts::get_global_default_context());
+
+  size_t t2_runs = 0;
+  auto t2 = TimerT::make_shared(
+    1ms,
+    [&t2_runs]() {
+      t2_runs++;
+    },
+    rclcpp::contexts::get_global_default_context());
+
+  timers_manager->add_timer(t1);
+  timers_manager->add_timer(t2);
+
+  std::this_thread::sleep_for(5ms);
+  EXPECT_EQ(2u, timers_manager->get_number_ready_timers());
+
+  timers_manager->execute_ready_timer(t1->get_timer_handle().get());
+  timers_manager->execute_ready_timer(t2->get_timer_handle().get());
+  EXPECT_EQ(1u, t1_runs);
+  EXPECT_EQ(1u, t2_runs);
+
+  std::this_thread::sleep_for(5ms);
+  timers_manager->execute_head_timer();
+  EXPECT_EQ(3u, t1_runs + t2_runs);
+
+  timers_manager->clear();
+  EXPECT_EQ(0u, timers_manager->get_number_ready_timers());
+}
@@ -0,0 +1,56 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <unordered_set>
+
+#include "rclcpp/topic_name.hpp"
+
+TEST(TestTopicName, equal_strings_share_one_record) {
+  rclcpp::TopicName first("/chatter");
+  rclcpp::TopicName second("/chatter");
+  rclcpp::TopicName other("/other_chatter");
+
+  EXPECT_EQ(first, second);
+  EXPECT_NE(first, other);
+  // Interned: equal names resolve to the same storage.
+  EXPECT_EQ(first.str().c_str(), second.str().c_str());
+  EXPECT_EQ(first.hash(), second.hash());
+  EXPECT_EQ("/chatter", first.str());
+  EXPECT_STREQ("/chatter", first.c_str());
+}
+
+TEST(TestTopicName, empty_names_compare_equal) {
+  rclcpp::TopicName empty;
+  rclcpp::TopicName also_empty;
+  rclcpp::TopicName named("/chatter");
+
+  EXPECT_TRUE(empty.empty());
+  EXPECT_FALSE(named.empty());
+  EXPECT_EQ(empty, also_empty);
+  EXPECT_NE(empty, named);
+  EXPECT_EQ("", empty.str());
+}
+
+TEST(TestTopicName, usable_as_hash_key) {
+  std::unordered_set<rclcpp::TopicName> names;
+  names.insert(rclcpp::TopicName("/a"));
+  names.insert(rclcpp::TopicName("/a"));
+  names.insert(rclcpp::TopicName("/b"));
+
+  EXPECT_EQ(2u, names.size());
+  EXPECT_EQ(1u, names.count(rclcpp::TopicName("/a")));
+}
@@ -61,6 +61,36 @@ TEST(TypesupportHelpersTest, returns_c_type_info_for_valid_legacy_library) {
   }
 }
 
+TEST(TypesupportHelpersTest, cached_library_and_handle_are_reused) {
+  auto first_library = rclcpp::get_cached_typesupport_library(
+    "test_msgs/msg/BasicTypes", "rosidl_typesupport_cpp");
+  auto second_library = rclcpp::get_cached_typesupport_library(
+    "test_msgs/msg/BasicTypes", "rosidl_typesupport_cpp");
+  EXPECT_EQ(first_library.get(), second_library.get());
+
+  auto first_handle = rclcpp::get_cached_typesupport_handle(
+    "test_msgs/msg/BasicTypes", "rosidl_typesupport_cpp");
+  auto second_handle = rclcpp::get_cached_typesupport_handle(
+    "test_msgs/msg/BasicTypes", "rosidl_typesupport_cpp");
+  EXPECT_EQ(first_handle, second_handle);
+  EXPECT_THAT(
+    std::string(first_handle->typesupport_identifier),
+    ContainsRegex("rosidl_typesupport"));
+}
+
+TEST(TypesupportHelpersTest, cached_lookup_failures_keep_throwing) {
+  EXPECT_THROW(
+    rclcpp::get_cached_typesupport_handle("invalid/message", "rosidl_typesupport_cpp"),
+    std::runtime_error);
+  // The negative result is cached; the second attempt must fail the same way.
+  EXPECT_THROW(
+    rclcpp::get_cached_typesupport_handle("invalid/message", "rosidl_typesupport_cpp"),
+    std::runtime_error);
+  EXPECT_THROW(
+    rclcpp::get_cached_typesupport_library("invalid/message", "rosidl_typesupport_cpp"),
+    std::runtime_error);
+}
+
 TEST(TypesupportHelpersTest, returns_c_type_info_for_valid_library) {
   try {
     auto library = rclcpp::get_typesupport_library(
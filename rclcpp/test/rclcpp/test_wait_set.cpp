@@ -359,3 +359,139 @@ TEST_F(TestWaitSet, get_result_from_wait_result_not_ready_error) {
     const_result.get_wait_set(),
     std::runtime_error("cannot access wait set when the result was not ready"));
 }
+
+/*
+ * Reuse one WaitResult across several waits with wait_into.
+ */
+TEST_F(TestWaitSet, wait_into_reuses_result) {
+  rclcpp::WaitSet wait_set;
+  auto guard_condition = std::make_shared<rclcpp::GuardCondition>();
+  wait_set.add_guard_condition(guard_condition);
+
+  // A default-constructed result is inactive and behaves like a timeout.
+  rclcpp::WaitSet::ResultT result;
+  EXPECT_EQ(rclcpp::WaitResultKind::Timeout, result.kind());
+
+  guard_condition->trigger();
+  EXPECT_EQ(rclcpp::WaitResultKind::Ready, wait_set.wait_into(result, std::chrono::seconds(1)));
+  ASSERT_EQ(rclcpp::WaitResultKind::Ready, result.kind());
+  EXPECT_EQ(&wait_set, &result.get_wait_set());
+
+  // Waiting again with the same result, still holding from the last cycle,
+  // releases it first instead of throwing.
+  EXPECT_EQ(
+    rclcpp::WaitResultKind::Timeout,
+    wait_set.wait_into(result, std::chrono::milliseconds(10)));
+  EXPECT_EQ(rclcpp::WaitResultKind::Timeout, result.kind());
+
+  // A third cycle works as well.
+  guard_condition->trigger();
+  EXPECT_EQ(rclcpp::WaitResultKind::Ready, wait_set.wait_into(result, std::chrono::seconds(1)));
+
+  // An explicit reset releases the hold, so a plain wait() can follow.
+  result.reset();
+  EXPECT_EQ(rclcpp::WaitResultKind::Timeout, result.kind());
+  EXPECT_EQ(
+    rclcpp::WaitResultKind::Timeout,
+    wait_set.wait(std::chrono::milliseconds(10)).kind());
+}
+
+/*
+ * Collect the ready entities of a wait into reusable index lists.
+ */
+TEST_F(TestWaitSet, collect_ready_entities) {
+  rclcpp::WaitSet wait_set;
+  auto gc0 = std::make_shared<rclcpp::GuardCondition>();
+  auto gc1 = std::make_shared<rclcpp::GuardCondition>();
+  auto gc2 = std::make_shared<rclcpp::GuardCondition>();
+  wait_set.add_guard_condition(gc0);
+  wait_set.add_guard_condition(gc1);
+  wait_set.add_guard_condition(gc2);
+
+  gc0->trigger();
+  gc2->trigger();
+  rclcpp::WaitResult<rclcpp::WaitSet> result = wait_set.wait(std::chrono::seconds(1));
+  ASSERT_EQ(rclcpp::WaitResultKind::Ready, result.kind());
+
+  rclcpp::ReadyEntityIndexes ready;
+  result.collect_ready_entities(ready);
+  ASSERT_EQ(2u, ready.guard_conditions.size());
+  EXPECT_EQ(0u, ready.guard_conditions[0]);
+  EXPECT_EQ(2u, ready.guard_conditions[1]);
+  EXPECT_TRUE(ready.subscriptions.empty());
+  EXPECT_TRUE(ready.timers.empty());
+
+  // With priorities the highest-priority ready entity comes first; the
+  // untriggered gc1 stays absent regardless of its priority.
+  rclcpp::ReadyEntityPriorities priorities;
+  priorities.guard_conditions = {1, 10, 5};
+  result.collect_ready_entities(ready, priorities);
+  ASSERT_EQ(2u, ready.guard_conditions.size());
+  EXPECT_EQ(2u, ready.guard_conditions[0]);
+  EXPECT_EQ(0u, ready.guard_conditions[1]);
+}
+
+/*
+ * Collecting from a result that is not ready throws.
+ */
+TEST_F(TestWaitSet, collect_ready_entities_not_ready_error) {
+  rclcpp::WaitSet wait_set;
+  auto guard_condition = std::make_shared<rclcpp::GuardCondition>();
+  wait_set.add_guard_condition(guard_condition);
+
+  rclcpp::WaitResult<rclcpp::WaitSet> result = wait_set.wait(std::chrono::milliseconds(10));
+  ASSERT_EQ(rclcpp::WaitResultKind::Timeout, result.kind());
+  rclcpp::ReadyEntityIndexes ready;
+  RCLCPP_EXPECT_THROW_EQ(
+    result.collect_ready_entities(ready),
+    std::runtime_error("cannot access wait set when the result was not ready"));
+}
+
+/*
+ * Visit ready entities together with the tags given when they were added.
+ */
+TEST_F(TestWaitSet, for_each_ready_with_tags) {
+  rclcpp::WaitSet wait_set;
+  auto gc0 = std::make_shared<rclcpp::GuardCondition>();
+  auto gc1 = std::make_shared<rclcpp::GuardCondition>();
+  auto gc2 = std::make_shared<rclcpp::GuardCondition>();
+  int tag0 = 0;
+  int tag2 = 0;
+  wait_set.add_guard_condition(gc0, &tag0);
+  wait_set.add_guard_condition(gc1);  // no tag
+  wait_set.add_guard_condition(gc2, &tag2);
+
+  gc0->trigger();
+  gc1->trigger();
+  rclcpp::WaitResult<rclcpp::WaitSet> result = wait_set.wait(std::chrono::seconds(1));
+  ASSERT_EQ(rclcpp::WaitResultKind::Ready, result.kind());
+
+  std::vector<std::pair<const rclcpp::GuardCondition *, const void *>> visited;
+  rclcpp::ReadyEntityVisitors visitors;
+  visitors.guard_condition = [&visited](rclcpp::GuardCondition & gc, const void * tag) {
+      visited.emplace_back(&gc, tag);
+    };
+  result.for_each_ready(visitors);
+
+  // Only the triggered guard conditions are visited, in add order, and the
+  // untagged one reports a nullptr tag.
+  ASSERT_EQ(2u, visited.size());
+  EXPECT_EQ(gc0.get(), visited[0].first);
+  EXPECT_EQ(&tag0, visited[0].second);
+  EXPECT_EQ(gc1.get(), visited[1].first);
+  EXPECT_EQ(nullptr, visited[1].second);
+
+  // After removal the tag is forgotten; re-adding without a tag and
+  // triggering again yields nullptr for the formerly tagged entity.
+  result.reset();
+  wait_set.remove_guard_condition(gc0);
+  wait_set.add_guard_condition(gc0);
+  gc0->trigger();
+  result = wait_set.wait(std::chrono::seconds(1));
+  ASSERT_EQ(rclcpp::WaitResultKind::Ready, result.kind());
+  visited.clear();
+  result.for_each_ready(visitors);
+  ASSERT_EQ(1u, visited.size());
+  EXPECT_EQ(gc0.get(), visited[0].first);
+  EXPECT_EQ(nullptr, visited[0].second);
+}
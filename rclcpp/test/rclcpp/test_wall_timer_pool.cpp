@@ -0,0 +1,133 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+
+#include "rclcpp/executors/single_threaded_executor.hpp"
+#include "rclcpp/rclcpp.hpp"
+#include "rclcpp/wall_timer_pool.hpp"
+
+using namespace std::chrono_literals;
+
+class TestWallTimerPool : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    rclcpp::init(0, nullptr);
+    node = std::make_shared<rclcpp::Node>("test_wall_timer_pool_node");
+    executor = std::make_shared<rclcpp::executors::SingleThreadedExecutor>();
+    executor->add_node(node);
+    pool = rclcpp::WallTimerPool::make_shared(node);
+  }
+
+  void TearDown() override
+  {
+    pool.reset();
+    executor.reset();
+    node.reset();
+    rclcpp::shutdown();
+  }
+
+  rclcpp::Node::SharedPtr node;
+  rclcpp::executors::SingleThreadedExecutor::SharedPtr executor;
+  rclcpp::WallTimerPool::SharedPtr pool;
+};
+
+TEST_F(TestWallTimerPool, bad_arguments) {
+  EXPECT_THROW(pool->call_later(0ns, []() {}), std::invalid_argument);
+  EXPECT_THROW(pool->call_later(-1ms, []() {}), std::invalid_argument);
+  EXPECT_THROW(pool->call_later(1ms, nullptr), std::invalid_argument);
+  EXPECT_THROW(
+    rclcpp::WallTimerPool(nullptr, node->get_node_timers_interface()),
+    std::invalid_argument);
+  EXPECT_THROW(
+    rclcpp::WallTimerPool(node->get_node_base_interface(), nullptr),
+    std::invalid_argument);
+}
+
+TEST_F(TestWallTimerPool, fires_once_and_recycles) {
+  size_t call_count = 0;
+  auto timer = pool->call_later(
+    1ms,
+    [this, &call_count]() {
+      call_count++;
+      executor->cancel();
+    });
+  ASSERT_NE(nullptr, timer);
+  EXPECT_EQ(1u, pool->size());
+  EXPECT_EQ(0u, pool->idle_count());
+
+  executor->spin();
+  EXPECT_EQ(1u, call_count);
+  // The timer fired once, canceled itself, and returned to the pool.
+  EXPECT_TRUE(timer->is_canceled());
+  EXPECT_EQ(1u, pool->idle_count());
+
+  // Spinning some more must not fire it again.
+  executor->spin_all(50ms);
+  EXPECT_EQ(1u, call_count);
+
+  // The next one-shot timer reuses the pooled timer instead of allocating.
+  auto second_timer = pool->call_later(
+    1ms,
+    [this, &call_count]() {
+      call_count++;
+      executor->cancel();
+    });
+  EXPECT_EQ(timer, second_timer);
+  EXPECT_EQ(1u, pool->size());
+  EXPECT_EQ(0u, pool->idle_count());
+
+  executor->spin();
+  EXPECT_EQ(2u, call_count);
+  EXPECT_EQ(1u, pool->idle_count());
+}
+
+TEST_F(TestWallTimerPool, cancel_returns_to_pool) {
+  size_t call_count = 0;
+  auto timer = pool->call_later(10s, [&call_count]() {call_count++;});
+  EXPECT_EQ(0u, pool->idle_count());
+
+  pool->cancel(timer);
+  EXPECT_TRUE(timer->is_canceled());
+  EXPECT_EQ(1u, pool->idle_count());
+  // Canceling again is a no-op.
+  pool->cancel(timer);
+  EXPECT_EQ(1u, pool->idle_count());
+
+  executor->spin_all(50ms);
+  EXPECT_EQ(0u, call_count);
+
+  // A timer that did not come from this pool is ignored.
+  auto foreign_timer = node->create_wall_timer(10s, []() {});
+  pool->cancel(foreign_timer);
+  EXPECT_EQ(1u, pool->idle_count());
+}
+
+TEST_F(TestWallTimerPool, grows_when_busy) {
+  auto first = pool->call_later(10s, []() {});
+  auto second = pool->call_later(10s, []() {});
+  EXPECT_NE(first, second);
+  EXPECT_EQ(2u, pool->size());
+  EXPECT_EQ(0u, pool->idle_count());
+
+  pool->cancel(first);
+  pool->cancel(second);
+  EXPECT_EQ(2u, pool->idle_count());
+}
@@ -33,6 +33,7 @@
 #include "rclcpp/rclcpp.hpp"
 #include "rclcpp/subscription_options.hpp"
 
+#include "rclcpp/topic_statistics/aggregated_topic_statistics.hpp"
 #include "rclcpp/topic_statistics/subscription_topic_statistics.hpp"
 
 #include "statistics_msgs/msg/metrics_message.hpp"
@@ -85,8 +86,17 @@ class TestSubscriptionTopicStatistics : public SubscriptionTopicStatistics<Callb
 public:
   TestSubscriptionTopicStatistics(
     const std::string & node_name,
-    rclcpp::Publisher<statistics_msgs::msg::MetricsMessage>::SharedPtr publisher)
-  : SubscriptionTopicStatistics<CallbackMessageT>(node_name, publisher)
+    rclcpp::Publisher<statistics_msgs::msg::MetricsMessage>::SharedPtr publisher,
+    uint64_t sample_rate = 1)
+  : SubscriptionTopicStatistics<CallbackMessageT>(node_name, publisher, sample_rate)
+  {
+  }
+
+  TestSubscriptionTopicStatistics(
+    const std::string & node_name,
+    std::shared_ptr<rclcpp::topic_statistics::AggregatedTopicStatisticsSink> sink,
+    uint64_t sample_rate = 1)
+  : SubscriptionTopicStatistics<CallbackMessageT>(node_name, sink, sample_rate)
   {
   }
 
@@ -586,3 +596,117 @@ TEST_F(TestSubscriptionTopicStatisticsFixture, test_receive_stats_include_window
     }
   }
 }
+
+/**
+ * Test an invalid argument is thrown for a bad input sample rate.
+ */
+TEST(TestSubscriptionTopicStatistics, test_invalid_sample_rate)
+{
+  rclcpp::init(0 /* argc */, nullptr /* argv */);
+
+  auto node = std::make_shared<rclcpp::Node>("test_sample_rate_node");
+
+  auto options = rclcpp::SubscriptionOptions();
+  options.topic_stats_options.state = rclcpp::TopicStatisticsState::Enable;
+  options.topic_stats_options.sample_rate = 0;
+
+  auto callback = [](Empty::UniquePtr msg) {
+      (void) msg;
+    };
+
+  ASSERT_THROW(
+    (node->create_subscription<Empty, std::function<void(Empty::UniquePtr)>>(
+      "should_throw_invalid_arg",
+      rclcpp::QoS(rclcpp::KeepAll()),
+      callback,
+      options)), std::invalid_argument);
+
+  rclcpp::shutdown();
+}
+
+/**
+ * Test that only one out of every sample_rate handled messages is measured.
+ */
+TEST_F(TestSubscriptionTopicStatisticsFixture, test_sample_rate_reduces_measurements)
+{
+  auto empty_subscriber = std::make_shared<EmptySubscriber>(
+    kTestSubNodeName,
+    kTestSubStatsEmptyTopic);
+
+  // Manually create publisher tied to the node
+  auto topic_stats_publisher =
+    empty_subscriber->create_publisher<MetricsMessage>(
+    kTestTopicStatisticsTopic,
+    10);
+
+  auto sub_topic_stats = std::make_unique<TestSubscriptionTopicStatistics<Empty>>(
+    empty_subscriber->get_name(),
+    topic_stats_publisher,
+    2 /* sample_rate */);
+
+  Empty msg;
+  for (int i = 0; i < 6; ++i) {
+    sub_topic_stats->handle_message(msg, rclcpp::Time(i * 1000000));
+  }
+
+  // 3 of the 6 messages are sampled; the period collector measures the 2
+  // intervals between them, and the age collector has no header to measure.
+  uint64_t total_samples = 0;
+  for (const auto & data : sub_topic_stats->get_current_collector_data()) {
+    total_samples += data.sample_count;
+  }
+  EXPECT_EQ(2u, total_samples);
+}
+
+/**
+ * Test that an aggregated sink drains every registered source in one batch.
+ */
+TEST_F(TestSubscriptionTopicStatisticsFixture, test_aggregated_sink_drains_sources)
+{
+  auto empty_subscriber = std::make_shared<EmptySubscriber>(
+    kTestSubNodeName,
+    kTestSubStatsEmptyTopic);
+
+  // Manually create publisher tied to the node
+  auto topic_stats_publisher =
+    empty_subscriber->create_publisher<MetricsMessage>(
+    kTestTopicStatisticsTopic,
+    10);
+
+  // Invalid construction throws
+  EXPECT_THROW(
+    rclcpp::topic_statistics::AggregatedTopicStatisticsSink(nullptr),
+    std::invalid_argument);
+  EXPECT_THROW(
+    TestSubscriptionTopicStatistics<Empty>(
+      empty_subscriber->get_name(),
+      std::shared_ptr<rclcpp::topic_statistics::AggregatedTopicStatisticsSink>(nullptr)),
+    std::invalid_argument);
+
+  auto sink = std::make_shared<rclcpp::topic_statistics::AggregatedTopicStatisticsSink>(
+    topic_stats_publisher);
+
+  auto first_stats = std::make_shared<TestSubscriptionTopicStatistics<Empty>>(
+    empty_subscriber->get_name(),
+    sink);
+  auto second_stats = std::make_shared<TestSubscriptionTopicStatistics<Empty>>(
+    empty_subscriber->get_name(),
+    sink);
+  sink->add_source(first_stats);
+  sink->add_source(second_stats);
+
+  Empty msg;
+  for (int i = 0; i < 3; ++i) {
+    first_stats->handle_message(msg, rclcpp::Time(i * 1000000));
+    second_stats->handle_message(msg, rclcpp::Time(i * 1000000));
+  }
+
+  // One batch collects and resets the measurements of every source
+  sink->publish_batch();
+
+  for (const auto & stats : {first_stats, second_stats}) {
+    for (const auto & data : stats->get_current_collector_data()) {
+      EXPECT_EQ(kNoSamples, data.sample_count);
+    }
+  }
+}
@@ -0,0 +1,134 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "rclcpp/rclcpp.hpp"
+#include "rclcpp/wait_set.hpp"
+
+#include "test_msgs/msg/empty.hpp"
+#include "test_msgs/srv/empty.hpp"
+
+class TestEventNotifySynchronization : public ::testing::Test
+{
+public:
+  static void SetUpTestCase()
+  {
+    rclcpp::init(0, nullptr);
+  }
+
+  static void TearDownTestCase()
+  {
+    rclcpp::shutdown();
+  }
+
+  void SetUp()
+  {
+    node = std::make_shared<rclcpp::Node>("node", "ns");
+  }
+
+  std::shared_ptr<rclcpp::Node> node;
+};
+
+TEST_F(TestEventNotifySynchronization, default_construct_destruct) {
+  rclcpp::EventNotifyWaitSet wait_set;
+  EXPECT_TRUE(rcl_wait_set_is_valid(&wait_set.get_rcl_wait_set()));
+
+  // Nothing is added, so nothing can ever fire a listener
+  EXPECT_EQ(rclcpp::WaitResultKind::Empty, wait_set.wait(std::chrono::milliseconds(10)).kind());
+}
+
+TEST_F(TestEventNotifySynchronization, guard_condition_wakes_wait) {
+  rclcpp::EventNotifyWaitSet wait_set;
+  auto guard_condition = std::make_shared<rclcpp::GuardCondition>();
+  wait_set.add_guard_condition(guard_condition);
+
+  // An untriggered guard condition should leave the wait blocked until timeout
+  EXPECT_EQ(rclcpp::WaitResultKind::Timeout, wait_set.wait(std::chrono::milliseconds(10)).kind());
+
+  // Triggering from another thread wakes the wait through the listener
+  std::thread trigger_thread(
+    [&guard_condition]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+      guard_condition->trigger();
+    });
+  EXPECT_EQ(rclcpp::WaitResultKind::Ready, wait_set.wait(std::chrono::seconds(10)).kind());
+  trigger_thread.join();
+
+  // A trigger that happened before the wait is not lost
+  guard_condition->trigger();
+  EXPECT_EQ(rclcpp::WaitResultKind::Ready, wait_set.wait(std::chrono::seconds(10)).kind());
+
+  wait_set.remove_guard_condition(guard_condition);
+}
+
+TEST_F(TestEventNotifySynchronization, timer_bounds_wait) {
+  rclcpp::EventNotifyWaitSet wait_set;
+  // Timers have no readiness listener, the wait is bounded by their deadline
+  auto timer = node->create_wall_timer(std::chrono::milliseconds(100), []() {});
+  wait_set.add_timer(timer);
+
+  auto result = wait_set.wait(std::chrono::seconds(10));
+  ASSERT_EQ(rclcpp::WaitResultKind::Ready, result.kind());
+  const auto & rcl_wait_set = result.get_wait_set().get_rcl_wait_set();
+  ASSERT_EQ(1u, rcl_wait_set.size_of_timers);
+  EXPECT_NE(nullptr, rcl_wait_set.timers[0]);
+
+  wait_set.remove_timer(timer);
+}
+
+TEST_F(TestEventNotifySynchronization, add_remove_entities) {
+  rclcpp::EventNotifyWaitSet wait_set;
+
+  auto subscription = node->create_subscription<test_msgs::msg::Empty>(
+    "~/topic", 10, [](test_msgs::msg::Empty::ConstSharedPtr) {});
+  wait_set.add_subscription(subscription);
+
+  auto client = node->create_client<test_msgs::srv::Empty>("~/service");
+  wait_set.add_client(client);
+
+  auto service = node->create_service<test_msgs::srv::Empty>(
+    "~/service",
+    [](
+      const test_msgs::srv::Empty::Request::SharedPtr,
+      test_msgs::srv::Empty::Response::SharedPtr) {});
+  wait_set.add_service(service);
+
+  wait_set.remove_service(service);
+  wait_set.remove_client(client);
+  wait_set.remove_subscription(subscription);
+
+  // Removal cleared the listeners, so re-adding can register them again
+  wait_set.add_subscription(subscription);
+}
+
+TEST_F(TestEventNotifySynchronization, message_wakes_wait) {
+  rclcpp::EventNotifyWaitSet wait_set;
+  auto subscription = node->create_subscription<test_msgs::msg::Empty>(
+    "~/topic", 10, [](test_msgs::msg::Empty::ConstSharedPtr) {});
+  wait_set.add_subscription(subscription);
+
+  auto publisher = node->create_publisher<test_msgs::msg::Empty>("~/topic", 10);
+  std::thread publish_thread(
+    [&publisher]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+      publisher->publish(test_msgs::msg::Empty());
+    });
+  EXPECT_EQ(rclcpp::WaitResultKind::Ready, wait_set.wait(std::chrono::seconds(10)).kind());
+  publish_thread.join();
+}
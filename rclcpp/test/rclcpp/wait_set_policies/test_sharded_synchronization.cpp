@@ -0,0 +1,110 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "rclcpp/rclcpp.hpp"
+#include "rclcpp/wait_set.hpp"
+
+#include "test_msgs/msg/empty.hpp"
+#include "test_msgs/srv/empty.hpp"
+
+class TestShardedSynchronization : public ::testing::Test
+{
+public:
+  static void SetUpTestCase()
+  {
+    rclcpp::init(0, nullptr);
+  }
+
+  static void TearDownTestCase()
+  {
+    rclcpp::shutdown();
+  }
+
+  void SetUp()
+  {
+    node = std::make_shared<rclcpp::Node>("node", "ns");
+  }
+
+  std::shared_ptr<rclcpp::Node> node;
+};
+
+TEST_F(TestShardedSynchronization, default_construct_destruct) {
+  rclcpp::ConcurrentWaitSet wait_set;
+  EXPECT_TRUE(rcl_wait_set_is_valid(&wait_set.get_rcl_wait_set()));
+
+  // Expected behavior of thread-safe like wait sets is to timeout here
+  EXPECT_EQ(rclcpp::WaitResultKind::Timeout, wait_set.wait(std::chrono::milliseconds(10)).kind());
+}
+
+TEST_F(TestShardedSynchronization, add_entities_and_wait) {
+  rclcpp::ConcurrentWaitSet wait_set;
+
+  auto subscription = node->create_subscription<test_msgs::msg::Empty>(
+    "~/topic", 10, [](test_msgs::msg::Empty::ConstSharedPtr) {});
+  wait_set.add_subscription(subscription);
+
+  auto timer = node->create_wall_timer(std::chrono::seconds(100), []() {});
+  wait_set.add_timer(timer);
+
+  auto guard_condition = std::make_shared<rclcpp::GuardCondition>();
+  wait_set.add_guard_condition(guard_condition);
+
+  guard_condition->trigger();
+  EXPECT_EQ(rclcpp::WaitResultKind::Ready, wait_set.wait(std::chrono::seconds(10)).kind());
+
+  wait_set.remove_guard_condition(guard_condition);
+  wait_set.remove_timer(timer);
+  wait_set.remove_subscription(subscription);
+}
+
+TEST_F(TestShardedSynchronization, add_guard_condition_while_waiting) {
+  rclcpp::ConcurrentWaitSet wait_set;
+  // A pre-added entity keeps the wait set from returning Empty
+  auto timer = node->create_wall_timer(std::chrono::seconds(100), []() {});
+  wait_set.add_timer(timer);
+
+  auto guard_condition = std::make_shared<rclcpp::GuardCondition>();
+  std::thread add_thread(
+    [&wait_set, &guard_condition]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+      // Interrupts the blocking wait, which then picks up the new entity
+      wait_set.add_guard_condition(guard_condition);
+      guard_condition->trigger();
+    });
+  EXPECT_EQ(rclcpp::WaitResultKind::Ready, wait_set.wait(std::chrono::seconds(10)).kind());
+  add_thread.join();
+}
+
+TEST_F(TestShardedSynchronization, registration_does_not_stall_behind_wait_result) {
+  rclcpp::ConcurrentWaitSet wait_set;
+  auto guard_condition = std::make_shared<rclcpp::GuardCondition>();
+  wait_set.add_guard_condition(guard_condition);
+
+  guard_condition->trigger();
+  auto result = wait_set.wait(std::chrono::seconds(10));
+  ASSERT_EQ(rclcpp::WaitResultKind::Ready, result.kind());
+
+  // With the single-reader lock of ThreadSafeWaitSet this would deadlock,
+  // since the held WaitResult blocks any add; here only the rcl wait set is
+  // held, so registration proceeds.
+  auto timer = node->create_wall_timer(std::chrono::seconds(100), []() {});
+  wait_set.add_timer(timer);
+  wait_set.remove_timer(timer);
+}
@@ -194,6 +194,37 @@ TEST_F(TestStaticStorage, wait_client_service) {
   }
 }
 
+TEST_F(TestStaticStorage, repeated_waits_use_cached_handles) {
+  auto publisher = node->create_publisher<test_msgs::msg::Empty>("topic", 10);
+  auto subscription = node->create_subscription<test_msgs::msg::Empty>(
+    "topic", 10, [](test_msgs::msg::Empty::ConstSharedPtr) {});
+  auto guard_condition = std::make_shared<rclcpp::GuardCondition>();
+  rclcpp::StaticWaitSet<1, 1, 0, 0, 0, 0> wait_set({{{subscription}}}, {guard_condition});
+
+  // Each wait refills the rcl wait set from the handles cached at
+  // construction; alternate readiness sources across several waits to make
+  // sure the refill keeps every entity registered.
+  for (int i = 0; i < 3; ++i) {
+    {
+      auto wait_result = wait_set.wait(std::chrono::milliseconds(10));
+      EXPECT_EQ(rclcpp::WaitResultKind::Timeout, wait_result.kind());
+    }
+    guard_condition->trigger();
+    {
+      auto wait_result = wait_set.wait(std::chrono::seconds(-1));
+      EXPECT_EQ(rclcpp::WaitResultKind::Ready, wait_result.kind());
+    }
+    publisher->publish(test_msgs::msg::Empty());
+    {
+      auto wait_result = wait_set.wait(std::chrono::seconds(-1));
+      ASSERT_EQ(rclcpp::WaitResultKind::Ready, wait_result.kind());
+    }
+    test_msgs::msg::Empty message;
+    rclcpp::MessageInfo message_info;
+    EXPECT_TRUE(subscription->take(message, message_info));
+  }
+}
+
 TEST_F(TestStaticStorage, wait_waitable) {
   auto waitable = std::make_shared<TestWaitable>();
   rclcpp::StaticWaitSet<0, 0, 0, 0, 0, 1> wait_set({}, {}, {}, {}, {}, {{{waitable}}});
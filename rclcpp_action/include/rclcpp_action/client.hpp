@@ -19,6 +19,7 @@
 #include <chrono>
 #include <functional>
 #include <future>
+#include <list>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -46,6 +47,18 @@
 #include "rclcpp_action/visibility_control.hpp"
 
 
+namespace rclcpp
+{
+namespace experimental
+{
+/**
+ * IntraProcessManager is forward declared here, avoiding an rclcpp_action
+ * header dependency on `rclcpp/experimental/intra_process_manager.hpp`.
+ */
+class IntraProcessManager;
+}  // namespace experimental
+}  // namespace rclcpp
+
 namespace rclcpp_action
 {
 // Forward declaration
@@ -73,6 +86,7 @@ public:
     CancelClient,
     FeedbackSubscription,
     StatusSubscription,
+    IntraProcessFeedback,
   };
 
   /// Return true if there is an action server that is ready to take goal requests.
@@ -80,6 +94,33 @@ public:
   bool
   action_server_is_ready() const;
 
+  /// \internal
+  /// Enable the intra-process feedback path for this client.
+  /**
+   * Registers the client's identity so feedback from a matched in-process
+   * action server is handed over directly, skipping serialization. Each
+   * in-process delivery marks the corresponding middleware copy of that
+   * publish as a duplicate, which is then dropped per message.
+   */
+  RCLCPP_ACTION_PUBLIC
+  void
+  setup_intra_process(
+    uint64_t intra_process_action_client_id,
+    std::weak_ptr<rclcpp::experimental::IntraProcessManager> weak_ipm,
+    const std::string & action_name,
+    const void * type_support);
+
+  /// \internal
+  /// Buffer a feedback message published by an in-process action server.
+  /**
+   * The message is queued and the feedback callback runs the next time this
+   * client's executor dispatches it, in the client's callback group, never
+   * inline on the server's publishing thread.
+   */
+  RCLCPP_ACTION_PUBLIC
+  void
+  handle_intra_process_feedback_message(std::shared_ptr<void> message);
+
   /// Wait for action_server_is_ready() to become true, or until the given timeout is reached.
   template<typename RepT = int64_t, typename RatioT = std::milli>
   bool
@@ -282,6 +323,12 @@ protected:
   void
   handle_feedback_message(std::shared_ptr<void> message) = 0;
 
+  /// \internal
+  /// Extract the goal id from a type-erased feedback message.
+  virtual
+  GoalUUID
+  get_feedback_message_goal_id(const std::shared_ptr<void> & message) const = 0;
+
   /// \internal
   virtual
   std::shared_ptr<void>
@@ -312,6 +359,20 @@ protected:
 private:
   std::unique_ptr<ClientBaseImpl> pimpl_;
 
+  /// Drop the middleware copy of a feedback message already delivered in-process.
+  /**
+   * Every in-process delivery records one expected middleware duplicate for
+   * its goal id; this consumes one such record if present. The decision is
+   * made per message, so a server appearing or disappearing between publish
+   * and delivery cannot cause duplicated or lost feedback.
+   *
+   * \param[in] feedback_message the middleware-delivered feedback message.
+   * \return true if the message is a duplicate and must be dropped.
+   */
+  RCLCPP_ACTION_PUBLIC
+  bool
+  consume_intra_process_feedback_duplicate(const std::shared_ptr<void> & feedback_message);
+
   /// Set a std::function callback to be called when the specified entity is ready
   RCLCPP_ACTION_PUBLIC
   void
@@ -375,6 +436,21 @@ public:
 
     /// Function called when the result for the goal is received.
     ResultCallback result_callback;
+
+    /// Conflate feedback to at most one callback invocation per period.
+    /**
+     * When positive, feedback arriving within this period of the last
+     * delivered sample is not dispatched; the newest withheld sample is
+     * delivered once the period has elapsed, or flushed when the result
+     * arrives, so consumers that only render the latest state are not
+     * burned dispatching stale samples at the producer's rate. Zero (the
+     * default) delivers every sample.
+     *
+     * Mirrors the server-side `ServerGoalHandle::set_feedback_policy()`,
+     * but applies on the client so it also covers servers which publish
+     * at full rate.
+     */
+    std::chrono::nanoseconds feedback_conflation_period = std::chrono::nanoseconds(0);
   };
 
   /// Construct an action client.
@@ -447,6 +523,7 @@ public:
         // Do not use std::make_shared as friendship cannot be forwarded.
         std::shared_ptr<GoalHandle> goal_handle(
           new GoalHandle(goal_info, options.feedback_callback, options.result_callback));
+        goal_handle->set_feedback_conflation_period(options.feedback_conflation_period);
         {
           std::lock_guard<std::mutex> guard(goal_handles_mutex_);
           goal_handles_[goal_handle->get_goal_id()] = goal_handle;
@@ -485,8 +562,13 @@ public:
 
   /// Asynchronously get the result for an active goal.
   /**
-   * \throws exceptions::UnknownGoalHandleError If the goal unknown or already reached a terminal
-   *   state, or if there was an error requesting the result.
+   * All callers for the same goal share one underlying result request; each
+   * call registers its own callback, without replacing earlier ones.
+   * Results of goals that already reached a terminal state are served from a
+   * bounded most-recently-used cache, so repeat queries cost no round trip.
+   *
+   * \throws exceptions::UnknownGoalHandleError If the goal is unknown, or it terminated long
+   *   enough ago that its result left the cache, or there was an error requesting the result.
    * \param[in] goal_handle The goal handle for which to get the result.
    * \param[in] result_callback Optional callback that is called when the result is received.
    * \return A future that is set to the goal result when the goal is finished.
@@ -498,7 +580,19 @@ public:
   {
     std::lock_guard<std::mutex> lock(goal_handles_mutex_);
     if (goal_handles_.count(goal_handle->get_goal_id()) == 0) {
-      throw exceptions::UnknownGoalHandleError();
+      // Terminated goals stay queryable while their result is cached
+      auto cache_iter = result_cache_.find(goal_handle->get_goal_id());
+      if (cache_iter == result_cache_.end()) {
+        throw exceptions::UnknownGoalHandleError();
+      }
+      result_cache_order_.splice(
+        result_cache_order_.begin(), result_cache_order_, cache_iter->second.second);
+      if (result_callback) {
+        result_callback(cache_iter->second.first);
+      }
+      std::promise<WrappedResult> ready_promise;
+      ready_promise.set_value(cache_iter->second.first);
+      return ready_promise.get_future().share();
     }
     if (goal_handle->is_invalidated()) {
       // This case can happen if there was a failure to send the result request
@@ -506,8 +600,7 @@ public:
       throw goal_handle->invalidate_exception_;
     }
     if (result_callback) {
-      // This will override any previously registered callback
-      goal_handle->set_result_callback(result_callback);
+      goal_handle->add_result_callback(result_callback);
     }
     this->make_result_aware(goal_handle);
     return goal_handle->async_get_result();
@@ -662,6 +755,14 @@ private:
     goal_handle->call_feedback_callback(goal_handle, feedback);
   }
 
+  /// \internal
+  GoalUUID
+  get_feedback_message_goal_id(const std::shared_ptr<void> & message) const override
+  {
+    using FeedbackMessage = typename ActionT::Impl::FeedbackMessage;
+    return std::static_pointer_cast<const FeedbackMessage>(message)->goal_id.uuid;
+  }
+
   /// \internal
   std::shared_ptr<void>
   create_status_message() const override
@@ -722,8 +823,12 @@ private:
           *wrapped_result.result = result_response->result;
           wrapped_result.goal_id = goal_handle->get_goal_id();
           wrapped_result.code = static_cast<ResultCode>(result_response->status);
+          // Deliver any feedback withheld by conflation before the result,
+          // so the final progress update is never lost.
+          goal_handle->flush_pending_feedback(goal_handle);
           goal_handle->set_result(wrapped_result);
           std::lock_guard<std::mutex> lock(goal_handles_mutex_);
+          this->cache_result(wrapped_result);
           goal_handles_.erase(goal_handle->get_goal_id());
         });
     } catch (rclcpp::exceptions::RCLError & ex) {
@@ -754,7 +859,36 @@ private:
     return future;
   }
 
+  /// Remember the result of a terminated goal, evicting the least recently used one.
+  /**
+   * Assumes `goal_handles_mutex_` is held by the caller.
+   * \internal
+   */
+  void
+  cache_result(const WrappedResult & result)
+  {
+    auto iter = result_cache_.find(result.goal_id);
+    if (iter != result_cache_.end()) {
+      result_cache_order_.splice(
+        result_cache_order_.begin(), result_cache_order_, iter->second.second);
+      iter->second.first = result;
+      return;
+    }
+    if (result_cache_.size() >= RESULT_CACHE_CAPACITY) {
+      result_cache_.erase(result_cache_order_.back());
+      result_cache_order_.pop_back();
+    }
+    result_cache_order_.push_front(result.goal_id);
+    result_cache_.emplace(
+      result.goal_id, std::make_pair(result, result_cache_order_.begin()));
+  }
+
   std::map<GoalUUID, typename GoalHandle::WeakPtr> goal_handles_;
+  /// Results of terminated goals, most recently used first in result_cache_order_
+  static constexpr size_t RESULT_CACHE_CAPACITY = 64;
+  std::list<GoalUUID> result_cache_order_;
+  std::map<GoalUUID, std::pair<WrappedResult, typename std::list<GoalUUID>::iterator>>
+  result_cache_;
   std::mutex goal_handles_mutex_;
 };
 }  // namespace rclcpp_action
@@ -15,10 +15,13 @@
 #ifndef RCLCPP_ACTION__CLIENT_GOAL_HANDLE_HPP_
 #define RCLCPP_ACTION__CLIENT_GOAL_HANDLE_HPP_
 
+#include <chrono>
 #include <functional>
 #include <future>
 #include <memory>
 #include <mutex>
+#include <utility>
+#include <vector>
 
 #include "rcl_action/action_client.h"
 
@@ -117,11 +120,31 @@ private:
   void
   set_result_callback(ResultCallback callback);
 
+  /// Register an additional callback to be invoked when the result arrives.
+  /**
+   * Unlike `set_result_callback()`, this does not replace callbacks registered
+   * earlier, so any number of callers can wait on the same underlying result
+   * request.  If the result is already known the callback is invoked inline.
+   */
+  void
+  add_result_callback(ResultCallback callback);
+
   void
   call_feedback_callback(
     typename ClientGoalHandle<ActionT>::SharedPtr shared_this,
     typename std::shared_ptr<const Feedback> feedback_message);
 
+  /// Conflate feedback to at most one delivery per period, keeping the latest.
+  /** A zero period (the default) delivers every sample. */
+  void
+  set_feedback_conflation_period(std::chrono::nanoseconds period);
+
+  /// Deliver the newest conflated-away feedback sample, if any.
+  /** Called when the goal reaches a terminal state so the final progress
+    * update is never lost. */
+  void
+  flush_pending_feedback(typename ClientGoalHandle<ActionT>::SharedPtr shared_this);
+
   /// Get a future to the goal result.
   /**
    * This method should not be called if the `ignore_result` flag was set when
@@ -161,6 +184,16 @@ private:
 
   FeedbackCallback feedback_callback_{nullptr};
   ResultCallback result_callback_{nullptr};
+  /// Minimum time between feedback deliveries; zero delivers every sample.
+  std::chrono::nanoseconds feedback_conflation_period_{0};
+  std::chrono::steady_clock::time_point last_feedback_delivery_;
+  /// Newest sample withheld by conflation, delivered on the next slot or flush.
+  std::shared_ptr<const Feedback> pending_feedback_;
+  /// Continuations registered while the result request was already in flight.
+  std::vector<ResultCallback> result_continuations_;
+  /// Copy of the result, kept so late continuations can be served inline.
+  bool result_ready_{false};
+  WrappedResult wrapped_result_ {};
   int8_t status_{GoalStatus::STATUS_ACCEPTED};
 
   std::mutex handle_mutex_;
@@ -17,7 +17,10 @@
 
 #include <rcl_action/types.h>
 
+#include <chrono>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "rclcpp/logging.hpp"
 #include "rclcpp_action/client_goal_handle.hpp"
@@ -70,11 +73,21 @@ template<typename ActionT>
 void
 ClientGoalHandle<ActionT>::set_result(const WrappedResult & wrapped_result)
 {
-  std::lock_guard<std::mutex> guard(handle_mutex_);
+  std::unique_lock<std::mutex> guard(handle_mutex_);
   status_ = static_cast<int8_t>(wrapped_result.code);
+  result_ready_ = true;
+  wrapped_result_ = wrapped_result;
   result_promise_.set_value(wrapped_result);
-  if (result_callback_) {
-    result_callback_(wrapped_result);
+  ResultCallback callback = result_callback_;
+  std::vector<ResultCallback> continuations = std::move(result_continuations_);
+  result_continuations_.clear();
+  // Invoke callbacks with the lock released so they may query this handle
+  guard.unlock();
+  if (callback) {
+    callback(wrapped_result);
+  }
+  for (const ResultCallback & continuation : continuations) {
+    continuation(wrapped_result);
   }
 }
 
@@ -94,6 +107,20 @@ ClientGoalHandle<ActionT>::set_result_callback(ResultCallback callback)
   result_callback_ = callback;
 }
 
+template<typename ActionT>
+void
+ClientGoalHandle<ActionT>::add_result_callback(ResultCallback callback)
+{
+  std::unique_lock<std::mutex> guard(handle_mutex_);
+  if (result_ready_) {
+    WrappedResult result = wrapped_result_;
+    guard.unlock();
+    callback(result);
+    return;
+  }
+  result_continuations_.push_back(callback);
+}
+
 template<typename ActionT>
 int8_t
 ClientGoalHandle<ActionT>::get_status()
@@ -174,6 +201,46 @@ ClientGoalHandle<ActionT>::call_feedback_callback(
     RCLCPP_DEBUG(rclcpp::get_logger("rclcpp_action"), "Received feedback but goal ignores it.");
     return;
   }
+  if (feedback_conflation_period_ > std::chrono::nanoseconds(0)) {
+    const auto now = std::chrono::steady_clock::now();
+    if (now - last_feedback_delivery_ < feedback_conflation_period_) {
+      // Within the rate budget: remember the newest sample instead of
+      // dispatching it; it is superseded by later arrivals or flushed when
+      // the goal terminates.
+      pending_feedback_ = std::move(feedback_message);
+      return;
+    }
+    // The incoming sample is newer than anything withheld.
+    pending_feedback_.reset();
+    last_feedback_delivery_ = now;
+  }
+  feedback_callback_(shared_this, feedback_message);
+}
+
+template<typename ActionT>
+void
+ClientGoalHandle<ActionT>::set_feedback_conflation_period(std::chrono::nanoseconds period)
+{
+  std::lock_guard<std::mutex> guard(handle_mutex_);
+  feedback_conflation_period_ = period;
+}
+
+template<typename ActionT>
+void
+ClientGoalHandle<ActionT>::flush_pending_feedback(
+  typename ClientGoalHandle<ActionT>::SharedPtr shared_this)
+{
+  if (shared_this.get() != this) {
+    RCLCPP_ERROR(rclcpp::get_logger("rclcpp_action"), "Sent feedback to wrong goal handle.");
+    return;
+  }
+  std::lock_guard<std::mutex> guard(handle_mutex_);
+  if (!pending_feedback_ || nullptr == feedback_callback_) {
+    return;
+  }
+  auto feedback_message = std::move(pending_feedback_);
+  pending_feedback_.reset();
+  last_feedback_delivery_ = std::chrono::steady_clock::now();
   feedback_callback_(shared_this, feedback_message);
 }
 
@@ -18,6 +18,8 @@
 #include <memory>
 #include <string>
 
+#include "rclcpp/expand_topic_or_service_name.hpp"
+#include "rclcpp/experimental/intra_process_manager.hpp"
 #include "rclcpp/node.hpp"
 
 #include "rclcpp_action/client.hpp"
@@ -89,6 +91,21 @@ create_client(
     deleter);
 
   node_waitables_interface->add_waitable(action_client, group);
+
+  if (node_base_interface->get_use_intra_process_default()) {
+    // Register the client so in-process servers deliver feedback to it
+    // directly; the middleware copies are then dropped as duplicates.
+    auto ipm = node_base_interface->get_context()->get_sub_context<
+      rclcpp::experimental::IntraProcessManager>();
+    const void * type_support =
+      rosidl_typesupport_cpp::get_action_type_support_handle<ActionT>();
+    std::string expanded_name = rclcpp::expand_topic_or_service_name(
+      name, node_base_interface->get_name(), node_base_interface->get_namespace());
+    uint64_t intra_process_action_client_id = ipm->add_action_client(
+      std::static_pointer_cast<ClientBase>(action_client), type_support, expanded_name);
+    action_client->setup_intra_process(
+      intra_process_action_client_id, ipm, expanded_name, type_support);
+  }
   return action_client;
 }
 
@@ -20,6 +20,8 @@
 
 #include "rcl_action/action_server.h"
 
+#include "rclcpp/expand_topic_or_service_name.hpp"
+#include "rclcpp/experimental/intra_process_manager.hpp"
 #include "rclcpp/node.hpp"
 #include "rclcpp/node_interfaces/node_base_interface.hpp"
 #include "rclcpp/node_interfaces/node_clock_interface.hpp"
@@ -107,6 +109,21 @@ create_server(
       handle_accepted), deleter);
 
   node_waitables_interface->add_waitable(action_server, group);
+
+  if (node_base_interface->get_use_intra_process_default()) {
+    // Register the server so in-process clients get feedback delivered
+    // directly, without a serialization round trip.
+    auto ipm = node_base_interface->get_context()->get_sub_context<
+      rclcpp::experimental::IntraProcessManager>();
+    const void * type_support =
+      rosidl_typesupport_cpp::get_action_type_support_handle<ActionT>();
+    std::string expanded_name = rclcpp::expand_topic_or_service_name(
+      name, node_base_interface->get_name(), node_base_interface->get_namespace());
+    uint64_t intra_process_action_server_id = ipm->add_action_server(
+      std::static_pointer_cast<ServerBase>(action_server), type_support, expanded_name);
+    action_server->setup_intra_process(
+      intra_process_action_server_id, ipm, expanded_name, type_support);
+  }
   return action_server;
 }
 
@@ -0,0 +1,240 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP_ACTION__GOAL_UUID_TABLE_HPP_
+#define RCLCPP_ACTION__GOAL_UUID_TABLE_HPP_
+
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "rclcpp_action/types.hpp"
+
+namespace rclcpp_action
+{
+/// A pool of per-goal values indexed by goal UUID.
+/**
+ * Slots live in a flat, power-of-two sized array probed with open addressing,
+ * so lookups touch contiguous memory and steady-state insert/erase cycles are
+ * allocation-free; the array only grows when more than half of it is in use.
+ * Erased slots are reused for later goals.
+ *
+ * insert_or_assign() hands back an Index that names the slot plus the slot's
+ * generation at insertion time.
+ * The generation is bumped every time the slot is erased, so a stale Index
+ * held across a slot reuse is detected and treated as "not found" instead of
+ * touching the newer goal's entry.
+ *
+ * This class does no locking; callers serialize access with their own mutex.
+ */
+template<typename ValueT>
+class GoalUuidTable
+{
+public:
+  /// Generation-checked reference to a slot in the table.
+  struct Index
+  {
+    size_t slot{0u};
+    uint32_t generation{0u};
+  };
+
+  GoalUuidTable()
+  : slots_(kInitialCapacity)
+  {
+  }
+
+  /// Insert a value, replacing any existing value stored for the same goal id.
+  /**
+   * \param[in] uuid the goal id to index the value under.
+   * \param[in] value the value to store.
+   * \return an Index that can be used with get() and erase() until the slot
+   *   is erased and reused, at which point it is rejected by the generation
+   *   check.
+   */
+  Index
+  insert_or_assign(const GoalUUID & uuid, ValueT value)
+  {
+    size_t slot = find_slot(uuid);
+    if (slot != slots_.size()) {
+      slots_[slot].value = std::move(value);
+      return Index{slot, slots_[slot].generation};
+    }
+    if ((used_ + 1u) * 2u > slots_.size()) {
+      grow();
+    }
+    const size_t mask = slots_.size() - 1u;
+    slot = hash_uuid(uuid) & mask;
+    while (SlotState::kOccupied == slots_[slot].state) {
+      slot = (slot + 1u) & mask;
+    }
+    if (SlotState::kEmpty == slots_[slot].state) {
+      ++used_;
+    }
+    slots_[slot].uuid = uuid;
+    slots_[slot].value = std::move(value);
+    slots_[slot].state = SlotState::kOccupied;
+    ++size_;
+    return Index{slot, slots_[slot].generation};
+  }
+
+  /// Get a pointer to the value stored for a goal id, or nullptr if absent.
+  ValueT *
+  find(const GoalUUID & uuid)
+  {
+    size_t slot = find_slot(uuid);
+    if (slot == slots_.size()) {
+      return nullptr;
+    }
+    return &slots_[slot].value;
+  }
+
+  /// Get a pointer to the value a previously returned Index refers to.
+  /**
+   * \return nullptr if the slot was erased since the Index was handed out,
+   *   even if it has since been reused for another goal.
+   */
+  ValueT *
+  get(const Index & index)
+  {
+    Slot & slot = slots_[index.slot];
+    if (SlotState::kOccupied != slot.state || slot.generation != index.generation) {
+      return nullptr;
+    }
+    return &slot.value;
+  }
+
+  /// Erase the value stored for a goal id.
+  /**
+   * \return true if a value was erased.
+   */
+  bool
+  erase(const GoalUUID & uuid)
+  {
+    size_t slot = find_slot(uuid);
+    if (slot == slots_.size()) {
+      return false;
+    }
+    release(slots_[slot]);
+    return true;
+  }
+
+  /// Erase the value a previously returned Index refers to.
+  /**
+   * A no-op if the slot was already erased, so terminal-state cleanup racing
+   * goal expiration cannot erase an unrelated goal that reused the slot.
+   *
+   * \return true if a value was erased.
+   */
+  bool
+  erase(const Index & index)
+  {
+    Slot & slot = slots_[index.slot];
+    if (SlotState::kOccupied != slot.state || slot.generation != index.generation) {
+      return false;
+    }
+    release(slot);
+    return true;
+  }
+
+  size_t
+  size() const
+  {
+    return size_;
+  }
+
+private:
+  enum class SlotState : uint8_t
+  {
+    kEmpty,
+    kOccupied,
+    kErased,
+  };
+
+  struct Slot
+  {
+    GoalUUID uuid{};
+    ValueT value{};
+    uint32_t generation{0u};
+    SlotState state{SlotState::kEmpty};
+  };
+
+  static constexpr size_t kInitialCapacity = 64u;
+
+  static size_t
+  hash_uuid(const GoalUUID & uuid)
+  {
+    static_assert(sizeof(GoalUUID) == 2u * sizeof(uint64_t), "expected a 128-bit goal id");
+    // Goal ids are (pseudo)random, a multiply-xorshift mix of the two halves
+    // spreads them well enough for linear probing.
+    uint64_t halves[2];
+    std::memcpy(halves, uuid.data(), sizeof(halves));
+    uint64_t mixed = halves[0] * 0x9e3779b97f4a7c15u;
+    mixed ^= halves[1] * 0xbf58476d1ce4e5b9u;
+    mixed ^= mixed >> 32u;
+    return static_cast<size_t>(mixed);
+  }
+
+  /// Return the slot occupied by uuid, or slots_.size() if absent.
+  size_t
+  find_slot(const GoalUUID & uuid) const
+  {
+    const size_t mask = slots_.size() - 1u;
+    size_t slot = hash_uuid(uuid) & mask;
+    while (SlotState::kEmpty != slots_[slot].state) {
+      if (SlotState::kOccupied == slots_[slot].state && uuid == slots_[slot].uuid) {
+        return slot;
+      }
+      slot = (slot + 1u) & mask;
+    }
+    return slots_.size();
+  }
+
+  void
+  grow()
+  {
+    std::vector<Slot> old_slots(slots_.size() * 2u);
+    old_slots.swap(slots_);
+    const size_t mask = slots_.size() - 1u;
+    for (Slot & old_slot : old_slots) {
+      if (SlotState::kOccupied != old_slot.state) {
+        continue;
+      }
+      size_t slot = hash_uuid(old_slot.uuid) & mask;
+      while (SlotState::kOccupied == slots_[slot].state) {
+        slot = (slot + 1u) & mask;
+      }
+      slots_[slot] = std::move(old_slot);
+    }
+    // Rehashing drops the erased slots.
+    used_ = size_;
+  }
+
+  void
+  release(Slot & slot)
+  {
+    slot.value = ValueT{};
+    ++slot.generation;
+    slot.state = SlotState::kErased;
+    --size_;
+  }
+
+  std::vector<Slot> slots_;
+  /// Number of occupied slots.
+  size_t size_{0u};
+  /// Number of occupied plus erased (not yet reclaimed) slots.
+  size_t used_{0u};
+};
+}  // namespace rclcpp_action
+#endif  // RCLCPP_ACTION__GOAL_UUID_TABLE_HPP_
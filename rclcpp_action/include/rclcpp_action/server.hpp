@@ -15,6 +15,7 @@
 #ifndef RCLCPP_ACTION__SERVER_HPP_
 #define RCLCPP_ACTION__SERVER_HPP_
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -31,10 +32,23 @@
 #include "rclcpp/node_interfaces/node_logging_interface.hpp"
 #include "rclcpp/waitable.hpp"
 
+#include "rclcpp_action/goal_uuid_table.hpp"
 #include "rclcpp_action/visibility_control.hpp"
 #include "rclcpp_action/server_goal_handle.hpp"
 #include "rclcpp_action/types.hpp"
 
+namespace rclcpp
+{
+namespace experimental
+{
+/**
+ * IntraProcessManager is forward declared here, avoiding an rclcpp_action
+ * header dependency on `rclcpp/experimental/intra_process_manager.hpp`.
+ */
+class IntraProcessManager;
+}  // namespace experimental
+}  // namespace rclcpp
+
 namespace rclcpp_action
 {
 // Forward declaration
@@ -82,6 +96,21 @@ public:
   RCLCPP_ACTION_PUBLIC
   virtual ~ServerBase();
 
+  /// \internal
+  /// Enable the intra-process feedback path for this server.
+  /**
+   * Once set up, publish_feedback() hands the feedback message directly to
+   * every matched in-process action client, in addition to publishing it
+   * through the middleware for remote clients.
+   */
+  RCLCPP_ACTION_PUBLIC
+  void
+  setup_intra_process(
+    uint64_t intra_process_action_server_id,
+    std::weak_ptr<rclcpp::experimental::IntraProcessManager> weak_ipm,
+    const std::string & action_name,
+    const void * type_support);
+
   // -------------
   // Waitables API
 
@@ -271,6 +300,19 @@ protected:
   void
   publish_feedback(std::shared_ptr<void> feedback_msg);
 
+  /// Publish feedback for one goal, applying the policy configured for it.
+  /// \internal
+  RCLCPP_ACTION_PUBLIC
+  void
+  publish_feedback(const GoalUUID & uuid, std::shared_ptr<void> feedback_msg);
+
+  /// Configure how feedback published for one goal is limited, see FeedbackPolicy.
+  /// \internal
+  RCLCPP_ACTION_PUBLIC
+  void
+  set_feedback_policy(
+    const GoalUUID & uuid, FeedbackPolicy policy, std::chrono::nanoseconds period);
+
   // End API for communication between ServerBase and Server<>
   // ---------------------------------------------------------
 
@@ -428,9 +470,9 @@ protected:
     std::shared_ptr<ServerGoalHandle<ActionT>> goal_handle;
     {
       std::lock_guard<std::mutex> lock(goal_handles_mutex_);
-      auto element = goal_handles_.find(uuid);
-      if (element != goal_handles_.end()) {
-        goal_handle = element->second.lock();
+      GoalHandleWeakPtr * element = goal_handles_.find(uuid);
+      if (element) {
+        goal_handle = element->lock();
       }
     }
 
@@ -460,8 +502,17 @@ protected:
     std::shared_ptr<ServerGoalHandle<ActionT>> goal_handle;
     std::weak_ptr<Server<ActionT>> weak_this = this->shared_from_this();
 
+    // Reserve a slot up front so terminal-state cleanup can erase it by
+    // generation-checked index, without re-hashing the goal id.
+    typename GoalUuidTable<GoalHandleWeakPtr>::Index goal_handle_index;
+    {
+      std::lock_guard<std::mutex> lock(goal_handles_mutex_);
+      goal_handle_index = goal_handles_.insert_or_assign(uuid, GoalHandleWeakPtr());
+    }
+
     std::function<void(const GoalUUID &, std::shared_ptr<void>)> on_terminal_state =
-      [weak_this](const GoalUUID & goal_uuid, std::shared_ptr<void> result_message)
+      [weak_this, goal_handle_index](
+      const GoalUUID & goal_uuid, std::shared_ptr<void> result_message)
       {
         std::shared_ptr<Server<ActionT>> shared_this = weak_this.lock();
         if (!shared_this) {
@@ -475,7 +526,7 @@ protected:
         shared_this->notify_goal_terminal_state();
         // Delete data now (ServerBase and rcl_action_server_t keep data until goal handle expires)
         std::lock_guard<std::mutex> lock(shared_this->goal_handles_mutex_);
-        shared_this->goal_handles_.erase(goal_uuid);
+        shared_this->goal_handles_.erase(goal_handle_index);
       };
 
     std::function<void(const GoalUUID &)> on_executing =
@@ -491,13 +542,23 @@ protected:
       };
 
     std::function<void(std::shared_ptr<typename ActionT::Impl::FeedbackMessage>)> publish_feedback =
-      [weak_this](std::shared_ptr<typename ActionT::Impl::FeedbackMessage> feedback_msg)
+      [weak_this, uuid](std::shared_ptr<typename ActionT::Impl::FeedbackMessage> feedback_msg)
       {
         std::shared_ptr<Server<ActionT>> shared_this = weak_this.lock();
         if (!shared_this) {
           return;
         }
-        shared_this->publish_feedback(std::static_pointer_cast<void>(feedback_msg));
+        shared_this->publish_feedback(uuid, std::static_pointer_cast<void>(feedback_msg));
+      };
+
+    std::function<void(FeedbackPolicy, std::chrono::nanoseconds)> set_feedback_policy =
+      [weak_this, uuid](FeedbackPolicy policy, std::chrono::nanoseconds period)
+      {
+        std::shared_ptr<Server<ActionT>> shared_this = weak_this.lock();
+        if (!shared_this) {
+          return;
+        }
+        shared_this->set_feedback_policy(uuid, policy, period);
       };
 
     auto request = std::static_pointer_cast<
@@ -505,10 +566,14 @@ protected:
     auto goal = std::shared_ptr<const typename ActionT::Goal>(request, &request->goal);
     goal_handle.reset(
       new ServerGoalHandle<ActionT>(
-        rcl_goal_handle, uuid, goal, on_terminal_state, on_executing, publish_feedback));
+        rcl_goal_handle, uuid, goal, on_terminal_state, on_executing, publish_feedback,
+        set_feedback_policy));
     {
       std::lock_guard<std::mutex> lock(goal_handles_mutex_);
-      goal_handles_[uuid] = goal_handle;
+      GoalHandleWeakPtr * element = goal_handles_.get(goal_handle_index);
+      if (element) {
+        *element = goal_handle;
+      }
     }
     handle_accepted_(goal_handle);
   }
@@ -561,9 +626,9 @@ private:
   AcceptedCallback handle_accepted_;
 
   using GoalHandleWeakPtr = std::weak_ptr<ServerGoalHandle<ActionT>>;
-  /// A map of goal id to goal handle weak pointers.
+  /// A pool of goal handle weak pointers indexed by goal id.
   /// This is used to provide a goal handle to handle_cancel.
-  std::unordered_map<GoalUUID, GoalHandleWeakPtr> goal_handles_;
+  GoalUuidTable<GoalHandleWeakPtr> goal_handles_;
   std::mutex goal_handles_mutex_;
 };
 }  // namespace rclcpp_action
@@ -15,6 +15,7 @@
 #ifndef RCLCPP_ACTION__SERVER_GOAL_HANDLE_HPP_
 #define RCLCPP_ACTION__SERVER_GOAL_HANDLE_HPP_
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -30,6 +31,22 @@
 namespace rclcpp_action
 {
 
+/// How an action server treats feedback samples published for a single goal.
+/**
+ * Producers may call `ServerGoalHandle::publish_feedback()` at their native
+ * rate; the policy decides which of those samples actually reach clients.
+ */
+enum class FeedbackPolicy : int8_t
+{
+  /// Publish every sample (default).
+  PUBLISH_ALL = 1,
+  /// Drop samples arriving within the configured period of the last published one.
+  RATE_LIMIT = 2,
+  /// Like RATE_LIMIT, but remember the newest dropped sample and flush it when
+  /// the goal reaches a terminal state, so the final progress is never lost.
+  CONFLATE = 3,
+};
+
 /// Base class to interact with goals on a server.
 /// \internal
 /**
@@ -154,6 +171,29 @@ public:
     publish_feedback_(feedback_message);
   }
 
+  /// Limit how often feedback published for this goal reaches clients.
+  /**
+   * By default every sample handed to `publish_feedback()` is published.
+   * A limiting policy lets the producer keep emitting at its native rate while
+   * the wire only carries one sample per period, see `FeedbackPolicy`.
+   *
+   * The first sample published after a policy change always goes out.
+   *
+   * \param[in] policy how samples beyond the rate budget are treated.
+   * \param[in] period minimum time between published samples.
+   *   Ignored for FeedbackPolicy::PUBLISH_ALL, must be positive otherwise.
+   * \throws std::invalid_argument if period is not positive for a limiting policy.
+   */
+  void
+  set_feedback_policy(
+    FeedbackPolicy policy,
+    std::chrono::nanoseconds period = std::chrono::nanoseconds(0))
+  {
+    if (set_feedback_policy_) {
+      set_feedback_policy_(policy, period);
+    }
+  }
+
   /// Indicate that a goal could not be reached and has been aborted.
   /**
    * Only call this if the goal was executing but cannot be completed.
@@ -259,11 +299,12 @@ protected:
     std::shared_ptr<const typename ActionT::Goal> goal,
     std::function<void(const GoalUUID &, std::shared_ptr<void>)> on_terminal_state,
     std::function<void(const GoalUUID &)> on_executing,
-    std::function<void(std::shared_ptr<typename ActionT::Impl::FeedbackMessage>)> publish_feedback
+    std::function<void(std::shared_ptr<typename ActionT::Impl::FeedbackMessage>)> publish_feedback,
+    std::function<void(FeedbackPolicy, std::chrono::nanoseconds)> set_feedback_policy = nullptr
   )
   : ServerGoalHandleBase(rcl_handle), goal_(goal), uuid_(uuid),
     on_terminal_state_(on_terminal_state), on_executing_(on_executing),
-    publish_feedback_(publish_feedback)
+    publish_feedback_(publish_feedback), set_feedback_policy_(set_feedback_policy)
   {
   }
 
@@ -278,6 +319,7 @@ protected:
   std::function<void(const GoalUUID &, std::shared_ptr<void>)> on_terminal_state_;
   std::function<void(const GoalUUID &)> on_executing_;
   std::function<void(std::shared_ptr<typename ActionT::Impl::FeedbackMessage>)> publish_feedback_;
+  std::function<void(FeedbackPolicy, std::chrono::nanoseconds)> set_feedback_policy_;
 };
 }  // namespace rclcpp_action
 
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <algorithm>
+#include <deque>
 #include <map>
 #include <memory>
 #include <random>
@@ -22,6 +23,9 @@
 
 #include "rcl_action/action_client.h"
 #include "rcl_action/wait.h"
+#include "rclcpp/detail/add_guard_condition_to_rcl_wait_set.hpp"
+#include "rclcpp/experimental/intra_process_manager.hpp"
+#include "rclcpp/guard_condition.hpp"
 #include "rclcpp/node_interfaces/node_base_interface.hpp"
 #include "rclcpp/node_interfaces/node_logging_interface.hpp"
 
@@ -41,7 +45,8 @@ public:
     const std::string & action_name,
     const rosidl_action_type_support_t * type_support,
     const rcl_action_client_options_t & client_options)
-  : node_graph_(node_graph),
+  : intra_process_feedback_gc_(node_base->get_context()),
+    node_graph_(node_graph),
     node_handle(node_base->get_shared_rcl_node_handle()),
     logger(node_logging->get_logger().get_child("rclcpp_action")),
     random_bytes_generator(std::random_device{}())
@@ -94,11 +99,28 @@ public:
   size_t num_clients{0u};
   size_t num_services{0u};
 
+  bool use_intra_process_{false};
+  std::weak_ptr<rclcpp::experimental::IntraProcessManager> weak_ipm_;
+  uint64_t intra_process_action_client_id_{0};
+  std::string intra_process_action_name_;
+  const void * intra_process_type_support_{nullptr};
+
   bool is_feedback_ready{false};
   bool is_status_ready{false};
   bool is_goal_response_ready{false};
   bool is_cancel_response_ready{false};
   bool is_result_response_ready{false};
+  bool is_intra_process_feedback_ready{false};
+
+  // Wakes the client's executor when an in-process server queued feedback.
+  rclcpp::GuardCondition intra_process_feedback_gc_;
+  std::mutex intra_process_feedback_mutex_;
+  std::deque<std::shared_ptr<void>> intra_process_feedback_queue_;
+
+  // Number of in-process feedback deliveries, per goal, whose middleware
+  // copy has not arrived yet; that copy is dropped as a duplicate.
+  std::mutex feedback_dedup_mutex_;
+  std::map<GoalUUID, size_t> expected_feedback_duplicates_;
 
   rclcpp::Context::SharedPtr context_;
   rclcpp::node_interfaces::NodeGraphInterface::WeakPtr node_graph_;
@@ -136,6 +158,66 @@ ClientBase::ClientBase(
 
 ClientBase::~ClientBase()
 {
+  if (pimpl_->use_intra_process_) {
+    auto ipm = pimpl_->weak_ipm_.lock();
+    if (ipm) {
+      ipm->remove_action_client(pimpl_->intra_process_action_client_id_);
+    }
+  }
+}
+
+void
+ClientBase::setup_intra_process(
+  uint64_t intra_process_action_client_id,
+  std::weak_ptr<rclcpp::experimental::IntraProcessManager> weak_ipm,
+  const std::string & action_name,
+  const void * type_support)
+{
+  pimpl_->intra_process_action_client_id_ = intra_process_action_client_id;
+  pimpl_->weak_ipm_ = weak_ipm;
+  pimpl_->intra_process_action_name_ = action_name;
+  pimpl_->intra_process_type_support_ = type_support;
+  pimpl_->use_intra_process_ = true;
+}
+
+void
+ClientBase::handle_intra_process_feedback_message(std::shared_ptr<void> message)
+{
+  // Record the expected middleware duplicate before queueing, i.e. while still
+  // on the server's publishing thread.  Doing it any later would race with the
+  // middleware copy, which could be taken and executed first.
+  {
+    const GoalUUID goal_id = this->get_feedback_message_goal_id(message);
+    std::lock_guard<std::mutex> lock(pimpl_->feedback_dedup_mutex_);
+    ++pimpl_->expected_feedback_duplicates_[goal_id];
+  }
+  {
+    std::lock_guard<std::mutex> lock(pimpl_->intra_process_feedback_mutex_);
+    pimpl_->intra_process_feedback_queue_.push_back(std::move(message));
+  }
+  pimpl_->intra_process_feedback_gc_.trigger();
+
+  std::lock_guard<std::recursive_mutex> lock(listener_mutex_);
+  auto it = entity_type_to_on_ready_callback_.find(EntityType::IntraProcessFeedback);
+  if (it != entity_type_to_on_ready_callback_.end()) {
+    it->second(1);
+  }
+}
+
+bool
+ClientBase::consume_intra_process_feedback_duplicate(
+  const std::shared_ptr<void> & feedback_message)
+{
+  const GoalUUID goal_id = this->get_feedback_message_goal_id(feedback_message);
+  std::lock_guard<std::mutex> lock(pimpl_->feedback_dedup_mutex_);
+  auto it = pimpl_->expected_feedback_duplicates_.find(goal_id);
+  if (it == pimpl_->expected_feedback_duplicates_.end()) {
+    return false;
+  }
+  if (0 == --it->second) {
+    pimpl_->expected_feedback_duplicates_.erase(it);
+  }
+  return true;
 }
 
 bool
@@ -231,7 +313,8 @@ ClientBase::get_number_of_ready_subscriptions()
 size_t
 ClientBase::get_number_of_ready_guard_conditions()
 {
-  return pimpl_->num_guard_conditions;
+  // One extra for the guard condition backing the intra-process feedback queue.
+  return pimpl_->num_guard_conditions + 1;
 }
 
 size_t
@@ -260,6 +343,8 @@ ClientBase::add_to_wait_set(rcl_wait_set_t * wait_set)
   if (RCL_RET_OK != ret) {
     rclcpp::exceptions::throw_from_rcl_error(ret, "ClientBase::add_to_wait_set() failed");
   }
+  rclcpp::detail::add_guard_condition_to_rcl_wait_set(
+    *wait_set, pimpl_->intra_process_feedback_gc_);
 }
 
 bool
@@ -276,12 +361,17 @@ ClientBase::is_ready(rcl_wait_set_t * wait_set)
     rclcpp::exceptions::throw_from_rcl_error(
       ret, "failed to check for any ready entities");
   }
+  {
+    std::lock_guard<std::mutex> lock(pimpl_->intra_process_feedback_mutex_);
+    pimpl_->is_intra_process_feedback_ready = !pimpl_->intra_process_feedback_queue_.empty();
+  }
   return
     pimpl_->is_feedback_ready ||
     pimpl_->is_status_ready ||
     pimpl_->is_goal_response_ready ||
     pimpl_->is_cancel_response_ready ||
-    pimpl_->is_result_response_ready;
+    pimpl_->is_result_response_ready ||
+    pimpl_->is_intra_process_feedback_ready;
 }
 
 void
@@ -404,6 +494,7 @@ ClientBase::set_on_ready_callback(std::function<void(size_t, int)> callback)
   set_callback_to_entity(EntityType::CancelClient, callback);
   set_callback_to_entity(EntityType::FeedbackSubscription, callback);
   set_callback_to_entity(EntityType::StatusSubscription, callback);
+  set_callback_to_entity(EntityType::IntraProcessFeedback, callback);
 }
 
 void
@@ -462,6 +553,18 @@ ClientBase::set_callback_to_entity(
       static_cast<const void *>(&cb));
   }
 
+  if (EntityType::IntraProcessFeedback == entity_type) {
+    // Report feedback queued before the callback was registered.
+    size_t unread = 0;
+    {
+      std::lock_guard<std::mutex> queue_lock(pimpl_->intra_process_feedback_mutex_);
+      unread = pimpl_->intra_process_feedback_queue_.size();
+    }
+    if (unread > 0 && it != entity_type_to_on_ready_callback_.end()) {
+      it->second(unread);
+    }
+  }
+
   on_ready_callback_set_ = true;
 }
 
@@ -519,6 +622,14 @@ ClientBase::set_on_ready_callback(
         break;
       }
 
+    case EntityType::IntraProcessFeedback:
+      {
+        // Not backed by an rcl entity; the stored std::function is invoked
+        // directly when an in-process server queues feedback.
+        ret = RCL_RET_OK;
+        break;
+      }
+
     default:
       throw std::runtime_error("ClientBase::set_on_ready_callback: Unknown entity type.");
       break;
@@ -541,6 +652,7 @@ ClientBase::clear_on_ready_callback()
     set_on_ready_callback(EntityType::CancelClient, nullptr, nullptr);
     set_on_ready_callback(EntityType::FeedbackSubscription, nullptr, nullptr);
     set_on_ready_callback(EntityType::StatusSubscription, nullptr, nullptr);
+    set_on_ready_callback(EntityType::IntraProcessFeedback, nullptr, nullptr);
     on_ready_callback_set_ = false;
   }
 
@@ -550,7 +662,18 @@ ClientBase::clear_on_ready_callback()
 std::shared_ptr<void>
 ClientBase::take_data()
 {
-  if (pimpl_->is_feedback_ready) {
+  if (pimpl_->is_intra_process_feedback_ready) {
+    std::shared_ptr<void> feedback_message;
+    {
+      std::lock_guard<std::mutex> lock(pimpl_->intra_process_feedback_mutex_);
+      if (!pimpl_->intra_process_feedback_queue_.empty()) {
+        feedback_message = pimpl_->intra_process_feedback_queue_.front();
+        pimpl_->intra_process_feedback_queue_.pop_front();
+      }
+    }
+    return std::static_pointer_cast<void>(
+      std::make_shared<std::shared_ptr<void>>(std::move(feedback_message)));
+  } else if (pimpl_->is_feedback_ready) {
     std::shared_ptr<void> feedback_message = this->create_feedback_message();
     rcl_ret_t ret = rcl_action_take_feedback(
       pimpl_->client_handle.get(), feedback_message.get());
@@ -613,6 +736,9 @@ ClientBase::take_data_by_entity_id(size_t id)
     case EntityType::StatusSubscription:
       pimpl_->is_status_ready = true;
       break;
+    case EntityType::IntraProcessFeedback:
+      pimpl_->is_intra_process_feedback_ready = true;
+      break;
   }
 
   return take_data();
@@ -625,13 +751,24 @@ ClientBase::execute(std::shared_ptr<void> & data)
     throw std::runtime_error("'data' is empty");
   }
 
-  if (pimpl_->is_feedback_ready) {
+  if (pimpl_->is_intra_process_feedback_ready) {
+    auto shared_ptr = std::static_pointer_cast<std::shared_ptr<void>>(data);
+    pimpl_->is_intra_process_feedback_ready = false;
+    if (*shared_ptr) {
+      this->handle_feedback_message(*shared_ptr);
+    }
+  } else if (pimpl_->is_feedback_ready) {
     auto shared_ptr = std::static_pointer_cast<std::tuple<rcl_ret_t, std::shared_ptr<void>>>(data);
     auto ret = std::get<0>(*shared_ptr);
     pimpl_->is_feedback_ready = false;
     if (RCL_RET_OK == ret) {
       auto feedback_message = std::get<1>(*shared_ptr);
-      this->handle_feedback_message(feedback_message);
+      // Each in-process delivery for this goal accounts for exactly one copy
+      // arriving through the middleware; those copies are dropped as
+      // duplicates, message by message.
+      if (!this->consume_intra_process_feedback_duplicate(feedback_message)) {
+        this->handle_feedback_message(feedback_message);
+      }
     } else if (RCL_RET_ACTION_CLIENT_TAKE_FAILED != ret) {
       rclcpp::exceptions::throw_from_rcl_error(ret, "error taking feedback");
     }
@@ -12,6 +12,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <list>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -28,6 +32,9 @@
 #include "action_msgs/msg/goal_status_array.hpp"
 #include "action_msgs/srv/cancel_goal.hpp"
 #include "rclcpp/exceptions.hpp"
+#include "rclcpp/experimental/intra_process_manager.hpp"
+#include "rclcpp_action/client.hpp"
+#include "rclcpp_action/goal_uuid_table.hpp"
 #include "rclcpp_action/server.hpp"
 
 using rclcpp_action::ServerBase;
@@ -72,8 +79,104 @@ public:
   std::unordered_map<GoalUUID, std::shared_ptr<void>> goal_results_;
   // Requests for results are kept until a result becomes available
   std::unordered_map<GoalUUID, std::vector<rmw_request_id_t>> result_requests_;
+
+  // Timer wheel over the expiry deadlines of terminated goals, used to size
+  // the batch passed to rcl_action_expire_goals() on a goal_expired event
+  // instead of expiring goals one scan at a time. Guarded by
+  // unordered_map_mutex_, like the result tables it shadows.
+  struct ExpiryWheel
+  {
+    // One revolution covers kNumBuckets * kTickNs; entries further out share
+    // a slot with a later revolution and are filtered by deadline.
+    static constexpr size_t kNumBuckets = 256;
+    static constexpr int64_t kTickNs = 250LL * 1000LL * 1000LL;
+
+    struct Entry
+    {
+      GoalUUID uuid;
+      int64_t deadline_ns;
+    };
+
+    std::array<std::list<Entry>, kNumBuckets> buckets;
+    // Goal id to bucket and position, for O(1) cancellation
+    std::unordered_map<GoalUUID, std::pair<size_t, std::list<Entry>::iterator>> index;
+    int64_t last_counted_ns {0};
+
+    void
+    schedule(const GoalUUID & uuid, int64_t deadline_ns)
+    {
+      this->cancel(uuid);
+      const size_t bucket = static_cast<size_t>(
+        (deadline_ns / kTickNs) % static_cast<int64_t>(kNumBuckets));
+      buckets[bucket].push_front(Entry{uuid, deadline_ns});
+      index[uuid] = std::make_pair(bucket, buckets[bucket].begin());
+    }
+
+    void
+    cancel(const GoalUUID & uuid)
+    {
+      auto it = index.find(uuid);
+      if (it == index.end()) {
+        return;
+      }
+      buckets[it->second.first].erase(it->second.second);
+      index.erase(it);
+    }
+
+    // Count entries due at now_ns, looking only at the slots the wheel hand
+    // passed over since the last count.
+    size_t
+    count_due(int64_t now_ns)
+    {
+      if (index.empty() || now_ns < last_counted_ns) {
+        last_counted_ns = now_ns;
+        return 0u;
+      }
+      const int64_t first_tick = last_counted_ns / kTickNs;
+      const int64_t num_ticks = std::min<int64_t>(
+        now_ns / kTickNs - first_tick + 1, static_cast<int64_t>(kNumBuckets));
+      size_t due = 0u;
+      for (int64_t tick = first_tick; tick < first_tick + num_ticks; ++tick) {
+        const size_t bucket = static_cast<size_t>(tick % static_cast<int64_t>(kNumBuckets));
+        for (const Entry & entry : buckets[bucket]) {
+          if (entry.deadline_ns <= now_ns) {
+            ++due;
+          }
+        }
+      }
+      last_counted_ns = now_ns;
+      return due;
+    }
+  };
+
+  ExpiryWheel expiry_wheel_;
+  // Result keep-alive duration from the server options
+  int64_t result_timeout_ns_ {0};
+
+  // Lock for goal_handles_, held only while touching the table
+  std::mutex goal_handles_mutex_;
   // rcl goal handles are kept so api to send result doesn't try to access freed memory
-  std::unordered_map<GoalUUID, std::shared_ptr<rcl_action_goal_handle_t>> goal_handles_;
+  GoalUuidTable<std::shared_ptr<rcl_action_goal_handle_t>> goal_handles_;
+
+  // Per-goal feedback limiting state, see ServerGoalHandle::set_feedback_policy()
+  struct FeedbackGate
+  {
+    FeedbackPolicy policy {FeedbackPolicy::PUBLISH_ALL};
+    std::chrono::nanoseconds period {0};
+    std::chrono::steady_clock::time_point last_publish_time;
+    // Newest sample held back by a conflating policy
+    std::shared_ptr<void> pending;
+  };
+  // Lock for feedback_gates_
+  std::mutex feedback_gates_mutex_;
+  // Only goals with a limiting policy have an entry here
+  std::unordered_map<GoalUUID, FeedbackGate> feedback_gates_;
+
+  bool use_intra_process_{false};
+  std::weak_ptr<rclcpp::experimental::IntraProcessManager> weak_ipm_;
+  uint64_t intra_process_action_server_id_{0};
+  std::string intra_process_action_name_;
+  const void * intra_process_type_support_{nullptr};
 
   rclcpp::Logger logger_;
 };
@@ -107,6 +210,8 @@ ServerBase::ServerBase(
   pimpl_->action_server_.reset(new rcl_action_server_t, deleter);
   *(pimpl_->action_server_) = rcl_action_get_zero_initialized_server();
 
+  pimpl_->result_timeout_ns_ = options.result_timeout.nanoseconds;
+
   rcl_node_t * rcl_node = node_base->get_rcl_node_handle();
   rcl_clock_t * rcl_clock = pimpl_->clock_->get_clock_handle();
 
@@ -132,6 +237,26 @@ ServerBase::ServerBase(
 
 ServerBase::~ServerBase()
 {
+  if (pimpl_->use_intra_process_) {
+    auto ipm = pimpl_->weak_ipm_.lock();
+    if (ipm) {
+      ipm->remove_action_server(pimpl_->intra_process_action_server_id_);
+    }
+  }
+}
+
+void
+ServerBase::setup_intra_process(
+  uint64_t intra_process_action_server_id,
+  std::weak_ptr<rclcpp::experimental::IntraProcessManager> weak_ipm,
+  const std::string & action_name,
+  const void * type_support)
+{
+  pimpl_->intra_process_action_server_id_ = intra_process_action_server_id;
+  pimpl_->weak_ipm_ = weak_ipm;
+  pimpl_->intra_process_action_name_ = action_name;
+  pimpl_->intra_process_type_support_ = type_support;
+  pimpl_->use_intra_process_ = true;
 }
 
 size_t
@@ -379,8 +504,8 @@ ServerBase::execute_goal_request_received(std::shared_ptr<void> & data)
     *handle = *rcl_handle;
 
     {
-      std::lock_guard<std::recursive_mutex> lock(pimpl_->unordered_map_mutex_);
-      pimpl_->goal_handles_[uuid] = handle;
+      std::lock_guard<std::mutex> lock(pimpl_->goal_handles_mutex_);
+      pimpl_->goal_handles_.insert_or_assign(uuid, handle);
     }
 
     if (GoalResponse::ACCEPT_AND_EXECUTE == status) {
@@ -548,30 +673,47 @@ ServerBase::execute_result_request_received(std::shared_ptr<void> & data)
 void
 ServerBase::execute_check_expired_goals()
 {
-  // Allocate expecting only one goal to expire at a time
-  rcl_action_goal_info_t expired_goals[1];
-  size_t num_expired = 1;
+  // Size the batch from the timer wheel; each rcl_action_expire_goals() call
+  // scans every goal handle held by the server, so a server holding many
+  // terminated goals wants one appropriately sized call, not one per goal.
+  size_t capacity = 1;
+  {
+    std::lock_guard<std::recursive_mutex> lock(pimpl_->unordered_map_mutex_);
+    capacity = std::max<size_t>(
+      1u, pimpl_->expiry_wheel_.count_due(pimpl_->clock_->now().nanoseconds()));
+  }
+  std::vector<rcl_action_goal_info_t> expired_goals(capacity);
+  size_t num_expired = 0;
 
-  // Loop in case more than 1 goal expired
-  while (num_expired > 0u) {
+  // Loop in case more goals expired than the wheel predicted
+  do {
     rcl_ret_t ret;
     {
       std::lock_guard<std::recursive_mutex> lock(pimpl_->action_server_reentrant_mutex_);
-      ret = rcl_action_expire_goals(pimpl_->action_server_.get(), expired_goals, 1, &num_expired);
+      ret = rcl_action_expire_goals(
+        pimpl_->action_server_.get(), expired_goals.data(), capacity, &num_expired);
     }
     if (RCL_RET_OK != ret) {
       rclcpp::exceptions::throw_from_rcl_error(ret);
-    } else if (num_expired) {
-      // A goal expired!
+    }
+    for (size_t i = 0; i < num_expired; ++i) {
       GoalUUID uuid;
-      convert(expired_goals[0], &uuid);
+      convert(expired_goals[i], &uuid);
       RCLCPP_DEBUG(pimpl_->logger_, "Expired goal %s", to_string(uuid).c_str());
-      std::lock_guard<std::recursive_mutex> lock(pimpl_->unordered_map_mutex_);
-      pimpl_->goal_results_.erase(uuid);
-      pimpl_->result_requests_.erase(uuid);
+      {
+        std::lock_guard<std::recursive_mutex> lock(pimpl_->unordered_map_mutex_);
+        pimpl_->goal_results_.erase(uuid);
+        pimpl_->result_requests_.erase(uuid);
+        pimpl_->expiry_wheel_.cancel(uuid);
+      }
+      {
+        std::lock_guard<std::mutex> lock(pimpl_->feedback_gates_mutex_);
+        pimpl_->feedback_gates_.erase(uuid);
+      }
+      std::lock_guard<std::mutex> lock(pimpl_->goal_handles_mutex_);
       pimpl_->goal_handles_.erase(uuid);
     }
-  }
+  } while (num_expired == capacity);
 }
 
 void
@@ -649,6 +791,21 @@ ServerBase::publish_result(const GoalUUID & uuid, std::shared_ptr<void> result_m
     throw std::runtime_error("Asked to publish result for goal that does not exist");
   }
 
+  // Flush any feedback sample still held back by a conflating policy and drop
+  // the gate; no more feedback follows for this goal.
+  std::shared_ptr<void> pending_feedback;
+  {
+    std::lock_guard<std::mutex> lock(pimpl_->feedback_gates_mutex_);
+    auto gate_iter = pimpl_->feedback_gates_.find(uuid);
+    if (gate_iter != pimpl_->feedback_gates_.end()) {
+      pending_feedback = std::move(gate_iter->second.pending);
+      pimpl_->feedback_gates_.erase(gate_iter);
+    }
+  }
+  if (pending_feedback) {
+    publish_feedback(std::move(pending_feedback));
+  }
+
   {
     /**
     * NOTE: There is a potential deadlock issue if both unordered_map_mutex_ and
@@ -663,6 +820,12 @@ ServerBase::publish_result(const GoalUUID & uuid, std::shared_ptr<void> result_m
     */
     std::lock_guard<std::recursive_mutex> unordered_map_lock(pimpl_->unordered_map_mutex_);
     pimpl_->goal_results_[uuid] = result_msg;
+    if (pimpl_->result_timeout_ns_ >= 0) {
+      // Terminal state reached: the result now lives until the server's
+      // result timeout, track the deadline in the expiry wheel.
+      pimpl_->expiry_wheel_.schedule(
+        uuid, pimpl_->clock_->now().nanoseconds() + pimpl_->result_timeout_ns_);
+    }
 
     // if there are clients who already asked for the result, send it to them
     auto iter = pimpl_->result_requests_.find(uuid);
@@ -692,6 +855,21 @@ ServerBase::notify_goal_terminal_state()
 void
 ServerBase::publish_feedback(std::shared_ptr<void> feedback_msg)
 {
+  if (pimpl_->use_intra_process_) {
+    auto ipm = pimpl_->weak_ipm_.lock();
+    if (ipm) {
+      // Matched in-process clients buffer the message itself, skipping
+      // serialization, and dispatch it from their own executors. Each of
+      // them drops exactly one middleware copy of this publish, which still
+      // serves any remote clients.
+      for (auto & endpoint : ipm->get_matching_action_clients(
+          pimpl_->intra_process_action_name_, pimpl_->intra_process_type_support_))
+      {
+        std::static_pointer_cast<ClientBase>(endpoint)->handle_intra_process_feedback_message(
+          feedback_msg);
+      }
+    }
+  }
   std::lock_guard<std::recursive_mutex> lock(pimpl_->action_server_reentrant_mutex_);
   rcl_ret_t ret = rcl_action_publish_feedback(pimpl_->action_server_.get(), feedback_msg.get());
   if (RCL_RET_OK != ret) {
@@ -699,6 +877,51 @@ ServerBase::publish_feedback(std::shared_ptr<void> feedback_msg)
   }
 }
 
+void
+ServerBase::publish_feedback(const GoalUUID & uuid, std::shared_ptr<void> feedback_msg)
+{
+  {
+    std::lock_guard<std::mutex> lock(pimpl_->feedback_gates_mutex_);
+    auto it = pimpl_->feedback_gates_.find(uuid);
+    if (it != pimpl_->feedback_gates_.end()) {
+      ServerBaseImpl::FeedbackGate & gate = it->second;
+      const auto now = std::chrono::steady_clock::now();
+      if (now - gate.last_publish_time < gate.period) {
+        if (FeedbackPolicy::CONFLATE == gate.policy) {
+          // Keep only the newest sample; it is flushed when the goal reaches a
+          // terminal state unless something newer makes it out first.
+          gate.pending = std::move(feedback_msg);
+        }
+        return;
+      }
+      gate.last_publish_time = now;
+      // The incoming sample supersedes anything held back earlier
+      gate.pending.reset();
+    }
+  }
+  publish_feedback(std::move(feedback_msg));
+}
+
+void
+ServerBase::set_feedback_policy(
+  const GoalUUID & uuid, FeedbackPolicy policy, std::chrono::nanoseconds period)
+{
+  if (FeedbackPolicy::PUBLISH_ALL != policy && period <= std::chrono::nanoseconds(0)) {
+    throw std::invalid_argument("feedback policy period must be positive");
+  }
+  std::lock_guard<std::mutex> lock(pimpl_->feedback_gates_mutex_);
+  if (FeedbackPolicy::PUBLISH_ALL == policy) {
+    pimpl_->feedback_gates_.erase(uuid);
+    return;
+  }
+  ServerBaseImpl::FeedbackGate & gate = pimpl_->feedback_gates_[uuid];
+  gate.policy = policy;
+  gate.period = period;
+  // The first sample published after a policy change always goes out
+  gate.last_publish_time = std::chrono::steady_clock::time_point();
+  gate.pending.reset();
+}
+
 void
 ServerBase::set_on_ready_callback(std::function<void(size_t, int)> callback)
 {
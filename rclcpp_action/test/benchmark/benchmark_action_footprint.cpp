@@ -0,0 +1,152 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+#include "rclcpp_action/rclcpp_action.hpp"
+#include "rclcpp/rclcpp.hpp"
+#include "test_msgs/action/fibonacci.hpp"
+
+using performance_test_fixture::PerformanceTest;
+
+using Fibonacci = test_msgs::action::Fibonacci;
+
+namespace
+{
+
+/// Net bytes currently allocated through the replaced global operator new.
+std::atomic<int64_t> g_live_bytes {0};
+
+/// Prefix storing the allocation size, kept maximally aligned.
+constexpr size_t kHeaderSize = alignof(std::max_align_t);
+
+constexpr size_t kEntitiesPerSample = 16;
+
+}  // namespace
+
+// Counting global allocation functions, the action-side companion of the
+// entity footprint benchmark in rclcpp (see benchmark_memory_footprint.cpp
+// there for the measurement rationale).
+void *
+operator new(std::size_t size)
+{
+  void * raw = std::malloc(size + kHeaderSize);
+  if (nullptr == raw) {
+    throw std::bad_alloc();
+  }
+  *static_cast<size_t *>(raw) = size;
+  g_live_bytes.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed);
+  return static_cast<char *>(raw) + kHeaderSize;
+}
+
+void
+operator delete(void * pointer) noexcept
+{
+  if (nullptr == pointer) {
+    return;
+  }
+  void * raw = static_cast<char *>(pointer) - kHeaderSize;
+  const size_t size = *static_cast<size_t *>(raw);
+  g_live_bytes.fetch_sub(static_cast<int64_t>(size), std::memory_order_relaxed);
+  std::free(raw);
+}
+
+void
+operator delete(void * pointer, std::size_t) noexcept
+{
+  operator delete(pointer);
+}
+
+class ActionFootprintTest : public PerformanceTest
+{
+public:
+  void SetUp(benchmark::State & state)
+  {
+    rclcpp::init(0, nullptr);
+    node = std::make_shared<rclcpp::Node>("action_footprint_node");
+    PerformanceTest::SetUp(state);
+  }
+
+  void TearDown(benchmark::State & state)
+  {
+    PerformanceTest::TearDown(state);
+    node.reset();
+    rclcpp::shutdown();
+  }
+
+protected:
+  std::shared_ptr<rclcpp::Node> node;
+};
+
+BENCHMARK_F(ActionFootprintTest, action_server_footprint)(benchmark::State & state)
+{
+  auto handle_goal =
+    [](const rclcpp_action::GoalUUID &, std::shared_ptr<const Fibonacci::Goal>) {
+      return rclcpp_action::GoalResponse::ACCEPT_AND_EXECUTE;
+    };
+  auto handle_cancel =
+    [](std::shared_ptr<rclcpp_action::ServerGoalHandle<Fibonacci>>) {
+      return rclcpp_action::CancelResponse::ACCEPT;
+    };
+  auto handle_accepted = [](std::shared_ptr<rclcpp_action::ServerGoalHandle<Fibonacci>>) {};
+
+  for (auto _ : state) {
+    (void)_;
+    std::vector<std::shared_ptr<void>> servers;
+    servers.reserve(kEntitiesPerSample);
+    const int64_t before = g_live_bytes.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < kEntitiesPerSample; i++) {
+      servers.push_back(
+        rclcpp_action::create_server<Fibonacci>(
+          node, "footprint_" + std::to_string(i),
+          handle_goal, handle_cancel, handle_accepted));
+    }
+    const int64_t after = g_live_bytes.load(std::memory_order_relaxed);
+    state.counters["bytes_per_action_server"] =
+      static_cast<double>(after - before) / static_cast<double>(kEntitiesPerSample);
+
+    state.PauseTiming();
+    servers.clear();
+    state.ResumeTiming();
+  }
+}
+
+BENCHMARK_F(ActionFootprintTest, action_client_footprint)(benchmark::State & state)
+{
+  for (auto _ : state) {
+    (void)_;
+    std::vector<std::shared_ptr<void>> clients;
+    clients.reserve(kEntitiesPerSample);
+    const int64_t before = g_live_bytes.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < kEntitiesPerSample; i++) {
+      clients.push_back(
+        rclcpp_action::create_client<Fibonacci>(node, "footprint_" + std::to_string(i)));
+    }
+    const int64_t after = g_live_bytes.load(std::memory_order_relaxed);
+    state.counters["bytes_per_action_client"] =
+      static_cast<double>(after - before) / static_cast<double>(kEntitiesPerSample);
+
+    state.PauseTiming();
+    clients.clear();
+    state.ResumeTiming();
+  }
+}
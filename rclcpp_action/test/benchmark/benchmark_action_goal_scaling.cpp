@@ -0,0 +1,173 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "performance_test_fixture/performance_test_fixture.hpp"
+#include "rclcpp_action/rclcpp_action.hpp"
+#include "rclcpp/rclcpp.hpp"
+#include "test_msgs/action/fibonacci.hpp"
+
+/**
+ * Benchmarks for how the action server scales with the number of concurrent
+ * goals.  The server tracks every live goal in UUID-keyed maps behind a
+ * recursive mutex, so per-goal costs that look flat with a single goal can
+ * grow once dozens of goals are in flight.
+ */
+
+using performance_test_fixture::PerformanceTest;
+
+using Fibonacci = test_msgs::action::Fibonacci;
+using GoalHandle = rclcpp_action::ServerGoalHandle<Fibonacci>;
+using GoalUUID = rclcpp_action::GoalUUID;
+
+constexpr char fibonacci_action_name[] = "fibonacci";
+
+class ActionGoalScalingTest : public PerformanceTest
+{
+public:
+  void SetUp(benchmark::State & state)
+  {
+    rclcpp::init(0, nullptr);
+    node = std::make_shared<rclcpp::Node>("node", "ns");
+    action_client =
+      rclcpp_action::create_client<Fibonacci>(node, fibonacci_action_name);
+    performance_test_fixture::PerformanceTest::SetUp(state);
+  }
+
+  void TearDown(benchmark::State & state)
+  {
+    performance_test_fixture::PerformanceTest::TearDown(state);
+
+    action_client.reset();
+    node.reset();
+    rclcpp::shutdown();
+  }
+
+  auto AsyncSendGoalOfOrder(const int order)
+  {
+    test_msgs::action::Fibonacci::Goal goal;
+    goal.order = order;
+
+    return action_client->async_send_goal(goal);
+  }
+
+  /// Send count goals and spin until the server has accepted all of them.
+  bool SpawnAcceptedGoals(benchmark::State & state, int count)
+  {
+    for (int i = 0; i < count; ++i) {
+      auto client_goal_handle_future = AsyncSendGoalOfOrder(1);
+      rclcpp::spin_until_future_complete(node, client_goal_handle_future);
+      auto goal_handle = client_goal_handle_future.get();
+      if (rclcpp_action::GoalStatus::STATUS_ACCEPTED != goal_handle->get_status()) {
+        state.SkipWithError("Background goal was not accepted");
+        return false;
+      }
+    }
+    return true;
+  }
+
+protected:
+  std::shared_ptr<rclcpp::Node> node;
+  std::shared_ptr<rclcpp_action::Client<Fibonacci>> action_client;
+};
+
+BENCHMARK_DEFINE_F(ActionGoalScalingTest, accept_goal_with_concurrent_goals)(
+  benchmark::State & state)
+{
+  std::vector<std::shared_ptr<GoalHandle>> server_goal_handles;
+  auto action_server = rclcpp_action::create_server<Fibonacci>(
+    node, fibonacci_action_name,
+    [](const GoalUUID &, std::shared_ptr<const Fibonacci::Goal>) {
+      return rclcpp_action::GoalResponse::ACCEPT_AND_DEFER;
+    },
+    [](std::shared_ptr<GoalHandle>) {
+      return rclcpp_action::CancelResponse::ACCEPT;
+    },
+    [&server_goal_handles](std::shared_ptr<GoalHandle> goal_handle) {
+      server_goal_handles.push_back(goal_handle);
+    });
+
+  // Fill the server's goal tables with long-lived goals before measuring.
+  const int concurrent_goals = static_cast<int>(state.range(0));
+  if (!SpawnAcceptedGoals(state, concurrent_goals)) {
+    return;
+  }
+
+  auto result = std::make_shared<Fibonacci::Result>();
+  reset_heap_counters();
+  for (auto _ : state) {
+    (void)_;
+    state.PauseTiming();
+    auto client_goal_handle_future = AsyncSendGoalOfOrder(1);
+    state.ResumeTiming();
+
+    rclcpp::spin_until_future_complete(node, client_goal_handle_future);
+    auto goal_handle = client_goal_handle_future.get();
+    if (rclcpp_action::GoalStatus::STATUS_ACCEPTED != goal_handle->get_status()) {
+      state.SkipWithError("Valid goal was not accepted");
+      return;
+    }
+
+    state.PauseTiming();
+    // Retire the measured goal so only the background goals persist.
+    server_goal_handles.back()->execute();
+    server_goal_handles.back()->abort(result);
+    server_goal_handles.pop_back();
+    state.ResumeTiming();
+  }
+}
+BENCHMARK_REGISTER_F(ActionGoalScalingTest, accept_goal_with_concurrent_goals)
+->Arg(1)->Arg(10)->Arg(100);
+
+BENCHMARK_DEFINE_F(ActionGoalScalingTest, publish_feedback_concurrent_goals)(
+  benchmark::State & state)
+{
+  std::vector<std::shared_ptr<GoalHandle>> server_goal_handles;
+  auto action_server = rclcpp_action::create_server<Fibonacci>(
+    node, fibonacci_action_name,
+    [](const GoalUUID &, std::shared_ptr<const Fibonacci::Goal>) {
+      return rclcpp_action::GoalResponse::ACCEPT_AND_EXECUTE;
+    },
+    [](std::shared_ptr<GoalHandle>) {
+      return rclcpp_action::CancelResponse::ACCEPT;
+    },
+    [&server_goal_handles](std::shared_ptr<GoalHandle> goal_handle) {
+      server_goal_handles.push_back(goal_handle);
+    });
+
+  const int concurrent_goals = static_cast<int>(state.range(0));
+  if (!SpawnAcceptedGoals(state, concurrent_goals)) {
+    return;
+  }
+
+  auto feedback = std::make_shared<Fibonacci::Feedback>();
+  reset_heap_counters();
+  for (auto _ : state) {
+    (void)_;
+    for (const auto & goal_handle : server_goal_handles) {
+      goal_handle->publish_feedback(feedback);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * concurrent_goals);
+
+  auto result = std::make_shared<Fibonacci::Result>();
+  for (const auto & goal_handle : server_goal_handles) {
+    goal_handle->abort(result);
+  }
+}
+BENCHMARK_REGISTER_F(ActionGoalScalingTest, publish_feedback_concurrent_goals)
+->Arg(1)->Arg(10)->Arg(100);
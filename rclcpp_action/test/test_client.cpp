@@ -570,6 +570,41 @@ TEST_F(TestClientAgainstServer, async_send_goal_with_feedback_callback_wait_for_
   EXPECT_EQ(5, feedback_count);
 }
 
+TEST_F(TestClientAgainstServer, async_send_goal_with_conflated_feedback)
+{
+  auto action_client = rclcpp_action::create_client<ActionType>(client_node, action_name);
+  ASSERT_TRUE(action_client->wait_for_action_server(WAIT_FOR_SERVER_TIMEOUT));
+
+  ActionGoal goal;
+  goal.order = 4;
+  int feedback_count = 0;
+  size_t last_feedback_sequence_size = 0;
+  auto send_goal_ops = rclcpp_action::Client<ActionType>::SendGoalOptions();
+  // Larger than the whole exchange, so only the first sample is delivered
+  // directly; the rest are conflated and the newest flushed with the result.
+  send_goal_ops.feedback_conflation_period = std::chrono::seconds(60);
+  send_goal_ops.feedback_callback =
+    [&feedback_count, &last_feedback_sequence_size](
+    typename ActionGoalHandle::SharedPtr goal_handle,
+    const std::shared_ptr<const ActionFeedback> feedback)
+    {
+      (void)goal_handle;
+      feedback_count++;
+      last_feedback_sequence_size = feedback->sequence.size();
+    };
+  auto future_goal_handle = action_client->async_send_goal(goal, send_goal_ops);
+  dual_spin_until_future_complete(future_goal_handle);
+  auto goal_handle = future_goal_handle.get();
+  auto future_result = action_client->async_get_result(goal_handle);
+  dual_spin_until_future_complete(future_result);
+  auto wrapped_result = future_result.get();
+
+  ASSERT_EQ(5u, wrapped_result.result->sequence.size());
+  // First sample plus the conflated newest one flushed with the result.
+  EXPECT_EQ(2, feedback_count);
+  EXPECT_EQ(5u, last_feedback_sequence_size);
+}
+
 TEST_F(TestClientAgainstServer, async_send_goal_with_result_callback_wait_for_result)
 {
   auto action_client = rclcpp_action::create_client<ActionType>(client_node, action_name);
@@ -640,6 +675,51 @@ TEST_F(TestClientAgainstServer, async_get_result_with_callback)
   EXPECT_EQ(3, wrapped_result.result->sequence.back());
 }
 
+TEST_F(TestClientAgainstServer, async_get_result_shared_and_cached)
+{
+  auto action_client = rclcpp_action::create_client<ActionType>(client_node, action_name);
+  ASSERT_TRUE(action_client->wait_for_action_server(WAIT_FOR_SERVER_TIMEOUT));
+
+  ActionGoal goal;
+  goal.order = 4;
+  auto future_goal_handle = action_client->async_send_goal(goal);
+  dual_spin_until_future_complete(future_goal_handle);
+  auto goal_handle = future_goal_handle.get();
+
+  // Both callers share one underlying result request, each with its own callback
+  size_t first_callback_count = 0;
+  size_t second_callback_count = 0;
+  auto future_result = action_client->async_get_result(
+    goal_handle,
+    [&first_callback_count](const typename ActionGoalHandle::WrappedResult &)
+    {
+      ++first_callback_count;
+    });
+  auto other_future_result = action_client->async_get_result(
+    goal_handle,
+    [&second_callback_count](const typename ActionGoalHandle::WrappedResult &)
+    {
+      ++second_callback_count;
+    });
+  dual_spin_until_future_complete(future_result);
+  EXPECT_EQ(
+    std::future_status::ready, other_future_result.wait_for(std::chrono::seconds(0)));
+  EXPECT_EQ(1u, first_callback_count);
+  EXPECT_EQ(1u, second_callback_count);
+
+  // The goal terminated; repeat queries are served from the result cache
+  auto cached_result = action_client->async_get_result(
+    goal_handle,
+    [&second_callback_count](const typename ActionGoalHandle::WrappedResult &)
+    {
+      ++second_callback_count;
+    });
+  ASSERT_EQ(std::future_status::ready, cached_result.wait_for(std::chrono::seconds(0)));
+  EXPECT_EQ(2u, second_callback_count);
+  EXPECT_EQ(rclcpp_action::ResultCode::SUCCEEDED, cached_result.get().code);
+  ASSERT_EQ(5u, cached_result.get().result->sequence.size());
+}
+
 TEST_F(TestClientAgainstServer, async_cancel_one_goal)
 {
   auto action_client = rclcpp_action::create_client<ActionType>(client_node, action_name);
@@ -0,0 +1,107 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include "rclcpp_action/goal_uuid_table.hpp"
+
+using rclcpp_action::GoalUUID;
+using rclcpp_action::GoalUuidTable;
+
+namespace
+{
+GoalUUID
+make_uuid(uint8_t seed)
+{
+  GoalUUID uuid;
+  for (uint8_t i = 0; i < UUID_SIZE; ++i) {
+    uuid[i] = static_cast<uint8_t>(seed + i);
+  }
+  return uuid;
+}
+}  // namespace
+
+TEST(TestGoalUuidTable, insert_find_erase) {
+  GoalUuidTable<int> table;
+  EXPECT_EQ(0u, table.size());
+
+  table.insert_or_assign(make_uuid(1), 42);
+  ASSERT_NE(nullptr, table.find(make_uuid(1)));
+  EXPECT_EQ(42, *table.find(make_uuid(1)));
+  EXPECT_EQ(1u, table.size());
+
+  // Assigning again replaces the value without growing the table
+  table.insert_or_assign(make_uuid(1), 43);
+  EXPECT_EQ(43, *table.find(make_uuid(1)));
+  EXPECT_EQ(1u, table.size());
+
+  EXPECT_EQ(nullptr, table.find(make_uuid(2)));
+  EXPECT_FALSE(table.erase(make_uuid(2)));
+
+  EXPECT_TRUE(table.erase(make_uuid(1)));
+  EXPECT_EQ(nullptr, table.find(make_uuid(1)));
+  EXPECT_EQ(0u, table.size());
+}
+
+TEST(TestGoalUuidTable, index_generation_check) {
+  GoalUuidTable<int> table;
+
+  auto index = table.insert_or_assign(make_uuid(1), 42);
+  ASSERT_NE(nullptr, table.get(index));
+  EXPECT_EQ(42, *table.get(index));
+
+  EXPECT_TRUE(table.erase(index));
+  // The index is now stale
+  EXPECT_EQ(nullptr, table.get(index));
+  EXPECT_FALSE(table.erase(index));
+
+  // A reused slot rejects the stale index but honors the fresh one
+  auto fresh_index = table.insert_or_assign(make_uuid(1), 43);
+  EXPECT_EQ(nullptr, table.get(index));
+  ASSERT_NE(nullptr, table.get(fresh_index));
+  EXPECT_EQ(43, *table.get(fresh_index));
+}
+
+TEST(TestGoalUuidTable, grows_past_initial_capacity) {
+  GoalUuidTable<size_t> table;
+  constexpr size_t num_entries = 200u;
+
+  for (size_t i = 0; i < num_entries; ++i) {
+    table.insert_or_assign(make_uuid(static_cast<uint8_t>(i)), i);
+  }
+  EXPECT_EQ(num_entries, table.size());
+  for (size_t i = 0; i < num_entries; ++i) {
+    auto * value = table.find(make_uuid(static_cast<uint8_t>(i)));
+    ASSERT_NE(nullptr, value);
+    EXPECT_EQ(i, *value);
+  }
+
+  for (size_t i = 0; i < num_entries; ++i) {
+    EXPECT_TRUE(table.erase(make_uuid(static_cast<uint8_t>(i))));
+  }
+  EXPECT_EQ(0u, table.size());
+}
+
+TEST(TestGoalUuidTable, reuses_erased_slots) {
+  GoalUuidTable<size_t> table;
+
+  // Churn through many more goals than the initial capacity, keeping only
+  // a few live; erased slots must be reclaimed instead of poisoning probes.
+  for (size_t i = 0; i < 1000u; ++i) {
+    auto index = table.insert_or_assign(make_uuid(static_cast<uint8_t>(i % 251u)), i);
+    ASSERT_NE(nullptr, table.get(index));
+    EXPECT_TRUE(table.erase(index));
+  }
+  EXPECT_EQ(0u, table.size());
+}
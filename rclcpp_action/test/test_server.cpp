@@ -25,6 +25,7 @@
 
 #include "rcl_action/action_server.h"
 #include "rcl_action/wait.h"
+#include "rclcpp_action/create_client.hpp"
 #include "rclcpp_action/create_server.hpp"
 #include "rclcpp_action/server.hpp"
 #include "mocking_utils/patch.hpp"
@@ -825,6 +826,179 @@ TEST_F(TestServer, publish_feedback)
   ASSERT_EQ(sent_message->sequence, msg->feedback.sequence);
 }
 
+TEST_F(TestServer, publish_feedback_intra_process)
+{
+  auto node = std::make_shared<rclcpp::Node>(
+    "pub_feedback_ipc", "/rclcpp_action/pub_feedback_ipc",
+    rclcpp::NodeOptions().use_intra_process_comms(true));
+
+  auto handle_goal = [](
+    const GoalUUID &, std::shared_ptr<const Fibonacci::Goal>)
+    {
+      return rclcpp_action::GoalResponse::ACCEPT_AND_EXECUTE;
+    };
+
+  using GoalHandle = rclcpp_action::ServerGoalHandle<Fibonacci>;
+
+  auto handle_cancel = [](std::shared_ptr<GoalHandle>)
+    {
+      return rclcpp_action::CancelResponse::REJECT;
+    };
+
+  std::shared_ptr<GoalHandle> received_handle;
+  auto handle_accepted = [&received_handle](std::shared_ptr<GoalHandle> handle)
+    {
+      received_handle = handle;
+    };
+
+  auto as = rclcpp_action::create_server<Fibonacci>(
+    node, "fibonacci",
+    handle_goal,
+    handle_cancel,
+    handle_accepted);
+  (void)as;
+
+  auto ac = rclcpp_action::create_client<Fibonacci>(node, "fibonacci");
+  ASSERT_TRUE(ac->wait_for_action_server(std::chrono::seconds(20)));
+
+  std::vector<std::shared_ptr<const Fibonacci::Feedback>> received_feedbacks;
+  rclcpp_action::Client<Fibonacci>::SendGoalOptions options;
+  options.feedback_callback =
+    [&received_feedbacks](
+    rclcpp_action::ClientGoalHandle<Fibonacci>::SharedPtr,
+    const std::shared_ptr<const Fibonacci::Feedback> feedback)
+    {
+      received_feedbacks.push_back(feedback);
+    };
+
+  auto goal_handle_future = ac->async_send_goal(Fibonacci::Goal(), options);
+  ASSERT_EQ(
+    rclcpp::FutureReturnCode::SUCCESS,
+    rclcpp::spin_until_future_complete(node, goal_handle_future, std::chrono::seconds(20)));
+  ASSERT_NE(nullptr, received_handle);
+
+  auto sent_message = std::make_shared<Fibonacci::Feedback>();
+  sent_message->sequence = {1, 1, 2, 3, 5};
+  received_handle->publish_feedback(sent_message);
+
+  // Feedback is buffered, not run inline on the publishing thread; it is
+  // delivered once the client's executor spins.
+  EXPECT_EQ(0u, received_feedbacks.size());
+  for (size_t retry = 0; retry < 100 && received_feedbacks.empty(); ++retry) {
+    rclcpp::spin_some(node);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  ASSERT_EQ(1u, received_feedbacks.size());
+  EXPECT_EQ(sent_message->sequence, received_feedbacks.back()->sequence);
+
+  // The copy published over the middleware must be dropped as a duplicate.
+  for (size_t retry = 0; retry < 10; ++retry) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    rclcpp::spin_some(node);
+  }
+  EXPECT_EQ(1u, received_feedbacks.size());
+}
+
+TEST_F(TestServer, feedback_policy)
+{
+  auto node = std::make_shared<rclcpp::Node>(
+    "feedback_policy", "/rclcpp_action/feedback_policy",
+    rclcpp::NodeOptions().use_intra_process_comms(true));
+
+  auto handle_goal = [](
+    const GoalUUID &, std::shared_ptr<const Fibonacci::Goal>)
+    {
+      return rclcpp_action::GoalResponse::ACCEPT_AND_EXECUTE;
+    };
+
+  using GoalHandle = rclcpp_action::ServerGoalHandle<Fibonacci>;
+
+  auto handle_cancel = [](std::shared_ptr<GoalHandle>)
+    {
+      return rclcpp_action::CancelResponse::REJECT;
+    };
+
+  std::shared_ptr<GoalHandle> received_handle;
+  auto handle_accepted = [&received_handle](std::shared_ptr<GoalHandle> handle)
+    {
+      received_handle = handle;
+    };
+
+  auto as = rclcpp_action::create_server<Fibonacci>(
+    node, "fibonacci",
+    handle_goal,
+    handle_cancel,
+    handle_accepted);
+  (void)as;
+
+  auto ac = rclcpp_action::create_client<Fibonacci>(node, "fibonacci");
+  ASSERT_TRUE(ac->wait_for_action_server(std::chrono::seconds(20)));
+
+  std::vector<std::shared_ptr<const Fibonacci::Feedback>> received_feedbacks;
+  rclcpp_action::Client<Fibonacci>::SendGoalOptions options;
+  options.feedback_callback =
+    [&received_feedbacks](
+    rclcpp_action::ClientGoalHandle<Fibonacci>::SharedPtr,
+    const std::shared_ptr<const Fibonacci::Feedback> feedback)
+    {
+      received_feedbacks.push_back(feedback);
+    };
+
+  auto goal_handle_future = ac->async_send_goal(Fibonacci::Goal(), options);
+  ASSERT_EQ(
+    rclcpp::FutureReturnCode::SUCCESS,
+    rclcpp::spin_until_future_complete(node, goal_handle_future, std::chrono::seconds(20)));
+  ASSERT_NE(nullptr, received_handle);
+
+  auto publish = [&received_handle](int32_t value)
+    {
+      auto msg = std::make_shared<Fibonacci::Feedback>();
+      msg->sequence = {value};
+      received_handle->publish_feedback(msg);
+    };
+
+  // Feedback is buffered on the client side, so spin to deliver it.
+  auto spin_until_feedback_count = [&node, &received_feedbacks](size_t count)
+    {
+      for (size_t retry = 0; retry < 100 && received_feedbacks.size() < count; ++retry) {
+        rclcpp::spin_some(node);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      }
+    };
+
+  // A limiting policy requires a positive period
+  EXPECT_THROW(
+    received_handle->set_feedback_policy(rclcpp_action::FeedbackPolicy::RATE_LIMIT),
+    std::invalid_argument);
+
+  // Rate limiting publishes only the first sample of a burst
+  received_handle->set_feedback_policy(
+    rclcpp_action::FeedbackPolicy::RATE_LIMIT, std::chrono::seconds(10));
+  publish(1);
+  publish(2);
+  publish(3);
+  spin_until_feedback_count(1u);
+  ASSERT_EQ(1u, received_feedbacks.size());
+  EXPECT_EQ(1, received_feedbacks.back()->sequence[0]);
+
+  // Conflation keeps the newest held-back sample; the first sample after a
+  // policy change always goes out
+  received_handle->set_feedback_policy(
+    rclcpp_action::FeedbackPolicy::CONFLATE, std::chrono::seconds(10));
+  publish(4);
+  publish(5);
+  publish(6);
+  spin_until_feedback_count(2u);
+  ASSERT_EQ(2u, received_feedbacks.size());
+  EXPECT_EQ(4, received_feedbacks.back()->sequence[0]);
+
+  // Reaching a terminal state flushes the held-back sample
+  received_handle->succeed(std::make_shared<Fibonacci::Result>());
+  spin_until_feedback_count(3u);
+  ASSERT_EQ(3u, received_feedbacks.size());
+  EXPECT_EQ(6, received_feedbacks.back()->sequence[0]);
+}
+
 TEST_F(TestServer, get_result)
 {
   auto node = std::make_shared<rclcpp::Node>("get_result", "/rclcpp_action/get_result");
@@ -903,6 +1077,76 @@ TEST_F(TestServer, get_result)
   EXPECT_EQ(action_msgs::msg::GoalStatus::STATUS_UNKNOWN, response->status);
 }
 
+TEST_F(TestServer, goals_expire_in_batch)
+{
+  auto node = std::make_shared<rclcpp::Node>("expire_batch", "/rclcpp_action/expire_batch");
+
+  auto handle_goal = [](
+    const GoalUUID &, std::shared_ptr<const Fibonacci::Goal>)
+    {
+      return rclcpp_action::GoalResponse::ACCEPT_AND_EXECUTE;
+    };
+
+  using GoalHandle = rclcpp_action::ServerGoalHandle<Fibonacci>;
+
+  auto handle_cancel = [](std::shared_ptr<GoalHandle>)
+    {
+      return rclcpp_action::CancelResponse::REJECT;
+    };
+
+  std::vector<std::shared_ptr<GoalHandle>> received_handles;
+  auto handle_accepted = [&received_handles](std::shared_ptr<GoalHandle> handle)
+    {
+      received_handles.push_back(handle);
+    };
+
+  const std::chrono::milliseconds result_timeout{50};
+
+  rcl_action_server_options_t options = rcl_action_server_get_default_options();
+  options.result_timeout.nanoseconds = RCL_MS_TO_NS(result_timeout.count());
+  auto as = rclcpp_action::create_server<Fibonacci>(
+    node, "fibonacci",
+    handle_goal,
+    handle_cancel,
+    handle_accepted,
+    options);
+  (void)as;
+
+  // Terminate several goals together so a single goal_expired event has to
+  // expire a whole batch.
+  constexpr uint8_t num_goals = 5;
+  std::vector<GoalUUID> uuids;
+  for (uint8_t i = 0; i < num_goals; ++i) {
+    const GoalUUID uuid{{i, 2, 3, 4, 5, 6, 7, 80, 90, 10, 11, 12, 13, 14, 15, 160}};
+    send_goal_request(node, uuid);
+    uuids.push_back(uuid);
+  }
+  ASSERT_EQ(static_cast<size_t>(num_goals), received_handles.size());
+  for (auto & handle : received_handles) {
+    handle->succeed(std::make_shared<Fibonacci::Result>());
+  }
+
+  // Wait for goal expiration, then let the server process it
+  rclcpp::sleep_for(2 * result_timeout);
+  rclcpp::spin_some(node);
+
+  // All results must be gone
+  auto result_client = node->create_client<Fibonacci::Impl::GetResultService>(
+    "fibonacci/_action/get_result");
+  if (!result_client->wait_for_service(std::chrono::seconds(20))) {
+    throw std::runtime_error("get result service didn't become available");
+  }
+  for (const auto & uuid : uuids) {
+    auto request = std::make_shared<Fibonacci::Impl::GetResultService::Request>();
+    request->goal_id.uuid = uuid;
+    auto future = result_client->async_send_request(request);
+    ASSERT_EQ(
+      rclcpp::FutureReturnCode::SUCCESS,
+      rclcpp::spin_until_future_complete(node, future));
+    EXPECT_EQ(action_msgs::msg::GoalStatus::STATUS_UNKNOWN, future.get()->status);
+  }
+}
+
 TEST_F(TestServer, get_result_deferred)
 {
   auto node = std::make_shared<rclcpp::Node>("get_result", "/rclcpp_action/get_result");
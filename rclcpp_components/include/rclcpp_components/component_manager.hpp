@@ -44,6 +44,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -91,9 +92,11 @@ public:
   /// Default constructor
   /**
    * Initializes the component manager. It creates the services: load node, unload node
-   * and list nodes.
+   * and list nodes. The services execute on a dedicated internal executor
+   * thread, so loading a component with a slow constructor does not stall the
+   * callbacks of components spinning on the container's executor.
    *
-   * \param executor the executor which will spin the node.
+   * \param executor the executor which will spin the loaded components.
    * \param node_name the name of the node that the data originates from.
    * \param node_options additional options to control creation of the node.
    */
@@ -139,7 +142,54 @@ public:
   virtual void
   set_executor(const std::weak_ptr<rclcpp::Executor> executor);
 
+  /// Load a batch of components, loading the libraries concurrently.
+  /**
+   * The distinct libraries referenced by the requests are resolved up front
+   * and loaded concurrently on a thread pool sized by the 'thread_num'
+   * parameter, which dominates container bring-up time.
+   * The node instances are then constructed serially in request order, since
+   * component construction mutates shared container state and dependencies
+   * between components are not modeled.
+   * Each request is handled like on_load_node(), including per-request error
+   * reporting in the matching response.
+   *
+   * \param requests load requests, handled like on_load_node()
+   * \return one response per request, in the same order
+   */
+  RCLCPP_COMPONENTS_PUBLIC
+  virtual std::vector<std::shared_ptr<LoadNode::Response>>
+  load_nodes(const std::vector<std::shared_ptr<LoadNode::Request>> & requests);
+
+  /// Load the libraries providing a package's components before first use.
+  /**
+   * Every component library registered by the package is loaded concurrently
+   * on a thread pool sized by the 'thread_num' parameter, so that later load
+   * requests only have to construct nodes.
+   *
+   * \param package_name name of the package
+   * \param resource_index name of the executable
+   * \throws ComponentManagerException if the resource was not found or a
+   *   library could not be loaded
+   */
+  RCLCPP_COMPONENTS_PUBLIC
+  virtual void
+  preload_component_libraries(
+    const std::string & package_name,
+    const std::string & resource_index = "rclcpp_components");
+
 protected:
+  /// Load the given libraries concurrently and store their class loaders.
+  /**
+   * Libraries which are already loaded are skipped; duplicates are loaded
+   * once. Successfully loaded libraries are stored even if others fail.
+   *
+   * \param library_paths absolute paths of the libraries to load
+   * \throws ComponentManagerException if any library could not be loaded
+   */
+  RCLCPP_COMPONENTS_PUBLIC
+  virtual void
+  load_libraries_in_parallel(const std::vector<std::string> & library_paths);
+
   /// Create node options for loaded component
   /**
    * \param request information with the node to load
@@ -149,6 +199,23 @@ protected:
   virtual rclcpp::NodeOptions
   create_node_options(const std::shared_ptr<LoadNode::Request> request);
 
+  /// Resolve a load request's qos_overrides parameters into frozen profiles.
+  /**
+   * Used when the request passes the 'freeze_qos_profiles' extra argument;
+   * the result is handed to the component through
+   * `rclcpp::NodeOptions::qos_profile_manifest` so entity creation skips
+   * per-entity qos parameter declaration.
+   * Frozen profiles start from the default rclcpp profile, the component's
+   * in-code defaults do not contribute to them.
+   *
+   * \param parameters the request parameters, qos_overrides ones are resolved
+   * \return manifest keyed as expected by NodeOptions::qos_profile_manifest
+   * \throws ComponentManagerException if a qos_overrides parameter is malformed
+   */
+  RCLCPP_COMPONENTS_PUBLIC
+  std::map<std::string, rclcpp::QoS>
+  create_qos_profile_manifest(const std::vector<rclcpp::Parameter> & parameters);
+
   /// Add component node to executor model, it's invoked in on_load_node()
   /**
    * \param node_id  node_id of loaded component node in node_wrappers_
@@ -260,12 +327,22 @@ protected:
   std::weak_ptr<rclcpp::Executor> executor_;
 
   uint64_t unique_id_ {1};
-  std::map<std::string, std::unique_ptr<class_loader::ClassLoader>> loaders_;
+  /// Class loaders used by this container, backed by a process-wide cache so
+  /// that other containers and repeated load/unload cycles reuse loaded
+  /// libraries instead of re-linking them.
+  std::map<std::string, std::shared_ptr<class_loader::ClassLoader>> loaders_;
   std::map<uint64_t, rclcpp_components::NodeInstanceWrapper> node_wrappers_;
 
   rclcpp::Service<LoadNode>::SharedPtr loadNode_srv_;
   rclcpp::Service<UnloadNode>::SharedPtr unloadNode_srv_;
   rclcpp::Service<ListNodes>::SharedPtr listNodes_srv_;
+
+  /// The manager services run in this group on a dedicated internal executor
+  /// thread, so slow component constructors do not stall the callbacks of
+  /// components running on the container's main executor.
+  rclcpp::CallbackGroup::SharedPtr services_callback_group_;
+  std::shared_ptr<rclcpp::Executor> services_executor_;
+  std::thread services_thread_;
 };
 
 }  // namespace rclcpp_components
@@ -0,0 +1,195 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef RCLCPP_COMPONENTS__COMPONENT_MANAGER_POOLED_HPP__
+#define RCLCPP_COMPONENTS__COMPONENT_MANAGER_POOLED_HPP__
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "rclcpp_components/component_manager.hpp"
+
+
+namespace rclcpp_components
+{
+/// ComponentManagerPooled multiplexes component nodes onto a fixed pool of executor shards.
+/**
+ * ComponentManagerIsolated spawns one executor thread per component, which
+ * does not scale on machines hosting many mostly-idle components.  This
+ * manager instead keeps at most `pool_size` single-threaded execution
+ * contexts: a component is pinned to the least loaded shard when it is loaded
+ * and never migrates, so its callbacks always run sequentially on the same
+ * thread, while the container's thread count stays bounded regardless of how
+ * many components are loaded.  Components sharing a shard share that shard's
+ * wall-clock time, so latency critical components should be sized against
+ * `pool_size` accordingly.
+ */
+template<typename ExecutorT = rclcpp::executors::SingleThreadedExecutor>
+class ComponentManagerPooled : public rclcpp_components::ComponentManager
+{
+  struct ExecutorShard
+  {
+    std::shared_ptr<rclcpp::Executor> executor;
+    std::thread thread;
+    std::atomic_bool thread_initialized;
+    /// Number of components currently pinned to this shard
+    size_t component_count {0};
+
+    /// Constructor for the shard.
+    /// This is necessary as atomic variables don't have copy/move operators
+    /// implemented so this structure is not copyable/movable by default
+    explicit ExecutorShard(std::shared_ptr<rclcpp::Executor> exec)
+    : executor(exec),
+      thread_initialized(false)
+    {
+    }
+  };
+
+public:
+  /// Constructor, see ComponentManager for the common parameters.
+  /**
+   * \param executor the executor which will spin the manager node itself.
+   * \param pool_size upper bound on the number of executor shard threads.
+   * \throws std::invalid_argument if pool_size is zero.
+   */
+  explicit ComponentManagerPooled(
+    std::weak_ptr<rclcpp::Executor> executor,
+    size_t pool_size,
+    std::string node_name = "ComponentManager",
+    const rclcpp::NodeOptions & node_options = rclcpp::NodeOptions()
+    .start_parameter_services(false)
+    .start_parameter_event_publisher(false))
+  : ComponentManager(executor, node_name, node_options),
+    pool_size_(pool_size)
+  {
+    if (0u == pool_size_) {
+      throw std::invalid_argument("pool_size must be greater than 0");
+    }
+  }
+
+  ~ComponentManagerPooled()
+  {
+    if (node_wrappers_.size()) {
+      for (auto & shard : shards_) {
+        cancel_shard(*shard);
+      }
+      node_wrappers_.clear();
+    }
+  }
+
+protected:
+  /// Add component node to the least loaded shard, it's invoked in on_load_node()
+  /**
+   * Shards are created on demand until the pool is full, so a container
+   * hosting fewer components than `pool_size` carries no idle threads.
+   *
+   * \param node_id  node_id of loaded component node in node_wrappers_
+   */
+  void
+  add_node_to_executor(uint64_t node_id) override
+  {
+    size_t shard_index = pick_shard();
+    ExecutorShard & shard = *shards_[shard_index];
+    shard.executor->add_node(node_wrappers_[node_id].get_node_base_interface());
+    ++shard.component_count;
+    component_shards_[node_id] = shard_index;
+  }
+
+  /// Remove component node from its shard, it's invoked in on_unload_node()
+  /**
+   * The shard thread stays alive for the components still pinned to it and
+   * for future loads.
+   *
+   * \param node_id  node_id of loaded component node in node_wrappers_
+   */
+  void
+  remove_node_from_executor(uint64_t node_id) override
+  {
+    auto component_shard = component_shards_.find(node_id);
+    if (component_shard != component_shards_.end()) {
+      ExecutorShard & shard = *shards_[component_shard->second];
+      shard.executor->remove_node(node_wrappers_[node_id].get_node_base_interface());
+      --shard.component_count;
+      component_shards_.erase(component_shard);
+    }
+  }
+
+private:
+  /// Return the index of the shard the next component should be pinned to.
+  size_t
+  pick_shard()
+  {
+    if (shards_.size() < pool_size_) {
+      auto exec = std::make_shared<ExecutorT>();
+      shards_.push_back(std::make_unique<ExecutorShard>(exec));
+      ExecutorShard & shard = *shards_.back();
+      auto & thread_initialized = shard.thread_initialized;
+      shard.thread = std::thread(
+        [exec, &thread_initialized]() {
+          thread_initialized = true;
+          exec->spin();
+        });
+      return shards_.size() - 1u;
+    }
+    size_t best = 0u;
+    for (size_t i = 1u; i < shards_.size(); ++i) {
+      if (shards_[i]->component_count < shards_[best]->component_count) {
+        best = i;
+      }
+    }
+    return best;
+  }
+
+  /// Stops a spinning shard avoiding race conditions.
+  /**
+   * @param shard shard to stop and its associated thread
+   */
+  void cancel_shard(ExecutorShard & shard)
+  {
+    // Verify that the shard thread has begun spinning.
+    // If it has not, then wait until the thread starts to ensure
+    // that cancel() will fully stop the execution
+    if (!shard.thread_initialized) {
+      auto context = this->get_node_base_interface()->get_context();
+
+      // Guarantee that either the executor is spinning or we are shutting down.
+      while (!shard.executor->is_spinning() && rclcpp::ok(context)) {
+        // This is an arbitrarily small delay to avoid busy looping
+        rclcpp::sleep_for(std::chrono::milliseconds(1));
+      }
+    }
+
+    // After the while loop we are sure that the executor is now spinning, so
+    // the call to cancel() will work.
+    shard.executor->cancel();
+    // Wait for the thread task to return
+    shard.thread.join();
+  }
+
+  /// Upper bound on the number of shard threads
+  size_t pool_size_;
+  /// Shards are stable in memory so threads may capture references into them
+  std::vector<std::unique_ptr<ExecutorShard>> shards_;
+  /// Which shard each loaded component is pinned to, by index into shards_
+  std::unordered_map<uint64_t, size_t> component_shards_;
+};
+
+}  // namespace rclcpp_components
+
+#endif  // RCLCPP_COMPONENTS__COMPONENT_MANAGER_POOLED_HPP__
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <iterator>
 #include <memory>
 #include <vector>
 #include <string>
@@ -19,6 +20,7 @@
 #include "rclcpp/rclcpp.hpp"
 #include "rclcpp/utilities.hpp"
 #include "rclcpp_components/component_manager_isolated.hpp"
+#include "rclcpp_components/component_manager_pooled.hpp"
 
 int main(int argc, char * argv[])
 {
@@ -26,16 +28,25 @@ int main(int argc, char * argv[])
   rclcpp::init(argc, argv);
   // parse arguments
   bool use_multi_threaded_executor{false};
+  size_t thread_pool_size{0};
   std::vector<std::string> args = rclcpp::remove_ros_arguments(argc, argv);
-  for (auto & arg : args) {
-    if (arg == std::string("--use_multi_threaded_executor")) {
+  for (auto it = args.begin(); it != args.end(); ++it) {
+    if (*it == std::string("--use_multi_threaded_executor")) {
       use_multi_threaded_executor = true;
+    } else if (*it == std::string("--thread_pool_size") && std::next(it) != args.end()) {
+      thread_pool_size = std::stoul(*std::next(it));
     }
   }
   // create executor and component manager
   auto exec = std::make_shared<rclcpp::executors::SingleThreadedExecutor>();
   rclcpp::Node::SharedPtr node;
-  if (use_multi_threaded_executor) {
+  if (thread_pool_size > 0) {
+    // Hybrid mode: components keep single-threaded execution contexts but
+    // share a bounded pool of worker threads
+    using ComponentManagerPooled =
+      rclcpp_components::ComponentManagerPooled<rclcpp::executors::SingleThreadedExecutor>;
+    node = std::make_shared<ComponentManagerPooled>(exec, thread_pool_size);
+  } else if (use_multi_threaded_executor) {
     using ComponentManagerIsolated =
       rclcpp_components::ComponentManagerIsolated<rclcpp::executors::MultiThreadedExecutor>;
     node = std::make_shared<ComponentManagerIsolated>(exec);
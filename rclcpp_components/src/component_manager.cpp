@@ -14,22 +14,53 @@
 
 #include "rclcpp_components/component_manager.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
 #include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
 #include "ament_index_cpp/get_resource.hpp"
 #include "class_loader/class_loader.hpp"
+#include "rclcpp/detail/qos_parameters.hpp"
 #include "rcpputils/filesystem_helper.hpp"
 #include "rcpputils/split.hpp"
+#include "rmw/qos_string_conversions.h"
 
 using namespace std::placeholders;
 
 namespace rclcpp_components
 {
 
+namespace
+{
+
+/// Process-wide caches shared by every ComponentManager in this process.
+std::mutex g_component_cache_mutex;
+/// Ament prefix path the resource cache below was built against.
+std::string g_cached_prefix_path;
+/// Parsed resource index entries keyed by resource index and package name.
+std::map<std::string, std::vector<ComponentManager::ComponentResource>> g_component_resources;
+/// Class loaders keyed by library path, kept loaded for the process lifetime
+/// so that load/unload cycles skip re-linking the library.
+std::map<std::string, std::shared_ptr<class_loader::ClassLoader>> g_class_loaders;
+
+std::string
+current_ament_prefix_path()
+{
+  const char * prefix_path = std::getenv("AMENT_PREFIX_PATH");
+  return prefix_path ? prefix_path : "";
+}
+
+}  // namespace
+
 ComponentManager::ComponentManager(
   std::weak_ptr<rclcpp::Executor> executor,
   std::string node_name,
@@ -37,15 +68,40 @@ ComponentManager::ComponentManager(
 : Node(std::move(node_name), node_options),
   executor_(executor)
 {
+  // The manager services run on a dedicated internal executor thread, so a
+  // slow component constructor in on_load_node() can not stall the callbacks
+  // of components running on the container's main executor. The group is not
+  // picked up automatically with the node; only the internal executor spins
+  // it. Loaded components touch the main executor solely through the final
+  // add_node_to_executor()/remove_node_from_executor() step, which is safe
+  // from this thread through the executor's notify machinery.
+  services_callback_group_ = create_callback_group(
+    rclcpp::CallbackGroupType::MutuallyExclusive,
+    false /* automatically_add_to_executor_with_node */);
+
   loadNode_srv_ = create_service<LoadNode>(
     "~/_container/load_node",
-    std::bind(&ComponentManager::on_load_node, this, _1, _2, _3));
+    std::bind(&ComponentManager::on_load_node, this, _1, _2, _3),
+    rclcpp::ServicesQoS(),
+    services_callback_group_);
   unloadNode_srv_ = create_service<UnloadNode>(
     "~/_container/unload_node",
-    std::bind(&ComponentManager::on_unload_node, this, _1, _2, _3));
+    std::bind(&ComponentManager::on_unload_node, this, _1, _2, _3),
+    rclcpp::ServicesQoS(),
+    services_callback_group_);
   listNodes_srv_ = create_service<ListNodes>(
     "~/_container/list_nodes",
-    std::bind(&ComponentManager::on_list_nodes, this, _1, _2, _3));
+    std::bind(&ComponentManager::on_list_nodes, this, _1, _2, _3),
+    rclcpp::ServicesQoS(),
+    services_callback_group_);
+
+  services_executor_ = std::make_shared<rclcpp::executors::SingleThreadedExecutor>();
+  services_executor_->add_callback_group(
+    services_callback_group_, get_node_base_interface());
+  services_thread_ = std::thread(
+    [this]() {
+      services_executor_->spin();
+    });
 
   {
     rcl_interfaces::msg::ParameterDescriptor desc{};
@@ -62,6 +118,18 @@ ComponentManager::ComponentManager(
 
 ComponentManager::~ComponentManager()
 {
+  // Stop the internal services thread before tearing anything down, so no
+  // load or unload request is mid-flight while components are removed.
+  // As in ComponentManagerIsolated::cancel_executor(), wait until the thread
+  // has actually started spinning, otherwise cancel() could be lost.
+  auto context = this->get_node_base_interface()->get_context();
+  while (!services_executor_->is_spinning() && rclcpp::ok(context)) {
+    rclcpp::sleep_for(std::chrono::milliseconds(1));
+  }
+  services_executor_->cancel();
+  if (services_thread_.joinable()) {
+    services_thread_.join();
+  }
   if (node_wrappers_.size()) {
     RCLCPP_DEBUG(get_logger(), "Removing components from executor");
     if (auto exec = executor_.lock()) {
@@ -76,6 +144,20 @@ std::vector<ComponentManager::ComponentResource>
 ComponentManager::get_component_resources(
   const std::string & package_name, const std::string & resource_index) const
 {
+  const std::string cache_key = resource_index + ":" + package_name;
+  {
+    std::lock_guard<std::mutex> cache_lock(g_component_cache_mutex);
+    // Invalidate on ament prefix change, e.g. a different overlay was sourced.
+    if (g_cached_prefix_path != current_ament_prefix_path()) {
+      g_cached_prefix_path = current_ament_prefix_path();
+      g_component_resources.clear();
+    }
+    auto it = g_component_resources.find(cache_key);
+    if (it != g_component_resources.end()) {
+      return it->second;
+    }
+  }
+
   std::string content;
   std::string base_path;
   if (
@@ -99,6 +181,11 @@ ComponentManager::get_component_resources(
     }
     resources.push_back({parts[0], library_path});
   }
+
+  {
+    std::lock_guard<std::mutex> cache_lock(g_component_cache_mutex);
+    g_component_resources[cache_key] = resources;
+  }
   return resources;
 }
 
@@ -111,13 +198,21 @@ ComponentManager::create_component_factory(const ComponentResource & resource)
 
   class_loader::ClassLoader * loader;
   if (loaders_.find(library_path) == loaders_.end()) {
-    RCLCPP_INFO(get_logger(), "Load Library: %s", library_path.c_str());
-    try {
-      loaders_[library_path] = std::make_unique<class_loader::ClassLoader>(library_path);
-    } catch (const std::exception & ex) {
-      throw ComponentManagerException("Failed to load library: " + std::string(ex.what()));
-    } catch (...) {
-      throw ComponentManagerException("Failed to load library");
+    std::lock_guard<std::mutex> cache_lock(g_component_cache_mutex);
+    auto found = g_class_loaders.find(library_path);
+    if (found != g_class_loaders.end()) {
+      // Reuse a library another container in this process already loaded.
+      loaders_[library_path] = found->second;
+    } else {
+      RCLCPP_INFO(get_logger(), "Load Library: %s", library_path.c_str());
+      try {
+        loaders_[library_path] = std::make_shared<class_loader::ClassLoader>(library_path);
+      } catch (const std::exception & ex) {
+        throw ComponentManagerException("Failed to load library: " + std::string(ex.what()));
+      } catch (...) {
+        throw ComponentManagerException("Failed to load library");
+      }
+      g_class_loaders[library_path] = loaders_[library_path];
     }
   }
   loader = loaders_[library_path].get();
@@ -164,6 +259,7 @@ ComponentManager::create_node_options(const std::shared_ptr<LoadNode::Request> r
     .parameter_overrides(parameters)
     .arguments(remap_rules);
 
+  bool freeze_qos_profiles = false;
   for (const auto & a : request->extra_arguments) {
     const rclcpp::Parameter extra_argument = rclcpp::Parameter::from_parameter_msg(a);
     if (extra_argument.get_name() == "use_intra_process_comms") {
@@ -184,18 +280,196 @@ ComponentManager::create_node_options(const std::shared_ptr<LoadNode::Request> r
           "recommended in a component manager. If true, this will cause this node's behavior "
           "to be influenced by global arguments, not only those targeted at this node.");
       }
+    } else if (extra_argument.get_name() == "freeze_qos_profiles") {
+      if (extra_argument.get_type() != rclcpp::ParameterType::PARAMETER_BOOL) {
+        throw ComponentManagerException(
+                "Extra component argument 'freeze_qos_profiles' must be a boolean");
+      }
+      freeze_qos_profiles = extra_argument.get_value<bool>();
     }
   }
 
+  if (freeze_qos_profiles) {
+    options.qos_profile_manifest(create_qos_profile_manifest(parameters));
+  }
+
   return options;
 }
 
+std::map<std::string, rclcpp::QoS>
+ComponentManager::create_qos_profile_manifest(
+  const std::vector<rclcpp::Parameter> & parameters)
+{
+  // Resolve the request's qos_overrides parameters once, per entity, into
+  // frozen profiles; entity creation then uses them verbatim instead of
+  // declaring one parameter per policy per entity.
+  // Each profile starts from the default rclcpp profile, so the component's
+  // own in-code defaults do not contribute to frozen entities.
+  std::map<std::string, rclcpp::QoS> manifest;
+  constexpr char prefix[] = "qos_overrides.";
+  constexpr size_t prefix_length = sizeof(prefix) - 1;
+  for (const auto & p : parameters) {
+    const std::string & name = p.get_name();
+    if (name.rfind(prefix, 0) != 0) {
+      continue;
+    }
+    const size_t policy_separator = name.rfind('.');
+    if (policy_separator == std::string::npos || policy_separator <= prefix_length) {
+      throw ComponentManagerException("invalid qos_overrides parameter name: " + name);
+    }
+    const std::string entity_key = name.substr(prefix_length, policy_separator - prefix_length);
+    const std::string policy_name = name.substr(policy_separator + 1);
+    const rmw_qos_policy_kind_t policy_kind =
+      rmw_qos_policy_kind_from_str(policy_name.c_str());
+    if (RMW_QOS_POLICY_INVALID == policy_kind) {
+      throw ComponentManagerException(
+              "unknown policy in qos_overrides parameter name: " + name);
+    }
+    auto it = manifest.find(entity_key);
+    if (it == manifest.end()) {
+      it = manifest.emplace(entity_key, rclcpp::QoS(rclcpp::KeepLast(10))).first;
+    }
+    try {
+      rclcpp::detail::apply_qos_override(
+        static_cast<rclcpp::QosPolicyKind>(policy_kind), p.get_parameter_value(), it->second);
+    } catch (const std::exception & e) {
+      throw ComponentManagerException(
+              "failed to apply qos_overrides parameter '" + name + "': " + e.what());
+    }
+  }
+  return manifest;
+}
+
 void
 ComponentManager::set_executor(const std::weak_ptr<rclcpp::Executor> executor)
 {
   executor_ = executor;
 }
 
+void
+ComponentManager::load_libraries_in_parallel(const std::vector<std::string> & library_paths)
+{
+  // Collect the libraries which still need loading, deduplicated, adopting
+  // libraries another container in this process already loaded.
+  std::vector<std::string> to_load;
+  {
+    std::lock_guard<std::mutex> cache_lock(g_component_cache_mutex);
+    for (const auto & library_path : library_paths) {
+      if (
+        loaders_.find(library_path) != loaders_.end() ||
+        std::find(to_load.begin(), to_load.end(), library_path) != to_load.end())
+      {
+        continue;
+      }
+      auto found = g_class_loaders.find(library_path);
+      if (found != g_class_loaders.end()) {
+        loaders_[library_path] = found->second;
+        continue;
+      }
+      to_load.push_back(library_path);
+    }
+  }
+  if (to_load.empty()) {
+    return;
+  }
+
+  const size_t thread_num = static_cast<size_t>(this->get_parameter("thread_num").as_int());
+  const size_t number_of_threads = std::min(to_load.size(), thread_num);
+  std::vector<std::shared_ptr<class_loader::ClassLoader>> loaded(to_load.size());
+  std::vector<std::string> errors(to_load.size());
+  std::atomic<size_t> next_index{0};
+  auto worker = [&to_load, &loaded, &errors, &next_index]() {
+      while (true) {
+        const size_t i = next_index.fetch_add(1);
+        if (i >= to_load.size()) {
+          break;
+        }
+        try {
+          loaded[i] = std::make_shared<class_loader::ClassLoader>(to_load[i]);
+        } catch (const std::exception & ex) {
+          errors[i] = ex.what();
+        } catch (...) {
+          errors[i] = "unknown error";
+        }
+      }
+    };
+  std::vector<std::thread> workers;
+  workers.reserve(number_of_threads);
+  for (size_t i = 0; i < number_of_threads; ++i) {
+    workers.emplace_back(worker);
+  }
+  for (auto & thread : workers) {
+    thread.join();
+  }
+
+  // Store what succeeded before reporting failures, so a partial preload
+  // still pays off for later load requests.
+  std::string error_message;
+  std::lock_guard<std::mutex> cache_lock(g_component_cache_mutex);
+  for (size_t i = 0; i < to_load.size(); ++i) {
+    if (loaded[i]) {
+      RCLCPP_INFO(get_logger(), "Load Library: %s", to_load[i].c_str());
+      loaders_[to_load[i]] = loaded[i];
+      g_class_loaders[to_load[i]] = std::move(loaded[i]);
+    } else {
+      if (!error_message.empty()) {
+        error_message += ", ";
+      }
+      error_message += to_load[i] + " (" + errors[i] + ")";
+    }
+  }
+  if (!error_message.empty()) {
+    throw ComponentManagerException("Failed to load library: " + error_message);
+  }
+}
+
+std::vector<std::shared_ptr<ComponentManager::LoadNode::Response>>
+ComponentManager::load_nodes(const std::vector<std::shared_ptr<LoadNode::Request>> & requests)
+{
+  // Resolve the requested libraries up front and load them concurrently.
+  std::vector<std::string> library_paths;
+  for (const auto & request : requests) {
+    try {
+      for (const auto & resource : get_component_resources(request->package_name)) {
+        if (resource.first == request->plugin_name) {
+          library_paths.push_back(resource.second);
+        }
+      }
+    } catch (const ComponentManagerException &) {
+      // The per-request handling below reports this failure in the response.
+    }
+  }
+  try {
+    load_libraries_in_parallel(library_paths);
+  } catch (const ComponentManagerException & ex) {
+    // Failed libraries are left to the per-request path, which retries and
+    // reports the failure in the matching response.
+    RCLCPP_WARN(get_logger(), "%s", ex.what());
+  }
+
+  // Construct the node instances serially in request order.
+  std::vector<std::shared_ptr<LoadNode::Response>> responses;
+  responses.reserve(requests.size());
+  for (const auto & request : requests) {
+    auto response = std::make_shared<LoadNode::Response>();
+    on_load_node(nullptr, request, response);
+    responses.push_back(response);
+  }
+  return responses;
+}
+
+void
+ComponentManager::preload_component_libraries(
+  const std::string & package_name,
+  const std::string & resource_index)
+{
+  std::vector<std::string> library_paths;
+  for (const auto & resource : get_component_resources(package_name, resource_index)) {
+    library_paths.push_back(resource.second);
+  }
+  load_libraries_in_parallel(library_paths);
+}
+
 void
 ComponentManager::add_node_to_executor(uint64_t node_id)
 {
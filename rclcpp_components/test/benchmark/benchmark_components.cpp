@@ -16,6 +16,7 @@
 
 #include <rcutils/logging.h>
 
+#include <chrono>
 #include <memory>
 #include <string>
 #include <vector>
@@ -122,3 +123,58 @@ BENCHMARK_F(ComponentTest, create_node_instance)(benchmark::State & state)
     benchmark::ClobberMemory();
   }
 }
+
+BENCHMARK_F(ComponentTest, component_bring_up)(benchmark::State & state)
+{
+  // Full bring-up of one component the way the container does it on a load
+  // request: resolve the factory, construct the node and register it with the
+  // executor. The per-phase averages are reported as counters so a startup
+  // regression is attributable to a phase. Delivery of a first message is
+  // covered by the composition startup benchmark in rclcpp, since the test
+  // components here create no entities of their own.
+  const std::vector<rclcpp_components::ComponentManager::ComponentResource> resources =
+    manager->get_component_resources("rclcpp_components");
+  if (resources.size() != 3) {
+    state.SkipWithError("Wrong number of components found");
+    return;
+  }
+
+  const rclcpp::NodeOptions options = rclcpp::NodeOptions().context(context);
+
+  double factory_ns = 0.0;
+  double node_construction_ns = 0.0;
+  double executor_registration_ns = 0.0;
+  size_t iterations = 0;
+
+  for (auto _ : state) {
+    (void)_;
+    const auto start = std::chrono::steady_clock::now();
+    const std::shared_ptr<rclcpp_components::NodeFactory> factory =
+      manager->create_component_factory(resources[0]);
+    const auto after_factory = std::chrono::steady_clock::now();
+
+    rclcpp_components::NodeInstanceWrapper node = factory->create_node_instance(options);
+    const auto after_node = std::chrono::steady_clock::now();
+
+    executor->add_node(node.get_node_base_interface());
+    const auto after_registration = std::chrono::steady_clock::now();
+
+    factory_ns += std::chrono::duration<double, std::nano>(after_factory - start).count();
+    node_construction_ns +=
+      std::chrono::duration<double, std::nano>(after_node - after_factory).count();
+    executor_registration_ns +=
+      std::chrono::duration<double, std::nano>(after_registration - after_node).count();
+    iterations++;
+
+    state.PauseTiming();
+    executor->remove_node(node.get_node_base_interface());
+    state.ResumeTiming();
+  }
+
+  if (iterations > 0) {
+    const double count = static_cast<double>(iterations);
+    state.counters["factory_ns"] = factory_ns / count;
+    state.counters["node_construction_ns"] = node_construction_ns / count;
+    state.counters["executor_registration_ns"] = executor_registration_ns / count;
+  }
+}
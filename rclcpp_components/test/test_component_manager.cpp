@@ -15,6 +15,8 @@
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "rclcpp_components/component_manager.hpp"
 
@@ -57,6 +59,40 @@ TEST_F(TestComponentManager, get_component_resources_valid)
   EXPECT_TRUE(fs::exists(fs::path(resources[2].second)));
 }
 
+TEST_F(TestComponentManager, create_qos_profile_manifest)
+{
+  auto exec = std::make_shared<rclcpp::executors::SingleThreadedExecutor>();
+  auto manager = std::make_shared<rclcpp_components::ComponentManager>(exec);
+
+  std::vector<rclcpp::Parameter> parameters = {
+    rclcpp::Parameter("unrelated_parameter", 5),
+    rclcpp::Parameter("qos_overrides./chatter.publisher.reliability", "best_effort"),
+    rclcpp::Parameter("qos_overrides./chatter.publisher.depth", 42),
+    rclcpp::Parameter("qos_overrides./chatter.subscription.durability", "transient_local"),
+  };
+  auto manifest = manager->create_qos_profile_manifest(parameters);
+  ASSERT_EQ(2u, manifest.size());
+  ASSERT_EQ(1u, manifest.count("/chatter.publisher"));
+  ASSERT_EQ(1u, manifest.count("/chatter.subscription"));
+  EXPECT_EQ(
+    RMW_QOS_POLICY_RELIABILITY_BEST_EFFORT,
+    manifest.at("/chatter.publisher").get_rmw_qos_profile().reliability);
+  EXPECT_EQ(42u, manifest.at("/chatter.publisher").get_rmw_qos_profile().depth);
+  EXPECT_EQ(
+    RMW_QOS_POLICY_DURABILITY_TRANSIENT_LOCAL,
+    manifest.at("/chatter.subscription").get_rmw_qos_profile().durability);
+
+  // Malformed qos_overrides parameters are rejected.
+  EXPECT_THROW(
+    manager->create_qos_profile_manifest(
+      {rclcpp::Parameter("qos_overrides./chatter.publisher.not_a_policy", 1)}),
+    rclcpp_components::ComponentManagerException);
+  EXPECT_THROW(
+    manager->create_qos_profile_manifest(
+      {rclcpp::Parameter("qos_overrides.", 1)}),
+    rclcpp_components::ComponentManagerException);
+}
+
 TEST_F(TestComponentManager, create_component_factory_valid)
 {
   auto exec = std::make_shared<rclcpp::executors::SingleThreadedExecutor>();
@@ -95,3 +131,68 @@ TEST_F(TestComponentManager, create_component_factory_invalid)
     auto resources = manager->get_component_resources("invalid_rclcpp_components"),
     rclcpp_components::ComponentManagerException);
 }
+
+TEST_F(TestComponentManager, preload_component_libraries)
+{
+  auto exec = std::make_shared<rclcpp::executors::SingleThreadedExecutor>();
+  auto manager = std::make_shared<rclcpp_components::ComponentManager>(exec);
+
+  EXPECT_NO_THROW(manager->preload_component_libraries("rclcpp_components"));
+  // Preloading again is a no-op.
+  EXPECT_NO_THROW(manager->preload_component_libraries("rclcpp_components"));
+  EXPECT_THROW(
+    manager->preload_component_libraries("invalid_package"),
+    rclcpp_components::ComponentManagerException);
+
+  // Factories come from the preloaded libraries without further loading.
+  for (const auto & resource : manager->get_component_resources("rclcpp_components")) {
+    EXPECT_NE(nullptr, manager->create_component_factory(resource));
+  }
+}
+
+TEST_F(TestComponentManager, load_nodes)
+{
+  using LoadNode = rclcpp_components::ComponentManager::LoadNode;
+
+  auto exec = std::make_shared<rclcpp::executors::SingleThreadedExecutor>();
+  auto manager = std::make_shared<rclcpp_components::ComponentManager>(exec);
+
+  auto make_request = [](const std::string & plugin_name) {
+      auto request = std::make_shared<LoadNode::Request>();
+      request->package_name = "rclcpp_components";
+      request->plugin_name = plugin_name;
+      return request;
+    };
+  std::vector<std::shared_ptr<LoadNode::Request>> requests = {
+    make_request("test_rclcpp_components::TestComponentFoo"),
+    make_request("test_rclcpp_components::TestComponentBar"),
+    make_request("test_rclcpp_components::NotAComponent"),
+  };
+
+  auto responses = manager->load_nodes(requests);
+  ASSERT_EQ(3u, responses.size());
+  EXPECT_TRUE(responses[0]->success);
+  EXPECT_EQ("/test_component_foo", responses[0]->full_node_name);
+  EXPECT_TRUE(responses[1]->success);
+  EXPECT_EQ("/test_component_bar", responses[1]->full_node_name);
+  // A bad request fails on its own without failing the batch.
+  EXPECT_FALSE(responses[2]->success);
+}
+
+TEST_F(TestComponentManager, shared_caches_across_managers)
+{
+  auto exec = std::make_shared<rclcpp::executors::SingleThreadedExecutor>();
+  auto manager_a = std::make_shared<rclcpp_components::ComponentManager>(exec, "manager_a");
+  auto manager_b = std::make_shared<rclcpp_components::ComponentManager>(exec, "manager_b");
+
+  auto resources = manager_a->get_component_resources("rclcpp_components");
+  ASSERT_EQ(3u, resources.size());
+  // The second manager resolves the same entries from the process-wide cache.
+  EXPECT_EQ(resources, manager_b->get_component_resources("rclcpp_components"));
+
+  // A library loaded through one manager is reused by the other, including
+  // after the first manager is destroyed.
+  EXPECT_NE(nullptr, manager_a->create_component_factory(resources[0]));
+  manager_a.reset();
+  EXPECT_NE(nullptr, manager_b->create_component_factory(resources[0]));
+}
@@ -134,12 +134,16 @@ public:
    * \param[in] node_name Name of the node.
    * \param[in] options Additional options to control creation of the node.
    * \param[in] enable_communication_interface Deciding whether the communication interface of the underlying rcl_lifecycle_node shall be enabled.
+   * \param[in] defer_communication_interface If true, defer creating the lifecycle
+   *   services and the transition event publisher until a matching client is seen
+   *   on the graph, cutting discovery load for nodes that are rarely managed.
    */
   RCLCPP_LIFECYCLE_PUBLIC
   explicit LifecycleNode(
     const std::string & node_name,
     const rclcpp::NodeOptions & options = rclcpp::NodeOptions(),
-    bool enable_communication_interface = true);
+    bool enable_communication_interface = true,
+    bool defer_communication_interface = false);
 
   /// Create a node based on the node name
   /**
@@ -147,13 +151,17 @@ public:
    * \param[in] namespace_ Namespace of the node.
    * \param[in] options Additional options to control creation of the node.
    * \param[in] enable_communication_interface Deciding whether the communication interface of the underlying rcl_lifecycle_node shall be enabled.
+   * \param[in] defer_communication_interface If true, defer creating the lifecycle
+   *   services and the transition event publisher until a matching client is seen
+   *   on the graph, cutting discovery load for nodes that are rarely managed.
    */
   RCLCPP_LIFECYCLE_PUBLIC
   LifecycleNode(
     const std::string & node_name,
     const std::string & namespace_,
     const rclcpp::NodeOptions & options = rclcpp::NodeOptions(),
-    bool enable_communication_interface = true);
+    bool enable_communication_interface = true,
+    bool defer_communication_interface = false);
 
   RCLCPP_LIFECYCLE_PUBLIC
   virtual ~LifecycleNode();
@@ -15,6 +15,9 @@
 #ifndef RCLCPP_LIFECYCLE__LIFECYCLE_PUBLISHER_HPP_
 #define RCLCPP_LIFECYCLE__LIFECYCLE_PUBLISHER_HPP_
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
@@ -52,7 +55,6 @@ public:
     const rclcpp::QoS & qos,
     const rclcpp::PublisherOptionsWithAllocator<Alloc> & options)
   : rclcpp::Publisher<MessageT, Alloc>(node_base, topic, qos, options),
-    should_log_(true),
     logger_(rclcpp::get_logger("LifecyclePublisher"))
   {
   }
@@ -113,33 +115,45 @@ public:
   on_activate() override
   {
     SimpleManagedEntity::on_activate();
-    should_log_ = true;
+    // Warn immediately the next time publishing is attempted while inactive.
+    next_log_time_ns_.store(0, std::memory_order_relaxed);
   }
 
 private:
+  /// Minimum interval between repeated "not activated" warnings.
+  static constexpr std::chrono::nanoseconds kNotEnabledLogPeriod = std::chrono::seconds(1);
+
   /// LifecyclePublisher log helper function
   /**
    * Helper function that logs a message saying that publisher can't publish
    * because it's not enabled.
+   *
+   * The warning is throttled to one per kNotEnabledLogPeriod, and the slot is
+   * claimed with a compare-exchange, so an inactive high-rate publisher does
+   * not serialize its callers on the logging mutex.
    */
   void log_publisher_not_enabled()
   {
-    // Nothing to do if we are not meant to log
-    if (!should_log_) {
+    const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+    int64_t next_log_time = next_log_time_ns_.load(std::memory_order_relaxed);
+    if (now < next_log_time) {
+      return;
+    }
+    if (!next_log_time_ns_.compare_exchange_strong(
+        next_log_time, now + kNotEnabledLogPeriod.count(), std::memory_order_relaxed))
+    {
+      // Another thread claimed this logging slot.
       return;
     }
 
-    // Log the message
     RCLCPP_WARN(
       logger_,
       "Trying to publish message on the topic '%s', but the publisher is not activated",
       this->get_topic_name());
-
-    // We stop logging until the flag gets enabled again
-    should_log_ = false;
   }
 
-  bool should_log_ = true;
+  std::atomic<int64_t> next_log_time_ns_ {0};
   rclcpp::Logger logger_;
 };
 
@@ -56,9 +56,18 @@ public:
   void
   on_deactivate() override;
 
-  RCLCPP_LIFECYCLE_PUBLIC
+  /// Return the activation state.
+  /**
+   * Non-virtual and inline with a relaxed load, so checking the state on a
+   * publish hot path costs a single uncontended read.  Activation changes
+   * publish their side effects through the release stores in on_activate()
+   * and on_deactivate().
+   */
   bool
-  is_activated() const;
+  is_activated() const
+  {
+    return activated_.load(std::memory_order_relaxed);
+  }
 
 private:
   std::atomic<bool> activated_ = false;
@@ -0,0 +1,140 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RCLCPP_LIFECYCLE__TRANSITION_ORCHESTRATOR_HPP_
+#define RCLCPP_LIFECYCLE__TRANSITION_ORCHESTRATOR_HPP_
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "lifecycle_msgs/srv/change_state.hpp"
+
+#include "rclcpp/client.hpp"
+
+#include "rclcpp_lifecycle/lifecycle_node.hpp"
+#include "rclcpp_lifecycle/node_interfaces/lifecycle_node_interface.hpp"
+#include "rclcpp_lifecycle/visibility_control.h"
+
+namespace rclcpp_lifecycle
+{
+
+/// Drive one lifecycle transition across a group of managed nodes.
+/**
+ * Transitioning many nodes one change_state service call at a time serializes
+ * work that is mostly independent. This orchestrator instead executes a
+ * transition in dependency-ordered waves: within a wave, every node whose
+ * dependencies have already transitioned successfully is processed
+ * concurrently.
+ *
+ * Nodes living in this process are added with add_node() and transitioned via
+ * a fast path that invokes LifecycleNode::trigger_transition() directly, with
+ * no service round trip. Nodes in other processes are added with
+ * add_remote_node() together with a change_state service client; their
+ * requests are all issued asynchronously at the start of a wave (pipelined)
+ * before any response is awaited. The node owning the remote clients must be
+ * spun by an executor in another thread while transition_all() runs.
+ *
+ * This class is not thread-safe; drive it from one thread at a time.
+ */
+class TransitionOrchestrator
+{
+public:
+  using CallbackReturn = node_interfaces::LifecycleNodeInterface::CallbackReturn;
+  using ChangeStateSrv = lifecycle_msgs::srv::ChangeState;
+
+  RCLCPP_LIFECYCLE_PUBLIC
+  TransitionOrchestrator();
+
+  RCLCPP_LIFECYCLE_PUBLIC
+  virtual ~TransitionOrchestrator();
+
+  /// Add an in-process node, transitioned by direct callback invocation.
+  /**
+   * \param[in] node The node to manage; only a weak reference is kept.
+   * \throws std::invalid_argument if node is nullptr or a node with the same
+   *   name was already added.
+   */
+  RCLCPP_LIFECYCLE_PUBLIC
+  void
+  add_node(std::shared_ptr<rclcpp_lifecycle::LifecycleNode> node);
+
+  /// Add an out-of-process node, transitioned via its change_state service.
+  /**
+   * \param[in] node_name The name used in add_dependency() and in results.
+   * \param[in] client A client for the node's change_state service, created
+   *   on a node that is spun externally while transition_all() runs.
+   * \throws std::invalid_argument if the client is nullptr or a node with the
+   *   same name was already added.
+   */
+  RCLCPP_LIFECYCLE_PUBLIC
+  void
+  add_remote_node(
+    const std::string & node_name,
+    rclcpp::Client<ChangeStateSrv>::SharedPtr client);
+
+  /// Require one node to transition only after another has succeeded.
+  /**
+   * \param[in] node_name The dependent node.
+   * \param[in] depends_on The node that must transition first.
+   * \throws std::invalid_argument if either name is unknown or both are the
+   *   same node.
+   */
+  RCLCPP_LIFECYCLE_PUBLIC
+  void
+  add_dependency(const std::string & node_name, const std::string & depends_on);
+
+  /// Execute one transition on every added node, in dependency order.
+  /**
+   * Nodes whose dependencies all returned SUCCESS are processed together,
+   * in-process nodes each on their own thread and remote nodes via pipelined
+   * service requests. Nodes with a failed (or skipped) dependency are skipped
+   * and omitted from the returned map.
+   *
+   * For in-process nodes, an exception escaping the transition is recorded as
+   * CallbackReturn::ERROR. For remote nodes an unsuccessful change_state
+   * response is recorded as FAILURE and a response missing the timeout as
+   * ERROR.
+   *
+   * \param[in] transition_id The transition to trigger on every node, one of
+   *   lifecycle_msgs::msg::Transition.
+   * \param[in] service_timeout How long to wait for each remote response.
+   * \return map from node name to that node's transition callback return
+   *   code; skipped nodes are absent.
+   * \throws std::runtime_error if the dependencies form a cycle.
+   */
+  RCLCPP_LIFECYCLE_PUBLIC
+  std::map<std::string, CallbackReturn>
+  transition_all(
+    uint8_t transition_id,
+    std::chrono::nanoseconds service_timeout = std::chrono::seconds(10));
+
+private:
+  struct ManagedEntry
+  {
+    std::weak_ptr<rclcpp_lifecycle::LifecycleNode> node;
+    rclcpp::Client<ChangeStateSrv>::SharedPtr client;
+  };
+
+  std::map<std::string, ManagedEntry> entries_;
+  // Dependent node name -> names it depends on.
+  std::multimap<std::string, std::string> dependencies_;
+};
+
+}  // namespace rclcpp_lifecycle
+
+#endif  // RCLCPP_LIFECYCLE__TRANSITION_ORCHESTRATOR_HPP_
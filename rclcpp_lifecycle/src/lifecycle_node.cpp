@@ -56,19 +56,22 @@ namespace rclcpp_lifecycle
 LifecycleNode::LifecycleNode(
   const std::string & node_name,
   const rclcpp::NodeOptions & options,
-  bool enable_communication_interface)
+  bool enable_communication_interface,
+  bool defer_communication_interface)
 : LifecycleNode(
     node_name,
     "",
     options,
-    enable_communication_interface)
+    enable_communication_interface,
+    defer_communication_interface)
 {}
 
 LifecycleNode::LifecycleNode(
   const std::string & node_name,
   const std::string & namespace_,
   const rclcpp::NodeOptions & options,
-  bool enable_communication_interface)
+  bool enable_communication_interface,
+  bool defer_communication_interface)
 : node_base_(new rclcpp::node_interfaces::NodeBase(
       node_name,
       namespace_,
@@ -97,6 +100,7 @@ LifecycleNode::LifecycleNode(
       node_clock_,
       options.parameter_overrides(),
       options.start_parameter_services(),
+      options.use_shared_parameter_service(),
       options.start_parameter_event_publisher(),
       options.parameter_event_qos(),
       options.parameter_event_publisher_options(),
@@ -122,9 +126,10 @@ LifecycleNode::LifecycleNode(
     )),
   node_waitables_(new rclcpp::node_interfaces::NodeWaitables(node_base_.get())),
   node_options_(options),
-  impl_(new LifecycleNodeInterfaceImpl(node_base_, node_services_, node_logging_))
+  impl_(new LifecycleNodeInterfaceImpl(
+      node_base_, node_services_, node_logging_, node_graph_, node_topics_))
 {
-  impl_->init(enable_communication_interface);
+  impl_->init(enable_communication_interface, defer_communication_interface);
 
   register_on_configure(
     std::bind(
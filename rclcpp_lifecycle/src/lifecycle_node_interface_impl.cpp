@@ -12,7 +12,11 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <stdexcept>
@@ -29,8 +33,14 @@
 #include "lifecycle_msgs/srv/get_available_transitions.hpp"
 
 #include "rclcpp/node_interfaces/node_base_interface.hpp"
+#include "rclcpp/node_interfaces/node_graph_interface.hpp"
 #include "rclcpp/node_interfaces/node_logging_interface.hpp"
 #include "rclcpp/node_interfaces/node_services_interface.hpp"
+#include "rclcpp/node_interfaces/node_topics_interface.hpp"
+#include "rclcpp/publisher_factory.hpp"
+#include "rclcpp/publisher_options.hpp"
+#include "rclcpp/qos.hpp"
+#include "rclcpp/utilities.hpp"
 
 #include "rclcpp_lifecycle/node_interfaces/lifecycle_node_interface.hpp"
 
@@ -52,15 +62,24 @@ namespace rclcpp_lifecycle
 LifecycleNode::LifecycleNodeInterfaceImpl::LifecycleNodeInterfaceImpl(
   std::shared_ptr<rclcpp::node_interfaces::NodeBaseInterface> node_base_interface,
   std::shared_ptr<rclcpp::node_interfaces::NodeServicesInterface> node_services_interface,
-  std::shared_ptr<rclcpp::node_interfaces::NodeLoggingInterface> node_logging_interface)
+  std::shared_ptr<rclcpp::node_interfaces::NodeLoggingInterface> node_logging_interface,
+  std::shared_ptr<rclcpp::node_interfaces::NodeGraphInterface> node_graph_interface,
+  std::shared_ptr<rclcpp::node_interfaces::NodeTopicsInterface> node_topics_interface)
 : node_base_interface_(node_base_interface),
   node_services_interface_(node_services_interface),
-  node_logging_interface_(node_logging_interface)
+  node_logging_interface_(node_logging_interface),
+  node_graph_interface_(node_graph_interface),
+  node_topics_interface_(node_topics_interface)
 {
 }
 
 LifecycleNode::LifecycleNodeInterfaceImpl::~LifecycleNodeInterfaceImpl()
 {
+  stop_graph_watcher_.store(true);
+  if (graph_watcher_.joinable()) {
+    graph_watcher_.join();
+  }
+
   rcl_node_t * node_handle = node_base_interface_->get_rcl_node_handle();
   rcl_ret_t ret;
   {
@@ -75,13 +94,18 @@ LifecycleNode::LifecycleNodeInterfaceImpl::~LifecycleNodeInterfaceImpl()
 }
 
 void
-LifecycleNode::LifecycleNodeInterfaceImpl::init(bool enable_communication_interface)
+LifecycleNode::LifecycleNodeInterfaceImpl::init(
+  bool enable_communication_interface, bool defer_communication_interface)
 {
   rcl_node_t * node_handle = node_base_interface_->get_rcl_node_handle();
   const rcl_node_options_t * node_options =
     rcl_node_get_options(node_base_interface_->get_rcl_node_handle());
   auto state_machine_options = rcl_lifecycle_get_default_state_machine_options();
-  state_machine_options.enable_com_interface = enable_communication_interface;
+  // With a deferred communication interface the rcl com interface stays
+  // disabled; the services and the transition event publisher are created by
+  // materialize_services() when the first matching client shows up.
+  state_machine_options.enable_com_interface =
+    enable_communication_interface && !defer_communication_interface;
   state_machine_options.allocator = node_options->allocator;
 
   // The call to initialize the state machine takes
@@ -109,6 +133,14 @@ LifecycleNode::LifecycleNodeInterfaceImpl::init(bool enable_communication_interf
   }
 
   current_state_ = State(state_machine_.current_state);
+  cached_current_state_.store(state_machine_.current_state, std::memory_order_release);
+  build_transition_table();
+
+  if (enable_communication_interface && defer_communication_interface) {
+    graph_watcher_ = std::thread(
+      &LifecycleNode::LifecycleNodeInterfaceImpl::graph_watcher_loop, this);
+    return;
+  }
 
   if (enable_communication_interface) {
     { // change_state
@@ -195,6 +227,188 @@ LifecycleNode::LifecycleNodeInterfaceImpl::init(bool enable_communication_interf
   }
 }
 
+void
+LifecycleNode::LifecycleNodeInterfaceImpl::graph_watcher_loop()
+{
+  auto context = node_base_interface_->get_context();
+  auto graph_event = node_graph_interface_->get_graph_event();
+
+  // A matching client may already have been on the graph before this node
+  // was created, so check once before waiting for a graph change.
+  bool demand = has_matching_client();
+  while (!demand && !stop_graph_watcher_.load() && rclcpp::ok(context)) {
+    node_graph_interface_->wait_for_graph_change(graph_event, std::chrono::milliseconds(100));
+    if (graph_event->check_and_clear()) {
+      demand = has_matching_client();
+    }
+  }
+
+  if (demand && !stop_graph_watcher_.load() && rclcpp::ok(context)) {
+    materialize_services();
+  }
+}
+
+bool
+LifecycleNode::LifecycleNodeInterfaceImpl::has_matching_client() const
+{
+  const std::string fq_name = node_base_interface_->get_fully_qualified_name();
+  const std::array<std::string, 5> service_names = {
+    fq_name + "/change_state",
+    fq_name + "/get_state",
+    fq_name + "/get_available_states",
+    fq_name + "/get_available_transitions",
+    fq_name + "/get_transition_graph"};
+
+  for (const auto & node_name_and_namespace :
+    node_graph_interface_->get_node_names_and_namespaces())
+  {
+    std::map<std::string, std::vector<std::string>> clients;
+    try {
+      clients = node_graph_interface_->get_client_names_and_types_by_node(
+        node_name_and_namespace.first, node_name_and_namespace.second);
+    } catch (const std::exception &) {
+      // the node may have left the graph between enumeration and query
+      continue;
+    }
+    for (const auto & service_name : service_names) {
+      if (clients.count(service_name) != 0) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+void
+LifecycleNode::LifecycleNodeInterfaceImpl::materialize_services()
+{
+  rcl_service_options_t service_options = rcl_service_get_default_options();
+
+  { // change_state
+    auto cb = std::bind(
+      &LifecycleNode::LifecycleNodeInterfaceImpl::on_change_state, this,
+      std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
+    rclcpp::AnyServiceCallback<ChangeStateSrv> any_cb;
+    any_cb.set(std::move(cb));
+
+    srv_change_state_ = std::make_shared<rclcpp::Service<ChangeStateSrv>>(
+      node_base_interface_->get_shared_rcl_node_handle(),
+      "~/change_state",
+      any_cb,
+      service_options);
+    node_services_interface_->add_service(
+      std::dynamic_pointer_cast<rclcpp::ServiceBase>(srv_change_state_),
+      nullptr);
+  }
+
+  { // get_state
+    auto cb = std::bind(
+      &LifecycleNode::LifecycleNodeInterfaceImpl::on_get_state, this,
+      std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
+    rclcpp::AnyServiceCallback<GetStateSrv> any_cb;
+    any_cb.set(std::move(cb));
+
+    srv_get_state_ = std::make_shared<rclcpp::Service<GetStateSrv>>(
+      node_base_interface_->get_shared_rcl_node_handle(),
+      "~/get_state",
+      any_cb,
+      service_options);
+    node_services_interface_->add_service(
+      std::dynamic_pointer_cast<rclcpp::ServiceBase>(srv_get_state_),
+      nullptr);
+  }
+
+  { // get_available_states
+    auto cb = std::bind(
+      &LifecycleNode::LifecycleNodeInterfaceImpl::on_get_available_states, this,
+      std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
+    rclcpp::AnyServiceCallback<GetAvailableStatesSrv> any_cb;
+    any_cb.set(std::move(cb));
+
+    srv_get_available_states_ = std::make_shared<rclcpp::Service<GetAvailableStatesSrv>>(
+      node_base_interface_->get_shared_rcl_node_handle(),
+      "~/get_available_states",
+      any_cb,
+      service_options);
+    node_services_interface_->add_service(
+      std::dynamic_pointer_cast<rclcpp::ServiceBase>(srv_get_available_states_),
+      nullptr);
+  }
+
+  { // get_available_transitions
+    auto cb = std::bind(
+      &LifecycleNode::LifecycleNodeInterfaceImpl::on_get_available_transitions, this,
+      std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
+    rclcpp::AnyServiceCallback<GetAvailableTransitionsSrv> any_cb;
+    any_cb.set(std::move(cb));
+
+    srv_get_available_transitions_ =
+      std::make_shared<rclcpp::Service<GetAvailableTransitionsSrv>>(
+      node_base_interface_->get_shared_rcl_node_handle(),
+      "~/get_available_transitions",
+      any_cb,
+      service_options);
+    node_services_interface_->add_service(
+      std::dynamic_pointer_cast<rclcpp::ServiceBase>(srv_get_available_transitions_),
+      nullptr);
+  }
+
+  { // get_transition_graph
+    auto cb = std::bind(
+      &LifecycleNode::LifecycleNodeInterfaceImpl::on_get_transition_graph, this,
+      std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
+    rclcpp::AnyServiceCallback<GetAvailableTransitionsSrv> any_cb;
+    any_cb.set(std::move(cb));
+
+    srv_get_transition_graph_ =
+      std::make_shared<rclcpp::Service<GetAvailableTransitionsSrv>>(
+      node_base_interface_->get_shared_rcl_node_handle(),
+      "~/get_transition_graph",
+      any_cb,
+      service_options);
+    node_services_interface_->add_service(
+      std::dynamic_pointer_cast<rclcpp::ServiceBase>(srv_get_transition_graph_),
+      nullptr);
+  }
+
+  { // transition_event
+    auto pub = node_topics_interface_->create_publisher(
+      "~/transition_event",
+      rclcpp::create_publisher_factory<TransitionEventMsg, std::allocator<void>>(
+        rclcpp::PublisherOptionsWithAllocator<std::allocator<void>>()),
+      rclcpp::QoS(rclcpp::KeepLast(10)));
+    node_topics_interface_->add_publisher(pub, nullptr);
+
+    std::lock_guard<std::recursive_mutex> lock(state_machine_mutex_);
+    pub_transition_event_ =
+      std::dynamic_pointer_cast<rclcpp::Publisher<TransitionEventMsg>>(pub);
+  }
+
+  RCLCPP_INFO(
+    node_logging_interface_->get_logger(),
+    "Created deferred lifecycle services on first matching client");
+}
+
+void
+LifecycleNode::LifecycleNodeInterfaceImpl::publish_transition_event(
+  const rcl_lifecycle_transition_t * transition)
+{
+  if (!pub_transition_event_ || nullptr == transition) {
+    return;
+  }
+
+  TransitionEventMsg msg;
+  msg.timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::system_clock::now().time_since_epoch()).count();
+  msg.transition.id = static_cast<uint8_t>(transition->id);
+  msg.transition.label = transition->label;
+  msg.start_state.id = static_cast<uint8_t>(transition->start->id);
+  msg.start_state.label = transition->start->label;
+  msg.goal_state.id = static_cast<uint8_t>(transition->goal->id);
+  msg.goal_state.label = transition->goal->label;
+  pub_transition_event_->publish(msg);
+}
+
 bool
 LifecycleNode::LifecycleNodeInterfaceImpl::register_callback(
   std::uint8_t lifecycle_transition,
@@ -211,31 +425,31 @@ LifecycleNode::LifecycleNodeInterfaceImpl::on_change_state(
   std::shared_ptr<ChangeStateSrv::Response> resp)
 {
   (void)header;
-  std::uint8_t transition_id;
-  {
-    std::lock_guard<std::recursive_mutex> lock(state_machine_mutex_);
-    if (rcl_lifecycle_state_machine_is_initialized(&state_machine_) != RCL_RET_OK) {
-      throw std::runtime_error("Can't get state. State machine is not initialized.");
-    }
+  // The state cache and the per-state transition arrays are immutable after
+  // init(), so resolving the request takes no lock.
+  const rcl_lifecycle_state_t * current_state =
+    cached_current_state_.load(std::memory_order_acquire);
+  if (nullptr == current_state) {
+    throw std::runtime_error("Can't get state. State machine is not initialized.");
+  }
 
-    transition_id = req->transition.id;
-    // if there's a label attached to the request,
-    // we check the transition attached to this label.
-    // we further can't compare the id of the looked up transition
-    // because ros2 service call defaults all intergers to zero.
-    // that means if we call ros2 service call ... {transition: {label: shutdown}}
-    // the id of the request is 0 (zero) whereas the id from the lookup up transition
-    // can be different.
-    // the result of this is that the label takes presedence of the id.
-    if (req->transition.label.size() != 0) {
-      auto rcl_transition = rcl_lifecycle_get_transition_by_label(
-        state_machine_.current_state, req->transition.label.c_str());
-      if (rcl_transition == nullptr) {
-        resp->success = false;
-        return;
-      }
-      transition_id = static_cast<std::uint8_t>(rcl_transition->id);
+  std::uint8_t transition_id = req->transition.id;
+  // if there's a label attached to the request,
+  // we check the transition attached to this label.
+  // we further can't compare the id of the looked up transition
+  // because ros2 service call defaults all intergers to zero.
+  // that means if we call ros2 service call ... {transition: {label: shutdown}}
+  // the id of the request is 0 (zero) whereas the id from the lookup up transition
+  // can be different.
+  // the result of this is that the label takes presedence of the id.
+  if (req->transition.label.size() != 0) {
+    auto rcl_transition = rcl_lifecycle_get_transition_by_label(
+      current_state, req->transition.label.c_str());
+    if (rcl_transition == nullptr) {
+      resp->success = false;
+      return;
     }
+    transition_id = static_cast<std::uint8_t>(rcl_transition->id);
   }
 
   node_interfaces::LifecycleNodeInterface::CallbackReturn cb_return_code;
@@ -256,13 +470,16 @@ LifecycleNode::LifecycleNodeInterfaceImpl::on_get_state(
 {
   (void)header;
   (void)req;
-  std::lock_guard<std::recursive_mutex> lock(state_machine_mutex_);
-  if (rcl_lifecycle_state_machine_is_initialized(&state_machine_) != RCL_RET_OK) {
+  // Answered from the atomic state cache, so a supervisor polling the state
+  // at a high rate never contends with a transition in progress.
+  const rcl_lifecycle_state_t * current_state =
+    cached_current_state_.load(std::memory_order_acquire);
+  if (nullptr == current_state) {
     throw std::runtime_error(
             "Can't get state. State machine is not initialized.");
   }
-  resp->current_state.id = static_cast<uint8_t>(state_machine_.current_state->id);
-  resp->current_state.label = state_machine_.current_state->label;
+  resp->current_state.id = static_cast<uint8_t>(current_state->id);
+  resp->current_state.label = current_state->label;
 }
 
 void
@@ -398,6 +615,30 @@ LifecycleNode::LifecycleNodeInterfaceImpl::change_state(
   State initial_state;
   unsigned int current_state_id;
 
+  {
+    // O(1) check against the immutable transition table, so requests which
+    // are not valid from the current state are rejected without taking the
+    // state machine lock.  The cache may lag behind a transition in flight,
+    // so it is only a hint: rejection is confirmed under the lock against
+    // the authoritative state, otherwise a valid request queued behind
+    // another transition would fail spuriously.
+    const rcl_lifecycle_state_t * current_state =
+      cached_current_state_.load(std::memory_order_acquire);
+    if (current_state &&
+      nullptr == get_transition_by_id(current_state->id, transition_id))
+    {
+      std::lock_guard<std::recursive_mutex> lock(state_machine_mutex_);
+      if (nullptr == get_transition_by_id(state_machine_.current_state->id, transition_id)) {
+        RCLCPP_ERROR(
+          node_logging_interface_->get_logger(),
+          "Unable to start transition %u from current state %s: transition is not registered",
+          transition_id, state_machine_.current_state->label);
+        cb_return_code = node_interfaces::LifecycleNodeInterface::CallbackReturn::ERROR;
+        return RCL_RET_ERROR;
+      }
+    }
+  }
+
   {
     std::lock_guard<std::recursive_mutex> lock(state_machine_mutex_);
     if (rcl_lifecycle_state_machine_is_initialized(&state_machine_) != RCL_RET_OK) {
@@ -411,6 +652,8 @@ LifecycleNode::LifecycleNodeInterfaceImpl::change_state(
     // keep the initial state to pass to a transition callback
     initial_state = State(state_machine_.current_state);
 
+    const rcl_lifecycle_transition_t * transition =
+      get_transition_by_id(state_machine_.current_state->id, transition_id);
     if (
       rcl_lifecycle_trigger_transition_by_id(
         &state_machine_, transition_id, publish_update) != RCL_RET_OK)
@@ -422,11 +665,13 @@ LifecycleNode::LifecycleNodeInterfaceImpl::change_state(
       rcutils_reset_error();
       return RCL_RET_ERROR;
     }
+    publish_transition_event(transition);
     current_state_id = state_machine_.current_state->id;
   }
 
   // Update the internal current_state_
   current_state_ = State(state_machine_.current_state);
+  cached_current_state_.store(state_machine_.current_state, std::memory_order_release);
 
   auto get_label_for_return_code =
     [](node_interfaces::LifecycleNodeInterface::CallbackReturn cb_return_code) -> const char *{
@@ -444,6 +689,8 @@ LifecycleNode::LifecycleNodeInterfaceImpl::change_state(
 
   {
     std::lock_guard<std::recursive_mutex> lock(state_machine_mutex_);
+    const rcl_lifecycle_transition_t * transition = rcl_lifecycle_get_transition_by_label(
+      state_machine_.current_state, transition_label);
     if (
       rcl_lifecycle_trigger_transition_by_label(
         &state_machine_, transition_label, publish_update) != RCL_RET_OK)
@@ -455,11 +702,13 @@ LifecycleNode::LifecycleNodeInterfaceImpl::change_state(
       rcutils_reset_error();
       return RCL_RET_ERROR;
     }
+    publish_transition_event(transition);
     current_state_id = state_machine_.current_state->id;
   }
 
   // Update the internal current_state_
   current_state_ = State(state_machine_.current_state);
+  cached_current_state_.store(state_machine_.current_state, std::memory_order_release);
 
   // error handling ?!
   // TODO(karsten1987): iterate over possible ret value
@@ -471,6 +720,8 @@ LifecycleNode::LifecycleNodeInterfaceImpl::change_state(
     auto error_cb_code = execute_callback(current_state_id, initial_state);
     auto error_cb_label = get_label_for_return_code(error_cb_code);
     std::lock_guard<std::recursive_mutex> lock(state_machine_mutex_);
+    const rcl_lifecycle_transition_t * transition = rcl_lifecycle_get_transition_by_label(
+      state_machine_.current_state, error_cb_label);
     if (
       rcl_lifecycle_trigger_transition_by_label(
         &state_machine_, error_cb_label, publish_update) != RCL_RET_OK)
@@ -481,10 +732,12 @@ LifecycleNode::LifecycleNodeInterfaceImpl::change_state(
       rcutils_reset_error();
       return RCL_RET_ERROR;
     }
+    publish_transition_event(transition);
   }
 
   // Update the internal current_state_
   current_state_ = State(state_machine_.current_state);
+  cached_current_state_.store(state_machine_.current_state, std::memory_order_release);
 
   // This true holds in both cases where the actual callback
   // was successful or not, since at this point we have a valid transistion
@@ -517,6 +770,42 @@ LifecycleNode::LifecycleNodeInterfaceImpl::execute_callback(
   return cb_success;
 }
 
+void
+LifecycleNode::LifecycleNodeInterfaceImpl::build_transition_table()
+{
+  const rcl_lifecycle_transition_map_t & map = state_machine_.transition_map;
+
+  size_t max_state_id = 0;
+  for (unsigned int i = 0; i < map.states_size; ++i) {
+    max_state_id = std::max(max_state_id, static_cast<size_t>(map.states[i].id));
+  }
+  size_t max_transition_id = 0;
+  for (unsigned int i = 0; i < map.transitions_size; ++i) {
+    max_transition_id = std::max(max_transition_id, static_cast<size_t>(map.transitions[i].id));
+  }
+  state_id_count_ = max_state_id + 1;
+  transition_id_count_ = max_transition_id + 1;
+
+  transition_table_.assign(state_id_count_ * transition_id_count_, nullptr);
+  for (unsigned int i = 0; i < map.states_size; ++i) {
+    const rcl_lifecycle_state_t & state = map.states[i];
+    for (unsigned int j = 0; j < state.valid_transition_size; ++j) {
+      const rcl_lifecycle_transition_t & transition = state.valid_transitions[j];
+      transition_table_[state.id * transition_id_count_ + transition.id] = &transition;
+    }
+  }
+}
+
+const rcl_lifecycle_transition_t *
+LifecycleNode::LifecycleNodeInterfaceImpl::get_transition_by_id(
+  unsigned int state_id, std::uint8_t transition_id) const
+{
+  if (state_id >= state_id_count_ || transition_id >= transition_id_count_) {
+    return nullptr;
+  }
+  return transition_table_[state_id * transition_id_count_ + transition_id];
+}
+
 const State & LifecycleNode::LifecycleNodeInterfaceImpl::trigger_transition(
   const char * transition_label)
 {
@@ -528,12 +817,13 @@ const State & LifecycleNode::LifecycleNodeInterfaceImpl::trigger_transition(
   const char * transition_label,
   node_interfaces::LifecycleNodeInterface::CallbackReturn & cb_return_code)
 {
-  const rcl_lifecycle_transition_t * transition;
-  {
-    std::lock_guard<std::recursive_mutex> lock(state_machine_mutex_);
-
-    transition =
-      rcl_lifecycle_get_transition_by_label(state_machine_.current_state, transition_label);
+  const rcl_lifecycle_transition_t * transition = nullptr;
+  // The per-state transition arrays are immutable after init(), so the label
+  // lookup only needs the atomic state cache, not the lock.
+  const rcl_lifecycle_state_t * current_state =
+    cached_current_state_.load(std::memory_order_acquire);
+  if (current_state) {
+    transition = rcl_lifecycle_get_transition_by_label(current_state, transition_label);
   }
   if (transition) {
     change_state(static_cast<uint8_t>(transition->id), cb_return_code);
@@ -17,9 +17,11 @@
 
 #include "rclcpp_lifecycle/lifecycle_node.hpp"
 
+#include <atomic>
 #include <functional>
 #include <map>
 #include <memory>
+#include <thread>
 #include <vector>
 
 #include "lifecycle_msgs/msg/transition_event.hpp"
@@ -32,8 +34,11 @@
 
 #include "rclcpp/macros.hpp"
 #include "rclcpp/node_interfaces/node_base_interface.hpp"
+#include "rclcpp/node_interfaces/node_graph_interface.hpp"
 #include "rclcpp/node_interfaces/node_logging_interface.hpp"
 #include "rclcpp/node_interfaces/node_services_interface.hpp"
+#include "rclcpp/node_interfaces/node_topics_interface.hpp"
+#include "rclcpp/publisher.hpp"
 
 #include "rclcpp_lifecycle/node_interfaces/lifecycle_node_interface.hpp"
 
@@ -54,12 +59,14 @@ public:
   LifecycleNodeInterfaceImpl(
     std::shared_ptr<rclcpp::node_interfaces::NodeBaseInterface> node_base_interface,
     std::shared_ptr<rclcpp::node_interfaces::NodeServicesInterface> node_services_interface,
-    std::shared_ptr<rclcpp::node_interfaces::NodeLoggingInterface> node_logging_interface);
+    std::shared_ptr<rclcpp::node_interfaces::NodeLoggingInterface> node_logging_interface,
+    std::shared_ptr<rclcpp::node_interfaces::NodeGraphInterface> node_graph_interface,
+    std::shared_ptr<rclcpp::node_interfaces::NodeTopicsInterface> node_topics_interface);
 
   ~LifecycleNodeInterfaceImpl();
 
   void
-  init(bool enable_communication_interface = true);
+  init(bool enable_communication_interface = true, bool defer_communication_interface = false);
 
   bool
   register_callback(
@@ -142,12 +149,68 @@ private:
     std::uint8_t transition_id,
     node_interfaces::LifecycleNodeInterface::CallbackReturn & cb_return_code);
 
+  /// Watch the graph and materialize the services on the first matching client.
+  /**
+   * Runs on its own thread when the communication interface was deferred in
+   * init().  Returns once the services are created, the node shuts down or
+   * the node is destructed.
+   */
+  void
+  graph_watcher_loop();
+
+  /// Check whether any remote node has a client on one of the lifecycle services.
+  bool
+  has_matching_client() const;
+
+  /// Create the five lifecycle services and the transition event publisher.
+  /**
+   * Used by the deferred communication interface: the services go through the
+   * plain rclcpp service path instead of the rcl_lifecycle com interface,
+   * which was left disabled in init().
+   */
+  void
+  materialize_services();
+
+  /// Publish a transition event for the given transition, deferred mode only.
+  /**
+   * With the rcl com interface enabled rcl publishes the event itself and
+   * this is a no-op.  Called with state_machine_mutex_ held.
+   */
+  void
+  publish_transition_event(const rcl_lifecycle_transition_t * transition);
+
   node_interfaces::LifecycleNodeInterface::CallbackReturn
   execute_callback(unsigned int cb_id, const State & previous_state) const;
 
+  /// Build the flat (state id, transition id) lookup table, init() only.
+  void
+  build_transition_table();
+
+  /// O(1) lookup of the transition with the given id valid from the given state.
+  /**
+   * The table is immutable after init(), so the lookup takes no lock and
+   * never contends with a transition in progress.
+   * \return the transition, or nullptr if it is not valid from that state.
+   */
+  const rcl_lifecycle_transition_t *
+  get_transition_by_id(unsigned int state_id, std::uint8_t transition_id) const;
+
   mutable std::recursive_mutex state_machine_mutex_;
   rcl_lifecycle_state_machine_t state_machine_;
   State current_state_;
+
+  /// Current rcl state, cached on transition completion for lock-free queries.
+  /**
+   * The pointed-to states are owned by the state machine and immutable after
+   * init(), so readers only need the pointer load to be atomic; state queries
+   * through this cache never take state_machine_mutex_.
+   */
+  std::atomic<const rcl_lifecycle_state_t *> cached_current_state_ {nullptr};
+
+  /// Flat transition lookup, indexed by state id * transition_id_count_ + transition id.
+  std::vector<const rcl_lifecycle_transition_t *> transition_table_;
+  size_t state_id_count_ {0};
+  size_t transition_id_count_ {0};
   std::map<
     std::uint8_t,
     std::function<node_interfaces::LifecycleNodeInterface::CallbackReturn(const State &)>> cb_map_;
@@ -155,6 +218,8 @@ private:
   using NodeBasePtr = std::shared_ptr<rclcpp::node_interfaces::NodeBaseInterface>;
   using NodeServicesPtr = std::shared_ptr<rclcpp::node_interfaces::NodeServicesInterface>;
   using NodeLoggingPtr = std::shared_ptr<rclcpp::node_interfaces::NodeLoggingInterface>;
+  using NodeGraphPtr = std::shared_ptr<rclcpp::node_interfaces::NodeGraphInterface>;
+  using NodeTopicsPtr = std::shared_ptr<rclcpp::node_interfaces::NodeTopicsInterface>;
   using ChangeStateSrvPtr = std::shared_ptr<rclcpp::Service<ChangeStateSrv>>;
   using GetStateSrvPtr = std::shared_ptr<rclcpp::Service<GetStateSrv>>;
   using GetAvailableStatesSrvPtr =
@@ -167,12 +232,24 @@ private:
   NodeBasePtr node_base_interface_;
   NodeServicesPtr node_services_interface_;
   NodeLoggingPtr node_logging_interface_;
+  NodeGraphPtr node_graph_interface_;
+  NodeTopicsPtr node_topics_interface_;
   ChangeStateSrvPtr srv_change_state_;
   GetStateSrvPtr srv_get_state_;
   GetAvailableStatesSrvPtr srv_get_available_states_;
   GetAvailableTransitionsSrvPtr srv_get_available_transitions_;
   GetTransitionGraphSrvPtr srv_get_transition_graph_;
 
+  /// Transition event publisher, only set by materialize_services().
+  /**
+   * Guarded by state_machine_mutex_: it is written by the graph watcher
+   * thread while change_state() may be publishing on another thread.
+   */
+  std::shared_ptr<rclcpp::Publisher<TransitionEventMsg>> pub_transition_event_;
+
+  std::thread graph_watcher_;
+  std::atomic<bool> stop_graph_watcher_ {false};
+
   // to controllable things
   std::vector<std::weak_ptr<rclcpp_lifecycle::ManagedEntityInterface>> weak_managed_entities_;
   std::vector<std::weak_ptr<rclcpp::TimerBase>> weak_timers_;
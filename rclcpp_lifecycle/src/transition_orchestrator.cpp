@@ -0,0 +1,181 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "rclcpp_lifecycle/transition_orchestrator.hpp"
+
+#include <chrono>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace rclcpp_lifecycle
+{
+
+TransitionOrchestrator::TransitionOrchestrator() {}
+
+TransitionOrchestrator::~TransitionOrchestrator() {}
+
+void
+TransitionOrchestrator::add_node(std::shared_ptr<rclcpp_lifecycle::LifecycleNode> node)
+{
+  if (!node) {
+    throw std::invalid_argument("node must not be nullptr");
+  }
+  const std::string name = node->get_name();
+  if (entries_.count(name) != 0) {
+    throw std::invalid_argument("node '" + name + "' was already added");
+  }
+  entries_[name].node = node;
+}
+
+void
+TransitionOrchestrator::add_remote_node(
+  const std::string & node_name,
+  rclcpp::Client<ChangeStateSrv>::SharedPtr client)
+{
+  if (!client) {
+    throw std::invalid_argument("client must not be nullptr");
+  }
+  if (entries_.count(node_name) != 0) {
+    throw std::invalid_argument("node '" + node_name + "' was already added");
+  }
+  entries_[node_name].client = client;
+}
+
+void
+TransitionOrchestrator::add_dependency(
+  const std::string & node_name, const std::string & depends_on)
+{
+  if (entries_.count(node_name) == 0) {
+    throw std::invalid_argument("unknown node '" + node_name + "'");
+  }
+  if (entries_.count(depends_on) == 0) {
+    throw std::invalid_argument("unknown node '" + depends_on + "'");
+  }
+  if (node_name == depends_on) {
+    throw std::invalid_argument("node '" + node_name + "' cannot depend on itself");
+  }
+  dependencies_.emplace(node_name, depends_on);
+}
+
+std::map<std::string, TransitionOrchestrator::CallbackReturn>
+TransitionOrchestrator::transition_all(
+  uint8_t transition_id,
+  std::chrono::nanoseconds service_timeout)
+{
+  std::map<std::string, CallbackReturn> results;
+  std::set<std::string> remaining;
+  std::set<std::string> skipped;
+  for (const auto & entry : entries_) {
+    remaining.insert(entry.first);
+  }
+
+  while (!remaining.empty()) {
+    // Collect the next wave: every remaining node whose dependencies have all
+    // transitioned successfully. Nodes with a failed or skipped dependency
+    // can never become ready, drop them up front.
+    std::vector<std::string> ready;
+    for (const auto & name : remaining) {
+      bool deps_met = true;
+      bool deps_failed = false;
+      auto range = dependencies_.equal_range(name);
+      for (auto it = range.first; it != range.second; ++it) {
+        auto result_it = results.find(it->second);
+        if (result_it != results.end() && CallbackReturn::SUCCESS == result_it->second) {
+          continue;
+        }
+        deps_met = false;
+        if (0 != skipped.count(it->second) ||
+          (result_it != results.end() && CallbackReturn::SUCCESS != result_it->second))
+        {
+          deps_failed = true;
+        }
+      }
+      if (deps_failed) {
+        skipped.insert(name);
+      } else if (deps_met) {
+        ready.push_back(name);
+      }
+    }
+    for (const auto & name : skipped) {
+      remaining.erase(name);
+    }
+    if (ready.empty()) {
+      if (remaining.empty()) {
+        break;
+      }
+      throw std::runtime_error("lifecycle transition dependencies form a cycle");
+    }
+
+    // Issue every remote request of the wave before waiting on any response,
+    // so the per-node service round trips overlap.
+    std::map<std::string, rclcpp::Client<ChangeStateSrv>::FutureAndRequestId> pending;
+    std::vector<std::thread> workers;
+    std::map<std::string, CallbackReturn> wave_results;
+    std::mutex wave_mutex;
+    for (const auto & name : ready) {
+      ManagedEntry & entry = entries_[name];
+      if (entry.client) {
+        auto request = std::make_shared<ChangeStateSrv::Request>();
+        request->transition.id = transition_id;
+        pending.emplace(name, entry.client->async_send_request(request));
+      } else {
+        // In-process fast path: invoke the transition callbacks directly.
+        workers.emplace_back(
+          [&entry, &wave_results, &wave_mutex, name, transition_id]() {
+            CallbackReturn cb_return_code = CallbackReturn::ERROR;
+            auto node = entry.node.lock();
+            if (node) {
+              try {
+                node->trigger_transition(transition_id, cb_return_code);
+              } catch (const std::exception &) {
+                cb_return_code = CallbackReturn::ERROR;
+              }
+            }
+            std::lock_guard<std::mutex> lock(wave_mutex);
+            wave_results.emplace(name, cb_return_code);
+          });
+      }
+    }
+    for (auto & worker : workers) {
+      worker.join();
+    }
+    for (auto & name_and_future : pending) {
+      CallbackReturn cb_return_code = CallbackReturn::ERROR;
+      if (std::future_status::ready == name_and_future.second.wait_for(service_timeout)) {
+        cb_return_code = name_and_future.second.get()->success ?
+          CallbackReturn::SUCCESS : CallbackReturn::FAILURE;
+      } else {
+        entries_[name_and_future.first].client->remove_pending_request(name_and_future.second);
+      }
+      wave_results.emplace(name_and_future.first, cb_return_code);
+    }
+
+    for (const auto & name_and_result : wave_results) {
+      results.emplace(name_and_result);
+      remaining.erase(name_and_result.first);
+    }
+  }
+
+  return results;
+}
+
+}  // namespace rclcpp_lifecycle
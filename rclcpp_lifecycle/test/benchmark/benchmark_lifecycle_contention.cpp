@@ -0,0 +1,164 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "lifecycle_msgs/msg/state.hpp"
+#include "lifecycle_msgs/msg/transition.hpp"
+#include "performance_test_fixture/performance_test_fixture.hpp"
+#include "rclcpp/rclcpp.hpp"
+#include "rclcpp_lifecycle/lifecycle_node.hpp"
+
+/**
+ * Benchmarks for the lifecycle state machine under load: full transition
+ * cycles, and state queries and transitions while other threads are reading
+ * the current state concurrently.  The state machine serializes access with a
+ * mutex, so single-threaded numbers understate the cost seen by nodes whose
+ * state is polled from monitoring threads.
+ */
+
+class BenchmarkLifecycleContention : public performance_test_fixture::PerformanceTest
+{
+public:
+  void SetUp(benchmark::State & state)
+  {
+    rclcpp::init(0, nullptr);
+    node = std::make_shared<rclcpp_lifecycle::LifecycleNode>("node", "ns");
+    performance_test_fixture::PerformanceTest::SetUp(state);
+  }
+
+  void TearDown(benchmark::State & state)
+  {
+    performance_test_fixture::PerformanceTest::TearDown(state);
+    node.reset();
+    rclcpp::shutdown();
+  }
+
+  /// Start count threads that poll get_current_state() until StopReaders().
+  void StartReaders(int count)
+  {
+    stop_readers.store(false);
+    for (int i = 0; i < count; ++i) {
+      readers.emplace_back(
+        [this]() {
+          while (!stop_readers.load()) {
+            benchmark::DoNotOptimize(node->get_current_state().id());
+          }
+        });
+    }
+  }
+
+  void StopReaders()
+  {
+    stop_readers.store(true);
+    for (auto & reader : readers) {
+      reader.join();
+    }
+    readers.clear();
+  }
+
+protected:
+  std::shared_ptr<rclcpp_lifecycle::LifecycleNode> node;
+  std::vector<std::thread> readers;
+  std::atomic<bool> stop_readers {false};
+};
+
+BENCHMARK_F(BenchmarkLifecycleContention, transition_full_cycle)(benchmark::State & state) {
+  for (auto _ : state) {
+    (void)_;
+    const std::uint8_t transitions[] = {
+      lifecycle_msgs::msg::Transition::TRANSITION_CONFIGURE,
+      lifecycle_msgs::msg::Transition::TRANSITION_ACTIVATE,
+      lifecycle_msgs::msg::Transition::TRANSITION_DEACTIVATE,
+      lifecycle_msgs::msg::Transition::TRANSITION_CLEANUP,
+    };
+    for (const std::uint8_t transition : transitions) {
+      const rclcpp_lifecycle::State & result = node->trigger_transition(transition);
+      benchmark::DoNotOptimize(const_cast<rclcpp_lifecycle::State &>(result));
+    }
+    if (node->get_current_state().id() !=
+      lifecycle_msgs::msg::State::PRIMARY_STATE_UNCONFIGURED)
+    {
+      state.SkipWithError("Full transition cycle did not return to unconfigured");
+    }
+    benchmark::ClobberMemory();
+  }
+  // Four transitions per cycle: items/sec reports transitions/sec.
+  state.SetItemsProcessed(state.iterations() * 4);
+}
+
+BENCHMARK_DEFINE_F(BenchmarkLifecycleContention, get_current_state_under_contention)(
+  benchmark::State & state)
+{
+  StartReaders(static_cast<int>(state.range(0)));
+
+  reset_heap_counters();
+  for (auto _ : state) {
+    (void)_;
+    const rclcpp_lifecycle::State & lifecycle_state = node->get_current_state();
+    if (lifecycle_state.id() != lifecycle_msgs::msg::State::PRIMARY_STATE_UNCONFIGURED) {
+      state.SkipWithError("Node left the unconfigured state");
+      break;
+    }
+    benchmark::DoNotOptimize(const_cast<rclcpp_lifecycle::State &>(lifecycle_state));
+    benchmark::ClobberMemory();
+  }
+
+  StopReaders();
+}
+BENCHMARK_REGISTER_F(BenchmarkLifecycleContention, get_current_state_under_contention)
+->Arg(1)->Arg(2)->Arg(4);
+
+BENCHMARK_DEFINE_F(BenchmarkLifecycleContention, trigger_transition_under_contention)(
+  benchmark::State & state)
+{
+  const auto & configured =
+    node->trigger_transition(lifecycle_msgs::msg::Transition::TRANSITION_CONFIGURE);
+  if (configured.id() != lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE) {
+    state.SkipWithError("Transition to configured state failed");
+  }
+  StartReaders(static_cast<int>(state.range(0)));
+
+  reset_heap_counters();
+  for (auto _ : state) {
+    (void)_;
+    const rclcpp_lifecycle::State & active =
+      node->trigger_transition(lifecycle_msgs::msg::Transition::TRANSITION_ACTIVATE);
+    if (active.id() != lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE) {
+      state.SkipWithError("Transition to active state failed");
+      break;
+    }
+    const rclcpp_lifecycle::State & inactive =
+      node->trigger_transition(lifecycle_msgs::msg::Transition::TRANSITION_DEACTIVATE);
+    if (inactive.id() != lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE) {
+      state.SkipWithError("Transition to inactive state failed");
+      break;
+    }
+    benchmark::DoNotOptimize(const_cast<rclcpp_lifecycle::State &>(active));
+    benchmark::DoNotOptimize(const_cast<rclcpp_lifecycle::State &>(inactive));
+    benchmark::ClobberMemory();
+  }
+
+  StopReaders();
+  state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK_REGISTER_F(BenchmarkLifecycleContention, trigger_transition_under_contention)
+->Arg(1)->Arg(2)->Arg(4);
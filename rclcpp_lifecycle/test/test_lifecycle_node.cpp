@@ -23,6 +23,7 @@
 
 #include "lifecycle_msgs/msg/state.hpp"
 #include "lifecycle_msgs/msg/transition.hpp"
+#include "lifecycle_msgs/srv/change_state.hpp"
 
 #include "rcl_lifecycle/rcl_lifecycle.h"
 
@@ -725,6 +726,31 @@ TEST_F(TestDefaultStateMachine, test_graph_services_by_node) {
     "lifecycle_msgs/srv/GetAvailableTransitions");
 }
 
+TEST_F(TestDefaultStateMachine, deferred_communication_interface) {
+  auto test_node = std::make_shared<rclcpp_lifecycle::LifecycleNode>(
+    "deferrednode", rclcpp::NodeOptions(), true, true);
+
+  // The state machine is fully usable before the services are materialized.
+  EXPECT_EQ(State::PRIMARY_STATE_UNCONFIGURED, test_node->get_current_state().id());
+
+  // None of the lifecycle services are advertised until a client shows up.
+  auto service_names_and_types = test_node->get_service_names_and_types();
+  EXPECT_EQ(0u, service_names_and_types.count("/deferrednode/change_state"));
+  EXPECT_EQ(0u, service_names_and_types.count("/deferrednode/get_state"));
+
+  // A matching client triggers materialization of all five services.
+  auto client_node = std::make_shared<rclcpp::Node>("clientnode");
+  auto client = client_node->create_client<lifecycle_msgs::srv::ChangeState>(
+    "/deferrednode/change_state");
+
+  ASSERT_TRUE(wait_for_service(test_node, "/deferrednode/change_state"));
+  ASSERT_TRUE(wait_for_service(test_node, "/deferrednode/get_available_states"));
+  ASSERT_TRUE(wait_for_service(test_node, "/deferrednode/get_available_transitions"));
+  ASSERT_TRUE(wait_for_service(test_node, "/deferrednode/get_state"));
+  ASSERT_TRUE(wait_for_service(test_node, "/deferrednode/get_transition_graph"));
+  ASSERT_TRUE(wait_for_topic(test_node, "/deferrednode/transition_event"));
+}
+
 TEST_F(TestDefaultStateMachine, test_callback_groups) {
   auto test_node = std::make_shared<EmptyLifecycleNode>("testnode");
   size_t num_groups = 0;
@@ -0,0 +1,144 @@
+// Copyright 2026 Open Source Robotics Foundation, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "lifecycle_msgs/msg/state.hpp"
+#include "lifecycle_msgs/msg/transition.hpp"
+
+#include "rclcpp/rclcpp.hpp"
+#include "rclcpp_lifecycle/lifecycle_node.hpp"
+#include "rclcpp_lifecycle/transition_orchestrator.hpp"
+
+using lifecycle_msgs::msg::State;
+using lifecycle_msgs::msg::Transition;
+using CallbackReturn = rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn;
+
+class TestTransitionOrchestrator : public ::testing::Test
+{
+protected:
+  static void SetUpTestCase()
+  {
+    rclcpp::init(0, nullptr);
+  }
+};
+
+class OrderedLifecycleNode : public rclcpp_lifecycle::LifecycleNode
+{
+public:
+  OrderedLifecycleNode(
+    std::string node_name, std::atomic<size_t> & sequence,
+    CallbackReturn configure_return = CallbackReturn::SUCCESS)
+  : rclcpp_lifecycle::LifecycleNode(std::move(node_name)),
+    sequence_(sequence),
+    configure_return_(configure_return)
+  {}
+
+  size_t configure_order = 0;
+
+protected:
+  CallbackReturn
+  on_configure(const rclcpp_lifecycle::State &) override
+  {
+    configure_order = ++sequence_;
+    return configure_return_;
+  }
+
+private:
+  std::atomic<size_t> & sequence_;
+  CallbackReturn configure_return_;
+};
+
+/*
+   Nodes transition in dependency order, dependents after their dependencies.
+ */
+TEST_F(TestTransitionOrchestrator, dependency_ordering) {
+  std::atomic<size_t> sequence {0};
+  auto node_a = std::make_shared<OrderedLifecycleNode>("orch_node_a", sequence);
+  auto node_b = std::make_shared<OrderedLifecycleNode>("orch_node_b", sequence);
+  auto node_c = std::make_shared<OrderedLifecycleNode>("orch_node_c", sequence);
+
+  rclcpp_lifecycle::TransitionOrchestrator orchestrator;
+  orchestrator.add_node(node_a);
+  orchestrator.add_node(node_b);
+  orchestrator.add_node(node_c);
+  orchestrator.add_dependency("orch_node_b", "orch_node_a");
+  orchestrator.add_dependency("orch_node_c", "orch_node_b");
+
+  auto results = orchestrator.transition_all(Transition::TRANSITION_CONFIGURE);
+
+  ASSERT_EQ(3u, results.size());
+  EXPECT_EQ(CallbackReturn::SUCCESS, results["orch_node_a"]);
+  EXPECT_EQ(CallbackReturn::SUCCESS, results["orch_node_b"]);
+  EXPECT_EQ(CallbackReturn::SUCCESS, results["orch_node_c"]);
+  EXPECT_LT(node_a->configure_order, node_b->configure_order);
+  EXPECT_LT(node_b->configure_order, node_c->configure_order);
+  EXPECT_EQ(
+    State::PRIMARY_STATE_INACTIVE, node_c->get_current_state().id());
+}
+
+/*
+   A failed dependency skips its dependents, independent nodes still run.
+ */
+TEST_F(TestTransitionOrchestrator, failed_dependency_skips_dependents) {
+  std::atomic<size_t> sequence {0};
+  auto failing = std::make_shared<OrderedLifecycleNode>(
+    "orch_failing", sequence, CallbackReturn::FAILURE);
+  auto dependent = std::make_shared<OrderedLifecycleNode>("orch_dependent", sequence);
+  auto independent = std::make_shared<OrderedLifecycleNode>("orch_independent", sequence);
+
+  rclcpp_lifecycle::TransitionOrchestrator orchestrator;
+  orchestrator.add_node(failing);
+  orchestrator.add_node(dependent);
+  orchestrator.add_node(independent);
+  orchestrator.add_dependency("orch_dependent", "orch_failing");
+
+  auto results = orchestrator.transition_all(Transition::TRANSITION_CONFIGURE);
+
+  ASSERT_EQ(2u, results.size());
+  EXPECT_EQ(CallbackReturn::FAILURE, results["orch_failing"]);
+  EXPECT_EQ(0u, results.count("orch_dependent"));
+  EXPECT_EQ(CallbackReturn::SUCCESS, results["orch_independent"]);
+  EXPECT_EQ(0u, dependent->configure_order);
+}
+
+/*
+   Invalid configurations are rejected up front.
+ */
+TEST_F(TestTransitionOrchestrator, invalid_arguments) {
+  std::atomic<size_t> sequence {0};
+  auto node_a = std::make_shared<OrderedLifecycleNode>("orch_inv_a", sequence);
+  auto node_b = std::make_shared<OrderedLifecycleNode>("orch_inv_b", sequence);
+
+  rclcpp_lifecycle::TransitionOrchestrator orchestrator;
+  orchestrator.add_node(node_a);
+  orchestrator.add_node(node_b);
+
+  EXPECT_THROW(orchestrator.add_node(nullptr), std::invalid_argument);
+  EXPECT_THROW(orchestrator.add_node(node_a), std::invalid_argument);
+  EXPECT_THROW(orchestrator.add_remote_node("orch_inv_a", nullptr), std::invalid_argument);
+  EXPECT_THROW(orchestrator.add_dependency("orch_inv_a", "no_such_node"), std::invalid_argument);
+  EXPECT_THROW(orchestrator.add_dependency("orch_inv_a", "orch_inv_a"), std::invalid_argument);
+
+  orchestrator.add_dependency("orch_inv_a", "orch_inv_b");
+  orchestrator.add_dependency("orch_inv_b", "orch_inv_a");
+  EXPECT_THROW(
+    orchestrator.transition_all(Transition::TRANSITION_CONFIGURE), std::runtime_error);
+}